@@ -0,0 +1,92 @@
+#version 450
+
+// Grass variant of the instanced vertex shader: identical transform
+// decoding, plus wind sway computed entirely on the GPU from the frame
+// time uniform. Blades are modeled with their base at y = 0, so bend
+// weight grows with vertex height and the root stays planted. The CPU
+// never touches individual blades - it only uploads one instance per
+// blade once and a wind/rustle strength per instance per frame.
+
+// Uniform buffer for per-frame data (view, projection, camera)
+layout(set = 0, binding = 0) uniform UniformBufferObject {
+    mat4 view;
+    mat4 proj;
+    vec3 cameraPos;
+    float time;  // Seconds since renderer start - drives shader-side animation
+} ubo;
+
+layout(set = 0, binding = 2) uniform LightingData {
+    vec3 directionalLightDir;
+    float directionalLightIntensity;
+    vec3 directionalLightColor;
+    float _padding1;
+    vec3 ambientColor;
+    float ambientIntensity;
+    vec4 clusterInfo;  // x: zNear, y: zFar, z/w: screen size
+} lighting;
+
+// Per-vertex input attributes (binding 0)
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec3 inColor;
+
+// Per-instance input attributes (binding 1) - same compressed transform
+// as instanced.vert. For grass, materialParams.z carries the wind
+// strength (base wind plus the patch's current rustle intensity).
+layout(location = 4) in vec4 instancePositionScale;  // xyz: world position, w: uniform scale
+layout(location = 5) in vec4 instanceRotation;       // unit quaternion (x, y, z, w)
+layout(location = 6) in vec4 instanceMaterialParams; // material ID + bindless slot + wind strength
+
+// Output to fragment shader
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 2) out vec3 fragNormal;
+layout(location = 3) out vec3 worldPos;
+layout(location = 4) out vec3 cameraPos;
+layout(location = 5) out float materialId;
+layout(location = 6) flat out uint textureIndex;
+layout(location = 7) out float viewDepth;
+
+// Rotate a vector by a unit quaternion (q.xyz imaginary, q.w real)
+vec3 rotateByQuat(vec4 q, vec3 v) {
+    return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v);
+}
+
+void main() {
+    // Decode the compressed transform: scale, rotate, translate
+    vec3 worldPosition = instancePositionScale.xyz
+                       + rotateByQuat(instanceRotation, inPosition * instancePositionScale.w);
+
+    // Wind sway: two sine waves at different frequencies give a gusty
+    // feel, phase-offset by world position so neighbouring blades don't
+    // move in lockstep. Bend weight is the blade-local height, keeping
+    // the root anchored.
+    float windStrength = instanceMaterialParams.z;
+    float bendWeight = max(inPosition.y, 0.0) * instancePositionScale.w;
+    float phase = dot(instancePositionScale.xz, vec2(0.37, 0.73));
+    float sway = sin(ubo.time * 1.7 + phase)
+               + 0.4 * sin(ubo.time * 3.9 + phase * 1.3);
+    vec2 windDir = normalize(vec2(0.8, 0.6));
+    worldPosition.xz += windDir * sway * windStrength * 0.12 * bendWeight;
+    worldPos = worldPosition;
+
+    // Complete MVP transformation: Projection * View * Model (instanced)
+    gl_Position = ubo.proj * ubo.view * vec4(worldPosition, 1.0);
+
+    // Positive view-space depth for the light cluster lookup
+    viewDepth = -(ubo.view * vec4(worldPosition, 1.0)).z;
+
+    // Sway is a small shear; the unbent normal is visually fine for
+    // grass-scale geometry
+    fragNormal = rotateByQuat(instanceRotation, inNormal);
+
+    // Pass through vertex attributes
+    fragColor = inColor;
+    fragTexCoord = inTexCoord;
+    cameraPos = ubo.cameraPos;
+
+    // Pass instance material ID to fragment shader
+    materialId = instanceMaterialParams.x;
+    textureIndex = uint(instanceMaterialParams.y + 0.5);  // bindless texture slot
+}
@@ -1,4 +1,5 @@
 #version 450
+#extension GL_EXT_nonuniform_qualifier : require
 
 // Input from vertex shader
 layout(location = 0) in vec3 fragColor;
@@ -7,9 +8,17 @@ layout(location = 2) in vec3 fragNormal;
 layout(location = 3) in vec3 worldPos;
 layout(location = 4) in vec3 cameraPos;
 layout(location = 5) in float materialId;
+layout(location = 6) flat in uint textureIndex;
+layout(location = 7) in float viewDepth;
+
+// Specialization constants - folded at pipeline creation time (see
+// ShaderSpecialization.h), so disabled features cost no branches
+layout(constant_id = 0) const bool ENABLE_AMBIENT = true;
+layout(constant_id = 1) const uint SPECULAR_MODEL = 1;  // 0 = off, 1 = Blinn-Phong, 2 = classic Phong
 
 // Descriptors
-layout(set = 0, binding = 1) uniform sampler2D texSampler;
+// Global bindless texture array - per-instance slot carried in instance data
+layout(set = 2, binding = 0) uniform sampler2D bindlessTextures[];
 
 layout(set = 0, binding = 2) uniform LightingData {
     vec3 directionalLightDir;
@@ -18,8 +27,33 @@ layout(set = 0, binding = 2) uniform LightingData {
     float _padding1;
     vec3 ambientColor;
     float ambientIntensity;
+    vec4 clusterInfo;  // x: zNear, y: zFar, z/w: screen size
 } lighting;
 
+// Clustered point lights - CPU-binned froxel grid, 16x9 screen tiles
+// with 24 exponential depth slices. Each fragment reads its cluster's
+// (offset, count) range and iterates only those lights.
+const uint CLUSTER_DIM_X = 16;
+const uint CLUSTER_DIM_Y = 9;
+const uint CLUSTER_DIM_Z = 24;
+
+struct PointLight {
+    vec4 positionRadius;   // xyz: world position, w: influence radius
+    vec4 colorIntensity;   // rgb: color, a: intensity
+};
+
+layout(std430, set = 0, binding = 3) readonly buffer PointLightBuffer {
+    PointLight pointLights[];
+};
+
+layout(std430, set = 0, binding = 4) readonly buffer ClusterRangeBuffer {
+    uvec2 clusterRanges[];  // x: offset into index list, y: count
+};
+
+layout(std430, set = 0, binding = 5) readonly buffer LightIndexBuffer {
+    uint lightIndices[];
+};
+
 layout(set = 1, binding = 0) uniform MaterialData {
     vec4 ambient;
     vec4 diffuse;
@@ -33,15 +67,65 @@ layout(set = 1, binding = 0) uniform MaterialData {
 // Output
 layout(location = 0) out vec4 outColor;
 
+// Specular factor for the selected model; the branch is compile-time
+float specularTerm(vec3 normal, vec3 lightDir, vec3 viewDir, float shininess) {
+    if (SPECULAR_MODEL == 1) {
+        vec3 halfwayDir = normalize(lightDir + viewDir);
+        return pow(max(dot(normal, halfwayDir), 0.0), shininess);
+    } else if (SPECULAR_MODEL == 2) {
+        vec3 reflectDir = reflect(-lightDir, normal);
+        return pow(max(dot(viewDir, reflectDir), 0.0), shininess);
+    }
+    return 0.0;
+}
+
+// Accumulated contribution from this fragment's cluster
+vec3 clusteredPointLights(vec3 normal, vec3 viewDir) {
+    float zNear = lighting.clusterInfo.x;
+    float zFar = lighting.clusterInfo.y;
+
+    uint tileX = min(uint(gl_FragCoord.x * float(CLUSTER_DIM_X) / lighting.clusterInfo.z), CLUSTER_DIM_X - 1);
+    uint tileY = min(uint(gl_FragCoord.y * float(CLUSTER_DIM_Y) / lighting.clusterInfo.w), CLUSTER_DIM_Y - 1);
+    uint slice = uint(clamp(log(max(viewDepth, zNear) / zNear) / log(zFar / zNear) * float(CLUSTER_DIM_Z),
+                            0.0, float(CLUSTER_DIM_Z) - 1.0));
+    uvec2 range = clusterRanges[(slice * CLUSTER_DIM_Y + tileY) * CLUSTER_DIM_X + tileX];
+
+    vec3 result = vec3(0.0);
+    for (uint i = 0; i < range.y; ++i) {
+        PointLight light = pointLights[lightIndices[range.x + i]];
+
+        vec3 toLight = light.positionRadius.xyz - worldPos;
+        float dist = length(toLight);
+        if (dist >= light.positionRadius.w) {
+            continue;
+        }
+
+        // Smooth quadratic falloff that reaches exactly zero at the
+        // influence radius, matching the CPU binning bounds
+        float atten = 1.0 - dist / light.positionRadius.w;
+        atten *= atten;
+
+        vec3 lightDir = toLight / max(dist, 0.0001);
+        float diff = max(dot(normal, lightDir), 0.0);
+        float spec = specularTerm(normal, lightDir, viewDir, material.shininess);
+
+        vec3 radiance = light.colorIntensity.rgb * light.colorIntensity.a * atten;
+        result += radiance * (diff * material.diffuse.rgb + spec * material.specular.rgb);
+    }
+    return result;
+}
+
 void main() {
     // Base color from texture and vertex color
-    vec4 baseColor = texture(texSampler, fragTexCoord) * vec4(fragColor, 1.0);
+    vec4 baseColor = texture(bindlessTextures[nonuniformEXT(textureIndex)], fragTexCoord) * vec4(fragColor, 1.0);
 
     // Normalize the normal vector
     vec3 normal = normalize(fragNormal);
 
-    // Ambient lighting
-    vec3 ambient = lighting.ambientColor * lighting.ambientIntensity * material.ambient.rgb;
+    // Ambient lighting (compiled out when the variant disables it)
+    vec3 ambient = ENABLE_AMBIENT
+        ? lighting.ambientColor * lighting.ambientIntensity * material.ambient.rgb
+        : vec3(0.0);
 
     // Diffuse lighting
     vec3 lightDir = normalize(-lighting.directionalLightDir);
@@ -49,15 +133,17 @@ void main() {
     vec3 diffuse = lighting.directionalLightColor * lighting.directionalLightIntensity *
                    diffuseFactor * material.diffuse.rgb;
 
-    // Specular lighting (Blinn-Phong)
+    // Specular lighting with the variant's specular model
     vec3 viewDir = normalize(cameraPos - worldPos);
-    vec3 halfwayDir = normalize(lightDir + viewDir);
-    float specularFactor = pow(max(dot(normal, halfwayDir), 0.0), material.shininess);
+    float specularFactor = specularTerm(normal, lightDir, viewDir, material.shininess);
     vec3 specular = lighting.directionalLightColor * lighting.directionalLightIntensity *
                     specularFactor * material.specular.rgb;
 
     // Combine lighting components with base color
     vec3 lighting_result = (ambient + diffuse + specular);
+
+    // Add this fragment's clustered point lights (torches, glow, spells)
+    lighting_result += clusteredPointLights(normal, viewDir);
     outColor = vec4(lighting_result * baseColor.rgb, baseColor.a);
 
     // Optional: Debug material ID with subtle color tinting
@@ -5,7 +5,7 @@ layout(set = 0, binding = 0) uniform UniformBufferObject {
     mat4 view;
     mat4 proj;
     vec3 cameraPos;
-    float _padding;
+    float time;  // Seconds since renderer start - drives shader-side animation
 } ubo;
 
 layout(set = 0, binding = 2) uniform LightingData {
@@ -15,6 +15,7 @@ layout(set = 0, binding = 2) uniform LightingData {
     float _padding1;
     vec3 ambientColor;
     float ambientIntensity;
+    vec4 clusterInfo;  // x: zNear, y: zFar, z/w: screen size
 } lighting;
 
 // Per-vertex input attributes (binding 0)
@@ -23,13 +24,12 @@ layout(location = 1) in vec3 inNormal;
 layout(location = 2) in vec2 inTexCoord;
 layout(location = 3) in vec3 inColor;
 
-// Per-instance input attributes (binding 1) - GPU instancing data
-layout(location = 4) in vec4 instanceModelMatrix0;  // First row of model matrix
-layout(location = 5) in vec4 instanceModelMatrix1;  // Second row of model matrix
-layout(location = 6) in vec4 instanceModelMatrix2;  // Third row of model matrix
-layout(location = 7) in vec4 instanceModelMatrix3;  // Fourth row of model matrix
-layout(location = 8) in vec4 instanceMaterialParams; // Material ID + custom params
-layout(location = 9) in vec4 instanceLodParams;     // LOD level + distance + custom
+// Per-instance input attributes (binding 1) - compressed transform:
+// position + uniform scale + unit quaternion instead of a full model
+// matrix, halving the per-instance bandwidth
+layout(location = 4) in vec4 instancePositionScale;  // xyz: world position, w: uniform scale
+layout(location = 5) in vec4 instanceRotation;       // unit quaternion (x, y, z, w)
+layout(location = 6) in vec4 instanceMaterialParams; // material ID + bindless slot + LOD + distance
 
 // Output to fragment shader
 layout(location = 0) out vec3 fragColor;
@@ -38,25 +38,29 @@ layout(location = 2) out vec3 fragNormal;
 layout(location = 3) out vec3 worldPos;
 layout(location = 4) out vec3 cameraPos;
 layout(location = 5) out float materialId;
+layout(location = 6) flat out uint textureIndex;
+layout(location = 7) out float viewDepth;
 
-void main() {
-    // Reconstruct the model matrix from per-instance data
-    mat4 instanceModelMatrix = mat4(
-        instanceModelMatrix0,
-        instanceModelMatrix1,
-        instanceModelMatrix2,
-        instanceModelMatrix3
-    );
+// Rotate a vector by a unit quaternion (q.xyz imaginary, q.w real)
+vec3 rotateByQuat(vec4 q, vec3 v) {
+    return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v);
+}
 
-    // Calculate world position using instance-specific model matrix
-    vec4 worldPosition = instanceModelMatrix * vec4(inPosition, 1.0);
-    worldPos = worldPosition.xyz;
+void main() {
+    // Decode the compressed transform: scale, rotate, translate
+    vec3 worldPosition = instancePositionScale.xyz
+                       + rotateByQuat(instanceRotation, inPosition * instancePositionScale.w);
+    worldPos = worldPosition;
 
     // Complete MVP transformation: Projection * View * Model (instanced)
-    gl_Position = ubo.proj * ubo.view * worldPosition;
+    gl_Position = ubo.proj * ubo.view * vec4(worldPosition, 1.0);
+
+    // Positive view-space depth for the light cluster lookup
+    viewDepth = -(ubo.view * vec4(worldPosition, 1.0)).z;
 
-    // Transform normal to world space using instance model matrix
-    fragNormal = mat3(transpose(inverse(instanceModelMatrix))) * inNormal;
+    // Uniform scale means the normal only needs the rotation - no
+    // inverse-transpose required
+    fragNormal = rotateByQuat(instanceRotation, inNormal);
 
     // Pass through vertex attributes
     fragColor = inColor;
@@ -65,4 +69,5 @@ void main() {
 
     // Pass instance material ID to fragment shader
     materialId = instanceMaterialParams.x;
+    textureIndex = uint(instanceMaterialParams.y + 0.5);  // bindless texture slot
 }
\ No newline at end of file
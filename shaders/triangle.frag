@@ -1,6 +1,18 @@
 #version 450
+#extension GL_EXT_nonuniform_qualifier : require
 
-layout(set = 0, binding = 1) uniform sampler2D texSampler;
+// Global bindless texture array - draws pick a slot via push constant
+// instead of rebinding descriptor sets per texture
+layout(set = 2, binding = 0) uniform sampler2D bindlessTextures[];
+
+layout(push_constant) uniform PushConstants {
+    layout(offset = 64) uint textureIndex;  // slot 0 = default texture
+} pc;
+
+// Specialization constants - folded at pipeline creation time (see
+// ShaderSpecialization.h), so disabled features cost no branches
+layout(constant_id = 0) const bool ENABLE_AMBIENT = true;
+layout(constant_id = 1) const uint SPECULAR_MODEL = 1;  // 0 = off, 1 = Blinn-Phong, 2 = classic Phong
 
 layout(set = 0, binding = 2) uniform LightingData {
     vec3 directionalLightDir;
@@ -9,8 +21,33 @@ layout(set = 0, binding = 2) uniform LightingData {
     float _padding1;
     vec3 ambientColor;
     float ambientIntensity;
+    vec4 clusterInfo;  // x: zNear, y: zFar, z/w: screen size
 } lighting;
 
+// Clustered point lights - CPU-binned froxel grid, 16x9 screen tiles
+// with 24 exponential depth slices. Each fragment reads its cluster's
+// (offset, count) range and iterates only those lights.
+const uint CLUSTER_DIM_X = 16;
+const uint CLUSTER_DIM_Y = 9;
+const uint CLUSTER_DIM_Z = 24;
+
+struct PointLight {
+    vec4 positionRadius;   // xyz: world position, w: influence radius
+    vec4 colorIntensity;   // rgb: color, a: intensity
+};
+
+layout(std430, set = 0, binding = 3) readonly buffer PointLightBuffer {
+    PointLight pointLights[];
+};
+
+layout(std430, set = 0, binding = 4) readonly buffer ClusterRangeBuffer {
+    uvec2 clusterRanges[];  // x: offset into index list, y: count
+};
+
+layout(std430, set = 0, binding = 5) readonly buffer LightIndexBuffer {
+    uint lightIndices[];
+};
+
 layout(set = 1, binding = 0) uniform MaterialData {
     vec4 ambient;
     vec4 diffuse;
@@ -24,32 +61,86 @@ layout(location = 1) in vec2 fragTexCoord;
 layout(location = 2) in vec3 fragNormal;
 layout(location = 3) in vec3 worldPos;
 layout(location = 4) in vec3 cameraPos;
+layout(location = 5) in float viewDepth;
 
 layout(location = 0) out vec4 outColor;
 
+// Specular factor for the selected model; the branch is compile-time
+float specularTerm(vec3 normal, vec3 lightDir, vec3 viewDir, float shininess) {
+    if (SPECULAR_MODEL == 1) {
+        vec3 halfwayDir = normalize(lightDir + viewDir);
+        return pow(max(dot(normal, halfwayDir), 0.0), shininess);
+    } else if (SPECULAR_MODEL == 2) {
+        vec3 reflectDir = reflect(-lightDir, normal);
+        return pow(max(dot(viewDir, reflectDir), 0.0), shininess);
+    }
+    return 0.0;
+}
+
+// Accumulated contribution from this fragment's cluster
+vec3 clusteredPointLights(vec3 normal, vec3 viewDir) {
+    float zNear = lighting.clusterInfo.x;
+    float zFar = lighting.clusterInfo.y;
+
+    uint tileX = min(uint(gl_FragCoord.x * float(CLUSTER_DIM_X) / lighting.clusterInfo.z), CLUSTER_DIM_X - 1);
+    uint tileY = min(uint(gl_FragCoord.y * float(CLUSTER_DIM_Y) / lighting.clusterInfo.w), CLUSTER_DIM_Y - 1);
+    uint slice = uint(clamp(log(max(viewDepth, zNear) / zNear) / log(zFar / zNear) * float(CLUSTER_DIM_Z),
+                            0.0, float(CLUSTER_DIM_Z) - 1.0));
+    uvec2 range = clusterRanges[(slice * CLUSTER_DIM_Y + tileY) * CLUSTER_DIM_X + tileX];
+
+    vec3 result = vec3(0.0);
+    for (uint i = 0; i < range.y; ++i) {
+        PointLight light = pointLights[lightIndices[range.x + i]];
+
+        vec3 toLight = light.positionRadius.xyz - worldPos;
+        float dist = length(toLight);
+        if (dist >= light.positionRadius.w) {
+            continue;
+        }
+
+        // Smooth quadratic falloff that reaches exactly zero at the
+        // influence radius, matching the CPU binning bounds
+        float atten = 1.0 - dist / light.positionRadius.w;
+        atten *= atten;
+
+        vec3 lightDir = toLight / max(dist, 0.0001);
+        float diff = max(dot(normal, lightDir), 0.0);
+        float spec = specularTerm(normal, lightDir, viewDir, material.shininess);
+
+        vec3 radiance = light.colorIntensity.rgb * light.colorIntensity.a * atten;
+        result += radiance * (diff * material.diffuse.xyz + spec * material.specular.xyz);
+    }
+    return result;
+}
+
 void main() {
     // Normalize the interpolated normal
     vec3 normal = normalize(fragNormal);
     
     // Sample texture for base color (optional - can be used to modulate materials)
-    vec3 textureColor = texture(texSampler, fragTexCoord).rgb;
+    vec3 textureColor = texture(bindlessTextures[nonuniformEXT(pc.textureIndex)], fragTexCoord).rgb;
     
     // Calculate ambient lighting with material ambient property
-    vec3 ambient = lighting.ambientColor * lighting.ambientIntensity * material.ambient.xyz;
-    
+    // (compiled out entirely when the variant disables ambient)
+    vec3 ambient = ENABLE_AMBIENT
+        ? lighting.ambientColor * lighting.ambientIntensity * material.ambient.xyz
+        : vec3(0.0);
+
     // Calculate directional lighting with material diffuse property
     vec3 lightDir = normalize(-lighting.directionalLightDir);
     float diff = max(dot(normal, lightDir), 0.0);
     vec3 diffuse = diff * lighting.directionalLightColor * lighting.directionalLightIntensity * material.diffuse.xyz;
-    
-    // Calculate specular lighting with material specular property (Blinn-Phong)
+
+    // Specular lighting with the variant's specular model
     vec3 viewDir = normalize(cameraPos - worldPos);
-    vec3 halfwayDir = normalize(lightDir + viewDir);
-    float spec = pow(max(dot(normal, halfwayDir), 0.0), material.shininess);
+    float spec = specularTerm(normal, lightDir, viewDir, material.shininess);
     vec3 specular = spec * lighting.directionalLightColor * lighting.directionalLightIntensity * material.specular.xyz;
     
     // Combine lighting components - material properties ARE the color
     vec3 result = ambient + diffuse + specular;
+
+    // Add this fragment's clustered point lights (torches, glow, spells)
+    result += clusteredPointLights(normal, viewDir);
     
     // Optionally modulate with texture (can be disabled for pure material testing)
     // result *= textureColor;
@@ -10,7 +10,7 @@ layout(set = 0, binding = 0) uniform UniformBufferObject {
     mat4 view;
     mat4 proj;
     vec3 cameraPos;
-    float _padding;
+    float time;  // Seconds since renderer start - drives shader-side animation
 } ubo;
 
 layout(set = 0, binding = 2) uniform LightingData {
@@ -20,6 +20,7 @@ layout(set = 0, binding = 2) uniform LightingData {
     float _padding1;
     vec3 ambientColor;
     float ambientIntensity;
+    vec4 clusterInfo;  // x: zNear, y: zFar, z/w: screen size
 } lighting;
 
 layout(location = 0) in vec3 inPosition;
@@ -32,6 +33,7 @@ layout(location = 1) out vec2 fragTexCoord;
 layout(location = 2) out vec3 fragNormal;
 layout(location = 3) out vec3 worldPos;
 layout(location = 4) out vec3 cameraPos;
+layout(location = 5) out float viewDepth;
 
 void main() {
     // Calculate world position for lighting calculations using push constant model matrix
@@ -41,6 +43,9 @@ void main() {
     // Complete MVP transformation: Projection * View * Model
     gl_Position = ubo.proj * ubo.view * worldPosition;
 
+    // Positive view-space depth for the light cluster lookup
+    viewDepth = -(ubo.view * worldPosition).z;
+
     // Transform normal to world space (using normal matrix from push constants)
     fragNormal = mat3(transpose(inverse(push.model))) * inNormal;
     
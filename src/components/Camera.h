@@ -26,12 +26,35 @@ struct Camera {
     mutable glm::mat4 viewProjectionMatrix = glm::mat4(1.0f);
     mutable bool isDirty = true;
 
+    // Set whenever view or projection actually changes; consumed by
+    // CameraSystem so the frustum is only re-extracted on camera change
+    mutable bool frustumDirty = true;
+
+    // Inputs the cached matrices were built from - CameraSystem calls
+    // the update methods every frame, and these guards turn unchanged
+    // frames into early-outs instead of rebuilds that re-dirty everything
+    mutable glm::vec3 builtViewPosition{0.0f};
+    mutable glm::vec3 builtViewForward{0.0f};
+    mutable glm::vec3 builtViewUp{0.0f};
+    mutable bool viewBuilt = false;
+    mutable float builtFov = 0.0f;
+    mutable float builtAspectRatio = 0.0f;
+    mutable float builtNearPlane = 0.0f;
+    mutable float builtFarPlane = 0.0f;
+    mutable float builtOrthoLeft = 0.0f;
+    mutable float builtOrthoRight = 0.0f;
+    mutable float builtOrthoBottom = 0.0f;
+    mutable float builtOrthoTop = 0.0f;
+    mutable bool projectionBuilt = false;
+
     // Camera type
     enum class Type {
         PERSPECTIVE,
         ORTHOGRAPHIC
     } type = Type::PERSPECTIVE;
 
+    mutable Type builtType = Type::PERSPECTIVE; // projection type the cache was built for
+
     // Orthographic camera parameters (only used if type == ORTHOGRAPHIC)
     float orthoLeft = -10.0f;
     float orthoRight = 10.0f;
@@ -44,20 +67,54 @@ struct Camera {
     Camera(float fieldOfView, float aspect, float near, float far)
         : fov(fieldOfView), aspectRatio(aspect), nearPlane(near), farPlane(far) {}
 
-    // Update projection matrix (call when camera parameters change)
+    // Update projection matrix (call when camera parameters change).
+    // Safe to call every frame: unchanged parameters early-out without
+    // rebuilding or re-dirtying the cached view-projection and frustum
     void updateProjectionMatrix() const {
+        if (projectionBuilt && type == builtType &&
+            fov == builtFov && aspectRatio == builtAspectRatio &&
+            nearPlane == builtNearPlane && farPlane == builtFarPlane &&
+            orthoLeft == builtOrthoLeft && orthoRight == builtOrthoRight &&
+            orthoBottom == builtOrthoBottom && orthoTop == builtOrthoTop) {
+            return;
+        }
+
         if (type == Type::PERSPECTIVE) {
             projectionMatrix = glm::perspective(glm::radians(fov), aspectRatio, nearPlane, farPlane);
         } else {
             projectionMatrix = glm::ortho(orthoLeft, orthoRight, orthoBottom, orthoTop, nearPlane, farPlane);
         }
+
+        builtType = type;
+        builtFov = fov;
+        builtAspectRatio = aspectRatio;
+        builtNearPlane = nearPlane;
+        builtFarPlane = farPlane;
+        builtOrthoLeft = orthoLeft;
+        builtOrthoRight = orthoRight;
+        builtOrthoBottom = orthoBottom;
+        builtOrthoTop = orthoTop;
+        projectionBuilt = true;
         isDirty = true;
+        frustumDirty = true;
     }
 
-    // Update view matrix from transform (call when transform changes)
+    // Update view matrix from transform (call when transform changes).
+    // Same contract as the projection update: an unmoved camera skips
+    // the lookAt and keeps the frustum cache valid
     void updateViewMatrix(const glm::vec3& position, const glm::vec3& forward, const glm::vec3& up) const {
+        if (viewBuilt && position == builtViewPosition &&
+            forward == builtViewForward && up == builtViewUp) {
+            return;
+        }
+
         viewMatrix = glm::lookAt(position, position + forward, up);
+        builtViewPosition = position;
+        builtViewForward = forward;
+        builtViewUp = up;
+        viewBuilt = true;
         isDirty = true;
+        frustumDirty = true;
     }
 
     // Get combined view-projection matrix
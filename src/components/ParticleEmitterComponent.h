@@ -0,0 +1,96 @@
+#pragma once
+
+#include "../core/Entity.h"
+#include <glm/glm.hpp>
+
+namespace VulkanMon {
+
+/**
+ * ParticleEmitterComponent
+ *
+ * Attaches a GPU particle emitter to an entity. The component only holds
+ * emission parameters and a rate accumulator - the particles themselves
+ * live entirely in a device-local pool simulated by the renderer's
+ * compute pass, so emitters scale to Pokemon-density effect counts with
+ * no per-particle CPU cost.
+ *
+ * Continuous emission (emissionRate) and one-shot bursts (pendingBurst)
+ * can be combined freely; ParticleSystem drains both each frame.
+ */
+struct ParticleEmitterComponent {
+    VKMON_COMPONENT(ParticleEmitterComponent)
+
+    bool enabled = true;
+
+    // Continuous emission in particles per second; fractional particles
+    // carry over between frames through the accumulator
+    float emissionRate = 0.0f;
+    float emissionAccumulator = 0.0f;
+
+    // One-shot burst staged by gameplay code (impact, capture flash).
+    // Consumed and reset to zero by ParticleSystem on the next update
+    uint32_t pendingBurst = 0;
+
+    // Spawn shape and motion, forwarded to the GPU emit request
+    glm::vec3 localOffset{0.0f};             // spawn point relative to the entity
+    glm::vec3 direction{0.0f, 1.0f, 0.0f};   // cone axis in world space
+    float baseSpeed = 1.0f;                  // m/s, jittered per particle on the GPU
+    float spread = 0.25f;                    // 0 = beam, 1 = full sphere
+    float lifetimeSeconds = 2.0f;
+    float particleSize = 0.1f;
+    float gravityScale = 0.0f;               // 0 = floating, 1 = ballistic
+    float drag = 0.0f;                       // per-second velocity damping
+    uint32_t materialId = 0;
+
+    ParticleEmitterComponent() = default;
+
+    // Continuous trail behind a moving projectile
+    static ParticleEmitterComponent createTrail(uint32_t materialId = 0, float rate = 120.0f) {
+        ParticleEmitterComponent emitter;
+        emitter.emissionRate = rate;
+        emitter.direction = {0.0f, 0.0f, 1.0f};  // opposite the flight direction
+        emitter.baseSpeed = 0.5f;
+        emitter.spread = 0.15f;
+        emitter.lifetimeSeconds = 0.6f;
+        emitter.particleSize = 0.05f;
+        emitter.drag = 2.0f;                     // trail hangs in the air briefly
+        emitter.materialId = materialId;
+        return emitter;
+    }
+
+    // One-shot spherical burst for impacts and captures; stage the burst
+    // count again via triggerBurst() to refire
+    static ParticleEmitterComponent createImpactBurst(uint32_t materialId = 0, uint32_t count = 64) {
+        ParticleEmitterComponent emitter;
+        emitter.pendingBurst = count;
+        emitter.baseSpeed = 6.0f;
+        emitter.spread = 1.0f;                   // full sphere
+        emitter.lifetimeSeconds = 0.8f;
+        emitter.particleSize = 0.08f;
+        emitter.gravityScale = 1.0f;             // debris falls
+        emitter.drag = 1.0f;
+        emitter.materialId = materialId;
+        return emitter;
+    }
+
+    // Slow ambient drift for grass spores, fireflies, falling leaves
+    static ParticleEmitterComponent createAmbientSpores(uint32_t materialId = 0, float rate = 8.0f) {
+        ParticleEmitterComponent emitter;
+        emitter.emissionRate = rate;
+        emitter.baseSpeed = 0.3f;
+        emitter.spread = 1.0f;
+        emitter.lifetimeSeconds = 6.0f;
+        emitter.particleSize = 0.04f;
+        emitter.gravityScale = -0.02f;           // gentle updraft
+        emitter.drag = 0.5f;
+        emitter.materialId = materialId;
+        return emitter;
+    }
+
+    // Queue a one-shot burst on top of any continuous emission
+    void triggerBurst(uint32_t count) {
+        pendingBurst += count;
+    }
+};
+
+} // namespace VulkanMon
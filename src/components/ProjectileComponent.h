@@ -107,7 +107,7 @@ struct ProjectileComponent {
     // =============================================================================
 
     // Update frequency control
-    bool useHighPrecisionPhysics = false;          // Use full physics vs simplified trajectory
+    bool useHighPrecisionPhysics = false;          // Create a full Jolt body; default is the swept-raycast fast path
     float simulationTimeStep = 1.0f/60.0f;         // Physics time step for trajectory calculation
     bool enableCollisionDetection = true;          // Whether to check for collisions
 
@@ -134,7 +134,6 @@ struct ProjectileComponent {
         projectile.dragCoefficient = 0.001f;        // Minimal air resistance
         projectile.collisionResponse = CollisionResponse::DESTROY;
         projectile.destroyOnAnyCollision = true;
-        projectile.useHighPrecisionPhysics = true;
         return projectile;
     }
 
@@ -163,6 +162,7 @@ struct ProjectileComponent {
         projectile.dragCoefficient = 0.01f;
         projectile.bounciness = bounce;
         projectile.collisionResponse = CollisionResponse::BOUNCE;
+        projectile.useHighPrecisionPhysics = true;     // Rolls and settles - needs real contacts
         projectile.hasDistanceLimit = false;
         projectile.timeSinceSpawn = 0.0f;  // Explicitly ensure timer starts at zero
         projectile.distanceTraveled = 0.0f;
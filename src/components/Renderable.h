@@ -1,40 +1,64 @@
 #pragma once
 
+#include "../core/AssetID.h"
 #include "../core/Entity.h"
 #include <string>
 #include <cstdint>
 
 namespace VulkanMon {
 
+// Hot render state only - 32 bytes, two components per cache line.
+//
+// Renderable used to carry its mesh and texture paths as std::strings,
+// so the culling and batching loops dragged 64 bytes of cold string
+// state through cache per entity. The strings now live solely in the
+// AssetID intern table (the cold sidecar); meshPath()/texturePath()
+// resolve them on demand for the Inspector, loaders and serialization,
+// and the component itself is packed, trivially copyable state.
 struct Renderable {
     VKMON_COMPONENT(Renderable)
 
-    // Asset references (will integrate with AssetManager)
-    std::string meshPath;
-    std::string texturePath;
+    // Interned asset handles - the render systems and model cache key
+    // on these instead of hashing strings every frame. Assign through
+    // setMesh()/setTexture() or the constructor
+    AssetID meshId;
+    AssetID textureId;
 
     // Material properties (will integrate with MaterialSystem)
     uint32_t materialId = 0;
 
-    // Rendering flags
-    bool isVisible = true;
-    bool castsShadow = true;
-    bool receivesShadow = true;
+    // Rendering layer (for sorting/culling)
+    uint32_t renderLayer = 0;    // 0 = default layer
 
     // Level of detail
     float lodDistance = 500.0f;  // Distance at which to switch LOD
     uint32_t currentLod = 0;     // Current LOD level (0 = highest quality)
 
-    // Rendering layer (for sorting/culling)
-    uint32_t renderLayer = 0;    // 0 = default layer
+    // Rendering flags
+    bool isVisible = true;
+    bool castsShadow = true;
+    bool receivesShadow = true;
 
     // Constructor for easy creation
     Renderable() = default;
 
     Renderable(const std::string& mesh, const std::string& texture = "", uint32_t material = 0)
-        : meshPath(mesh), texturePath(texture), materialId(material) {}
+        : meshId(AssetID::intern(mesh)), textureId(AssetID::intern(texture)), materialId(material) {}
 
     // Helper methods
+    void setMesh(const std::string& mesh) {
+        meshId = AssetID::intern(mesh);
+    }
+
+    void setTexture(const std::string& texture) {
+        textureId = AssetID::intern(texture);
+    }
+
+    // Path strings resolved from the intern table - debug/loader
+    // boundaries only, never per-frame loops
+    const std::string& meshPath() const { return meshId.str(); }
+    const std::string& texturePath() const { return textureId.str(); }
+
     void setVisible(bool visible) { isVisible = visible; }
     void setMaterial(uint32_t material) { materialId = material; }
     void setRenderLayer(uint32_t layer) { renderLayer = layer; }
@@ -45,4 +69,4 @@ struct Renderable {
     }
 };
 
-} // namespace VulkanMon
\ No newline at end of file
+} // namespace VulkanMon
@@ -23,6 +23,25 @@ struct Transform {
     mutable glm::mat4 modelMatrix = glm::mat4(1.0f);
     mutable bool isDirty = true;
 
+    // Hierarchy parent: INVALID_ENTITY makes this a root (world equals
+    // local). Parented entities get their world matrix composed by
+    // TransformHierarchySystem in parent-before-child order; position,
+    // rotation and scale then express LOCAL space relative to the parent
+    EntityID parent = INVALID_ENTITY;
+
+    // Composed world matrix, written by TransformHierarchySystem only
+    // for parented entities whose subtree actually moved. Roots fall
+    // through to the local matrix in getWorldMatrix()
+    mutable glm::mat4 worldMatrix = glm::mat4(1.0f);
+    mutable bool worldComposed = false;
+
+    // Monotonic change tick, bumped by every setter via markDirty().
+    // Consumers remember the version they last processed and use
+    // view<Transform>().changedSince(version) to skip static entities.
+    // Direct field writes bypass it, same caveat as isDirty - use the
+    // setters for tracked mutation.
+    uint64_t changeVersion = 1;
+
     // Get the model matrix (automatically recalculates if dirty)
     const glm::mat4& getModelMatrix() const {
         if (isDirty) {
@@ -34,6 +53,24 @@ struct Transform {
     // Mark transform as dirty (needs recalculation)
     void markDirty() {
         isDirty = true;
+        ++changeVersion;
+    }
+
+    // World-space matrix: composed for parented entities, local for roots
+    const glm::mat4& getWorldMatrix() const {
+        return worldComposed ? worldMatrix : getModelMatrix();
+    }
+
+    // World-space position without forcing a matrix rebuild for roots
+    glm::vec3 getWorldPosition() const {
+        return worldComposed ? glm::vec3(worldMatrix[3]) : position;
+    }
+
+    // Attach to (or detach from, with INVALID_ENTITY) a parent entity.
+    // TransformHierarchySystem picks the change up on its next update
+    void setParent(EntityID newParent) {
+        parent = newParent;
+        markDirty();
     }
 
     // Set position and mark dirty
@@ -1,9 +1,12 @@
 #include "Application.h"
 #include "../utils/Utils.h"
 #include "../utils/Logger.h"
+#include "../utils/FrameProfiler.h"
+#include "../utils/Task.h"
 #include "../game/CreatureDetectionSystem.h"
 #include "../components/RigidBodyComponent.h"
 #include "../components/CollisionComponent.h"
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 #include <random>
@@ -118,27 +121,53 @@ void Application::shutdown() {
 void Application::processFrame() {
     try {
         auto frameStart = std::chrono::high_resolution_clock::now();
+        FrameProfiler::getInstance().beginFrame();
 
         updateFrameTiming();
+
+        // frameTime_ covers the frame that beginFrame() just closed into
+        // the profiler history, so histogram and zone tree stay aligned:
+        // a spike here attributes against exactly the slow frame
+        if (frameHistogram_.record(frameTime_)) {
+            logFrameSpike();
+        }
         auto timingEnd = std::chrono::high_resolution_clock::now();
 
         // Poll window events
-        window_->pollEvents();
+        {
+            VKMON_PROFILE_SCOPE("Window::pollEvents");
+            window_->pollEvents();
+        }
         auto eventsEnd = std::chrono::high_resolution_clock::now();
 
-        processInput(frameTime_);
+        {
+            VKMON_PROFILE_SCOPE("Application::processInput");
+            processInput(frameTime_);
+        }
         auto inputEnd = std::chrono::high_resolution_clock::now();
 
-        updateSystems(frameTime_);
+        {
+            VKMON_PROFILE_SCOPE("Application::updateSystems");
+            updateSystems(frameTime_);
+        }
         auto systemsEnd = std::chrono::high_resolution_clock::now();
 
-        updateECS(frameTime_);
+        {
+            VKMON_PROFILE_SCOPE("Application::updateECS");
+            updateECS(frameTime_);
+        }
         auto ecsEnd = std::chrono::high_resolution_clock::now();
 
-        updateImGui(frameTime_);
+        {
+            VKMON_PROFILE_SCOPE("Application::updateImGui");
+            updateImGui(frameTime_);
+        }
         auto imguiEnd = std::chrono::high_resolution_clock::now();
 
-        render(frameTime_);
+        {
+            VKMON_PROFILE_SCOPE("Application::render");
+            render(frameTime_);
+        }
         auto renderEnd = std::chrono::high_resolution_clock::now();
 
         // Log performance breakdown when frame is slow (>100ms)
@@ -187,7 +216,11 @@ void Application::updateFrameTiming() {
         static int logCounter = 0;
         if (++logCounter >= 5) {
             VKMON_INFO("Application Performance: " + std::to_string(static_cast<int>(fps_)) + " FPS, " +
-                       std::to_string(frameTime_) + "ms frame time");
+                       "p50=" + std::to_string(frameHistogram_.percentile(50.0f)) + "ms, " +
+                       "p95=" + std::to_string(frameHistogram_.percentile(95.0f)) + "ms, " +
+                       "p99=" + std::to_string(frameHistogram_.percentile(99.0f)) + "ms, " +
+                       "max=" + std::to_string(frameHistogram_.getMaxMs()) + "ms, " +
+                       "spikes=" + std::to_string(frameHistogram_.getSpikeCount()));
             logCounter = 0;
         }
 
@@ -196,9 +229,61 @@ void Application::updateFrameTiming() {
     }
 }
 
+void Application::logFrameSpike() {
+    // Attribute the spike using the zone tree FrameProfiler closed for
+    // this frame. Self time (zone minus its children) names the actual
+    // culprit rather than blaming every ancestor on the path to it.
+    const auto& frame = FrameProfiler::getInstance().getHistoryFrame(0);
+
+    std::vector<float> selfMs(frame.zones.size());
+    for (size_t i = 0; i < frame.zones.size(); ++i) {
+        selfMs[i] = frame.zones[i].durationMs;
+    }
+    for (size_t i = 0; i < frame.zones.size(); ++i) {
+        if (frame.zones[i].parent >= 0) {
+            selfMs[frame.zones[i].parent] -= frame.zones[i].durationMs;
+        }
+    }
+
+    std::vector<size_t> order(frame.zones.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(),
+              [&selfMs](size_t a, size_t b) { return selfMs[a] > selfMs[b]; });
+
+    std::string contributors;
+    constexpr size_t MAX_CONTRIBUTORS = 4;
+    constexpr float CONTRIBUTOR_FLOOR_MS = 0.5f;
+    for (size_t rank = 0; rank < order.size() && rank < MAX_CONTRIBUTORS; ++rank) {
+        size_t zone = order[rank];
+        if (selfMs[zone] < CONTRIBUTOR_FLOOR_MS) {
+            break;
+        }
+        if (!contributors.empty()) {
+            contributors += ", ";
+        }
+        contributors += std::string(frame.zones[zone].name) + "=" +
+                        std::to_string(selfMs[zone]) + "ms";
+    }
+    if (contributors.empty()) {
+        // Zone tree doesn't cover the time - GPU wait, present, or
+        // unprofiled code between zones
+        contributors = "outside profiled zones (GPU wait / present?)";
+    }
+
+    VKMON_WARNING("FRAME SPIKE: " + std::to_string(frameTime_) + "ms " +
+                  "(p50=" + std::to_string(frameHistogram_.percentile(50.0f)) + "ms, " +
+                  "p99=" + std::to_string(frameHistogram_.percentile(99.0f)) + "ms) " +
+                  "top contributors: " + contributors);
+}
+
 void Application::processInput(float deltaTime) {
-    // Process continuous input (WASD movement, held keys)
     if (inputHandler_) {
+        // Dispatch the events the callbacks queued during glfwPollEvents
+        inputHandler_->processQueuedEvents();
+
+        // Process continuous input (WASD movement, held keys)
         inputHandler_->processContinuousInput(window_->getWindow(), deltaTime);
     }
 }
@@ -206,11 +291,42 @@ void Application::processInput(float deltaTime) {
 void Application::updateSystems(float deltaTime) {
     // Update various engine systems each frame
 
+    // Route assets changed on disk to their incremental reload paths
+    if (assetWatcher_ && assetManager_) {
+        for (const auto& changedAsset : assetWatcher_->drainChanges()) {
+            assetManager_->handleAssetFileChanged(changedAsset);
+        }
+    }
+
+    // Resume coroutine tasks waiting for the main thread. Texture loads
+    // finalized during the previous frame's render un-park their
+    // awaiting coroutines here, at the top of the next update.
+    MainThreadTaskQueue::getInstance().pump();
+
     // Update physics simulation
     if (physicsSystem_ && world_) {
+        // Creature physics LOD tiers by distance from the active camera
+        if (cameraSystem_) {
+            physicsSystem_->setLODReference(
+                cameraSystem_->getActiveCameraPosition(world_->getEntityManager()));
+        }
         physicsSystem_->update(deltaTime, world_->getEntityManager());
     }
 
+    // Creature detection intervals stretch with distance from the player
+    // (the active camera stands in until a dedicated player exists)
+    if (creatureDetectionSystem_ && cameraSystem_ && world_) {
+        auto& entityManager = world_->getEntityManager();
+        creatureDetectionSystem_->setDetectionReference(
+            cameraSystem_->getActiveCameraPosition(entityManager));
+
+        // Crowd LOD tiers creature update rates by projected screen size
+        Camera* activeCamera = cameraSystem_->getActiveCamera(entityManager);
+        creatureDetectionSystem_->getCrowdLOD().setCameraState(
+            cameraSystem_->getActiveCameraPosition(entityManager),
+            activeCamera ? activeCamera->fov : Config::Camera::DEFAULT_FOV);
+    }
+
     // Future: Update game logic, animations, other systems, etc.
 }
 
@@ -301,7 +417,7 @@ void Application::makeRandomCubeFall() {
 
     // Add Renderable component (visible cube)
     Renderable renderable;
-    renderable.meshPath = "cube.obj";
+    renderable.setMesh("cube.obj");
     renderable.materialId = 4; // Use Chrome material for distinction
     renderable.isVisible = true;
     entityManager.addComponent(newCube, renderable);
@@ -580,6 +696,22 @@ void Application::updateImGui(float deltaTime) {
 
         // Render ECS Inspector (only if enabled)
         if (ecsInspector_ && inspectorEnabled_) {
+            const auto& gpuTimings = renderer_->getGpuPassTimings();
+            ecsInspector_->setGpuTimings(gpuTimings.mainPassMs, gpuTimings.instancedPassMs,
+                                         gpuTimings.imguiPassMs, gpuTimings.totalMs, gpuTimings.valid);
+
+            const auto& presentStats = renderer_->getPresentStats();
+            const char* presentModeName =
+                renderer_->getPresentMode() == VulkanRenderer::PresentModeSetting::Immediate ? "Immediate"
+                : renderer_->getPresentMode() == VulkanRenderer::PresentModeSetting::Mailbox ? "Mailbox"
+                                                                                             : "Fifo";
+            ecsInspector_->setPresentStats(presentModeName,
+                                           presentStats.presentWaitMs, presentStats.limiterWaitMs);
+
+            const auto& drawStats = renderer_->getFrameRenderStats();
+            ecsInspector_->setDrawStats(drawStats.drawCalls, drawStats.instancesSubmitted,
+                                        drawStats.trianglesSubmitted, drawStats.bufferUploadBytes,
+                                        drawStats.descriptorBinds, drawStats.pipelineBinds);
             ecsInspector_->render(frameTime_);
         }
 
@@ -674,6 +806,12 @@ void Application::updateCameraMatrices() {
 void Application::cleanup() {
     VKMON_INFO("Beginning Application cleanup...");
 
+    // Stop the asset watcher first so no reload lands mid-teardown
+    if (assetWatcher_) {
+        assetWatcher_->stop();
+        assetWatcher_.reset();
+    }
+
     // Cleanup in reverse order of initialization
     if (ecsInspector_) {
         VKMON_DEBUG("Cleaning up ECS Inspector...");
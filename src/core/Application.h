@@ -4,8 +4,10 @@
 #include "InputHandler.h"
 // Old Camera.h removed - using unified ECS camera system
 #include "../utils/Logger.h"
+#include "../utils/FrameTimeHistogram.h"
 #include "../rendering/ResourceManager.h"
 #include "../io/AssetManager.h"
+#include "../io/AssetWatcher.h"
 #include "../io/ModelLoader.h"
 #include "../systems/LightingSystem.h"
 #include "../systems/MaterialSystem.h"
@@ -17,7 +19,12 @@
 #include "../systems/SpatialSystem.h"
 #include "../systems/PhysicsSystem.h"
 #include "../systems/ProjectileSystem.h"
+#include "../systems/CharacterControllerSystem.h"
+#include "../systems/TransformHierarchySystem.h"
+#include "../systems/ParticleSystem.h"
 #include "../game/CreatureDetectionSystem.h"
+#include "../game/FlockingSystem.h"
+#include "../game/NavigationSystem.h"
 #include "../components/Transform.h"
 #include "../components/Renderable.h"
 #include "../debug/ECSInspector.h"
@@ -154,6 +161,15 @@ public:
      */
     float getFPS() const { return fps_; }
 
+    /**
+     * Get the frame-time distribution for this run
+     * Percentiles (p50/p95/p99) and max expose spikes that average FPS
+     * hides; spike frames are attributed in the log via FrameProfiler.
+     *
+     * @return Frame-time histogram, updated once per frame
+     */
+    const FrameTimeHistogram& getFrameHistogram() const { return frameHistogram_; }
+
     /**
      * Toggle ECS Inspector visibility
      */
@@ -179,6 +195,7 @@ private:
     std::chrono::high_resolution_clock::time_point lastFrameTime_;
     float frameTime_ = 0.0f;
     float fps_ = 0.0f;
+    FrameTimeHistogram frameHistogram_;
 
     // Core engine systems (owned)
     std::shared_ptr<Window> window_;
@@ -199,11 +216,19 @@ private:
     SpatialSystem* spatialSystem_ = nullptr;  // Owned by World
     PhysicsSystem* physicsSystem_ = nullptr;  // Owned by World
     ProjectileSystem* projectileSystem_ = nullptr;  // Owned by World
+    CharacterControllerSystem* characterControllerSystem_ = nullptr;  // Owned by World
+    TransformHierarchySystem* transformHierarchySystem_ = nullptr;  // Owned by World
+    ParticleSystem* particleSystem_ = nullptr;  // Owned by World
     CreatureDetectionSystem* creatureDetectionSystem_ = nullptr;  // Owned by World
+    FlockingSystem* flockingSystem_ = nullptr;  // Owned by World
+    NavigationSystem* navigationSystem_ = nullptr;  // Owned by World
 
     // Debug tools
     std::unique_ptr<Debug::ECSInspector> ecsInspector_;
 
+    // Asset hot reload (development feature, see AssetWatcher)
+    std::unique_ptr<AssetWatcher> assetWatcher_;
+
     // Current loaded model
     std::shared_ptr<Model> currentModel_;
 
@@ -238,6 +263,7 @@ private:
     // Main loop methods
     void processFrame();
     void updateFrameTiming();
+    void logFrameSpike();
     void processInput(float deltaTime);
     void updateSystems(float deltaTime);
     void updateECS(float deltaTime);        // Update ECS World
@@ -13,8 +13,9 @@ void Application::handleShaderReload() {
 
     try {
         if (renderer_) {
+            // Compilation runs on a background thread; the renderer swaps
+            // the new pipeline in once it is ready
             renderer_->reloadShaders();
-            VKMON_INFO("Hot reload complete - new shaders active!");
         }
     } catch (const std::exception& e) {
         VKMON_ERROR("Hot reload failed: " + std::string(e.what()));
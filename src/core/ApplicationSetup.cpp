@@ -12,6 +12,7 @@
 #include <stdexcept>
 #include <set>
 #include <chrono>
+#include <vector>
 
 using namespace VulkanMon;
 
@@ -93,23 +94,25 @@ void Application::initializeInputSystem() {
         toggleInspector();
     });
 
-    // Connect window input callbacks for WASD + mouse controls
+    // Connect window input callbacks for WASD + mouse controls. Callbacks
+    // only enqueue timestamped events; Application::processInput drains
+    // the queue once per frame and dispatches in arrival order
     window_->setKeyCallback([this](int key, int scancode, int action, int mods) {
         if (inputHandler_) {
-            inputHandler_->processKeyInput(key, scancode, action, mods);
+            inputHandler_->queueKeyEvent(key, scancode, action, mods);
         }
     });
 
     window_->setMouseCallback([this](double xpos, double ypos) {
         if (inputHandler_) {
-            inputHandler_->processMouseInput(xpos, ypos);
+            inputHandler_->queueMouseMoveEvent(xpos, ypos);
         }
     });
 
     // Connect mouse button callback for projectile spawning
     window_->setMouseButtonCallback([this](int button, int action, int mods) {
         if (inputHandler_) {
-            inputHandler_->processMouseButtonInput(button, action, mods);
+            inputHandler_->queueMouseButtonEvent(button, action, mods);
         }
     });
 
@@ -171,8 +174,9 @@ void Application::initializeECS() {
                            std::to_string(worldConfig.maxBounds.x) + "," +
                            std::to_string(worldConfig.maxBounds.y) + "," +
                            std::to_string(worldConfig.maxBounds.z) + ")");
-    // Add spatial system for Pokemon-style spatial queries and octree partitioning
-    spatialSystem_ = world_->addSystem<SpatialSystem>(worldConfig.getBoundingBox());
+    // Add spatial system for Pokemon-style spatial queries; the config
+    // also selects the spatial backend (octree by default)
+    spatialSystem_ = world_->addSystem<SpatialSystem>(worldConfig);
 
     // Add physics system for realistic physics simulation
     physicsSystem_ = world_->addSystem<PhysicsSystem>();
@@ -183,13 +187,46 @@ void Application::initializeECS() {
     // Note: MaterialSystem will be connected after renderer systems are available
     projectileSystem_ = world_->addSystem<ProjectileSystem>(cameraSystem_, nullptr);
     projectileSystem_->setPhysicsSystem(physicsSystem_);
+
+    // Add character controller solver; ground probes for every character
+    // are batched through the physics job system each frame
+    characterControllerSystem_ = world_->addSystem<CharacterControllerSystem>();
+    characterControllerSystem_->setPhysicsSystem(physicsSystem_);
+    VKMON_INFO("CharacterControllerSystem added to World and connected to physics");
     VKMON_INFO("ProjectileSystem added to World and connected to physics/camera (MaterialSystem deferred)");
 
+    // Add transform hierarchy composition LAST so parented entities
+    // compose against this frame's physics/projectile movement
+    transformHierarchySystem_ = world_->addSystem<TransformHierarchySystem>();
+    VKMON_INFO("TransformHierarchySystem added to World");
+
+    // Add particle system after hierarchy composition so emitters on
+    // parented entities spawn from their composed world position
+    particleSystem_ = world_->addSystem<ParticleSystem>();
+    VKMON_INFO("ParticleSystem added to World");
+
+    // Pre-create pooled projectiles so rapid-fire spawning reuses parked
+    // entities instead of paying entity and Jolt body construction per throw
+    projectileSystem_->prewarmPool(16, 8, world_->getEntityManager());
+
     // MaterialSystem connection will be done after renderer initialization
 
     // Add CreatureDetectionSystem for AI behavior and spatial detection
     // creatureDetectionSystem_ = world_->addSystem<CreatureDetectionSystem>();
 
+    // Add flocking solver for herd movement - one shared spatial gather
+    // steers every member of a flock cluster (spatial connection happens
+    // in World::connectSystems)
+    flockingSystem_ = world_->addSystem<FlockingSystem>();
+    VKMON_INFO("FlockingSystem added to World");
+
+    // Add navigation solver for async creature pathing - goals queue here,
+    // terrain probes batch through the physics job system, and solved
+    // paths publish the following frame
+    navigationSystem_ = world_->addSystem<NavigationSystem>();
+    navigationSystem_->setPhysicsSystem(physicsSystem_);
+    VKMON_INFO("NavigationSystem added to World and connected to physics");
+
     // Use centralized system connection with validation
     world_->connectSystems();
     VKMON_INFO("System dependency connection completed via World::connectSystems()");
@@ -224,6 +261,26 @@ void Application::connectDeferredSystems() {
         VKMON_WARNING("ProjectileSystem: MaterialSystem not available for connection");
     }
 
+    // Enable the GPU particle pass now that compute resources exist; the
+    // renderer refuses and warns if creation failed at startup
+    if (renderer_) {
+        renderer_->setGpuParticlesEnabled(true);
+    }
+
+    // Asset hot reload: the watcher polls assets/ on a background thread,
+    // updateSystems drains its changes each frame, and AssetManager
+    // reloads only the affected cache entries. Shader reload stays on
+    // the R key; this covers textures and models.
+    if (assetManager_ && renderer_) {
+        assetManager_->setModelReloadHandler([this](const std::string& modelFile) {
+            if (renderer_) {
+                renderer_->invalidateModelCache(modelFile);
+            }
+        });
+        assetWatcher_ = std::make_unique<AssetWatcher>(assetManager_->getAssetsRootPath());
+        assetWatcher_->start();
+    }
+
     VKMON_INFO("Deferred system connections completed");
 }
 
@@ -236,6 +293,15 @@ void Application::createProjectileTestScene() {
     VKMON_INFO("Creating Clean Projectile Test Scene...");
     VKMON_INFO("Focus: Mouse click projectile spawning and physics validation");
 
+    // Scene metadata reserve hints: size the ECS slabs once up front so
+    // the spawns below (and runtime projectile/falling-cube waves) grow
+    // into pre-carved pool blocks instead of reallocating mid-frame
+    world_->reserveComponents<Transform>(128);
+    world_->reserveComponents<SpatialComponent>(128);
+    world_->reserveComponents<Renderable>(128);
+    world_->reserveComponents<RigidBodyComponent>(64);
+    world_->reserveComponents<CollisionComponent>(64);
+
     // =========================================================================
     // CLEAN PROJECTILE TEST SCENE
     // =========================================================================
@@ -255,8 +321,8 @@ void Application::createProjectileTestScene() {
     world_->addComponent(groundEntity, groundTransform);
 
     Renderable groundRenderable;
-    groundRenderable.meshPath = "plane.obj";
-    groundRenderable.texturePath = "default";
+    groundRenderable.setMesh("plane.obj");
+    groundRenderable.setTexture("default");
     groundRenderable.materialId = 0; // Default material
     groundRenderable.isVisible = true;
     world_->addComponent(groundEntity, groundRenderable);
@@ -299,8 +365,8 @@ void Application::createProjectileTestScene() {
         world_->addComponent(targetEntity, targetTransform);
 
         Renderable targetRenderable;
-        targetRenderable.meshPath = "cube.obj";
-        targetRenderable.texturePath = "default";
+        targetRenderable.setMesh("cube.obj");
+        targetRenderable.setTexture("default");
         targetRenderable.materialId = 1 + static_cast<uint32_t>(i); // Different materials
         targetRenderable.isVisible = true;
         world_->addComponent(targetEntity, targetRenderable);
@@ -402,44 +468,39 @@ void Application::preloadSceneAssets() {
         return;
     }
 
-    // Collect unique mesh paths to avoid duplicate loading
+    // The scene's preload manifest: every unique mesh and texture the
+    // Renderable components reference
     std::set<std::string> uniqueMeshPaths;
+    std::set<std::string> uniqueTexturePaths;
     int totalRenderables = 0;
 
     for (EntityID entity : entities) {
         auto& renderable = world_->getComponent<Renderable>(entity);
-        uniqueMeshPaths.insert(renderable.meshPath);
+        uniqueMeshPaths.insert(renderable.meshPath());
+        if (!renderable.texturePath().empty()) {
+            uniqueTexturePaths.insert(renderable.texturePath());
+        }
         totalRenderables++;
     }
 
     VKMON_INFO("Found " + std::to_string(totalRenderables) + " renderable entities using " +
-               std::to_string(uniqueMeshPaths.size()) + " unique models");
-
-    // Preload each unique model
-    size_t successCount = 0;
-    size_t failureCount = 0;
-    double totalLoadTime = 0.0;
-
-    for (const std::string& meshPath : uniqueMeshPaths) {
-        VKMON_INFO("Preloading model: " + meshPath);
-
-        auto start = std::chrono::high_resolution_clock::now();
-
-        if (renderer_->preloadModel(meshPath)) {
-            auto end = std::chrono::high_resolution_clock::now();
-            double loadTime = std::chrono::duration<double, std::milli>(end - start).count();
-            totalLoadTime += loadTime;
-
-            VKMON_INFO("Model preloaded successfully in " + std::to_string(loadTime) + "ms: " + meshPath);
-            successCount++;
-        } else {
-            VKMON_ERROR("Failed to preload model: " + meshPath);
-            failureCount++;
+               std::to_string(uniqueMeshPaths.size()) + " unique models and " +
+               std::to_string(uniqueTexturePaths.size()) + " unique textures");
+
+    // Texture decodes fan out on the loader pool immediately; GPU images
+    // finalize on the main thread during the first frames
+    if (auto assetManager = renderer_->getAssetManager()) {
+        for (const std::string& texturePath : uniqueTexturePaths) {
+            assetManager->loadTextureAsync(texturePath);
         }
     }
 
+    // Model warmup: Assimp cooks fan across the job system, uploads stay
+    // on this thread. Lazy loads from here on log as frame hitches.
+    std::vector<std::string> manifest(uniqueMeshPaths.begin(), uniqueMeshPaths.end());
+    size_t resident = renderer_->preloadModels(manifest);
+
     VKMON_INFO("Scene asset preloading complete: " +
-               std::to_string(successCount) + " models loaded successfully, " +
-               std::to_string(failureCount) + " failures, " +
-               std::to_string(totalLoadTime) + "ms total");
+               std::to_string(resident) + "/" + std::to_string(manifest.size()) +
+               " models resident");
 }
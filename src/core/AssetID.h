@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace VulkanMon {
+
+// Interned 32-bit handle for asset path strings.
+//
+// Mesh identity used to travel through the frame as std::string: hashed
+// by the model cache, compared by the instanced batching map, and
+// concatenated into batch keys - thousands of times per frame at creature
+// scale. Interning maps each distinct path to a stable handle exactly
+// once, so hot paths hash and compare integers and strings survive only
+// at load and debug boundaries.
+//
+// Handle 0 is reserved for the empty string: a default-constructed
+// AssetID round-trips to "" and reports !valid().
+class AssetID {
+public:
+    constexpr AssetID() = default;
+
+    // Look up (or create) the handle for a path. Shared lock on the hit
+    // path, unique lock the first time a path is seen
+    static AssetID intern(const std::string& path);
+
+    // The interned string. The table never shrinks, so the reference
+    // stays valid for the life of the process
+    const std::string& str() const;
+
+    uint32_t value() const { return value_; }
+    bool valid() const { return value_ != 0; }
+
+    bool operator==(const AssetID& other) const { return value_ == other.value_; }
+    bool operator!=(const AssetID& other) const { return value_ != other.value_; }
+    bool operator<(const AssetID& other) const { return value_ < other.value_; }
+
+private:
+    explicit constexpr AssetID(uint32_t value) : value_(value) {}
+
+    uint32_t value_ = 0;
+};
+
+namespace detail {
+
+// Global append-only string table backing AssetID. Thread-safe: model
+// paths are interned from load-time code that may run on worker threads
+class AssetStringTable {
+public:
+    static AssetStringTable& getInstance() {
+        static AssetStringTable instance;
+        return instance;
+    }
+
+    uint32_t intern(const std::string& path) {
+        if (path.empty()) {
+            return 0;
+        }
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            auto it = idsByString_.find(path);
+            if (it != idsByString_.end()) {
+                return it->second;
+            }
+        }
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        auto [it, inserted] = idsByString_.try_emplace(path, static_cast<uint32_t>(strings_.size()));
+        if (inserted) {
+            strings_.push_back(path);
+        }
+        return it->second;
+    }
+
+    const std::string& lookup(uint32_t id) const {
+        // Entries are immutable once added and a deque never relocates
+        // them, so the returned reference outlives the lock
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return id < strings_.size() ? strings_[id] : strings_[0];
+    }
+
+private:
+    AssetStringTable() {
+        strings_.push_back(std::string()); // id 0 = empty string
+    }
+
+    mutable std::shared_mutex mutex_;
+    std::deque<std::string> strings_;
+    std::unordered_map<std::string, uint32_t> idsByString_;
+};
+
+} // namespace detail
+
+inline AssetID AssetID::intern(const std::string& path) {
+    return AssetID(detail::AssetStringTable::getInstance().intern(path));
+}
+
+inline const std::string& AssetID::str() const {
+    return detail::AssetStringTable::getInstance().lookup(value_);
+}
+
+} // namespace VulkanMon
+
+// Hash by handle value so unordered containers keyed on AssetID never
+// touch the underlying string
+template<>
+struct std::hash<VulkanMon::AssetID> {
+    size_t operator()(const VulkanMon::AssetID& id) const noexcept {
+        return std::hash<uint32_t>{}(id.value());
+    }
+};
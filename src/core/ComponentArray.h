@@ -2,32 +2,91 @@
 
 #include "Entity.h"
 #include <vector>
-#include <unordered_map>
+#include <memory_resource>
 #include <stdexcept>
+#include <algorithm>
 
 namespace VulkanMon {
 
+// Container aliases for ECS component storage. All dense arrays allocate
+// through std::pmr so the World can point them at its pooled slab
+// resource instead of the global heap; consumers iterating with auto&
+// never see the difference.
+template<typename T>
+using ComponentVector = std::pmr::vector<T>;
+using EntityIdVector = std::pmr::vector<EntityID>;
+
 // Base class for type-erased component storage
 class ComponentArrayBase {
 public:
     virtual ~ComponentArrayBase() = default;
     virtual void removeEntity(EntityID entity) = 0;
+    virtual size_t size() const = 0;
+    virtual void reorder(const std::vector<EntityID>& order) = 0;
 };
 
 // Templated component storage using sparse set approach
+//
+// Components live in a dense vector (structure-of-arrays with the
+// parallel entityIds vector), so systems iterate contiguous memory.
+// Entity -> dense index lookup is a direct array index into a sparse
+// vector instead of a hash map, which keeps per-entity access O(1) with
+// no hashing or probing on hot system-update paths.
+//
+// Storage is parameterized on std::pmr::memory_resource: the World hands
+// every array its component pool, so growth during spawn waves carves
+// from large contiguous slabs the engine sized up front rather than
+// fragmenting the global heap one reallocation at a time.
 template<typename T>
 class ComponentArray : public ComponentArrayBase {
 private:
+    // Sentinel for "entity has no component of this type"
+    static constexpr size_t INVALID_INDEX = static_cast<size_t>(-1);
+
     // Dense array of components for cache-friendly iteration
-    std::vector<T> components;
+    ComponentVector<T> components;
 
     // Entity ID for each component (same indexing as components)
-    std::vector<EntityID> entityIds;
+    EntityIdVector entityIds;
 
-    // Fast lookup: entity -> index in dense arrays
-    std::unordered_map<EntityID, size_t> entityToIndex;
+    // Sparse lookup: indexed directly by EntityID, grows on demand
+    std::pmr::vector<size_t> sparse;
+
+    size_t lookupIndex(EntityID entity) const {
+        return (entity < sparse.size()) ? sparse[entity] : INVALID_INDEX;
+    }
+
+    void ensureSparseCapacity(EntityID entity) {
+        if (entity >= sparse.size()) {
+            // Grow geometrically so thousands of entities don't cause
+            // a reallocation per-add
+            size_t newSize = std::max(static_cast<size_t>(entity) + 1, sparse.size() * 2);
+            sparse.resize(newSize, INVALID_INDEX);
+        }
+    }
 
 public:
+    // Defaults to the global heap so standalone arrays (tests, tools)
+    // need no setup; the EntityManager always passes the World's pool
+    explicit ComponentArray(std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+        : components(memory)
+        , entityIds(memory)
+        , sparse(memory) {}
+
+    // Reserve hint from scene metadata: size the dense arrays once up
+    // front so a spawn wave of expectedCount entities never reallocates
+    // mid-frame. The sparse array is sized too - entity IDs are dense by
+    // construction, so the expected count bounds them well.
+    void reserve(size_t expectedCount) {
+        components.reserve(expectedCount);
+        entityIds.reserve(expectedCount);
+        // +1: entity IDs start at 1 (0 is INVALID_ENTITY), so ID
+        // expectedCount must index into the sparse array directly
+        if (sparse.size() < expectedCount + 1) {
+            sparse.resize(expectedCount + 1, INVALID_INDEX);
+        }
+    }
+
     // Add component to entity
     void addComponent(EntityID entity, const T& component) {
         if (hasComponent(entity)) {
@@ -39,17 +98,18 @@ public:
         components.push_back(component);
         entityIds.push_back(entity);
 
-        // Update lookup map
-        entityToIndex[entity] = newIndex;
+        // Update sparse lookup
+        ensureSparseCapacity(entity);
+        sparse[entity] = newIndex;
     }
 
     // Remove component from entity
     void removeComponent(EntityID entity) {
-        if (!hasComponent(entity)) {
+        size_t indexToRemove = lookupIndex(entity);
+        if (indexToRemove == INVALID_INDEX) {
             return; // Silently ignore if component doesn't exist
         }
 
-        size_t indexToRemove = entityToIndex[entity];
         size_t lastIndex = components.size() - 1;
 
         // Move last element to the removed position (swap and pop)
@@ -58,52 +118,105 @@ public:
             entityIds[indexToRemove] = entityIds[lastIndex];
 
             // Update the moved entity's index
-            entityToIndex[entityIds[indexToRemove]] = indexToRemove;
+            sparse[entityIds[indexToRemove]] = indexToRemove;
         }
 
         // Remove last element
         components.pop_back();
         entityIds.pop_back();
-        entityToIndex.erase(entity);
+        sparse[entity] = INVALID_INDEX;
     }
 
     // Get component reference
     T& getComponent(EntityID entity) {
-        auto it = entityToIndex.find(entity);
-        if (it == entityToIndex.end()) {
+        size_t index = lookupIndex(entity);
+        if (index == INVALID_INDEX) {
             throw std::runtime_error("Entity does not have this component type");
         }
-        return components[it->second];
+        return components[index];
     }
 
     // Get component reference (const version)
     const T& getComponent(EntityID entity) const {
-        auto it = entityToIndex.find(entity);
-        if (it == entityToIndex.end()) {
+        size_t index = lookupIndex(entity);
+        if (index == INVALID_INDEX) {
             throw std::runtime_error("Entity does not have this component type");
         }
-        return components[it->second];
+        return components[index];
     }
 
     // Check if entity has component
     bool hasComponent(EntityID entity) const {
-        return entityToIndex.find(entity) != entityToIndex.end();
+        return lookupIndex(entity) != INVALID_INDEX;
+    }
+
+    // Get dense index for entity (INVALID_INDEX-checked variants above)
+    size_t getEntityIndex(EntityID entity) const {
+        return lookupIndex(entity);
     }
 
     // Get all components (for system iteration)
-    std::vector<T>& getAllComponents() { return components; }
-    const std::vector<T>& getAllComponents() const { return components; }
+    ComponentVector<T>& getAllComponents() { return components; }
+    const ComponentVector<T>& getAllComponents() const { return components; }
 
     // Get all entity IDs (for system iteration)
-    const std::vector<EntityID>& getAllEntityIds() const { return entityIds; }
+    const EntityIdVector& getAllEntityIds() const { return entityIds; }
 
     // Get component count
     size_t getComponentCount() const { return components.size(); }
+    size_t size() const override { return components.size(); }
 
     // Remove entity from this component array (implements base class method)
     void removeEntity(EntityID entity) override {
         removeComponent(entity);
     }
+
+    // Rebuild the dense arrays so entities appear in `order` - the
+    // storage compaction pass feeds the octree-locality order here so
+    // entities near each other in space become near in memory. Entities
+    // in `order` without this component are skipped; components whose
+    // entity is absent from `order` keep their relative order at the
+    // tail. The sparse map is rebuilt to match. O(n) over both inputs
+    // with one dense-array copy - meant for loading screens and idle
+    // frames, never hot per-frame paths.
+    void reorder(const std::vector<EntityID>& order) override {
+        if (components.empty()) {
+            return;
+        }
+
+        ComponentVector<T> newComponents(components.get_allocator());
+        EntityIdVector newEntityIds(entityIds.get_allocator());
+        newComponents.reserve(components.size());
+        newEntityIds.reserve(entityIds.size());
+
+        // Pull entities into locality order, marking each consumed slot
+        // in the sparse map so the tail sweep below skips it
+        for (EntityID entity : order) {
+            size_t index = lookupIndex(entity);
+            if (index == INVALID_INDEX) {
+                continue;
+            }
+            newComponents.push_back(std::move(components[index]));
+            newEntityIds.push_back(entity);
+            sparse[entity] = INVALID_INDEX;
+        }
+
+        // Entities the order didn't name (not spatially tracked) follow
+        // in their existing relative order
+        for (size_t i = 0; i < entityIds.size(); ++i) {
+            if (lookupIndex(entityIds[i]) == INVALID_INDEX) {
+                continue; // consumed above
+            }
+            newComponents.push_back(std::move(components[i]));
+            newEntityIds.push_back(entityIds[i]);
+        }
+
+        components = std::move(newComponents);
+        entityIds = std::move(newEntityIds);
+        for (size_t i = 0; i < entityIds.size(); ++i) {
+            sparse[entityIds[i]] = i;
+        }
+    }
 };
 
-} // namespace VulkanMon
\ No newline at end of file
+} // namespace VulkanMon
@@ -10,6 +10,28 @@ using EntityID = uint32_t;
 // Reserved invalid entity ID
 static constexpr EntityID INVALID_ENTITY = 0;
 
+// Generational entity handle: EntityID index in the low 32 bits,
+// generation counter in the high 32 bits. EntityManager bumps the
+// generation when an ID is destroyed, so a stale handle held across
+// frames (spatial caches, projectile callbacks) fails validation in O(1)
+// instead of silently aliasing a recycled entity.
+struct EntityHandle {
+    uint64_t value = 0;
+
+    EntityHandle() = default;
+    EntityHandle(EntityID id, uint32_t generation)
+        : value((static_cast<uint64_t>(generation) << 32) | id) {}
+
+    EntityID id() const { return static_cast<EntityID>(value & 0xFFFFFFFFu); }
+    uint32_t generation() const { return static_cast<uint32_t>(value >> 32); }
+
+    bool operator==(const EntityHandle& other) const { return value == other.value; }
+    bool operator!=(const EntityHandle& other) const { return value != other.value; }
+};
+
+// Handle that never validates (id 0 is INVALID_ENTITY)
+static constexpr uint64_t INVALID_ENTITY_HANDLE = 0;
+
 // Component type identification
 struct ComponentBase {
     static inline uint32_t nextTypeId = 1;
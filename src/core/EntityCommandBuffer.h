@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Entity.h"
+#include "EntityManager.h"
+#include <functional>
+#include <vector>
+
+namespace VulkanMon {
+
+// Deferred structural changes for the ECS
+//
+// Systems iterating dense component arrays must not create/destroy
+// entities or add/remove components mid-iteration (swap-and-pop storage
+// invalidates indices). EntityCommandBuffer records those operations and
+// applies them in one batched flush at the frame sync point in
+// World::update, after all systems have run.
+//
+// createEntity() allocates the real ID eagerly - ID allocation never
+// touches component arrays, so it is safe mid-update and lets callers
+// reference the new entity in subsequently recorded commands.
+class EntityCommandBuffer {
+private:
+    EntityManager& entityManager;
+    std::vector<std::function<void(EntityManager&)>> commands;
+
+public:
+    explicit EntityCommandBuffer(EntityManager& entityManager)
+        : entityManager(entityManager) {}
+
+    // Non-copyable (owns recorded commands against one manager)
+    EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+    EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+    // Allocate an entity ID now; component adds for it should also be
+    // recorded through this buffer
+    EntityID createEntity() {
+        return entityManager.createEntity();
+    }
+
+    // Record entity destruction (applied on flush)
+    void destroyEntity(EntityID entity) {
+        commands.push_back([entity](EntityManager& manager) {
+            manager.destroyEntity(entity);
+        });
+    }
+
+    // Record component addition (applied on flush)
+    template<typename T>
+    void addComponent(EntityID entity, const T& component) {
+        commands.push_back([entity, component](EntityManager& manager) {
+            manager.addComponent(entity, component);
+        });
+    }
+
+    // Record component removal (applied on flush)
+    template<typename T>
+    void removeComponent(EntityID entity) {
+        commands.push_back([entity](EntityManager& manager) {
+            manager.removeComponent<T>(entity);
+        });
+    }
+
+    // Apply all recorded commands in recording order, then clear
+    void flush() {
+        for (auto& command : commands) {
+            command(entityManager);
+        }
+        commands.clear();
+    }
+
+    // Drop recorded commands without applying them
+    void clear() {
+        commands.clear();
+    }
+
+    size_t pendingCount() const { return commands.size(); }
+    bool empty() const { return commands.empty(); }
+};
+
+} // namespace VulkanMon
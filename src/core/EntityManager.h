@@ -2,71 +2,139 @@
 
 #include "Entity.h"
 #include "ComponentArray.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <memory>
-#include <unordered_map>
-#include <queue>
-#include <typeindex>
+#include <memory_resource>
+#include <vector>
 
 namespace VulkanMon {
 
 class EntityManager {
 private:
+    // Memory resource every component array allocates from. The World
+    // passes its pooled slab resource; the default keeps standalone
+    // EntityManagers (tests, tools) working against the global heap.
+    std::pmr::memory_resource* componentMemory_;
+
     // Next entity ID to assign
     EntityID nextEntityId = 1; // Start at 1 since 0 is INVALID_ENTITY
 
-    // Reusable entity IDs (from destroyed entities)
-    std::queue<EntityID> availableEntityIds;
+    // Reusable entity IDs (from destroyed entities), flat LIFO free-list
+    std::vector<EntityID> freeList;
+
+    // Per-ID generation counter and liveness, indexed by EntityID.
+    // Generation is bumped on destroy so stale EntityHandles fail
+    // validation instead of aliasing a recycled ID.
+    std::vector<uint32_t> generations;
+    std::vector<bool> aliveEntities;
+
+    void ensureEntityRecords(EntityID entity) {
+        if (entity >= generations.size()) {
+            generations.resize(entity + 1, 0);
+            aliveEntities.resize(entity + 1, false);
+        }
+    }
 
-    // Component arrays, indexed by component type
-    std::unordered_map<std::type_index, std::unique_ptr<ComponentArrayBase>> componentArrays;
+    // Component arrays indexed by compile-time component type ID
+    // (ComponentBase::getTypeId<T>()), so array lookup is a direct
+    // vector index with no RTTI hash or map probe
+    std::vector<std::unique_ptr<ComponentArrayBase>> componentArrays;
+
+    // Storage compaction resume point: compactStorage reorders whole
+    // arrays one at a time, so a budgeted pass picks up where the
+    // previous call stopped
+    size_t compactionCursor_ = 0;
 
     // Get or create component array for type T
     template<typename T>
     ComponentArray<T>* getComponentArray() {
-        std::type_index typeIndex = std::type_index(typeid(T));
-
-        auto it = componentArrays.find(typeIndex);
-        if (it == componentArrays.end()) {
-            // Create new component array for this type
-            auto newArray = std::make_unique<ComponentArray<T>>();
-            ComponentArray<T>* rawPtr = newArray.get();
-            componentArrays[typeIndex] = std::move(newArray);
-            return rawPtr;
+        uint32_t typeId = ComponentBase::getTypeId<T>();
+
+        if (typeId >= componentArrays.size()) {
+            componentArrays.resize(typeId + 1);
+        }
+
+        auto& slot = componentArrays[typeId];
+        if (!slot) {
+            slot = std::make_unique<ComponentArray<T>>(componentMemory_);
         }
 
-        return static_cast<ComponentArray<T>*>(it->second.get());
+        return static_cast<ComponentArray<T>*>(slot.get());
+    }
+
+    // Lookup without creation (const paths like hasComponent)
+    template<typename T>
+    const ComponentArray<T>* findComponentArray() const {
+        uint32_t typeId = ComponentBase::getTypeId<T>();
+        if (typeId >= componentArrays.size()) {
+            return nullptr;
+        }
+        return static_cast<const ComponentArray<T>*>(componentArrays[typeId].get());
     }
 
 public:
+    explicit EntityManager(std::pmr::memory_resource* componentMemory =
+                               std::pmr::get_default_resource())
+        : componentMemory_(componentMemory) {}
+
     // Create new entity
     EntityID createEntity() {
         EntityID newEntity;
 
-        if (!availableEntityIds.empty()) {
-            // Reuse previously destroyed entity ID
-            newEntity = availableEntityIds.front();
-            availableEntityIds.pop();
+        if (!freeList.empty()) {
+            // Reuse previously destroyed entity ID (generation was
+            // already bumped when it was destroyed)
+            newEntity = freeList.back();
+            freeList.pop_back();
         } else {
             // Create new entity ID
             newEntity = nextEntityId++;
         }
 
+        ensureEntityRecords(newEntity);
+        aliveEntities[newEntity] = true;
         return newEntity;
     }
 
     // Destroy entity and all its components
     void destroyEntity(EntityID entity) {
-        if (entity == INVALID_ENTITY) {
+        if (entity == INVALID_ENTITY || !isAlive(entity)) {
             return;
         }
 
         // Remove entity from all component arrays
-        for (auto& [typeIndex, componentArray] : componentArrays) {
-            componentArray->removeEntity(entity);
+        for (auto& componentArray : componentArrays) {
+            if (componentArray) {
+                componentArray->removeEntity(entity);
+            }
+        }
+
+        // Invalidate outstanding handles and recycle the ID
+        generations[entity]++;
+        aliveEntities[entity] = false;
+        freeList.push_back(entity);
+    }
+
+    // O(1) liveness check for a raw entity ID
+    bool isAlive(EntityID entity) const {
+        return entity < aliveEntities.size() && aliveEntities[entity];
+    }
+
+    // Generational handle for a live entity (invalid handle if dead)
+    EntityHandle getHandle(EntityID entity) const {
+        if (!isAlive(entity)) {
+            return EntityHandle{};
         }
+        return EntityHandle(entity, generations[entity]);
+    }
 
-        // Mark entity ID as available for reuse
-        availableEntityIds.push(entity);
+    // A handle is valid only while the entity it was taken from is still
+    // alive with the same generation
+    bool isValid(EntityHandle handle) const {
+        EntityID entity = handle.id();
+        return isAlive(entity) && generations[entity] == handle.generation();
     }
 
     // Add component to entity
@@ -90,42 +158,90 @@ public:
     // Get component from entity (const version)
     template<typename T>
     const T& getComponent(EntityID entity) const {
-        return getComponentArray<T>()->getComponent(entity);
+        const ComponentArray<T>* array = findComponentArray<T>();
+        if (!array) {
+            throw std::runtime_error("Entity does not have this component type");
+        }
+        return array->getComponent(entity);
     }
 
     // Check if entity has component
     template<typename T>
     bool hasComponent(EntityID entity) const {
-        auto typeIndex = std::type_index(typeid(T));
-        auto it = componentArrays.find(typeIndex);
-        if (it == componentArrays.end()) {
-            return false;
-        }
-        return static_cast<ComponentArray<T>*>(it->second.get())->hasComponent(entity);
+        const ComponentArray<T>* array = findComponentArray<T>();
+        return array && array->hasComponent(entity);
     }
 
     // Get all components of type T (for system iteration)
     template<typename T>
-    std::vector<T>& getAllComponents() {
+    ComponentVector<T>& getAllComponents() {
         return getComponentArray<T>()->getAllComponents();
     }
 
     // Get all entity IDs that have component T
     template<typename T>
-    const std::vector<EntityID>& getEntitiesWithComponent() {
+    const EntityIdVector& getEntitiesWithComponent() {
         return getComponentArray<T>()->getAllEntityIds();
     }
 
+    // Scene metadata reserve hint: pre-size type T's storage for the
+    // expected component count so spawn waves never reallocate mid-frame
+    template<typename T>
+    void reserveComponents(size_t expectedCount) {
+        getComponentArray<T>()->reserve(expectedCount);
+    }
+
     // Get component count for type T
     template<typename T>
     size_t getComponentCount() const {
-        auto typeIndex = std::type_index(typeid(T));
-        auto it = componentArrays.find(typeIndex);
-        if (it == componentArrays.end()) {
-            return 0;
+        const ComponentArray<T>* array = findComponentArray<T>();
+        return array ? array->getComponentCount() : 0;
+    }
+
+    // Storage compaction/defrag pass for long sessions. Hours of
+    // spawn/despawn cycles leave component iteration order decorrelated
+    // from spatial locality and the free list recycling high IDs; this
+    // reorders every component array to spatialOrder (typically
+    // SpatialManager::getEntitiesInSpatialOrder) and re-sorts the free
+    // list so the lowest IDs are recycled first, keeping the sparse
+    // tables dense.
+    //
+    // Each call reorders whole arrays until budgetMs is spent (checked
+    // between arrays), then resumes from the same array next call -
+    // sized for loading screens and idle frames. Pass a negative budget
+    // to finish in one call. Returns true once every array has been
+    // processed. Structural changes between calls are safe: swap-remove
+    // and append only perturb already-compacted arrays, they never
+    // corrupt them.
+    bool compactStorage(const std::vector<EntityID>& spatialOrder, float budgetMs) {
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                            std::chrono::duration<float, std::milli>(std::max(budgetMs, 0.0f)));
+
+        if (compactionCursor_ == 0) {
+            // Descending sort: back() is the lowest ID, so reuse fills
+            // the ID range from the bottom up
+            std::sort(freeList.begin(), freeList.end(), std::greater<EntityID>());
+        }
+
+        while (compactionCursor_ < componentArrays.size()) {
+            auto& componentArray = componentArrays[compactionCursor_];
+            if (componentArray) {
+                componentArray->reorder(spatialOrder);
+            }
+            ++compactionCursor_;
+
+            if (budgetMs >= 0.0f && std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+        }
+
+        if (compactionCursor_ >= componentArrays.size()) {
+            compactionCursor_ = 0;
+            return true;
         }
-        return static_cast<ComponentArray<T>*>(it->second.get())->getComponentCount();
+        return false;
     }
 };
 
-} // namespace VulkanMon
\ No newline at end of file
+} // namespace VulkanMon
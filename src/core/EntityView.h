@@ -0,0 +1,187 @@
+#pragma once
+
+#include "Entity.h"
+#include "EntityManager.h"
+#include "../utils/JobSystem.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace VulkanMon {
+
+// Multi-component view over an EntityManager
+//
+// Intersects the component arrays for ComponentTypes... once per forEach
+// call: the smallest array drives iteration and the remaining types are
+// probed with O(1) sparse lookups. This replaces the "iterate one array,
+// hasComponent-probe the rest" pattern that systems used to hand-roll.
+//
+// Structural changes (add/remove component, destroy entity) must not be
+// performed from inside forEach - the swap-and-pop dense storage would
+// invalidate the iteration. Queue such changes and apply them afterwards.
+template<typename... ComponentTypes>
+class EntityView {
+    static_assert(sizeof...(ComponentTypes) > 0, "EntityView requires at least one component type");
+
+private:
+    EntityManager& entityManager;
+
+    // Drive iteration from DriverType's dense entity array
+    template<typename DriverType, typename Func>
+    void forEachDrivenBy(Func&& func) {
+        const EntityIdVector& entities =
+            entityManager.getEntitiesWithComponent<DriverType>();
+        forEachRangeDrivenBy<DriverType>(0, entities.size(), func);
+    }
+
+    // Visit driver entities in [begin, end) - shared by the serial and
+    // chunked parallel paths
+    template<typename DriverType, typename Func>
+    void forEachRangeDrivenBy(size_t begin, size_t end, Func& func) {
+        const EntityIdVector& entities =
+            entityManager.getEntitiesWithComponent<DriverType>();
+
+        for (size_t i = begin; i < end; ++i) {
+            EntityID entity = entities[i];
+            if ((entityManager.hasComponent<ComponentTypes>(entity) && ...)) {
+                func(entity, entityManager.getComponent<ComponentTypes>(entity)...);
+            }
+        }
+    }
+
+    // Chunked parallel dispatch once the driver type has been selected.
+    // Chunks run on the engine-wide JobSystem pool (the calling thread
+    // participates), so ECS parallelism shares workers with physics and
+    // asset IO instead of spawning threads of its own.
+    template<typename DriverType, typename Func>
+    void parallelForEachDrivenBy(size_t chunkSize, Func& func) {
+        const EntityIdVector& entities =
+            entityManager.getEntitiesWithComponent<DriverType>();
+
+        JobSystem::getInstance().parallelFor(entities.size(), chunkSize,
+            [this, &func](size_t begin, size_t end) {
+                forEachRangeDrivenBy<DriverType>(begin, end, func);
+            });
+    }
+
+public:
+    explicit EntityView(EntityManager& entityManager) : entityManager(entityManager) {}
+
+    // Call func(EntityID, ComponentTypes&...) for every entity that has
+    // all of ComponentTypes
+    template<typename Func>
+    void forEach(Func&& func) {
+        // Pick the smallest component array as the driver so we probe
+        // as few entities as possible
+        constexpr size_t typeCount = sizeof...(ComponentTypes);
+        std::array<size_t, typeCount> sizes = {
+            entityManager.getComponentCount<ComponentTypes>()...
+        };
+
+        size_t smallest = 0;
+        for (size_t i = 1; i < typeCount; ++i) {
+            if (sizes[i] < sizes[smallest]) {
+                smallest = i;
+            }
+        }
+
+        // No entity can match if any required array is empty
+        if (sizes[smallest] == 0) {
+            return;
+        }
+
+        size_t current = 0;
+        bool dispatched = false;
+        ((current++ == smallest && !dispatched
+              ? (forEachDrivenBy<ComponentTypes>(func), dispatched = true)
+              : false), ...);
+    }
+
+    // Chunked parallel forEach: splits the driving dense array into
+    // chunkSize slices executed concurrently (first chunk runs on the
+    // calling thread). For embarrassingly parallel per-entity work only:
+    // the functor must not touch shared mutable state without its own
+    // synchronization, and structural changes must go through the
+    // EntityCommandBuffer, never this callback.
+    template<typename Func>
+    void parallelForEach(size_t chunkSize, Func&& func) {
+        if (chunkSize == 0) {
+            chunkSize = 1;
+        }
+
+        constexpr size_t typeCount = sizeof...(ComponentTypes);
+        std::array<size_t, typeCount> sizes = {
+            entityManager.getComponentCount<ComponentTypes>()...
+        };
+
+        size_t smallest = 0;
+        for (size_t i = 1; i < typeCount; ++i) {
+            if (sizes[i] < sizes[smallest]) {
+                smallest = i;
+            }
+        }
+
+        if (sizes[smallest] == 0) {
+            return;
+        }
+
+        size_t current = 0;
+        bool dispatched = false;
+        ((current++ == smallest && !dispatched
+              ? (parallelForEachDrivenBy<ComponentTypes>(chunkSize, func), dispatched = true)
+              : false), ...);
+    }
+
+    // Filtered view that only visits entities whose first component type
+    // reports a changeVersion newer than sinceVersion. The component must
+    // expose a monotonic changeVersion field (see Transform::markDirty).
+    // Usage:
+    //     world.view<Transform, SpatialComponent>()
+    //          .changedSince(lastSeenVersion)
+    //          .forEach([](EntityID e, Transform& t, SpatialComponent& s) { ... });
+    class ChangedView {
+    private:
+        EntityView baseView;
+        uint64_t sinceVersion;
+
+    public:
+        ChangedView(const EntityView& baseView, uint64_t sinceVersion)
+            : baseView(baseView), sinceVersion(sinceVersion) {}
+
+        template<typename Func>
+        void forEach(Func&& func) {
+            uint64_t since = sinceVersion;
+            baseView.forEach([&func, since](EntityID entity, ComponentTypes&... components) {
+                // Filter on the first component in the pack
+                const auto& first = std::get<0>(std::tie(components...));
+                if (first.changeVersion > since) {
+                    func(entity, components...);
+                }
+            });
+        }
+    };
+
+    ChangedView changedSince(uint64_t sinceVersion) {
+        return ChangedView(*this, sinceVersion);
+    }
+
+    // Number of entities in the smallest contributing array (upper bound
+    // on the number of matches)
+    size_t sizeHint() const {
+        constexpr size_t typeCount = sizeof...(ComponentTypes);
+        std::array<size_t, typeCount> sizes = {
+            entityManager.getComponentCount<ComponentTypes>()...
+        };
+
+        size_t smallest = sizes[0];
+        for (size_t i = 1; i < typeCount; ++i) {
+            smallest = std::min(smallest, sizes[i]);
+        }
+        return smallest;
+    }
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "World.h"
+#include "../systems/CameraSystem.h"
+#include "../systems/SpatialSystem.h"
+#include "../systems/PhysicsSystem.h"
+#include "../game/CreatureDetectionSystem.h"
+#include "../spatial/WorldConfig.h"
+#include "../utils/Logger.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace VulkanMon {
+
+// =============================================================================
+// HEADLESS ENGINE - Simulation without a window or Vulkan device
+// =============================================================================
+//
+// Runs the ECS World with the simulation-side systems (spatial, physics,
+// creature AI) and none of the presentation stack - no Window, no
+// VulkanRenderer, no GPU required. Built for CI performance runs and AI
+// balance simulations: a scripted fixed-step loop can burn through 10,000
+// ticks in seconds on a render-less runner.
+//
+// The tick mirrors Application's frame ordering (physics stepped with
+// millisecond delta, then World::update with seconds) so headless results
+// transfer to the windowed build. World::render is simply never called -
+// render systems that happen to be absent cost nothing, and systems are
+// only added here if they work without a renderer.
+class HeadlessEngine {
+public:
+    static constexpr float DEFAULT_FIXED_STEP_SECONDS = 1.0f / 60.0f;
+
+    // Scenario hook invoked after systems update each tick - spawn
+    // creatures, issue goals, record metrics
+    using TickCallback = std::function<void(uint64_t tick, World& world)>;
+
+    explicit HeadlessEngine(const WorldConfig& worldConfig = WorldConfig::createTestWorld())
+        : worldConfig_(worldConfig) {}
+
+    ~HeadlessEngine() {
+        shutdown();
+    }
+
+    void initialize() {
+        if (world_) {
+            return;
+        }
+
+        world_ = std::make_unique<World>();
+        world_->initialize();
+
+        // CameraSystem stays in: detection staggering and LOD reference
+        // points read the "active camera" even when nothing renders, and
+        // scenarios can park a camera entity wherever the player would be
+        cameraSystem_ = world_->addSystem<CameraSystem>();
+        spatialSystem_ = world_->addSystem<SpatialSystem>(worldConfig_);
+        physicsSystem_ = world_->addSystem<PhysicsSystem>();
+        physicsSystem_->initialize(world_->getEntityManager());
+        creatureDetectionSystem_ = world_->addSystem<CreatureDetectionSystem>();
+
+        world_->connectSystems();
+        VKMON_INFO("HeadlessEngine initialized (world config '" + worldConfig_.name + "')");
+    }
+
+    // Scripted fixed-step loop: every tick advances the simulation by
+    // exactly fixedStepSeconds regardless of wall clock
+    void runTicks(uint64_t tickCount,
+                  float fixedStepSeconds = DEFAULT_FIXED_STEP_SECONDS,
+                  const TickCallback& perTick = nullptr) {
+        if (!world_) {
+            VKMON_ERROR("HeadlessEngine::runTicks called before initialize()");
+            return;
+        }
+
+        float fixedStepMs = fixedStepSeconds * 1000.0f;
+        for (uint64_t tick = 0; tick < tickCount; ++tick) {
+            // Same ordering as Application::processFrame - physics takes
+            // milliseconds, World systems take seconds
+            physicsSystem_->update(fixedStepMs, world_->getEntityManager());
+            world_->update(fixedStepSeconds);
+
+            if (perTick) {
+                perTick(ticksSimulated_, *world_);
+            }
+            ticksSimulated_++;
+        }
+    }
+
+    void shutdown() {
+        if (world_) {
+            world_->shutdown();
+            world_.reset();
+            cameraSystem_ = nullptr;
+            spatialSystem_ = nullptr;
+            physicsSystem_ = nullptr;
+            creatureDetectionSystem_ = nullptr;
+        }
+    }
+
+    bool isInitialized() const { return world_ != nullptr; }
+    uint64_t getTicksSimulated() const { return ticksSimulated_; }
+
+    World& getWorld() { return *world_; }
+    EntityManager& getEntityManager() { return world_->getEntityManager(); }
+    CameraSystem* getCameraSystem() { return cameraSystem_; }
+    SpatialSystem* getSpatialSystem() { return spatialSystem_; }
+    PhysicsSystem* getPhysicsSystem() { return physicsSystem_; }
+    CreatureDetectionSystem* getCreatureDetectionSystem() { return creatureDetectionSystem_; }
+
+private:
+    WorldConfig worldConfig_;
+    std::unique_ptr<World> world_;
+    uint64_t ticksSimulated_ = 0;
+
+    CameraSystem* cameraSystem_ = nullptr;                       // Owned by World
+    SpatialSystem* spatialSystem_ = nullptr;                     // Owned by World
+    PhysicsSystem* physicsSystem_ = nullptr;                     // Owned by World
+    CreatureDetectionSystem* creatureDetectionSystem_ = nullptr; // Owned by World
+};
+
+} // namespace VulkanMon
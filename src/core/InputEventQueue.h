@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * VulkanMon Input Event Queue
+ *
+ * Timestamped input buffering following our philosophy:
+ * - "Simple is Powerful" - One flat event struct, push and drain
+ * - "Test, Test, Test" - Pure data, no GLFW or window dependency
+ * - "Document Often" - Event fields per type documented below
+ *
+ * GLFW callbacks fire during glfwPollEvents and used to mutate camera
+ * and system state directly. At low frame rates several events land in
+ * one poll and their relative timing is lost, which makes camera motion
+ * stutter and benchmark runs unrepeatable. The queue keeps every event
+ * with the time it arrived; the Application drains it once per frame
+ * and dispatches in order, so sub-frame ordering survives and a
+ * recorded event stream can be replayed deterministically through the
+ * exact same dispatch path as live input.
+ */
+
+namespace VulkanMon {
+
+struct InputEvent {
+    enum class Type {
+        Key,          // key, scancode, action, mods
+        MouseMove,    // x, y
+        MouseButton   // key (button), action, mods
+    };
+
+    Type type = Type::Key;
+    double timestamp = 0.0;  // seconds, caller's clock (glfwGetTime for live input)
+
+    int key = 0;        // GLFW key code, or mouse button for MouseButton
+    int scancode = 0;
+    int action = 0;     // GLFW_PRESS / GLFW_RELEASE / GLFW_REPEAT
+    int mods = 0;
+    double x = 0.0;     // cursor position for MouseMove
+    double y = 0.0;
+
+    static InputEvent keyEvent(double timestamp, int key, int scancode, int action, int mods) {
+        InputEvent event;
+        event.type = Type::Key;
+        event.timestamp = timestamp;
+        event.key = key;
+        event.scancode = scancode;
+        event.action = action;
+        event.mods = mods;
+        return event;
+    }
+
+    static InputEvent mouseMoveEvent(double timestamp, double x, double y) {
+        InputEvent event;
+        event.type = Type::MouseMove;
+        event.timestamp = timestamp;
+        event.x = x;
+        event.y = y;
+        return event;
+    }
+
+    static InputEvent mouseButtonEvent(double timestamp, int button, int action, int mods) {
+        InputEvent event;
+        event.type = Type::MouseButton;
+        event.timestamp = timestamp;
+        event.key = button;
+        event.action = action;
+        event.mods = mods;
+        return event;
+    }
+};
+
+class InputEventQueue {
+public:
+    // Append an event; callbacks push in arrival order, so the queue
+    // stays timestamp-sorted without explicit sorting
+    void push(const InputEvent& event) {
+        pending_.push_back(event);
+        if (recording_) {
+            recorded_.push_back(event);
+        }
+    }
+
+    // Hand the frame's events to the consumer and leave the queue empty.
+    // The swap keeps the vector's capacity for the next frame.
+    std::vector<InputEvent> drain() {
+        std::vector<InputEvent> drained;
+        std::swap(drained, pending_);
+        return drained;
+    }
+
+    bool empty() const { return pending_.empty(); }
+    size_t size() const { return pending_.size(); }
+
+    // Recording captures every pushed event for later replay; replay is
+    // just pushing the recorded events back through the queue, so they
+    // travel the same dispatch path as live input
+    void startRecording() {
+        recorded_.clear();
+        recording_ = true;
+    }
+
+    std::vector<InputEvent> stopRecording() {
+        recording_ = false;
+        return std::move(recorded_);
+    }
+
+    bool isRecording() const { return recording_; }
+
+    void replay(const std::vector<InputEvent>& events) {
+        for (const auto& event : events) {
+            push(event);
+        }
+    }
+
+private:
+    std::vector<InputEvent> pending_;
+    std::vector<InputEvent> recorded_;
+    bool recording_ = false;
+};
+
+} // namespace VulkanMon
@@ -20,6 +20,38 @@ InputHandler::InputHandler(
     VKMON_DEBUG(world_ ? "  ECS World: connected" : "  ECS World: null");
 }
 
+void InputHandler::queueKeyEvent(int key, int scancode, int action, int mods) {
+    eventQueue_.push(InputEvent::keyEvent(glfwGetTime(), key, scancode, action, mods));
+}
+
+void InputHandler::queueMouseMoveEvent(double xpos, double ypos) {
+    eventQueue_.push(InputEvent::mouseMoveEvent(glfwGetTime(), xpos, ypos));
+}
+
+void InputHandler::queueMouseButtonEvent(int button, int action, int mods) {
+    eventQueue_.push(InputEvent::mouseButtonEvent(glfwGetTime(), button, action, mods));
+}
+
+void InputHandler::processQueuedEvents() {
+    // Dispatch in arrival order so several events from one poll (common
+    // at low frame rates) apply in the same sequence the user produced
+    // them; recorded streams replayed through the queue follow the
+    // identical path
+    for (const InputEvent& event : eventQueue_.drain()) {
+        switch (event.type) {
+            case InputEvent::Type::Key:
+                processKeyInput(event.key, event.scancode, event.action, event.mods);
+                break;
+            case InputEvent::Type::MouseMove:
+                processMouseInput(event.x, event.y);
+                break;
+            case InputEvent::Type::MouseButton:
+                processMouseButtonInput(event.key, event.action, event.mods);
+                break;
+        }
+    }
+}
+
 void InputHandler::processKeyInput(int key, int scancode, int action, int mods) {
     // Only process key press events (not release or repeat)
     if (action != GLFW_PRESS) {
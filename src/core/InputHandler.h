@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Window.h"
+#include "InputEventQueue.h"
 #include "../systems/LightingSystem.h"
 #include "../systems/MaterialSystem.h"
 #include "../systems/CameraSystem.h"
@@ -65,10 +66,35 @@ public:
     InputHandler(InputHandler&&) = default;
     InputHandler& operator=(InputHandler&&) = default;
     
+    /**
+     * Queue input events from GLFW callbacks
+     *
+     * Callbacks fire during glfwPollEvents; instead of mutating state
+     * mid-poll, events are timestamped and buffered, then dispatched in
+     * arrival order by processQueuedEvents(). This keeps sub-frame event
+     * ordering at low frame rates and gives the benchmark harness a
+     * replayable event stream.
+     */
+    void queueKeyEvent(int key, int scancode, int action, int mods);
+    void queueMouseMoveEvent(double xpos, double ypos);
+    void queueMouseButtonEvent(int button, int action, int mods);
+
+    /**
+     * Dispatch all queued events in timestamp order
+     * Called once per frame by Application before continuous input
+     */
+    void processQueuedEvents();
+
+    /**
+     * Access the event queue for recording and deterministic replay
+     * (benchmark camera paths push recorded events here)
+     */
+    InputEventQueue& eventQueue() { return eventQueue_; }
+
     /**
      * Process discrete key input events
      * Called when a key is pressed, released, or repeated
-     * 
+     *
      * @param key GLFW key code
      * @param scancode Platform-specific scan code
      * @param action GLFW_PRESS, GLFW_RELEASE, or GLFW_REPEAT
@@ -186,6 +212,10 @@ private:
     std::shared_ptr<Window> window_;
     CameraSystem* cameraSystem_;
     World* world_;
+
+    // Timestamped events buffered between glfwPollEvents and the frame's
+    // dispatch in processQueuedEvents()
+    InputEventQueue eventQueue_;
     
     // Mouse input state
     bool firstMouse_ = true;
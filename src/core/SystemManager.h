@@ -9,6 +9,9 @@
 #include <unordered_map>
 #include <chrono>
 #include <string>
+#include <future>
+#include <stdexcept>
+#include <algorithm>
 
 namespace VulkanMon {
 
@@ -24,8 +27,81 @@ class SystemManager {
 private:
     std::vector<std::unique_ptr<SystemBase>> systems;
     std::unordered_map<std::type_index, SystemBase*> systemLookup;
+    std::unordered_map<SystemBase*, std::type_index> systemTypes;
     std::unordered_map<std::type_index, SystemPerformanceData> performanceData;
 
+    // Declared update-order dependencies: system -> systems it must run after
+    std::unordered_map<SystemBase*, std::vector<SystemBase*>> dependencies;
+
+    // Update stages derived from the dependency graph. Systems within a
+    // stage have no declared ordering between them; stages run in order.
+    std::vector<std::vector<SystemBase*>> updateStages;
+    bool stagesDirty = true;
+
+    // Parallel update is opt-in: the engine's documented default is
+    // single-threaded ECS, and systems must be declared safe to overlap
+    // (no shared mutable state with their stage peers) before enabling.
+    bool parallelUpdateEnabled = false;
+
+    void recordUpdateTime(SystemBase* system, float timeMs) {
+        auto it = systemTypes.find(system);
+        if (it != systemTypes.end()) {
+            performanceData[it->second].updateTime = timeMs;
+        }
+    }
+
+    void recordRenderTime(SystemBase* system, float timeMs) {
+        auto it = systemTypes.find(system);
+        if (it != systemTypes.end()) {
+            performanceData[it->second].renderTime = timeMs;
+        }
+    }
+
+    // Kahn-style leveling: stage N holds systems whose dependencies all
+    // live in stages < N. Registration order is preserved within a stage.
+    void rebuildUpdateStages() {
+        updateStages.clear();
+
+        std::unordered_map<SystemBase*, size_t> remainingDeps;
+        for (auto& system : systems) {
+            auto it = dependencies.find(system.get());
+            remainingDeps[system.get()] = (it != dependencies.end()) ? it->second.size() : 0;
+        }
+
+        std::vector<SystemBase*> unscheduled;
+        for (auto& system : systems) {
+            unscheduled.push_back(system.get());
+        }
+
+        while (!unscheduled.empty()) {
+            std::vector<SystemBase*> stage;
+            for (SystemBase* system : unscheduled) {
+                if (remainingDeps[system] == 0) {
+                    stage.push_back(system);
+                }
+            }
+
+            if (stage.empty()) {
+                throw std::runtime_error("SystemManager: dependency cycle detected between systems");
+            }
+
+            // Retire scheduled systems and release their dependents
+            for (SystemBase* scheduled : stage) {
+                unscheduled.erase(std::remove(unscheduled.begin(), unscheduled.end(), scheduled),
+                                  unscheduled.end());
+                for (auto& [dependent, deps] : dependencies) {
+                    if (std::find(deps.begin(), deps.end(), scheduled) != deps.end()) {
+                        remainingDeps[dependent]--;
+                    }
+                }
+            }
+
+            updateStages.push_back(std::move(stage));
+        }
+
+        stagesDirty = false;
+    }
+
 public:
     // Add a system to the manager
     template<typename T, typename... Args>
@@ -38,6 +114,8 @@ public:
         systems.push_back(std::move(system));
         auto typeIndex = std::type_index(typeid(T));
         systemLookup[typeIndex] = rawPtr;
+        systemTypes.emplace(rawPtr, typeIndex);
+        stagesDirty = true;
 
         // Initialize performance data
         SystemPerformanceData perfData;
@@ -75,7 +153,48 @@ public:
             }
 
             systemLookup.erase(it);
+            systemTypes.erase(systemPtr);
+            dependencies.erase(systemPtr);
+            for (auto& [dependent, deps] : dependencies) {
+                deps.erase(std::remove(deps.begin(), deps.end(), systemPtr), deps.end());
+            }
+            stagesDirty = true;
+        }
+    }
+
+    // Declare that TSystem must update after TDependsOn
+    template<typename TSystem, typename TDependsOn>
+    void addDependency() {
+        SystemBase* system = getSystem<TSystem>();
+        SystemBase* dependsOn = getSystem<TDependsOn>();
+        if (!system || !dependsOn) {
+            throw std::runtime_error("SystemManager: addDependency on unregistered system");
+        }
+
+        auto& deps = dependencies[system];
+        if (std::find(deps.begin(), deps.end(), dependsOn) == deps.end()) {
+            deps.push_back(dependsOn);
+        }
+        stagesDirty = true;
+    }
+
+    // Enable concurrent update of systems that share a stage (no declared
+    // ordering between them). Leave disabled unless every system in the
+    // world is safe to overlap with its stage peers.
+    void setParallelUpdateEnabled(bool enabled) {
+        parallelUpdateEnabled = enabled;
+    }
+
+    bool isParallelUpdateEnabled() const {
+        return parallelUpdateEnabled;
+    }
+
+    // Number of derived update stages (mainly for tests and the inspector)
+    size_t getUpdateStageCount() {
+        if (stagesDirty) {
+            rebuildUpdateStages();
         }
+        return updateStages.size();
     }
 
     // Initialize all systems
@@ -85,45 +204,69 @@ public:
         }
     }
 
-    // Update all systems
+    // Update all systems, honoring declared dependencies
     void updateSystems(float deltaTime, EntityManager& entityManager) {
-        for (auto& system : systems) {
-            auto start = std::chrono::high_resolution_clock::now();
-            system->update(deltaTime, entityManager);
-            auto end = std::chrono::high_resolution_clock::now();
+        if (stagesDirty) {
+            rebuildUpdateStages();
+        }
 
-            // Update performance data
-            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-            float timeMs = duration.count() / 1000.0f; // Convert to milliseconds
+        for (auto& stage : updateStages) {
+            if (parallelUpdateEnabled && stage.size() > 1) {
+                // Run stage peers concurrently; each task measures its own
+                // duration and timings are committed after the join
+                std::vector<float> stageTimes(stage.size(), 0.0f);
+                std::vector<std::future<void>> tasks;
+                tasks.reserve(stage.size() - 1);
 
-            // Find the system type and update performance data
-            for (auto& [typeIndex, systemPtr] : systemLookup) {
-                if (systemPtr == system.get()) {
-                    performanceData[typeIndex].updateTime = timeMs;
-                    break;
+                for (size_t i = 1; i < stage.size(); ++i) {
+                    tasks.push_back(std::async(std::launch::async,
+                        [&, i]() {
+                            auto start = std::chrono::high_resolution_clock::now();
+                            stage[i]->update(deltaTime, entityManager);
+                            auto end = std::chrono::high_resolution_clock::now();
+                            stageTimes[i] = std::chrono::duration_cast<std::chrono::microseconds>(
+                                                end - start).count() / 1000.0f;
+                        }));
+                }
+
+                // First stage member runs on the calling thread
+                auto start = std::chrono::high_resolution_clock::now();
+                stage[0]->update(deltaTime, entityManager);
+                auto end = std::chrono::high_resolution_clock::now();
+                stageTimes[0] = std::chrono::duration_cast<std::chrono::microseconds>(
+                                    end - start).count() / 1000.0f;
+
+                for (auto& task : tasks) {
+                    task.get();
+                }
+
+                for (size_t i = 0; i < stage.size(); ++i) {
+                    recordUpdateTime(stage[i], stageTimes[i]);
+                }
+            } else {
+                for (SystemBase* system : stage) {
+                    auto start = std::chrono::high_resolution_clock::now();
+                    system->update(deltaTime, entityManager);
+                    auto end = std::chrono::high_resolution_clock::now();
+
+                    float timeMs = std::chrono::duration_cast<std::chrono::microseconds>(
+                                       end - start).count() / 1000.0f;
+                    recordUpdateTime(system, timeMs);
                 }
             }
         }
     }
 
-    // Render all systems
+    // Render all systems (always serial - command recording order matters)
     void renderSystems(VulkanRenderer& renderer, EntityManager& entityManager) {
         for (auto& system : systems) {
             auto start = std::chrono::high_resolution_clock::now();
             system->render(renderer, entityManager);
             auto end = std::chrono::high_resolution_clock::now();
 
-            // Update performance data
-            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-            float timeMs = duration.count() / 1000.0f; // Convert to milliseconds
-
-            // Find the system type and update performance data
-            for (auto& [typeIndex, systemPtr] : systemLookup) {
-                if (systemPtr == system.get()) {
-                    performanceData[typeIndex].renderTime = timeMs;
-                    break;
-                }
-            }
+            float timeMs = std::chrono::duration_cast<std::chrono::microseconds>(
+                               end - start).count() / 1000.0f;
+            recordRenderTime(system.get(), timeMs);
         }
     }
 
@@ -159,4 +302,4 @@ public:
     }
 };
 
-} // namespace VulkanMon
\ No newline at end of file
+} // namespace VulkanMon
@@ -5,6 +5,7 @@
 #include "../systems/CreatureRenderSystem.h"
 #include "../systems/PhysicsSystem.h"
 #include "../game/CreatureDetectionSystem.h"
+#include "../game/FlockingSystem.h"
 #include "../utils/Logger.h"
 
 namespace VulkanMon {
@@ -17,6 +18,7 @@ void World::connectSystems() {
     auto* renderSystem = getSystem<RenderSystem>();
     auto* creatureRenderSystem = getSystem<CreatureRenderSystem>();
     auto* creatureDetectionSystem = getSystem<CreatureDetectionSystem>();
+    auto* flockingSystem = getSystem<FlockingSystem>();
 
     // Validate required core systems exist
     if (!cameraSystem) {
@@ -43,6 +45,10 @@ void World::connectSystems() {
         creatureDetectionSystem->setSpatialSystem(spatialSystem);
     }
 
+    if (flockingSystem) {
+        flockingSystem->setSpatialSystem(spatialSystem);
+    }
+
     if (physicsSystem) {
         physicsSystem->setSpatialSystem(spatialSystem);
     }
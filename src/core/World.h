@@ -1,9 +1,15 @@
 #pragma once
 
 #include "EntityManager.h"
+#include "EntityView.h"
+#include "EntityCommandBuffer.h"
 #include "SystemManager.h"
 #include "../rendering/VulkanRenderer.h"
+#include "../utils/FrameArena.h"
+#include "../utils/FrameProfiler.h"
 #include "../utils/Logger.h"
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
@@ -12,11 +18,31 @@ namespace VulkanMon {
 
 class World {
 private:
+    // Initial slab for ECS component storage; the monotonic resource
+    // grows geometrically from here when scenes outsize it
+    static constexpr size_t COMPONENT_SLAB_INITIAL_BYTES = 256 * 1024;
+
+    // ECS storage memory: every ComponentArray allocates from one pool
+    // resource backed by a growing monotonic slab, so component growth
+    // during spawn waves carves from large contiguous blocks instead of
+    // fragmenting the global heap. Unsynchronized is correct here - ECS
+    // runs on the main thread only (single World ownership model).
+    // unique_ptr keeps World movable; the resources' addresses stay
+    // pinned for the EntityManager either way.
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> componentSlab_;
+    std::unique_ptr<std::pmr::unsynchronized_pool_resource> componentPool_;
+
     EntityManager entityManager;
     SystemManager systemManager;
+    EntityCommandBuffer commandBuffer{entityManager};
 
 public:
-    World() = default;
+    World()
+        : componentSlab_(std::make_unique<std::pmr::monotonic_buffer_resource>(
+              COMPONENT_SLAB_INITIAL_BYTES))
+        , componentPool_(std::make_unique<std::pmr::unsynchronized_pool_resource>(
+              componentSlab_.get()))
+        , entityManager(componentPool_.get()) {}
     ~World() = default;
 
     // Non-copyable but movable
@@ -32,11 +58,22 @@ public:
 
     // Update the world (called every frame)
     void update(float deltaTime) {
+        VKMON_PROFILE_SCOPE("World::update");
+
+        // New frame: reclaim all transient arena allocations from the
+        // previous update/render pass in one shot
+        FrameArena::frame().reset();
+
         systemManager.updateSystems(deltaTime, entityManager);
+
+        // Frame sync point: apply structural changes systems deferred
+        // while component arrays were being iterated
+        commandBuffer.flush();
     }
 
     // Render the world
     void render(VulkanRenderer& renderer) {
+        VKMON_PROFILE_SCOPE("World::render");
         systemManager.renderSystems(renderer, entityManager);
     }
 
@@ -79,6 +116,19 @@ public:
         return entityManager.hasComponent<T>(entity);
     }
 
+    // Deferred structural changes - record during system updates, applied
+    // automatically at the end of World::update
+    EntityCommandBuffer& getCommandBuffer() {
+        return commandBuffer;
+    }
+
+    // Multi-component iteration: world.view<Transform, Renderable>()
+    //     .forEach([](EntityID e, Transform& t, Renderable& r) { ... });
+    template<typename... ComponentTypes>
+    EntityView<ComponentTypes...> view() {
+        return EntityView<ComponentTypes...>(entityManager);
+    }
+
     // System management
     template<typename T, typename... Args>
     T* addSystem(Args&&... args) {
@@ -122,6 +172,22 @@ public:
     SystemManager& getSystemManager() { return systemManager; }
     const SystemManager& getSystemManager() const { return systemManager; }
 
+    // Scene metadata reserve hint: pre-size a component type's storage
+    // before spawning (see EntityManager::reserveComponents)
+    template<typename T>
+    void reserveComponents(size_t expectedCount) {
+        entityManager.reserveComponents<T>(expectedCount);
+    }
+
+    // Storage compaction/defrag for long sessions (see
+    // EntityManager::compactStorage). The caller supplies the locality
+    // order - typically SpatialSystem::getEntitiesInSpatialOrder() - and
+    // calls repeatedly with an idle-frame budget until this returns true
+    // (or once with a negative budget during a loading screen).
+    bool compactStorage(const std::vector<EntityID>& spatialOrder, float budgetMs) {
+        return entityManager.compactStorage(spatialOrder, budgetMs);
+    }
+
     // Stats and debugging
     template<typename T>
     size_t getComponentCount() const {
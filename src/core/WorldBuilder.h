@@ -0,0 +1,133 @@
+#pragma once
+
+#include "World.h"
+#include "../utils/JobSystem.h"
+#include "../utils/Logger.h"
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace VulkanMon {
+
+// Background world construction for scene transitions
+//
+// Rebuilding the single World in place blanks the screen for as long as
+// the build takes. WorldBuilder instead constructs a second, detached
+// World on a JobSystem worker while the current one keeps rendering,
+// then hands it over for a pointer swap at a frame boundary.
+//
+// This does not bend the single-World ownership model (OwnershipModel.h):
+// the world under construction is owned by the builder and observed by
+// exactly one thread - the worker - until takeWorld() moves it out. Only
+// after the swap does it become THE world, and by then it lives entirely
+// on the main thread again.
+//
+// Split of responsibilities:
+//   - The build function runs on the worker: create entities, add
+//     components, add systems. It must not touch the renderer, the live
+//     world, or any other shared engine state.
+//   - World::initialize() runs on the main thread inside takeWorld(),
+//     because system initialization may reach GPU-facing state.
+class WorldBuilder {
+public:
+    using BuildFunction = std::function<void(World&)>;
+
+    WorldBuilder() = default;
+
+    ~WorldBuilder() {
+        // The worker lambda captures this; let an in-flight build finish
+        // before the members it writes are torn down
+        if (building_.load(std::memory_order_acquire)) {
+            JobSystem::getInstance().waitIdle();
+        }
+    }
+
+    WorldBuilder(const WorldBuilder&) = delete;
+    WorldBuilder& operator=(const WorldBuilder&) = delete;
+
+    // Kick off construction of a detached world on a worker. Returns
+    // false (and logs) if a build is already running - scene transitions
+    // are serial by nature, queueing a second build is a logic error.
+    bool buildAsync(BuildFunction build) {
+        if (building_.load(std::memory_order_acquire)) {
+            VKMON_WARNING("WorldBuilder: build already in progress, ignoring request");
+            return false;
+        }
+
+        pendingWorld_ = std::make_unique<World>();
+        failed_ = false;
+        ready_.store(false, std::memory_order_release);
+        building_.store(true, std::memory_order_release);
+
+        JobSystem::getInstance().submit([this, build = std::move(build)]() {
+            try {
+                build(*pendingWorld_);
+            } catch (const std::exception& e) {
+                VKMON_ERROR("WorldBuilder: build function failed: " + std::string(e.what()));
+                pendingWorld_.reset();
+                failed_ = true;
+            }
+            ready_.store(true, std::memory_order_release);
+        }, JobPriority::Low);
+        return true;
+    }
+
+    bool isBuilding() const {
+        return building_.load(std::memory_order_acquire) &&
+               !ready_.load(std::memory_order_acquire);
+    }
+
+    // True once the worker has finished (successfully or not)
+    bool isReady() const {
+        return building_.load(std::memory_order_acquire) &&
+               ready_.load(std::memory_order_acquire);
+    }
+
+    bool buildFailed() const { return failed_; }
+
+    // Main thread: claim the finished world. Runs World::initialize()
+    // here so system init never executes on a worker. Returns null if
+    // the build is unfinished or failed.
+    std::unique_ptr<World> takeWorld() {
+        if (!isReady()) {
+            return nullptr;
+        }
+        building_.store(false, std::memory_order_release);
+        ready_.store(false, std::memory_order_release);
+
+        std::unique_ptr<World> world = std::move(pendingWorld_);
+        if (world) {
+            world->initialize();
+        }
+        return world;
+    }
+
+    // Frame-boundary swap: when the built world is ready, shut down the
+    // world in slot and replace it. Returns true on the frame the swap
+    // happened. Call between update/render passes - never mid-frame.
+    bool trySwap(std::unique_ptr<World>& slot) {
+        if (!isReady()) {
+            return false;
+        }
+        std::unique_ptr<World> next = takeWorld();
+        if (!next) {
+            return false;
+        }
+        if (slot) {
+            slot->shutdown();
+        }
+        slot = std::move(next);
+        VKMON_INFO("WorldBuilder: swapped in background-built world");
+        return true;
+    }
+
+private:
+    std::unique_ptr<World> pendingWorld_;
+    std::atomic<bool> building_{false};
+    std::atomic<bool> ready_{false};
+    bool failed_ = false;
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,307 @@
+#pragma once
+
+#include "World.h"
+#include "../components/Transform.h"
+#include "../components/Renderable.h"
+#include "../components/SpatialComponent.h"
+#include "../components/RigidBodyComponent.h"
+#include "../components/CreaturePhysicsComponent.h"
+#include "../utils/Logger.h"
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace VulkanMon {
+
+// Binary ECS world snapshot
+//
+// Dumps component arrays as flat blobs so large scenes restore with bulk
+// reads instead of rebuilding entity-by-entity in ApplicationSetup.
+// Trivially copyable components (Transform, SpatialComponent,
+// RigidBodyComponent, CreaturePhysicsComponent) are written as one
+// contiguous blob per type; Renderable needs per-element encoding for
+// its asset path strings.
+//
+// Entity IDs are remapped on load (snapshots restore into a fresh or
+// existing world without colliding with live IDs). CollisionComponent is
+// deliberately excluded: its std::function callbacks cannot be
+// serialized and must be re-attached by gameplay code after load.
+class WorldSnapshot {
+private:
+    static constexpr uint32_t MAGIC = 0x564B4D57;   // 'VKMW'
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    enum class SectionType : uint32_t {
+        TransformSection = 1,
+        RenderableSection = 2,
+        SpatialSection = 3,
+        RigidBodySection = 4,
+        CreaturePhysicsSection = 5,
+        EndOfFile = 0xFFFFFFFF
+    };
+
+    // Entity ID remapping during load: snapshot IDs -> freshly created IDs
+    using EntityRemap = std::unordered_map<EntityID, EntityID>;
+
+    static EntityID remapEntity(World& world, EntityRemap& remap, EntityID snapshotId) {
+        auto it = remap.find(snapshotId);
+        if (it != remap.end()) {
+            return it->second;
+        }
+        EntityID fresh = world.createEntity();
+        remap[snapshotId] = fresh;
+        return fresh;
+    }
+
+    template<typename T>
+    static void writePod(std::ostream& out, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    static bool readPod(std::istream& in, T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+        return in.good();
+    }
+
+    static void writeString(std::ostream& out, const std::string& str) {
+        uint32_t length = static_cast<uint32_t>(str.size());
+        writePod(out, length);
+        out.write(str.data(), length);
+    }
+
+    static bool readString(std::istream& in, std::string& str) {
+        uint32_t length = 0;
+        if (!readPod(in, length)) return false;
+        str.resize(length);
+        in.read(str.data(), length);
+        return in.good();
+    }
+
+    // Bulk section for trivially copyable component types: entity ID
+    // array followed by the raw component blob. A subset filter gathers
+    // the matching rows into temporaries first (streaming cell bakes);
+    // the common full-world save keeps the zero-copy blob write.
+    template<typename T>
+    static void writeBlobSection(std::ostream& out, World& world, SectionType type,
+                                 const std::unordered_set<EntityID>* subset) {
+        auto& entityManager = world.getEntityManager();
+        const EntityIdVector& entities = entityManager.getEntitiesWithComponent<T>();
+        const ComponentVector<T>& components = entityManager.getAllComponents<T>();
+
+        writePod(out, static_cast<uint32_t>(type));
+        if (subset) {
+            std::vector<EntityID> filteredEntities;
+            std::vector<T> filteredComponents;
+            for (size_t i = 0; i < entities.size(); ++i) {
+                if (subset->count(entities[i])) {
+                    filteredEntities.push_back(entities[i]);
+                    filteredComponents.push_back(components[i]);
+                }
+            }
+            writePod(out, static_cast<uint64_t>(filteredEntities.size()));
+            if (!filteredEntities.empty()) {
+                out.write(reinterpret_cast<const char*>(filteredEntities.data()),
+                          filteredEntities.size() * sizeof(EntityID));
+                out.write(reinterpret_cast<const char*>(filteredComponents.data()),
+                          filteredComponents.size() * sizeof(T));
+            }
+            return;
+        }
+
+        writePod(out, static_cast<uint64_t>(entities.size()));
+        if (!entities.empty()) {
+            out.write(reinterpret_cast<const char*>(entities.data()),
+                      entities.size() * sizeof(EntityID));
+            out.write(reinterpret_cast<const char*>(components.data()),
+                      components.size() * sizeof(T));
+        }
+    }
+
+    template<typename T>
+    static bool readBlobSection(std::istream& in, World& world, EntityRemap& remap) {
+        uint64_t count = 0;
+        if (!readPod(in, count)) return false;
+
+        std::vector<EntityID> entities(count);
+        std::vector<T> components(count);
+        if (count > 0) {
+            in.read(reinterpret_cast<char*>(entities.data()), count * sizeof(EntityID));
+            in.read(reinterpret_cast<char*>(components.data()), count * sizeof(T));
+            if (!in.good()) return false;
+        }
+
+        for (uint64_t i = 0; i < count; ++i) {
+            world.addComponent(remapEntity(world, remap, entities[i]), components[i]);
+        }
+        return true;
+    }
+
+    static void writeRenderableSection(std::ostream& out, World& world,
+                                       const std::unordered_set<EntityID>* subset) {
+        auto& entityManager = world.getEntityManager();
+        const EntityIdVector& entities =
+            entityManager.getEntitiesWithComponent<Renderable>();
+        ComponentVector<Renderable>& components = entityManager.getAllComponents<Renderable>();
+
+        uint64_t count = 0;
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if (!subset || subset->count(entities[i])) ++count;
+        }
+
+        writePod(out, static_cast<uint32_t>(SectionType::RenderableSection));
+        writePod(out, count);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if (subset && !subset->count(entities[i])) continue;
+            const Renderable& renderable = components[i];
+            writePod(out, entities[i]);
+            writeString(out, renderable.meshPath());
+            writeString(out, renderable.texturePath());
+            writePod(out, renderable.materialId);
+            writePod(out, renderable.isVisible);
+            writePod(out, renderable.castsShadow);
+            writePod(out, renderable.receivesShadow);
+            writePod(out, renderable.lodDistance);
+            writePod(out, renderable.currentLod);
+            writePod(out, renderable.renderLayer);
+        }
+    }
+
+    static bool readRenderableSection(std::istream& in, World& world, EntityRemap& remap) {
+        uint64_t count = 0;
+        if (!readPod(in, count)) return false;
+
+        for (uint64_t i = 0; i < count; ++i) {
+            EntityID snapshotId = INVALID_ENTITY;
+            Renderable renderable;
+            std::string meshPath;
+            std::string texturePath;
+            if (!readPod(in, snapshotId)) return false;
+            if (!readString(in, meshPath)) return false;
+            if (!readString(in, texturePath)) return false;
+            renderable.setMesh(meshPath);
+            renderable.setTexture(texturePath);
+            if (!readPod(in, renderable.materialId)) return false;
+            if (!readPod(in, renderable.isVisible)) return false;
+            if (!readPod(in, renderable.castsShadow)) return false;
+            if (!readPod(in, renderable.receivesShadow)) return false;
+            if (!readPod(in, renderable.lodDistance)) return false;
+            if (!readPod(in, renderable.currentLod)) return false;
+            if (!readPod(in, renderable.renderLayer)) return false;
+
+            world.addComponent(remapEntity(world, remap, snapshotId), renderable);
+        }
+        return true;
+    }
+
+public:
+    // Write snapshot-supported component arrays to a stream. When subset
+    // is given, only those entities are written - this is how the world
+    // streamer bakes per-cell files from an authored world.
+    static bool save(World& world, std::ostream& out,
+                     const std::unordered_set<EntityID>* subset = nullptr) {
+        writePod(out, MAGIC);
+        writePod(out, FORMAT_VERSION);
+
+        writeBlobSection<Transform>(out, world, SectionType::TransformSection, subset);
+        writeRenderableSection(out, world, subset);
+        writeBlobSection<SpatialComponent>(out, world, SectionType::SpatialSection, subset);
+        writeBlobSection<RigidBodyComponent>(out, world, SectionType::RigidBodySection, subset);
+        writeBlobSection<CreaturePhysicsComponent>(out, world, SectionType::CreaturePhysicsSection, subset);
+
+        writePod(out, static_cast<uint32_t>(SectionType::EndOfFile));
+        return out.good();
+    }
+
+    static bool save(World& world, const std::string& path,
+                     const std::unordered_set<EntityID>* subset = nullptr) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            VKMON_ERROR("WorldSnapshot: failed to open for write: " + path);
+            return false;
+        }
+        return save(world, out, subset);
+    }
+
+    // Restore snapshot into world. Entities are created fresh with
+    // remapped IDs; restoring into a non-empty world adds alongside
+    // existing entities. createdEntities (when non-null) receives the
+    // fresh IDs so callers like the world streamer can release them
+    // later. The label names the source in error messages.
+    static bool load(World& world, std::istream& in, const std::string& label,
+                     std::vector<EntityID>* createdEntities = nullptr) {
+        uint32_t magic = 0, version = 0;
+        if (!readPod(in, magic) || magic != MAGIC) {
+            VKMON_ERROR("WorldSnapshot: bad magic in " + label);
+            return false;
+        }
+        if (!readPod(in, version) || version != FORMAT_VERSION) {
+            VKMON_ERROR("WorldSnapshot: unsupported format version in " + label);
+            return false;
+        }
+
+        EntityRemap remap;
+        while (true) {
+            uint32_t rawType = 0;
+            if (!readPod(in, rawType)) {
+                VKMON_ERROR("WorldSnapshot: truncated file: " + label);
+                return false;
+            }
+
+            bool ok = true;
+            switch (static_cast<SectionType>(rawType)) {
+                case SectionType::EndOfFile:
+                    if (createdEntities) {
+                        for (const auto& [snapshotId, freshId] : remap) {
+                            (void)snapshotId;
+                            createdEntities->push_back(freshId);
+                        }
+                    }
+                    return true;
+                case SectionType::TransformSection:
+                    ok = readBlobSection<Transform>(in, world, remap);
+                    break;
+                case SectionType::RenderableSection:
+                    ok = readRenderableSection(in, world, remap);
+                    break;
+                case SectionType::SpatialSection:
+                    ok = readBlobSection<SpatialComponent>(in, world, remap);
+                    break;
+                case SectionType::RigidBodySection:
+                    ok = readBlobSection<RigidBodyComponent>(in, world, remap);
+                    break;
+                case SectionType::CreaturePhysicsSection:
+                    ok = readBlobSection<CreaturePhysicsComponent>(in, world, remap);
+                    break;
+                default:
+                    VKMON_ERROR("WorldSnapshot: unknown section type in " + label);
+                    return false;
+            }
+
+            if (!ok) {
+                VKMON_ERROR("WorldSnapshot: failed reading section in " + label);
+                return false;
+            }
+        }
+    }
+
+    static bool load(World& world, const std::string& path,
+                     std::vector<EntityID>* createdEntities = nullptr) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open()) {
+            VKMON_ERROR("WorldSnapshot: failed to open for read: " + path);
+            return false;
+        }
+        return load(world, in, path, createdEntities);
+    }
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,308 @@
+#pragma once
+
+#include "World.h"
+#include "WorldSnapshot.h"
+#include "../components/Transform.h"
+#include "../spatial/WorldConfig.h"
+#include "../utils/JobSystem.h"
+#include "../utils/Logger.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace VulkanMon {
+
+// Streaming grid parameters. The unload radius must exceed the load
+// radius - the gap is hysteresis that keeps a cell resident while the
+// player hovers near its boundary instead of thrashing load/release.
+struct StreamingConfig {
+    float cellSize = 32.0f;
+    float loadRadius = 64.0f;
+    float unloadRadius = 96.0f;
+    std::string cellDirectory = "world_cells";
+
+    void validate() const {
+        if (cellSize <= 0.0f) {
+            throw std::invalid_argument("StreamingConfig: cellSize must be positive");
+        }
+        if (loadRadius <= 0.0f) {
+            throw std::invalid_argument("StreamingConfig: loadRadius must be positive");
+        }
+        if (unloadRadius <= loadRadius) {
+            throw std::invalid_argument("StreamingConfig: unloadRadius must exceed loadRadius for hysteresis");
+        }
+    }
+};
+
+// Spatial-cell entity streaming for large worlds
+//
+// Partitions the WorldConfig bounds into an XZ grid of cells and keeps
+// only cells near a focus position (the player) instantiated as live ECS
+// entities. Distant cells exist solely as WorldSnapshot files on disk,
+// so memory and per-frame update cost scale with the active area rather
+// than total world size.
+//
+// Threading contract: file reads run as Low-priority jobs on the shared
+// JobSystem pool and touch nothing but the completed-load queue (under
+// its mutex). Entity instantiation and release always happen on the main
+// thread inside update(), preserving the engine's single-threaded ECS
+// model (see OwnershipModel.h).
+//
+// A cell that drifts out of range while its file read is still in flight
+// is not cancelled - it instantiates on arrival and the next update()
+// releases it. Resize-rate churn like that is rare enough that the
+// simpler lifecycle wins over a cancellation protocol.
+class WorldStreamer {
+public:
+    WorldStreamer(World& world, const WorldConfig& worldConfig, const StreamingConfig& config)
+        : world_(world)
+        , config_(config)
+        , worldMin_(worldConfig.minBounds)
+    {
+        config_.validate();
+        glm::vec3 size = worldConfig.getSize();
+        cellsX_ = std::max(1, static_cast<int>(std::ceil(size.x / config_.cellSize)));
+        cellsZ_ = std::max(1, static_cast<int>(std::ceil(size.z / config_.cellSize)));
+        cells_.resize(static_cast<size_t>(cellsX_) * static_cast<size_t>(cellsZ_));
+
+        VKMON_INFO("WorldStreamer: " + std::to_string(cellsX_) + "x" + std::to_string(cellsZ_) +
+                   " cell grid over world '" + worldConfig.name + "'");
+    }
+
+    ~WorldStreamer() {
+        // In-flight read jobs capture this; let them drain before the
+        // completed-load queue is torn down
+        if (loadingCells_ > 0) {
+            JobSystem::getInstance().waitIdle();
+        }
+    }
+
+    WorldStreamer(const WorldStreamer&) = delete;
+    WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+    // Partition every entity with a Transform (minus the exclusions -
+    // player, camera, anything that must stay live) into per-cell
+    // snapshot files and destroy the baked entities. Afterwards the world
+    // holds only the exclusions; update() streams cells back in around
+    // the focus. Cells with no entities get no file.
+    bool bakeAndRelease(const std::unordered_set<EntityID>& keepAlive = {}) {
+        std::error_code ec;
+        std::filesystem::create_directories(config_.cellDirectory, ec);
+        if (ec) {
+            VKMON_ERROR("WorldStreamer: failed to create cell directory: " + config_.cellDirectory);
+            return false;
+        }
+
+        // Group streamable entities by the cell their position falls in
+        std::vector<std::unordered_set<EntityID>> cellEntities(cells_.size());
+        auto& entityManager = world_.getEntityManager();
+        const EntityIdVector& entities = entityManager.getEntitiesWithComponent<Transform>();
+        const ComponentVector<Transform>& transforms = entityManager.getAllComponents<Transform>();
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if (keepAlive.count(entities[i])) continue;
+            cellEntities[cellIndexFor(transforms[i].position)].insert(entities[i]);
+        }
+
+        size_t baked = 0;
+        for (size_t cell = 0; cell < cellEntities.size(); ++cell) {
+            if (cellEntities[cell].empty()) continue;
+            if (!WorldSnapshot::save(world_, cellPath(cell), &cellEntities[cell])) {
+                return false;
+            }
+            for (EntityID entity : cellEntities[cell]) {
+                world_.destroyEntity(entity);
+                ++baked;
+            }
+        }
+
+        VKMON_INFO("WorldStreamer: baked " + std::to_string(baked) + " entities into cell files");
+        return true;
+    }
+
+    // Per-frame driver: instantiate finished loads, request cells within
+    // loadRadius of the focus, release loaded cells beyond unloadRadius.
+    // Scans only the cell index range covering the load radius.
+    void update(const glm::vec3& focusPosition) {
+        drainCompletedLoads();
+
+        int minX = clampCellX(static_cast<int>(std::floor((focusPosition.x - config_.loadRadius - worldMin_.x) / config_.cellSize)));
+        int maxX = clampCellX(static_cast<int>(std::floor((focusPosition.x + config_.loadRadius - worldMin_.x) / config_.cellSize)));
+        int minZ = clampCellZ(static_cast<int>(std::floor((focusPosition.z - config_.loadRadius - worldMin_.z) / config_.cellSize)));
+        int maxZ = clampCellZ(static_cast<int>(std::floor((focusPosition.z + config_.loadRadius - worldMin_.z) / config_.cellSize)));
+
+        for (int z = minZ; z <= maxZ; ++z) {
+            for (int x = minX; x <= maxX; ++x) {
+                size_t cell = static_cast<size_t>(z) * cellsX_ + x;
+                if (cells_[cell].state == CellState::Unloaded && !cells_[cell].fileMissing &&
+                    cellDistance(cell, focusPosition) <= config_.loadRadius) {
+                    requestLoad(cell);
+                }
+            }
+        }
+
+        // Release pass over resident cells only - never the whole grid
+        for (auto it = residentCells_.begin(); it != residentCells_.end();) {
+            size_t cell = *it;
+            if (cells_[cell].state == CellState::Loaded &&
+                cellDistance(cell, focusPosition) > config_.unloadRadius) {
+                releaseCell(cell);
+                it = residentCells_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Block until every in-flight cell read has been instantiated.
+    // Initial load and teleports, not per-frame use.
+    void flushPendingLoads() {
+        while (loadingCells_ > 0) {
+            JobSystem::getInstance().waitIdle();
+            drainCompletedLoads();
+        }
+    }
+
+    size_t loadedCellCount() const {
+        size_t count = 0;
+        for (size_t cell : residentCells_) {
+            if (cells_[cell].state == CellState::Loaded) ++count;
+        }
+        return count;
+    }
+
+    size_t pendingLoadCount() const { return loadingCells_; }
+
+    size_t loadedEntityCount() const {
+        size_t count = 0;
+        for (size_t cell : residentCells_) {
+            count += cells_[cell].entities.size();
+        }
+        return count;
+    }
+
+private:
+    enum class CellState { Unloaded, Loading, Loaded };
+
+    struct Cell {
+        CellState state = CellState::Unloaded;
+        bool fileMissing = false;          // permanently empty - never re-request
+        std::vector<EntityID> entities;    // live IDs while Loaded
+    };
+
+    struct CompletedLoad {
+        size_t cell = 0;
+        std::string bytes;
+        bool missing = false;
+    };
+
+    size_t cellIndexFor(const glm::vec3& position) const {
+        int x = clampCellX(static_cast<int>(std::floor((position.x - worldMin_.x) / config_.cellSize)));
+        int z = clampCellZ(static_cast<int>(std::floor((position.z - worldMin_.z) / config_.cellSize)));
+        return static_cast<size_t>(z) * cellsX_ + x;
+    }
+
+    int clampCellX(int x) const { return std::clamp(x, 0, cellsX_ - 1); }
+    int clampCellZ(int z) const { return std::clamp(z, 0, cellsZ_ - 1); }
+
+    std::string cellPath(size_t cell) const {
+        int x = static_cast<int>(cell % cellsX_);
+        int z = static_cast<int>(cell / cellsX_);
+        return config_.cellDirectory + "/cell_" + std::to_string(x) + "_" + std::to_string(z) + ".vkmw";
+    }
+
+    // XZ distance from the focus to the nearest point of the cell's
+    // footprint; zero when the focus stands inside the cell
+    float cellDistance(size_t cell, const glm::vec3& focus) const {
+        float minX = worldMin_.x + static_cast<float>(cell % cellsX_) * config_.cellSize;
+        float minZ = worldMin_.z + static_cast<float>(cell / cellsX_) * config_.cellSize;
+        float dx = std::max({minX - focus.x, 0.0f, focus.x - (minX + config_.cellSize)});
+        float dz = std::max({minZ - focus.z, 0.0f, focus.z - (minZ + config_.cellSize)});
+        return std::sqrt(dx * dx + dz * dz);
+    }
+
+    void requestLoad(size_t cell) {
+        cells_[cell].state = CellState::Loading;
+        ++loadingCells_;
+
+        std::string path = cellPath(cell);
+        JobSystem::getInstance().submit([this, cell, path]() {
+            CompletedLoad result;
+            result.cell = cell;
+
+            std::ifstream in(path, std::ios::binary);
+            if (!in.is_open()) {
+                result.missing = true;
+            } else {
+                std::ostringstream buffer;
+                buffer << in.rdbuf();
+                result.bytes = std::move(buffer).str();
+            }
+
+            std::lock_guard<std::mutex> lock(completedMutex_);
+            completedLoads_.push_back(std::move(result));
+        }, JobPriority::Low);
+    }
+
+    // Main thread: turn finished file reads into live entities
+    void drainCompletedLoads() {
+        std::vector<CompletedLoad> completed;
+        {
+            std::lock_guard<std::mutex> lock(completedMutex_);
+            completed.swap(completedLoads_);
+        }
+
+        for (auto& load : completed) {
+            Cell& cell = cells_[load.cell];
+            --loadingCells_;
+
+            if (load.missing) {
+                cell.fileMissing = true;
+                cell.state = CellState::Unloaded;
+                continue;
+            }
+
+            std::istringstream in(std::move(load.bytes));
+            cell.entities.clear();
+            if (!WorldSnapshot::load(world_, in, cellPath(load.cell), &cell.entities)) {
+                VKMON_ERROR("WorldStreamer: failed to instantiate cell " + cellPath(load.cell));
+                // Leave any partially created entities for the release
+                // path and retry no further - a corrupt cell stays out
+                cell.fileMissing = true;
+            }
+            cell.state = CellState::Loaded;
+            residentCells_.push_back(load.cell);
+        }
+    }
+
+    void releaseCell(size_t cell) {
+        for (EntityID entity : cells_[cell].entities) {
+            world_.destroyEntity(entity);
+        }
+        cells_[cell].entities.clear();
+        cells_[cell].state = CellState::Unloaded;
+    }
+
+    World& world_;
+    StreamingConfig config_;
+    glm::vec3 worldMin_;
+    int cellsX_ = 0;
+    int cellsZ_ = 0;
+
+    std::vector<Cell> cells_;
+    std::vector<size_t> residentCells_;   // cells currently holding entities
+    size_t loadingCells_ = 0;
+
+    std::mutex completedMutex_;
+    std::vector<CompletedLoad> completedLoads_;
+};
+
+} // namespace VulkanMon
@@ -1,10 +1,14 @@
 #include "ECSInspector.h"
+#include "../utils/FrameProfiler.h"
 #include "../utils/Logger.h"
+#include "../utils/MemoryTracker.h"
 #include "../systems/SpatialSystem.h"
 #include <glm/gtc/type_ptr.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/euler_angles.hpp>
 #include <algorithm>
+#include <cfloat>
+#include <chrono>
 #include <sstream>
 #include <iomanip>
 
@@ -25,6 +29,25 @@ void ECSInspector::render(float deltaTime) {
     // Update performance data with actual frame time
     updatePerformanceData(deltaTime);
 
+    // Throttled entity list refresh - filter or population changes mark
+    // the cache dirty for an immediate rebuild
+    entityListRefreshTimerMs_ += deltaTime;
+    if (entityListDirty_ || entityListRefreshTimerMs_ >= 1000.0f / ENTITY_LIST_REFRESH_HZ) {
+        refreshEntityListCache();
+        entityListRefreshTimerMs_ = 0.0f;
+        entityListDirty_ = false;
+    }
+
+    // Each panel is timed so its cost shows in the profiler's Inspector
+    // Overhead readout (values are from this frame, displayed next frame
+    // for the profiler panel itself)
+    using Clock = std::chrono::high_resolution_clock;
+    auto timePanel = [](float& costMs, auto&& body) {
+        auto start = Clock::now();
+        body();
+        costMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+    };
+
     // Main inspector layout with docking
     if (ImGui::Begin("ECS Inspector", &enabled_)) {
         // Inspector controls
@@ -36,25 +59,27 @@ void ECSInspector::render(float deltaTime) {
 
         // Split layout: Entity list on left, Component inspector on right
         ImGui::BeginChild("EntityListPane", ImVec2(300, 0), true);
-        renderEntityList();
+        timePanel(panelCosts_.entityListMs, [this]() { renderEntityList(); });
         ImGui::EndChild();
 
         ImGui::SameLine();
 
         ImGui::BeginChild("ComponentPane", ImVec2(0, 0), true);
-        renderComponentInspector();
+        timePanel(panelCosts_.componentInspectorMs, [this]() { renderComponentInspector(); });
         ImGui::EndChild();
     }
     ImGui::End();
 
     // Performance profiler in separate window
     if (showPerformanceProfiler_) {
-        renderPerformanceProfiler();
+        timePanel(panelCosts_.profilerMs, [this]() { renderPerformanceProfiler(); });
+    } else {
+        panelCosts_.profilerMs = 0.0f;
     }
 
     // Scene operations panel
     if (ImGui::Begin("Scene Operations", nullptr, ImGuiWindowFlags_AlwaysAutoResize)) {
-        renderSceneOperations();
+        timePanel(panelCosts_.sceneOperationsMs, [this]() { renderSceneOperations(); });
     }
     ImGui::End();
 }
@@ -67,13 +92,18 @@ void ECSInspector::renderEntityList() {
     static char filterBuffer[256] = "";
     if (ImGui::InputText("##Filter", filterBuffer, sizeof(filterBuffer))) {
         entityFilter_ = std::string(filterBuffer);
+        entityListDirty_ = true;
     }
     ImGui::SameLine();
     if (ImGui::Button("Clear")) {
         entityFilter_.clear();
+        filterBuffer[0] = '\0';
+        entityListDirty_ = true;
     }
 
-    ImGui::Checkbox("Visible Only", &showOnlyVisible_);
+    if (ImGui::Checkbox("Visible Only", &showOnlyVisible_)) {
+        entityListDirty_ = true;
+    }
     if (showComponentHelp_) {
         renderHelpTooltip("Show only entities with visible Renderable components");
     }
@@ -114,55 +144,79 @@ void ECSInspector::renderEntityList() {
 
     ImGui::Separator();
 
-    // Entity list
+    // Entity list - iterates the sampled cache and only materializes the
+    // rows the clipper says are on screen, so list cost stays flat as the
+    // entity count grows
+    ImGui::TextDisabled("%zu entities (refreshed at %.0f Hz)",
+                        entityListCache_.size(), ENTITY_LIST_REFRESH_HZ);
     if (ImGui::BeginListBox("##Entities", ImVec2(-1, -1))) {
         auto& entityManager = world_->getEntityManager();
-        auto entities = entityManager.getEntitiesWithComponent<Transform>();
 
-        for (EntityID entityId : entities) {
-            if (!shouldShowEntity(entityId)) continue;
-
-            std::string label = formatEntityLabel(entityId);
-            bool isSelected = (selectedEntity_ == entityId);
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(entityListCache_.size()));
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+                EntityID entityId = entityListCache_[static_cast<size_t>(row)];
 
-            if (ImGui::Selectable(label.c_str(), isSelected)) {
-                selectedEntity_ = entityId;
-            }
+                // The cache can outlive an entity by up to one refresh period
+                if (!entityManager.hasComponent<Transform>(entityId)) {
+                    continue;
+                }
 
-            // Right-click context menu
-            if (ImGui::IsItemHovered() && ImGui::IsMouseReleased(ImGuiMouseButton_Right)) {
-                ImGui::OpenPopup(("EntityContext##" + std::to_string(entityId)).c_str());
-            }
+                std::string label = formatEntityLabel(entityId);
+                bool isSelected = (selectedEntity_ == entityId);
 
-            if (ImGui::BeginPopup(("EntityContext##" + std::to_string(entityId)).c_str())) {
-                if (ImGui::MenuItem("Select")) {
+                if (ImGui::Selectable(label.c_str(), isSelected)) {
                     selectedEntity_ = entityId;
                 }
-                if (ImGui::MenuItem("Duplicate")) {
-                    EntityID duplicatedEntity = duplicateEntity(entityId);
-                    if (duplicatedEntity != INVALID_ENTITY) {
-                        selectedEntity_ = duplicatedEntity;
-                        VKMON_INFO("Duplicated entity " + std::to_string(entityId) + " to entity " + std::to_string(duplicatedEntity));
-                    } else {
-                        VKMON_WARNING("Failed to duplicate entity " + std::to_string(entityId));
-                    }
+
+                // Right-click context menu
+                if (ImGui::IsItemHovered() && ImGui::IsMouseReleased(ImGuiMouseButton_Right)) {
+                    ImGui::OpenPopup(("EntityContext##" + std::to_string(entityId)).c_str());
                 }
-                ImGui::Separator();
-                if (ImGui::MenuItem("Delete", "Del")) {
-                    if (selectedEntity_ == entityId) {
-                        deleteSelectedEntity();
-                    } else {
-                        world_->destroyEntity(entityId);
-                        VKMON_INFO("Deleted Entity " + std::to_string(entityId));
+
+                if (ImGui::BeginPopup(("EntityContext##" + std::to_string(entityId)).c_str())) {
+                    if (ImGui::MenuItem("Select")) {
+                        selectedEntity_ = entityId;
+                    }
+                    if (ImGui::MenuItem("Duplicate")) {
+                        EntityID duplicatedEntity = duplicateEntity(entityId);
+                        if (duplicatedEntity != INVALID_ENTITY) {
+                            selectedEntity_ = duplicatedEntity;
+                            VKMON_INFO("Duplicated entity " + std::to_string(entityId) + " to entity " + std::to_string(duplicatedEntity));
+                        } else {
+                            VKMON_WARNING("Failed to duplicate entity " + std::to_string(entityId));
+                        }
+                    }
+                    ImGui::Separator();
+                    if (ImGui::MenuItem("Delete", "Del")) {
+                        if (selectedEntity_ == entityId) {
+                            deleteSelectedEntity();
+                        } else {
+                            world_->destroyEntity(entityId);
+                            entityListDirty_ = true;
+                            VKMON_INFO("Deleted Entity " + std::to_string(entityId));
+                        }
                     }
+                    ImGui::EndPopup();
                 }
-                ImGui::EndPopup();
             }
         }
         ImGui::EndListBox();
     }
 }
 
+void ECSInspector::refreshEntityListCache() {
+    entityListCache_.clear();
+
+    auto& entityManager = world_->getEntityManager();
+    for (EntityID entityId : entityManager.getEntitiesWithComponent<Transform>()) {
+        if (shouldShowEntity(entityId)) {
+            entityListCache_.push_back(entityId);
+        }
+    }
+}
+
 void ECSInspector::renderComponentInspector() {
     if (selectedEntity_ == INVALID_ENTITY) {
         ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "No entity selected");
@@ -292,11 +346,13 @@ bool ECSInspector::renderRenderableEditor(Renderable& renderable) {
     bool modified = false;
 
     // Mesh path selector with dropdown
-    if (ImGui::BeginCombo("Mesh", renderable.meshPath.c_str())) {
+    if (ImGui::BeginCombo("Mesh", renderable.meshPath().c_str())) {
         for (const auto& mesh : availableMeshes_) {
-            bool selected = (renderable.meshPath == mesh);
+            bool selected = (renderable.meshPath() == mesh);
             if (ImGui::Selectable(mesh.c_str(), selected)) {
-                renderable.meshPath = mesh;
+                // setMesh keeps the interned meshId in sync for the
+                // render systems' string-free hot paths
+                renderable.setMesh(mesh);
                 modified = true;
             }
             if (selected) {
@@ -584,7 +640,7 @@ EntityID ECSInspector::createEntityFromTemplate(EntityTemplate templateType, con
         case EntityTemplate::CUBE:
             {
                 Renderable renderable;
-                renderable.meshPath = "cube.obj";
+                renderable.setMesh("cube.obj");
                 renderable.materialId = 0; // Default material
                 world_->addComponent<Renderable>(newEntity, renderable);
                 break;
@@ -592,7 +648,7 @@ EntityID ECSInspector::createEntityFromTemplate(EntityTemplate templateType, con
         case EntityTemplate::SPHERE:
             {
                 Renderable renderable;
-                renderable.meshPath = "sphere.obj";
+                renderable.setMesh("sphere.obj");
                 renderable.materialId = 1; // Gold material
                 world_->addComponent<Renderable>(newEntity, renderable);
                 break;
@@ -600,7 +656,7 @@ EntityID ECSInspector::createEntityFromTemplate(EntityTemplate templateType, con
         case EntityTemplate::PYRAMID:
             {
                 Renderable renderable;
-                renderable.meshPath = "pyramid.obj";
+                renderable.setMesh("pyramid.obj");
                 renderable.materialId = 2; // Ruby material
                 world_->addComponent<Renderable>(newEntity, renderable);
                 break;
@@ -608,7 +664,7 @@ EntityID ECSInspector::createEntityFromTemplate(EntityTemplate templateType, con
         case EntityTemplate::PLANE:
             {
                 Renderable renderable;
-                renderable.meshPath = "plane.obj";
+                renderable.setMesh("plane.obj");
                 renderable.materialId = 4; // Emerald material
                 world_->addComponent<Renderable>(newEntity, renderable);
                 break;
@@ -630,7 +686,7 @@ EntityID ECSInspector::createEntityFromTemplate(EntityTemplate templateType, con
                 int randomModel = rand() % 3;
 
                 Renderable renderable;
-                renderable.meshPath = creatureModels[randomModel];
+                renderable.setMesh(creatureModels[randomModel]);
                 renderable.materialId = rand() % MATERIAL_COUNT;  // Random material
                 renderable.isVisible = true;
                 world_->addComponent<Renderable>(newEntity, renderable);
@@ -656,6 +712,7 @@ EntityID ECSInspector::createEntityFromTemplate(EntityTemplate templateType, con
     }
 
     VKMON_INFO("Created entity " + std::to_string(newEntity) + " from template");
+    entityListDirty_ = true;
     return newEntity;
 }
 
@@ -665,6 +722,7 @@ void ECSInspector::deleteSelectedEntity() {
     world_->destroyEntity(selectedEntity_);
     VKMON_INFO("Deleted Entity " + std::to_string(selectedEntity_));
     selectedEntity_ = INVALID_ENTITY;
+    entityListDirty_ = true;
 }
 
 EntityID ECSInspector::duplicateEntity(EntityID sourceEntity) {
@@ -701,6 +759,7 @@ EntityID ECSInspector::duplicateEntity(EntityID sourceEntity) {
         world_->addComponent<Camera>(newEntity, sourceCamera);
     }
 
+    entityListDirty_ = true;
     return newEntity;
 }
 
@@ -713,7 +772,7 @@ void ECSInspector::renderComponentAddition() {
     if (!entityManager.hasComponent<Renderable>(selectedEntity_)) {
         if (ImGui::Button("Add Renderable")) {
             Renderable renderable;
-            renderable.meshPath = "cube.obj";
+            renderable.setMesh("cube.obj");
             renderable.materialId = 0;
             world_->addComponent<Renderable>(selectedEntity_, renderable);
             VKMON_INFO("Added Renderable component to Entity " + std::to_string(selectedEntity_));
@@ -767,6 +826,159 @@ void ECSInspector::renderPerformanceProfiler() {
     if (ImGui::Begin("Performance Profiler", &showPerformanceProfiler_)) {
         ImGui::Text("Frame Time: %.3f ms (%.1f FPS)", performanceData_.frameTime, 1000.0f / performanceData_.frameTime);
 
+        // The inspector's own cost (previous frame - the profiler panel
+        // cannot time itself mid-draw)
+        ImGui::Text("Inspector Overhead: %.3f ms", panelCosts_.totalMs());
+        ImGui::Indent();
+        ImGui::Text("Entity List: %.3f ms", panelCosts_.entityListMs);
+        ImGui::Text("Component Inspector: %.3f ms", panelCosts_.componentInspectorMs);
+        ImGui::Text("Performance Profiler: %.3f ms", panelCosts_.profilerMs);
+        ImGui::Text("Scene Operations: %.3f ms", panelCosts_.sceneOperationsMs);
+        ImGui::Unindent();
+
+        ImGui::Separator();
+
+        // GPU per-pass timings from renderer timestamp queries
+        ImGui::Text("GPU Timings:");
+        ImGui::Indent();
+        if (performanceData_.gpuTimingsValid) {
+            ImGui::Text("Main Pass: %.3f ms", performanceData_.gpuMainPassMs);
+            ImGui::Text("Instanced Pass: %.3f ms", performanceData_.gpuInstancedPassMs);
+            ImGui::Text("ImGui Pass: %.3f ms", performanceData_.gpuImGuiPassMs);
+            ImGui::Text("GPU Total: %.3f ms", performanceData_.gpuTotalMs);
+        } else {
+            ImGui::TextDisabled("Unavailable (no completed frame or timestamps unsupported)");
+        }
+        ImGui::Unindent();
+
+        ImGui::Separator();
+
+        // Presentation timing from the renderer's present stats
+        ImGui::Text("Presentation (%s):", performanceData_.presentModeName);
+        ImGui::Indent();
+        ImGui::Text("Present Wait: %.3f ms", performanceData_.presentWaitMs);
+        if (performanceData_.limiterWaitMs > 0.0f) {
+            ImGui::Text("Frame Limiter Wait: %.3f ms", performanceData_.limiterWaitMs);
+        } else {
+            ImGui::TextDisabled("Frame Limiter: off");
+        }
+        ImGui::Unindent();
+
+        ImGui::Separator();
+
+        // Draw submission counters from the renderer's frame stats
+        ImGui::Text("Draw Submission:");
+        ImGui::Indent();
+        ImGui::Text("Draw Calls: %u", performanceData_.drawCalls);
+        ImGui::Text("Instances: %u", performanceData_.instancesSubmitted);
+        ImGui::Text("Triangles: %llu", static_cast<unsigned long long>(performanceData_.trianglesSubmitted));
+        ImGui::Text("Buffer Uploads: %.1f KB", performanceData_.bufferUploadBytes / 1024.0f);
+        ImGui::Text("Descriptor Binds: %u", performanceData_.descriptorBinds);
+        ImGui::Text("Pipeline Binds: %u", performanceData_.pipelineBinds);
+        ImGui::Unindent();
+
+        ImGui::Separator();
+
+        // CPU frame zones from the scoped-zone profiler - flame-style
+        // breakdown of the last completed frame plus a history plot
+        if (ImGui::CollapsingHeader("CPU Frame Zones")) {
+            auto& profiler = FrameProfiler::getInstance();
+
+            bool profilerEnabled = profiler.isEnabled();
+            if (ImGui::Checkbox("Capture zones", &profilerEnabled)) {
+                profiler.setEnabled(profilerEnabled);
+            }
+
+            if (profiler.getCompletedFrameCount() > 0) {
+                // Frame-time history: newest sample last
+                size_t sampleCount = std::min(profiler.getCompletedFrameCount(),
+                                              FrameProfiler::HISTORY_FRAMES);
+                std::vector<float> frameTimes(sampleCount);
+                for (size_t i = 0; i < sampleCount; ++i) {
+                    frameTimes[i] = profiler.getHistoryFrame(sampleCount - 1 - i).totalMs;
+                }
+                ImGui::PlotLines("##FrameHistory", frameTimes.data(),
+                                 static_cast<int>(sampleCount), 0, "Frame time (ms)",
+                                 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+
+                const auto& frame = profiler.getHistoryFrame(0);
+                if (ImGui::BeginTable("FrameZones", 3,
+                                      ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                    ImGui::TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch);
+                    ImGui::TableSetupColumn("ms", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+                    ImGui::TableSetupColumn("% frame", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+                    ImGui::TableHeadersRow();
+
+                    // Zones are stored in begin order (pre-order), so
+                    // indenting by depth reads as a flame graph
+                    for (const auto& zone : frame.zones) {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::Indent(zone.depth * 14.0f + 0.001f);
+                        ImGui::TextUnformatted(zone.name);
+                        ImGui::Unindent(zone.depth * 14.0f + 0.001f);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.3f", zone.durationMs);
+                        ImGui::TableNextColumn();
+                        float fraction = frame.totalMs > 0.0f
+                            ? zone.durationMs / frame.totalMs * 100.0f : 0.0f;
+                        ImGui::Text("%.1f", fraction);
+                    }
+                    ImGui::EndTable();
+                }
+            } else {
+                ImGui::TextDisabled("No completed frames captured yet");
+            }
+        }
+
+        ImGui::Separator();
+
+        // Tagged memory totals with editable per-tag budgets; the tracker
+        // logs a warning when a subsystem crosses its budget
+        if (ImGui::CollapsingHeader("Memory")) {
+            auto& memTracker = MemoryTracker::getInstance();
+            constexpr float BYTES_PER_MB = 1024.0f * 1024.0f;
+
+            if (ImGui::BeginTable("MemoryTags", 3,
+                                  ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                ImGui::TableSetupColumn("Subsystem", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableSetupColumn("Resident (MB)", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+                ImGui::TableSetupColumn("Budget (MB)", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+                ImGui::TableHeadersRow();
+
+                for (uint8_t i = 0; i < static_cast<uint8_t>(MemoryTag::COUNT); ++i) {
+                    MemoryTag tag = static_cast<MemoryTag>(i);
+
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(MemoryTracker::tagName(tag));
+
+                    ImGui::TableNextColumn();
+                    float residentMb = memTracker.getUsage(tag) / BYTES_PER_MB;
+                    if (memTracker.isOverBudget(tag)) {
+                        ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%.2f", residentMb);
+                    } else {
+                        ImGui::Text("%.2f", residentMb);
+                    }
+
+                    ImGui::TableNextColumn();
+                    int budgetMb = static_cast<int>(memTracker.getBudget(tag) / (1024 * 1024));
+                    ImGui::SetNextItemWidth(-FLT_MIN);
+                    ImGui::PushID(i);
+                    if (ImGui::InputInt("##budget", &budgetMb, 0, 0,
+                                        ImGuiInputTextFlags_EnterReturnsTrue)) {
+                        budgetMb = std::max(budgetMb, 0);
+                        memTracker.setBudget(tag, static_cast<size_t>(budgetMb) * 1024 * 1024);
+                    }
+                    ImGui::PopID();
+                }
+                ImGui::EndTable();
+            }
+
+            ImGui::Text("Total Tracked: %.2f MB", memTracker.getTotalUsage() / BYTES_PER_MB);
+            ImGui::TextDisabled("Budget 0 disables the alarm for that tag");
+        }
+
         ImGui::Separator();
 
         // Entity statistics
@@ -974,7 +1186,7 @@ std::string ECSInspector::formatEntityLabel(EntityID entityId) const {
     // Add mesh name if available
     if (entityManager.hasComponent<Renderable>(entityId)) {
         auto& renderable = entityManager.getComponent<Renderable>(entityId);
-        std::string meshName = renderable.meshPath;
+        std::string meshName = renderable.meshPath();
         if (!meshName.empty()) {
             // Extract filename without extension
             size_t lastSlash = meshName.find_last_of("/\\");
@@ -7,6 +7,7 @@
 #include "../components/SpatialComponent.h"
 #include "../game/CreatureDetectionSystem.h"  // For CreatureComponent
 #include <imgui.h>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -48,6 +49,60 @@ public:
      */
     void render(float deltaTime = 0.0f);
 
+    /**
+     * Feed per-pass GPU timings into the performance profiler panel
+     * Called by Application each frame with the renderer's timestamp results
+     *
+     * @param mainPassMs Per-object ECS draw time in milliseconds
+     * @param instancedPassMs Instanced creature batch time in milliseconds
+     * @param imguiPassMs Debug interface draw time in milliseconds
+     * @param totalMs Whole GPU frame time in milliseconds
+     * @param valid false while no completed frame of results exists
+     */
+    void setGpuTimings(float mainPassMs, float instancedPassMs, float imguiPassMs,
+                       float totalMs, bool valid) {
+        performanceData_.gpuMainPassMs = mainPassMs;
+        performanceData_.gpuInstancedPassMs = instancedPassMs;
+        performanceData_.gpuImGuiPassMs = imguiPassMs;
+        performanceData_.gpuTotalMs = totalMs;
+        performanceData_.gpuTimingsValid = valid;
+    }
+
+    /**
+     * Feed presentation timing into the performance profiler panel
+     * Called by Application each frame with the renderer's present stats
+     *
+     * @param presentModeName Human-readable active present mode
+     * @param presentWaitMs CPU time blocked in vkQueuePresentKHR
+     * @param limiterWaitMs Time the frame limiter spent waiting, 0 when uncapped
+     */
+    void setPresentStats(const char* presentModeName, float presentWaitMs, float limiterWaitMs) {
+        performanceData_.presentModeName = presentModeName;
+        performanceData_.presentWaitMs = presentWaitMs;
+        performanceData_.limiterWaitMs = limiterWaitMs;
+    }
+
+    /**
+     * Feed draw submission counters into the performance profiler panel
+     * Called by Application each frame with the renderer's frame stats
+     *
+     * @param drawCalls Draw commands recorded in the shaded pass
+     * @param instances Total instances across those draws
+     * @param triangles Triangles submitted (indices / 3, scaled by instances)
+     * @param uploadBytes Bytes copied into mapped buffers this frame
+     * @param descriptorBinds Descriptor set bind commands recorded
+     * @param pipelineBinds Pipeline bind commands recorded
+     */
+    void setDrawStats(uint32_t drawCalls, uint32_t instances, uint64_t triangles,
+                      uint64_t uploadBytes, uint32_t descriptorBinds, uint32_t pipelineBinds) {
+        performanceData_.drawCalls = drawCalls;
+        performanceData_.instancesSubmitted = instances;
+        performanceData_.trianglesSubmitted = triangles;
+        performanceData_.bufferUploadBytes = uploadBytes;
+        performanceData_.descriptorBinds = descriptorBinds;
+        performanceData_.pipelineBinds = pipelineBinds;
+    }
+
     /**
      * Check if inspector is enabled
      * @return true if inspector should render
@@ -84,6 +139,27 @@ private:
     bool showPerformanceProfiler_ = true;
     bool showComponentHelp_ = false;
 
+    // Sampled entity list: walking every entity each frame makes the
+    // inspector itself the thing being profiled, so the list is rebuilt
+    // at ENTITY_LIST_REFRESH_HZ (or immediately when the filter or the
+    // entity population changes) and rows are virtualized via clipper
+    static constexpr float ENTITY_LIST_REFRESH_HZ = 4.0f;
+    std::vector<EntityID> entityListCache_;
+    float entityListRefreshTimerMs_ = 0.0f;
+    bool entityListDirty_ = true;
+
+    // Last frame's cost of each inspector panel, for the Inspector
+    // Overhead readout - tooling that costs milliseconds lies to you
+    struct PanelCosts {
+        float entityListMs = 0.0f;
+        float componentInspectorMs = 0.0f;
+        float profilerMs = 0.0f;
+        float sceneOperationsMs = 0.0f;
+        float totalMs() const {
+            return entityListMs + componentInspectorMs + profilerMs + sceneOperationsMs;
+        }
+    } panelCosts_;
+
     // Entity creation templates
     enum class EntityTemplate {
         CUBE,
@@ -110,6 +186,26 @@ private:
         size_t culledEntities = 0;
         float renderSystemTime = 0.0f;
         float cameraSystemTime = 0.0f;
+
+        // Per-pass GPU timings fed from the renderer's timestamp queries
+        float gpuMainPassMs = 0.0f;
+        float gpuInstancedPassMs = 0.0f;
+        float gpuImGuiPassMs = 0.0f;
+        float gpuTotalMs = 0.0f;
+        bool gpuTimingsValid = false;
+
+        // Presentation timing fed from the renderer's present stats
+        const char* presentModeName = "Unknown";
+        float presentWaitMs = 0.0f;
+        float limiterWaitMs = 0.0f;
+
+        // Draw submission counters fed from the renderer's frame stats
+        uint32_t drawCalls = 0;
+        uint32_t instancesSubmitted = 0;
+        uint64_t trianglesSubmitted = 0;
+        uint64_t bufferUploadBytes = 0;
+        uint32_t descriptorBinds = 0;
+        uint32_t pipelineBinds = 0;
     } performanceData_;
 
     // Material and mesh asset lists
@@ -132,6 +228,12 @@ private:
      */
     void renderEntityList();
 
+    /**
+     * Rebuild the cached, filtered entity list (throttled - see
+     * ENTITY_LIST_REFRESH_HZ)
+     */
+    void refreshEntityListCache();
+
     /**
      * Render component inspector panel for selected entity
      */
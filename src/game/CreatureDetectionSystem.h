@@ -6,9 +6,11 @@
 #include "../spatial/LayerMask.h"
 #include "../spatial/SpatialManager.h"
 #include "../systems/SpatialSystem.h"
+#include "../game/CrowdLODController.h"
 #include "../utils/Logger.h"
 #include <memory>
 #include <random>
+#include <unordered_map>
 #include <cassert>
 
 namespace VulkanMon {
@@ -62,16 +64,164 @@ private:
     // Performance tracking
     struct DetectionStats {
         size_t creaturesProcessed = 0;
+        size_t detectionQueriesIssued = 0;
+        size_t detectionChecksDeferred = 0;
         size_t detectionsTriggered = 0;
         size_t stateChanges = 0;
+        size_t visualUpdatesSkipped = 0;
         float updateTimeMs = 0.0f;
     } frameStats_;
 
+    // Screen-space update-rate scheduler shared with future per-creature
+    // systems (animation); owned here until more consumers exist
+    CrowdLODController crowdLOD_;
+
     // Modern C++11 random generation (thread-safe, high quality)
     mutable std::mt19937 randomGenerator_;
     mutable std::uniform_real_distribution<float> randomDistribution_;
 
+    // Detection staggering state
+    glm::vec3 detectionReference_{0.0f};           // Player position intervals scale against
+    bool detectionReferenceSet_ = false;           // Without it, every creature checks at base rate
+
+    // =============================================================================
+    // SOA AI STATE STORAGE
+    // =============================================================================
+
+    // AI hot data repacked as parallel arrays. CreatureComponent stays
+    // the authoring interface and the value other systems (and the
+    // Inspector) read, but the per-frame loops below never chase it
+    // through component lookups: each field lives in its own contiguous
+    // vector, indexed by a dense slot, so timer ticking and state
+    // transitions are linear sweeps the compiler can vectorize.
+    //
+    // Membership is reconciled once per update (swap-and-pop removal
+    // keeps slots dense), positions are refreshed from Transform in the
+    // same pass, and mutated state/timers are written back to the
+    // component at the end of the frame.
+    struct CreatureAIStore {
+        std::vector<EntityID> entities;
+        std::vector<glm::vec3> positions;       // Refreshed from Transform each update
+        std::vector<CreatureState> states;
+        std::vector<EntityID> targets;
+        std::vector<float> detectionTimers;     // CreatureComponent::lastDetectionCheck
+        std::vector<float> alertTimers;
+        std::vector<float> detectionRadii;
+        std::vector<float> alertRadii;
+        std::vector<float> fleeRadii;
+        std::vector<float> checkIntervals;
+        std::vector<float> alertDurations;
+        std::vector<float> boundingRadii;       // From SpatialComponent, for screen-size LOD
+        std::vector<float> visualAccumulators;  // Delta time banked while a slot's LOD tier skips frames
+        std::vector<CreatureComponent::CreatureType> types;
+        std::unordered_map<EntityID, size_t> slotOf;
+
+        size_t size() const { return entities.size(); }
+
+        size_t add(EntityID entity, const CreatureComponent& creature, const glm::vec3& position,
+                   float boundingRadius) {
+            size_t slot = entities.size();
+            entities.push_back(entity);
+            positions.push_back(position);
+            states.push_back(creature.state);
+            targets.push_back(creature.targetEntity);
+            detectionTimers.push_back(creature.lastDetectionCheck);
+            alertTimers.push_back(creature.alertTimer);
+            detectionRadii.push_back(creature.detectionRadius);
+            alertRadii.push_back(creature.alertRadius);
+            fleeRadii.push_back(creature.fleeRadius);
+            checkIntervals.push_back(creature.detectionCheckInterval);
+            alertDurations.push_back(creature.alertDuration);
+            boundingRadii.push_back(boundingRadius);
+            visualAccumulators.push_back(0.0f);
+            types.push_back(creature.type);
+            slotOf[entity] = slot;
+            return slot;
+        }
+
+        void remove(EntityID entity) {
+            auto it = slotOf.find(entity);
+            if (it == slotOf.end()) return;
+            size_t slot = it->second;
+            size_t last = entities.size() - 1;
+
+            if (slot != last) {
+                entities[slot] = entities[last];
+                positions[slot] = positions[last];
+                states[slot] = states[last];
+                targets[slot] = targets[last];
+                detectionTimers[slot] = detectionTimers[last];
+                alertTimers[slot] = alertTimers[last];
+                detectionRadii[slot] = detectionRadii[last];
+                alertRadii[slot] = alertRadii[last];
+                fleeRadii[slot] = fleeRadii[last];
+                checkIntervals[slot] = checkIntervals[last];
+                alertDurations[slot] = alertDurations[last];
+                boundingRadii[slot] = boundingRadii[last];
+                visualAccumulators[slot] = visualAccumulators[last];
+                types[slot] = types[last];
+                slotOf[entities[slot]] = slot;
+            }
+
+            entities.pop_back();
+            positions.pop_back();
+            states.pop_back();
+            targets.pop_back();
+            detectionTimers.pop_back();
+            alertTimers.pop_back();
+            detectionRadii.pop_back();
+            alertRadii.pop_back();
+            fleeRadii.pop_back();
+            checkIntervals.pop_back();
+            alertDurations.pop_back();
+            boundingRadii.pop_back();
+            visualAccumulators.pop_back();
+            types.pop_back();
+            slotOf.erase(it);
+        }
+    } store_;
+
 public:
+    // =============================================================================
+    // TIME-SLICED DETECTION STAGGERING
+    // =============================================================================
+
+    // Detection responsiveness only matters near the player: a creature
+    // 300m away noticing the player half a second late changes nothing.
+    // Each creature's check interval scales with distance to the
+    // detection reference, and first checks are phase-offset by entity ID
+    // so creatures spawned together don't all fire on the same frame.
+
+    static constexpr float DETECTION_NEAR_DISTANCE = 30.0f;      // Base rate inside this
+    static constexpr float DETECTION_FAR_DISTANCE = 150.0f;      // Slowest rate beyond this
+    static constexpr float DETECTION_FAR_INTERVAL_SCALE = 2.5f;  // 0.2s base becomes 0.5s (2Hz) far out
+
+    // Overflow guard: checks past the cap keep their elapsed timers and
+    // run next frame, round-robin style
+    static constexpr size_t MAX_DETECTION_QUERIES_PER_FRAME = 64;
+
+    // Interval multiplier for a creature at the given distance from the
+    // detection reference
+    static float intervalScaleForDistance(float distance) {
+        if (distance <= DETECTION_NEAR_DISTANCE) return 1.0f;
+        if (distance >= DETECTION_FAR_DISTANCE) return DETECTION_FAR_INTERVAL_SCALE;
+        float t = (distance - DETECTION_NEAR_DISTANCE) /
+                  (DETECTION_FAR_DISTANCE - DETECTION_NEAR_DISTANCE);
+        return 1.0f + t * (DETECTION_FAR_INTERVAL_SCALE - 1.0f);
+    }
+
+    // Position detection intervals scale against, typically the player;
+    // until set, every creature checks at its base interval
+    void setDetectionReference(const glm::vec3& position) {
+        detectionReference_ = position;
+        detectionReferenceSet_ = true;
+    }
+
+    // Crowd LOD scheduler - the application feeds it camera state each
+    // frame, and future per-creature systems (animation) consult the same
+    // instance so every tier decision agrees
+    CrowdLODController& getCrowdLOD() { return crowdLOD_; }
+
     CreatureDetectionSystem()
         : randomGenerator_(std::random_device{}()), randomDistribution_(0.0f, 1.0f) {
         VKMON_INFO("CreatureDetectionSystem initialized");
@@ -93,30 +243,35 @@ public:
 
         auto start = std::chrono::high_resolution_clock::now();
         frameStats_ = DetectionStats{};
+        crowdLOD_.beginFrame();
 
-        // PERFORMANCE OPTIMIZATION: Batch all spatial queries instead of per-creature queries
-        auto creatureEntities = collectCreatureEntities(entityManager);
-        frameStats_.creaturesProcessed = creatureEntities.size();
+        // Reconcile SoA membership and refresh positions - the only pass
+        // that touches components before writeback
+        syncStore(entityManager);
+        frameStats_.creaturesProcessed = store_.size();
 
-        if (creatureEntities.empty()) {
+        if (store_.size() == 0) {
             frameStats_.updateTimeMs = 0.0f;
             return;
         }
 
-        // Build batched spatial queries for all creatures that need detection checks
+        // Build batched spatial queries from the packed arrays
         std::vector<SpatialManager::BatchedRadiusQuery> batchedQueries;
-        std::vector<std::pair<EntityID, CreatureComponent*>> queriedCreatures;
-
-        prepareBatchedQueries(creatureEntities, entityManager, deltaTime, batchedQueries, queriedCreatures);
+        std::vector<size_t> queriedSlots;
+        prepareBatchedQueries(deltaTime, batchedQueries, queriedSlots);
 
         // Execute all spatial queries in a single batch operation (eliminates mutex overhead)
         auto spatialResults = spatialSystem_->getSpatialManager()->queryRadiusBatch(batchedQueries);
 
-        // Process detection results for each creature
-        processBatchedDetectionResults(spatialResults, queriedCreatures, entityManager);
+        // Process detection results for each queried slot
+        processBatchedDetectionResults(spatialResults, queriedSlots, entityManager);
+
+        // Update all creature states (non-spatial logic) - linear sweep
+        // over the packed arrays
+        updateAllCreatureStates(deltaTime);
 
-        // Update all creature states (non-spatial logic)
-        updateAllCreatureStates(creatureEntities, entityManager, deltaTime);
+        // Publish mutated hot state back to the components
+        writeBackToComponents(entityManager);
 
         auto end = std::chrono::high_resolution_clock::now();
         frameStats_.updateTimeMs = std::chrono::duration<float, std::milli>(end - start).count();
@@ -137,96 +292,127 @@ public:
     const DetectionStats& getFrameStats() const { return frameStats_; }
 
 private:
-    // PERFORMANCE OPTIMIZATION: Batched processing methods
-
-    std::vector<EntityID> collectCreatureEntities(EntityManager& entityManager) {
-        std::vector<EntityID> creatures;
-        auto& entityIds = entityManager.getEntitiesWithComponent<Transform>();
+    // Phase buckets for first-check staggering - enough to spread a
+    // whole herd across its interval
+    static constexpr size_t STAGGER_BUCKETS = 16;
+
+    void syncStore(EntityManager& entityManager) {
+        // Drop creatures whose components went away (swap-and-pop keeps
+        // the arrays dense, so iterate backwards)
+        for (size_t slot = store_.size(); slot-- > 0;) {
+            EntityID entity = store_.entities[slot];
+            if (!entityManager.hasComponent<CreatureComponent>(entity) ||
+                !entityManager.hasComponent<Transform>(entity) ||
+                !entityManager.hasComponent<SpatialComponent>(entity)) {
+                store_.remove(entity);
+            }
+        }
 
+        // Add newcomers and refresh positions
+        auto& entityIds = entityManager.getEntitiesWithComponent<CreatureComponent>();
         for (EntityID entity : entityIds) {
-            if (entityManager.hasComponent<SpatialComponent>(entity) &&
-                entityManager.hasComponent<CreatureComponent>(entity)) {
-                creatures.push_back(entity);
+            if (!entityManager.hasComponent<Transform>(entity) ||
+                !entityManager.hasComponent<SpatialComponent>(entity)) {
+                continue;
             }
-        }
 
-        return creatures;
+            const auto& transform = entityManager.getComponent<Transform>(entity);
+            auto it = store_.slotOf.find(entity);
+            if (it != store_.slotOf.end()) {
+                size_t slot = it->second;
+                store_.positions[slot] = transform.position;
+
+                // Detection tuning stays live-editable (Inspector sliders)
+                const auto& creature = entityManager.getComponent<CreatureComponent>(entity);
+                store_.detectionRadii[slot] = creature.detectionRadius;
+                store_.alertRadii[slot] = creature.alertRadius;
+                store_.fleeRadii[slot] = creature.fleeRadius;
+                store_.checkIntervals[slot] = creature.detectionCheckInterval;
+                store_.alertDurations[slot] = creature.alertDuration;
+                store_.boundingRadii[slot] =
+                    entityManager.getComponent<SpatialComponent>(entity).boundingRadius;
+                store_.types[slot] = creature.type;
+            } else {
+                const auto& creature = entityManager.getComponent<CreatureComponent>(entity);
+                const auto& spatial = entityManager.getComponent<SpatialComponent>(entity);
+                size_t slot = store_.add(entity, creature, transform.position, spatial.boundingRadius);
+
+                // First sight: give the creature a head start derived from
+                // its ID so a batch spawned together doesn't check in lockstep
+                float phase = static_cast<float>(entity % STAGGER_BUCKETS) /
+                              static_cast<float>(STAGGER_BUCKETS);
+                store_.detectionTimers[slot] = phase * store_.checkIntervals[slot];
+            }
+        }
     }
 
-    void prepareBatchedQueries(const std::vector<EntityID>& creatures, EntityManager& entityManager,
-                              float deltaTime, std::vector<SpatialManager::BatchedRadiusQuery>& batchedQueries,
-                              std::vector<std::pair<EntityID, CreatureComponent*>>& queriedCreatures) {
+    void prepareBatchedQueries(float deltaTime,
+                               std::vector<SpatialManager::BatchedRadiusQuery>& batchedQueries,
+                               std::vector<size_t>& queriedSlots) {
+        size_t count = store_.size();
 
-        // Safety check: prevent division by zero in temporal spreading
-        if (creatures.empty()) {
-            return;
+        // Timer ticking first, as plain array sweeps
+        for (size_t slot = 0; slot < count; ++slot) {
+            store_.detectionTimers[slot] += deltaTime;
+        }
+        for (size_t slot = 0; slot < count; ++slot) {
+            store_.alertTimers[slot] += deltaTime;
         }
 
-        // TEMPORAL SPREADING OPTIMIZATION: Limit creatures processed per frame to eliminate frame time spikes
-        static size_t frameOffset = 0;
-        const size_t MAX_CREATURES_PER_FRAME = 64;  // Process max 64 creatures per frame (1024/16 = 64 per frame cycle)
-
-        frameOffset = (frameOffset + MAX_CREATURES_PER_FRAME) % creatures.size();
-        size_t endOffset = std::min(frameOffset + MAX_CREATURES_PER_FRAME, creatures.size());
+        for (size_t slot = 0; slot < count; ++slot) {
+            // Distance-scaled interval: near creatures check at base rate,
+            // far ones stretch toward DETECTION_FAR_INTERVAL_SCALE
+            float interval = store_.checkIntervals[slot];
+            if (detectionReferenceSet_) {
+                float distance = glm::distance(store_.positions[slot], detectionReference_);
+                interval *= intervalScaleForDistance(distance);
+            }
 
-        for (size_t i = frameOffset; i < endOffset; ++i) {
-            EntityID entity = creatures[i];
-            auto& transform = entityManager.getComponent<Transform>(entity);
-            auto& creature = entityManager.getComponent<CreatureComponent>(entity);
+            if (store_.detectionTimers[slot] < interval) {
+                continue;
+            }
 
-            // Update timing first
-            creature.lastDetectionCheck += deltaTime;
-            creature.alertTimer += deltaTime;
+            // Past the per-frame cap the timer keeps its elapsed time, so
+            // the check runs next frame instead of being dropped
+            if (batchedQueries.size() >= MAX_DETECTION_QUERIES_PER_FRAME) {
+                frameStats_.detectionChecksDeferred++;
+                continue;
+            }
 
-            // Only add to batch if creature needs detection check
-            if (creature.lastDetectionCheck >= creature.detectionCheckInterval) {
-                creature.lastDetectionCheck = 0.0f;
+            store_.detectionTimers[slot] = 0.0f;
 
-                SpatialManager::BatchedRadiusQuery query;
-                query.sourceEntity = entity;
-                query.center = transform.position;
-                query.radius = creature.detectionRadius;
-                query.layerMask = LayerMask::Player | LayerMask::Creatures;
+            SpatialManager::BatchedRadiusQuery query;
+            query.sourceEntity = store_.entities[slot];
+            query.center = store_.positions[slot];
+            query.radius = store_.detectionRadii[slot];
+            query.layerMask = LayerMask::Player | LayerMask::Creatures;
 
-                batchedQueries.push_back(query);
-                queriedCreatures.push_back({entity, &creature});
-            }
+            batchedQueries.push_back(query);
+            queriedSlots.push_back(slot);
         }
+
+        frameStats_.detectionQueriesIssued = batchedQueries.size();
     }
 
     void processBatchedDetectionResults(const std::vector<SpatialManager::BatchedQueryResult>& spatialResults,
-                                       const std::vector<std::pair<EntityID, CreatureComponent*>>& queriedCreatures,
-                                       EntityManager& entityManager) {
-
+                                        const std::vector<size_t>& queriedSlots,
+                                        EntityManager& entityManager) {
         for (size_t i = 0; i < spatialResults.size(); ++i) {
-            const auto& result = spatialResults[i];
-            EntityID entity = queriedCreatures[i].first;
-            CreatureComponent* creature = queriedCreatures[i].second;
-
-            auto& transform = entityManager.getComponent<Transform>(entity);
-            processDetectedEntities(entity, transform, *creature, result.nearbyEntities, entityManager);
+            processDetectedEntities(queriedSlots[i], spatialResults[i].nearbyEntities, entityManager);
         }
     }
 
-    void updateAllCreatureStates(const std::vector<EntityID>& creatures, EntityManager& entityManager, float deltaTime) {
-        for (EntityID entity : creatures) {
-            auto& transform = entityManager.getComponent<Transform>(entity);
-            auto& creature = entityManager.getComponent<CreatureComponent>(entity);
-            updateCreatureState(entity, transform, creature, deltaTime);
-        }
-    }
-
-    void processDetectedEntities(EntityID entity, const Transform& transform,
-                                CreatureComponent& creature, const std::vector<EntityID>& nearbyEntities, EntityManager& entityManager) {
-
+    void processDetectedEntities(size_t slot, const SmallVector<EntityID, 16>& nearbyEntities,
+                                 EntityManager& entityManager) {
+        EntityID selfEntity = store_.entities[slot];
         EntityID closestPlayer = INVALID_ENTITY;
-        float closestPlayerDistance = creature.detectionRadius;
+        float closestPlayerDistance = store_.detectionRadii[slot];
 
         // PERFORMANCE OPTIMIZATION: Spatial query already filtered by layer mask!
         // Since we queried with LayerMask::Player | LayerMask::Creatures,
         // we only need to check which ones are players (much faster!)
         for (EntityID nearbyEntity : nearbyEntities) {
-            if (nearbyEntity == entity) continue; // Skip self
+            if (nearbyEntity == selfEntity) continue; // Skip self
 
             // FAST PATH: Use spatial layer cache (already loaded by spatial query)
             // Only check entities that are in Player layer - spatial query pre-filtered these!
@@ -249,7 +435,7 @@ private:
                     }
                 }
 
-                float distance = glm::distance(transform.position, cachedPlayerPos);
+                float distance = glm::distance(store_.positions[slot], cachedPlayerPos);
                 if (distance < closestPlayerDistance) {
                     closestPlayer = cachedPlayerEntity;
                     closestPlayerDistance = distance;
@@ -260,113 +446,138 @@ private:
         // React to closest player if found
         if (closestPlayer != INVALID_ENTITY) {
             frameStats_.detectionsTriggered++;
-            handlePlayerDetection(entity, creature, closestPlayer, closestPlayerDistance);
+            handlePlayerDetection(slot, closestPlayer, closestPlayerDistance);
         }
     }
 
-    void handlePlayerDetection(EntityID entity, CreatureComponent& creature,
-                              EntityID player, float distance) {
+    void handlePlayerDetection(size_t slot, EntityID player, float distance) {
+        CreatureState oldState = store_.states[slot];
 
-        CreatureState oldState = creature.state;
-
-        switch (creature.type) {
+        switch (store_.types[slot]) {
             case CreatureComponent::CreatureType::PEACEFUL:
-                if (distance <= creature.fleeRadius) {
-                    creature.state = CreatureState::FLEEING;
-                    creature.targetEntity = player;
-                } else if (distance <= creature.alertRadius) {
-                    creature.state = CreatureState::ALERT;
-                    creature.targetEntity = player;
-                    creature.alertTimer = 0.0f;
+                if (distance <= store_.fleeRadii[slot]) {
+                    store_.states[slot] = CreatureState::FLEEING;
+                    store_.targets[slot] = player;
+                } else if (distance <= store_.alertRadii[slot]) {
+                    store_.states[slot] = CreatureState::ALERT;
+                    store_.targets[slot] = player;
+                    store_.alertTimers[slot] = 0.0f;
                 }
                 break;
 
             case CreatureComponent::CreatureType::NEUTRAL:
-                if (distance <= creature.alertRadius) {
-                    creature.state = CreatureState::ALERT;
-                    creature.targetEntity = player;
-                    creature.alertTimer = 0.0f;
+                if (distance <= store_.alertRadii[slot]) {
+                    store_.states[slot] = CreatureState::ALERT;
+                    store_.targets[slot] = player;
+                    store_.alertTimers[slot] = 0.0f;
                 }
                 break;
 
             case CreatureComponent::CreatureType::AGGRESSIVE:
-                if (distance <= creature.detectionRadius) {
-                    creature.state = CreatureState::AGGRESSIVE;
-                    creature.targetEntity = player;
+                if (distance <= store_.detectionRadii[slot]) {
+                    store_.states[slot] = CreatureState::AGGRESSIVE;
+                    store_.targets[slot] = player;
                 }
                 break;
         }
 
-        if (oldState != creature.state) {
+        if (oldState != store_.states[slot]) {
             frameStats_.stateChanges++;
 
             #ifdef DEBUG_VERBOSE
-            VKMON_DEBUG("Creature " + std::to_string(static_cast<uint32_t>(entity)) +
+            VKMON_DEBUG("Creature " + std::to_string(static_cast<uint32_t>(store_.entities[slot])) +
                        " state changed from " + std::to_string(static_cast<int>(oldState)) +
-                       " to " + std::to_string(static_cast<int>(creature.state)));
+                       " to " + std::to_string(static_cast<int>(store_.states[slot])));
             #endif
         }
     }
 
-    void updateCreatureState(EntityID entity, const Transform& transform,
-                            CreatureComponent& creature, float deltaTime) {
+    void updateAllCreatureStates(float deltaTime) {
+        // State machine over the packed arrays - no component lookups.
+        // Per-second chances are frame-rate corrected per slot from the
+        // LOD-accumulated delta, so every tier sees the same rates.
+        size_t count = store_.size();
+        for (size_t slot = 0; slot < count; ++slot) {
+            // Screen-size LOD: distant creatures run their visual state
+            // machine every 4th or 16th frame. Skipped delta time banks in
+            // the accumulator and is applied when the tier fires, so the
+            // frame-rate-corrected chances stay unbiased.
+            store_.visualAccumulators[slot] += deltaTime;
+            CreatureUpdateRate rate = crowdLOD_.rateFor(store_.positions[slot],
+                                                        store_.boundingRadii[slot]);
+            if (!crowdLOD_.shouldUpdate(store_.entities[slot], rate)) {
+                frameStats_.visualUpdatesSkipped++;
+                continue;
+            }
+            float slotDelta = store_.visualAccumulators[slot];
+            store_.visualAccumulators[slot] = 0.0f;
+
+            float wanderChanceThisFrame = 1.0f - std::pow(1.0f - 0.1f, slotDelta);  // ~10%/s
+            float idleChanceThisFrame = 1.0f - std::pow(1.0f - 0.05f, slotDelta);   // ~5%/s
 
-        switch (creature.state) {
-            case CreatureState::IDLE:
-                // Target: ~10% chance per second to start wandering
-                {
-                    float wanderChancePerSecond = 0.1f;
-                    float wanderChanceThisFrame = 1.0f - std::pow(1.0f - wanderChancePerSecond, deltaTime);
+            switch (store_.states[slot]) {
+                case CreatureState::IDLE:
                     if (randomDistribution_(randomGenerator_) < wanderChanceThisFrame) {
-                        creature.state = CreatureState::WANDERING;
+                        store_.states[slot] = CreatureState::WANDERING;
                         frameStats_.stateChanges++;
                     }
-                }
-                break;
+                    break;
 
-            case CreatureState::WANDERING:
-                // Target: ~5% chance per second to return to idle
-                {
-                    float idleChancePerSecond = 0.05f;
-                    float idleChanceThisFrame = 1.0f - std::pow(1.0f - idleChancePerSecond, deltaTime);
+                case CreatureState::WANDERING:
                     if (randomDistribution_(randomGenerator_) < idleChanceThisFrame) {
-                        creature.state = CreatureState::IDLE;
+                        store_.states[slot] = CreatureState::IDLE;
                         frameStats_.stateChanges++;
                     }
-                }
-                break;
+                    break;
 
-            case CreatureState::ALERT:
-                // Return to normal behavior after alert duration
-                if (creature.alertTimer >= creature.alertDuration) {
-                    creature.state = CreatureState::WANDERING;
-                    creature.targetEntity = INVALID_ENTITY;
-                    frameStats_.stateChanges++;
-                }
-                break;
+                case CreatureState::ALERT:
+                    // Return to normal behavior after alert duration
+                    if (store_.alertTimers[slot] >= store_.alertDurations[slot]) {
+                        store_.states[slot] = CreatureState::WANDERING;
+                        store_.targets[slot] = INVALID_ENTITY;
+                        frameStats_.stateChanges++;
+                    }
+                    break;
 
-            case CreatureState::FLEEING:
-                // Stop fleeing after some time or distance
-                if (creature.alertTimer >= creature.alertDuration * 0.5f) {
-                    creature.state = CreatureState::ALERT;
-                    frameStats_.stateChanges++;
-                }
-                break;
+                case CreatureState::FLEEING:
+                    // Stop fleeing after some time or distance
+                    if (store_.alertTimers[slot] >= store_.alertDurations[slot] * 0.5f) {
+                        store_.states[slot] = CreatureState::ALERT;
+                        frameStats_.stateChanges++;
+                    }
+                    break;
 
-            case CreatureState::AGGRESSIVE:
-                // Stay aggressive until target is out of range
-                // This would be handled by the detection check above
-                break;
+                case CreatureState::AGGRESSIVE:
+                    // Stay aggressive until target is out of range
+                    // This would be handled by the detection check above
+                    break;
+            }
+        }
+    }
+
+    void writeBackToComponents(EntityManager& entityManager) {
+        // One linear pass publishing hot state so other systems and the
+        // Inspector read current values between updates
+        size_t count = store_.size();
+        for (size_t slot = 0; slot < count; ++slot) {
+            auto& creature = entityManager.getComponent<CreatureComponent>(store_.entities[slot]);
+            creature.state = store_.states[slot];
+            creature.targetEntity = store_.targets[slot];
+            creature.lastDetectionCheck = store_.detectionTimers[slot];
+            creature.alertTimer = store_.alertTimers[slot];
         }
     }
 
     void logPerformanceStats() {
         VKMON_INFO("CreatureDetectionSystem Performance:");
         VKMON_INFO("  Creatures processed: " + std::to_string(frameStats_.creaturesProcessed));
+        VKMON_INFO("  Detection queries issued: " + std::to_string(frameStats_.detectionQueriesIssued));
+        VKMON_INFO("  Detection checks deferred: " + std::to_string(frameStats_.detectionChecksDeferred));
         VKMON_INFO("  Detections triggered: " + std::to_string(frameStats_.detectionsTriggered));
         VKMON_INFO("  State changes: " + std::to_string(frameStats_.stateChanges));
+        VKMON_INFO("  Visual updates skipped (crowd LOD): " + std::to_string(frameStats_.visualUpdatesSkipped));
         VKMON_INFO("  Update time: " + std::to_string(frameStats_.updateTimeMs) + "ms");
     }
 };
 
-} // namespace VulkanMon
\ No newline at end of file
+} // namespace VulkanMon
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "../core/Entity.h"
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstdint>
+
+namespace VulkanMon {
+
+// Update cadence tiers for per-creature work. The numeric value is the
+// frame period, so schedulers can use it directly as a modulus.
+enum class CreatureUpdateRate : uint8_t {
+    EveryFrame = 1,
+    EveryFourthFrame = 4,
+    EverySixteenthFrame = 16
+};
+
+// =============================================================================
+// CROWD LOD CONTROLLER - Screen-space update-rate scheduler for creatures
+// =============================================================================
+//
+// Per-creature visual work (AI state pulses, detection indicators, and
+// eventually skeletal animation) does not need to run at frame rate for a
+// creature a few pixels tall. This controller assigns each creature an
+// update rate tier from its projected screen-space size and answers "does
+// this creature's tier fire on the current frame", with phases derived
+// from the entity ID so a tier's members spread across the period instead
+// of bunching on one frame.
+//
+// The controller is deliberately not an ECS system: it is a shared
+// scheduling service that any per-creature system consults inside its own
+// update loop. Consumers accumulate skipped delta time and apply it on the
+// frame the tier fires, so tiered logic stays frame-rate independent.
+class CrowdLODController {
+public:
+    // Screen-height fraction tier boundaries: a creature taller than ~5%
+    // of the viewport updates every frame, down to every 16th frame for
+    // the distant specks
+    static constexpr float FULL_RATE_SCREEN_FRACTION = 0.05f;
+    static constexpr float QUARTER_RATE_SCREEN_FRACTION = 0.012f;
+
+    // Camera state the projection estimate needs; refreshed once per frame
+    // by the application, not per query
+    void setCameraState(const glm::vec3& position, float verticalFovDegrees) {
+        cameraPosition_ = position;
+        tanHalfFov_ = std::tan(glm::radians(verticalFovDegrees * 0.5f));
+        cameraStateSet_ = true;
+    }
+
+    void beginFrame() { ++frameIndex_; }
+    uint64_t frameIndex() const { return frameIndex_; }
+
+    // Approximate fraction of the viewport height a sphere of the given
+    // radius covers at the given distance. Cheap perspective estimate -
+    // tier boundaries are coarse enough that exact projection buys nothing.
+    static float screenHeightFraction(float distance, float boundingRadius, float tanHalfFov) {
+        if (distance < 0.001f) {
+            return 1.0f; // At or inside the camera - always full rate
+        }
+        return boundingRadius / (distance * tanHalfFov);
+    }
+
+    static CreatureUpdateRate rateForScreenFraction(float fraction) {
+        if (fraction >= FULL_RATE_SCREEN_FRACTION) return CreatureUpdateRate::EveryFrame;
+        if (fraction >= QUARTER_RATE_SCREEN_FRACTION) return CreatureUpdateRate::EveryFourthFrame;
+        return CreatureUpdateRate::EverySixteenthFrame;
+    }
+
+    // Tier for a creature at this position; falls back to full rate until
+    // camera state has been provided
+    CreatureUpdateRate rateFor(const glm::vec3& position, float boundingRadius) const {
+        if (!cameraStateSet_) {
+            return CreatureUpdateRate::EveryFrame;
+        }
+        float distance = glm::distance(position, cameraPosition_);
+        return rateForScreenFraction(screenHeightFraction(distance, boundingRadius, tanHalfFov_));
+    }
+
+    // Does this entity's tier fire on the current frame? The entity ID
+    // offsets the phase so same-tier creatures stagger across the period.
+    bool shouldUpdate(EntityID entity, CreatureUpdateRate rate) const {
+        uint64_t period = static_cast<uint64_t>(rate);
+        return (frameIndex_ + static_cast<uint64_t>(entity)) % period == 0;
+    }
+
+private:
+    glm::vec3 cameraPosition_{0.0f};
+    float tanHalfFov_ = 1.0f;
+    bool cameraStateSet_ = false;
+    uint64_t frameIndex_ = 0;
+};
+
+} // namespace VulkanMon
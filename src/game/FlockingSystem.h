@@ -0,0 +1,253 @@
+#pragma once
+
+#include "../core/SystemImpl.h"
+#include "../components/Transform.h"
+#include "../components/SpatialComponent.h"
+#include "../components/CreaturePhysicsComponent.h"
+#include "../game/CreatureDetectionSystem.h" // For CreatureComponent state checks
+#include "../spatial/LayerMask.h"
+#include "../spatial/SpatialManager.h"
+#include "../systems/SpatialSystem.h"
+#include "../utils/Logger.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+namespace VulkanMon {
+
+// Membership in a herd. Creatures sharing a flockId steer together;
+// the ID is assigned at spawn (per species group or territory).
+struct FlockComponent {
+    VKMON_COMPONENT(FlockComponent)
+
+    uint32_t flockId = 0;
+
+    // Boids weights - tuned for loose Pokemon herds, not tight bird flocks
+    float separationRadius = 2.5f;   // Personal space - push apart inside this
+    float separationWeight = 1.5f;
+    float alignmentWeight = 1.0f;    // Match the herd's heading
+    float cohesionWeight = 0.8f;     // Drift toward the herd's center
+    float steerBlend = 0.25f;        // How strongly flocking overrides current heading per solve
+
+    FlockComponent() = default;
+    explicit FlockComponent(uint32_t id) : flockId(id) {}
+};
+
+// =============================================================================
+// FLOCKING SYSTEM - Shared-neighborhood herd movement solver
+// =============================================================================
+//
+// The naive boids formulation costs one spatial query per creature per
+// frame - N herd members issue N radius queries that all return roughly
+// the same neighbors. This solver inverts that: members are grouped by
+// flockId, ONE queryRegion gather runs per cluster over the cluster's
+// combined bounds, and separation/alignment/cohesion for every member are
+// solved from that single shared result.
+//
+// Output is written into CreaturePhysicsComponent::inputDirection (blended
+// with the current heading), so PhysicsSystem keeps sole ownership of
+// actual movement. Creatures whose detection AI has taken over (fleeing or
+// aggressive) are left alone - survival beats formation.
+class FlockingSystem : public System<Transform, SpatialComponent, FlockComponent> {
+public:
+    // Herds drift; they do not need per-frame re-steering
+    static constexpr float FLOCK_SOLVE_INTERVAL = 0.1f; // seconds
+
+    void setSpatialSystem(SpatialSystem* spatialSystem) {
+        spatialSystem_ = spatialSystem;
+    }
+
+    void update(float deltaTime, EntityManager& entityManager) override {
+        if (!spatialSystem_) {
+            return;
+        }
+
+        solveTimer_ += deltaTime;
+        if (solveTimer_ < FLOCK_SOLVE_INTERVAL) {
+            return;
+        }
+        solveTimer_ = 0.0f;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        frameStats_ = FlockStats{};
+
+        auto& flockComponents = entityManager.getAllComponents<FlockComponent>();
+        auto& flockEntities = entityManager.getEntitiesWithComponent<FlockComponent>();
+
+        // Group members by flockId and accumulate each cluster's bounds
+        clusters_.clear();
+        for (size_t i = 0; i < flockEntities.size(); ++i) {
+            EntityID entity = flockEntities[i];
+            if (!entityManager.hasComponent<Transform>(entity) ||
+                !entityManager.hasComponent<CreaturePhysicsComponent>(entity)) {
+                continue;
+            }
+
+            auto& cluster = clusters_[flockComponents[i].flockId];
+            glm::vec3 position = entityManager.getComponent<Transform>(entity).position;
+            cluster.members.push_back(Member{entity, position, i});
+            cluster.bounds.min = glm::min(cluster.bounds.min, position);
+            cluster.bounds.max = glm::max(cluster.bounds.max, position);
+        }
+
+        for (auto& [flockId, cluster] : clusters_) {
+            if (cluster.members.size() < 2) {
+                continue; // a herd of one has nothing to flock with
+            }
+            solveCluster(cluster, flockComponents, entityManager);
+            frameStats_.clustersSolved++;
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        frameStats_.updateTimeMs = std::chrono::duration<float, std::milli>(end - start).count();
+
+        static int solveCount = 0;
+        if (++solveCount >= 300) { // Every ~30 seconds at the solve interval
+            logPerformanceStats();
+            solveCount = 0;
+        }
+    }
+
+    void render(VulkanRenderer& renderer, EntityManager& entityManager) override {
+        // FlockingSystem doesn't render anything
+    }
+
+    struct FlockStats {
+        size_t clustersSolved = 0;
+        size_t membersSteered = 0;
+        size_t spatialQueriesIssued = 0;
+        float updateTimeMs = 0.0f;
+    };
+    const FlockStats& getFrameStats() const { return frameStats_; }
+
+private:
+    struct Member {
+        EntityID entity = INVALID_ENTITY;
+        glm::vec3 position = glm::vec3(0.0f);
+        size_t componentIndex = 0; // into the packed FlockComponent array
+    };
+
+    struct Cluster {
+        std::vector<Member> members;
+        BoundingBox bounds;
+    };
+
+    void solveCluster(Cluster& cluster, ComponentVector<FlockComponent>& flockComponents,
+                     EntityManager& entityManager) {
+        // ONE neighborhood gather for the whole cluster - the region is the
+        // members' combined bounds padded by the widest separation radius
+        float padding = 0.0f;
+        for (const auto& member : cluster.members) {
+            padding = std::max(padding, flockComponents[member.componentIndex].separationRadius);
+        }
+        BoundingBox region(cluster.bounds.min - glm::vec3(padding),
+                          cluster.bounds.max + glm::vec3(padding));
+
+        queryScratch_.clear();
+        spatialSystem_->queryRegion(region, LayerMask::Creatures, queryScratch_);
+        frameStats_.spatialQueriesIssued++;
+
+        // Resolve the shared neighborhood once - every creature the gather
+        // found, member or not, acts as a separation obstacle for all
+        // members, so herds also avoid crowding other species
+        neighborCache_.clear();
+        for (EntityID neighbor : queryScratch_) {
+            if (entityManager.hasComponent<Transform>(neighbor)) {
+                neighborCache_.push_back(Neighbor{neighbor,
+                    entityManager.getComponent<Transform>(neighbor).position});
+            }
+        }
+
+        // Cluster-wide aggregates computed once: centroid for cohesion and
+        // average heading for alignment
+        glm::vec3 centroid(0.0f);
+        glm::vec3 averageHeading(0.0f);
+        for (const auto& member : cluster.members) {
+            centroid += member.position;
+            averageHeading += entityManager.getComponent<CreaturePhysicsComponent>(member.entity).inputDirection;
+        }
+        centroid /= static_cast<float>(cluster.members.size());
+
+        float headingLength = glm::length(averageHeading);
+        if (headingLength > 0.001f) {
+            averageHeading /= headingLength;
+        }
+
+        for (const auto& member : cluster.members) {
+            // Detection AI owns creatures in survival states
+            if (entityManager.hasComponent<CreatureComponent>(member.entity)) {
+                auto state = entityManager.getComponent<CreatureComponent>(member.entity).state;
+                if (state == CreatureState::FLEEING || state == CreatureState::AGGRESSIVE) {
+                    continue;
+                }
+            }
+
+            const auto& flock = flockComponents[member.componentIndex];
+
+            // Separation: push away from anything inside personal space,
+            // weighted by proximity. Scans the shared gather result, not a
+            // fresh per-member spatial query.
+            glm::vec3 separation(0.0f);
+            float separationSq = flock.separationRadius * flock.separationRadius;
+            for (const auto& other : neighborCache_) {
+                if (other.entity == member.entity) continue;
+                glm::vec3 away = member.position - other.position;
+                float distSq = glm::dot(away, away);
+                if (distSq < separationSq && distSq > 0.0001f) {
+                    separation += away / distSq; // closer neighbors push harder
+                }
+            }
+
+            glm::vec3 cohesion = centroid - member.position;
+            float cohesionLength = glm::length(cohesion);
+            if (cohesionLength > 0.001f) {
+                cohesion /= cohesionLength;
+            }
+
+            glm::vec3 steer = separation * flock.separationWeight
+                            + averageHeading * flock.alignmentWeight
+                            + cohesion * flock.cohesionWeight;
+            steer.y = 0.0f; // herds steer on the ground plane
+            float steerLength = glm::length(steer);
+            if (steerLength < 0.001f) {
+                continue;
+            }
+            steer /= steerLength;
+
+            // Blend into the current heading rather than replacing it, so
+            // wander behavior still shows through the herd motion
+            auto& physics = entityManager.getComponent<CreaturePhysicsComponent>(member.entity);
+            glm::vec3 blended = physics.inputDirection * (1.0f - flock.steerBlend)
+                              + steer * flock.steerBlend;
+            float blendedLength = glm::length(blended);
+            physics.inputDirection = blendedLength > 0.001f ? blended / blendedLength : steer;
+            frameStats_.membersSteered++;
+        }
+    }
+
+    void logPerformanceStats() {
+        VKMON_INFO("FlockingSystem Performance:");
+        VKMON_INFO("  Clusters solved: " + std::to_string(frameStats_.clustersSolved));
+        VKMON_INFO("  Members steered: " + std::to_string(frameStats_.membersSteered));
+        VKMON_INFO("  Spatial queries issued: " + std::to_string(frameStats_.spatialQueriesIssued));
+        VKMON_INFO("  Update time: " + std::to_string(frameStats_.updateTimeMs) + "ms");
+    }
+
+    SpatialSystem* spatialSystem_ = nullptr;  // Non-owning, lifetime managed by World
+    float solveTimer_ = 0.0f;
+    FlockStats frameStats_;
+
+    struct Neighbor {
+        EntityID entity = INVALID_ENTITY;
+        glm::vec3 position = glm::vec3(0.0f);
+    };
+
+    // Reused scratch - clusters are rebuilt each solve without reallocating
+    std::unordered_map<uint32_t, Cluster> clusters_;
+    std::vector<EntityID> queryScratch_;
+    std::vector<Neighbor> neighborCache_;
+};
+
+} // namespace VulkanMon
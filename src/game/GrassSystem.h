@@ -5,9 +5,16 @@
 #include "../components/SpatialComponent.h"
 #include "../spatial/LayerMask.h"
 #include "../spatial/SpatialManager.h"
+#include "../rendering/VulkanRenderer.h"
+#include "../systems/CameraSystem.h"
 #include "../utils/Logger.h"
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cmath>
 #include <memory>
 #include <random>
+#include <unordered_map>
+#include <vector>
 
 namespace VulkanMon {
 
@@ -33,6 +40,12 @@ struct GrassComponent {
     glm::vec3 rustleDirection = glm::vec3(0.0f); // Direction of movement causing rustle
     float rustleDecayRate = 2.0f;       // How fast rustle fades (per second)
 
+    // Rendering properties - each patch is drawn as GPU-instanced blades
+    // generated once from these parameters, never as per-blade entities
+    float patchRadius = 3.0f;           // Blades scatter within this disc around the patch
+    uint32_t bladeCount = 160;          // Blades generated for this patch
+    float bladeScale = 0.5f;            // Base uniform scale per blade (jittered +/- 30%)
+
     // Grass type affects spawn rates and creature types
     enum class GrassType : uint8_t {
         SHORT_GRASS,    // Common creatures, low spawn rate
@@ -43,21 +56,29 @@ struct GrassComponent {
 
     GrassComponent() = default;
     GrassComponent(GrassType t, float radius = 3.0f)
-        : type(t), rustleRadius(radius) {
+        : type(t), rustleRadius(radius), patchRadius(radius) {
 
-        // Set spawn rates based on grass type
+        // Set spawn rates and blade appearance based on grass type
         switch (type) {
             case GrassType::SHORT_GRASS:
                 spawnChance = 0.0005f;
+                bladeCount = 160;
+                bladeScale = 0.5f;
                 break;
             case GrassType::TALL_GRASS:
                 spawnChance = 0.002f;
+                bladeCount = 220;
+                bladeScale = 1.0f;
                 break;
             case GrassType::FLOWER_PATCH:
                 spawnChance = 0.0001f;
+                bladeCount = 90;
+                bladeScale = 0.6f;
                 break;
             case GrassType::DENSE_BRUSH:
                 spawnChance = 0.001f;
+                bladeCount = 140;
+                bladeScale = 0.8f;
                 break;
         }
     }
@@ -68,12 +89,63 @@ private:
     std::shared_ptr<SpatialSystem> spatialSystem_;
     std::mt19937 rng_;
 
+    std::shared_ptr<CameraSystem> cameraSystem_;  // optional - enables per-patch frustum culling
+
+    static constexpr size_t GRASS_TYPE_COUNT = 4;
+
+    // Baked placement: all blade instances for a type live in one
+    // device-local buffer, generated once (seeded by patch entity ID for
+    // determinism) and uploaded at first render. Per frame the CPU only
+    // refreshes the per-patch visibility bitset and issues range draws -
+    // blade data is never regenerated or re-uploaded.
+    struct BakedPatch {
+        EntityID entity = INVALID_ENTITY;
+        glm::vec3 position = glm::vec3(0.0f);
+        float patchRadius = 0.0f;
+        uint32_t firstInstance = 0;
+        uint32_t instanceCount = 0;
+    };
+    struct BakedTypeBatch {
+        uint32_t bufferHandle = VulkanRenderer::INVALID_BAKED_BUFFER;
+        std::vector<BakedPatch> patches;  // baked order - ranges are contiguous
+        std::vector<bool> visibility;     // per-patch bitset, rewritten each frame
+    };
+    BakedTypeBatch bakedBatches_[GRASS_TYPE_COUNT];
+
+    // Fingerprint of what was baked - a mismatch (patch added, moved,
+    // retyped, or removed) marks the bake dirty. Steady-state frames never
+    // touch blade data, only this comparison and the bitsets.
+    struct PatchFingerprint {
+        glm::vec3 position = glm::vec3(0.0f);
+        GrassComponent::GrassType type = GrassComponent::GrassType::SHORT_GRASS;
+        float patchRadius = 0.0f;
+        uint32_t bladeCount = 0;
+    };
+    std::unordered_map<EntityID, PatchFingerprint> bakedFingerprints_;
+    bool bakeDirty_ = true;
+
+    // Dynamic per-frame batches - only rustling patches go through here,
+    // because their wind strength changes every frame and baked instance
+    // data is immutable. Calm patches (the vast majority) draw baked.
+    std::vector<VulkanMon::InstanceData> typeBatches_[GRASS_TYPE_COUNT];
+
+    // CPU mirror of the baked blade data, kept so rustling patches can be
+    // re-submitted dynamically (with boosted wind) without regenerating
+    std::vector<VulkanMon::InstanceData> bakedCpuBlades_[GRASS_TYPE_COUNT];
+
+    // Rustle below this routes a patch through the baked path unchanged;
+    // above it the patch draws dynamically so the sway boost is visible
+    static constexpr float RUSTLE_DYNAMIC_THRESHOLD = 0.05f;
+
     // Performance tracking
     struct GrassStats {
         size_t grassPatchesProcessed = 0;
         size_t rustleEventsTriggered = 0;
         size_t spawnsAttempted = 0;
         size_t creaturesSpawned = 0;
+        size_t bladesSubmitted = 0;
+        size_t grassDrawCalls = 0;
+        size_t patchesCulled = 0;
         float updateTimeMs = 0.0f;
     } frameStats_;
 
@@ -90,7 +162,16 @@ public:
         }
 
         auto start = std::chrono::high_resolution_clock::now();
+
+        // Preserve last frame's render counters - render() runs after
+        // update(), so resetting them here would log zeros
+        size_t lastBladesSubmitted = frameStats_.bladesSubmitted;
+        size_t lastGrassDrawCalls = frameStats_.grassDrawCalls;
+        size_t lastPatchesCulled = frameStats_.patchesCulled;
         frameStats_ = GrassStats{};
+        frameStats_.bladesSubmitted = lastBladesSubmitted;
+        frameStats_.grassDrawCalls = lastGrassDrawCalls;
+        frameStats_.patchesCulled = lastPatchesCulled;
 
         // Get all grass patches
         auto& transforms = entityManager.getAllComponents<Transform>();
@@ -126,15 +207,272 @@ public:
         }
     }
 
+    void setCameraSystem(std::shared_ptr<CameraSystem> cameraSystem) {
+        cameraSystem_ = cameraSystem;
+    }
+
     void render(VulkanRenderer& renderer, EntityManager& entityManager) override {
-        // GrassSystem doesn't render anything directly
-        // Rendering would be handled by a separate grass rendering system
+        // Steady-state frames do no blade work at all: placement was baked
+        // into a device-local buffer at load, so the CPU only refreshes the
+        // per-patch visibility bitset and issues range draws. Only patches
+        // that are actively rustling fall back to the dynamic path, because
+        // their per-instance wind strength changes every frame.
+        auto& grassComponents = entityManager.getAllComponents<GrassComponent>();
+        auto& grassEntities = entityManager.getEntitiesWithComponent<GrassComponent>();
+
+        if (isBakeStale(grassEntities, grassComponents, entityManager)) {
+            bakeGrassPlacements(renderer, grassEntities, grassComponents, entityManager);
+        }
+
+        // Frustum for patch visibility - without a camera system all
+        // patches draw (the GPU still clips them). Borrowed from the
+        // CameraSystem cache, not copied
+        const Frustum* frustum = cameraSystem_
+            ? &cameraSystem_->getActiveCameraFrustum(entityManager) : nullptr;
+
+        for (auto& batch : typeBatches_) {
+            batch.clear();
+        }
+
+        frameStats_.patchesCulled = 0;
+        for (size_t typeIndex = 0; typeIndex < GRASS_TYPE_COUNT; ++typeIndex) {
+            auto& baked = bakedBatches_[typeIndex];
+            for (size_t p = 0; p < baked.patches.size(); ++p) {
+                const auto& patch = baked.patches[p];
+
+                bool visible = true;
+                if (frustum) {
+                    // Generous vertical band - blades sit on the patch
+                    // plane but sway and scale above it
+                    BoundingBox patchBounds(
+                        patch.position - glm::vec3(patch.patchRadius, 1.0f, patch.patchRadius),
+                        patch.position + glm::vec3(patch.patchRadius, 3.0f, patch.patchRadius));
+                    visible = frustum->intersects(patchBounds);
+                }
+                if (!visible) {
+                    baked.visibility[p] = false;
+                    frameStats_.patchesCulled++;
+                    continue;
+                }
+
+                // Rustling patches leave the baked path for this frame so
+                // the boosted sway is visible; their blade data is sliced
+                // from the CPU mirror, never regenerated
+                const GrassComponent* grass = entityManager.hasComponent<GrassComponent>(patch.entity)
+                    ? &entityManager.getComponent<GrassComponent>(patch.entity) : nullptr;
+                if (grass && grass->rustleIntensity > RUSTLE_DYNAMIC_THRESHOLD) {
+                    baked.visibility[p] = false;
+                    float windStrength = baseWindStrength(grass->type) + grass->rustleIntensity;
+                    auto& batch = typeBatches_[typeIndex];
+                    const auto& mirror = bakedCpuBlades_[typeIndex];
+                    for (uint32_t b = 0; b < patch.instanceCount; ++b) {
+                        auto& instance = batch.emplace_back(mirror[patch.firstInstance + b]);
+                        instance.materialParams.z = windStrength;
+                    }
+                    continue;
+                }
+
+                baked.visibility[p] = true;
+            }
+        }
+
+        frameStats_.bladesSubmitted = 0;
+        frameStats_.grassDrawCalls = 0;
+        for (size_t typeIndex = 0; typeIndex < GRASS_TYPE_COUNT; ++typeIndex) {
+            auto type = static_cast<GrassComponent::GrassType>(typeIndex);
+            auto& baked = bakedBatches_[typeIndex];
+
+            // Contiguous visible patches merge into single range draws -
+            // a fully visible field of N patches is still one draw
+            if (baked.bufferHandle != VulkanRenderer::INVALID_BAKED_BUFFER) {
+                size_t p = 0;
+                while (p < baked.patches.size()) {
+                    if (!baked.visibility[p]) {
+                        ++p;
+                        continue;
+                    }
+                    uint32_t firstInstance = baked.patches[p].firstInstance;
+                    uint32_t instanceCount = 0;
+                    while (p < baked.patches.size() && baked.visibility[p]) {
+                        instanceCount += baked.patches[p].instanceCount;
+                        ++p;
+                    }
+                    renderer.renderGrassFromBakedBuffer(bladeMeshPath(type), baked.bufferHandle,
+                                                       firstInstance, instanceCount,
+                                                       bladeMaterialId(type));
+                    frameStats_.bladesSubmitted += instanceCount;
+                    frameStats_.grassDrawCalls++;
+                }
+            }
+
+            // Dynamic draw for this type's rustling patches
+            auto& batch = typeBatches_[typeIndex];
+            if (!batch.empty()) {
+                renderer.renderInstancedGrass(bladeMeshPath(type), batch, bladeMaterialId(type));
+                frameStats_.bladesSubmitted += batch.size();
+                frameStats_.grassDrawCalls++;
+            }
+        }
+    }
+
+    // Generate the blade instances for one patch - deterministic per entity
+    // so a patch always regrows identically. Static and pure for testability.
+    static std::vector<VulkanMon::InstanceData> generateBladeInstances(
+        EntityID entity, const glm::vec3& patchPosition, const GrassComponent& grass) {
+
+        std::vector<VulkanMon::InstanceData> blades;
+        blades.reserve(grass.bladeCount);
+
+        std::mt19937 bladeRng(static_cast<uint32_t>(entity) * 2654435761u + 1u);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        for (uint32_t b = 0; b < grass.bladeCount; ++b) {
+            // Uniform scatter over the patch disc (sqrt for area uniformity)
+            float radius = grass.patchRadius * std::sqrt(unit(bladeRng));
+            float angle = unit(bladeRng) * glm::two_pi<float>();
+            glm::vec3 position = patchPosition + glm::vec3(radius * std::cos(angle),
+                                                           0.0f,
+                                                           radius * std::sin(angle));
+
+            // Random yaw and +/- 30% scale jitter break up the repetition
+            // of instancing a single blade mesh
+            glm::quat yaw = glm::angleAxis(unit(bladeRng) * glm::two_pi<float>(),
+                                           glm::vec3(0.0f, 1.0f, 0.0f));
+            float scale = grass.bladeScale * (0.7f + 0.6f * unit(bladeRng));
+
+            blades.emplace_back(position, yaw, scale, bladeMaterialId(grass.type));
+        }
+        return blades;
+    }
+
+    // Per-type blade mesh - one mesh per type keeps each type a single draw
+    static const char* bladeMeshPath(GrassComponent::GrassType type) {
+        switch (type) {
+            case GrassComponent::GrassType::SHORT_GRASS: return "grass_blade_short.obj";
+            case GrassComponent::GrassType::TALL_GRASS: return "grass_blade_tall.obj";
+            case GrassComponent::GrassType::FLOWER_PATCH: return "flower_patch.obj";
+            case GrassComponent::GrassType::DENSE_BRUSH: return "dense_brush.obj";
+            default: return "grass_blade_short.obj";
+        }
+    }
+
+    static uint32_t bladeMaterialId(GrassComponent::GrassType type) {
+        // Emerald reads as foliage; flowers use Ruby for contrast
+        return type == GrassComponent::GrassType::FLOWER_PATCH ? 2u : 4u;
+    }
+
+    // Calm-air sway per type - rustle from passing creatures adds on top
+    static float baseWindStrength(GrassComponent::GrassType type) {
+        switch (type) {
+            case GrassComponent::GrassType::SHORT_GRASS: return 0.35f;
+            case GrassComponent::GrassType::TALL_GRASS: return 0.6f;
+            case GrassComponent::GrassType::FLOWER_PATCH: return 0.4f;
+            case GrassComponent::GrassType::DENSE_BRUSH: return 0.25f;
+            default: return 0.35f;
+        }
     }
 
     // Get system statistics
     const GrassStats& getFrameStats() const { return frameStats_; }
 
 private:
+    // True when the baked buffers no longer match the live patch set -
+    // a patch was added, removed, moved, retyped, or re-tuned
+    bool isBakeStale(const std::vector<EntityID>& grassEntities,
+                    std::vector<GrassComponent>& grassComponents,
+                    EntityManager& entityManager) const {
+        if (bakeDirty_) {
+            return true;
+        }
+
+        size_t livePatches = 0;
+        for (size_t i = 0; i < grassEntities.size(); ++i) {
+            EntityID entity = grassEntities[i];
+            if (!entityManager.hasComponent<Transform>(entity)) {
+                continue;
+            }
+            livePatches++;
+
+            auto it = bakedFingerprints_.find(entity);
+            if (it == bakedFingerprints_.end()) {
+                return true;
+            }
+            const auto& grass = grassComponents[i];
+            const auto& transform = entityManager.getComponent<Transform>(entity);
+            if (it->second.position != transform.position ||
+                it->second.type != grass.type ||
+                it->second.patchRadius != grass.patchRadius ||
+                it->second.bladeCount != grass.bladeCount) {
+                return true;
+            }
+        }
+        return livePatches != bakedFingerprints_.size();
+    }
+
+    // Regenerate all blade placement and upload it to device-local buffers,
+    // one per grass type. Deterministic per patch entity, so a rebake after
+    // an unrelated patch edit regrows every other patch identically.
+    void bakeGrassPlacements(VulkanRenderer& renderer,
+                            const std::vector<EntityID>& grassEntities,
+                            std::vector<GrassComponent>& grassComponents,
+                            EntityManager& entityManager) {
+        for (auto& baked : bakedBatches_) {
+            if (baked.bufferHandle != VulkanRenderer::INVALID_BAKED_BUFFER) {
+                renderer.destroyBakedInstanceBuffer(baked.bufferHandle);
+            }
+            baked = BakedTypeBatch{};
+        }
+        for (auto& mirror : bakedCpuBlades_) {
+            mirror.clear();
+        }
+        bakedFingerprints_.clear();
+
+        for (size_t i = 0; i < grassEntities.size(); ++i) {
+            EntityID entity = grassEntities[i];
+            if (!entityManager.hasComponent<Transform>(entity)) {
+                continue;
+            }
+            auto& grass = grassComponents[i];
+            const auto& transform = entityManager.getComponent<Transform>(entity);
+
+            size_t typeIndex = static_cast<size_t>(grass.type);
+            auto& mirror = bakedCpuBlades_[typeIndex];
+
+            BakedPatch patch{};
+            patch.entity = entity;
+            patch.position = transform.position;
+            patch.patchRadius = grass.patchRadius;
+            patch.firstInstance = static_cast<uint32_t>(mirror.size());
+            patch.instanceCount = grass.bladeCount;
+            bakedBatches_[typeIndex].patches.push_back(patch);
+
+            // Baked wind strength is the type's calm-air sway; rustle
+            // boosts reroute through the dynamic path instead
+            auto blades = generateBladeInstances(entity, transform.position, grass);
+            float calmWind = baseWindStrength(grass.type);
+            for (auto& blade : blades) {
+                blade.materialParams.z = calmWind;
+            }
+            mirror.insert(mirror.end(), blades.begin(), blades.end());
+
+            bakedFingerprints_[entity] = PatchFingerprint{transform.position, grass.type,
+                                                          grass.patchRadius, grass.bladeCount};
+        }
+
+        for (size_t typeIndex = 0; typeIndex < GRASS_TYPE_COUNT; ++typeIndex) {
+            auto& baked = bakedBatches_[typeIndex];
+            baked.visibility.assign(baked.patches.size(), true);
+            if (!bakedCpuBlades_[typeIndex].empty()) {
+                auto type = static_cast<GrassComponent::GrassType>(typeIndex);
+                baked.bufferHandle = renderer.bakeInstanceBuffer(
+                    bakedCpuBlades_[typeIndex],
+                    std::string("grass placement: ") + getGrassTypeName(type));
+            }
+        }
+
+        bakeDirty_ = false;
+    }
+
     void updateGrassPatch(EntityID entity, const Transform& transform, const SpatialComponent& spatial,
                          GrassComponent& grass, float deltaTime, EntityManager& entityManager) {
 
@@ -271,6 +609,9 @@ private:
         VKMON_INFO("  Rustle events triggered: " + std::to_string(frameStats_.rustleEventsTriggered));
         VKMON_INFO("  Spawn attempts: " + std::to_string(frameStats_.spawnsAttempted));
         VKMON_INFO("  Creatures spawned: " + std::to_string(frameStats_.creaturesSpawned));
+        VKMON_INFO("  Blades submitted: " + std::to_string(frameStats_.bladesSubmitted) +
+                   " in " + std::to_string(frameStats_.grassDrawCalls) + " draws");
+        VKMON_INFO("  Patches frustum-culled: " + std::to_string(frameStats_.patchesCulled));
         VKMON_INFO("  Update time: " + std::to_string(frameStats_.updateTimeMs) + "ms");
     }
 };
@@ -0,0 +1,350 @@
+#pragma once
+
+#include "../core/SystemImpl.h"
+#include "../components/Transform.h"
+#include "../components/CreaturePhysicsComponent.h"
+#include "../systems/PhysicsSystem.h"
+#include "../utils/JobSystem.h"
+#include "../utils/Logger.h"
+#include <glm/glm.hpp>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace VulkanMon {
+
+// =============================================================================
+// NAVIGATION SYSTEM - Async path/steering request queue for creatures
+// =============================================================================
+//
+// Creatures never pathfind synchronously. Movement goals go into a request
+// queue; each frame the system drains a capped batch, probes the terrain
+// along each goal line with ONE raycastBatch (already fanned across the
+// worker pool), and hands the hit data to a JobSystem worker that turns it
+// into ground-snapped waypoint paths. Solved paths publish at the START of
+// the next update - a goal submitted on frame N steers the creature on
+// frame N+1, and nothing about the solve sits on the main thread's
+// critical path.
+//
+// The split matters for thread safety: physics queries must be issued
+// between simulation steps, so the raycastBatch runs inside update() where
+// that ordering is guaranteed, while the pure-math steering solve (which
+// touches no physics or ECS state) is what moves to the worker.
+//
+// Path following itself is a cheap per-frame sweep that writes the next
+// waypoint direction into CreaturePhysicsComponent::inputDirection -
+// PhysicsSystem keeps sole ownership of actual movement, same contract as
+// FlockingSystem.
+class NavigationSystem : public System<Transform, CreaturePhysicsComponent> {
+public:
+    // Goals solved per frame; overflow stays queued for the next frame
+    static constexpr size_t MAX_GOALS_PER_BATCH = 64;
+
+    // Terrain probe shape: samples every PROBE_SPACING meters along the
+    // goal line, each a downward ray from PROBE_HEIGHT above the sample
+    static constexpr float PROBE_SPACING = 2.0f;
+    static constexpr float PROBE_HEIGHT = 2.0f;
+    static constexpr float PROBE_DEPTH = 10.0f;
+    static constexpr size_t MAX_PROBES_PER_GOAL = 16;
+
+    static constexpr float WAYPOINT_REACHED_DISTANCE = 0.5f;
+
+    void setPhysicsSystem(PhysicsSystem* physicsSystem) {
+        physicsSystem_ = physicsSystem;
+    }
+
+    // Collision filter for terrain probes. Defaults to all layers for the
+    // same reason CharacterControllerSystem's ground rays do: raycast
+    // filtering works on Jolt object layers, which LayerMask bits do not
+    // map onto.
+    void setProbeLayerMask(uint32_t layerMask) { probeLayerMask_ = layerMask; }
+
+    ~NavigationSystem() {
+        // A worker may still hold the solve buffers; let it finish before
+        // they are torn down
+        if (solveInFlight_) {
+            JobSystem::getInstance().waitIdle();
+        }
+    }
+
+    // Queue a movement goal. Replaces any pending goal for the same
+    // creature - the newest intent wins.
+    void requestMoveTo(EntityID entity, const glm::vec3& goal) {
+        for (auto& request : pendingGoals_) {
+            if (request.entity == entity) {
+                request.goal = goal;
+                return;
+            }
+        }
+        pendingGoals_.push_back(GoalRequest{entity, goal});
+    }
+
+    void cancelNavigation(EntityID entity) {
+        activePaths_.erase(entity);
+        for (auto it = pendingGoals_.begin(); it != pendingGoals_.end(); ++it) {
+            if (it->entity == entity) {
+                pendingGoals_.erase(it);
+                break;
+            }
+        }
+    }
+
+    bool isNavigating(EntityID entity) const {
+        return activePaths_.find(entity) != activePaths_.end();
+    }
+
+    void update(float deltaTime, EntityManager& entityManager) override {
+        if (!physicsSystem_) {
+            return;
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        frameStats_ = NavigationStats{};
+
+        // 1. Publish paths the worker finished since last frame
+        collectSolvedPaths();
+
+        // 2. Drain a batch of goals and probe the terrain. The blocking
+        //    raycastBatch runs here, between physics steps, which is the
+        //    only place physics queries are legal; the batch itself fans
+        //    across the worker pool.
+        if (!solveInFlight_ && !pendingGoals_.empty()) {
+            dispatchSolveBatch(entityManager);
+        }
+
+        // 3. Steer creatures along their active paths
+        followPaths(entityManager);
+
+        auto end = std::chrono::high_resolution_clock::now();
+        frameStats_.updateTimeMs = std::chrono::duration<float, std::milli>(end - start).count();
+
+        static int frameCount = 0;
+        if (++frameCount >= 1800) { // Every ~30 seconds at 60 FPS
+            logPerformanceStats();
+            frameCount = 0;
+        }
+    }
+
+    void render(VulkanRenderer& renderer, EntityManager& entityManager) override {
+        // NavigationSystem doesn't render anything
+    }
+
+    struct NavigationStats {
+        size_t goalsQueued = 0;
+        size_t goalsDispatched = 0;
+        size_t pathsPublished = 0;
+        size_t creaturesFollowing = 0;
+        size_t terrainProbesIssued = 0;
+        float updateTimeMs = 0.0f;
+    };
+    const NavigationStats& getFrameStats() const { return frameStats_; }
+
+private:
+    struct GoalRequest {
+        EntityID entity = INVALID_ENTITY;
+        glm::vec3 goal{0.0f};
+    };
+
+    // One goal's slice of the shared probe batch
+    struct SolveEntry {
+        EntityID entity = INVALID_ENTITY;
+        glm::vec3 start{0.0f};
+        glm::vec3 goal{0.0f};
+        size_t firstProbe = 0;
+        size_t probeCount = 0;
+    };
+
+    struct PathResult {
+        EntityID entity = INVALID_ENTITY;
+        std::vector<glm::vec3> waypoints;
+    };
+
+    void collectSolvedPaths() {
+        if (!solveReady_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        for (auto& result : solvedPaths_) {
+            if (!result.waypoints.empty()) {
+                activePaths_[result.entity] = ActivePath{std::move(result.waypoints), 0};
+                frameStats_.pathsPublished++;
+            }
+        }
+        solvedPaths_.clear();
+        solveReady_.store(false, std::memory_order_release);
+        solveInFlight_ = false;
+    }
+
+    void dispatchSolveBatch(EntityManager& entityManager) {
+        solveEntries_.clear();
+        probeRequests_.clear();
+
+        size_t dispatched = 0;
+        while (!pendingGoals_.empty() && dispatched < MAX_GOALS_PER_BATCH) {
+            GoalRequest request = pendingGoals_.front();
+            pendingGoals_.pop_front();
+
+            if (!entityManager.hasComponent<Transform>(request.entity)) {
+                continue; // Creature despawned while queued
+            }
+            glm::vec3 start = entityManager.getComponent<Transform>(request.entity).position;
+
+            glm::vec3 toGoal = request.goal - start;
+            float distance = glm::length(glm::vec3(toGoal.x, 0.0f, toGoal.z));
+            if (distance < WAYPOINT_REACHED_DISTANCE) {
+                continue; // Already there
+            }
+
+            size_t probeCount = std::min(MAX_PROBES_PER_GOAL,
+                static_cast<size_t>(std::ceil(distance / PROBE_SPACING)));
+
+            SolveEntry entry;
+            entry.entity = request.entity;
+            entry.start = start;
+            entry.goal = request.goal;
+            entry.firstProbe = probeRequests_.size();
+            entry.probeCount = probeCount;
+
+            for (size_t i = 1; i <= probeCount; ++i) {
+                float t = static_cast<float>(i) / static_cast<float>(probeCount);
+                glm::vec3 sample = start + toGoal * t;
+
+                PhysicsSystem::RaycastRequest probe;
+                probe.origin = sample + glm::vec3(0.0f, PROBE_HEIGHT, 0.0f);
+                probe.direction = glm::vec3(0.0f, -1.0f, 0.0f);
+                probe.maxDistance = PROBE_DEPTH;
+                probe.layerMask = probeLayerMask_;
+                probeRequests_.push_back(probe);
+            }
+
+            solveEntries_.push_back(entry);
+            dispatched++;
+        }
+
+        frameStats_.goalsQueued = pendingGoals_.size();
+        frameStats_.goalsDispatched = dispatched;
+        frameStats_.terrainProbesIssued = probeRequests_.size();
+
+        if (solveEntries_.empty()) {
+            return;
+        }
+
+        // One blocking batch for every probe of every goal in the frame
+        probeHits_ = physicsSystem_->raycastBatch(probeRequests_);
+
+        // The remaining solve is pure math over captured data - ship it to
+        // a worker and pick up the results next frame
+        solveInFlight_ = true;
+        JobSystem::getInstance().submit([this]() {
+            solvePaths();
+            solveReady_.store(true, std::memory_order_release);
+        }, JobPriority::Normal);
+    }
+
+    // Worker-side: turn probe hits into ground-snapped waypoint paths.
+    // Touches only the solve buffers, never ECS or physics state.
+    void solvePaths() {
+        solvedPaths_.clear();
+        solvedPaths_.reserve(solveEntries_.size());
+
+        for (const auto& entry : solveEntries_) {
+            PathResult result;
+            result.entity = entry.entity;
+            result.waypoints.reserve(entry.probeCount);
+
+            for (size_t i = 0; i < entry.probeCount; ++i) {
+                const auto& hit = probeHits_[entry.firstProbe + i];
+                if (!hit.hit) {
+                    // No ground under this sample - cliff edge or hole.
+                    // Truncate: the creature walks as far as terrain allows.
+                    break;
+                }
+                result.waypoints.push_back(hit.point);
+            }
+
+            solvedPaths_.push_back(std::move(result));
+        }
+    }
+
+    void followPaths(EntityManager& entityManager) {
+        for (auto it = activePaths_.begin(); it != activePaths_.end();) {
+            EntityID entity = it->first;
+            ActivePath& path = it->second;
+
+            if (!entityManager.hasComponent<Transform>(entity) ||
+                !entityManager.hasComponent<CreaturePhysicsComponent>(entity)) {
+                it = activePaths_.erase(it);
+                continue;
+            }
+
+            const glm::vec3& position = entityManager.getComponent<Transform>(entity).position;
+
+            // Advance past reached waypoints (XZ distance - the body's Y
+            // is the physics engine's business)
+            while (path.nextWaypoint < path.waypoints.size()) {
+                glm::vec3 toWaypoint = path.waypoints[path.nextWaypoint] - position;
+                toWaypoint.y = 0.0f;
+                if (glm::dot(toWaypoint, toWaypoint) >
+                    WAYPOINT_REACHED_DISTANCE * WAYPOINT_REACHED_DISTANCE) {
+                    break;
+                }
+                path.nextWaypoint++;
+            }
+
+            if (path.nextWaypoint >= path.waypoints.size()) {
+                entityManager.getComponent<CreaturePhysicsComponent>(entity).inputDirection = glm::vec3(0.0f);
+                it = activePaths_.erase(it);
+                continue;
+            }
+
+            glm::vec3 direction = path.waypoints[path.nextWaypoint] - position;
+            direction.y = 0.0f;
+            float length = glm::length(direction);
+            if (length > 0.001f) {
+                entityManager.getComponent<CreaturePhysicsComponent>(entity).inputDirection =
+                    direction / length;
+            }
+
+            frameStats_.creaturesFollowing++;
+            ++it;
+        }
+    }
+
+    void logPerformanceStats() {
+        VKMON_INFO("NavigationSystem Performance:");
+        VKMON_INFO("  Goals still queued: " + std::to_string(frameStats_.goalsQueued));
+        VKMON_INFO("  Goals dispatched: " + std::to_string(frameStats_.goalsDispatched));
+        VKMON_INFO("  Paths published: " + std::to_string(frameStats_.pathsPublished));
+        VKMON_INFO("  Creatures following: " + std::to_string(frameStats_.creaturesFollowing));
+        VKMON_INFO("  Terrain probes issued: " + std::to_string(frameStats_.terrainProbesIssued));
+        VKMON_INFO("  Update time: " + std::to_string(frameStats_.updateTimeMs) + "ms");
+    }
+
+    struct ActivePath {
+        std::vector<glm::vec3> waypoints;
+        size_t nextWaypoint = 0;
+    };
+
+    PhysicsSystem* physicsSystem_ = nullptr;  // Non-owning, lifetime managed by World
+    uint32_t probeLayerMask_ = 0xFFFFFFFF;    // Default to all layers
+
+    std::deque<GoalRequest> pendingGoals_;
+    std::unordered_map<EntityID, ActivePath> activePaths_;
+
+    // Solve buffers: written by update() before dispatch, read by the
+    // worker, results collected next frame. solveReady_ is the only
+    // cross-thread handshake - exactly one solve is in flight at a time.
+    std::vector<SolveEntry> solveEntries_;
+    std::vector<PhysicsSystem::RaycastRequest> probeRequests_;
+    std::vector<PhysicsSystem::RaycastHit> probeHits_;
+    std::vector<PathResult> solvedPaths_;
+    bool solveInFlight_ = false;
+    std::atomic<bool> solveReady_{false};
+
+    NavigationStats frameStats_;
+};
+
+} // namespace VulkanMon
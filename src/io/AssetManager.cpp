@@ -1,6 +1,8 @@
 #include "AssetManager.h"
 #include "../utils/Logger.h"
 #include "../rendering/ResourceManager.h"
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <filesystem>
 #include <chrono>
@@ -23,12 +25,32 @@ AssetManager::AssetManager(VkDevice device, VkPhysicalDevice physicalDevice,
     , resourceManager_(std::make_unique<ResourceManager>(device, physicalDevice)) {
     
     initializeAssetDirectories();
+
+    // Shipped builds carry the assets as one archive named after the
+    // loose directory ("assets/" -> "assets.vkpack"); mount it when present
+    std::string defaultPack = assetsRootPath_;
+    while (!defaultPack.empty() && (defaultPack.back() == '/' || defaultPack.back() == '\\')) {
+        defaultPack.pop_back();
+    }
+    defaultPack += ".vkpack";
+    if (fileExists(defaultPack)) {
+        mountAssetPack(defaultPack);
+    }
+
     VKMON_INFO("AssetManager initialized with root path: " + assetsRootPath_);
 }
 
 AssetManager::~AssetManager() {
     VKMON_INFO("AssetManager cleanup starting");
-    
+
+    // Stop the loader pool before touching the caches it feeds
+    stopLoaderPool();
+
+    // Let any in-flight uploads into cached textures finish first
+    if (transferManager_) {
+        transferManager_->waitForAllUploads();
+    }
+
     // Clear texture cache (this will destroy samplers)
     for (auto& [filename, texture] : textureCache_) {
         if (texture->sampler != VK_NULL_HANDLE) {
@@ -68,10 +90,34 @@ std::string AssetManager::getFullAssetPath(AssetType type, const std::string& fi
 }
 
 bool AssetManager::validateAssetPath(const std::string& relativePath) const {
+    if (assetPack_ && assetPack_->contains(relativePath)) {
+        return true;
+    }
     std::string fullPath = assetsRootPath_ + relativePath;
     return fileExists(fullPath);
 }
 
+bool AssetManager::mountAssetPack(const std::string& packPath) {
+    auto pack = std::make_unique<AssetPack>();
+    if (!pack->open(packPath)) {
+        VKMON_WARNING("Asset pack not mounted: " + packPath);
+        return false;
+    }
+    assetPack_ = std::move(pack);
+    return true;
+}
+
+const unsigned char* AssetManager::findPackedAsset(const std::string& fullPath, size_t& size) const {
+    if (!assetPack_) {
+        return nullptr;
+    }
+    // Pack entries are stored relative to the assets root
+    if (fullPath.rfind(assetsRootPath_, 0) != 0) {
+        return nullptr;
+    }
+    return assetPack_->find(fullPath.substr(assetsRootPath_.size()), size);
+}
+
 bool AssetManager::fileExists(const std::string& path) const {
     return std::filesystem::exists(path) && std::filesystem::is_regular_file(path);
 }
@@ -96,9 +142,10 @@ std::shared_ptr<LoadedTexture> AssetManager::loadTexture(const TextureLoadInfo&
     // Check cache first
     {
         std::shared_lock<std::shared_mutex> lock(textureCacheMutex_);
-        auto it = textureCache_.find(loadInfo.filename);
+        auto it = textureCache_.find(loadInfo.cacheKey());
         if (it != textureCache_.end()) {
             it->second->referenceCount++;
+            it->second->lastUsedTick = textureUseTick_++;
             VKMON_DEBUG("Texture loaded from cache: " + loadInfo.filename + " (refs: " +
                        std::to_string(it->second->referenceCount) + ")");
             return it->second;
@@ -108,95 +155,362 @@ std::shared_ptr<LoadedTexture> AssetManager::loadTexture(const TextureLoadInfo&
     try {
         // Load image data
         uint32_t width, height;
-        auto image = createTextureImage(loadInfo.filename, width, height);
-        
-        // Create sampler
-        VkSampler sampler = createTextureSampler(loadInfo);
-        
-        // Create loaded texture
-        auto loadedTexture = std::make_shared<LoadedTexture>(
-            std::move(image), sampler, width, height, loadInfo.filename);
-        loadedTexture->referenceCount = 1;
-        
-        // Add to cache
-        {
-            std::unique_lock<std::shared_mutex> lock(textureCacheMutex_);
-            textureCache_[loadInfo.filename] = loadedTexture;
-        }
-        
+        auto image = createTextureImage(loadInfo, width, height);
+
+        auto loadedTexture = finalizeLoadedTexture(loadInfo, std::move(image), width, height);
+
         // Performance logging
         if (performanceLogging_) {
             auto endTime = std::chrono::high_resolution_clock::now();
             auto duration = std::chrono::duration<double, std::milli>(endTime - startTime);
             VKMON_PERF("Texture loading (" + loadInfo.debugName + ")", duration.count());
         }
-        
-        VKMON_INFO("Texture loaded: " + loadInfo.filename + " (" + 
-                  std::to_string(width) + "x" + std::to_string(height) + ")");
-        
+
         return loadedTexture;
-        
+
     } catch (const std::exception& e) {
         VKMON_ERROR("Failed to load texture " + loadInfo.filename + ": " + e.what());
         throw;
     }
 }
 
-std::unique_ptr<ManagedImage> AssetManager::createTextureImage(const std::string& filename, 
+std::shared_ptr<LoadedTexture> AssetManager::finalizeLoadedTexture(const TextureLoadInfo& loadInfo,
+                                                                   std::unique_ptr<ManagedImage> image,
+                                                                   uint32_t width, uint32_t height) {
+    // Create sampler
+    VkSampler sampler = createTextureSampler(loadInfo);
+
+    // Create loaded texture
+    auto loadedTexture = std::make_shared<LoadedTexture>(
+        std::move(image), sampler, width, height, loadInfo.filename);
+    loadedTexture->format = loadedTexture->image->getFormat();
+    loadedTexture->referenceCount = 1;
+    loadedTexture->lastUsedTick = textureUseTick_++;
+
+    // Publish into the renderer's bindless array so draws can select
+    // this texture by index without a descriptor rebind. A hot reload
+    // overwrites the retired entry's slot in place instead of allocating
+    // a fresh one, keeping every recorded index valid.
+    auto slotReuse = pendingSlotReuse_.find(loadInfo.cacheKey());
+    bool reuseSlot = slotReuse != pendingSlotReuse_.end() &&
+                     slotReuse->second != 0 && bindlessUpdater_;
+    if (reuseSlot) {
+        bindlessUpdater_(slotReuse->second, loadedTexture->image->getImageView(),
+                         loadedTexture->sampler);
+        loadedTexture->bindlessIndex = slotReuse->second;
+        VKMON_INFO("Texture hot reloaded in place: " + loadInfo.filename +
+                   " (slot " + std::to_string(loadedTexture->bindlessIndex) + ")");
+    } else if (bindlessRegistrar_) {
+        loadedTexture->bindlessIndex = bindlessRegistrar_(loadedTexture->image->getImageView(),
+                                                          loadedTexture->sampler);
+    }
+    if (slotReuse != pendingSlotReuse_.end()) {
+        pendingSlotReuse_.erase(slotReuse);
+    }
+
+    // Release the retired predecessor from a reload: it kept the slot's
+    // old view alive until the overwrite above. Carry its reference count
+    // so holders' unloadTexture calls stay balanced.
+    auto retired = retiredTextures_.find(loadInfo.cacheKey());
+    if (retired != retiredTextures_.end()) {
+        loadedTexture->referenceCount = retired->second->referenceCount.load();
+        if (retired->second->sampler != VK_NULL_HANDLE) {
+            vkDestroySampler(device_, retired->second->sampler, nullptr);
+            retired->second->sampler = VK_NULL_HANDLE;
+        }
+        retiredTextures_.erase(retired);
+    }
+
+    // Add to cache
+    {
+        std::unique_lock<std::shared_mutex> lock(textureCacheMutex_);
+        textureCache_[loadInfo.cacheKey()] = loadedTexture;
+    }
+
+    // A new resident texture may push the cache past its budget
+    enforceTextureBudget();
+
+    VKMON_INFO("Texture loaded: " + loadInfo.filename + " (" +
+              std::to_string(width) + "x" + std::to_string(height) + ")");
+
+    return loadedTexture;
+}
+
+namespace {
+
+// Drop mip levels on the CPU: box-filter halve the decoded RGBA image
+// dropLevels times. Frees the input and returns a malloc'd replacement
+// (stbi_image_free-compatible), so callers keep one ownership rule.
+// Tiny images stop halving early rather than degrade to noise.
+stbi_uc* applyMipDrop(stbi_uc* pixels, int& width, int& height, uint32_t dropLevels) {
+    while (dropLevels-- > 0 && width >= 8 && height >= 8) {
+        int halfWidth = width / 2;
+        int halfHeight = height / 2;
+        auto* half = static_cast<stbi_uc*>(malloc(static_cast<size_t>(halfWidth) * halfHeight * 4));
+        if (!half) {
+            return pixels; // Keep the sharper tier rather than fail the load
+        }
+        for (int y = 0; y < halfHeight; ++y) {
+            for (int x = 0; x < halfWidth; ++x) {
+                const stbi_uc* s0 = pixels + ((y * 2) * width + x * 2) * 4;
+                const stbi_uc* s1 = s0 + width * 4;
+                stbi_uc* dst = half + (y * halfWidth + x) * 4;
+                for (int c = 0; c < 4; ++c) {
+                    dst[c] = static_cast<stbi_uc>(
+                        (s0[c] + s0[4 + c] + s1[c] + s1[4 + c] + 2) / 4);
+                }
+            }
+        }
+        stbi_image_free(pixels);
+        pixels = half;
+        width = halfWidth;
+        height = halfHeight;
+    }
+    return pixels;
+}
+
+// ============================================================================
+// KTX2 Container Parsing (cooked GPU-compressed textures)
+// ============================================================================
+
+// The cook step writes plain KTX2: a fixed header, a level index, then the
+// block data. We only need enough of the spec to hand level 0 to Vulkan -
+// no supercompression, no data format descriptor interpretation (the
+// vkFormat field already names the format exactly).
+
+constexpr unsigned char KTX2_IDENTIFIER[12] = {
+    0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'
+};
+
+struct Ktx2Header {
+    uint32_t vkFormat;
+    uint32_t typeSize;
+    uint32_t pixelWidth;
+    uint32_t pixelHeight;
+    uint32_t pixelDepth;
+    uint32_t layerCount;
+    uint32_t faceCount;
+    uint32_t levelCount;
+    uint32_t supercompressionScheme;
+};
+
+struct Ktx2LevelEntry {
+    uint64_t byteOffset;
+    uint64_t byteLength;
+    uint64_t uncompressedByteLength;
+};
+
+// Validate a KTX2 blob and point levelData/levelSize at the base (largest)
+// mip level. Engine images are single-mip (sampler maxLod is 0), so only
+// level 0 is consumed; smaller levels in the file are ignored.
+bool parseKtx2BaseLevel(const unsigned char* bytes, size_t size,
+                        VkFormat& format, uint32_t& width, uint32_t& height,
+                        const unsigned char*& levelData, size_t& levelSize) {
+    constexpr size_t IDENTIFIER_SIZE = sizeof(KTX2_IDENTIFIER);
+    constexpr size_t INDEX_SIZE = 4 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+    constexpr size_t LEVEL_INDEX_OFFSET = IDENTIFIER_SIZE + sizeof(Ktx2Header) + INDEX_SIZE;
+
+    if (size < LEVEL_INDEX_OFFSET + sizeof(Ktx2LevelEntry)) {
+        return false;
+    }
+    if (std::memcmp(bytes, KTX2_IDENTIFIER, IDENTIFIER_SIZE) != 0) {
+        return false;
+    }
+
+    Ktx2Header header;
+    std::memcpy(&header, bytes + IDENTIFIER_SIZE, sizeof(header));
+
+    // 2D, single layer, single face, no supercompression - anything else
+    // is not something this pipeline cooks
+    if (header.supercompressionScheme != 0 ||
+        header.pixelDepth > 1 || header.layerCount > 1 || header.faceCount != 1 ||
+        header.levelCount < 1 ||
+        header.pixelWidth == 0 || header.pixelHeight == 0) {
+        return false;
+    }
+
+    Ktx2LevelEntry level;
+    std::memcpy(&level, bytes + LEVEL_INDEX_OFFSET, sizeof(level));
+    if (level.byteLength == 0 ||
+        level.byteOffset > size || level.byteLength > size - level.byteOffset) {
+        return false;
+    }
+
+    format = static_cast<VkFormat>(header.vkFormat);
+    width = header.pixelWidth;
+    height = header.pixelHeight;
+    levelData = bytes + level.byteOffset;
+    levelSize = static_cast<size_t>(level.byteLength);
+    return true;
+}
+
+} // namespace
+
+std::string AssetManager::compressedVariantPath(const std::string& filename) {
+    // Replace the extension after the last path separator so directory
+    // names containing dots are left alone
+    size_t lastSlash = filename.find_last_of("/\\");
+    size_t searchFrom = (lastSlash == std::string::npos) ? 0 : lastSlash + 1;
+    size_t dot = filename.find_last_of('.');
+    if (dot == std::string::npos || dot < searchFrom) {
+        return filename + ".ktx2";
+    }
+    return filename.substr(0, dot) + ".ktx2";
+}
+
+bool AssetManager::isCompressedFormatSupported(VkFormat format) const {
+    VkFormatProperties properties{};
+    vkGetPhysicalDeviceFormatProperties(physicalDevice_, format, &properties);
+    return (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0;
+}
+
+bool AssetManager::tryLoadCompressedTexture(const TextureLoadInfo& loadInfo,
+                                            CompressedPixels& out) const {
+    // BC blocks cannot be box-filtered on the CPU, so distance-streaming
+    // tiers (mipDrop > 0) stay on the decoded RGBA path
+    if (loadInfo.mipDrop > 0) {
+        return false;
+    }
+
+    std::string variantPath = getFullAssetPath(AssetType::TEXTURE,
+                                               compressedVariantPath(loadInfo.filename));
+
+    const unsigned char* bytes = nullptr;
+    size_t byteCount = 0;
+    MappedFile mapped;  // keeps loose-file bytes alive through the parse
+    if (const unsigned char* packedData = findPackedAsset(variantPath, byteCount)) {
+        bytes = packedData;
+    } else if (fileExists(variantPath)) {
+        if (!mapped.open(variantPath)) {
+            return false;
+        }
+        bytes = static_cast<const unsigned char*>(mapped.data());
+        byteCount = mapped.size();
+    } else {
+        return false;
+    }
+
+    VkFormat format = VK_FORMAT_UNDEFINED;
+    uint32_t width = 0, height = 0;
+    const unsigned char* levelData = nullptr;
+    size_t levelSize = 0;
+    if (!parseKtx2BaseLevel(bytes, byteCount, format, width, height, levelData, levelSize)) {
+        VKMON_WARNING("Ignoring malformed KTX2 sidecar: " + variantPath);
+        return false;
+    }
+
+    if (!isCompressedFormatSupported(format)) {
+        VKMON_WARNING("Device cannot sample cooked format " + std::to_string(format) +
+                      " for " + loadInfo.filename + ", falling back to decoded RGBA");
+        return false;
+    }
+
+    out.format = format;
+    out.width = width;
+    out.height = height;
+    out.data.assign(levelData, levelData + levelSize);
+    return true;
+}
+
+std::unique_ptr<ManagedImage> AssetManager::createTextureImage(const TextureLoadInfo& loadInfo,
                                                                uint32_t& width, uint32_t& height) {
+    const std::string& filename = loadInfo.filename;
+
+    // A cooked .ktx2 sibling wins when the device supports its format:
+    // BC blocks upload directly with no decode
+    CompressedPixels compressed;
+    if (tryLoadCompressedTexture(loadInfo, compressed)) {
+        width = compressed.width;
+        height = compressed.height;
+        return createTextureImageFromBytes(compressed.data.data(), compressed.data.size(),
+                                           compressed.format, width, height, filename);
+    }
+
     // Get full path
     std::string fullPath = getFullAssetPath(AssetType::TEXTURE, filename);
-    
-    if (!fileExists(fullPath)) {
-        throw std::runtime_error("Texture file not found: " + fullPath);
-    }
-    
-    // Load image with stb_image
+
+    // Load image with stb_image - a mounted pack wins, loose files stay
+    // the development fallback
     int texWidth, texHeight, texChannels;
-    stbi_uc* pixels = stbi_load(fullPath.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
-    
+    stbi_uc* pixels = nullptr;
+    size_t packedSize = 0;
+    if (const unsigned char* packedData = findPackedAsset(fullPath, packedSize)) {
+        pixels = stbi_load_from_memory(packedData, static_cast<int>(packedSize),
+                                       &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+    } else {
+        if (!fileExists(fullPath)) {
+            throw std::runtime_error("Texture file not found: " + fullPath);
+        }
+        pixels = stbi_load(fullPath.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+    }
+
     if (!pixels) {
         throw std::runtime_error("Failed to load texture image: " + fullPath);
     }
     
+    if (loadInfo.mipDrop > 0) {
+        pixels = applyMipDrop(pixels, texWidth, texHeight, loadInfo.mipDrop);
+    }
+
     width = static_cast<uint32_t>(texWidth);
     height = static_cast<uint32_t>(texHeight);
-    VkDeviceSize imageSize = width * height * 4; // RGBA
-    
-    // Create staging buffer
-    auto stagingBuffer = resourceManager_->createBuffer(
-        imageSize, 
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-        "texture_staging_" + filename
-    );
-    
-    // Copy pixel data to staging buffer
-    stagingBuffer->updateData(pixels, imageSize);
-    
-    // Free the loaded image
+
+    auto textureImage = createTextureImageFromPixels(pixels, width, height, filename);
     stbi_image_free(pixels);
-    
-    // Create texture image
+    return textureImage;
+}
+
+std::unique_ptr<ManagedImage> AssetManager::createTextureImageFromPixels(const unsigned char* pixels,
+                                                                         uint32_t width, uint32_t height,
+                                                                         const std::string& filename) {
+    VkDeviceSize imageSize = static_cast<VkDeviceSize>(width) * height * 4; // RGBA
+    return createTextureImageFromBytes(pixels, imageSize, VK_FORMAT_R8G8B8A8_SRGB,
+                                       width, height, filename);
+}
+
+std::unique_ptr<ManagedImage> AssetManager::createTextureImageFromBytes(const unsigned char* data,
+                                                                        VkDeviceSize size, VkFormat format,
+                                                                        uint32_t width, uint32_t height,
+                                                                        const std::string& filename) {
+    // Create texture image - for BC formats the copy region below is still
+    // addressed in texels, Vulkan handles the block layout
     auto textureImage = resourceManager_->createImage(
         width, height,
-        VK_FORMAT_R8G8B8A8_SRGB,
+        format,
         VK_IMAGE_TILING_OPTIMAL,
         VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
         VK_IMAGE_ASPECT_COLOR_BIT,
         "texture_" + filename
     );
-    
+
+    if (transferManager_) {
+        // Async path: stage through the shared ring and submit to the
+        // transfer queue; rendering keeps running while the copy happens
+        transferManager_->uploadImage(data, size, textureImage->getImage(),
+                                     width, height, filename);
+        return textureImage;
+    }
+
+    // Blocking fallback (no TransferManager wired, e.g. standalone tests):
+    // per-texture staging buffer and single-use command buffers
+    auto stagingBuffer = resourceManager_->createBuffer(
+        size,
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        "texture_staging_" + filename
+    );
+    stagingBuffer->updateData(data, size);
+
     // Transition image layout and copy data
-    transitionImageLayout(textureImage->getImage(), VK_FORMAT_R8G8B8A8_SRGB, 
+    transitionImageLayout(textureImage->getImage(), format,
                          VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-    
+
     copyBufferToImage(stagingBuffer->getBuffer(), textureImage->getImage(), width, height);
-    
-    transitionImageLayout(textureImage->getImage(), VK_FORMAT_R8G8B8A8_SRGB,
+
+    transitionImageLayout(textureImage->getImage(), format,
                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-    
+
     return textureImage;
 }
 
@@ -227,6 +541,166 @@ VkSampler AssetManager::createTextureSampler(const TextureLoadInfo& loadInfo) {
     return sampler;
 }
 
+// ============================================================================
+// Async Texture Loading Implementation
+// ============================================================================
+
+AsyncTextureLoad AssetManager::loadTextureAsync(const std::string& filename) {
+    TextureLoadInfo loadInfo(filename);
+    return loadTextureAsync(loadInfo);
+}
+
+AsyncTextureLoad AssetManager::loadTextureAsync(const TextureLoadInfo& loadInfo) {
+    AsyncTextureLoad handle;
+
+    // Cache hits resolve immediately - no worker round trip
+    {
+        std::shared_lock<std::shared_mutex> lock(textureCacheMutex_);
+        auto it = textureCache_.find(loadInfo.cacheKey());
+        if (it != textureCache_.end()) {
+            it->second->referenceCount++;
+            it->second->lastUsedTick = textureUseTick_++;
+            handle.state_ = std::make_shared<AsyncTextureLoad::State>();
+            handle.state_->texture = it->second;
+            handle.state_->ready = true;
+            return handle;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(asyncLoadMutex_);
+
+    // Concurrent requests for the same file share one decode
+    auto pending = pendingTextureLoads_.find(loadInfo.cacheKey());
+    if (pending != pendingTextureLoads_.end()) {
+        handle.state_ = pending->second;
+        return handle;
+    }
+
+    handle.state_ = std::make_shared<AsyncTextureLoad::State>();
+    pendingTextureLoads_[loadInfo.cacheKey()] = handle.state_;
+    ++activeDecodeJobs_;
+
+    // Decode on the shared engine pool at Low priority - background IO
+    // never runs ahead of frame-critical physics or ECS work
+    JobSystem::getInstance().submit(
+        [this, job = TextureLoadJob{loadInfo, handle.state_}]() {
+            decodeTexture(job);
+        },
+        JobPriority::Low);
+
+    return handle;
+}
+
+void AssetManager::stopLoaderPool() {
+    // Decode jobs run on the shared JobSystem, so there are no threads to
+    // join - flag queued jobs to bail and wait out any already running so
+    // no worker touches this AssetManager after teardown
+    std::unique_lock<std::mutex> lock(asyncLoadMutex_);
+    loaderStopRequested_ = true;
+    decodeJobsDone_.wait(lock, [this] { return activeDecodeJobs_ == 0; });
+}
+
+void AssetManager::decodeTexture(TextureLoadJob job) {
+    {
+        std::lock_guard<std::mutex> lock(asyncLoadMutex_);
+        if (loaderStopRequested_) {
+            if (--activeDecodeJobs_ == 0) {
+                decodeJobsDone_.notify_all();
+            }
+            return;
+        }
+    }
+
+    // File I/O and STB decode - the expensive part, off the frame loop
+    DecodedTexture decoded{job.loadInfo, job.state};
+
+    // Cooked compressed sidecar first - format queries and pack reads
+    // are both safe from workers
+    CompressedPixels compressed;
+    if (tryLoadCompressedTexture(job.loadInfo, compressed)) {
+        auto* copy = static_cast<unsigned char*>(malloc(compressed.data.size()));
+        if (copy) {
+            std::memcpy(copy, compressed.data.data(), compressed.data.size());
+            decoded.pixels = std::unique_ptr<unsigned char, void (*)(void*)>(copy, free);
+            decoded.width = compressed.width;
+            decoded.height = compressed.height;
+            decoded.format = compressed.format;
+            decoded.byteSize = compressed.data.size();
+        }
+    }
+
+    if (!decoded.pixels) {
+        std::string fullPath = getFullAssetPath(AssetType::TEXTURE, job.loadInfo.filename);
+        int texWidth = 0, texHeight = 0, texChannels = 0;
+        stbi_uc* pixels = nullptr;
+        size_t packedSize = 0;
+        // Pack lookup is read-only into the mapping, safe from workers
+        if (const unsigned char* packedData = findPackedAsset(fullPath, packedSize)) {
+            pixels = stbi_load_from_memory(packedData, static_cast<int>(packedSize),
+                                           &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+        } else if (fileExists(fullPath)) {
+            pixels = stbi_load(fullPath.c_str(), &texWidth, &texHeight,
+                               &texChannels, STBI_rgb_alpha);
+        }
+        if (pixels && job.loadInfo.mipDrop > 0) {
+            pixels = applyMipDrop(pixels, texWidth, texHeight, job.loadInfo.mipDrop);
+        }
+        if (pixels) {
+            decoded.pixels = std::unique_ptr<unsigned char, void (*)(void*)>(pixels, stbi_image_free);
+            decoded.width = static_cast<uint32_t>(texWidth);
+            decoded.height = static_cast<uint32_t>(texHeight);
+            decoded.byteSize = static_cast<size_t>(texWidth) * texHeight * 4;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(asyncLoadMutex_);
+        completedTextureLoads_.push_back(std::move(decoded));
+        if (--activeDecodeJobs_ == 0) {
+            decodeJobsDone_.notify_all();
+        }
+    }
+}
+
+void AssetManager::processCompletedTextureLoads() {
+    // Drain under the lock, finalize outside it - GPU object creation and
+    // upload submission stay on the calling (main) thread
+    std::deque<DecodedTexture> completed;
+    {
+        std::lock_guard<std::mutex> lock(asyncLoadMutex_);
+        if (completedTextureLoads_.empty()) {
+            return;
+        }
+        completed.swap(completedTextureLoads_);
+        for (const auto& decoded : completed) {
+            pendingTextureLoads_.erase(decoded.loadInfo.cacheKey());
+        }
+    }
+
+    for (auto& decoded : completed) {
+        if (!decoded.pixels) {
+            VKMON_ERROR("Async texture load failed for " + decoded.loadInfo.filename +
+                        ": file missing or decode error");
+            decoded.state->failed = true;
+            continue;
+        }
+
+        try {
+            auto image = createTextureImageFromBytes(decoded.pixels.get(), decoded.byteSize,
+                                                     decoded.format,
+                                                     decoded.width, decoded.height,
+                                                     decoded.loadInfo.filename);
+            decoded.state->texture = finalizeLoadedTexture(decoded.loadInfo, std::move(image),
+                                                           decoded.width, decoded.height);
+            decoded.state->ready = true;
+        } catch (const std::exception& e) {
+            VKMON_ERROR("Async texture finalize failed for " + decoded.loadInfo.filename +
+                        ": " + e.what());
+            decoded.state->failed = true;
+        }
+    }
+}
+
 void AssetManager::unloadTexture(const std::string& filename) {
     std::unique_lock<std::shared_mutex> lock(textureCacheMutex_);
     auto it = textureCache_.find(filename);
@@ -380,6 +854,12 @@ std::vector<std::string> AssetManager::discoverAssets(AssetType type, const std:
 }
 
 void AssetManager::clearTextureCache() {
+    // Destroying images that an async upload is still copying into would
+    // be a use-after-free on the GPU timeline
+    if (transferManager_) {
+        transferManager_->waitForAllUploads();
+    }
+
     std::unique_lock<std::shared_mutex> lock(textureCacheMutex_);
     VKMON_INFO("Clearing texture cache (" + std::to_string(textureCache_.size()) + " textures)");
 
@@ -392,6 +872,217 @@ void AssetManager::clearTextureCache() {
     textureCache_.clear();
 }
 
+// ============================================================================
+// Hot Reload (see AssetWatcher)
+// ============================================================================
+
+void AssetManager::recordAssetDependency(const std::string& dependencyPath,
+                                         const std::string& consumerModel) {
+    std::lock_guard<std::mutex> lock(assetDependentsMutex_);
+    auto& consumers = assetDependents_[dependencyPath];
+    if (std::find(consumers.begin(), consumers.end(), consumerModel) == consumers.end()) {
+        consumers.push_back(consumerModel);
+    }
+}
+
+std::vector<std::string> AssetManager::getDependentModels(const std::string& dependencyPath) const {
+    std::lock_guard<std::mutex> lock(assetDependentsMutex_);
+    auto it = assetDependents_.find(dependencyPath);
+    return (it != assetDependents_.end()) ? it->second : std::vector<std::string>{};
+}
+
+void AssetManager::reloadTexture(const std::string& filename) {
+    // Retire every cached tier of this file: the base entry plus any
+    // streamed "#drop" mip tiers each hold their own bindless slot
+    struct RetiredTier {
+        std::string cacheKey;
+        uint32_t mipDrop;
+    };
+    std::vector<RetiredTier> tiers;
+    {
+        std::unique_lock<std::shared_mutex> lock(textureCacheMutex_);
+        std::string dropPrefix = filename + "#drop";
+        for (auto it = textureCache_.begin(); it != textureCache_.end();) {
+            const std::string& key = it->first;
+            bool isBase = (key == filename);
+            bool isDropTier = (key.rfind(dropPrefix, 0) == 0);
+            if (!isBase && !isDropTier) {
+                ++it;
+                continue;
+            }
+
+            uint32_t mipDrop = isBase
+                ? 0u
+                : static_cast<uint32_t>(std::stoul(key.substr(dropPrefix.size())));
+            tiers.push_back({key, mipDrop});
+            pendingSlotReuse_[key] = it->second->bindlessIndex;
+            retiredTextures_[key] = it->second;
+            it = textureCache_.erase(it);
+        }
+    }
+
+    if (tiers.empty()) {
+        VKMON_DEBUG("Texture changed on disk but not cached, nothing to reload: " + filename);
+        return;
+    }
+
+    for (const auto& tier : tiers) {
+        TextureLoadInfo loadInfo(filename);
+        loadInfo.mipDrop = tier.mipDrop;
+        loadTextureAsync(loadInfo);
+    }
+    VKMON_INFO("Texture reload queued: " + filename + " (" +
+               std::to_string(tiers.size()) + " tier(s))");
+}
+
+void AssetManager::handleAssetFileChanged(const std::string& relativePath) {
+    constexpr const char* TEXTURE_PREFIX = "textures/";
+    constexpr const char* MODEL_PREFIX = "models/";
+
+    if (relativePath.rfind(TEXTURE_PREFIX, 0) == 0) {
+        std::string filename = relativePath.substr(std::string(TEXTURE_PREFIX).size());
+        reloadTexture(filename);
+
+        // Materials select textures by bindless slot, so dependent models
+        // need no reload of their own - log them for visibility
+        auto dependents = getDependentModels(relativePath);
+        for (const auto& model : dependents) {
+            VKMON_DEBUG("  Texture used by model: " + model);
+        }
+    } else if (relativePath.rfind(MODEL_PREFIX, 0) == 0) {
+        std::string filename = relativePath.substr(std::string(MODEL_PREFIX).size());
+        if (modelReloadHandler_) {
+            VKMON_INFO("Model changed on disk, reloading: " + filename);
+            modelReloadHandler_(filename);
+        } else {
+            VKMON_WARNING("Model changed on disk but no reload handler installed: " + filename);
+        }
+    } else {
+        VKMON_DEBUG("Ignoring changed asset outside reload scope: " + relativePath);
+    }
+}
+
+void AssetManager::setTextureMemoryBudget(size_t bytes) {
+    textureMemoryBudget_ = bytes;
+    if (bytes == 0) {
+        VKMON_INFO("Texture memory budget disabled");
+        return;
+    }
+    VKMON_INFO("Texture memory budget set to " + std::to_string(bytes / (1024 * 1024)) + " MB");
+    enforceTextureBudget();
+}
+
+uint32_t AssetManager::mipDropForDistance(float distance) {
+    if (distance < STREAM_NEAR_DISTANCE) return 0;
+    if (distance < STREAM_MID_DISTANCE) return 1;
+    if (distance < STREAM_FAR_DISTANCE) return 2;
+    return 3;
+}
+
+uint32_t AssetManager::streamTextureForDistance(const std::string& filename, float distance) {
+    uint32_t desiredDrop = mipDropForDistance(distance);
+    auto& state = streamedTextures_[filename];
+
+    // Promote a finished stream to resident, releasing the old tier so
+    // the memory budget can reclaim it
+    if (state.inFlightDrop != StreamedTextureState::NO_TIER) {
+        if (state.inFlight.isReady()) {
+            if (state.resident) {
+                TextureLoadInfo oldTier(filename);
+                oldTier.mipDrop = state.residentDrop;
+                unloadTexture(oldTier.cacheKey());
+            }
+            state.resident = state.inFlight.get();
+            state.residentDrop = state.inFlightDrop;
+            state.inFlight = AsyncTextureLoad{};
+            state.inFlightDrop = StreamedTextureState::NO_TIER;
+        } else if (state.inFlight.hasFailed()) {
+            // Keep whatever tier is resident; retry on the next tier change
+            state.inFlight = AsyncTextureLoad{};
+            state.inFlightDrop = StreamedTextureState::NO_TIER;
+        }
+    }
+
+    // Kick a stream when the viewer wants a different tier than what is
+    // resident and nothing is already in flight
+    if (desiredDrop != state.residentDrop &&
+        state.inFlightDrop == StreamedTextureState::NO_TIER) {
+        TextureLoadInfo tier(filename);
+        tier.mipDrop = desiredDrop;
+        state.inFlight = loadTextureAsync(tier);
+        state.inFlightDrop = desiredDrop;
+    }
+
+    // Best resident tier, or the async placeholder (default texture)
+    // until the first tier lands
+    return state.resident ? state.resident->bindlessIndex : state.inFlight.getBindlessIndex();
+}
+
+void AssetManager::enforceTextureBudget() {
+    if (textureMemoryBudget_ == 0) {
+        return;
+    }
+
+    // Pick victims under the lock, destroy outside it
+    std::vector<std::shared_ptr<LoadedTexture>> evicted;
+    {
+        std::unique_lock<std::shared_mutex> lock(textureCacheMutex_);
+
+        size_t resident = 0;
+        for (const auto& [filename, texture] : textureCache_) {
+            resident += textureBytes(*texture);
+        }
+        if (resident <= textureMemoryBudget_) {
+            return;
+        }
+
+        // Only unreferenced textures are candidates; evict the ones with
+        // the oldest use stamps first
+        std::vector<std::pair<uint64_t, std::string>> candidates;
+        for (const auto& [filename, texture] : textureCache_) {
+            if (texture->referenceCount == 0) {
+                candidates.emplace_back(texture->lastUsedTick.load(), filename);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (const auto& [tick, filename] : candidates) {
+            if (resident <= textureMemoryBudget_) {
+                break;
+            }
+            auto it = textureCache_.find(filename);
+            size_t bytes = textureBytes(*it->second);
+            resident -= bytes;
+            bytesEvicted_ += bytes;
+            texturesEvicted_++;
+            evicted.push_back(it->second);
+            textureCache_.erase(it);
+        }
+
+        if (resident > textureMemoryBudget_) {
+            VKMON_WARNING("Texture cache over budget (" + std::to_string(resident) +
+                         " bytes) with no unreferenced textures left to evict");
+        }
+    }
+
+    if (evicted.empty()) {
+        return;
+    }
+
+    // Same upload safety rule as clearTextureCache: never destroy an
+    // image a staging copy may still be writing
+    if (transferManager_) {
+        transferManager_->waitForAllUploads();
+    }
+    for (const auto& texture : evicted) {
+        if (texture->sampler != VK_NULL_HANDLE) {
+            vkDestroySampler(device_, texture->sampler, nullptr);
+        }
+        VKMON_INFO("Texture evicted (LRU): " + texture->filename + " (" +
+                   std::to_string(textureBytes(*texture)) + " bytes)");
+    }
+}
+
 size_t AssetManager::getTotalTextureMemory() const {
     std::shared_lock<std::shared_mutex> lock(textureCacheMutex_);
     size_t total = 0;
@@ -411,7 +1102,20 @@ void AssetManager::printAssetSummary() const {
     }
 
     VKMON_INFO("Loaded Textures: " + std::to_string(textureCount));
-    VKMON_INFO("Texture Memory: " + std::to_string(getTotalTextureMemory()) + " bytes");
+
+    // Residency statistics
+    size_t residentBytes = getTotalTextureMemory();
+    if (textureMemoryBudget_ > 0) {
+        VKMON_INFO("Texture Memory: " + std::to_string(residentBytes) + " / " +
+                   std::to_string(textureMemoryBudget_) + " bytes budget");
+    } else {
+        VKMON_INFO("Texture Memory: " + std::to_string(residentBytes) + " bytes (no budget)");
+    }
+    {
+        std::shared_lock<std::shared_mutex> lock(textureCacheMutex_);
+        VKMON_INFO("Texture Evictions: " + std::to_string(texturesEvicted_) + " (" +
+                   std::to_string(bytesEvicted_) + " bytes reclaimed)");
+    }
     
     if (resourceManager_) {
         resourceManager_->printResourceSummary();
@@ -1,7 +1,11 @@
 #pragma once
 
 #include "../rendering/ResourceManager.h"
+#include "../rendering/TransferManager.h"
+#include "../utils/JobSystem.h"
 #include "../utils/Logger.h"
+#include "../utils/Task.h"
+#include "AssetPack.h"
 #include <vulkan/vulkan.h>
 #include <string>
 #include <unordered_map>
@@ -9,6 +13,10 @@
 #include <functional>
 #include <shared_mutex>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
 
 /**
  * VulkanMon Asset Loading Pipeline
@@ -55,12 +63,22 @@ struct TextureLoadInfo {
     VkFilter minFilter = VK_FILTER_LINEAR;
     VkSamplerAddressMode addressMode = VK_SAMPLER_ADDRESS_MODE_REPEAT;
     std::string debugName;
-    
+
+    // Halve the decoded image this many times (box filter) before upload.
+    // Distance streaming uses this to keep only low-resolution tiers
+    // resident for far-away entities; 0 uploads full resolution.
+    uint32_t mipDrop = 0;
+
     TextureLoadInfo(const std::string& file) : filename(file) {
         // Generate debug name from filename
         size_t lastSlash = file.find_last_of("/\\");
         debugName = (lastSlash != std::string::npos) ? file.substr(lastSlash + 1) : file;
     }
+
+    // Cache identity - each mip tier of a file is its own cache entry
+    std::string cacheKey() const {
+        return (mipDrop == 0) ? filename : filename + "#drop" + std::to_string(mipDrop);
+    }
 };
 
 /**
@@ -70,8 +88,11 @@ struct LoadedTexture {
     std::unique_ptr<ManagedImage> image;
     VkSampler sampler = VK_NULL_HANDLE;
     uint32_t width, height;
+    VkFormat format = VK_FORMAT_R8G8B8A8_SRGB;  // actual GPU format (BC for cooked textures)
+    uint32_t bindlessIndex = 0;  // slot in the renderer's global texture array
     std::string filename;
     std::atomic<size_t> referenceCount = 0;
+    std::atomic<uint64_t> lastUsedTick = 0;  // monotonic use stamp for LRU eviction
     
     LoadedTexture(std::unique_ptr<ManagedImage> img, VkSampler samp, 
                   uint32_t w, uint32_t h, const std::string& file)
@@ -84,6 +105,74 @@ struct LoadedTexture {
     }
 };
 
+/**
+ * Handle to a texture being loaded on the background loader pool
+ *
+ * Returned immediately by AssetManager::loadTextureAsync. get() yields
+ * nullptr until the decode and GPU upload finish; consumers rendering
+ * through the bindless array can use getBindlessIndex() meanwhile, which
+ * resolves to slot 0 (the default texture) as the placeholder.
+ */
+class AsyncTextureLoad {
+public:
+    AsyncTextureLoad() = default;
+
+    /// true once the texture is uploaded and cached
+    bool isReady() const { return state_ && state_->ready; }
+
+    /// true if decoding or upload failed; the placeholder stays in use
+    bool hasFailed() const { return state_ && state_->failed; }
+
+    /// Loaded texture, or nullptr while still loading or after failure
+    std::shared_ptr<LoadedTexture> get() const {
+        return isReady() ? state_->texture : nullptr;
+    }
+
+    /// Bindless array slot: the real texture once ready, the default
+    /// texture (slot 0) as placeholder until then
+    uint32_t getBindlessIndex() const {
+        auto texture = get();
+        return texture ? texture->bindlessIndex : 0;
+    }
+
+    /**
+     * co_await support: suspends the coroutine until the load settles,
+     * then resumes it on the main thread (at the MainThreadTaskQueue
+     * pump, after processCompletedTextureLoads has published the
+     * texture). Yields the loaded texture, or nullptr on failure -
+     * awaiting never throws, matching get().
+     */
+    auto operator co_await() const {
+        struct Awaiter {
+            std::shared_ptr<State> state;
+
+            bool await_ready() const {
+                return !state || state->ready || state->failed;
+            }
+            void await_suspend(std::coroutine_handle<> handle) const {
+                auto s = state;
+                MainThreadTaskQueue::getInstance().postWhen(
+                    [s] { return s->ready.load() || s->failed.load(); }, handle);
+            }
+            std::shared_ptr<LoadedTexture> await_resume() const {
+                return (state && state->ready) ? state->texture : nullptr;
+            }
+        };
+        return Awaiter{state_};
+    }
+
+private:
+    friend class AssetManager;
+
+    struct State {
+        std::atomic<bool> ready{false};
+        std::atomic<bool> failed{false};
+        std::shared_ptr<LoadedTexture> texture;
+    };
+
+    std::shared_ptr<State> state_;
+};
+
 /**
  * Asset Manager - Central hub for all asset loading and management
  */
@@ -104,6 +193,30 @@ public:
     std::shared_ptr<LoadedTexture> loadTexture(const TextureLoadInfo& loadInfo);
     std::shared_ptr<LoadedTexture> loadTexture(const std::string& filename);
     void unloadTexture(const std::string& filename);
+
+    /**
+     * Load a texture without blocking the caller
+     *
+     * File I/O and STB decode run on a small worker pool; the GPU image
+     * is created and uploaded (through the transfer queue when wired) on
+     * the next processCompletedTextureLoads() call. Cache hits resolve
+     * immediately, and concurrent requests for the same file share one
+     * decode.
+     *
+     * @param loadInfo Texture load configuration
+     * @return Handle that becomes ready once the texture is usable
+     */
+    AsyncTextureLoad loadTextureAsync(const TextureLoadInfo& loadInfo);
+    AsyncTextureLoad loadTextureAsync(const std::string& filename);
+
+    /**
+     * Finalize textures decoded by the loader pool
+     *
+     * Creates GPU images, submits uploads, and publishes the results to
+     * the cache and bindless array. Called once per frame from the
+     * renderer so all Vulkan work stays on the main thread.
+     */
+    void processCompletedTextureLoads();
     
     // Shader loading and compilation
     std::vector<char> loadShaderBytecode(const std::string& filename);
@@ -117,6 +230,113 @@ public:
     
     // Cache management
     void clearTextureCache();
+
+    // Hot reload support (see AssetWatcher)
+    // A changed file on disk flows: AssetWatcher poll thread -> Application
+    // drains per frame -> handleAssetFileChanged -> only the affected cache
+    // entries reload through the existing async loader. Everything below
+    // runs on the main thread, like the streaming and model caches.
+
+    /**
+     * Record that a model consumes another asset
+     *
+     * ModelLoader calls this while resolving material textures, building
+     * the dependency table hot reload consults: when a texture changes on
+     * disk, the table names the models whose materials reference it.
+     *
+     * @param dependencyPath Consumed asset relative to the assets root
+     *        (e.g. "textures/creature.png")
+     * @param consumerModel Model filename relative to assets/models/
+     */
+    void recordAssetDependency(const std::string& dependencyPath,
+                               const std::string& consumerModel);
+
+    /// Models recorded as consumers of the given asset (may be empty)
+    std::vector<std::string> getDependentModels(const std::string& dependencyPath) const;
+
+    /**
+     * Reload a texture from disk into its existing bindless slots
+     *
+     * Every cached tier of the file (base entry plus any streamed mip
+     * drops) is retired and re-issued through the async loader. When the
+     * replacement finishes, finalizeLoadedTexture writes it into the
+     * tier's old bindless slot in place, so materials and draws that
+     * captured the slot index pick up the new pixels with no rebind and
+     * no dependent-model reload. Uncached textures are ignored - nothing
+     * references them yet.
+     *
+     * @param filename Texture path relative to assets/textures/
+     */
+    void reloadTexture(const std::string& filename);
+
+    /**
+     * Route a changed asset file to the matching reload path
+     *
+     * Textures reload in place (see reloadTexture); model changes are
+     * forwarded to the model reload handler so the renderer can drop the
+     * cached geometry and let the next frame's ensureMeshLoaded re-cook
+     * and re-upload it.
+     *
+     * @param relativePath Forward-slash path relative to the assets root
+     */
+    void handleAssetFileChanged(const std::string& relativePath);
+
+    /**
+     * Install the renderer's in-place bindless slot updater
+     *
+     * Companion to setBindlessTextureRegistrar: instead of allocating a
+     * new slot, the updater overwrites an existing one, which is what
+     * lets texture reload keep every material's recorded index valid.
+     */
+    void setBindlessTextureUpdater(std::function<void(uint32_t, VkImageView, VkSampler)> updater) {
+        bindlessUpdater_ = std::move(updater);
+    }
+
+    /// Called with the model filename (relative to assets/models/) when a
+    /// watched model file changes on disk
+    void setModelReloadHandler(std::function<void(const std::string&)> handler) {
+        modelReloadHandler_ = std::move(handler);
+    }
+
+    const std::string& getAssetsRootPath() const { return assetsRootPath_; }
+
+    /**
+     * Cap resident texture memory
+     *
+     * When a load pushes the cache past the budget, unreferenced textures
+     * (referenceCount == 0) are evicted least-recently-used first until
+     * the cache fits again. Referenced textures are never evicted, so the
+     * cache may exceed the budget while everything is in use. Zero
+     * disables the budget (the default, preserving unbounded caching).
+     *
+     * @param bytes Budget in bytes of decoded RGBA texture data
+     */
+    void setTextureMemoryBudget(size_t bytes);
+    size_t getTextureMemoryBudget() const { return textureMemoryBudget_; }
+
+    // Distance-based texture streaming
+    // Callers with a camera distance (the render systems already compute
+    // one per entity for LOD selection) feed it in every frame; the
+    // returned bindless slot is the best tier currently resident, with
+    // better tiers streaming in through the async loader as the camera
+    // approaches. Tier changes release the previous tier so the memory
+    // budget can reclaim it. Main thread only, like the model cache.
+    static constexpr float STREAM_NEAR_DISTANCE = 25.0f;  // full resolution inside this
+    static constexpr float STREAM_MID_DISTANCE = 75.0f;   // one mip dropped
+    static constexpr float STREAM_FAR_DISTANCE = 150.0f;  // two dropped; beyond: three
+
+    // Tier mapping, pure for testability
+    static uint32_t mipDropForDistance(float distance);
+
+    /**
+     * Resolve a texture's bindless slot for a viewer at the given distance
+     *
+     * @param filename Texture path relative to assets/textures/
+     * @param distance Camera-to-entity distance in world units
+     * @return Bindless array slot of the sharpest resident tier, or the
+     *         default texture (slot 0) until any tier finishes loading
+     */
+    uint32_t streamTextureForDistance(const std::string& filename, float distance);
     size_t getTextureCount() const {
         std::shared_lock<std::shared_mutex> lock(textureCacheMutex_);
         return textureCache_.size();
@@ -127,6 +347,61 @@ public:
     void printAssetSummary() const;
     void enablePerformanceLogging(bool enable) { performanceLogging_ = enable; }
 
+    // Async upload path - when set, texture pixel data goes through the
+    // shared staging ring on the transfer queue instead of a blocking
+    // single-use command buffer per texture
+    /**
+     * Install the renderer's bindless texture registrar
+     *
+     * When set, every loaded texture is written into the global bindless
+     * array and its slot recorded in LoadedTexture::bindlessIndex, so
+     * draws can select it by index instead of a descriptor rebind.
+     *
+     * @param registrar Callable returning the assigned array slot
+     */
+    void setBindlessTextureRegistrar(std::function<uint32_t(VkImageView, VkSampler)> registrar) {
+        bindlessRegistrar_ = std::move(registrar);
+    }
+
+    void setTransferManager(std::shared_ptr<TransferManager> transferManager) {
+        transferManager_ = std::move(transferManager);
+    }
+
+    /**
+     * Mount a packed asset archive
+     *
+     * Once mounted, asset lookups check the pack before the filesystem,
+     * so shipped builds read everything from one mapped file while loose
+     * files keep working for development. Mount before any loads start:
+     * the loader pool reads the pack without locking.
+     *
+     * The constructor mounts "<assetsRoot>.vkpack" automatically when it
+     * exists (e.g. "assets.vkpack" next to "assets/").
+     *
+     * @param packPath Archive produced by AssetPack::buildFromDirectory
+     * @return true when the pack validated and is now active
+     */
+    bool mountAssetPack(const std::string& packPath);
+    bool hasAssetPack() const { return assetPack_ && assetPack_->isOpen(); }
+
+    /**
+     * GPU-compressed texture support (BC formats in KTX2 containers)
+     *
+     * The cook step is external tooling (toktx, compressonator): it writes
+     * a "<name>.ktx2" sibling next to each source image, BC7 for color and
+     * BC5 for normal maps. When that sibling exists and the device samples
+     * the format, the loader uploads the compressed blocks directly -
+     * no decode, quarter the memory of RGBA8. Otherwise the loose
+     * PNG/JPG path is used unchanged, so uncooked assets keep working
+     * during development.
+     */
+
+    /// "textures/creature.png" -> "textures/creature.ktx2"
+    static std::string compressedVariantPath(const std::string& filename);
+
+    /// true when the device can sample the format with optimal tiling
+    bool isCompressedFormatSupported(VkFormat format) const;
+
 private:
     // Core Vulkan objects
     VkDevice device_;
@@ -140,6 +415,9 @@ private:
     
     // Resource management
     std::unique_ptr<ResourceManager> resourceManager_;
+    std::unique_ptr<AssetPack> assetPack_;  // optional, see mountAssetPack
+    std::shared_ptr<TransferManager> transferManager_;  // optional, see setTransferManager
+    std::function<uint32_t(VkImageView, VkSampler)> bindlessRegistrar_;  // optional, see setBindlessTextureRegistrar
     
     // Asset caches
     std::unordered_map<std::string, std::shared_ptr<LoadedTexture>> textureCache_;
@@ -147,14 +425,102 @@ private:
     
     // Configuration
     bool performanceLogging_ = true;
+
+    // Texture residency budget state (see setTextureMemoryBudget). The
+    // eviction counters are written under the cache's unique lock and
+    // reported by printAssetSummary.
+    size_t textureMemoryBudget_ = 0;  // bytes; 0 = unlimited
+    std::atomic<uint64_t> textureUseTick_{1};
+    size_t texturesEvicted_ = 0;
+    size_t bytesEvicted_ = 0;
     
+    // Async texture loading state: jobs flow to the worker pool, decoded
+    // pixels flow back to the main thread for GPU finalization
+    struct TextureLoadJob {
+        TextureLoadInfo loadInfo;
+        std::shared_ptr<AsyncTextureLoad::State> state;
+    };
+    struct DecodedTexture {
+        TextureLoadInfo loadInfo;
+        std::shared_ptr<AsyncTextureLoad::State> state;
+        std::unique_ptr<unsigned char, void (*)(void*)> pixels{nullptr, nullptr};
+        uint32_t width = 0;
+        uint32_t height = 0;
+        VkFormat format = VK_FORMAT_R8G8B8A8_SRGB;
+        size_t byteSize = 0;
+    };
+    std::deque<DecodedTexture> completedTextureLoads_;
+    std::unordered_map<std::string, std::shared_ptr<AsyncTextureLoad::State>> pendingTextureLoads_;
+    std::mutex asyncLoadMutex_;
+    std::condition_variable decodeJobsDone_;
+    size_t activeDecodeJobs_ = 0;      // Decode jobs queued or running on the shared JobSystem
+    bool loaderStopRequested_ = false;
+
+    void stopLoaderPool();
+    void decodeTexture(TextureLoadJob job);
+
+    // Distance streaming state, one entry per streamed base texture
+    struct StreamedTextureState {
+        static constexpr uint32_t NO_TIER = UINT32_MAX;
+        uint32_t residentDrop = NO_TIER;
+        uint32_t inFlightDrop = NO_TIER;
+        std::shared_ptr<LoadedTexture> resident;
+        AsyncTextureLoad inFlight;
+    };
+    std::unordered_map<std::string, StreamedTextureState> streamedTextures_;
+
+    // Hot reload state (main thread only). The dependency table has its
+    // own mutex because model loads may record entries from preload jobs.
+    std::unordered_map<std::string, std::vector<std::string>> assetDependents_;
+    mutable std::mutex assetDependentsMutex_;
+    std::function<void(uint32_t, VkImageView, VkSampler)> bindlessUpdater_;  // optional, see setBindlessTextureUpdater
+    std::function<void(const std::string&)> modelReloadHandler_;  // optional, see setModelReloadHandler
+    // Cache key -> bindless slot the replacement must land in
+    std::unordered_map<std::string, uint32_t> pendingSlotReuse_;
+    // Retired entries held alive until their replacement publishes, so
+    // the slot never points at a destroyed image view mid-reload
+    std::unordered_map<std::string, std::shared_ptr<LoadedTexture>> retiredTextures_;
+
     // Helper methods
     void initializeAssetDirectories();
     std::string getAssetTypeDirectory(AssetType type) const;
-    
+
     // Texture loading helpers
-    std::unique_ptr<ManagedImage> createTextureImage(const std::string& filename, uint32_t& width, uint32_t& height);
+    std::unique_ptr<ManagedImage> createTextureImage(const TextureLoadInfo& loadInfo, uint32_t& width, uint32_t& height);
+    std::unique_ptr<ManagedImage> createTextureImageFromPixels(const unsigned char* pixels,
+                                                               uint32_t width, uint32_t height,
+                                                               const std::string& filename);
+    std::unique_ptr<ManagedImage> createTextureImageFromBytes(const unsigned char* data,
+                                                              VkDeviceSize size, VkFormat format,
+                                                              uint32_t width, uint32_t height,
+                                                              const std::string& filename);
+    // Cooked compressed texture, read off disk or pack; data is the base
+    // mip level's BC blocks ready for direct upload
+    struct CompressedPixels {
+        VkFormat format = VK_FORMAT_UNDEFINED;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::vector<unsigned char> data;
+    };
+    bool tryLoadCompressedTexture(const TextureLoadInfo& loadInfo, CompressedPixels& out) const;
+    std::shared_ptr<LoadedTexture> finalizeLoadedTexture(const TextureLoadInfo& loadInfo,
+                                                         std::unique_ptr<ManagedImage> image,
+                                                         uint32_t width, uint32_t height);
     VkSampler createTextureSampler(const TextureLoadInfo& loadInfo);
+    void enforceTextureBudget();
+    static size_t textureBytes(const LoadedTexture& texture) {
+        switch (texture.format) {
+            case VK_FORMAT_BC5_UNORM_BLOCK:
+            case VK_FORMAT_BC5_SNORM_BLOCK:
+            case VK_FORMAT_BC7_UNORM_BLOCK:
+            case VK_FORMAT_BC7_SRGB_BLOCK:
+                // 16-byte 4x4 blocks - one byte per texel
+                return static_cast<size_t>((texture.width + 3) / 4) *
+                       ((texture.height + 3) / 4) * 16;
+            default:
+                return static_cast<size_t>(texture.width) * texture.height * 4; // decoded RGBA
+        }
+    }
     void transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout);
     void copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height);
     VkCommandBuffer beginSingleTimeCommands();
@@ -162,6 +528,9 @@ private:
     
     // File system helpers
     bool fileExists(const std::string& path) const;
+    // Pack lookup for a full asset path; nullptr when no pack is mounted
+    // or the entry is missing (the filesystem path is then used)
+    const unsigned char* findPackedAsset(const std::string& fullPath, size_t& size) const;
     std::string getFileExtension(const std::string& filename) const;
 };
 
@@ -0,0 +1,227 @@
+#include "AssetPack.h"
+#include "../utils/Logger.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace VulkanMon {
+
+namespace {
+
+// On-disk layout: header, entry table, path string table, data blobs.
+// Like the .vkmesh sidecars this is a local artifact written and read on
+// the same machine; a mismatched file fails validation and the loader
+// falls back to loose files.
+constexpr char VKPACK_MAGIC[8] = {'V', 'K', 'P', 'A', 'C', 'K', '\0', '\0'};
+
+struct VkPackHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t entryCount;
+    uint64_t pathTableOffset;  // NUL-terminated strings, one per entry
+    uint64_t pathTableSize;
+};
+
+struct VkPackEntry {
+    uint64_t pathHash;          // FNV-1a 64 of the normalized relative path
+    uint64_t pathOffset;        // into the path table, for collision verification
+    uint64_t dataOffset;        // from the start of the file
+    uint64_t dataSize;          // bytes as stored
+    uint64_t uncompressedSize;  // equals dataSize while only Store exists
+    uint32_t compression;       // AssetPack::Compression
+    uint32_t reserved;
+};
+
+} // namespace
+
+std::string AssetPack::normalizePath(std::string path) {
+    std::replace(path.begin(), path.end(), '\\', '/');
+    return path;
+}
+
+uint64_t AssetPack::hashPath(const std::string& normalizedPath) {
+    // FNV-1a 64-bit: simple, fast, and stable across platforms
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : normalizedPath) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool AssetPack::open(const std::string& packPath) {
+    entries_.clear();
+    if (!mapped_.open(packPath)) {
+        return false;
+    }
+
+    if (mapped_.size() < sizeof(VkPackHeader)) {
+        VKMON_WARNING("Asset pack too small to be valid: " + packPath);
+        mapped_.close();
+        return false;
+    }
+
+    VkPackHeader header{};
+    std::memcpy(&header, mapped_.data(), sizeof(header));
+    if (std::memcmp(header.magic, VKPACK_MAGIC, sizeof(VKPACK_MAGIC)) != 0 ||
+        header.version != VKPACK_VERSION) {
+        VKMON_WARNING("Asset pack failed validation: " + packPath);
+        mapped_.close();
+        return false;
+    }
+
+    size_t tableBytes = static_cast<size_t>(header.entryCount) * sizeof(VkPackEntry);
+    if (sizeof(VkPackHeader) + tableBytes > mapped_.size() ||
+        header.pathTableOffset + header.pathTableSize > mapped_.size()) {
+        VKMON_WARNING("Asset pack index out of bounds: " + packPath);
+        mapped_.close();
+        return false;
+    }
+
+    const char* pathTable = reinterpret_cast<const char*>(mapped_.data() + header.pathTableOffset);
+    entries_.reserve(header.entryCount);
+
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        VkPackEntry packed{};
+        std::memcpy(&packed, mapped_.data() + sizeof(VkPackHeader) + i * sizeof(VkPackEntry),
+                    sizeof(packed));
+
+        if (packed.dataOffset + packed.dataSize > mapped_.size() ||
+            packed.pathOffset >= header.pathTableSize ||
+            packed.compression != static_cast<uint32_t>(Compression::Store)) {
+            VKMON_WARNING("Asset pack entry " + std::to_string(i) + " is invalid: " + packPath);
+            mapped_.close();
+            entries_.clear();
+            return false;
+        }
+
+        Entry entry;
+        entry.dataOffset = packed.dataOffset;
+        entry.dataSize = packed.dataSize;
+        entry.path = std::string(pathTable + packed.pathOffset,
+                                 strnlen(pathTable + packed.pathOffset,
+                                         header.pathTableSize - packed.pathOffset));
+        entries_.emplace(packed.pathHash, std::move(entry));
+    }
+
+    VKMON_INFO("Asset pack mounted: " + packPath + " (" +
+               std::to_string(entries_.size()) + " entries)");
+    return true;
+}
+
+bool AssetPack::contains(const std::string& relativePath) const {
+    size_t size = 0;
+    return find(relativePath, size) != nullptr;
+}
+
+const unsigned char* AssetPack::find(const std::string& relativePath, size_t& size) const {
+    if (!mapped_.isValid()) {
+        return nullptr;
+    }
+
+    std::string normalized = normalizePath(relativePath);
+    auto it = entries_.find(hashPath(normalized));
+    if (it == entries_.end() || it->second.path != normalized) {
+        return nullptr;
+    }
+
+    size = static_cast<size_t>(it->second.dataSize);
+    return mapped_.data() + it->second.dataOffset;
+}
+
+bool AssetPack::buildFromDirectory(const std::string& rootPath, const std::string& packPath) {
+    namespace fs = std::filesystem;
+
+    std::error_code ec;
+    if (!fs::is_directory(rootPath, ec)) {
+        VKMON_ERROR("Asset pack source is not a directory: " + rootPath);
+        return false;
+    }
+
+    // Collect every regular file with its path relative to the root
+    struct PendingEntry {
+        std::string relativePath;
+        fs::path sourcePath;
+        uint64_t size;
+    };
+    std::vector<PendingEntry> pending;
+    for (const auto& item : fs::recursive_directory_iterator(rootPath, ec)) {
+        if (!item.is_regular_file(ec)) {
+            continue;
+        }
+        PendingEntry entry;
+        entry.relativePath = normalizePath(
+            fs::relative(item.path(), rootPath, ec).generic_string());
+        entry.sourcePath = item.path();
+        entry.size = static_cast<uint64_t>(item.file_size(ec));
+        pending.push_back(std::move(entry));
+    }
+
+    if (pending.empty()) {
+        VKMON_WARNING("No files to pack under: " + rootPath);
+        return false;
+    }
+
+    // Lay out the file: header, entry table, path table, then data blobs
+    std::string pathTable;
+    std::vector<VkPackEntry> table(pending.size());
+    uint64_t pathTableOffset = sizeof(VkPackHeader) + pending.size() * sizeof(VkPackEntry);
+
+    for (size_t i = 0; i < pending.size(); ++i) {
+        table[i].pathHash = hashPath(pending[i].relativePath);
+        table[i].pathOffset = pathTable.size();
+        table[i].dataSize = pending[i].size;
+        table[i].uncompressedSize = pending[i].size;
+        table[i].compression = static_cast<uint32_t>(Compression::Store);
+        pathTable += pending[i].relativePath;
+        pathTable += '\0';
+    }
+
+    uint64_t dataOffset = pathTableOffset + pathTable.size();
+    for (size_t i = 0; i < pending.size(); ++i) {
+        table[i].dataOffset = dataOffset;
+        dataOffset += pending[i].size;
+    }
+
+    std::ofstream out(packPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        VKMON_ERROR("Cannot write asset pack: " + packPath);
+        return false;
+    }
+
+    VkPackHeader header{};
+    std::memcpy(header.magic, VKPACK_MAGIC, sizeof(VKPACK_MAGIC));
+    header.version = VKPACK_VERSION;
+    header.entryCount = static_cast<uint32_t>(pending.size());
+    header.pathTableOffset = pathTableOffset;
+    header.pathTableSize = pathTable.size();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(table.data()),
+              static_cast<std::streamsize>(table.size() * sizeof(VkPackEntry)));
+    out.write(pathTable.data(), static_cast<std::streamsize>(pathTable.size()));
+
+    for (const auto& entry : pending) {
+        std::ifstream in(entry.sourcePath, std::ios::binary);
+        if (!in.is_open()) {
+            VKMON_ERROR("Cannot read file for packing: " + entry.sourcePath.string());
+            out.close();
+            fs::remove(packPath, ec);
+            return false;
+        }
+        out << in.rdbuf();
+    }
+
+    if (!out) {
+        VKMON_ERROR("Failed writing asset pack, removing partial file: " + packPath);
+        out.close();
+        fs::remove(packPath, ec);
+        return false;
+    }
+
+    VKMON_INFO("Asset pack written: " + packPath + " (" +
+               std::to_string(pending.size()) + " entries)");
+    return true;
+}
+
+} // namespace VulkanMon
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "MappedFile.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * VulkanMon Asset Pack Archive
+ *
+ * Single-file asset archive for shipped builds following our philosophy:
+ * - "Simple is Powerful" - one mapped file, one hash lookup per asset
+ * - "Test, Test, Test" - corrupt packs fail to mount, never crash
+ * - "Document Often" - on-disk layout documented next to the structs
+ *
+ * Cold-start loads over thousands of small files are dominated by
+ * open/seek syscalls. A pack replaces them with one open: the archive is
+ * memory-mapped and every entry resolves through a hash-indexed table of
+ * contents to a pointer into the mapping. AssetManager consults a mounted
+ * pack before the filesystem, so development builds keep working from
+ * loose files while shipped builds read everything from the archive.
+ *
+ * The format reserves a per-entry compression field; all entries are
+ * currently stored uncompressed (Store) until a compressor dependency is
+ * worth adding.
+ */
+
+namespace VulkanMon {
+
+class AssetPack {
+public:
+    static constexpr uint32_t VKPACK_VERSION = 1;
+
+    // Per-entry compression methods; only Store is implemented
+    enum class Compression : uint32_t {
+        Store = 0
+    };
+
+    AssetPack() = default;
+
+    // Move-only semantics - wraps a single file mapping
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+    AssetPack(AssetPack&&) = default;
+    AssetPack& operator=(AssetPack&&) = default;
+
+    // Mount an archive. Returns false when the file is missing or fails
+    // validation; the pack is then unusable and contains() returns false.
+    bool open(const std::string& packPath);
+
+    // Lookups take paths relative to the assets root ("textures/grass.png").
+    // Lookup is lock-free and the returned pointer stays valid for the
+    // lifetime of the pack, so worker threads may read concurrently.
+    bool contains(const std::string& relativePath) const;
+    const unsigned char* find(const std::string& relativePath, size_t& size) const;
+
+    size_t entryCount() const { return entries_.size(); }
+    bool isOpen() const { return mapped_.isValid(); }
+
+    // Path normalization and hashing used by both the builder and the
+    // runtime lookup: backslashes become forward slashes, then FNV-1a 64
+    static std::string normalizePath(std::string path);
+    static uint64_t hashPath(const std::string& normalizedPath);
+
+    // Pack every regular file under rootPath (recursively, paths stored
+    // relative to it) into a new archive. This is the cook step; it runs
+    // from tooling or a developer invocation, never on the hot load path.
+    static bool buildFromDirectory(const std::string& rootPath, const std::string& packPath);
+
+private:
+    struct Entry {
+        uint64_t dataOffset = 0;
+        uint64_t dataSize = 0;
+        std::string path;  // verified on lookup so hash collisions cannot alias assets
+    };
+
+    MappedFile mapped_;
+    std::unordered_map<uint64_t, Entry> entries_;
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,182 @@
+#include "AssetWatcher.h"
+#include "../utils/Logger.h"
+
+#include <algorithm>
+#include <filesystem>
+
+namespace VulkanMon {
+
+namespace {
+
+// Subdirectories that participate in hot reload
+constexpr const char* WATCHED_DIRECTORIES[] = {"textures/", "models/"};
+
+// Derived or transient files that must never trigger a reload: cooked
+// mesh sidecars and compiled shaders are written by the engine itself
+// (watching them would reload every model twice), and editors drop
+// temporary files mid-save
+constexpr const char* IGNORED_EXTENSIONS[] = {".vkmesh", ".spv", ".tmp"};
+
+} // namespace
+
+AssetWatcher::AssetWatcher(std::string rootPath, std::chrono::milliseconds pollInterval)
+    : rootPath_(std::move(rootPath))
+    , pollInterval_(pollInterval) {
+}
+
+AssetWatcher::~AssetWatcher() {
+    stop();
+}
+
+void AssetWatcher::start() {
+    if (running_) {
+        return;
+    }
+    stopRequested_ = false;
+    running_ = true;
+    pollThread_ = std::thread(&AssetWatcher::pollLoop, this);
+    VKMON_INFO("Asset watcher started on " + rootPath_ + " (" +
+               std::to_string(pollInterval_.count()) + "ms poll)");
+}
+
+void AssetWatcher::stop() {
+    if (!running_) {
+        return;
+    }
+    stopRequested_ = true;
+    if (pollThread_.joinable()) {
+        pollThread_.join();
+    }
+    running_ = false;
+    VKMON_INFO("Asset watcher stopped");
+}
+
+std::vector<std::string> AssetWatcher::drainChanges() {
+    std::lock_guard<std::mutex> lock(pendingChangesMutex_);
+    return std::move(pendingChanges_);
+}
+
+bool AssetWatcher::isWatchedFile(const std::string& relativePath) {
+    bool inWatchedDirectory = false;
+    for (const char* directory : WATCHED_DIRECTORIES) {
+        if (relativePath.rfind(directory, 0) == 0) {
+            inWatchedDirectory = true;
+            break;
+        }
+    }
+    if (!inWatchedDirectory) {
+        return false;
+    }
+
+    for (const char* extension : IGNORED_EXTENSIONS) {
+        size_t extensionLength = std::char_traits<char>::length(extension);
+        if (relativePath.size() >= extensionLength &&
+            relativePath.compare(relativePath.size() - extensionLength,
+                                 extensionLength, extension) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AssetWatcher::pollLoop() {
+    while (!stopRequested_) {
+        pollOnce();
+
+        // Sleep in short slices so stop() joins promptly even with a
+        // long poll interval
+        auto remaining = pollInterval_;
+        while (remaining.count() > 0 && !stopRequested_) {
+            auto slice = std::min(remaining, std::chrono::milliseconds(50));
+            std::this_thread::sleep_for(slice);
+            remaining -= slice;
+        }
+    }
+}
+
+void AssetWatcher::pollOnce() {
+    namespace fs = std::filesystem;
+
+    for (auto& [path, stamp] : fileStamps_) {
+        stamp.seenThisScan = false;
+    }
+
+    std::vector<std::string> stableChanges;
+
+    for (const char* directory : WATCHED_DIRECTORIES) {
+        fs::path searchPath = fs::path(rootPath_) / directory;
+        std::error_code ec;
+        if (!fs::exists(searchPath, ec)) {
+            continue;
+        }
+
+        // error_code overloads throughout: a file vanishing mid-scan
+        // (editor save-replace) is normal and must not kill the thread
+        fs::recursive_directory_iterator it(searchPath, ec);
+        fs::recursive_directory_iterator end;
+        for (; !ec && it != end; it.increment(ec)) {
+            if (!it->is_regular_file(ec)) {
+                continue;
+            }
+
+            std::string relativePath =
+                fs::relative(it->path(), rootPath_, ec).generic_string();
+            if (ec || !isWatchedFile(relativePath)) {
+                continue;
+            }
+
+            auto writeTime = fs::last_write_time(it->path(), ec);
+            if (ec) {
+                continue;
+            }
+            int64_t writeStamp =
+                static_cast<int64_t>(writeTime.time_since_epoch().count());
+
+            auto& stamp = fileStamps_[relativePath];
+            stamp.seenThisScan = true;
+
+            if (!baselineScanDone_) {
+                stamp.reportedWriteTime = writeStamp;
+                continue;
+            }
+
+            if (stamp.hasPending) {
+                if (writeStamp == stamp.pendingWriteTime) {
+                    // Write time held for a full cycle - the save finished
+                    stamp.reportedWriteTime = writeStamp;
+                    stamp.hasPending = false;
+                    stableChanges.push_back(relativePath);
+                } else {
+                    // Still being written; keep waiting for it to settle
+                    stamp.pendingWriteTime = writeStamp;
+                }
+            } else if (writeStamp != stamp.reportedWriteTime) {
+                stamp.pendingWriteTime = writeStamp;
+                stamp.hasPending = true;
+            }
+        }
+    }
+
+    // Forget deleted files without reporting them - reloading a missing
+    // asset would just replace it with the fallback
+    for (auto it = fileStamps_.begin(); it != fileStamps_.end();) {
+        if (baselineScanDone_ && !it->second.seenThisScan) {
+            it = fileStamps_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    baselineScanDone_ = true;
+
+    if (!stableChanges.empty()) {
+        std::lock_guard<std::mutex> lock(pendingChangesMutex_);
+        for (auto& path : stableChanges) {
+            if (std::find(pendingChanges_.begin(), pendingChanges_.end(), path) ==
+                pendingChanges_.end()) {
+                pendingChanges_.push_back(std::move(path));
+            }
+        }
+    }
+}
+
+} // namespace VulkanMon
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * VulkanMon Asset File Watcher
+ *
+ * Extends hot reload beyond shaders (the R key) to textures and models:
+ * a background thread polls the assets directory for modified files and
+ * the main thread drains the change list once per frame, routing each
+ * path through AssetManager::handleAssetFileChanged so only the affected
+ * cache entries reload. Artists tweak a texture and see it in seconds
+ * instead of restarting the engine.
+ *
+ * Polling was chosen over native filesystem notification APIs
+ * (ReadDirectoryChangesW, inotify) deliberately: one implementation
+ * covers Windows and Linux, std::filesystem::last_write_time is all it
+ * needs, and at the default interval a full scan of the assets tree is
+ * microseconds of background work. A modified file is reported only once
+ * its write time has held steady for a full poll cycle, so half-written
+ * saves from image editors never reach the loaders.
+ */
+
+namespace VulkanMon {
+
+class AssetWatcher {
+public:
+    /**
+     * @param rootPath Assets root to watch (e.g. "assets/")
+     * @param pollInterval Delay between filesystem scans
+     */
+    explicit AssetWatcher(std::string rootPath,
+                          std::chrono::milliseconds pollInterval = std::chrono::milliseconds(500));
+    ~AssetWatcher();
+
+    // Owns a thread - moving would leave the loop with a dangling this
+    AssetWatcher(const AssetWatcher&) = delete;
+    AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+    /// Start the background poll thread (idempotent)
+    void start();
+
+    /// Stop the poll thread and join it (idempotent, called by destructor)
+    void stop();
+
+    bool isRunning() const { return running_; }
+
+    /**
+     * Take all changes detected since the last drain
+     *
+     * Called once per frame from the main thread. Paths are relative to
+     * the assets root with forward slashes ("textures/creature.png"),
+     * matching the layout AssetManager::handleAssetFileChanged expects.
+     */
+    std::vector<std::string> drainChanges();
+
+    /**
+     * Run one scan synchronously on the caller's thread
+     *
+     * The poll thread calls this on its interval; tests call it directly
+     * to drive the stability debounce deterministically without threads.
+     */
+    void pollOnce();
+
+    /**
+     * Should a file be watched at all?
+     *
+     * Only textures/ and models/ are reload targets, and derived files
+     * the engine writes itself (.vkmesh cooks, compiled .spv) or editors
+     * leave behind (.tmp) must not trigger reload loops. Pure so the
+     * filter is testable without a filesystem.
+     *
+     * @param relativePath Forward-slash path relative to the assets root
+     */
+    static bool isWatchedFile(const std::string& relativePath);
+
+private:
+    // Last write time per watched file, plus the not-yet-reported value
+    // used for the one-cycle stability debounce
+    struct FileStamp {
+        int64_t reportedWriteTime = 0;
+        int64_t pendingWriteTime = 0;
+        bool hasPending = false;
+        bool seenThisScan = false;
+    };
+
+    void pollLoop();
+
+    std::string rootPath_;
+    std::chrono::milliseconds pollInterval_;
+
+    std::thread pollThread_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> stopRequested_{false};
+
+    // Poll-thread-only scan state; first scan seeds stamps silently so
+    // startup never reports the whole assets tree as changed
+    std::unordered_map<std::string, FileStamp> fileStamps_;
+    bool baselineScanDone_ = false;
+
+    // Changes stable for a full cycle, waiting for the main thread
+    std::vector<std::string> pendingChanges_;
+    std::mutex pendingChangesMutex_;
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * VulkanMon Read-Only File Mapping
+ *
+ * RAII wrapper over the platform file-mapping APIs (mmap on POSIX,
+ * CreateFileMapping on Windows) following our philosophy:
+ * - "Simple is Powerful" - open, read through a pointer, done
+ * - "Test, Test, Test" - failure is a false return, never a crash
+ * - "Document Often" - clear ownership and lifetime rules
+ *
+ * Used by the cooked-asset loaders to hand blob pointers straight to the
+ * GPU upload path without an intermediate heap copy. The mapping stays
+ * valid until close() or destruction, so callers must finish copying out
+ * of data() before the MappedFile goes out of scope.
+ */
+
+namespace VulkanMon {
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // Move-only semantics - the mapping has a single owner
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Map a file read-only. Returns false (leaving the object invalid) if
+    // the file is missing, empty, or the mapping fails - a missing cooked
+    // asset is a normal cache miss, not an error.
+    bool open(const std::string& path);
+    void close();
+
+    bool isValid() const { return data_ != nullptr; }
+    const unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+
+#ifdef _WIN32
+    void* fileHandle_ = nullptr;     // HANDLE from CreateFileA
+    void* mappingHandle_ = nullptr;  // HANDLE from CreateFileMappingA
+#endif
+};
+
+} // namespace VulkanMon
@@ -1,11 +1,17 @@
 #include "ModelLoader.h"
 #include "AssetManager.h"
+#include "MappedFile.h"
 #include "../utils/Logger.h"
 #include "../rendering/ResourceManager.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <unordered_map>
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 
 namespace VulkanMon {
 
@@ -51,6 +57,81 @@ std::vector<VkVertexInputAttributeDescription> ModelVertex::getAttributeDescript
     return attributeDescriptions;
 }
 
+// ============================================================================
+// Cooked Mesh Format (.vkmesh)
+// ============================================================================
+
+namespace {
+
+// On-disk layout of a .vkmesh sidecar. The file is a header, then per
+// mesh an entry header (counts plus a fixed-size material record) followed
+// by the raw vertex and index blobs in the exact ModelVertex layout, so
+// loading is sequential reads with no parsing. Cooked files are a local
+// cache written and read on the same machine - byte order and struct
+// padding are whatever the compiler produced, which is fine because a
+// mismatched file just fails validation and triggers a re-cook.
+constexpr char VKMESH_MAGIC[8] = {'V', 'K', 'M', 'E', 'S', 'H', '\0', '\0'};
+
+struct VkMeshFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t meshCount;
+    uint64_t sourceWriteTime;  // last_write_time of the source model at cook time
+    uint64_t sourceFileSize;   // byte size of the source model at cook time
+};
+
+struct VkMeshMaterialRecord {
+    char name[64];
+    float ambient[3];
+    float diffuse[3];
+    float specular[3];
+    float shininess;
+    char diffuseTexture[128];
+    char normalTexture[128];
+    char specularTexture[128];
+};
+
+struct VkMeshEntryHeader {
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    VkMeshMaterialRecord material;
+};
+
+void writeFixedString(char* dest, size_t destSize, const std::string& src) {
+    std::memset(dest, 0, destSize);
+    std::memcpy(dest, src.data(), std::min(src.size(), destSize - 1));
+}
+
+std::string readFixedString(const char* src, size_t maxSize) {
+    return std::string(src, strnlen(src, maxSize));
+}
+
+void writeVec3(float* dest, const glm::vec3& src) {
+    dest[0] = src.x;
+    dest[1] = src.y;
+    dest[2] = src.z;
+}
+
+glm::vec3 readVec3(const float* src) {
+    return glm::vec3(src[0], src[1], src[2]);
+}
+
+// Capture the source model's write time and size for cache invalidation;
+// false when the source cannot be stat'd (cooking is skipped then)
+bool readSourceStamp(const std::string& sourcePath, uint64_t& writeTime, uint64_t& fileSize) {
+    std::error_code ec;
+    auto time = std::filesystem::last_write_time(sourcePath, ec);
+    if (ec) return false;
+    auto size = std::filesystem::file_size(sourcePath, ec);
+    if (ec) return false;
+
+    writeTime = static_cast<uint64_t>(time.time_since_epoch().count());
+    fileSize = static_cast<uint64_t>(size);
+    return true;
+}
+
+} // namespace
+
 // ============================================================================
 // ModelLoader Implementation
 // ============================================================================
@@ -65,37 +146,64 @@ ModelLoader::ModelLoader(std::shared_ptr<ResourceManager> resourceManager,
 
 std::unique_ptr<Model> ModelLoader::loadModel(const std::string& filename) {
     std::string fullPath = assetManager_->getFullAssetPath(AssetType::MODEL, filename);
-    return loadModelFromFile(fullPath);
+    auto model = loadModelFromFile(fullPath);
+
+    // Feed the hot-reload dependency table: a changed texture can then be
+    // traced back to the models whose materials reference it
+    if (model) {
+        for (const auto& mesh : model->meshes) {
+            for (const std::string* texture : {&mesh->material.diffuseTexture,
+                                               &mesh->material.normalTexture,
+                                               &mesh->material.specularTexture}) {
+                if (!texture->empty()) {
+                    assetManager_->recordAssetDependency("textures/" + *texture, filename);
+                }
+            }
+        }
+    }
+    return model;
 }
 
 std::unique_ptr<Model> ModelLoader::loadModelFromFile(const std::string& fullPath) {
     auto startTime = std::chrono::high_resolution_clock::now();
     
     VKMON_INFO("Loading 3D model: " + fullPath);
-    
-    // Load model with Assimp
-    const aiScene* scene = importer_.ReadFile(fullPath, getAssimpFlags());
-    
-    if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-        std::string error = "Assimp failed to load model: " + std::string(importer_.GetErrorString());
-        VKMON_ERROR(error);
-        throw std::runtime_error(error);
+
+    // Cooked fast path: read vertex/index blobs straight from the sidecar,
+    // skipping Assimp parsing entirely
+    bool loadedFromCook = false;
+    auto model = tryLoadCookedModel(fullPath);
+    if (model) {
+        loadedFromCook = true;
+    } else {
+        // Load model with Assimp
+        const aiScene* scene = importer_.ReadFile(fullPath, getAssimpFlags());
+
+        if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+            std::string error = "Assimp failed to load model: " + std::string(importer_.GetErrorString());
+            VKMON_ERROR(error);
+            throw std::runtime_error(error);
+        }
+
+        // Extract directory for texture loading
+        std::string directory = fullPath.substr(0, fullPath.find_last_of('/'));
+
+        // Process the loaded scene
+        model = processAssimpScene(scene, directory);
+        model->filename = fullPath;
+
+        // Cook the parsed result so the next run takes the fast path
+        writeCookedModel(*model, fullPath);
     }
-    
-    // Extract directory for texture loading
-    std::string directory = fullPath.substr(0, fullPath.find_last_of('/'));
-    
-    // Process the loaded scene
-    auto model = processAssimpScene(scene, directory);
-    model->filename = fullPath;
-    
+
     // Performance logging
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration<double, std::milli>(endTime - startTime);
-    
+
     VKMON_INFO("Model loaded: " + fullPath.substr(fullPath.find_last_of('/') + 1) +
                " (" + std::to_string(model->meshCount()) + " meshes, " +
-               std::to_string(model->totalVertices()) + " vertices)");
+               std::to_string(model->totalVertices()) + " vertices" +
+               (loadedFromCook ? ", cooked" : "") + ")");
     VKMON_PERF("Model loading", duration.count());
     
     totalModelsLoaded_++;
@@ -105,14 +213,250 @@ std::unique_ptr<Model> ModelLoader::loadModelFromFile(const std::string& fullPat
     return model;
 }
 
-std::unique_ptr<Model> ModelLoader::processAssimpScene(const aiScene* scene, const std::string& directory) {
+std::unique_ptr<Model> ModelLoader::tryLoadCookedModel(const std::string& sourcePath) {
+    std::string cookedPath = cookedMeshPath(sourcePath);
+
+    // Map the sidecar instead of reading it: blob pointers go straight to
+    // the GPU upload path, so vertex and index data is copied exactly once
+    // (mapping -> pooled buffer) with no intermediate heap allocation
+    MappedFile mapped;
+    if (!mapped.open(cookedPath)) {
+        return nullptr; // Never cooked - the Assimp path will cook it
+    }
+
+    const unsigned char* cursor = mapped.data();
+    size_t remaining = mapped.size();
+    auto take = [&](void* dest, size_t bytes) {
+        if (remaining < bytes) return false;
+        std::memcpy(dest, cursor, bytes);
+        cursor += bytes;
+        remaining -= bytes;
+        return true;
+    };
+
+    VkMeshFileHeader header{};
+    if (!take(&header, sizeof(header)) ||
+        std::memcmp(header.magic, VKMESH_MAGIC, sizeof(VKMESH_MAGIC)) != 0 ||
+        header.version != VKMESH_VERSION) {
+        VKMON_WARNING("Ignoring unreadable cooked mesh, re-cooking: " + cookedPath);
+        return nullptr;
+    }
+
+    // Invalidate automatically when the source model changed since the cook
+    uint64_t sourceWriteTime = 0;
+    uint64_t sourceFileSize = 0;
+    if (!readSourceStamp(sourcePath, sourceWriteTime, sourceFileSize) ||
+        sourceWriteTime != header.sourceWriteTime ||
+        sourceFileSize != header.sourceFileSize) {
+        VKMON_INFO("Cooked mesh is stale, re-cooking: " + cookedPath);
+        return nullptr;
+    }
+
+    auto model = std::make_unique<Model>(sourcePath);
+    for (uint32_t i = 0; i < header.meshCount; ++i) {
+        VkMeshEntryHeader entry{};
+        if (!take(&entry, sizeof(entry))) {
+            VKMON_WARNING("Cooked mesh truncated, re-cooking: " + cookedPath);
+            return nullptr;
+        }
+
+        Material material(readFixedString(entry.material.name, sizeof(entry.material.name)));
+        material.ambient = readVec3(entry.material.ambient);
+        material.diffuse = readVec3(entry.material.diffuse);
+        material.specular = readVec3(entry.material.specular);
+        material.shininess = entry.material.shininess;
+        material.diffuseTexture = readFixedString(entry.material.diffuseTexture,
+                                                  sizeof(entry.material.diffuseTexture));
+        material.normalTexture = readFixedString(entry.material.normalTexture,
+                                                 sizeof(entry.material.normalTexture));
+        material.specularTexture = readFixedString(entry.material.specularTexture,
+                                                   sizeof(entry.material.specularTexture));
+
+        // Blob pointers into the mapping. Both blobs start 4-byte aligned:
+        // the mapping base is page-aligned and every preceding record size
+        // is a multiple of four.
+        size_t vertexBytes = static_cast<size_t>(entry.vertexCount) * sizeof(ModelVertex);
+        size_t indexBytes = static_cast<size_t>(entry.indexCount) * sizeof(uint32_t);
+        if (remaining < vertexBytes + indexBytes) {
+            VKMON_WARNING("Cooked mesh truncated, re-cooking: " + cookedPath);
+            return nullptr;
+        }
+        const auto* vertices = reinterpret_cast<const ModelVertex*>(cursor);
+        const auto* indices = reinterpret_cast<const uint32_t*>(cursor + vertexBytes);
+        cursor += vertexBytes + indexBytes;
+        remaining -= vertexBytes + indexBytes;
+
+        auto mesh = std::make_unique<Mesh>();
+        mesh->material = std::move(material);
+        createMeshBuffersFromBlobs(*mesh, vertices, entry.vertexCount, indices, entry.indexCount);
+        model->meshes.push_back(std::move(mesh));
+    }
+
+    return model;
+}
+
+void ModelLoader::writeCookedModel(const Model& model, const std::string& sourcePath) {
+    uint64_t sourceWriteTime = 0;
+    uint64_t sourceFileSize = 0;
+    if (!readSourceStamp(sourcePath, sourceWriteTime, sourceFileSize)) {
+        VKMON_WARNING("Cannot stat source model, skipping cook: " + sourcePath);
+        return;
+    }
+
+    std::string cookedPath = cookedMeshPath(sourcePath);
+    std::ofstream file(cookedPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        VKMON_WARNING("Cannot write cooked mesh: " + cookedPath);
+        return;
+    }
+
+    VkMeshFileHeader header{};
+    std::memcpy(header.magic, VKMESH_MAGIC, sizeof(VKMESH_MAGIC));
+    header.version = VKMESH_VERSION;
+    header.meshCount = static_cast<uint32_t>(model.meshCount());
+    header.sourceWriteTime = sourceWriteTime;
+    header.sourceFileSize = sourceFileSize;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const auto& mesh : model.meshes) {
+        VkMeshEntryHeader entry{};
+        entry.vertexCount = static_cast<uint32_t>(mesh->vertices.size());
+        entry.indexCount = static_cast<uint32_t>(mesh->indices.size());
+        writeFixedString(entry.material.name, sizeof(entry.material.name), mesh->material.name);
+        writeVec3(entry.material.ambient, mesh->material.ambient);
+        writeVec3(entry.material.diffuse, mesh->material.diffuse);
+        writeVec3(entry.material.specular, mesh->material.specular);
+        entry.material.shininess = mesh->material.shininess;
+        writeFixedString(entry.material.diffuseTexture, sizeof(entry.material.diffuseTexture),
+                         mesh->material.diffuseTexture);
+        writeFixedString(entry.material.normalTexture, sizeof(entry.material.normalTexture),
+                         mesh->material.normalTexture);
+        writeFixedString(entry.material.specularTexture, sizeof(entry.material.specularTexture),
+                         mesh->material.specularTexture);
+        file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+
+        file.write(reinterpret_cast<const char*>(mesh->vertices.data()),
+                   static_cast<std::streamsize>(mesh->vertices.size() * sizeof(ModelVertex)));
+        file.write(reinterpret_cast<const char*>(mesh->indices.data()),
+                   static_cast<std::streamsize>(mesh->indices.size() * sizeof(uint32_t)));
+    }
+
+    if (!file) {
+        // Best-effort cache: remove the partial file so the next run
+        // re-cooks instead of tripping over truncated data
+        VKMON_WARNING("Failed to write cooked mesh, removing partial file: " + cookedPath);
+        file.close();
+        std::error_code ec;
+        std::filesystem::remove(cookedPath, ec);
+        return;
+    }
+
+    VKMON_INFO("Cooked mesh written: " + cookedPath + " (" +
+               std::to_string(header.meshCount) + " meshes)");
+}
+
+bool ModelLoader::isCookCurrent(const std::string& sourcePath) const {
+    std::ifstream file(cookedMeshPath(sourcePath), std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    VkMeshFileHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file.good() ||
+        std::memcmp(header.magic, VKMESH_MAGIC, sizeof(VKMESH_MAGIC)) != 0 ||
+        header.version != VKMESH_VERSION) {
+        return false;
+    }
+
+    uint64_t sourceWriteTime = 0;
+    uint64_t sourceFileSize = 0;
+    return readSourceStamp(sourcePath, sourceWriteTime, sourceFileSize) &&
+           sourceWriteTime == header.sourceWriteTime &&
+           sourceFileSize == header.sourceFileSize;
+}
+
+bool ModelLoader::cookModel(const std::string& filename) {
+    std::string fullPath = assetManager_->getFullAssetPath(AssetType::MODEL, filename);
+    if (isCookCurrent(fullPath)) {
+        return true;
+    }
+
+    // Local importer: the member importer_ is single-threaded and this
+    // pass runs on JobSystem workers during scene warmup
+    Assimp::Importer importer;
+    const aiScene* scene = importer.ReadFile(fullPath, getAssimpFlags());
+    if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+        VKMON_ERROR("Cook failed, Assimp could not load model: " + fullPath +
+                    " (" + std::string(importer.GetErrorString()) + ")");
+        return false;
+    }
+
+    std::string directory = fullPath.substr(0, fullPath.find_last_of('/'));
+    auto model = processAssimpScene(scene, directory, /*createGpuBuffers=*/false);
+    model->filename = fullPath;
+    writeCookedModel(*model, fullPath);
+
+    // writeCookedModel is best-effort; report whether the sidecar landed
+    return isCookCurrent(fullPath);
+}
+
+std::string ModelLoader::lodVariantPath(const std::string& meshPath, uint32_t lodLevel) {
+    if (lodLevel == 0) {
+        return meshPath; // Level 0 is the base mesh itself
+    }
+
+    std::string suffix = "_lod" + std::to_string(lodLevel);
+    size_t lastDot = meshPath.find_last_of('.');
+    size_t lastSlash = meshPath.find_last_of("/\\");
+
+    // Only treat the dot as an extension separator if it comes after the
+    // last path separator ("models/v1.2/creature" has no extension)
+    if (lastDot == std::string::npos ||
+        (lastSlash != std::string::npos && lastDot < lastSlash)) {
+        return meshPath + suffix;
+    }
+    return meshPath.substr(0, lastDot) + suffix + meshPath.substr(lastDot);
+}
+
+uint32_t ModelLoader::clampToAvailableLod(const std::string& meshPath, uint32_t desiredLod) {
+    if (desiredLod == 0) {
+        return 0;
+    }
+
+    auto cached = lodChainDepth_.find(meshPath);
+    if (cached == lodChainDepth_.end()) {
+        // Probe the chain contiguously: a gap ends it, since selection
+        // clamps downward and must always land on an existing file
+        uint32_t depth = 0;
+        for (uint32_t level = 1; level < MAX_LOD_LEVELS; ++level) {
+            std::string fullPath = assetManager_->getFullAssetPath(
+                AssetType::MODEL, lodVariantPath(meshPath, level));
+            if (!std::filesystem::exists(fullPath)) {
+                break;
+            }
+            depth = level;
+        }
+        cached = lodChainDepth_.emplace(meshPath, depth).first;
+
+        if (depth > 0) {
+            VKMON_INFO("LOD chain discovered for " + meshPath + ": " +
+                       std::to_string(depth + 1) + " levels");
+        }
+    }
+
+    return std::min(desiredLod, cached->second);
+}
+
+std::unique_ptr<Model> ModelLoader::processAssimpScene(const aiScene* scene, const std::string& directory,
+                                                       bool createGpuBuffers) {
     auto model = std::make_unique<Model>("");
     model->directory = directory;
-    
+
     // Process all meshes in the scene
     for (unsigned int i = 0; i < scene->mNumMeshes; i++) {
         aiMesh* assimpMesh = scene->mMeshes[i];
-        auto mesh = processAssimpMesh(assimpMesh, scene, directory);
+        auto mesh = processAssimpMesh(assimpMesh, scene, directory, createGpuBuffers);
         if (mesh) {
             model->meshes.push_back(std::move(mesh));
         }
@@ -121,8 +465,8 @@ std::unique_ptr<Model> ModelLoader::processAssimpScene(const aiScene* scene, con
     return model;
 }
 
-std::unique_ptr<Mesh> ModelLoader::processAssimpMesh(aiMesh* assimpMesh, const aiScene* scene, 
-                                                    const std::string& directory) {
+std::unique_ptr<Mesh> ModelLoader::processAssimpMesh(aiMesh* assimpMesh, const aiScene* scene,
+                                                    const std::string& directory, bool createGpuBuffers) {
     std::vector<ModelVertex> vertices;
     std::vector<uint32_t> indices;
     
@@ -173,22 +517,237 @@ std::unique_ptr<Mesh> ModelLoader::processAssimpMesh(aiMesh* assimpMesh, const a
         }
     }
     
+    // Reorder for the GPU before the data reaches the buffers (and the
+    // cook, which stores the optimized order)
+    if (optimizeVertexCache_ && indices.size() >= 6) {
+        optimizeVertexCacheOrder(indices, vertices.size());
+        optimizeVertexFetchOrder(vertices, indices);
+    }
+
     // Process material
     Material material;
     if (assimpMesh->mMaterialIndex >= 0) {
         aiMaterial* assimpMaterial = scene->mMaterials[assimpMesh->mMaterialIndex];
         material = loadMaterial(assimpMaterial, directory);
     }
-    
+
     // Create mesh
     auto mesh = std::make_unique<Mesh>(std::move(vertices), std::move(indices), std::move(material));
-    
-    // Create Vulkan resources
-    createMeshBuffers(*mesh);
-    
+
+    // Create Vulkan resources (skipped for worker-thread cook passes)
+    if (createGpuBuffers) {
+        createMeshBuffers(*mesh);
+    }
+
     return mesh;
 }
 
+// ============================================================================
+// GPU Geometry Optimization
+// ============================================================================
+
+namespace {
+
+// Forsyth vertex cache scoring: vertices recently used score high (so the
+// next triangle reuses warm cache entries), and vertices with few
+// remaining triangles get a boost so isolated fans finish early instead
+// of evicting everything later. Constants are the published ones.
+constexpr int VERTEX_CACHE_SIZE = 32;
+constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+constexpr float CACHE_DECAY_POWER = 1.5f;
+constexpr float VALENCE_BOOST_SCALE = 2.0f;
+constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+float vertexCacheScore(int cachePosition, uint32_t remainingTriangles) {
+    if (remainingTriangles == 0) {
+        return -1.0f; // Fully emitted - never pick again
+    }
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // Was part of the previous triangle - high but flat score so
+            // strip-like orders do not get locked in
+            score = LAST_TRIANGLE_SCORE;
+        } else {
+            score = 1.0f - float(cachePosition - 3) / float(VERTEX_CACHE_SIZE - 3);
+            score = std::pow(score, CACHE_DECAY_POWER);
+        }
+    }
+
+    score += VALENCE_BOOST_SCALE *
+             std::pow(static_cast<float>(remainingTriangles), -VALENCE_BOOST_POWER);
+    return score;
+}
+
+} // namespace
+
+void ModelLoader::optimizeVertexCacheOrder(std::vector<uint32_t>& indices, size_t vertexCount) {
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount < 2 || vertexCount == 0) {
+        return;
+    }
+
+    // Per-vertex bookkeeping: remaining triangle count, triangle adjacency,
+    // simulated cache position, current score
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    for (uint32_t index : indices) {
+        remaining[index]++;
+    }
+
+    std::vector<uint32_t> adjacencyOffset(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        adjacencyOffset[v + 1] = adjacencyOffset[v] + remaining[v];
+    }
+    std::vector<uint32_t> adjacency(indices.size());
+    {
+        std::vector<uint32_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            for (size_t k = 0; k < 3; ++k) {
+                adjacency[fill[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+            }
+        }
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount, 0.0f);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        vertexScore[v] = vertexCacheScore(-1, remaining[v]);
+    }
+
+    std::vector<float> triangleScore(triangleCount, 0.0f);
+    std::vector<bool> emitted(triangleCount, false);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        triangleScore[t] = vertexScore[indices[t * 3]] +
+                           vertexScore[indices[t * 3 + 1]] +
+                           vertexScore[indices[t * 3 + 2]];
+    }
+
+    // Simulated LRU cache, three slots larger than the scored window so
+    // just-evicted vertices still update correctly
+    std::vector<uint32_t> cache;
+    cache.reserve(VERTEX_CACHE_SIZE + 3);
+
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+
+    // Seed with the globally best triangle; afterwards prefer triangles
+    // touching the cache and fall back to a global scan when none do
+    size_t bestTriangle = 0;
+    for (size_t t = 1; t < triangleCount; ++t) {
+        if (triangleScore[t] > triangleScore[bestTriangle]) {
+            bestTriangle = t;
+        }
+    }
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+        uint32_t tri = static_cast<uint32_t>(bestTriangle);
+        emitted[tri] = true;
+        triangleScore[tri] = -1.0f;
+
+        for (size_t k = 0; k < 3; ++k) {
+            uint32_t v = indices[tri * 3 + k];
+            output.push_back(v);
+            remaining[v]--;
+
+            // Move v to the cache front
+            auto it = std::find(cache.begin(), cache.end(), v);
+            if (it != cache.end()) {
+                cache.erase(it);
+            }
+            cache.insert(cache.begin(), v);
+        }
+        // Evict overflow entries and rescore them as uncached (their
+        // triangle scores can only drop, so no best-tracking needed here)
+        while (cache.size() > static_cast<size_t>(VERTEX_CACHE_SIZE + 3)) {
+            uint32_t evictedVertex = cache.back();
+            cache.pop_back();
+            cachePosition[evictedVertex] = -1;
+            float newScore = vertexCacheScore(-1, remaining[evictedVertex]);
+            float delta = newScore - vertexScore[evictedVertex];
+            vertexScore[evictedVertex] = newScore;
+            for (uint32_t a = adjacencyOffset[evictedVertex]; a < adjacencyOffset[evictedVertex + 1]; ++a) {
+                if (!emitted[adjacency[a]]) {
+                    triangleScore[adjacency[a]] += delta;
+                }
+            }
+        }
+
+        // Rescore cached vertices and the un-emitted triangles they touch
+        float bestScore = -1.0f;
+        size_t nextTriangle = triangleCount;
+        for (size_t pos = 0; pos < cache.size(); ++pos) {
+            uint32_t v = cache[pos];
+            cachePosition[v] = (pos < static_cast<size_t>(VERTEX_CACHE_SIZE)) ? static_cast<int>(pos) : -1;
+            float newScore = vertexCacheScore(cachePosition[v], remaining[v]);
+            float delta = newScore - vertexScore[v];
+            vertexScore[v] = newScore;
+
+            for (uint32_t a = adjacencyOffset[v]; a < adjacencyOffset[v + 1]; ++a) {
+                uint32_t candidate = adjacency[a];
+                if (emitted[candidate]) {
+                    continue;
+                }
+                triangleScore[candidate] += delta;
+                if (triangleScore[candidate] > bestScore) {
+                    bestScore = triangleScore[candidate];
+                    nextTriangle = candidate;
+                }
+            }
+        }
+
+        if (nextTriangle == triangleCount) {
+            // Nothing adjacent to the cache remains - scan for the best
+            // triangle overall (new connected component)
+            for (size_t t = 0; t < triangleCount; ++t) {
+                if (!emitted[t] && triangleScore[t] > bestScore) {
+                    bestScore = triangleScore[t];
+                    nextTriangle = t;
+                }
+            }
+            if (nextTriangle == triangleCount) {
+                break; // All emitted
+            }
+        }
+        bestTriangle = nextTriangle;
+    }
+
+    if (output.size() == indices.size()) {
+        indices = std::move(output);
+    }
+}
+
+void ModelLoader::optimizeVertexFetchOrder(std::vector<ModelVertex>& vertices,
+                                           std::vector<uint32_t>& indices) {
+    if (vertices.empty() || indices.empty()) {
+        return;
+    }
+
+    constexpr uint32_t UNMAPPED = UINT32_MAX;
+    std::vector<uint32_t> remap(vertices.size(), UNMAPPED);
+    std::vector<ModelVertex> reordered;
+    reordered.reserve(vertices.size());
+
+    // First use in the (cache-optimized) index stream decides the new
+    // vertex position, so fetches walk the buffer roughly linearly
+    for (uint32_t& index : indices) {
+        if (remap[index] == UNMAPPED) {
+            remap[index] = static_cast<uint32_t>(reordered.size());
+            reordered.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    // Keep unreferenced vertices at the tail rather than dropping them
+    for (size_t v = 0; v < vertices.size(); ++v) {
+        if (remap[v] == UNMAPPED) {
+            reordered.push_back(vertices[v]);
+        }
+    }
+
+    vertices = std::move(reordered);
+}
+
 Material ModelLoader::loadMaterial(aiMaterial* mat, const std::string& directory) {
     Material material;
     
@@ -260,39 +819,92 @@ std::unique_ptr<Mesh> ModelLoader::createMesh(const std::vector<ModelVertex>& ve
     return mesh;
 }
 
+void ModelLoader::ensureGeometryPools() {
+    if (vertexPool_ && indexPool_) {
+        return;
+    }
+
+    vertexPool_ = std::make_unique<BufferPool>(
+        *resourceManager_, VERTEX_POOL_SIZE,
+        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, "mesh_vertex_pool");
+    indexPool_ = std::make_unique<BufferPool>(
+        *resourceManager_, INDEX_POOL_SIZE,
+        VK_BUFFER_USAGE_INDEX_BUFFER_BIT, "mesh_index_pool");
+
+    VKMON_INFO("Geometry pools created (" +
+              std::to_string(VERTEX_POOL_SIZE / (1024 * 1024)) + " MB vertices, " +
+              std::to_string(INDEX_POOL_SIZE / (1024 * 1024)) + " MB indices)");
+}
+
 void ModelLoader::createMeshBuffers(Mesh& mesh) {
-    if (mesh.vertices.empty() || mesh.indices.empty()) {
+    createMeshBuffersFromBlobs(mesh, mesh.vertices.data(), mesh.vertices.size(),
+                               mesh.indices.data(), mesh.indices.size());
+}
+
+void ModelLoader::createMeshBuffersFromBlobs(Mesh& mesh,
+                                             const ModelVertex* vertices, size_t vertexCount,
+                                             const uint32_t* indices, size_t indexCount) {
+    if (vertexCount == 0 || indexCount == 0) {
         VKMON_WARNING("Attempting to create buffers for empty mesh");
         return;
     }
-    
-    // Create vertex buffer
-    VkDeviceSize vertexBufferSize = sizeof(mesh.vertices[0]) * mesh.vertices.size();
+
+    ensureGeometryPools();
+
+    mesh.numVertices = vertexCount;
+    mesh.numIndices = indexCount;
+
+    VkDeviceSize vertexBufferSize = sizeof(ModelVertex) * vertexCount;
+    VkDeviceSize indexBufferSize = sizeof(uint32_t) * indexCount;
+
+    // Suballocate from the shared pools; element-size alignment keeps the
+    // offsets exact multiples for baseVertex/firstIndex conversion
+    VkDeviceSize vertexOffset = vertexPool_->allocate(
+        vertices, vertexBufferSize, sizeof(ModelVertex));
+    VkDeviceSize indexOffset = (vertexOffset != BufferPool::INVALID_OFFSET)
+        ? indexPool_->allocate(indices, indexBufferSize, sizeof(uint32_t))
+        : BufferPool::INVALID_OFFSET;
+
+    if (vertexOffset != BufferPool::INVALID_OFFSET && indexOffset != BufferPool::INVALID_OFFSET) {
+        mesh.vertexBufferHandle = vertexPool_->getBuffer();
+        mesh.indexBufferHandle = indexPool_->getBuffer();
+        mesh.baseVertex = static_cast<int32_t>(vertexOffset / sizeof(ModelVertex));
+        mesh.firstIndex = static_cast<uint32_t>(indexOffset / sizeof(uint32_t));
+
+        VKMON_RESOURCE("Mesh", "pooled", mesh.material.name + " (" +
+                      std::to_string(vertexCount) + " verts, " +
+                      std::to_string(indexCount) + " indices)");
+        return;
+    }
+
+    // Pools exhausted - fall back to dedicated buffers so loading still
+    // succeeds, at the cost of one allocation pair for this mesh
+    VKMON_WARNING("Geometry pools exhausted, creating dedicated buffers for mesh " + mesh.material.name);
+
     mesh.vertexBuffer = resourceManager_->createBuffer(
         vertexBufferSize,
         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
         "mesh_vertices_" + mesh.material.name
     );
-    
-    // Copy vertex data
-    mesh.vertexBuffer->updateData(mesh.vertices.data(), vertexBufferSize);
-    
-    // Create index buffer
-    VkDeviceSize indexBufferSize = sizeof(mesh.indices[0]) * mesh.indices.size();
+    mesh.vertexBuffer->updateData(vertices, vertexBufferSize);
+
     mesh.indexBuffer = resourceManager_->createBuffer(
         indexBufferSize,
         VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
         "mesh_indices_" + mesh.material.name
     );
-    
-    // Copy index data
-    mesh.indexBuffer->updateData(mesh.indices.data(), indexBufferSize);
-    
-    VKMON_RESOURCE("Mesh", "created", mesh.material.name + " (" + 
-                  std::to_string(mesh.vertices.size()) + " verts, " +
-                  std::to_string(mesh.indices.size()) + " indices)");
+    mesh.indexBuffer->updateData(indices, indexBufferSize);
+
+    mesh.vertexBufferHandle = mesh.vertexBuffer->getBuffer();
+    mesh.indexBufferHandle = mesh.indexBuffer->getBuffer();
+    mesh.baseVertex = 0;
+    mesh.firstIndex = 0;
+
+    VKMON_RESOURCE("Mesh", "created", mesh.material.name + " (" +
+                  std::to_string(vertexCount) + " verts, " +
+                  std::to_string(indexCount) + " indices)");
 }
 
 // ============================================================================
@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <unordered_map>
 
 // Assimp includes
 #include <assimp/Importer.hpp>
@@ -80,22 +81,40 @@ struct Material {
  * Mesh representation - single drawable unit
  */
 struct Mesh {
+    // CPU-side geometry. Populated by the Assimp path (and retained for
+    // cooking); stays empty for cooked loads, which upload straight from
+    // the file mapping - use vertexCount()/indexCount(), not .size()
     std::vector<ModelVertex> vertices;
     std::vector<uint32_t> indices;
     Material material;
-    
+
     // Vulkan resources (created by ModelLoader)
+    // Geometry normally lives in ModelLoader's shared vertex/index pools:
+    // the handles point at the pooled buffers and baseVertex/firstIndex
+    // locate this mesh inside them, so rendering binds the pools once and
+    // draws with offsets. vertexBuffer/indexBuffer stay null unless the
+    // pools were exhausted and a dedicated fallback buffer was created.
+    VkBuffer vertexBufferHandle = VK_NULL_HANDLE;
+    VkBuffer indexBufferHandle = VK_NULL_HANDLE;
+    int32_t baseVertex = 0;   // first vertex of this mesh in the bound buffer
+    uint32_t firstIndex = 0;  // first index of this mesh in the bound buffer
     std::unique_ptr<ManagedBuffer> vertexBuffer;
     std::unique_ptr<ManagedBuffer> indexBuffer;
-    
+
+    // Authoritative geometry counts - valid even when the CPU-side
+    // vectors were never filled (zero-copy cooked loads)
+    size_t numVertices = 0;
+    size_t numIndices = 0;
+
     // Mesh statistics
-    size_t vertexCount() const { return vertices.size(); }
-    size_t indexCount() const { return indices.size(); }
-    size_t triangleCount() const { return indices.size() / 3; }
-    
+    size_t vertexCount() const { return numVertices; }
+    size_t indexCount() const { return numIndices; }
+    size_t triangleCount() const { return numIndices / 3; }
+
     Mesh() = default;
     Mesh(std::vector<ModelVertex> verts, std::vector<uint32_t> inds, Material mat = Material())
-        : vertices(std::move(verts)), indices(std::move(inds)), material(std::move(mat)) {}
+        : vertices(std::move(verts)), indices(std::move(inds)), material(std::move(mat)),
+          numVertices(vertices.size()), numIndices(indices.size()) {}
 };
 
 /**
@@ -144,6 +163,45 @@ public:
     // Model loading
     std::unique_ptr<Model> loadModel(const std::string& filename);
     std::unique_ptr<Model> loadModelFromFile(const std::string& fullPath);
+
+    // Cook-only pass for preload warmup: parse with Assimp and write the
+    // .vkmesh sidecar WITHOUT touching GPU state. Safe to call from
+    // JobSystem workers in parallel - it uses a local Assimp importer and
+    // never reaches the shared geometry pools, so the subsequent
+    // loadModel on the main thread takes the fast mapped-blob path.
+    // Returns immediately when the cook is already current.
+    bool cookModel(const std::string& filename);
+
+    // Cooked binary mesh format
+    // Assimp parsing dominates scene load time, so the first load of a
+    // source model writes a .vkmesh sidecar: a small header, a material
+    // table, and vertex/index blobs in the exact ModelVertex layout.
+    // Subsequent loads memory-map it and upload the blobs straight from
+    // the mapping - no parsing, no CPU-side vertex copies. The header
+    // records the source file's write time and size, so editing the
+    // source invalidates the cook automatically.
+    static constexpr uint32_t VKMESH_VERSION = 1;
+
+    // Sidecar path for a source model ("creature.obj" -> "creature.obj.vkmesh")
+    static std::string cookedMeshPath(const std::string& sourcePath) {
+        return sourcePath + ".vkmesh";
+    }
+
+    // LOD chain support
+    // A mesh ships its lower-detail variants as sibling files named with a
+    // _lod<N> suffix ("creature.obj" -> "creature_lod1.obj"), authored
+    // offline. Level 0 is the base mesh and always exists; missing levels
+    // clamp down so meshes without a chain keep rendering unchanged.
+    static constexpr uint32_t MAX_LOD_LEVELS = 3;
+
+    // Build the variant filename for a LOD level (level 0 returns the path
+    // unchanged). Pure string manipulation - does not touch the filesystem.
+    static std::string lodVariantPath(const std::string& meshPath, uint32_t lodLevel);
+
+    // Clamp a desired LOD level to the deepest variant file that actually
+    // exists for this mesh. Probes the chain once per mesh and caches the
+    // result, so per-frame selection never hits the filesystem.
+    uint32_t clampToAvailableLod(const std::string& meshPath, uint32_t desiredLod);
     
     // Mesh processing
     std::unique_ptr<Mesh> createMesh(const std::vector<ModelVertex>& vertices, 
@@ -153,12 +211,31 @@ public:
     // Utility functions
     static std::vector<std::string> getSupportedFormats();
     bool isFormatSupported(const std::string& extension) const;
-    
+
+    // GPU geometry optimization
+    // Assimp's OptimizeMeshes merges meshes but does not order triangles
+    // for the post-transform vertex cache. These passes run after parsing
+    // and before buffer creation (their result lands in the cooked
+    // .vkmesh, so the cost is paid once per source change):
+    //
+    // optimizeVertexCacheOrder - greedy cache-score triangle reordering
+    // (Forsyth's linear-speed algorithm) so indexed vertices are reused
+    // while still resident in the post-transform cache.
+    //
+    // optimizeVertexFetchOrder - rewrites the vertex buffer into first-use
+    // order and remaps the indices, making vertex memory reads sequential.
+    //
+    // Static and pure so tests can measure the effect directly.
+    static void optimizeVertexCacheOrder(std::vector<uint32_t>& indices, size_t vertexCount);
+    static void optimizeVertexFetchOrder(std::vector<ModelVertex>& vertices,
+                                         std::vector<uint32_t>& indices);
+
     // Configuration
     void setTriangulate(bool enable) { triangulate_ = enable; }
     void setGenerateNormals(bool enable) { generateNormals_ = enable; }
     void setOptimizeMeshes(bool enable) { optimizeMeshes_ = enable; }
     void setFlipUVs(bool enable) { flipUVs_ = enable; }
+    void setOptimizeVertexCache(bool enable) { optimizeVertexCache_ = enable; }
     
     // Statistics
     void printLoadingSummary() const;
@@ -170,12 +247,25 @@ public:
 private:
     std::shared_ptr<ResourceManager> resourceManager_;
     std::shared_ptr<AssetManager> assetManager_;
-    
+
+    // Shared geometry pools - one vertex buffer and one index buffer for
+    // every mesh this loader creates, suballocated append-only (the model
+    // cache never evicts). Created lazily on first mesh upload.
+    static constexpr VkDeviceSize VERTEX_POOL_SIZE = 64 * 1024 * 1024;
+    static constexpr VkDeviceSize INDEX_POOL_SIZE = 16 * 1024 * 1024;
+    std::unique_ptr<BufferPool> vertexPool_;
+    std::unique_ptr<BufferPool> indexPool_;
+
+    // Deepest available LOD level per base mesh path, discovered by
+    // probing _lod<N> sibling files on first query (0 = no chain)
+    std::unordered_map<std::string, uint32_t> lodChainDepth_;
+
     // Configuration flags (for Assimp processing)
     bool triangulate_ = true;
     bool generateNormals_ = true;
     bool optimizeMeshes_ = true;
     bool flipUVs_ = false;
+    bool optimizeVertexCache_ = true;
     
     // Statistics
     mutable size_t totalModelsLoaded_ = 0;
@@ -185,9 +275,12 @@ private:
     // Assimp instance for model loading
     Assimp::Importer importer_;
     
-    // Assimp-specific methods
-    std::unique_ptr<Model> processAssimpScene(const aiScene* scene, const std::string& directory);
-    std::unique_ptr<Mesh> processAssimpMesh(aiMesh* mesh, const aiScene* scene, const std::string& directory);
+    // Assimp-specific methods. createGpuBuffers=false keeps the result
+    // CPU-only (cook pass on a worker thread)
+    std::unique_ptr<Model> processAssimpScene(const aiScene* scene, const std::string& directory,
+                                              bool createGpuBuffers = true);
+    std::unique_ptr<Mesh> processAssimpMesh(aiMesh* mesh, const aiScene* scene, const std::string& directory,
+                                            bool createGpuBuffers = true);
     Material loadMaterial(aiMaterial* mat, const std::string& directory);
     
     // Assimp utility methods
@@ -195,8 +288,19 @@ private:
     glm::vec3 assimpToGlm(const aiVector3D& vec) const;
     glm::vec2 assimpToGlm(const aiVector2D& vec) const;
     
+    // Cooked mesh helpers: load returns nullptr when the sidecar is
+    // missing, stale, or unreadable (the Assimp path then runs); write is
+    // best-effort and only logs on failure
+    std::unique_ptr<Model> tryLoadCookedModel(const std::string& sourcePath);
+    void writeCookedModel(const Model& model, const std::string& sourcePath);
+    bool isCookCurrent(const std::string& sourcePath) const;
+
     // Vulkan resource creation helpers
+    void ensureGeometryPools();
     void createMeshBuffers(Mesh& mesh);
+    void createMeshBuffersFromBlobs(Mesh& mesh,
+                                    const ModelVertex* vertices, size_t vertexCount,
+                                    const uint32_t* indices, size_t indexCount);
     uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
 };
 
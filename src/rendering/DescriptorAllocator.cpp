@@ -0,0 +1,171 @@
+#include "DescriptorAllocator.h"
+#include "../utils/Logger.h"
+#include <stdexcept>
+
+namespace VulkanMon {
+
+DescriptorAllocator::DescriptorAllocator(VkDevice device)
+    : device_(device) {
+    VKMON_DEBUG("DescriptorAllocator: Initialized");
+}
+
+DescriptorAllocator::~DescriptorAllocator() {
+    cleanup();
+}
+
+VkDescriptorPool DescriptorAllocator::createPool(const char* purpose) {
+    // One chunk covers the engine's common descriptor mix; ratios are
+    // per-set averages scaled by the chunk's set capacity
+    const VkDescriptorPoolSize poolSizes[] = {
+        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,         SETS_PER_POOL * 2 },
+        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, SETS_PER_POOL },
+        { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         SETS_PER_POOL * 2 },
+        { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, SETS_PER_POOL * 2 },
+        { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,          SETS_PER_POOL },
+    };
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.poolSizeCount = static_cast<uint32_t>(std::size(poolSizes));
+    poolInfo.pPoolSizes = poolSizes;
+    poolInfo.maxSets = SETS_PER_POOL;
+
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    if (vkCreateDescriptorPool(device_, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+        throw std::runtime_error("DescriptorAllocator: Failed to create " +
+                                 std::string(purpose) + " descriptor pool");
+    }
+    return pool;
+}
+
+VkDescriptorSet DescriptorAllocator::allocateFromPools(std::vector<VkDescriptorPool>& pools,
+                                                       VkDescriptorSetLayout layout,
+                                                       const char* purpose,
+                                                       uint32_t& poolsCreatedStat) {
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &layout;
+
+    // Pools only ever fill up, so the newest one is the only candidate
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    if (!pools.empty()) {
+        allocInfo.descriptorPool = pools.back();
+        VkResult result = vkAllocateDescriptorSets(device_, &allocInfo, &set);
+        if (result == VK_SUCCESS) {
+            stats_.setsAllocated++;
+            return set;
+        }
+        if (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL) {
+            throw std::runtime_error("DescriptorAllocator: Failed to allocate descriptor set");
+        }
+    }
+
+    // Current chunk is full (or none exists yet) - grow by one chunk
+    pools.push_back(createPool(purpose));
+    poolsCreatedStat++;
+
+    allocInfo.descriptorPool = pools.back();
+    if (vkAllocateDescriptorSets(device_, &allocInfo, &set) != VK_SUCCESS) {
+        throw std::runtime_error("DescriptorAllocator: Failed to allocate descriptor set from fresh pool");
+    }
+    stats_.setsAllocated++;
+    return set;
+}
+
+VkDescriptorSet DescriptorAllocator::allocate(VkDescriptorSetLayout layout) {
+    return allocateFromPools(persistentPools_, layout, "persistent",
+                             stats_.persistentPoolsCreated);
+}
+
+VkDescriptorSet DescriptorAllocator::allocateTransient(VkDescriptorSetLayout layout) {
+    return allocateFromPools(transientPools_[currentFrameSlot_], layout, "transient",
+                             stats_.transientPoolsCreated);
+}
+
+void DescriptorAllocator::beginFrame(uint32_t frameSlot) {
+    currentFrameSlot_ = frameSlot % FRAMES_IN_FLIGHT;
+
+    // Bulk reclaim: every transient set from this slot's last use dies
+    // in one driver call per pool
+    for (VkDescriptorPool pool : transientPools_[currentFrameSlot_]) {
+        vkResetDescriptorPool(device_, pool, 0);
+    }
+}
+
+VkDescriptorSet DescriptorAllocator::getOrCreate(VkDescriptorSetLayout layout,
+                                                 const Bindings& bindings) {
+    CacheKey key{ layout, bindings };
+    auto cached = cache_.find(key);
+    if (cached != cache_.end()) {
+        stats_.cacheHits++;
+        return cached->second;
+    }
+    stats_.cacheMisses++;
+
+    VkDescriptorSet set = allocate(layout);
+
+    // Replay the recorded bindings into the fresh set. Info structs are
+    // sized up front so the write array's pointers stay stable
+    std::vector<VkDescriptorBufferInfo> bufferInfos(bindings.entries_.size());
+    std::vector<VkDescriptorImageInfo> imageInfos(bindings.entries_.size());
+    std::vector<VkWriteDescriptorSet> writes(bindings.entries_.size());
+
+    for (size_t i = 0; i < bindings.entries_.size(); ++i) {
+        const Bindings::Entry& entry = bindings.entries_[i];
+
+        VkWriteDescriptorSet& write = writes[i];
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = set;
+        write.dstBinding = entry.binding;
+        write.dstArrayElement = 0;
+        write.descriptorType = entry.type;
+        write.descriptorCount = 1;
+
+        if (entry.isImage) {
+            imageInfos[i].imageView = (VkImageView)entry.objectHandle;
+            imageInfos[i].sampler = (VkSampler)entry.samplerHandle;
+            imageInfos[i].imageLayout = static_cast<VkImageLayout>(entry.offsetOrLayout);
+            write.pImageInfo = &imageInfos[i];
+        } else {
+            bufferInfos[i].buffer = (VkBuffer)entry.objectHandle;
+            bufferInfos[i].offset = entry.offsetOrLayout;
+            bufferInfos[i].range = entry.range;
+            write.pBufferInfo = &bufferInfos[i];
+        }
+    }
+
+    if (!writes.empty()) {
+        vkUpdateDescriptorSets(device_, static_cast<uint32_t>(writes.size()),
+                               writes.data(), 0, nullptr);
+    }
+
+    cache_.emplace(std::move(key), set);
+    return set;
+}
+
+void DescriptorAllocator::cleanup() {
+    if (device_ == VK_NULL_HANDLE) {
+        return;
+    }
+
+    for (VkDescriptorPool pool : persistentPools_) {
+        vkDestroyDescriptorPool(device_, pool, nullptr);
+    }
+    persistentPools_.clear();
+
+    for (auto& framePools : transientPools_) {
+        for (VkDescriptorPool pool : framePools) {
+            vkDestroyDescriptorPool(device_, pool, nullptr);
+        }
+        framePools.clear();
+    }
+
+    cache_.clear();
+
+    VKMON_DEBUG("DescriptorAllocator: Cleanup completed (" +
+                std::to_string(stats_.setsAllocated) + " sets allocated, " +
+                std::to_string(stats_.cacheHits) + " cache hits)");
+}
+
+} // namespace VulkanMon
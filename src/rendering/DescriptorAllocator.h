@@ -0,0 +1,195 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * VulkanMon Descriptor Allocator
+ *
+ * Pooled descriptor set allocation following our philosophy:
+ * - "Simple is Powerful" - One allocator, three calls: allocate,
+ *   allocateTransient, getOrCreate
+ * - "Test, Test, Test" - The cache key is pure data, unit-testable
+ *   without a device
+ * - "Document Often" - Pool growth and reset rules spelled out below
+ *
+ * Descriptor allocation is a known driver slow path, and ad-hoc
+ * vkCreateDescriptorPool/vkAllocateDescriptorSets calls scattered
+ * through the renderer hit it mid-frame whenever something is created
+ * at runtime. This allocator replaces them with:
+ *
+ * - Pooled chunks: persistent sets come from shared VkDescriptorPool
+ *   chunks sized for the engine's common descriptor mix; when a chunk
+ *   fills up a new one is created and the old stays live until cleanup.
+ * - Per-frame transient pools: sets that live for one frame allocate
+ *   from the current frame slot's pools and are reclaimed in bulk by a
+ *   single vkResetDescriptorPool in beginFrame() - no per-set frees.
+ * - A (layout, bindings) cache: getOrCreate() hashes the layout plus
+ *   the recorded binding contents and returns the existing set when an
+ *   identical one was already written, so repeated requests (material
+ *   variants, Inspector edits re-applying the same buffers) cost a map
+ *   lookup instead of a driver call.
+ */
+
+namespace VulkanMon {
+
+class DescriptorAllocator {
+public:
+    static constexpr uint32_t SETS_PER_POOL = 256;
+    static constexpr uint32_t FRAMES_IN_FLIGHT = 2;  // matches VulkanRenderer::MAX_FRAMES_IN_FLIGHT
+
+    /**
+     * Recorded bindings for one descriptor set: both the cache key and
+     * the write list replayed on a cache miss. Entries are compared in
+     * recording order - record bindings in ascending binding index.
+     * Pure data, no device required.
+     */
+    class Bindings {
+    public:
+        Bindings& addBuffer(uint32_t binding, VkDescriptorType type,
+                            VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range) {
+            Entry entry{};
+            entry.binding = binding;
+            entry.type = type;
+            entry.objectHandle = toHandleValue(buffer);
+            entry.offsetOrLayout = offset;
+            entry.range = range;
+            entries_.push_back(entry);
+            return *this;
+        }
+
+        Bindings& addImage(uint32_t binding, VkDescriptorType type,
+                           VkImageView view, VkSampler sampler, VkImageLayout imageLayout) {
+            Entry entry{};
+            entry.binding = binding;
+            entry.type = type;
+            entry.isImage = true;
+            entry.objectHandle = toHandleValue(view);
+            entry.samplerHandle = toHandleValue(sampler);
+            entry.offsetOrLayout = static_cast<uint64_t>(imageLayout);
+            entries_.push_back(entry);
+            return *this;
+        }
+
+        size_t hash() const {
+            size_t seed = entries_.size();
+            for (const Entry& entry : entries_) {
+                hashCombine(seed, entry.binding);
+                hashCombine(seed, static_cast<uint64_t>(entry.type));
+                hashCombine(seed, entry.objectHandle);
+                hashCombine(seed, entry.samplerHandle);
+                hashCombine(seed, entry.offsetOrLayout);
+                hashCombine(seed, entry.range);
+                hashCombine(seed, static_cast<uint64_t>(entry.isImage));
+            }
+            return seed;
+        }
+
+        bool operator==(const Bindings& other) const {
+            return entries_ == other.entries_;
+        }
+
+        bool empty() const { return entries_.empty(); }
+        size_t size() const { return entries_.size(); }
+
+    private:
+        friend class DescriptorAllocator;
+
+        struct Entry {
+            uint32_t binding = 0;
+            VkDescriptorType type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            uint64_t objectHandle = 0;    // buffer or image view
+            uint64_t samplerHandle = 0;   // images only
+            uint64_t offsetOrLayout = 0;  // buffer offset or image layout
+            uint64_t range = 0;           // buffers only
+            bool isImage = false;
+
+            bool operator==(const Entry& other) const = default;
+        };
+
+        // Non-dispatchable handles are pointers on 64-bit builds and
+        // uint64_t otherwise; a C-style cast covers both
+        template <typename HandleT>
+        static uint64_t toHandleValue(HandleT handle) {
+            return (uint64_t)handle;
+        }
+
+        static void hashCombine(size_t& seed, uint64_t value) {
+            seed ^= static_cast<size_t>(value) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        }
+
+        std::vector<Entry> entries_;
+    };
+
+    struct Stats {
+        uint32_t persistentPoolsCreated = 0;
+        uint32_t transientPoolsCreated = 0;
+        uint64_t setsAllocated = 0;
+        uint64_t cacheHits = 0;
+        uint64_t cacheMisses = 0;
+    };
+
+    explicit DescriptorAllocator(VkDevice device);
+    ~DescriptorAllocator();
+
+    DescriptorAllocator(const DescriptorAllocator&) = delete;
+    DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
+
+    // Allocate a persistent set; lives until cleanup()
+    VkDescriptorSet allocate(VkDescriptorSetLayout layout);
+
+    // Allocate a set valid only for the current frame slot; reclaimed
+    // in bulk when beginFrame() next reaches that slot
+    VkDescriptorSet allocateTransient(VkDescriptorSetLayout layout);
+
+    // Rotate to frameSlot and reset its transient pools in one call.
+    // The caller guarantees the GPU is done with that slot (the renderer
+    // waits on the frame timeline before advancing)
+    void beginFrame(uint32_t frameSlot);
+
+    // Return the cached set for (layout, bindings), allocating and
+    // writing it on first sight
+    VkDescriptorSet getOrCreate(VkDescriptorSetLayout layout, const Bindings& bindings);
+
+    const Stats& getStats() const { return stats_; }
+
+    // Destroys every pool (and with them every allocated set); cached
+    // handles become invalid
+    void cleanup();
+
+private:
+    struct CacheKey {
+        VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+        Bindings bindings;
+
+        bool operator==(const CacheKey& other) const {
+            return layout == other.layout && bindings == other.bindings;
+        }
+    };
+
+    struct CacheKeyHash {
+        size_t operator()(const CacheKey& key) const {
+            size_t seed = key.bindings.hash();
+            Bindings::hashCombine(seed, Bindings::toHandleValue(key.layout));
+            return seed;
+        }
+    };
+
+    VkDescriptorPool createPool(const char* purpose);
+    VkDescriptorSet allocateFromPools(std::vector<VkDescriptorPool>& pools,
+                                      VkDescriptorSetLayout layout,
+                                      const char* purpose, uint32_t& poolsCreatedStat);
+
+    VkDevice device_;
+    std::vector<VkDescriptorPool> persistentPools_;
+    std::array<std::vector<VkDescriptorPool>, FRAMES_IN_FLIGHT> transientPools_;
+    uint32_t currentFrameSlot_ = 0;
+    std::unordered_map<CacheKey, VkDescriptorSet, CacheKeyHash> cache_;
+    Stats stats_;
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,193 @@
+#include "FrameGraph.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace VulkanMon {
+
+FrameGraph::Resource FrameGraph::createResource(const std::string& name, bool transient) {
+    ResourceInfo info;
+    info.name = name;
+    info.transient = transient;
+    resources_.push_back(std::move(info));
+    return static_cast<Resource>(resources_.size() - 1);
+}
+
+FrameGraph::PassId FrameGraph::addPass(const std::string& name) {
+    Pass pass;
+    pass.name = name;
+    passes_.push_back(std::move(pass));
+    compiled_ = false;
+    return static_cast<PassId>(passes_.size() - 1);
+}
+
+void FrameGraph::addRead(PassId pass, Resource resource,
+                         VkPipelineStageFlags stages, VkAccessFlags access) {
+    passes_.at(pass).reads.push_back({resource, stages, access});
+    compiled_ = false;
+}
+
+void FrameGraph::addWrite(PassId pass, Resource resource,
+                          VkPipelineStageFlags stages, VkAccessFlags access) {
+    passes_.at(pass).writes.push_back({resource, stages, access});
+    compiled_ = false;
+}
+
+void FrameGraph::compile() {
+    // Per-resource synchronization state carried across the pass walk
+    struct ResourceState {
+        bool written = false;
+        VkPipelineStageFlags writeStages = 0;   // last writer's stages
+        VkAccessFlags writeAccess = 0;          // last writer's access
+        VkPipelineStageFlags readStages = 0;    // readers since last write
+        // Stages/access the last write has already been made visible to
+        // by an earlier pass's barrier - hazards they cover are elided
+        VkPipelineStageFlags visibleStages = 0;
+        VkAccessFlags visibleAccess = 0;
+    };
+
+    std::vector<ResourceState> state(resources_.size());
+    for (auto& info : resources_) {
+        info.firstUse = UINT32_MAX;
+        info.lastUse = 0;
+    }
+
+    passHazards_.assign(passes_.size(), {});
+    barriers_.assign(passes_.size(), {});
+
+    for (uint32_t passIndex = 0; passIndex < static_cast<uint32_t>(passes_.size()); ++passIndex) {
+        const Pass& pass = passes_[passIndex];
+
+        auto touch = [&](Resource resource) {
+            ResourceInfo& info = resources_.at(resource);
+            info.firstUse = std::min(info.firstUse, passIndex);
+            info.lastUse = std::max(info.lastUse, passIndex);
+        };
+
+        auto addHazard = [&](Resource resource, VkPipelineStageFlags srcStages,
+                             VkAccessFlags srcAccess, VkPipelineStageFlags dstStages,
+                             VkAccessFlags dstAccess) {
+            passHazards_[passIndex].push_back(
+                {resource, {srcStages, dstStages, srcAccess, dstAccess}});
+        };
+
+        // Read-after-write: wait for the last writer, skipping stages the
+        // write is already visible to
+        for (const Access& read : pass.reads) {
+            touch(read.resource);
+            ResourceState& rs = state[read.resource];
+            if (!rs.written) {
+                continue; // imported/external contents - nothing to order against
+            }
+            VkPipelineStageFlags neededStages = read.stages & ~rs.visibleStages;
+            VkAccessFlags neededAccess = read.access & ~rs.visibleAccess;
+            if (neededStages == 0 && neededAccess == 0) {
+                continue; // an earlier barrier already covers this read
+            }
+            addHazard(read.resource, rs.writeStages, rs.writeAccess, read.stages, read.access);
+            rs.visibleStages |= read.stages;
+            rs.visibleAccess |= read.access;
+        }
+
+        // Write hazards: order against the previous writer (WAW) and
+        // every reader since (WAR - execution dependency only, no
+        // memory access to flush)
+        for (const Access& write : pass.writes) {
+            touch(write.resource);
+            ResourceState& rs = state[write.resource];
+            if (rs.written) {
+                addHazard(write.resource, rs.writeStages, rs.writeAccess,
+                          write.stages, write.access);
+            }
+            if (rs.readStages != 0) {
+                addHazard(write.resource, rs.readStages, 0, write.stages, write.access);
+            }
+        }
+
+        // Commit this pass's effects after hazard derivation so a pass
+        // that reads and writes one resource orders against its
+        // predecessors, not itself
+        for (const Access& read : pass.reads) {
+            state[read.resource].readStages |= read.stages;
+        }
+        for (const Access& write : pass.writes) {
+            ResourceState& rs = state[write.resource];
+            rs.written = true;
+            rs.writeStages = write.stages;
+            rs.writeAccess = write.access;
+            rs.readStages = 0;
+            rs.visibleStages = 0;
+            rs.visibleAccess = 0;
+        }
+
+        // Merge the pass's hazards into its single barrier
+        Barrier& merged = barriers_[passIndex];
+        for (const auto& [resource, hazard] : passHazards_[passIndex]) {
+            merged.srcStageMask |= hazard.srcStageMask;
+            merged.dstStageMask |= hazard.dstStageMask;
+            merged.srcAccessMask |= hazard.srcAccessMask;
+            merged.dstAccessMask |= hazard.dstAccessMask;
+        }
+    }
+
+    compiled_ = true;
+}
+
+FrameGraph::Barrier FrameGraph::barrierBefore(PassId pass,
+                                              const std::vector<Resource>& resources) const {
+    if (!compiled_) {
+        throw std::runtime_error("FrameGraph::barrierBefore called before compile()");
+    }
+    Barrier merged{};
+    for (const auto& [resource, hazard] : passHazards_.at(pass)) {
+        if (std::find(resources.begin(), resources.end(), resource) == resources.end()) {
+            continue;
+        }
+        merged.srcStageMask |= hazard.srcStageMask;
+        merged.dstStageMask |= hazard.dstStageMask;
+        merged.srcAccessMask |= hazard.srcAccessMask;
+        merged.dstAccessMask |= hazard.dstAccessMask;
+    }
+    return merged;
+}
+
+std::vector<std::vector<FrameGraph::Resource>> FrameGraph::aliasGroups() const {
+    if (!compiled_) {
+        throw std::runtime_error("FrameGraph::aliasGroups called before compile()");
+    }
+
+    // Transient resources sorted by first use; greedy interval
+    // partitioning packs each into the first group whose lifetimes it
+    // does not overlap
+    std::vector<Resource> transients;
+    for (Resource r = 0; r < static_cast<Resource>(resources_.size()); ++r) {
+        if (resources_[r].transient && resources_[r].firstUse != UINT32_MAX) {
+            transients.push_back(r);
+        }
+    }
+    std::sort(transients.begin(), transients.end(), [this](Resource a, Resource b) {
+        return resources_[a].firstUse < resources_[b].firstUse;
+    });
+
+    std::vector<std::vector<Resource>> groups;
+    std::vector<uint32_t> groupLastUse;
+    for (Resource r : transients) {
+        const ResourceInfo& info = resources_[r];
+        bool placed = false;
+        for (size_t g = 0; g < groups.size(); ++g) {
+            if (groupLastUse[g] < info.firstUse) {
+                groups[g].push_back(r);
+                groupLastUse[g] = info.lastUse;
+                placed = true;
+                break;
+            }
+        }
+        if (!placed) {
+            groups.push_back({r});
+            groupLastUse.push_back(info.lastUse);
+        }
+    }
+    return groups;
+}
+
+} // namespace VulkanMon
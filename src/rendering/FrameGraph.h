@@ -0,0 +1,120 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * VulkanMon Frame Graph
+ *
+ * Declarative pass scheduling following our philosophy:
+ * - "Simple is Powerful" - Passes declare what they touch, nothing else
+ * - "Test, Test, Test" - Pure metadata, fully unit-testable without a device
+ * - "Document Often" - Hazard rules spelled out where they are derived
+ *
+ * Each GPU pass declares which logical resources it reads and writes,
+ * with the pipeline stages and access masks of those touches.
+ * Declaration order is execution order - hazards flow from earlier
+ * passes to later ones. compile() derives one merged pipeline barrier
+ * per pass covering every read-after-write, write-after-write, and
+ * write-after-read hazard against earlier passes (eliding hazards an
+ * earlier barrier already made visible), and computes which transient
+ * resources have disjoint lifetimes and can therefore alias one
+ * allocation.
+ *
+ * The graph carries no Vulkan handles - it is pure scheduling metadata.
+ * The renderer maps logical resources onto real buffers and images and
+ * records the derived barriers itself, so adding a pass means declaring
+ * its touches here instead of hand-auditing every existing barrier.
+ * Attachment layout transitions that live inside a VkRenderPass (via
+ * subpass external dependencies) stay there; the graph covers ordering
+ * between passes and the barriers recorded outside render pass scope.
+ */
+
+namespace VulkanMon {
+
+class FrameGraph {
+public:
+    using Resource = uint32_t;
+    using PassId = uint32_t;
+
+    // One merged barrier recorded immediately before a pass executes.
+    // Empty masks mean the pass needs no barrier of its own.
+    struct Barrier {
+        VkPipelineStageFlags srcStageMask = 0;
+        VkPipelineStageFlags dstStageMask = 0;
+        VkAccessFlags srcAccessMask = 0;
+        VkAccessFlags dstAccessMask = 0;
+
+        bool empty() const { return srcStageMask == 0 && dstStageMask == 0; }
+    };
+
+    // Declare a logical resource. Transient resources exist only within
+    // the frame and are candidates for memory aliasing
+    Resource createResource(const std::string& name, bool transient = false);
+
+    // Declare a pass; declaration order is execution order
+    PassId addPass(const std::string& name);
+
+    // Declare that a pass reads or writes a resource at the given stages
+    // with the given access. A resource may be declared by any number of
+    // passes; hazards are derived from the combination
+    void addRead(PassId pass, Resource resource,
+                 VkPipelineStageFlags stages, VkAccessFlags access);
+    void addWrite(PassId pass, Resource resource,
+                  VkPipelineStageFlags stages, VkAccessFlags access);
+
+    // Resolve per-pass barriers, resource lifetimes, and alias groups
+    void compile();
+
+    // The merged barrier a pass must record before its own commands,
+    // covering every un-elided hazard against earlier passes (valid
+    // after compile)
+    const Barrier& barrierBefore(PassId pass) const { return barriers_[pass]; }
+
+    // Like barrierBefore but restricted to hazards on the given
+    // resources - for barriers recorded in a different command buffer
+    // than the rest of the pass (e.g. the async cull submission)
+    Barrier barrierBefore(PassId pass, const std::vector<Resource>& resources) const;
+
+    // Groups of transient resources whose lifetimes never overlap in the
+    // compiled order; each group can share one memory allocation
+    std::vector<std::vector<Resource>> aliasGroups() const;
+
+    const std::string& passName(PassId pass) const { return passes_[pass].name; }
+    const std::string& resourceName(Resource resource) const { return resources_[resource].name; }
+    size_t passCount() const { return passes_.size(); }
+
+private:
+    struct Access {
+        Resource resource;
+        VkPipelineStageFlags stages;
+        VkAccessFlags access;
+    };
+
+    struct Pass {
+        std::string name;
+        std::vector<Access> reads;
+        std::vector<Access> writes;
+    };
+
+    struct ResourceInfo {
+        std::string name;
+        bool transient = false;
+        // Pass indices of first and last touch (alias analysis)
+        uint32_t firstUse = UINT32_MAX;
+        uint32_t lastUse = 0;
+    };
+
+    std::vector<Pass> passes_;
+    std::vector<ResourceInfo> resources_;
+
+    // Per-pass hazard contributions keyed by resource, so a barrier can
+    // be re-merged for a subset of resources without re-deriving
+    std::vector<std::vector<std::pair<Resource, Barrier>>> passHazards_;
+    std::vector<Barrier> barriers_;  // indexed by PassId, merged from passHazards_
+    bool compiled_ = false;
+};
+
+} // namespace VulkanMon
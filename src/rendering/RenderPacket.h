@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../core/AssetID.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * VulkanMon Render Packet
+ *
+ * Snapshot of the render-relevant slice of ECS state - model matrices,
+ * mesh handles, material ids - taken once per frame by the render
+ * systems' extraction step. Command recording consumes the packet and
+ * never touches live components, so a recording thread can work frame
+ * N's packet while simulation mutates state for frame N+1.
+ *
+ * The systems that fill packets double-buffer them: extraction writes
+ * one while the previous frame's stays intact for any consumer still
+ * reading it. Both buffers keep their capacity across frames, so steady
+ * state extraction allocates nothing.
+ */
+
+namespace VulkanMon {
+
+// One per-object draw, fully resolved at extraction time
+struct ObjectDraw {
+    glm::mat4 modelMatrix{1.0f};
+    AssetID meshId;
+    uint32_t materialId = 0;
+};
+
+struct RenderPacket {
+    // Sorted in submission order (render layer, then material, then
+    // front-to-back) by the extraction step
+    std::vector<ObjectDraw> objectDraws;
+
+    void clear() { objectDraws.clear(); }  // keeps capacity
+    bool empty() const { return objectDraws.empty(); }
+    size_t size() const { return objectDraws.size(); }
+};
+
+} // namespace VulkanMon
@@ -1,10 +1,177 @@
 #include "ResourceManager.h"
+#include "../utils/MemoryTracker.h"
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 #include <cstring>
 
 namespace VulkanMon {
 
+// ============================================================================
+// MemoryAllocator Implementation
+// ============================================================================
+
+MemoryAllocator::MemoryAllocator(VkDevice device)
+    : device_(device) {
+}
+
+MemoryAllocator::~MemoryAllocator() {
+    for (auto& block : blocks_) {
+        if (block.mapped != nullptr) {
+            vkUnmapMemory(device_, block.memory);
+        }
+        if (block.memory != VK_NULL_HANDLE) {
+            vkFreeMemory(device_, block.memory, nullptr);
+        }
+    }
+}
+
+MemoryAllocator::Allocation MemoryAllocator::allocate(const VkMemoryRequirements& requirements,
+                                                      uint32_t memoryTypeIndex,
+                                                      bool linearResource) {
+    // First-fit over existing compatible blocks
+    for (uint32_t i = 0; i < blocks_.size(); ++i) {
+        Block& block = blocks_[i];
+        if (block.memoryTypeIndex != memoryTypeIndex || block.linear != linearResource ||
+            block.oversized) {
+            continue;
+        }
+        Allocation allocation = allocateFromBlock(block, i, requirements.size, requirements.alignment);
+        if (allocation.isValid()) {
+            return allocation;
+        }
+    }
+
+    // No block had room: allocate a new one. Requests bigger than half a
+    // block get a right-sized private block so they cannot starve the
+    // shared ones
+    bool oversized = requirements.size > DEFAULT_BLOCK_SIZE / 2;
+    VkDeviceSize blockSize = oversized ? requirements.size : DEFAULT_BLOCK_SIZE;
+
+    Block block{};
+    block.size = blockSize;
+    block.memoryTypeIndex = memoryTypeIndex;
+    block.linear = linearResource;
+    block.oversized = oversized;
+    block.freeRanges.push_back({0, blockSize});
+
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = blockSize;
+    allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+    if (vkAllocateMemory(device_, &allocInfo, nullptr, &block.memory) != VK_SUCCESS) {
+        throw std::runtime_error("MemoryAllocator: Failed to allocate device memory block");
+    }
+
+    blocks_.push_back(std::move(block));
+    uint32_t blockIndex = static_cast<uint32_t>(blocks_.size() - 1);
+
+    Allocation allocation = allocateFromBlock(blocks_[blockIndex], blockIndex,
+                                              requirements.size, requirements.alignment);
+    if (!allocation.isValid()) {
+        throw std::runtime_error("MemoryAllocator: Fresh block cannot satisfy allocation");
+    }
+    return allocation;
+}
+
+MemoryAllocator::Allocation MemoryAllocator::allocateFromBlock(Block& block, uint32_t blockIndex,
+                                                               VkDeviceSize size,
+                                                               VkDeviceSize alignment) {
+    if (alignment == 0) {
+        alignment = 1;
+    }
+
+    for (size_t i = 0; i < block.freeRanges.size(); ++i) {
+        FreeRange range = block.freeRanges[i];
+        VkDeviceSize alignedOffset = ((range.offset + alignment - 1) / alignment) * alignment;
+        VkDeviceSize padding = alignedOffset - range.offset;
+        if (padding + size > range.size) {
+            continue;
+        }
+
+        // Carve [alignedOffset, alignedOffset + size) out of the range;
+        // alignment padding stays on the free list as a leading fragment
+        block.freeRanges.erase(block.freeRanges.begin() + i);
+        if (padding > 0) {
+            block.freeRanges.insert(block.freeRanges.begin() + i, {range.offset, padding});
+            ++i;
+        }
+        VkDeviceSize tail = range.size - padding - size;
+        if (tail > 0) {
+            block.freeRanges.insert(block.freeRanges.begin() + i, {alignedOffset + size, tail});
+        }
+
+        ++activeAllocations_;
+        usedBytes_ += size;
+
+        Allocation allocation;
+        allocation.memory = block.memory;
+        allocation.offset = alignedOffset;
+        allocation.size = size;
+        allocation.blockIndex = blockIndex;
+        return allocation;
+    }
+    return Allocation{};
+}
+
+void MemoryAllocator::free(const Allocation& allocation) {
+    if (!allocation.isValid() || allocation.blockIndex >= blocks_.size()) {
+        return;
+    }
+    Block& block = blocks_[allocation.blockIndex];
+
+    // Insert sorted by offset, then merge with both neighbours
+    auto it = std::lower_bound(block.freeRanges.begin(), block.freeRanges.end(), allocation.offset,
+                               [](const FreeRange& range, VkDeviceSize offset) {
+                                   return range.offset < offset;
+                               });
+    it = block.freeRanges.insert(it, {allocation.offset, allocation.size});
+
+    if (it + 1 != block.freeRanges.end() && it->offset + it->size == (it + 1)->offset) {
+        it->size += (it + 1)->size;
+        block.freeRanges.erase(it + 1);
+    }
+    if (it != block.freeRanges.begin()) {
+        auto prev = it - 1;
+        if (prev->offset + prev->size == it->offset) {
+            prev->size += it->size;
+            block.freeRanges.erase(it);
+        }
+    }
+
+    --activeAllocations_;
+    usedBytes_ -= allocation.size;
+}
+
+void* MemoryAllocator::map(const Allocation& allocation) {
+    if (!allocation.isValid() || allocation.blockIndex >= blocks_.size()) {
+        throw std::runtime_error("MemoryAllocator: Cannot map invalid allocation");
+    }
+    Block& block = blocks_[allocation.blockIndex];
+    if (block.mapped == nullptr) {
+        if (vkMapMemory(device_, block.memory, 0, block.size, 0, &block.mapped) != VK_SUCCESS) {
+            throw std::runtime_error("MemoryAllocator: Failed to map memory block");
+        }
+    }
+    return static_cast<char*>(block.mapped) + allocation.offset;
+}
+
+MemoryAllocator::Statistics MemoryAllocator::getStatistics() const {
+    Statistics stats;
+    stats.blockCount = blocks_.size();
+    stats.activeAllocations = activeAllocations_;
+    stats.usedBytes = usedBytes_;
+    for (const auto& block : blocks_) {
+        stats.totalBlockBytes += block.size;
+        stats.freeRangeCount += block.freeRanges.size();
+        if (block.oversized) {
+            ++stats.oversizedBlocks;
+        }
+    }
+    return stats;
+}
+
 // ============================================================================
 // ManagedBuffer Implementation
 // ============================================================================
@@ -41,6 +208,42 @@ ManagedBuffer::ManagedBuffer(VkDevice device, VkDeviceSize size, VkBufferUsageFl
     
     // Bind buffer to memory
     vkBindBufferMemory(device_, buffer_, memory_, 0);
+
+    MemoryTracker::getInstance().recordAllocation(MemoryTag::VulkanBuffers,
+                                                  static_cast<size_t>(size_));
+}
+
+ManagedBuffer::ManagedBuffer(VkDevice device, VkDeviceSize size, VkBufferUsageFlags usage,
+                             MemoryAllocator& allocator, uint32_t memoryTypeIndex,
+                             const std::string& debugName)
+    : ManagedResource(device, debugName), size_(size), allocator_(&allocator) {
+
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = size;
+    bufferInfo.usage = usage;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (vkCreateBuffer(device_, &bufferInfo, nullptr, &buffer_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create buffer: " + debugName);
+    }
+
+    VkMemoryRequirements memRequirements;
+    vkGetBufferMemoryRequirements(device_, buffer_, &memRequirements);
+
+    try {
+        allocation_ = allocator.allocate(memRequirements, memoryTypeIndex, true);
+    } catch (...) {
+        vkDestroyBuffer(device_, buffer_, nullptr);
+        buffer_ = VK_NULL_HANDLE;
+        throw;
+    }
+    memory_ = allocation_.memory;
+
+    vkBindBufferMemory(device_, buffer_, allocation_.memory, allocation_.offset);
+
+    MemoryTracker::getInstance().recordAllocation(MemoryTag::VulkanBuffers,
+                                                  static_cast<size_t>(size_));
 }
 
 ManagedBuffer::~ManagedBuffer() {
@@ -52,13 +255,17 @@ ManagedBuffer::ManagedBuffer(ManagedBuffer&& other) noexcept
     , buffer_(other.buffer_)
     , memory_(other.memory_)
     , size_(other.size_)
-    , mappedData_(other.mappedData_) {
+    , mappedData_(other.mappedData_)
+    , allocator_(other.allocator_)
+    , allocation_(other.allocation_) {
     
     // Clear the moved-from object
     other.buffer_ = VK_NULL_HANDLE;
     other.memory_ = VK_NULL_HANDLE;
     other.size_ = 0;
     other.mappedData_ = nullptr;
+    other.allocator_ = nullptr;
+    other.allocation_ = MemoryAllocator::Allocation{};
 }
 
 ManagedBuffer& ManagedBuffer::operator=(ManagedBuffer&& other) noexcept {
@@ -70,19 +277,27 @@ ManagedBuffer& ManagedBuffer::operator=(ManagedBuffer&& other) noexcept {
         memory_ = other.memory_;
         size_ = other.size_;
         mappedData_ = other.mappedData_;
+        allocator_ = other.allocator_;
+        allocation_ = other.allocation_;
         
         // Clear the moved-from object
         other.buffer_ = VK_NULL_HANDLE;
         other.memory_ = VK_NULL_HANDLE;
         other.size_ = 0;
         other.mappedData_ = nullptr;
+        other.allocator_ = nullptr;
+        other.allocation_ = MemoryAllocator::Allocation{};
     }
     return *this;
 }
 
 void* ManagedBuffer::map() {
     if (mappedData_ == nullptr) {
-        if (vkMapMemory(device_, memory_, 0, size_, 0, &mappedData_) != VK_SUCCESS) {
+        if (allocator_ != nullptr) {
+            // Shared block stays persistently mapped; pointer already
+            // includes this buffer's offset into the block
+            mappedData_ = allocator_->map(allocation_);
+        } else if (vkMapMemory(device_, memory_, 0, size_, 0, &mappedData_) != VK_SUCCESS) {
             throw std::runtime_error("Failed to map buffer memory: " + debugName_);
         }
     }
@@ -91,7 +306,11 @@ void* ManagedBuffer::map() {
 
 void ManagedBuffer::unmap() {
     if (mappedData_ != nullptr) {
-        vkUnmapMemory(device_, memory_);
+        if (allocator_ == nullptr) {
+            // Sub-allocated memory is never unmapped here: the mapping
+            // belongs to the shared block, not this buffer
+            vkUnmapMemory(device_, memory_);
+        }
         mappedData_ = nullptr;
     }
 }
@@ -105,10 +324,20 @@ void ManagedBuffer::updateData(const void* data, VkDeviceSize size, VkDeviceSize
 void ManagedBuffer::cleanup() {
     unmap();
     if (buffer_ != VK_NULL_HANDLE) {
+        // buffer_ doubles as the "allocation is live" sentinel: moved-from
+        // and already-cleaned objects have it nulled, so the free is
+        // recorded exactly once per tracked allocation
+        MemoryTracker::getInstance().recordFree(MemoryTag::VulkanBuffers,
+                                                static_cast<size_t>(size_));
         vkDestroyBuffer(device_, buffer_, nullptr);
         buffer_ = VK_NULL_HANDLE;
     }
-    if (memory_ != VK_NULL_HANDLE) {
+    if (allocator_ != nullptr) {
+        allocator_->free(allocation_);
+        allocator_ = nullptr;
+        allocation_ = MemoryAllocator::Allocation{};
+        memory_ = VK_NULL_HANDLE;
+    } else if (memory_ != VK_NULL_HANDLE) {
         vkFreeMemory(device_, memory_, nullptr);
         memory_ = VK_NULL_HANDLE;
     }
@@ -176,6 +405,79 @@ ManagedImage::ManagedImage(VkDevice device, uint32_t width, uint32_t height, VkF
         vkDestroyImage(device_, image_, nullptr);
         throw std::runtime_error("Failed to create image view: " + debugName);
     }
+
+    memorySize_ = memRequirements.size;
+    MemoryTracker::getInstance().recordAllocation(MemoryTag::VulkanImages,
+                                                  static_cast<size_t>(memorySize_));
+}
+
+ManagedImage::ManagedImage(VkDevice device, uint32_t width, uint32_t height, VkFormat format,
+                           VkImageTiling tiling, VkImageUsageFlags usage,
+                           MemoryAllocator& allocator, uint32_t memoryTypeIndex,
+                           VkImageAspectFlags aspectFlags, const std::string& debugName)
+    : ManagedResource(device, debugName), format_(format), width_(width), height_(height),
+      allocator_(&allocator) {
+
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.extent.width = width;
+    imageInfo.extent.height = height;
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.format = format;
+    imageInfo.tiling = tiling;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageInfo.usage = usage;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (vkCreateImage(device_, &imageInfo, nullptr, &image_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create image: " + debugName);
+    }
+
+    VkMemoryRequirements memRequirements;
+    vkGetImageMemoryRequirements(device_, image_, &memRequirements);
+
+    // Optimal-tiling images go to their own blocks so linear buffers and
+    // images never interleave within bufferImageGranularity of each other
+    try {
+        allocation_ = allocator.allocate(memRequirements, memoryTypeIndex,
+                                         tiling == VK_IMAGE_TILING_LINEAR);
+    } catch (...) {
+        vkDestroyImage(device_, image_, nullptr);
+        image_ = VK_NULL_HANDLE;
+        throw;
+    }
+    memory_ = allocation_.memory;
+
+    vkBindImageMemory(device_, image_, allocation_.memory, allocation_.offset);
+
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = image_;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = format;
+    viewInfo.subresourceRange.aspectMask = aspectFlags;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.baseArrayLayer = 0;
+    viewInfo.subresourceRange.layerCount = 1;
+
+    if (vkCreateImageView(device_, &viewInfo, nullptr, &imageView_) != VK_SUCCESS) {
+        allocator.free(allocation_);
+        allocation_ = MemoryAllocator::Allocation{};
+        allocator_ = nullptr;
+        memory_ = VK_NULL_HANDLE;
+        vkDestroyImage(device_, image_, nullptr);
+        image_ = VK_NULL_HANDLE;
+        throw std::runtime_error("Failed to create image view: " + debugName);
+    }
+
+    memorySize_ = memRequirements.size;
+    MemoryTracker::getInstance().recordAllocation(MemoryTag::VulkanImages,
+                                                  static_cast<size_t>(memorySize_));
 }
 
 ManagedImage::~ManagedImage() {
@@ -189,12 +491,18 @@ ManagedImage::ManagedImage(ManagedImage&& other) noexcept
     , imageView_(other.imageView_)
     , format_(other.format_)
     , width_(other.width_)
-    , height_(other.height_) {
-    
+    , height_(other.height_)
+    , memorySize_(other.memorySize_)
+    , allocator_(other.allocator_)
+    , allocation_(other.allocation_) {
+
     // Clear the moved-from object
     other.image_ = VK_NULL_HANDLE;
     other.memory_ = VK_NULL_HANDLE;
     other.imageView_ = VK_NULL_HANDLE;
+    other.memorySize_ = 0;
+    other.allocator_ = nullptr;
+    other.allocation_ = MemoryAllocator::Allocation{};
 }
 
 ManagedImage& ManagedImage::operator=(ManagedImage&& other) noexcept {
@@ -208,11 +516,17 @@ ManagedImage& ManagedImage::operator=(ManagedImage&& other) noexcept {
         format_ = other.format_;
         width_ = other.width_;
         height_ = other.height_;
-        
+        memorySize_ = other.memorySize_;
+        allocator_ = other.allocator_;
+        allocation_ = other.allocation_;
+
         // Clear the moved-from object
         other.image_ = VK_NULL_HANDLE;
         other.memory_ = VK_NULL_HANDLE;
         other.imageView_ = VK_NULL_HANDLE;
+        other.memorySize_ = 0;
+        other.allocator_ = nullptr;
+        other.allocation_ = MemoryAllocator::Allocation{};
     }
     return *this;
 }
@@ -223,10 +537,19 @@ void ManagedImage::cleanup() {
         imageView_ = VK_NULL_HANDLE;
     }
     if (image_ != VK_NULL_HANDLE) {
+        // image_ is the "allocation is live" sentinel - see ManagedBuffer::cleanup
+        MemoryTracker::getInstance().recordFree(MemoryTag::VulkanImages,
+                                                static_cast<size_t>(memorySize_));
+        memorySize_ = 0;
         vkDestroyImage(device_, image_, nullptr);
         image_ = VK_NULL_HANDLE;
     }
-    if (memory_ != VK_NULL_HANDLE) {
+    if (allocator_ != nullptr) {
+        allocator_->free(allocation_);
+        allocator_ = nullptr;
+        allocation_ = MemoryAllocator::Allocation{};
+        memory_ = VK_NULL_HANDLE;
+    } else if (memory_ != VK_NULL_HANDLE) {
         vkFreeMemory(device_, memory_, nullptr);
         memory_ = VK_NULL_HANDLE;
     }
@@ -237,7 +560,8 @@ void ManagedImage::cleanup() {
 // ============================================================================
 
 ResourceManager::ResourceManager(VkDevice device, VkPhysicalDevice physicalDevice)
-    : device_(device), physicalDevice_(physicalDevice) {
+    : device_(device), physicalDevice_(physicalDevice),
+      allocator_(std::make_unique<MemoryAllocator>(device)) {
     std::cout << "[RESOURCE MANAGER] Initialized for device" << std::endl;
 }
 
@@ -269,7 +593,7 @@ std::unique_ptr<ManagedBuffer> ResourceManager::createBuffer(VkDeviceSize size,
         // Find appropriate memory type
         uint32_t memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
         
-        auto buffer = std::make_unique<ManagedBuffer>(device_, size, usage, memoryTypeIndex, debugName);
+        auto buffer = std::make_unique<ManagedBuffer>(device_, size, usage, *allocator_, memoryTypeIndex, debugName);
         bufferCount_++;
         totalAllocatedMemory_ += size;
         return buffer;
@@ -314,7 +638,7 @@ std::unique_ptr<ManagedImage> ResourceManager::createImage(uint32_t width, uint3
         uint32_t memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
         
         auto image = std::make_unique<ManagedImage>(device_, width, height, format, tiling, usage, 
-                                                    memoryTypeIndex, aspectFlags, debugName);
+                                                    *allocator_, memoryTypeIndex, aspectFlags, debugName);
         imageCount_++;
         totalAllocatedMemory_ += width * height * 4; // Rough estimate
         return image;
@@ -338,11 +662,49 @@ uint32_t ResourceManager::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFl
     throw std::runtime_error("Failed to find suitable memory type!");
 }
 
+// ============================================================================
+// BufferPool Implementation
+// ============================================================================
+
+BufferPool::BufferPool(ResourceManager& resourceManager, VkDeviceSize capacity,
+                       VkBufferUsageFlags usage, const std::string& debugName)
+    : capacity_(capacity), debugName_(debugName) {
+    buffer_ = resourceManager.createBuffer(
+        capacity,
+        usage,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        debugName
+    );
+}
+
+VkDeviceSize BufferPool::allocate(const void* data, VkDeviceSize size, VkDeviceSize alignment) {
+    // Round the bump pointer up so the returned offset is an exact
+    // multiple of the caller's element size
+    VkDeviceSize offset = ((nextOffset_ + alignment - 1) / alignment) * alignment;
+    if (offset + size > capacity_) {
+        return INVALID_OFFSET;
+    }
+
+    buffer_->updateData(data, size, offset);
+    nextOffset_ = offset + size;
+    return offset;
+}
+
+MemoryAllocator::Statistics ResourceManager::getMemoryStatistics() const {
+    return allocator_->getStatistics();
+}
+
 void ResourceManager::printResourceSummary() const {
+    MemoryAllocator::Statistics stats = allocator_->getStatistics();
     std::cout << "\n=== RESOURCE MANAGER SUMMARY ===" << std::endl;
     std::cout << "Buffers: " << bufferCount_ << std::endl;
     std::cout << "Images: " << imageCount_ << std::endl;
     std::cout << "Total Allocated Memory: " << totalAllocatedMemory_ << " bytes" << std::endl;
+    std::cout << "Device Memory Blocks: " << stats.blockCount
+              << " (" << stats.oversizedBlocks << " oversized)" << std::endl;
+    std::cout << "Block Memory: " << stats.usedBytes << " / " << stats.totalBlockBytes
+              << " bytes in " << stats.activeAllocations << " allocations" << std::endl;
+    std::cout << "Free Ranges: " << stats.freeRangeCount << std::endl;
     std::cout << "==============================\n" << std::endl;
 }
 
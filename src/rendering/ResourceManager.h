@@ -1,8 +1,10 @@
 #pragma once
 
 #include <vulkan/vulkan.h>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 /**
  * VulkanMon Resource Management System
@@ -46,6 +48,92 @@ protected:
     std::string debugName_;
 };
 
+/**
+ * Sub-allocating device memory allocator
+ *
+ * Drivers cap the number of live VkDeviceMemory allocations (commonly
+ * 4096) and every vkAllocateMemory call is slow, so per-resource
+ * allocations do not scale to texture-heavy scenes. The allocator
+ * requests large blocks per (memory type, linear/optimal) pair and
+ * hands out first-fit ranges from a per-block free list; freed ranges
+ * merge with their neighbours so the list stays short.
+ *
+ * Linear resources (buffers) and optimal-tiling images never share a
+ * block, which sidesteps the bufferImageGranularity rules entirely.
+ * Requests larger than half a block get their own right-sized block.
+ * Blocks persist until the allocator is destroyed.
+ *
+ * Not thread-safe: all resource creation happens on the main thread,
+ * matching the engine's single-threaded ECS design.
+ */
+class MemoryAllocator {
+public:
+    static constexpr VkDeviceSize DEFAULT_BLOCK_SIZE = 64ull * 1024 * 1024;
+
+    struct Allocation {
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+        VkDeviceSize size = 0;
+        uint32_t blockIndex = UINT32_MAX;
+
+        bool isValid() const { return memory != VK_NULL_HANDLE; }
+    };
+
+    struct Statistics {
+        size_t blockCount = 0;            // device memory allocations held
+        size_t oversizedBlocks = 0;       // blocks created for huge requests
+        size_t activeAllocations = 0;
+        VkDeviceSize totalBlockBytes = 0;
+        VkDeviceSize usedBytes = 0;
+        size_t freeRangeCount = 0;        // rising count at flat usage signals fragmentation
+    };
+
+    explicit MemoryAllocator(VkDevice device);
+    ~MemoryAllocator();
+
+    // Non-copyable, non-movable: resources hold raw pointers back to it
+    MemoryAllocator(const MemoryAllocator&) = delete;
+    MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+
+    // Carve a range out of a matching block, growing the block list when
+    // nothing fits; linearResource separates buffers from optimal images
+    Allocation allocate(const VkMemoryRequirements& requirements, uint32_t memoryTypeIndex,
+                        bool linearResource);
+
+    // Return a range to its block's free list, merging with neighbours
+    void free(const Allocation& allocation);
+
+    // Persistent whole-block mapping; returns the pointer at the
+    // allocation's offset (host-visible memory only)
+    void* map(const Allocation& allocation);
+
+    Statistics getStatistics() const;
+
+private:
+    struct FreeRange {
+        VkDeviceSize offset;
+        VkDeviceSize size;
+    };
+
+    struct Block {
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VkDeviceSize size = 0;
+        uint32_t memoryTypeIndex = 0;
+        bool linear = true;
+        bool oversized = false;
+        void* mapped = nullptr;
+        std::vector<FreeRange> freeRanges;  // sorted by offset
+    };
+
+    Allocation allocateFromBlock(Block& block, uint32_t blockIndex,
+                                 VkDeviceSize size, VkDeviceSize alignment);
+
+    VkDevice device_;
+    std::vector<Block> blocks_;
+    size_t activeAllocations_ = 0;
+    VkDeviceSize usedBytes_ = 0;
+};
+
 /**
  * RAII wrapper for VkBuffer + VkDeviceMemory
  * Automatically handles creation and cleanup of buffer resources
@@ -55,6 +143,12 @@ class ManagedBuffer : public ManagedResource {
 public:
     ManagedBuffer(VkDevice device, VkDeviceSize size, VkBufferUsageFlags usage, 
                   uint32_t memoryTypeIndex, const std::string& debugName = "");
+
+    // Sub-allocating constructor: memory comes from a MemoryAllocator
+    // block at a non-zero offset instead of a dedicated allocation
+    ManagedBuffer(VkDevice device, VkDeviceSize size, VkBufferUsageFlags usage,
+                  MemoryAllocator& allocator, uint32_t memoryTypeIndex,
+                  const std::string& debugName = "");
     ~ManagedBuffer();
     
     // Move constructor and assignment
@@ -66,6 +160,8 @@ public:
     VkDeviceSize getSize() const { return size_; }
     
     // Memory mapping helpers
+    // Note: with sub-allocated memory the returned pointer already
+    // includes the block offset; never vkMapMemory(getMemory()) directly
     void* map();
     void unmap();
     void updateData(const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
@@ -75,6 +171,8 @@ private:
     VkDeviceMemory memory_ = VK_NULL_HANDLE;
     VkDeviceSize size_ = 0;
     void* mappedData_ = nullptr;
+    MemoryAllocator* allocator_ = nullptr;
+    MemoryAllocator::Allocation allocation_{};
     
     void cleanup();
 };
@@ -90,6 +188,13 @@ public:
                  VkImageTiling tiling, VkImageUsageFlags usage, uint32_t memoryTypeIndex,
                  VkImageAspectFlags aspectFlags = VK_IMAGE_ASPECT_COLOR_BIT,
                  const std::string& debugName = "");
+
+    // Sub-allocating constructor: memory comes from a MemoryAllocator block
+    ManagedImage(VkDevice device, uint32_t width, uint32_t height, VkFormat format,
+                 VkImageTiling tiling, VkImageUsageFlags usage,
+                 MemoryAllocator& allocator, uint32_t memoryTypeIndex,
+                 VkImageAspectFlags aspectFlags = VK_IMAGE_ASPECT_COLOR_BIT,
+                 const std::string& debugName = "");
     ~ManagedImage();
     
     // Move constructor and assignment  
@@ -109,6 +214,9 @@ private:
     VkImageView imageView_ = VK_NULL_HANDLE;
     VkFormat format_;
     uint32_t width_, height_;
+    VkDeviceSize memorySize_ = 0;  // Bytes charged to the MemoryTracker
+    MemoryAllocator* allocator_ = nullptr;
+    MemoryAllocator::Allocation allocation_{};
     
     void cleanup();
 };
@@ -144,22 +252,70 @@ public:
     
     // Device access
     VkDevice getDevice() const { return device_; }
+    VkPhysicalDevice getPhysicalDevice() const { return physicalDevice_; }
     
     // Statistics and debugging
     size_t getBufferCount() const { return bufferCount_; }
     size_t getImageCount() const { return imageCount_; }
     VkDeviceSize getTotalAllocatedMemory() const { return totalAllocatedMemory_; }
+    MemoryAllocator::Statistics getMemoryStatistics() const;
     
     void printResourceSummary() const;
 
 private:
     VkDevice device_;
     VkPhysicalDevice physicalDevice_;
-    
+
+    // Heap-owned so Managed* resources can keep a stable pointer even if
+    // the ResourceManager itself is moved
+    std::unique_ptr<MemoryAllocator> allocator_;
+
     // Resource tracking
     size_t bufferCount_ = 0;
     size_t imageCount_ = 0;
     VkDeviceSize totalAllocatedMemory_ = 0;
 };
 
+/**
+ * Bump suballocator over a single ManagedBuffer
+ *
+ * Packs many small resources (mesh vertex/index data) into one large
+ * buffer so rendering can bind once and draw with offsets, and the
+ * VkDeviceMemory allocation count stays flat as assets are loaded.
+ *
+ * Allocations are append-only: suballocations live as long as the pool,
+ * matching the model cache which never evicts loaded meshes. When the
+ * pool is exhausted allocate() returns INVALID_OFFSET and the caller
+ * falls back to a dedicated buffer.
+ */
+class BufferPool {
+public:
+    static constexpr VkDeviceSize INVALID_OFFSET = ~VkDeviceSize(0);
+
+    BufferPool(ResourceManager& resourceManager, VkDeviceSize capacity,
+               VkBufferUsageFlags usage, const std::string& debugName);
+    ~BufferPool() = default;
+
+    // Move-only semantics
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+    BufferPool(BufferPool&&) = default;
+    BufferPool& operator=(BufferPool&&) = default;
+
+    // Copy data into the pool and return its byte offset, aligned to
+    // alignment (pass the element size so offset / elementSize is exact).
+    // Returns INVALID_OFFSET when the remaining space is too small.
+    VkDeviceSize allocate(const void* data, VkDeviceSize size, VkDeviceSize alignment);
+
+    VkBuffer getBuffer() const { return buffer_->getBuffer(); }
+    VkDeviceSize getCapacity() const { return capacity_; }
+    VkDeviceSize getUsedBytes() const { return nextOffset_; }
+
+private:
+    std::unique_ptr<ManagedBuffer> buffer_;
+    VkDeviceSize capacity_ = 0;
+    VkDeviceSize nextOffset_ = 0;
+    std::string debugName_;
+};
+
 } // namespace VulkanMon
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * VulkanMon Shader Specialization
+ *
+ * Compile-time shader feature selection following our philosophy:
+ * - "Simple is Powerful" - One struct of features, one builder
+ * - "Test, Test, Test" - Pure data, unit-testable without a device
+ * - "Document Often" - Constant IDs and their shader meaning listed here
+ *
+ * The fragment shaders branch on lighting features (ambient on/off,
+ * specular model). Left as runtime uniform branches they cost real
+ * fragment throughput on the low-end GPUs we target; as specialization
+ * constants the compiler folds them at pipeline creation and dead code
+ * disappears for free. ShaderFeatures is the CPU-side mirror of the
+ * constant_id block shared by triangle.frag and instanced.frag, and
+ * doubles as the cache key for pipeline variants.
+ */
+
+namespace VulkanMon {
+
+struct ShaderFeatures {
+    // Values for specularModel - must match the SPECULAR_MODEL constant
+    // interpretation in the fragment shaders
+    static constexpr uint32_t SPECULAR_OFF = 0;
+    static constexpr uint32_t SPECULAR_BLINN_PHONG = 1;
+    static constexpr uint32_t SPECULAR_PHONG = 2;
+
+    VkBool32 enableAmbient = VK_TRUE;
+    uint32_t specularModel = SPECULAR_BLINN_PHONG;
+
+    // Compact key for the pipeline variant cache
+    uint32_t cacheKey() const {
+        return (enableAmbient ? 1u : 0u) | (specularModel << 1);
+    }
+
+    bool operator==(const ShaderFeatures& other) const = default;
+};
+
+/**
+ * Builds the VkSpecializationInfo for a fragment stage. The info points
+ * into this object, so it must stay alive until pipeline creation
+ * returns - declare it on the stack next to the stage create info.
+ */
+struct ShaderSpecialization {
+    static constexpr uint32_t CONSTANT_ID_ENABLE_AMBIENT = 0;
+    static constexpr uint32_t CONSTANT_ID_SPECULAR_MODEL = 1;
+
+    ShaderFeatures features;
+    std::array<VkSpecializationMapEntry, 2> entries{};
+    VkSpecializationInfo info{};
+
+    explicit ShaderSpecialization(const ShaderFeatures& requested)
+        : features(requested) {
+        entries[0].constantID = CONSTANT_ID_ENABLE_AMBIENT;
+        entries[0].offset = offsetof(ShaderFeatures, enableAmbient);
+        entries[0].size = sizeof(VkBool32);
+        entries[1].constantID = CONSTANT_ID_SPECULAR_MODEL;
+        entries[1].offset = offsetof(ShaderFeatures, specularModel);
+        entries[1].size = sizeof(uint32_t);
+
+        info.mapEntryCount = static_cast<uint32_t>(entries.size());
+        info.pMapEntries = entries.data();
+        info.dataSize = sizeof(ShaderFeatures);
+        info.pData = &features;
+    }
+
+    // The info embeds pointers into this object; copying would leave
+    // them dangling
+    ShaderSpecialization(const ShaderSpecialization&) = delete;
+    ShaderSpecialization& operator=(const ShaderSpecialization&) = delete;
+};
+
+} // namespace VulkanMon
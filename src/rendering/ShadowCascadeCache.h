@@ -0,0 +1,220 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * VulkanMon Shadow Cascade Cache
+ *
+ * Cascade fitting and invalidation policy for directional shadows,
+ * following our philosophy:
+ * - "Simple is Powerful" - Pure math and caching policy, no Vulkan handles
+ * - "Test, Test, Test" - Fully unit-testable without a device
+ * - "Document Often" - The caching rules spelled out where they live
+ *
+ * Shadows are split into a cached static layer and a per-frame dynamic
+ * layer. Re-rendering the whole world into every cascade each frame
+ * would double our draw calls; statics (terrain, buildings, trees)
+ * rarely change, so their shadow map is rendered once and reused until
+ * either the static content version ticks or the cascade itself moves.
+ * Dynamic entities (creatures, projectiles) are composited into a
+ * separate depth layer every frame using the same cascade matrix.
+ *
+ * Two properties make the static cache actually hit:
+ * - Each cascade's ortho extent is the bounding sphere of its frustum
+ *   slice, so the projection size depends only on FOV/aspect/splits -
+ *   camera rotation never resizes it.
+ * - The cascade center is snapped to shadow-texel increments in light
+ *   space, so sub-texel camera motion reuses the cached map verbatim
+ *   and larger motion shifts it by whole texels (no shimmer).
+ *
+ * The renderer owns the actual depth images and render passes; this
+ * class only answers "what is cascade i's light matrix" and "does its
+ * static layer need re-rendering this frame".
+ */
+
+namespace VulkanMon {
+
+class ShadowCascadeCache {
+public:
+    static constexpr uint32_t MAX_CASCADES = 4;
+
+    struct Config {
+        uint32_t cascadeCount = 4;
+        uint32_t shadowMapResolution = 2048;  // texels per cascade side
+        float maxShadowDistance = 80.0f;      // view-space reach of the last cascade
+        float splitLambda = 0.6f;             // 0 = uniform splits, 1 = logarithmic
+    };
+
+    struct Cascade {
+        glm::mat4 lightViewProj = glm::mat4(1.0f);
+        float splitNear = 0.0f;   // view-space depth range this cascade covers
+        float splitFar = 0.0f;
+        bool staticDirty = true;  // static layer must be re-rendered this frame
+    };
+
+    ShadowCascadeCache() = default;
+    explicit ShadowCascadeCache(const Config& config) : config_(config) {
+        if (config_.cascadeCount > MAX_CASCADES) {
+            config_.cascadeCount = MAX_CASCADES;
+        }
+    }
+
+    // Refit the cascades to this frame's camera and light. Camera
+    // parameters match what the renderer already recovers from the
+    // projection matrix for light clustering. `staticContentVersion` is
+    // any monotonic counter that ticks when static shadow casters are
+    // added, removed, or moved - cascades whose snapped placement and
+    // version both match last frame keep their cached static layer.
+    void update(const glm::mat4& viewMatrix, float tanHalfFovY, float aspect,
+                float zNear, const glm::vec3& lightDirection,
+                uint64_t staticContentVersion) {
+        glm::vec3 lightDir = glm::normalize(lightDirection);
+
+        // View matrix is rigid: recover the camera basis directly
+        // instead of paying for a general inverse
+        glm::vec3 translation(viewMatrix[3]);
+        glm::vec3 cameraPos = -glm::vec3(
+            glm::dot(glm::vec3(viewMatrix[0]), translation),
+            glm::dot(glm::vec3(viewMatrix[1]), translation),
+            glm::dot(glm::vec3(viewMatrix[2]), translation));
+        glm::vec3 right(viewMatrix[0][0], viewMatrix[1][0], viewMatrix[2][0]);
+        glm::vec3 up(viewMatrix[0][1], viewMatrix[1][1], viewMatrix[2][1]);
+        glm::vec3 forward(-viewMatrix[0][2], -viewMatrix[1][2], -viewMatrix[2][2]);
+
+        computeSplits(zNear);
+
+        for (uint32_t i = 0; i < config_.cascadeCount; ++i) {
+            fitCascade(i, cameraPos, right, up, forward, tanHalfFovY, aspect,
+                       lightDir, staticContentVersion);
+        }
+    }
+
+    // The renderer calls this after it re-rendered cascade i's static
+    // layer; until placement or content changes again, staticDirty
+    // stays false and the cached map is composited as-is
+    void markStaticRendered(uint32_t cascade) {
+        cascades_[cascade].staticDirty = false;
+    }
+
+    uint32_t cascadeCount() const { return config_.cascadeCount; }
+    const Cascade& cascade(uint32_t i) const { return cascades_[i]; }
+    const Config& config() const { return config_; }
+
+private:
+    struct CachedPlacement {
+        glm::vec3 snappedCenter = glm::vec3(0.0f);
+        glm::vec3 lightDir = glm::vec3(0.0f);
+        float radius = -1.0f;
+        uint64_t staticVersion = 0;
+        bool valid = false;
+    };
+
+    Config config_;
+    std::array<Cascade, MAX_CASCADES> cascades_{};
+    std::array<CachedPlacement, MAX_CASCADES> cached_{};
+
+    // Practical split scheme: blend of uniform and logarithmic so near
+    // cascades get most of the resolution without starving the far ones
+    void computeSplits(float zNear) {
+        float zFar = config_.maxShadowDistance;
+        float previous = zNear;
+        for (uint32_t i = 0; i < config_.cascadeCount; ++i) {
+            float t = static_cast<float>(i + 1) / static_cast<float>(config_.cascadeCount);
+            float logSplit = zNear * std::pow(zFar / zNear, t);
+            float uniformSplit = zNear + (zFar - zNear) * t;
+            float split = config_.splitLambda * logSplit
+                        + (1.0f - config_.splitLambda) * uniformSplit;
+            cascades_[i].splitNear = previous;
+            cascades_[i].splitFar = split;
+            previous = split;
+        }
+    }
+
+    void fitCascade(uint32_t index, const glm::vec3& cameraPos,
+                    const glm::vec3& right, const glm::vec3& up, const glm::vec3& forward,
+                    float tanHalfFovY, float aspect,
+                    const glm::vec3& lightDir, uint64_t staticContentVersion) {
+        Cascade& cascade = cascades_[index];
+
+        // Bounding sphere of the frustum slice: centroid of the eight
+        // corners, radius to the farthest one. Rotation-invariant by
+        // construction - only the split depths and FOV shape it
+        glm::vec3 corners[8];
+        sliceCorners(cameraPos, right, up, forward, tanHalfFovY, aspect,
+                     cascade.splitNear, cascade.splitFar, corners);
+
+        glm::vec3 center(0.0f);
+        for (const glm::vec3& corner : corners) {
+            center += corner;
+        }
+        center *= 1.0f / 8.0f;
+
+        float radius = 0.0f;
+        for (const glm::vec3& corner : corners) {
+            radius = std::max(radius, glm::length(corner - center));
+        }
+
+        // Snap the center to whole shadow texels in light space so
+        // sub-texel camera motion leaves the cascade exactly in place
+        glm::vec3 lightUp = std::abs(lightDir.y) > 0.99f
+                          ? glm::vec3(0.0f, 0.0f, 1.0f)
+                          : glm::vec3(0.0f, 1.0f, 0.0f);
+        glm::vec3 lightRight = glm::normalize(glm::cross(lightUp, lightDir));
+        lightUp = glm::cross(lightDir, lightRight);
+
+        float texelSize = (2.0f * radius) / static_cast<float>(config_.shadowMapResolution);
+        float snappedX = std::round(glm::dot(center, lightRight) / texelSize) * texelSize;
+        float snappedY = std::round(glm::dot(center, lightUp) / texelSize) * texelSize;
+        float alongLight = glm::dot(center, lightDir);
+        glm::vec3 snappedCenter = lightRight * snappedX + lightUp * snappedY
+                                + lightDir * alongLight;
+
+        // Pull the light eye back past the sphere so casters between
+        // the light and the slice still land in the depth range
+        float casterReach = radius * 2.0f;
+        glm::vec3 eye = snappedCenter - lightDir * casterReach;
+        cascade.lightViewProj =
+            glm::ortho(-radius, radius, -radius, radius, 0.0f, casterReach + radius)
+            * glm::lookAt(eye, snappedCenter, lightUp);
+
+        // Static layer survives exactly when nothing that shaped the
+        // map changed: same snapped placement, same light, same statics
+        CachedPlacement& cache = cached_[index];
+        bool placementUnchanged = cache.valid
+            && cache.snappedCenter == snappedCenter
+            && cache.lightDir == lightDir
+            && cache.radius == radius
+            && cache.staticVersion == staticContentVersion;
+
+        if (!placementUnchanged) {
+            cascade.staticDirty = true;
+            cache.snappedCenter = snappedCenter;
+            cache.lightDir = lightDir;
+            cache.radius = radius;
+            cache.staticVersion = staticContentVersion;
+            cache.valid = true;
+        }
+    }
+
+    static void sliceCorners(const glm::vec3& cameraPos,
+                             const glm::vec3& right, const glm::vec3& up, const glm::vec3& forward,
+                             float tanHalfFovY, float aspect,
+                             float sliceNear, float sliceFar, glm::vec3 (&corners)[8]) {
+        int written = 0;
+        for (float distance : { sliceNear, sliceFar }) {
+            float halfHeight = distance * tanHalfFovY;
+            float halfWidth = halfHeight * aspect;
+            glm::vec3 planeCenter = cameraPos + forward * distance;
+            corners[written++] = planeCenter - right * halfWidth - up * halfHeight;
+            corners[written++] = planeCenter + right * halfWidth - up * halfHeight;
+            corners[written++] = planeCenter - right * halfWidth + up * halfHeight;
+            corners[written++] = planeCenter + right * halfWidth + up * halfHeight;
+        }
+    }
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,384 @@
+#include "TransferManager.h"
+#include "../utils/Logger.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace VulkanMon {
+
+TransferManager::TransferManager(VkDevice device, VkPhysicalDevice physicalDevice,
+                                 uint32_t graphicsQueueFamily, VkQueue graphicsQueue,
+                                 uint32_t transferQueueFamily, VkQueue transferQueue)
+    : device_(device)
+    , graphicsQueueFamily_(graphicsQueueFamily)
+    , graphicsQueue_(graphicsQueue)
+    , transferQueueFamily_(transferQueueFamily)
+    , transferQueue_(transferQueue)
+    , resourceManager_(std::make_unique<ResourceManager>(device, physicalDevice)) {
+
+    stagingRing_ = resourceManager_->createBuffer(
+        STAGING_RING_SIZE,
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        "transfer_staging_ring"
+    );
+    stagingMapped_ = static_cast<char*>(stagingRing_->map());
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+    poolInfo.queueFamilyIndex = transferQueueFamily_;
+    if (vkCreateCommandPool(device_, &poolInfo, nullptr, &transferPool_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create transfer command pool!");
+    }
+
+    if (hasDedicatedTransferQueue()) {
+        // Graphics-side pool for queue ownership acquire barriers
+        poolInfo.queueFamilyIndex = graphicsQueueFamily_;
+        if (vkCreateCommandPool(device_, &poolInfo, nullptr, &graphicsPool_) != VK_SUCCESS) {
+            vkDestroyCommandPool(device_, transferPool_, nullptr);
+            throw std::runtime_error("Failed to create transfer acquire command pool!");
+        }
+    }
+
+    VKMON_INFO(std::string("TransferManager initialized (") +
+              (hasDedicatedTransferQueue() ? "dedicated transfer queue" : "graphics queue fallback") +
+              ", " + std::to_string(STAGING_RING_SIZE / (1024 * 1024)) + " MB staging ring)");
+}
+
+TransferManager::~TransferManager() {
+    waitForAllUploads();
+
+    if (transferPool_ != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(device_, transferPool_, nullptr);
+    }
+    if (graphicsPool_ != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(device_, graphicsPool_, nullptr);
+    }
+
+    VKMON_INFO("TransferManager destroyed");
+}
+
+// ============================================================================
+// Staging Ring
+// ============================================================================
+
+bool TransferManager::tryReserve(VkDeviceSize size, VkDeviceSize& offset) {
+    if (inFlight_.empty()) {
+        ringHead_ = 0;
+        ringTail_ = 0;
+    }
+
+    if (ringTail_ <= ringHead_) {
+        // Free space is [head, capacity) then [0, tail)
+        if (ringHead_ + size <= STAGING_RING_SIZE) {
+            offset = ringHead_;
+            ringHead_ += size;
+            return true;
+        }
+        if (size < ringTail_) {
+            offset = 0;
+            ringHead_ = size;
+            return true;
+        }
+        return false;
+    }
+
+    // Free space is [head, tail); keep head strictly below tail so a full
+    // ring is never mistaken for an empty one
+    if (ringHead_ + size < ringTail_) {
+        offset = ringHead_;
+        ringHead_ += size;
+        return true;
+    }
+    return false;
+}
+
+VkDeviceSize TransferManager::stageData(const void* data, VkDeviceSize size,
+                                        std::unique_ptr<ManagedBuffer>& dedicated) {
+    VkDeviceSize aligned = ((size + STAGING_ALIGNMENT - 1) / STAGING_ALIGNMENT) * STAGING_ALIGNMENT;
+
+    if (aligned > STAGING_RING_SIZE) {
+        // Oversized upload - one-shot staging buffer, retired with the
+        // same fence tracking as ring regions
+        VKMON_WARNING("Upload of " + std::to_string(size) +
+                     " bytes exceeds the staging ring, using a dedicated staging buffer");
+        dedicated = resourceManager_->createBuffer(
+            size,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            "transfer_staging_oversize"
+        );
+        dedicated->updateData(data, size);
+        return 0;
+    }
+
+    VkDeviceSize offset = 0;
+    for (;;) {
+        if (tryReserve(aligned, offset)) {
+            break;
+        }
+        retireCompletedUploads();
+        if (tryReserve(aligned, offset)) {
+            break;
+        }
+        // Ring genuinely full of live uploads - block on the oldest one.
+        // This is the only CPU wait in the upload path and it only fires
+        // under sustained upload pressure.
+        waitOldestUpload();
+    }
+
+    std::memcpy(stagingMapped_ + offset, data, size);
+    return offset;
+}
+
+void TransferManager::waitOldestUpload() {
+    if (inFlight_.empty()) {
+        return;
+    }
+    vkWaitForFences(device_, 1, &inFlight_.front().fence, VK_TRUE, UINT64_MAX);
+    retireCompletedUploads();
+}
+
+void TransferManager::releaseUpload(InFlightUpload& upload) {
+    vkDestroyFence(device_, upload.fence, nullptr);
+    if (upload.transferDone != VK_NULL_HANDLE) {
+        vkDestroySemaphore(device_, upload.transferDone, nullptr);
+    }
+    if (upload.transferCommands != VK_NULL_HANDLE) {
+        vkFreeCommandBuffers(device_, transferPool_, 1, &upload.transferCommands);
+    }
+    if (upload.acquireCommands != VK_NULL_HANDLE) {
+        vkFreeCommandBuffers(device_, graphicsPool_, 1, &upload.acquireCommands);
+    }
+    upload.dedicatedStaging.reset();
+}
+
+void TransferManager::retireCompletedUploads() {
+    while (!inFlight_.empty() &&
+           vkGetFenceStatus(device_, inFlight_.front().fence) == VK_SUCCESS) {
+        releaseUpload(inFlight_.front());
+        inFlight_.pop_front();
+    }
+    ringTail_ = inFlight_.empty() ? ringHead_ : inFlight_.front().ringStart;
+}
+
+void TransferManager::waitForAllUploads() {
+    while (!inFlight_.empty()) {
+        waitOldestUpload();
+    }
+}
+
+// ============================================================================
+// Upload Recording
+// ============================================================================
+
+VkCommandBuffer TransferManager::beginCommands(VkCommandPool pool) {
+    VkCommandBufferAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandPool = pool;
+    allocInfo.commandBufferCount = 1;
+
+    VkCommandBuffer commandBuffer;
+    if (vkAllocateCommandBuffers(device_, &allocInfo, &commandBuffer) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to allocate transfer command buffer!");
+    }
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(commandBuffer, &beginInfo);
+    return commandBuffer;
+}
+
+void TransferManager::submitUpload(InFlightUpload&& upload) {
+    vkEndCommandBuffer(upload.transferCommands);
+
+    VkFenceCreateInfo fenceInfo{};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    if (vkCreateFence(device_, &fenceInfo, nullptr, &upload.fence) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create upload fence!");
+    }
+
+    if (upload.acquireCommands != VK_NULL_HANDLE) {
+        // Cross-family: transfer work signals a semaphore, the graphics
+        // queue acquires ownership behind it, and the fence tracks the
+        // graphics-side submission (the true end of the upload)
+        vkEndCommandBuffer(upload.acquireCommands);
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        if (vkCreateSemaphore(device_, &semaphoreInfo, nullptr, &upload.transferDone) != VK_SUCCESS) {
+            vkDestroyFence(device_, upload.fence, nullptr);
+            throw std::runtime_error("Failed to create upload semaphore!");
+        }
+
+        VkSubmitInfo transferSubmit{};
+        transferSubmit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        transferSubmit.commandBufferCount = 1;
+        transferSubmit.pCommandBuffers = &upload.transferCommands;
+        transferSubmit.signalSemaphoreCount = 1;
+        transferSubmit.pSignalSemaphores = &upload.transferDone;
+        vkQueueSubmit(transferQueue_, 1, &transferSubmit, VK_NULL_HANDLE);
+
+        VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        VkSubmitInfo acquireSubmit{};
+        acquireSubmit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        acquireSubmit.waitSemaphoreCount = 1;
+        acquireSubmit.pWaitSemaphores = &upload.transferDone;
+        acquireSubmit.pWaitDstStageMask = &waitStage;
+        acquireSubmit.commandBufferCount = 1;
+        acquireSubmit.pCommandBuffers = &upload.acquireCommands;
+        vkQueueSubmit(graphicsQueue_, 1, &acquireSubmit, upload.fence);
+    } else {
+        // Same family: a single submission on the graphics queue; queue
+        // ordering makes the upload visible to every later frame
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &upload.transferCommands;
+        vkQueueSubmit(graphicsQueue_, 1, &submitInfo, upload.fence);
+    }
+
+    inFlight_.push_back(std::move(upload));
+}
+
+void TransferManager::uploadImage(const void* data, VkDeviceSize size, VkImage image,
+                                  uint32_t width, uint32_t height, const std::string& debugName) {
+    InFlightUpload upload{};
+    upload.ringStart = ringHead_;
+    VkDeviceSize srcOffset = stageData(data, size, upload.dedicatedStaging);
+    if (!upload.dedicatedStaging) {
+        upload.ringStart = srcOffset;
+    }
+    VkBuffer srcBuffer = upload.dedicatedStaging ? upload.dedicatedStaging->getBuffer()
+                                                 : stagingRing_->getBuffer();
+
+    upload.transferCommands = beginCommands(transferPool_);
+
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 1;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vkCmdPipelineBarrier(upload.transferCommands,
+                        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                        0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+    VkBufferImageCopy region{};
+    region.bufferOffset = srcOffset;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset = {0, 0, 0};
+    region.imageExtent = {width, height, 1};
+    vkCmdCopyBufferToImage(upload.transferCommands, srcBuffer, image,
+                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    if (hasDedicatedTransferQueue()) {
+        // Release ownership on the transfer queue...
+        barrier.srcQueueFamilyIndex = transferQueueFamily_;
+        barrier.dstQueueFamilyIndex = graphicsQueueFamily_;
+        barrier.dstAccessMask = 0;
+        vkCmdPipelineBarrier(upload.transferCommands,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                            0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        // ...and acquire it on the graphics queue with the same barrier
+        upload.acquireCommands = beginCommands(graphicsPool_);
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(upload.acquireCommands,
+                            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                            0, 0, nullptr, 0, nullptr, 1, &barrier);
+    } else {
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(upload.transferCommands,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                            0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+
+    submitUpload(std::move(upload));
+
+    #ifdef DEBUG_VERBOSE
+    VKMON_DEBUG("Async image upload submitted: " + debugName);
+    #else
+    (void)debugName;
+    #endif
+}
+
+void TransferManager::uploadBuffer(const void* data, VkDeviceSize size,
+                                   VkBuffer dstBuffer, VkDeviceSize dstOffset, const std::string& debugName) {
+    InFlightUpload upload{};
+    upload.ringStart = ringHead_;
+    VkDeviceSize srcOffset = stageData(data, size, upload.dedicatedStaging);
+    if (!upload.dedicatedStaging) {
+        upload.ringStart = srcOffset;
+    }
+    VkBuffer srcBuffer = upload.dedicatedStaging ? upload.dedicatedStaging->getBuffer()
+                                                 : stagingRing_->getBuffer();
+
+    upload.transferCommands = beginCommands(transferPool_);
+
+    VkBufferCopy copyRegion{};
+    copyRegion.srcOffset = srcOffset;
+    copyRegion.dstOffset = dstOffset;
+    copyRegion.size = size;
+    vkCmdCopyBuffer(upload.transferCommands, srcBuffer, dstBuffer, 1, &copyRegion);
+
+    VkBufferMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.buffer = dstBuffer;
+    barrier.offset = dstOffset;
+    barrier.size = size;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+
+    if (hasDedicatedTransferQueue()) {
+        barrier.srcQueueFamilyIndex = transferQueueFamily_;
+        barrier.dstQueueFamilyIndex = graphicsQueueFamily_;
+        barrier.dstAccessMask = 0;
+        vkCmdPipelineBarrier(upload.transferCommands,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                            0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+        upload.acquireCommands = beginCommands(graphicsPool_);
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+        vkCmdPipelineBarrier(upload.acquireCommands,
+                            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                            0, 0, nullptr, 1, &barrier, 0, nullptr);
+    } else {
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+        vkCmdPipelineBarrier(upload.transferCommands,
+                            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                            0, 0, nullptr, 1, &barrier, 0, nullptr);
+    }
+
+    submitUpload(std::move(upload));
+
+    #ifdef DEBUG_VERBOSE
+    VKMON_DEBUG("Async buffer upload submitted: " + debugName);
+    #else
+    (void)debugName;
+    #endif
+}
+
+} // namespace VulkanMon
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "ResourceManager.h"
+#include <vulkan/vulkan.h>
+#include <deque>
+#include <memory>
+#include <string>
+
+/**
+ * VulkanMon Async Transfer System
+ *
+ * Moves asset uploads off the frame loop following our philosophy:
+ * - "Simple is Powerful" - One staging ring, FIFO fence retirement
+ * - "Test, Test, Test" - Fallback paths for every capacity limit
+ * - "Document Often" - Queue ownership rules spelled out inline
+ *
+ * Uploads stage into a persistent host-visible ring buffer and are
+ * submitted to a dedicated transfer queue when the device has one,
+ * so texture and buffer uploads overlap rendering instead of stalling
+ * it behind vkQueueWaitIdle. In-flight ring regions are fence-tracked
+ * and reclaimed FIFO.
+ *
+ * Correctness without CPU waits: when the transfer family differs from
+ * the graphics family, each image upload ends with a queue ownership
+ * release on the transfer queue and a semaphore-chained acquire barrier
+ * submitted to the graphics queue. Because the acquire lands on the
+ * graphics queue before any later frame's command buffers, every
+ * submission made after upload*() returns may safely read the resource.
+ * When the families match, the single upload submission on the graphics
+ * queue gives the same ordering guarantee.
+ */
+
+namespace VulkanMon {
+
+class TransferManager {
+public:
+    TransferManager(VkDevice device, VkPhysicalDevice physicalDevice,
+                    uint32_t graphicsQueueFamily, VkQueue graphicsQueue,
+                    uint32_t transferQueueFamily, VkQueue transferQueue);
+    ~TransferManager();
+
+    // Move-only semantics
+    TransferManager(const TransferManager&) = delete;
+    TransferManager& operator=(const TransferManager&) = delete;
+    TransferManager(TransferManager&&) = delete;
+    TransferManager& operator=(TransferManager&&) = delete;
+
+    // Stage pixel data and submit an async copy into image, transitioning
+    // it UNDEFINED -> TRANSFER_DST -> SHADER_READ_ONLY. Returns as soon as
+    // the work is submitted.
+    void uploadImage(const void* data, VkDeviceSize size, VkImage image,
+                     uint32_t width, uint32_t height, const std::string& debugName = "");
+
+    // Stage data and submit an async copy into dstBuffer at dstOffset
+    void uploadBuffer(const void* data, VkDeviceSize size,
+                      VkBuffer dstBuffer, VkDeviceSize dstOffset, const std::string& debugName = "");
+
+    // Poll upload fences and reclaim finished staging regions - called
+    // once per frame from the renderer, and internally when the ring fills
+    void retireCompletedUploads();
+
+    // Block until every submitted upload has finished (shutdown path)
+    void waitForAllUploads();
+
+    bool hasDedicatedTransferQueue() const { return transferQueueFamily_ != graphicsQueueFamily_; }
+    size_t getPendingUploadCount() const { return inFlight_.size(); }
+
+private:
+    // 32 MB covers several large textures; bigger single uploads fall back
+    // to a one-shot dedicated staging buffer tracked with the same fence
+    static constexpr VkDeviceSize STAGING_RING_SIZE = 32 * 1024 * 1024;
+    static constexpr VkDeviceSize STAGING_ALIGNMENT = 16;
+
+    struct InFlightUpload {
+        VkFence fence = VK_NULL_HANDLE;
+        VkSemaphore transferDone = VK_NULL_HANDLE;          // cross-family chain only
+        VkCommandBuffer transferCommands = VK_NULL_HANDLE;  // transfer family pool
+        VkCommandBuffer acquireCommands = VK_NULL_HANDLE;   // graphics family pool
+        VkDeviceSize ringStart = 0;                         // reclaimed FIFO on retire
+        std::unique_ptr<ManagedBuffer> dedicatedStaging;    // oversize fallback only
+    };
+
+    VkDevice device_;
+    uint32_t graphicsQueueFamily_;
+    VkQueue graphicsQueue_;
+    uint32_t transferQueueFamily_;
+    VkQueue transferQueue_;
+
+    std::unique_ptr<ResourceManager> resourceManager_;
+    std::unique_ptr<ManagedBuffer> stagingRing_;
+    char* stagingMapped_ = nullptr;  // persistently mapped for the manager's lifetime
+    VkDeviceSize ringHead_ = 0;      // next write offset
+    VkDeviceSize ringTail_ = 0;      // oldest in-flight offset
+
+    VkCommandPool transferPool_ = VK_NULL_HANDLE;
+    VkCommandPool graphicsPool_ = VK_NULL_HANDLE;
+
+    std::deque<InFlightUpload> inFlight_;
+
+    // Reserve size bytes in the ring, retiring or waiting on older uploads
+    // as needed. Returns the staged offset, or fills dedicated and returns
+    // 0 when the request exceeds the ring capacity.
+    VkDeviceSize stageData(const void* data, VkDeviceSize size,
+                           std::unique_ptr<ManagedBuffer>& dedicated);
+    bool tryReserve(VkDeviceSize size, VkDeviceSize& offset);
+    void waitOldestUpload();
+    void releaseUpload(InFlightUpload& upload);
+
+    VkCommandBuffer beginCommands(VkCommandPool pool);
+    void submitUpload(InFlightUpload&& upload);
+};
+
+} // namespace VulkanMon
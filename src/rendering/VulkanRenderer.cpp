@@ -3,12 +3,15 @@
 #include "../io/ModelLoader.h"
 #include "../systems/MaterialSystem.h"
 #include "../utils/Logger.h"
+#include "../utils/JobSystem.h"
 #include "../config/CameraConfig.h"
 #include <iostream>
+#include <fstream>
 #include <stdexcept>
 #include <array>
 #include <filesystem>
 #include <algorithm>
+#include <thread>
 #include <glm/gtc/matrix_transform.hpp>  // For lookAt and perspective
 
 #define GLFW_INCLUDE_VULKAN
@@ -16,12 +19,84 @@
 
 using namespace VulkanMon;
 
+namespace {
+    // CPU mirror of the push_constant block in creature_cull.comp
+    struct CullPushConstants {
+        glm::vec4 frustumPlanes[6];
+        uint32_t firstInstance;
+        uint32_t instanceCount;
+        uint32_t commandSlot;
+        float boundingRadius;
+    };
+    static_assert(sizeof(CullPushConstants) == 112, "CullPushConstants must match the shader push constant layout");
+
+    // CPU mirror of the CullGlobals uniform block in creature_cull.comp
+    struct CullGlobals {
+        glm::mat4 view;
+        glm::mat4 proj;
+        glm::vec4 pyramid;  // xy: mip 0 size, z: mip count, w: occlusion enabled
+    };
+    static_assert(sizeof(CullGlobals) == 144, "CullGlobals must match the shader uniform block layout");
+
+    // Push constants for hiz_build.comp - destination level size
+    struct HiZBuildPushConstants {
+        int32_t dstWidth;
+        int32_t dstHeight;
+    };
+
+    // CPU mirror of the EmitRequest struct in particle_update.comp; the
+    // pool itself is GPU-only, the CPU only ever sizes it
+    struct ParticleEmitRequestGpu {
+        glm::vec4 origin;     // xyz: spawn position, w: base speed
+        glm::vec4 direction;  // xyz: cone axis, w: spread
+        glm::vec4 params;     // x: lifetime, y: size, z: gravity scale, w: drag
+        glm::uvec4 slots;     // x: first pool slot, y: count, z: first thread, w: material ID
+    };
+    static_assert(sizeof(ParticleEmitRequestGpu) == 64, "ParticleEmitRequestGpu must match the shader std430 layout");
+
+    // CPU mirror of the push_constant block in particle_update.comp
+    struct ParticlePushConstants {
+        uint32_t mode;         // 0 = emit, 1 = simulate
+        uint32_t threadCount;
+        uint32_t requestCount;
+        uint32_t poolCapacity;
+        float deltaTime;
+        uint32_t frameSeed;
+    };
+
+    constexpr uint32_t PARTICLE_MODE_EMIT = 0;
+    constexpr uint32_t PARTICLE_MODE_SIMULATE = 1;
+    constexpr VkDeviceSize PARTICLE_POOL_SLOT_SIZE = 48;  // Particle struct in particle_update.comp
+
+    // Gribb-Hartmann plane extraction, matching Frustum::updateFromMatrix
+    // in the spatial module (kept local - the renderer does not depend on
+    // spatial headers)
+    void extractFrustumPlanes(const glm::mat4& m, glm::vec4* planes) {
+        planes[0] = glm::vec4(m[0][3] + m[0][0], m[1][3] + m[1][0], m[2][3] + m[2][0], m[3][3] + m[3][0]);
+        planes[1] = glm::vec4(m[0][3] - m[0][0], m[1][3] - m[1][0], m[2][3] - m[2][0], m[3][3] - m[3][0]);
+        planes[2] = glm::vec4(m[0][3] + m[0][1], m[1][3] + m[1][1], m[2][3] + m[2][1], m[3][3] + m[3][1]);
+        planes[3] = glm::vec4(m[0][3] - m[0][1], m[1][3] - m[1][1], m[2][3] - m[2][1], m[3][3] - m[3][1]);
+        planes[4] = glm::vec4(m[0][3] + m[0][2], m[1][3] + m[1][2], m[2][3] + m[2][2], m[3][3] + m[3][2]);
+        planes[5] = glm::vec4(m[0][3] - m[0][2], m[1][3] - m[1][2], m[2][3] - m[2][2], m[3][3] - m[3][2]);
+        for (int i = 0; i < 6; ++i) {
+            planes[i] /= glm::length(glm::vec3(planes[i]));
+        }
+    }
+}
+
 // Shader file constants
 constexpr const char* VERTEX_SHADER_COMPILED = "shaders/vert.spv";
 constexpr const char* FRAGMENT_SHADER_COMPILED = "shaders/frag.spv";
 constexpr const char* INSTANCED_VERTEX_SHADER_COMPILED = "shaders/instanced_vert.spv";
+constexpr const char* GRASS_VERTEX_SHADER_COMPILED = "shaders/grass_vert.spv";
+constexpr const char* CREATURE_CULL_SHADER_COMPILED = "shaders/creature_cull.spv";
+constexpr const char* HIZ_BUILD_SHADER_COMPILED = "shaders/hiz_build.spv";
+constexpr const char* PARTICLE_UPDATE_SHADER_COMPILED = "shaders/particle_update.spv";
 constexpr const char* INSTANCED_FRAGMENT_SHADER_COMPILED = "shaders/instanced_frag.spv";
 
+// Pipeline cache blobs land here, one file per driver/device UUID
+constexpr const char* PIPELINE_CACHE_DIRECTORY = "cache";
+
 VulkanRenderer::VulkanRenderer(
     std::shared_ptr<Window> window,
     std::shared_ptr<ResourceManager> resourceManager,
@@ -58,7 +133,10 @@ void VulkanRenderer::initialize() {
         
         // Initialize Vulkan subsystems
         initVulkan();
-        
+
+        // Declare the frame's pass schedule and derive its barriers
+        buildFrameGraph();
+
         initialized_ = true;
         VKMON_INFO("VulkanRenderer initialization completed successfully");
 
@@ -75,6 +153,75 @@ void VulkanRenderer::initialize() {
     }
 }
 
+void VulkanRenderer::buildFrameGraph() {
+    // Declare every pass the frame records and what it touches. The
+    // graph is pure metadata - resources here are logical names the
+    // submission paths map onto the real buffers and images. Attachment
+    // layout transitions that live inside a VkRenderPass (the pre-pass
+    // depth handoff, swapchain color) stay in the render pass external
+    // dependencies; the graph covers ordering and the barriers recorded
+    // outside render pass scope.
+    auto instanceData = frameGraph_.createResource("InstanceData");
+    fgCulledInstances_ = frameGraph_.createResource("CulledInstances", true);
+    fgIndirectCommands_ = frameGraph_.createResource("IndirectCommands", true);
+    auto sceneDepth = frameGraph_.createResource("SceneDepth", true);
+    auto hiZPyramid = frameGraph_.createResource("HiZPyramid");  // crosses frames, never aliased
+    auto swapchainColor = frameGraph_.createResource("SwapchainColor");
+
+    // Cull compute: frustum + Hi-Z test per instance, compacting
+    // survivors and rewriting indirect command instance counts. Reads
+    // the pyramid built at the end of the previous frame
+    auto cullPass = frameGraph_.addPass("CullCompute");
+    frameGraph_.addRead(cullPass, instanceData,
+                        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+    frameGraph_.addRead(cullPass, hiZPyramid,
+                        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+    frameGraph_.addWrite(cullPass, fgCulledInstances_,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+    frameGraph_.addWrite(cullPass, fgIndirectCommands_,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+
+    // Depth pre-pass: uncompacted geometry, depth only
+    auto prePass = frameGraph_.addPass("DepthPrePass");
+    frameGraph_.addRead(prePass, instanceData,
+                        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
+    frameGraph_.addWrite(prePass, sceneDepth,
+                         VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                         VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+
+    // Shaded pass: per-object draws, instanced batches, ImGui - all
+    // inside one render pass instance
+    fgShadedPass_ = frameGraph_.addPass("ShadedPass");
+    frameGraph_.addRead(fgShadedPass_, fgIndirectCommands_,
+                        VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT);
+    frameGraph_.addRead(fgShadedPass_, fgCulledInstances_,
+                        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
+    frameGraph_.addRead(fgShadedPass_, instanceData,
+                        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
+    frameGraph_.addWrite(fgShadedPass_, swapchainColor,
+                         VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+
+    // Hi-Z build: collapses this frame's depth into the max pyramid the
+    // next frame's cull pass samples
+    auto hiZBuild = frameGraph_.addPass("HiZBuild");
+    frameGraph_.addRead(hiZBuild, sceneDepth,
+                        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+    frameGraph_.addWrite(hiZBuild, hiZPyramid,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+
+    frameGraph_.compile();
+
+    // The cull submission ends in its own command buffer, so it records
+    // the shaded pass's barrier restricted to the resources that cross
+    // that boundary
+    cullToDrawBarrier_ = frameGraph_.barrierBefore(fgShadedPass_,
+                                                   {fgCulledInstances_, fgIndirectCommands_});
+
+    VKMON_INFO("Frame graph compiled: " + std::to_string(frameGraph_.passCount()) +
+               " passes, " + std::to_string(frameGraph_.aliasGroups().size()) +
+               " transient alias groups");
+}
+
 void VulkanRenderer::renderFrame(float deltaTime) {
     if (!initialized_) {
         VKMON_WARNING("Cannot render frame: VulkanRenderer not initialized");
@@ -106,10 +253,8 @@ void VulkanRenderer::handleWindowResize(int width, int height) {
         return;
     }
 
-    // Wait for device to be idle before recreating swapchain
-    vkDeviceWaitIdle(device_);
-
-    // Recreate swapchain with new dimensions
+    // Recreate swapchain with new dimensions; recreateSwapChain waits on
+    // the graphics timeline itself, so no device-wide stall is needed here
     recreateSwapChain();
 
     // Update ImGui display size
@@ -126,40 +271,92 @@ void VulkanRenderer::reloadShaders() {
     if (!initialized_) {
         throw std::runtime_error("Cannot reload shaders: VulkanRenderer not initialized");
     }
-    
-    try {
-        // 1. Recompile shader files
-        if (!Utils::recompileShaders()) {
-            throw std::runtime_error("Shader recompilation failed");
-        }
-        
-        // 2. Wait for device to be idle
-        vkDeviceWaitIdle(device_);
-        
-        // 3. Destroy old pipeline and shader modules
-        if (graphicsPipeline_ != VK_NULL_HANDLE) {
-            vkDestroyPipeline(device_, graphicsPipeline_, nullptr);
-            graphicsPipeline_ = VK_NULL_HANDLE;
-        }
-        if (vertShaderModule_ != VK_NULL_HANDLE) {
-            vkDestroyShaderModule(device_, vertShaderModule_, nullptr);
-            vertShaderModule_ = VK_NULL_HANDLE;
-        }
-        if (fragShaderModule_ != VK_NULL_HANDLE) {
-            vkDestroyShaderModule(device_, fragShaderModule_, nullptr);
-            fragShaderModule_ = VK_NULL_HANDLE;
+
+    // One reload at a time; a second R press while compiling is a no-op
+    if (shaderReloadInFlight_.exchange(true)) {
+        VKMON_WARNING("Shader reload already in progress, ignoring request");
+        return;
+    }
+    if (shaderReloadThread_.joinable()) {
+        shaderReloadThread_.join();  // reap the previous worker
+    }
+
+    VKMON_INFO("Starting background shader reload...");
+
+    // GLSL compilation and pipeline construction both happen off the
+    // frame loop; the old pipeline keeps rendering until the replacement
+    // is ready and swapPendingPipeline() installs it between frames.
+    // Shader module and pipeline creation are thread-safe device calls,
+    // and the pipeline layout / render pass they reference only change
+    // under vkDeviceWaitIdle.
+    shaderReloadThread_ = std::thread([this]() {
+        VkShaderModule vertModule = VK_NULL_HANDLE;
+        VkShaderModule fragModule = VK_NULL_HANDLE;
+        try {
+            if (!Utils::recompileShaders()) {
+                throw std::runtime_error("Shader recompilation failed");
+            }
+
+            auto vertShaderCode = Utils::readFile(VERTEX_SHADER_COMPILED);
+            auto fragShaderCode = Utils::readFile(FRAGMENT_SHADER_COMPILED);
+            vertModule = createShaderModule(vertShaderCode);
+            fragModule = createShaderModule(fragShaderCode);
+            VkPipeline pipeline = buildGraphicsPipeline(vertModule, fragModule);
+
+            {
+                std::lock_guard<std::mutex> lock(pendingPipelineMutex_);
+                pendingVertShaderModule_ = vertModule;
+                pendingFragShaderModule_ = fragModule;
+                pendingGraphicsPipeline_ = pipeline;
+                pendingPipelineReady_ = true;
+            }
+            VKMON_INFO("Background shader reload compiled, swapping in next frame");
+
+        } catch (const std::exception& e) {
+            // The old pipeline is untouched, so a broken shader edit just
+            // logs and keeps rendering the previous version
+            if (vertModule != VK_NULL_HANDLE) vkDestroyShaderModule(device_, vertModule, nullptr);
+            if (fragModule != VK_NULL_HANDLE) vkDestroyShaderModule(device_, fragModule, nullptr);
+            VKMON_ERROR("Background shader reload failed: " + std::string(e.what()));
+            shaderReloadInFlight_ = false;
         }
-        
-        // 4. Recreate shader modules and pipeline
-        createShaderModules();
-        createGraphicsPipeline();
-        
-        VKMON_INFO("Shader reload completed successfully");
-        
-    } catch (const std::exception& e) {
-        VKMON_ERROR("Shader reload failed: " + std::string(e.what()));
-        throw;
+    });
+}
+
+void VulkanRenderer::swapPendingPipeline() {
+    if (!pendingPipelineReady_) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(pendingPipelineMutex_);
+
+    // Called right after the frame timeline wait: no frame is executing, so
+    // the old pipeline and modules can be destroyed without a device idle.
+    // Specialized variants reference the old shader modules, so they go too
+    // and rebuild lazily against the reloaded shaders.
+    destroyPipelineVariants();
+    vkDestroyPipeline(device_, graphicsPipeline_, nullptr);
+    vkDestroyShaderModule(device_, vertShaderModule_, nullptr);
+    vkDestroyShaderModule(device_, fragShaderModule_, nullptr);
+
+    graphicsPipeline_ = pendingGraphicsPipeline_;
+    vertShaderModule_ = pendingVertShaderModule_;
+    fragShaderModule_ = pendingFragShaderModule_;
+    pendingGraphicsPipeline_ = VK_NULL_HANDLE;
+    pendingVertShaderModule_ = VK_NULL_HANDLE;
+    pendingFragShaderModule_ = VK_NULL_HANDLE;
+    pendingPipelineReady_ = false;
+
+    if (shaderReloadThread_.joinable()) {
+        shaderReloadThread_.join();
     }
+    shaderReloadInFlight_ = false;
+
+    // Persist the cache immediately so the rebuilt pipeline is warm on
+    // the next launch even if the session ends abnormally
+    savePipelineCache();
+
+    VKMON_INFO("Shader reload completed successfully");
 }
 
 void VulkanRenderer::setCurrentModel(std::shared_ptr<Model> model) {
@@ -231,9 +428,44 @@ void VulkanRenderer::beginECSFrame() {
         return;
     }
 
-    // Wait for previous frame
-    vkWaitForFences(device_, 1, &inFlightFence_, VK_TRUE, UINT64_MAX);
-    vkResetFences(device_, 1, &inFlightFence_);
+    // Fresh tallies for this frame's draw submissions
+    frameRenderStats_.reset();
+
+    // Wait for the previous frame's graphics timeline value - a single
+    // syscall, no fence reset
+    waitForGpuFrameCompletion();
+
+    // Swapchains retired during a resize can go once the frame that was
+    // in flight at recreation time has finished presenting
+    destroyReadyRetiredSwapchains();
+
+    // Install a background-compiled shader pipeline now that no frame is
+    // executing on the GPU
+    swapPendingPipeline();
+
+    // The timeline wait guarantees last frame's timestamps have landed
+    readTimestampResults();
+
+    // Reclaim staging space from finished asset uploads (cheap fence polls)
+    if (transferManager_) {
+        transferManager_->retireCompletedUploads();
+    }
+
+    // Finalize textures the loader pool finished decoding: GPU image
+    // creation and upload submission happen here, on the main thread
+    if (assetManager_) {
+        assetManager_->processCompletedTextureLoads();
+    }
+
+    // Rotate to this frame's instance buffer so bump-offset writes land
+    // in memory no in-flight draw is reading
+    currentFrameInFlight_ = (currentFrameInFlight_ + 1) % MAX_FRAMES_IN_FLIGHT;
+
+    // If this slot chained overflow blocks last time it was used, the
+    // timeline wait above means nothing on the GPU still reads them:
+    // replace the slot's primary buffer with one allocation sized for
+    // the observed demand and free the blocks
+    coalesceInstanceBuffer();
 
     // Acquire next swapchain image
     VkResult result = vkAcquireNextImageKHR(device_, swapChain_, UINT64_MAX,
@@ -247,9 +479,36 @@ void VulkanRenderer::beginECSFrame() {
         throw std::runtime_error("Failed to acquire swapchain image!");
     }
 
-    // Update frame-level uniforms (view, projection, lighting)
+    // Update frame-level uniforms (view, projection, lighting) in one
+    // batched write; material data piggybacks only when it changed
     updateUniformBuffer();
-    updateMaterialBuffer();
+
+    // Advance the material ring to this frame's region and upload all
+    // material data before any draw binds a dynamic offset into it
+    if (materialSystem_) {
+        materialSystem_->beginFrame();
+    }
+
+    // Bulk-reclaim this slot's transient descriptor sets; the frame
+    // fence already guaranteed the GPU is done with them
+    if (descriptorAllocator_) {
+        descriptorAllocator_->beginFrame(currentFrameInFlight_);
+    }
+
+    // Open compute culling recording for this frame (no-op unless enabled)
+    beginCullPass();
+
+    // Record this frame's particle emit + simulate dispatches (no-op
+    // unless enabled and the pool has ever been touched)
+    beginParticlePass();
+
+    // Open depth-only pre-pass recording for this frame (no-op unless enabled)
+    beginDepthPrePass();
+
+    // Fresh command buffer, nothing is bound yet
+    boundVertexBuffer_ = VK_NULL_HANDLE;
+    boundIndexBuffer_ = VK_NULL_HANDLE;
+    boundMaterialId_ = NO_MATERIAL_BOUND;
 
     // Reset command buffer and begin recording
     vkResetCommandBuffer(commandBuffers_[currentImageIndex_], 0);
@@ -263,10 +522,19 @@ void VulkanRenderer::beginECSFrame() {
         throw std::runtime_error("Failed to begin recording command buffer!");
     }
 
+    // Reset and start GPU timing for this frame (reset must precede the render pass)
+    if (gpuTimingSupported_) {
+        vkCmdResetQueryPool(commandBuffers_[currentImageIndex_], timestampQueryPool_, 0, TIMESTAMP_QUERY_COUNT);
+        vkCmdWriteTimestamp(commandBuffers_[currentImageIndex_], VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                           timestampQueryPool_, 0);
+        instancedMarkerWritten_ = false;
+    }
+
     // Begin render pass
     VkRenderPassBeginInfo renderPassInfo{};
     renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    renderPassInfo.renderPass = renderPass_;
+    // With a pre-pass active the shaded pass loads its depth instead of clearing
+    renderPassInfo.renderPass = prePassActive_ ? renderPassDepthLoad_ : renderPass_;
     renderPassInfo.framebuffer = swapChainFramebuffers_[currentImageIndex_];
     renderPassInfo.renderArea.offset = {0, 0};
     renderPassInfo.renderArea.extent = swapChainExtent_;
@@ -278,10 +546,16 @@ void VulkanRenderer::beginECSFrame() {
     renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
     renderPassInfo.pClearValues = clearValues.data();
 
-    vkCmdBeginRenderPass(commandBuffers_[currentImageIndex_], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    // Latch parallel recording for this frame: a mid-frame toggle must
+    // not change how an already-begun render pass is recorded. With it
+    // active the pass holds only executed secondaries, so all draw state
+    // moves into the secondaries themselves.
+    parallelFrameActive_ = parallelRecordingEnabled_ && !recordingWorkers_.empty();
+    activeRenderPass_ = renderPassInfo.renderPass;
 
-    // Bind graphics pipeline
-    vkCmdBindPipeline(commandBuffers_[currentImageIndex_], VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline_);
+    vkCmdBeginRenderPass(commandBuffers_[currentImageIndex_], &renderPassInfo,
+                        parallelFrameActive_ ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+                                             : VK_SUBPASS_CONTENTS_INLINE);
 
     // Set viewport dynamically (now that pipeline supports dynamic state)
     VkExtent2D currentWindowExtent = window_->getExtent();
@@ -293,19 +567,65 @@ void VulkanRenderer::beginECSFrame() {
     viewport.minDepth = 0.0f;
     viewport.maxDepth = 1.0f;
 
-
-    vkCmdSetViewport(commandBuffers_[currentImageIndex_], 0, 1, &viewport);
-
-    // Set scissor rectangle (must match viewport for proper rendering)
+    // Scissor rectangle (must match viewport for proper rendering)
     VkRect2D scissor{};
     scissor.offset = {0, 0};
     scissor.extent.width = currentWindowExtent.width;
     scissor.extent.height = currentWindowExtent.height;
-    vkCmdSetScissor(commandBuffers_[currentImageIndex_], 0, 1, &scissor);
 
-    // Bind global descriptor set (set 0: UBO, texture, lighting)
-    vkCmdBindDescriptorSets(commandBuffers_[currentImageIndex_], VK_PIPELINE_BIND_POINT_GRAPHICS,
-                           pipelineLayout_, 0, 1, &globalDescriptorSet_, 0, nullptr);
+    if (!parallelFrameActive_) {
+        // Bind graphics pipeline
+        vkCmdBindPipeline(commandBuffers_[currentImageIndex_], VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline_);
+
+        vkCmdSetViewport(commandBuffers_[currentImageIndex_], 0, 1, &viewport);
+        vkCmdSetScissor(commandBuffers_[currentImageIndex_], 0, 1, &scissor);
+
+        // Bind global descriptor set (set 0: UBO, texture, lighting)
+        vkCmdBindDescriptorSets(commandBuffers_[currentImageIndex_], VK_PIPELINE_BIND_POINT_GRAPHICS,
+                               pipelineLayout_, 0, 1, &globalDescriptorSets_[currentFrameInFlight_], 0, nullptr);
+
+        // Bind the bindless texture array (set 2) once for the whole frame;
+        // per-draw texture selection happens by index, never by rebinding
+        vkCmdBindDescriptorSets(commandBuffers_[currentImageIndex_], VK_PIPELINE_BIND_POINT_GRAPHICS,
+                               pipelineLayout_, 2, 1, &bindlessTextureSet_, 0, nullptr);
+
+        frameRenderStats_.pipelineBinds++;
+        frameRenderStats_.descriptorBinds += 2;
+    } else {
+        deferredDraws_.clear();
+
+        // Open the trailing secondary that collects instanced batches,
+        // timing markers, and ImGui on the main thread; the frame timeline
+        // wait above guarantees it is no longer pending
+        VkCommandBuffer tail = tailSecondaries_[currentFrameInFlight_];
+        vkResetCommandBuffer(tail, 0);
+
+        VkCommandBufferInheritanceInfo inheritance{};
+        inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritance.renderPass = activeRenderPass_;
+        inheritance.subpass = 0;
+        inheritance.framebuffer = swapChainFramebuffers_[currentImageIndex_];
+
+        VkCommandBufferBeginInfo tailBegin{};
+        tailBegin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        tailBegin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                          VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        tailBegin.pInheritanceInfo = &inheritance;
+
+        if (vkBeginCommandBuffer(tail, &tailBegin) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to begin trailing secondary command buffer!");
+        }
+
+        vkCmdSetViewport(tail, 0, 1, &viewport);
+        vkCmdSetScissor(tail, 0, 1, &scissor);
+
+        // The instanced fragment shader reads the bindless array (set 2);
+        // set 0/1 binds happen inside renderInstanced as usual
+        vkCmdBindDescriptorSets(tail, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                               pipelineLayout_, 2, 1, &bindlessTextureSet_, 0, nullptr);
+
+        frameRenderStats_.descriptorBinds++;
+    }
 
     ecsFrameActive_ = true;
     frameLoadedMeshes_.clear();
@@ -314,21 +634,89 @@ void VulkanRenderer::beginECSFrame() {
 void VulkanRenderer::renderECSObject(const glm::mat4& modelMatrix,
                                     const std::string& meshPath,
                                     uint32_t materialId) {
+    renderECSObject(modelMatrix, AssetID::intern(meshPath), materialId);
+}
+
+void VulkanRenderer::renderECSObject(const glm::mat4& modelMatrix,
+                                    AssetID meshId,
+                                    uint32_t materialId) {
     if (!ecsFrameActive_) {
         VKMON_ERROR("ECS frame not active! Call beginECSFrame() first.");
         return;
     }
 
+    // Deferred path: collect the draw now and record it into a secondary
+    // command buffer on a worker thread at submit time. The depth
+    // pre-pass still records here since it lives in its own primary.
+    if (parallelFrameActive_) {
+        ensureMeshLoaded(meshId);
+
+        std::shared_ptr<Model> model;
+        {
+            std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
+            auto modelIt = modelCache_.find(meshId);
+            if (modelIt != modelCache_.end() && modelIt->second && !modelIt->second->meshes.empty()) {
+                model = modelIt->second;
+            }
+        }
+        if (!model) {
+            VKMON_WARNING("No model cached for meshPath: " + meshId.str());
+            return;
+        }
+        deferredDraws_.push_back({model, modelMatrix, materialId});
+
+        // The workers record these draws later, so tally the submission now
+        for (const auto& mesh : model->meshes) {
+            if (mesh->vertexBufferHandle != VK_NULL_HANDLE && mesh->indexBufferHandle != VK_NULL_HANDLE) {
+                frameRenderStats_.drawCalls++;
+                frameRenderStats_.instancesSubmitted++;
+                frameRenderStats_.trianglesSubmitted += mesh->indexCount() / 3;
+            }
+        }
+
+        if (prePassActive_) {
+            PushConstants pushConstants{};
+            pushConstants.model = modelMatrix;
+            vkCmdPushConstants(prePassCommandBuffer_, pipelineLayout_,
+                              VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                              0, sizeof(PushConstants), &pushConstants);
+            for (const auto& mesh : model->meshes) {
+                if (mesh->vertexBufferHandle == VK_NULL_HANDLE || mesh->indexBufferHandle == VK_NULL_HANDLE) {
+                    continue;
+                }
+                if (mesh->vertexBufferHandle != prePassBoundVertexBuffer_) {
+                    VkDeviceSize prePassOffset = 0;
+                    vkCmdBindVertexBuffers(prePassCommandBuffer_, 0, 1, &mesh->vertexBufferHandle, &prePassOffset);
+                    prePassBoundVertexBuffer_ = mesh->vertexBufferHandle;
+                }
+                if (mesh->indexBufferHandle != prePassBoundIndexBuffer_) {
+                    vkCmdBindIndexBuffer(prePassCommandBuffer_, mesh->indexBufferHandle, 0, VK_INDEX_TYPE_UINT32);
+                    prePassBoundIndexBuffer_ = mesh->indexBufferHandle;
+                }
+                vkCmdDrawIndexed(prePassCommandBuffer_, static_cast<uint32_t>(mesh->indexCount()), 1,
+                                mesh->firstIndex, mesh->baseVertex, 0);
+            }
+        }
+        return;
+    }
+
     // Ensure mesh is loaded
-    ensureMeshLoaded(meshPath);
+    ensureMeshLoaded(meshId);
 
-    // Bind material-specific descriptor set (set 1)
-    if (materialSystem_ && materialId < materialSystem_->getMaterialCount()) {
+    // Bind material-specific descriptor set (set 1) - skipped when the
+    // previous draw already bound the same material, which is the common
+    // case since RenderSystem sorts its draw list by material
+    if (materialSystem_ && materialId < materialSystem_->getMaterialCount() &&
+        materialId != boundMaterialId_) {
         VkDescriptorSet materialDescriptorSet = materialSystem_->getDescriptorSet(materialId);
         if (materialDescriptorSet != VK_NULL_HANDLE) {
-            // Bind the material descriptor set to set 1
+            // Bind the shared material set to set 1; the dynamic offset
+            // selects this material's slot in the ring buffer
+            uint32_t dynamicOffset = materialSystem_->getDynamicOffset(materialId);
             vkCmdBindDescriptorSets(commandBuffers_[currentImageIndex_], VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                   pipelineLayout_, 1, 1, &materialDescriptorSet, 0, nullptr);
+                                   pipelineLayout_, 1, 1, &materialDescriptorSet, 1, &dynamicOffset);
+            boundMaterialId_ = materialId;
+            frameRenderStats_.descriptorBinds++;
         }
     }
 
@@ -337,13 +725,20 @@ void VulkanRenderer::renderECSObject(const glm::mat4& modelMatrix,
     pushConstants.model = modelMatrix;
 
     vkCmdPushConstants(commandBuffers_[currentImageIndex_], pipelineLayout_,
-                      VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(PushConstants), &pushConstants);
+                      VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                      0, sizeof(PushConstants), &pushConstants);
 
-    // Render the specific model for this meshPath
+    if (prePassActive_) {
+        vkCmdPushConstants(prePassCommandBuffer_, pipelineLayout_,
+                          VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                          0, sizeof(PushConstants), &pushConstants);
+    }
+
+    // Render the specific model for this mesh
     std::shared_ptr<Model> model;
     {
         std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
-        auto modelIt = modelCache_.find(meshPath);
+        auto modelIt = modelCache_.find(meshId);
         if (modelIt != modelCache_.end() && modelIt->second && !modelIt->second->meshes.empty()) {
             model = modelIt->second;
         }
@@ -351,17 +746,45 @@ void VulkanRenderer::renderECSObject(const glm::mat4& modelMatrix,
 
     if (model) {
         for (const auto& mesh : model->meshes) {
-            if (mesh->vertexBuffer && mesh->indexBuffer) {
-                VkBuffer vertexBuffers[] = {mesh->vertexBuffer->getBuffer()};
-                VkDeviceSize offsets[] = {0};
-                vkCmdBindVertexBuffers(commandBuffers_[currentImageIndex_], 0, 1, vertexBuffers, offsets);
-                vkCmdBindIndexBuffer(commandBuffers_[currentImageIndex_], mesh->indexBuffer->getBuffer(), 0, VK_INDEX_TYPE_UINT32);
+            if (mesh->vertexBufferHandle != VK_NULL_HANDLE && mesh->indexBufferHandle != VK_NULL_HANDLE) {
+                // Pooled meshes share one vertex/index buffer pair, so the
+                // binds are skipped whenever the handle is unchanged and the
+                // draw selects the mesh through baseVertex/firstIndex
+                if (mesh->vertexBufferHandle != boundVertexBuffer_) {
+                    VkDeviceSize offset = 0;
+                    vkCmdBindVertexBuffers(commandBuffers_[currentImageIndex_], 0, 1, &mesh->vertexBufferHandle, &offset);
+                    boundVertexBuffer_ = mesh->vertexBufferHandle;
+                }
+                if (mesh->indexBufferHandle != boundIndexBuffer_) {
+                    vkCmdBindIndexBuffer(commandBuffers_[currentImageIndex_], mesh->indexBufferHandle, 0, VK_INDEX_TYPE_UINT32);
+                    boundIndexBuffer_ = mesh->indexBufferHandle;
+                }
 
-                vkCmdDrawIndexed(commandBuffers_[currentImageIndex_], static_cast<uint32_t>(mesh->indices.size()), 1, 0, 0, 0);
+                vkCmdDrawIndexed(commandBuffers_[currentImageIndex_], static_cast<uint32_t>(mesh->indexCount()), 1,
+                                mesh->firstIndex, mesh->baseVertex, 0);
+
+                frameRenderStats_.drawCalls++;
+                frameRenderStats_.instancesSubmitted++;
+                frameRenderStats_.trianglesSubmitted += mesh->indexCount() / 3;
+
+                if (prePassActive_) {
+                    // Mirror the draw depth-only with its own bind tracking
+                    if (mesh->vertexBufferHandle != prePassBoundVertexBuffer_) {
+                        VkDeviceSize prePassOffset = 0;
+                        vkCmdBindVertexBuffers(prePassCommandBuffer_, 0, 1, &mesh->vertexBufferHandle, &prePassOffset);
+                        prePassBoundVertexBuffer_ = mesh->vertexBufferHandle;
+                    }
+                    if (mesh->indexBufferHandle != prePassBoundIndexBuffer_) {
+                        vkCmdBindIndexBuffer(prePassCommandBuffer_, mesh->indexBufferHandle, 0, VK_INDEX_TYPE_UINT32);
+                        prePassBoundIndexBuffer_ = mesh->indexBufferHandle;
+                    }
+                    vkCmdDrawIndexed(prePassCommandBuffer_, static_cast<uint32_t>(mesh->indexCount()), 1,
+                                    mesh->firstIndex, mesh->baseVertex, 0);
+                }
             }
         }
     } else {
-        VKMON_WARNING("No model cached for meshPath: " + meshPath);
+        VKMON_WARNING("No model cached for meshPath: " + meshId.str());
     }
 }
 
@@ -371,13 +794,69 @@ void VulkanRenderer::endECSFrame() {
         return;
     }
 
-    // Render ImGui if enabled
-    if (imguiEnabled_ && imguiInitialized_) {
-        ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), commandBuffers_[currentImageIndex_]);
+    if (parallelFrameActive_) {
+        // Finish the trailing secondary (instanced draws recorded during
+        // the frame, timing markers, ImGui), record the deferred
+        // per-object chunks across the workers, then execute everything
+        // in draw order: per-object chunks first, trailing secondary last
+        VkCommandBuffer tail = tailSecondaries_[currentFrameInFlight_];
+
+        if (gpuTimingSupported_) {
+            if (!instancedMarkerWritten_) {
+                vkCmdWriteTimestamp(tail, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                   timestampQueryPool_, 1);
+                instancedMarkerWritten_ = true;
+            }
+            vkCmdWriteTimestamp(tail, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                               timestampQueryPool_, 2);
+        }
+
+        if (imguiEnabled_ && imguiInitialized_) {
+            ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), tail);
+        }
+
+        if (vkEndCommandBuffer(tail) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to record trailing secondary command buffer!");
+        }
+
+        std::vector<VkCommandBuffer> executed;
+        flushDeferredDraws(executed);
+        executed.push_back(tail);
+        vkCmdExecuteCommands(commandBuffers_[currentImageIndex_],
+                            static_cast<uint32_t>(executed.size()), executed.data());
+
+        vkCmdEndRenderPass(commandBuffers_[currentImageIndex_]);
+    } else {
+        if (gpuTimingSupported_) {
+            // A frame without instanced batches still writes query 1 here so
+            // the readback sees a complete set; that pass then reads as zero
+            if (!instancedMarkerWritten_) {
+                vkCmdWriteTimestamp(commandBuffers_[currentImageIndex_], VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                   timestampQueryPool_, 1);
+                instancedMarkerWritten_ = true;
+            }
+            vkCmdWriteTimestamp(commandBuffers_[currentImageIndex_], VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                               timestampQueryPool_, 2);
+        }
+
+        // Render ImGui if enabled
+        if (imguiEnabled_ && imguiInitialized_) {
+            ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), commandBuffers_[currentImageIndex_]);
+        }
+
+        // End render pass
+        vkCmdEndRenderPass(commandBuffers_[currentImageIndex_]);
     }
 
-    // End render pass
-    vkCmdEndRenderPass(commandBuffers_[currentImageIndex_]);
+    // Max-reduce the depth this frame just wrote into the Hi-Z pyramid;
+    // the next frame's cull pass tests occlusion against it
+    recordHiZPyramidBuild(commandBuffers_[currentImageIndex_]);
+
+    if (gpuTimingSupported_) {
+        vkCmdWriteTimestamp(commandBuffers_[currentImageIndex_], VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                           timestampQueryPool_, 3);
+        timestampsIssued_ = true;
+    }
 
     // End command buffer recording
     if (vkEndCommandBuffer(commandBuffers_[currentImageIndex_]) != VK_SUCCESS) {
@@ -388,35 +867,172 @@ void VulkanRenderer::endECSFrame() {
     VkSubmitInfo submitInfo{};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
-    VkSemaphore waitSemaphores[] = {imageAvailableSemaphore_};
-    VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
-    submitInfo.waitSemaphoreCount = 1;
+    VkSemaphore waitSemaphores[2] = {imageAvailableSemaphore_, VK_NULL_HANDLE};
+    VkPipelineStageFlags waitStages[2] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0};
+    uint64_t waitValues[2] = {0, 0};  // ignored for binary semaphores
+    uint32_t waitSemaphoreCount = 1;
+
+    // Close the compute passes (cull and particles, if recorded). With a
+    // dedicated compute queue they are submitted there and overlap the
+    // fragment-heavy graphics work below, handing off through the compute
+    // timeline waited at the indirect command / vertex attribute read
+    // stages. Without one they ride the same queue ahead of the graphics
+    // commands, ordered by barriers.
+    std::array<VkCommandBuffer, 4> submitBuffers{};
+    uint32_t submitBufferCount = 0;
+    if (cullPassActive_ || particlePassActive_) {
+        // Graphics reads both passes' outputs at the same stages: indirect
+        // command counts and per-instance vertex attributes
+        constexpr VkPipelineStageFlags PARTICLE_DRAW_WAIT_STAGES =
+            VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+
+        if (asyncComputeAvailable_) {
+            // Cross-queue: the timeline signal/wait pair covers both
+            // execution order and memory visibility, and graphics-stage
+            // destination masks are not valid on a compute-only queue
+            std::array<VkCommandBuffer, 2> computeBuffers{};
+            uint32_t computeBufferCount = 0;
+            VkPipelineStageFlags computeWaitStages = 0;
+
+            if (cullPassActive_) {
+                if (vkEndCommandBuffer(cullCommandBuffer_) != VK_SUCCESS) {
+                    throw std::runtime_error("Failed to record cull command buffer!");
+                }
+                computeBuffers[computeBufferCount++] = cullCommandBuffer_;
+                computeWaitStages |= cullToDrawBarrier_.dstStageMask;
+            }
+            if (particlePassActive_) {
+                if (vkEndCommandBuffer(particleCommandBuffer_) != VK_SUCCESS) {
+                    throw std::runtime_error("Failed to record particle command buffer!");
+                }
+                computeBuffers[computeBufferCount++] = particleCommandBuffer_;
+                computeWaitStages |= PARTICLE_DRAW_WAIT_STAGES;
+            }
+
+            uint64_t computeSignalValue = ++computeTimelineValue_;
+            VkTimelineSemaphoreSubmitInfo computeTimelineInfo{};
+            computeTimelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            computeTimelineInfo.signalSemaphoreValueCount = 1;
+            computeTimelineInfo.pSignalSemaphoreValues = &computeSignalValue;
+
+            VkSubmitInfo computeSubmitInfo{};
+            computeSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            computeSubmitInfo.pNext = &computeTimelineInfo;
+            computeSubmitInfo.commandBufferCount = computeBufferCount;
+            computeSubmitInfo.pCommandBuffers = computeBuffers.data();
+            computeSubmitInfo.signalSemaphoreCount = 1;
+            computeSubmitInfo.pSignalSemaphores = &computeTimeline_;
+            if (vkQueueSubmit(computeQueue_, 1, &computeSubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to submit compute command buffers!");
+            }
+
+            waitSemaphores[waitSemaphoreCount] = computeTimeline_;
+            waitStages[waitSemaphoreCount] = computeWaitStages;
+            waitValues[waitSemaphoreCount] = computeSignalValue;
+            ++waitSemaphoreCount;
+        } else {
+            if (cullPassActive_) {
+                // Same-queue: masks come from the frame graph's compute ->
+                // draw hazard derivation (see buildFrameGraph), not
+                // hand-picked constants
+                VkMemoryBarrier cullBarrier{};
+                cullBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                cullBarrier.srcAccessMask = cullToDrawBarrier_.srcAccessMask;
+                cullBarrier.dstAccessMask = cullToDrawBarrier_.dstAccessMask;
+                vkCmdPipelineBarrier(cullCommandBuffer_,
+                                    cullToDrawBarrier_.srcStageMask,
+                                    cullToDrawBarrier_.dstStageMask,
+                                    0, 1, &cullBarrier, 0, nullptr, 0, nullptr);
+
+                if (vkEndCommandBuffer(cullCommandBuffer_) != VK_SUCCESS) {
+                    throw std::runtime_error("Failed to record cull command buffer!");
+                }
+                submitBuffers[submitBufferCount++] = cullCommandBuffer_;
+            }
+            if (particlePassActive_) {
+                VkMemoryBarrier particleBarrier{};
+                particleBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                particleBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+                particleBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+                vkCmdPipelineBarrier(particleCommandBuffer_,
+                                    VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                    PARTICLE_DRAW_WAIT_STAGES,
+                                    0, 1, &particleBarrier, 0, nullptr, 0, nullptr);
+
+                if (vkEndCommandBuffer(particleCommandBuffer_) != VK_SUCCESS) {
+                    throw std::runtime_error("Failed to record particle command buffer!");
+                }
+                submitBuffers[submitBufferCount++] = particleCommandBuffer_;
+            }
+        }
+    }
+
+    // Graphics signals its timeline (CPU frame wait) and the binary
+    // present semaphore in the same submit; wait/signal values line up
+    // index-for-index with the semaphore arrays, binary entries ignored
+    uint64_t renderSignalValues[2] = {renderTimelineValue_ + 1, 0};
+    VkTimelineSemaphoreSubmitInfo graphicsTimelineInfo{};
+    graphicsTimelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    graphicsTimelineInfo.waitSemaphoreValueCount = waitSemaphoreCount;
+    graphicsTimelineInfo.pWaitSemaphoreValues = waitValues;
+    graphicsTimelineInfo.signalSemaphoreValueCount = 2;
+    graphicsTimelineInfo.pSignalSemaphoreValues = renderSignalValues;
+
+    submitInfo.pNext = &graphicsTimelineInfo;
+    submitInfo.waitSemaphoreCount = waitSemaphoreCount;
     submitInfo.pWaitSemaphores = waitSemaphores;
     submitInfo.pWaitDstStageMask = waitStages;
 
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &commandBuffers_[currentImageIndex_];
+    // Close the depth pre-pass (if one was recorded) and submit it ahead
+    // of the shaded pass; the depth-load render pass's external dependency
+    // orders the depth writes against the shaded pass's depth tests
+    if (prePassActive_) {
+        vkCmdEndRenderPass(prePassCommandBuffer_);
+        if (vkEndCommandBuffer(prePassCommandBuffer_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to record depth pre-pass command buffer!");
+        }
+        submitBuffers[submitBufferCount++] = prePassCommandBuffer_;
+    }
+    submitBuffers[submitBufferCount++] = commandBuffers_[currentImageIndex_];
 
-    VkSemaphore signalSemaphores[] = {renderFinishedSemaphore_};
-    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.commandBufferCount = submitBufferCount;
+    submitInfo.pCommandBuffers = submitBuffers.data();
+
+    VkSemaphore signalSemaphores[] = {renderTimeline_, renderFinishedSemaphore_};
+    submitInfo.signalSemaphoreCount = 2;
     submitInfo.pSignalSemaphores = signalSemaphores;
 
-    if (vkQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFence_) != VK_SUCCESS) {
+    if (vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
         throw std::runtime_error("Failed to submit draw command buffer!");
     }
+    ++renderTimelineValue_;
+
+    // Frame capture rides between render and present: the copy submit
+    // consumes the render's binary semaphore and present waits on the
+    // capture semaphore instead, so the image is back in PRESENT_SRC
+    // before the presentation engine touches it
+    VkSemaphore presentWaitSemaphore = renderFinishedSemaphore_;
+    if (captureActive_ && submitFrameCapture(currentImageIndex_)) {
+        presentWaitSemaphore = captureSemaphore_;
+    }
 
     // Present the frame
     VkPresentInfoKHR presentInfo{};
     presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     presentInfo.waitSemaphoreCount = 1;
-    presentInfo.pWaitSemaphores = signalSemaphores;
+    presentInfo.pWaitSemaphores = &presentWaitSemaphore;
 
     VkSwapchainKHR swapChains[] = {swapChain_};
     presentInfo.swapchainCount = 1;
     presentInfo.pSwapchains = swapChains;
     presentInfo.pImageIndices = &currentImageIndex_;
 
+    // Time the present call: under FIFO back-pressure this is where the
+    // CPU blocks waiting for vblank, which the Inspector surfaces
+    auto presentStart = std::chrono::high_resolution_clock::now();
     VkResult result = vkQueuePresentKHR(graphicsQueue_, &presentInfo);
+    presentStats_.presentWaitMs = std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - presentStart).count();
 
     if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
         handleWindowResize(window_->getWidth(), window_->getHeight());
@@ -424,130 +1040,715 @@ void VulkanRenderer::endECSFrame() {
         throw std::runtime_error("Failed to present swapchain image!");
     }
 
+    applyFrameRateLimit();
+
+    // Publish a stable copy of this frame's tallies; readers (Inspector,
+    // benchmark harness) poll between frames and must never see a
+    // half-accumulated struct
+    lastFrameRenderStats_ = frameRenderStats_;
+
+    cullPassActive_ = false;
+    particlePassActive_ = false;
+    prePassActive_ = false;
+    parallelFrameActive_ = false;
     ecsFrameActive_ = false;
 }
 
 // =============================================================================
-// PHASE 7.1: Instanced Rendering Implementation
-// GPU instancing for massive creature rendering
+// Asynchronous Frame Capture
+// Swapchain readback ring for footage recording and visual regression
 // =============================================================================
 
-void VulkanRenderer::renderInstanced(const std::string& meshPath,
-                                    const void* instanceData,
-                                    uint32_t instanceCount,
-                                    uint32_t baseMaterialId) {
-    if (!ecsFrameActive_) {
-        VKMON_ERROR("ECS frame not active! Call beginECSFrame() first.");
-        return;
+bool VulkanRenderer::startFrameCapture(FrameCaptureCallback consumer) {
+    if (captureActive_) {
+        VKMON_WARNING("Frame capture already active - ignoring start request");
+        return false;
     }
-
-    if (instanceCount == 0) {
-        return; // Nothing to render
+    if (!consumer) {
+        VKMON_ERROR("Frame capture requires a consumer callback");
+        return false;
     }
 
-    // Validate instance data pointer and size alignment
-    if (!instanceData) {
-        VKMON_ERROR("GPU Instancing: instanceData is null");
-        return;
+    // The readback copy is tightly packed 4-byte pixels; every format
+    // the surface negotiation picks (BGRA8/RGBA8 variants) qualifies
+    if (swapChainImageFormat_ != VK_FORMAT_B8G8R8A8_SRGB &&
+        swapChainImageFormat_ != VK_FORMAT_B8G8R8A8_UNORM &&
+        swapChainImageFormat_ != VK_FORMAT_R8G8B8A8_SRGB &&
+        swapChainImageFormat_ != VK_FORMAT_R8G8B8A8_UNORM) {
+        VKMON_ERROR("Frame capture unsupported for swapchain format " +
+                    std::to_string(swapChainImageFormat_));
+        return false;
     }
 
-    // Verify alignment - InstanceData must be 16-byte aligned for GPU
-    if (reinterpret_cast<uintptr_t>(instanceData) % 16 != 0) {
-        VKMON_ERROR("GPU Instancing: instanceData is not properly aligned (must be 16-byte aligned)");
-        return;
+    if (!createFrameCaptureResources()) {
+        destroyFrameCaptureResources();
+        return false;
     }
 
-    #ifdef DEBUG_VERBOSE
-    VKMON_DEBUG("GPU Instancing: Rendering " + std::to_string(instanceCount) + " instances of " + meshPath);
-    #endif
-
-    // Direct cast after validation - avoid unnecessary copy
-    const auto* instances = static_cast<const InstanceData*>(instanceData);
+    captureCallback_ = std::move(consumer);
+    captureFrameCounter_ = 0;
+    captureDroppedFrames_ = 0;
+    captureStopRequested_ = false;
+    captureThread_ = std::thread(&VulkanRenderer::captureConsumerLoop, this);
+    captureActive_ = true;
 
-    // Update instance buffer directly from validated pointer - no vector copy
-    updateInstanceDataDirect(instances, instanceCount);
+    VKMON_INFO("Frame capture started: " + std::to_string(captureExtent_.width) + "x" +
+               std::to_string(captureExtent_.height) + ", ring depth " +
+               std::to_string(CAPTURE_RING_SIZE));
+    return true;
+}
 
-    // Ensure mesh is loaded
-    ensureMeshLoaded(meshPath);
+void VulkanRenderer::stopFrameCapture() {
+    if (!captureActive_) {
+        return;
+    }
 
-    // Find cached model and render all instances with GPU instancing
-    std::shared_ptr<Model> model;
+    // Flag first so no further copies are submitted, then let the
+    // consumer drain every in-flight slot before joining
+    captureActive_ = false;
     {
-        std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
-        auto modelIt = modelCache_.find(meshPath);
-        if (modelIt != modelCache_.end()) {
-            model = modelIt->second;
-        }
+        std::lock_guard<std::mutex> lock(captureMutex_);
+        captureStopRequested_ = true;
+    }
+    captureCondition_.notify_all();
+    if (captureThread_.joinable()) {
+        captureThread_.join();
     }
+    captureCallback_ = nullptr;
 
-    if (model && !model->meshes.empty()) {
-        // Get current command buffer
-        VkCommandBuffer commandBuffer = commandBuffers_[currentImageIndex_];
+    destroyFrameCaptureResources();
 
-        // Bind instanced graphics pipeline
-        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, instancedGraphicsPipeline_);
+    VKMON_INFO("Frame capture stopped: " + std::to_string(captureFrameCounter_) +
+               " frames delivered, " + std::to_string(captureDroppedFrames_.load()) +
+               " dropped");
+}
 
-        // Bind global descriptor set (set 0)
-        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
-                               0, 1, &globalDescriptorSet_, 0, nullptr);
+bool VulkanRenderer::createFrameCaptureResources() {
+    captureExtent_ = swapChainExtent_;
+    VkDeviceSize bufferSize = static_cast<VkDeviceSize>(captureExtent_.width) *
+                              captureExtent_.height * 4;
 
-        // Bind material-specific descriptor set (set 1)
-        if (materialSystem_ && baseMaterialId < materialSystem_->getMaterialCount()) {
-            VkDescriptorSet materialDescriptorSet = materialSystem_->getDescriptorSet(baseMaterialId);
-            if (materialDescriptorSet != VK_NULL_HANDLE) {
-                vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
-                                       1, 1, &materialDescriptorSet, 0, nullptr);
-            }
-        }
+    VkSemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    if (vkCreateSemaphore(device_, &semaphoreInfo, nullptr, &captureSemaphore_) != VK_SUCCESS) {
+        VKMON_ERROR("Failed to create frame capture semaphore");
+        return false;
+    }
 
-        // Render each mesh with instancing
-        for (const auto& mesh : model->meshes) {
-            // Bind vertex buffers: [0] = vertex data, [1] = instance data
-            VkBuffer vertexBuffers[] = {mesh->vertexBuffer->getBuffer(), instanceBuffer_};
-            VkDeviceSize offsets[] = {0, 0};
-            vkCmdBindVertexBuffers(commandBuffer, 0, 2, vertexBuffers, offsets);
+    for (CaptureSlot& slot : captureSlots_) {
+        createBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                     slot.buffer, slot.memory);
+        if (vkMapMemory(device_, slot.memory, 0, bufferSize, 0, &slot.mapped) != VK_SUCCESS) {
+            VKMON_ERROR("Failed to map frame capture readback buffer");
+            return false;
+        }
 
-            // Bind index buffer
-            vkCmdBindIndexBuffer(commandBuffer, mesh->indexBuffer->getBuffer(), 0, VK_INDEX_TYPE_UINT32);
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        if (vkCreateFence(device_, &fenceInfo, nullptr, &slot.fence) != VK_SUCCESS) {
+            VKMON_ERROR("Failed to create frame capture fence");
+            return false;
+        }
 
-            // CRITICAL: GPU Instanced draw call - this renders ALL instances in one draw call!
-            vkCmdDrawIndexed(commandBuffer,
-                            static_cast<uint32_t>(mesh->indices.size()),  // indexCount
-                            instanceCount,                                 // instanceCount - THE MAGIC!
-                            0,                                            // firstIndex
-                            0,                                            // vertexOffset
-                            currentInstanceOffset_);                      // firstInstance - USE OFFSET!
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = commandPool_;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(device_, &allocInfo, &slot.commandBuffer) != VK_SUCCESS) {
+            VKMON_ERROR("Failed to allocate frame capture command buffer");
+            return false;
         }
-        #ifdef DEBUG_VERBOSE
-        VKMON_DEBUG("GPU: Successfully submitted " + std::to_string(instanceCount) + " instances in 1 draw call");
-        #endif
 
-        // Update offset for next batch
-        currentInstanceOffset_ += instanceCount;
-    } else {
-        VKMON_WARNING("No model cached for instanced meshPath: " + meshPath);
+        slot.inFlight = false;
     }
+    return true;
 }
 
-void VulkanRenderer::renderInstancedCreatures(const std::string& meshPath,
-                                            const std::vector<VulkanMon::InstanceData>& instances,
-                                            uint32_t baseMaterialId) {
-    if (instances.empty()) {
-        return;
-    }
+void VulkanRenderer::destroyFrameCaptureResources() {
+    // The consumer thread is joined by now, but a final copy may still
+    // be executing on the queue - wait before pulling buffers out
+    vkDeviceWaitIdle(device_);
 
-    renderInstanced(meshPath, instances.data(), static_cast<uint32_t>(instances.size()), baseMaterialId);
+    for (CaptureSlot& slot : captureSlots_) {
+        if (slot.commandBuffer != VK_NULL_HANDLE) {
+            vkFreeCommandBuffers(device_, commandPool_, 1, &slot.commandBuffer);
+            slot.commandBuffer = VK_NULL_HANDLE;
+        }
+        if (slot.fence != VK_NULL_HANDLE) {
+            vkDestroyFence(device_, slot.fence, nullptr);
+            slot.fence = VK_NULL_HANDLE;
+        }
+        if (slot.mapped) {
+            vkUnmapMemory(device_, slot.memory);
+            slot.mapped = nullptr;
+        }
+        if (slot.buffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device_, slot.buffer, nullptr);
+            slot.buffer = VK_NULL_HANDLE;
+        }
+        if (slot.memory != VK_NULL_HANDLE) {
+            vkFreeMemory(device_, slot.memory, nullptr);
+            slot.memory = VK_NULL_HANDLE;
+        }
+        slot.inFlight = false;
+    }
+    if (captureSemaphore_ != VK_NULL_HANDLE) {
+        vkDestroySemaphore(device_, captureSemaphore_, nullptr);
+        captureSemaphore_ = VK_NULL_HANDLE;
+    }
+    captureCompletedQueue_.clear();
 }
 
-void VulkanRenderer::ensureMeshLoaded(const std::string& meshPath) {
-    // Check if model is already cached
+bool VulkanRenderer::submitFrameCapture(uint32_t imageIndex) {
+    // Claim a free ring slot; when the consumer has fallen a full ring
+    // behind, drop this frame rather than stall the frame loop
+    uint32_t slotIndex = CAPTURE_RING_SIZE;
+    {
+        std::lock_guard<std::mutex> lock(captureMutex_);
+        for (uint32_t i = 0; i < CAPTURE_RING_SIZE; ++i) {
+            if (!captureSlots_[i].inFlight) {
+                slotIndex = i;
+                captureSlots_[i].inFlight = true;
+                captureSlots_[i].frameNumber = captureFrameCounter_++;
+                break;
+            }
+        }
+    }
+    if (slotIndex == CAPTURE_RING_SIZE) {
+        captureDroppedFrames_.fetch_add(1);
+        return false;
+    }
+
+    CaptureSlot& slot = captureSlots_[slotIndex];
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(slot.commandBuffer, &beginInfo);
+
+    // PRESENT_SRC -> TRANSFER_SRC; prior writes are ordered by the
+    // semaphore wait on the render submit, so no srcAccessMask needed
+    VkImageMemoryBarrier toTransfer{};
+    toTransfer.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    toTransfer.oldLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    toTransfer.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    toTransfer.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    toTransfer.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    toTransfer.image = swapChainImages_[imageIndex];
+    toTransfer.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    toTransfer.srcAccessMask = 0;
+    toTransfer.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    vkCmdPipelineBarrier(slot.commandBuffer,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &toTransfer);
+
+    VkBufferImageCopy region{};
+    region.bufferRowLength = 0;   // tightly packed
+    region.bufferImageHeight = 0;
+    region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageExtent = {captureExtent_.width, captureExtent_.height, 1};
+    vkCmdCopyImageToBuffer(slot.commandBuffer, swapChainImages_[imageIndex],
+                           VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot.buffer, 1, &region);
+
+    // Back to PRESENT_SRC for the presentation engine
+    VkImageMemoryBarrier toPresent = toTransfer;
+    toPresent.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    toPresent.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    toPresent.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    toPresent.dstAccessMask = 0;
+    vkCmdPipelineBarrier(slot.commandBuffer,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &toPresent);
+
+    vkEndCommandBuffer(slot.commandBuffer);
+
+    VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.waitSemaphoreCount = 1;
+    submitInfo.pWaitSemaphores = &renderFinishedSemaphore_;
+    submitInfo.pWaitDstStageMask = &waitStage;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &slot.commandBuffer;
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores = &captureSemaphore_;
+
+    if (vkQueueSubmit(graphicsQueue_, 1, &submitInfo, slot.fence) != VK_SUCCESS) {
+        VKMON_ERROR("Failed to submit frame capture copy");
+        std::lock_guard<std::mutex> lock(captureMutex_);
+        slot.inFlight = false;
+        return false;
+    }
+
+    // Hand the slot to the consumer thread; it blocks on the fence, not
+    // the frame loop
+    {
+        std::lock_guard<std::mutex> lock(captureMutex_);
+        captureCompletedQueue_.push_back(slotIndex);
+    }
+    captureCondition_.notify_one();
+    return true;
+}
+
+void VulkanRenderer::captureConsumerLoop() {
+    while (true) {
+        uint32_t slotIndex;
+        {
+            std::unique_lock<std::mutex> lock(captureMutex_);
+            captureCondition_.wait(lock, [this] {
+                return !captureCompletedQueue_.empty() || captureStopRequested_;
+            });
+            if (captureCompletedQueue_.empty()) {
+                break;   // stop requested and every slot delivered
+            }
+            slotIndex = captureCompletedQueue_.front();
+            captureCompletedQueue_.pop_front();
+        }
+
+        CaptureSlot& slot = captureSlots_[slotIndex];
+        vkWaitForFences(device_, 1, &slot.fence, VK_TRUE, UINT64_MAX);
+        vkResetFences(device_, 1, &slot.fence);
+
+        CapturedFrame frame;
+        frame.pixels = static_cast<const uint8_t*>(slot.mapped);
+        frame.width = captureExtent_.width;
+        frame.height = captureExtent_.height;
+        frame.format = swapChainImageFormat_;
+        frame.frameNumber = slot.frameNumber;
+        captureCallback_(frame);
+
+        std::lock_guard<std::mutex> lock(captureMutex_);
+        slot.inFlight = false;
+    }
+}
+
+// =============================================================================
+// PHASE 7.1: Instanced Rendering Implementation
+// GPU instancing for massive creature rendering
+// =============================================================================
+
+void VulkanRenderer::renderInstanced(const std::string& meshPath,
+                                    const void* instanceData,
+                                    uint32_t instanceCount,
+                                    uint32_t baseMaterialId) {
+    renderInstancedWithPipeline(AssetID::intern(meshPath), instanceData, instanceCount,
+                               baseMaterialId, instancedGraphicsPipeline_, true);
+}
+
+void VulkanRenderer::renderInstancedWithPipeline(AssetID meshId,
+                                                const void* instanceData,
+                                                uint32_t instanceCount,
+                                                uint32_t baseMaterialId,
+                                                VkPipeline pipeline,
+                                                bool participateInPrePass) {
+    if (!ecsFrameActive_) {
+        VKMON_ERROR("ECS frame not active! Call beginECSFrame() first.");
+        return;
+    }
+
+    if (instanceCount == 0) {
+        return; // Nothing to render
+    }
+
+    // Validate instance data pointer and size alignment
+    if (!instanceData) {
+        VKMON_ERROR("GPU Instancing: instanceData is null");
+        return;
+    }
+
+    // Verify alignment - InstanceData must be 16-byte aligned for GPU
+    if (reinterpret_cast<uintptr_t>(instanceData) % 16 != 0) {
+        VKMON_ERROR("GPU Instancing: instanceData is not properly aligned (must be 16-byte aligned)");
+        return;
+    }
+
+    #ifdef DEBUG_VERBOSE
+    VKMON_DEBUG("GPU Instancing: Rendering " + std::to_string(instanceCount) + " instances of " + meshId.str());
+    #endif
+
+    // Instanced batches are few per frame; with parallel recording they
+    // record into the trailing secondary since the primary's render pass
+    // only accepts executed secondaries
+    VkCommandBuffer targetCommandBuffer = parallelFrameActive_ ? tailSecondaries_[currentFrameInFlight_]
+                                                               : commandBuffers_[currentImageIndex_];
+
+    // First instanced batch marks the main-pass / instanced-pass boundary
+    if (gpuTimingSupported_ && !instancedMarkerWritten_) {
+        vkCmdWriteTimestamp(targetCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                           timestampQueryPool_, 1);
+        instancedMarkerWritten_ = true;
+    }
+
+    // Direct cast after validation - avoid unnecessary copy
+    const auto* instances = static_cast<const InstanceData*>(instanceData);
+
+    // Update instance buffer directly from validated pointer - no vector
+    // copy. Past the primary buffer's capacity the batch lands in a
+    // chained overflow block; the placement tells us which buffer to bind
+    InstanceWriteResult placement = updateInstanceDataDirect(instances, instanceCount);
+    if (placement.written == 0) {
+        return; // batch dropped (hard cap or allocation failure), already logged
+    }
+    instanceCount = placement.written;
+
+    // Ensure mesh is loaded
+    ensureMeshLoaded(meshId);
+
+    // Find cached model and render all instances with GPU instancing
+    std::shared_ptr<Model> model;
+    {
+        std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
+        auto modelIt = modelCache_.find(meshId);
+        if (modelIt != modelCache_.end()) {
+            model = modelIt->second;
+        }
+    }
+
+    if (model && !model->meshes.empty()) {
+        // Get current command buffer
+        VkCommandBuffer commandBuffer = targetCommandBuffer;
+
+        // Bind the requested instanced pipeline variant
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+        frameRenderStats_.pipelineBinds++;
+
+        if (prePassActive_ && participateInPrePass) {
+            vkCmdBindPipeline(prePassCommandBuffer_, VK_PIPELINE_BIND_POINT_GRAPHICS, depthPrePassInstancedPipeline_);
+        }
+
+        // Bind global descriptor set (set 0)
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
+                               0, 1, &globalDescriptorSets_[currentFrameInFlight_], 0, nullptr);
+        frameRenderStats_.descriptorBinds++;
+
+        // Bind material-specific descriptor set (set 1); invalidate the
+        // per-object path's material tracking since set 1 changed
+        if (materialSystem_ && baseMaterialId < materialSystem_->getMaterialCount()) {
+            VkDescriptorSet materialDescriptorSet = materialSystem_->getDescriptorSet(baseMaterialId);
+            if (materialDescriptorSet != VK_NULL_HANDLE) {
+                uint32_t dynamicOffset = materialSystem_->getDynamicOffset(baseMaterialId);
+                vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
+                                       1, 1, &materialDescriptorSet, 1, &dynamicOffset);
+                boundMaterialId_ = NO_MATERIAL_BOUND;
+                frameRenderStats_.descriptorBinds++;
+            }
+        }
+
+        // Render each mesh with instancing
+        for (size_t meshIndex = 0; meshIndex < model->meshes.size(); ++meshIndex) {
+            const auto& mesh = model->meshes[meshIndex];
+            bool slotAvailable = indirectCommandBufferMapped_.isValid() &&
+                                 currentIndirectDrawCount_ < maxIndirectDraws_;
+
+            // GPU culling compacts each batch exactly once; secondary
+            // meshes of a multi-mesh model draw the full instance range
+            // uncompacted so two dispatches never race on one culled
+            // region. Overflow batches always skip compaction - the cull
+            // descriptors and compacted buffer only cover the primary
+            bool gpuCullThisDraw = cullPassActive_ && slotAvailable && meshIndex == 0 &&
+                                   placement.inPrimaryBuffer &&
+                                   placement.firstInstance + instanceCount <= culledInstanceCapacity_;
+
+            // Bind vertex buffers: [0] = vertex data, [1] = instance data
+            // (the compute-compacted copy when this draw is GPU culled)
+            VkBuffer sourceInstanceBuffer = gpuCullThisDraw ? culledInstanceBuffer_
+                                                            : placement.buffer;
+            VkBuffer vertexBuffers[] = {mesh->vertexBufferHandle, sourceInstanceBuffer};
+            VkDeviceSize offsets[] = {0, 0};
+            vkCmdBindVertexBuffers(commandBuffer, 0, 2, vertexBuffers, offsets);
+
+            // Bind index buffer
+            vkCmdBindIndexBuffer(commandBuffer, mesh->indexBufferHandle, 0, VK_INDEX_TYPE_UINT32);
+
+            // This path rebinds unconditionally (the instance buffer varies
+            // per draw), so invalidate the non-instanced path's bind tracking
+            boundVertexBuffer_ = VK_NULL_HANDLE;
+            boundIndexBuffer_ = VK_NULL_HANDLE;
+
+            if (prePassActive_ && participateInPrePass) {
+                // The pre-pass draws the full uncompacted instance range;
+                // GPU culling only compacts the shaded draw, and redundant
+                // depth writes are far cheaper than redundant shading
+                VkBuffer prePassVertexBuffers[] = {mesh->vertexBufferHandle, placement.buffer};
+                VkDeviceSize prePassOffsets[] = {0, 0};
+                vkCmdBindVertexBuffers(prePassCommandBuffer_, 0, 2, prePassVertexBuffers, prePassOffsets);
+                vkCmdBindIndexBuffer(prePassCommandBuffer_, mesh->indexBufferHandle, 0, VK_INDEX_TYPE_UINT32);
+                prePassBoundVertexBuffer_ = VK_NULL_HANDLE;
+                prePassBoundIndexBuffer_ = VK_NULL_HANDLE;
+                vkCmdDrawIndexed(prePassCommandBuffer_, static_cast<uint32_t>(mesh->indexCount()),
+                                instanceCount, mesh->firstIndex, mesh->baseVertex, placement.firstInstance);
+            }
+
+            // Tally what the CPU submits; GPU culling may shade fewer
+            // instances than this, but the submission count is what
+            // batching work needs to prove itself against
+            frameRenderStats_.drawCalls++;
+            frameRenderStats_.instancesSubmitted += instanceCount;
+            frameRenderStats_.trianglesSubmitted += (mesh->indexCount() / 3) * static_cast<uint64_t>(instanceCount);
+
+            if (slotAvailable) {
+                // Write this batch's draw parameters into the indirect
+                // command table and let the GPU read them at draw time.
+                // The CPU cost per batch is one 20-byte buffer write,
+                // and the GPU culling pass rewrites instanceCount in
+                // place without touching the command buffer.
+                VkDrawIndexedIndirectCommand command{};
+                command.indexCount = static_cast<uint32_t>(mesh->indexCount());
+                command.instanceCount = gpuCullThisDraw ? 0 : instanceCount;
+                command.firstIndex = mesh->firstIndex;
+                command.vertexOffset = mesh->baseVertex;
+                command.firstInstance = placement.firstInstance;
+
+                VkDeviceSize commandOffset = currentIndirectDrawCount_ * sizeof(VkDrawIndexedIndirectCommand);
+                memcpy(static_cast<char*>(indirectCommandBufferMapped_.get()) + commandOffset,
+                       &command, sizeof(command));
+
+                if (gpuCullThisDraw) {
+                    // One dispatch per batch: test every instance against
+                    // the frame frustum and compact survivors while
+                    // bumping this command slot's instanceCount
+                    CullPushConstants push{};
+                    for (int i = 0; i < 6; ++i) {
+                        push.frustumPlanes[i] = cullFrustumPlanes_[i];
+                    }
+                    push.firstInstance = placement.firstInstance;
+                    push.instanceCount = instanceCount;
+                    push.commandSlot = currentIndirectDrawCount_;
+                    push.boundingRadius = DEFAULT_INSTANCE_CULL_RADIUS;
+
+                    vkCmdPushConstants(cullCommandBuffer_, cullPipelineLayout_,
+                                      VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(push), &push);
+                    constexpr uint32_t WORKGROUP_SIZE = 64; // matches local_size_x in creature_cull.comp
+                    vkCmdDispatch(cullCommandBuffer_, (instanceCount + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE, 1, 1);
+                }
+
+                vkCmdDrawIndexedIndirect(commandBuffer,
+                                        indirectCommandBuffer_,
+                                        commandOffset,
+                                        1,                                        // drawCount
+                                        sizeof(VkDrawIndexedIndirectCommand));    // stride
+                currentIndirectDrawCount_++;
+            } else {
+                // Fallback: command table exhausted (or not yet created) -
+                // encode the draw parameters directly
+                if (currentIndirectDrawCount_ >= maxIndirectDraws_) {
+                    VKMON_WARNING("Indirect command table full (" + std::to_string(maxIndirectDraws_) +
+                                 " draws) - falling back to direct draw encoding");
+                }
+                vkCmdDrawIndexed(commandBuffer,
+                                static_cast<uint32_t>(mesh->indexCount()),  // indexCount
+                                instanceCount,                                 // instanceCount
+                                mesh->firstIndex,                             // firstIndex
+                                mesh->baseVertex,                             // vertexOffset
+                                placement.firstInstance);                     // firstInstance
+            }
+        }
+        #ifdef DEBUG_VERBOSE
+        VKMON_DEBUG("GPU: Successfully submitted " + std::to_string(instanceCount) + " instances in 1 draw call");
+        #endif
+    } else {
+        VKMON_WARNING("No model cached for instanced meshPath: " + meshId.str());
+    }
+}
+
+void VulkanRenderer::renderInstancedCreatures(AssetID meshId,
+                                            const std::vector<VulkanMon::InstanceData>& instances,
+                                            uint32_t baseMaterialId) {
+    if (instances.empty()) {
+        return;
+    }
+
+    renderInstancedWithPipeline(meshId, instances.data(), static_cast<uint32_t>(instances.size()),
+                               baseMaterialId, instancedGraphicsPipeline_, true);
+}
+
+void VulkanRenderer::renderInstancedCreatures(const std::string& meshPath,
+                                            const std::vector<VulkanMon::InstanceData>& instances,
+                                            uint32_t baseMaterialId) {
+    renderInstancedCreatures(AssetID::intern(meshPath), instances, baseMaterialId);
+}
+
+void VulkanRenderer::renderInstancedGrass(const std::string& meshPath,
+                                         const std::vector<VulkanMon::InstanceData>& instances,
+                                         uint32_t baseMaterialId) {
+    if (instances.empty()) {
+        return;
+    }
+
+    // Grass never joins the depth pre-pass: the pre-pass vertex shader has
+    // no wind displacement, so its depth would mismatch the swaying blades
+    // and the LESS_OR_EQUAL shaded draw would drop fragments
+    renderInstancedWithPipeline(AssetID::intern(meshPath), instances.data(),
+                               static_cast<uint32_t>(instances.size()),
+                               baseMaterialId, grassGraphicsPipeline_, false);
+}
+
+uint32_t VulkanRenderer::bakeInstanceBuffer(const std::vector<VulkanMon::InstanceData>& instances,
+                                           const std::string& debugName) {
+    if (instances.empty()) {
+        VKMON_WARNING("bakeInstanceBuffer: no instances to bake for " + debugName);
+        return INVALID_BAKED_BUFFER;
+    }
+    if (!transferManager_) {
+        VKMON_ERROR("bakeInstanceBuffer: TransferManager unavailable, cannot stage " + debugName);
+        return INVALID_BAKED_BUFFER;
+    }
+
+    BakedInstanceBuffer baked{};
+    baked.instanceCount = static_cast<uint32_t>(instances.size());
+    VkDeviceSize bufferSize = sizeof(VulkanMon::InstanceData) * instances.size();
+
+    createBuffer(bufferSize,
+                VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                baked.buffer, baked.memory);
+
+    transferManager_->uploadBuffer(instances.data(), bufferSize, baked.buffer, 0, debugName);
+    VKMON_INFO("Baked " + std::to_string(instances.size()) + " instances into device-local buffer: " + debugName);
+
+    // Reuse a slot freed by destroyBakedInstanceBuffer before growing
+    for (uint32_t handle = 0; handle < bakedInstanceBuffers_.size(); ++handle) {
+        if (bakedInstanceBuffers_[handle].buffer == VK_NULL_HANDLE) {
+            bakedInstanceBuffers_[handle] = baked;
+            return handle;
+        }
+    }
+    bakedInstanceBuffers_.push_back(baked);
+    return static_cast<uint32_t>(bakedInstanceBuffers_.size() - 1);
+}
+
+void VulkanRenderer::destroyBakedInstanceBuffer(uint32_t handle) {
+    if (handle >= bakedInstanceBuffers_.size() ||
+        bakedInstanceBuffers_[handle].buffer == VK_NULL_HANDLE) {
+        return;
+    }
+
+    // Rebaking is a load-time or editor event, so a full idle wait is the
+    // simple safe choice over per-frame deferred destruction
+    vkDeviceWaitIdle(device_);
+
+    vkDestroyBuffer(device_, bakedInstanceBuffers_[handle].buffer, nullptr);
+    vkFreeMemory(device_, bakedInstanceBuffers_[handle].memory, nullptr);
+    bakedInstanceBuffers_[handle] = BakedInstanceBuffer{};
+}
+
+void VulkanRenderer::renderGrassFromBakedBuffer(const std::string& meshPath,
+                                               uint32_t bakedBufferHandle,
+                                               uint32_t firstInstance,
+                                               uint32_t instanceCount,
+                                               uint32_t baseMaterialId) {
+    if (!ecsFrameActive_) {
+        VKMON_ERROR("ECS frame not active! Call beginECSFrame() first.");
+        return;
+    }
+    if (instanceCount == 0) {
+        return;
+    }
+    if (bakedBufferHandle >= bakedInstanceBuffers_.size() ||
+        bakedInstanceBuffers_[bakedBufferHandle].buffer == VK_NULL_HANDLE) {
+        VKMON_ERROR("renderGrassFromBakedBuffer: invalid baked buffer handle " +
+                   std::to_string(bakedBufferHandle));
+        return;
+    }
+    const auto& baked = bakedInstanceBuffers_[bakedBufferHandle];
+    if (firstInstance + instanceCount > baked.instanceCount) {
+        VKMON_ERROR("renderGrassFromBakedBuffer: range exceeds baked buffer (" +
+                   std::to_string(firstInstance + instanceCount) + " > " +
+                   std::to_string(baked.instanceCount) + ")");
+        return;
+    }
+
+    VkCommandBuffer commandBuffer = parallelFrameActive_ ? tailSecondaries_[currentFrameInFlight_]
+                                                         : commandBuffers_[currentImageIndex_];
+
+    if (gpuTimingSupported_ && !instancedMarkerWritten_) {
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                           timestampQueryPool_, 1);
+        instancedMarkerWritten_ = true;
+    }
+
+    AssetID meshId = AssetID::intern(meshPath);
+    ensureMeshLoaded(meshId);
+
+    std::shared_ptr<Model> model;
+    {
+        std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
+        auto modelIt = modelCache_.find(meshId);
+        if (modelIt != modelCache_.end()) {
+            model = modelIt->second;
+        }
+    }
+    if (!model || model->meshes.empty()) {
+        VKMON_WARNING("No model cached for baked grass meshPath: " + meshPath);
+        return;
+    }
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, grassGraphicsPipeline_);
+    frameRenderStats_.pipelineBinds++;
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
+                           0, 1, &globalDescriptorSets_[currentFrameInFlight_], 0, nullptr);
+    frameRenderStats_.descriptorBinds++;
+
+    if (materialSystem_ && baseMaterialId < materialSystem_->getMaterialCount()) {
+        VkDescriptorSet materialDescriptorSet = materialSystem_->getDescriptorSet(baseMaterialId);
+        if (materialDescriptorSet != VK_NULL_HANDLE) {
+            uint32_t dynamicOffset = materialSystem_->getDynamicOffset(baseMaterialId);
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
+                                   1, 1, &materialDescriptorSet, 1, &dynamicOffset);
+            boundMaterialId_ = NO_MATERIAL_BOUND;
+            frameRenderStats_.descriptorBinds++;
+        }
+    }
+
+    for (const auto& mesh : model->meshes) {
+        // Binding 1 is the baked device-local buffer - no per-frame upload,
+        // the firstInstance offset selects the visible patch range
+        VkBuffer vertexBuffers[] = {mesh->vertexBufferHandle, baked.buffer};
+        VkDeviceSize offsets[] = {0, 0};
+        vkCmdBindVertexBuffers(commandBuffer, 0, 2, vertexBuffers, offsets);
+        vkCmdBindIndexBuffer(commandBuffer, mesh->indexBufferHandle, 0, VK_INDEX_TYPE_UINT32);
+        boundVertexBuffer_ = VK_NULL_HANDLE;
+        boundIndexBuffer_ = VK_NULL_HANDLE;
+
+        vkCmdDrawIndexed(commandBuffer,
+                        static_cast<uint32_t>(mesh->indexCount()),
+                        instanceCount,
+                        mesh->firstIndex,
+                        mesh->baseVertex,
+                        firstInstance);
+
+        frameRenderStats_.drawCalls++;
+        frameRenderStats_.instancesSubmitted += instanceCount;
+        frameRenderStats_.trianglesSubmitted += (mesh->indexCount() / 3) * static_cast<uint64_t>(instanceCount);
+    }
+}
+
+uint32_t VulkanRenderer::resolveCreatureLod(const std::string& meshPath, uint32_t desiredLod) {
+    if (!modelLoader_) {
+        return 0; // No loader means only the base mesh can exist
+    }
+    return modelLoader_->clampToAvailableLod(meshPath, desiredLod);
+}
+
+void VulkanRenderer::ensureMeshLoaded(AssetID meshId) {
+    // Check if model is already cached - the per-draw hot path ends here
+    // with a single integer-keyed lookup
     {
         std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
-        if (modelCache_.find(meshPath) != modelCache_.end()) {
+        if (modelCache_.find(meshId) != modelCache_.end()) {
             return; // Already loaded
         }
     }
 
+    // Load boundary - the path string comes back into play
+    const std::string& meshPath = meshId.str();
+
+    // Hitch detector: after warmup every load should have come from the
+    // manifest, so a lazy load here is eating frame time right now
+    auto lazyLoadStart = std::chrono::high_resolution_clock::now();
+
     // Load the model using ModelLoader
     if (modelLoader_) {
         try {
@@ -557,7 +1758,7 @@ void VulkanRenderer::ensureMeshLoaded(const std::string& meshPath) {
             if (model && !model->meshes.empty()) {
                 {
                     std::unique_lock<std::shared_mutex> lock(modelCacheMutex_);
-                    modelCache_[meshPath] = std::move(model);
+                    modelCache_[meshId] = std::move(model);
                 }
                 VKMON_INFO("Model loaded and cached: " + meshPath);
             } else {
@@ -566,7 +1767,7 @@ void VulkanRenderer::ensureMeshLoaded(const std::string& meshPath) {
                 if (currentModel_) {
                     {
                         std::unique_lock<std::shared_mutex> lock(modelCacheMutex_);
-                        modelCache_[meshPath] = currentModel_;
+                        modelCache_[meshId] = currentModel_;
                     }
                     VKMON_WARNING("Using fallback model for: " + meshPath);
                 }
@@ -577,7 +1778,7 @@ void VulkanRenderer::ensureMeshLoaded(const std::string& meshPath) {
             if (currentModel_) {
                 {
                     std::unique_lock<std::shared_mutex> lock(modelCacheMutex_);
-                    modelCache_[meshPath] = currentModel_;
+                    modelCache_[meshId] = currentModel_;
                 }
                 VKMON_WARNING("Using fallback model due to exception: " + meshPath);
             }
@@ -585,6 +1786,102 @@ void VulkanRenderer::ensureMeshLoaded(const std::string& meshPath) {
     } else {
         VKMON_ERROR("ModelLoader not available for loading: " + meshPath);
     }
+
+    if (sceneWarmupComplete_) {
+        auto lazyLoadMs = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - lazyLoadStart).count();
+        VKMON_WARNING("Lazy model load after scene warmup (" +
+                      std::to_string(lazyLoadMs) + "ms hitch): " + meshPath +
+                      " - add it to the scene's preload manifest");
+    }
+}
+
+size_t VulkanRenderer::preloadModels(const std::vector<std::string>& manifest) {
+    if (!modelLoader_) {
+        VKMON_ERROR("Cannot preload models: ModelLoader not available");
+        return 0;
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Phase 1 (parallel): cook every manifest entry on the worker pool.
+    // The cook pass is CPU and file IO only, so workers never race on
+    // GPU state; models already cooked return immediately.
+    JobSystem::getInstance().parallelFor(manifest.size(), 1,
+        [this, &manifest](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                modelLoader_->cookModel(manifest[i]);
+            }
+        }, JobPriority::Low);
+
+    // Phase 2 (this thread): upload through the cooked fast path - a
+    // mapped-blob copy into the geometry pools, no parsing left to do
+    size_t resident = 0;
+    for (const std::string& meshPath : manifest) {
+        AssetID meshId = AssetID::intern(meshPath);
+        ensureMeshLoaded(meshId);
+
+        std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
+        if (modelCache_.find(meshId) != modelCache_.end()) {
+            ++resident;
+        } else {
+            VKMON_ERROR("Preload manifest entry failed to load: " + meshPath);
+        }
+    }
+
+    sceneWarmupComplete_ = true;
+
+    auto totalMs = std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - startTime).count();
+    VKMON_INFO("Model cache warmup: " + std::to_string(resident) + "/" +
+               std::to_string(manifest.size()) + " models resident in " +
+               std::to_string(totalMs) + "ms");
+    return resident;
+}
+
+Task<size_t> VulkanRenderer::preloadModelsAsync(std::vector<std::string> manifest) {
+    if (!modelLoader_) {
+        VKMON_ERROR("Cannot preload models: ModelLoader not available");
+        co_return 0;
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Cook phase off the main thread. parallelFor from inside a worker is
+    // safe (the worker participates in its own chunk loop), so the fan-out
+    // still spreads across the pool.
+    co_await resumeOnWorker(JobPriority::Low);
+    JobSystem::getInstance().parallelFor(manifest.size(), 1,
+        [this, &manifest](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                modelLoader_->cookModel(manifest[i]);
+            }
+        }, JobPriority::Low);
+
+    // Upload phase must run where Vulkan submission lives - resume at
+    // the next main-thread pump and walk the cooked fast path there
+    co_await resumeOnMainThread();
+    size_t resident = 0;
+    for (const std::string& meshPath : manifest) {
+        AssetID meshId = AssetID::intern(meshPath);
+        ensureMeshLoaded(meshId);
+
+        std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
+        if (modelCache_.find(meshId) != modelCache_.end()) {
+            ++resident;
+        } else {
+            VKMON_ERROR("Preload manifest entry failed to load: " + meshPath);
+        }
+    }
+
+    sceneWarmupComplete_ = true;
+
+    auto totalMs = std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - startTime).count();
+    VKMON_INFO("Async model cache warmup: " + std::to_string(resident) + "/" +
+               std::to_string(manifest.size()) + " models resident in " +
+               std::to_string(totalMs) + "ms (overlapped)");
+    co_return resident;
 }
 
 bool VulkanRenderer::preloadModel(const std::string& meshPath) {
@@ -594,12 +1891,13 @@ bool VulkanRenderer::preloadModel(const std::string& meshPath) {
         VKMON_INFO("Preloading model: " + meshPath);
 
         // Use existing ensureMeshLoaded logic
-        ensureMeshLoaded(meshPath);
+        AssetID meshId = AssetID::intern(meshPath);
+        ensureMeshLoaded(meshId);
 
         // Verify successful loading by checking cache
         {
             std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
-            if (modelCache_.find(meshPath) == modelCache_.end()) {
+            if (modelCache_.find(meshId) == modelCache_.end()) {
                 VKMON_ERROR("Model preloading failed - not found in cache: " + meshPath);
                 return false;
             }
@@ -684,7 +1982,7 @@ bool VulkanRenderer::performGPUWarmup() {
 
         // Bind descriptor sets to trigger any lazy descriptor creation
         vkCmdBindDescriptorSets(warmupCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
-                               pipelineLayout_, 0, 1, &globalDescriptorSet_, 0, nullptr);
+                               pipelineLayout_, 0, 1, &globalDescriptorSets_[currentFrameInFlight_], 0, nullptr);
 
         // No actual draw calls needed - pipeline binding is the expensive part
 
@@ -736,7 +2034,9 @@ void VulkanRenderer::initVulkan() {
     createSwapChain();
     createRenderPass();
     createDescriptorSetLayout();
+    createBindlessTextureResources();
     createShaderModules();
+    createPipelineCache();
     createGraphicsPipeline();
 
     // Create instanced rendering pipeline (Phase 7.1)
@@ -752,6 +2052,11 @@ void VulkanRenderer::initVulkan() {
 
     // Create GPU instancing resources (Phase 7.1)
     createInstanceBuffer();
+    createIndirectCommandBuffer();
+    createCullComputeResources();
+    createParticleComputeResources();
+    createHiZResources();
+    createDepthPrePassResources();
     
     // Legacy test model removed - ECS provides test scene
     
@@ -760,14 +2065,17 @@ void VulkanRenderer::initVulkan() {
     createTextureImage();
     createTextureImageView();
     createTextureSampler();
+    registerBindlessTexture(textureImageView_, textureSampler_);  // slot 0 = default texture
     createDescriptorPool();
     createDescriptorSet();
     createGlobalDescriptorPool();
     createGlobalDescriptorSet();
     createCommandBuffers();
+    createParallelRecordingResources();
     recordCommandBuffers();
     createSyncObjects();
-    
+    createTimestampQueryPool();
+
     VKMON_INFO("Vulkan initialization completed");
 }
 
@@ -780,7 +2088,9 @@ void VulkanRenderer::createInstance() {
     appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
     appInfo.pEngineName = "VulkanMon Engine";
     appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-    appInfo.apiVersion = VK_API_VERSION_1_0;
+    // 1.2 promotes descriptor indexing to core, which backs the bindless
+    // texture array; the engine already documents Vulkan 1.3 class GPUs
+    appInfo.apiVersion = VK_API_VERSION_1_2;
 
     VkInstanceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
@@ -837,25 +2147,86 @@ void VulkanRenderer::createLogicalDevice() {
     if (graphicsQueueFamily == -1) {
         throw std::runtime_error("Failed to find graphics queue family!");
     }
+    graphicsQueueFamily_ = static_cast<uint32_t>(graphicsQueueFamily);
+
+    // Look for a dedicated transfer queue family so asset uploads can
+    // overlap rendering; transferQueueFamily_ falls back to the graphics
+    // family when the device has none
+    int transferQueueFamily = findTransferQueueFamily();
+    transferQueueFamily_ = (transferQueueFamily != -1)
+        ? static_cast<uint32_t>(transferQueueFamily)
+        : graphicsQueueFamily_;
+
+    // Look for a compute-only family: compute submitted there runs
+    // asynchronously against fragment-heavy graphics work, which is a
+    // reliable frame win on hardware with dedicated compute queues
+    int computeQueueFamily = findComputeQueueFamily();
+    computeQueueFamily_ = (computeQueueFamily != -1)
+        ? static_cast<uint32_t>(computeQueueFamily)
+        : graphicsQueueFamily_;
+    asyncComputeAvailable_ = (computeQueueFamily_ != graphicsQueueFamily_);
+
+    float queuePriority = 1.0f;
+    std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
 
     VkDeviceQueueCreateInfo queueCreateInfo{};
     queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-    queueCreateInfo.queueFamilyIndex = graphicsQueueFamily;
+    queueCreateInfo.queueFamilyIndex = graphicsQueueFamily_;
     queueCreateInfo.queueCount = 1;
-
-    float queuePriority = 1.0f;
     queueCreateInfo.pQueuePriorities = &queuePriority;
+    queueCreateInfos.push_back(queueCreateInfo);
+
+    if (transferQueueFamily_ != graphicsQueueFamily_) {
+        queueCreateInfo.queueFamilyIndex = transferQueueFamily_;
+        queueCreateInfos.push_back(queueCreateInfo);
+    }
+
+    if (asyncComputeAvailable_ && computeQueueFamily_ != transferQueueFamily_) {
+        queueCreateInfo.queueFamilyIndex = computeQueueFamily_;
+        queueCreateInfos.push_back(queueCreateInfo);
+    }
 
     VkPhysicalDeviceFeatures deviceFeatures{};
 
+    // Descriptor indexing (core since Vulkan 1.2) is required for the
+    // bindless texture array; fail loudly on hardware that lacks it
+    VkPhysicalDeviceVulkan12Features supported12Features{};
+    supported12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    VkPhysicalDeviceFeatures2 supportedFeatures2{};
+    supportedFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    supportedFeatures2.pNext = &supported12Features;
+    vkGetPhysicalDeviceFeatures2(physicalDevice_, &supportedFeatures2);
+
+    if (!supported12Features.runtimeDescriptorArray ||
+        !supported12Features.shaderSampledImageArrayNonUniformIndexing ||
+        !supported12Features.descriptorBindingPartiallyBound ||
+        !supported12Features.descriptorBindingSampledImageUpdateAfterBind) {
+        throw std::runtime_error("Selected GPU lacks descriptor indexing required for bindless textures!");
+    }
+
+    // Timeline semaphores drive the frame loop; support is mandatory in
+    // Vulkan 1.2, but verify rather than trust the driver
+    if (!supported12Features.timelineSemaphore) {
+        throw std::runtime_error("Selected GPU lacks timeline semaphores required for frame synchronization!");
+    }
+
+    VkPhysicalDeviceVulkan12Features enabled12Features{};
+    enabled12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    enabled12Features.runtimeDescriptorArray = VK_TRUE;
+    enabled12Features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+    enabled12Features.descriptorBindingPartiallyBound = VK_TRUE;
+    enabled12Features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+    enabled12Features.timelineSemaphore = VK_TRUE;
+
     const std::vector<const char*> deviceExtensions = {
         VK_KHR_SWAPCHAIN_EXTENSION_NAME
     };
 
     VkDeviceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-    createInfo.pQueueCreateInfos = &queueCreateInfo;
-    createInfo.queueCreateInfoCount = 1;
+    createInfo.pNext = &enabled12Features;
+    createInfo.pQueueCreateInfos = queueCreateInfos.data();
+    createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
     createInfo.pEnabledFeatures = &deviceFeatures;
     createInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
     createInfo.ppEnabledExtensionNames = deviceExtensions.data();
@@ -864,11 +2235,56 @@ void VulkanRenderer::createLogicalDevice() {
         throw std::runtime_error("Failed to create logical device!");
     }
 
-    vkGetDeviceQueue(device_, graphicsQueueFamily, 0, &graphicsQueue_);
+    vkGetDeviceQueue(device_, graphicsQueueFamily_, 0, &graphicsQueue_);
+    vkGetDeviceQueue(device_, transferQueueFamily_, 0, &transferQueue_);
+    vkGetDeviceQueue(device_, computeQueueFamily_, 0, &computeQueue_);
+
+    if (transferQueueFamily_ != graphicsQueueFamily_) {
+        VKMON_INFO("Dedicated transfer queue found (family " + std::to_string(transferQueueFamily_) + ")");
+    }
+    if (asyncComputeAvailable_) {
+        VKMON_INFO("Dedicated compute queue found (family " + std::to_string(computeQueueFamily_) + ") - async compute enabled");
+    }
     VKMON_DEBUG("Logical device created successfully");
 }
 
-int VulkanRenderer::findGraphicsQueueFamily() {
+int VulkanRenderer::findTransferQueueFamily() {
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice_, &queueFamilyCount, nullptr);
+
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice_, &queueFamilyCount, queueFamilies.data());
+
+    // A transfer-capable family without graphics is a DMA engine that can
+    // run copies concurrently with rendering
+    for (int i = 0; i < queueFamilies.size(); i++) {
+        if ((queueFamilies[i].queueFlags & VK_QUEUE_TRANSFER_BIT) &&
+            !(queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int VulkanRenderer::findComputeQueueFamily() {
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice_, &queueFamilyCount, nullptr);
+
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice_, &queueFamilyCount, queueFamilies.data());
+
+    // A compute-capable family without graphics maps to the hardware's
+    // async compute engines; work submitted there overlaps the 3D queue
+    for (int i = 0; i < queueFamilies.size(); i++) {
+        if ((queueFamilies[i].queueFlags & VK_QUEUE_COMPUTE_BIT) &&
+            !(queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int VulkanRenderer::findGraphicsQueueFamily() {
     uint32_t queueFamilyCount = 0;
     vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice_, &queueFamilyCount, nullptr);
 
@@ -922,17 +2338,30 @@ void VulkanRenderer::createSwapChain() {
     createInfo.imageColorSpace = surfaceFormat.colorSpace;
     createInfo.imageExtent = swapChainExtent_;
     createInfo.imageArrayLayers = 1;
-    createInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    // TRANSFER_SRC enables the frame capture readback copy; universally
+    // supported for presentable formats and free when capture is off
+    createInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
     createInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
     createInfo.preTransform = capabilities.currentTransform;
     createInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
-    createInfo.presentMode = VK_PRESENT_MODE_IMMEDIATE_KHR; // No V-Sync for development - see true performance
+    createInfo.presentMode = resolvePresentMode();
     createInfo.clipped = VK_TRUE;
-    createInfo.oldSwapchain = VK_NULL_HANDLE;
 
-    if (vkCreateSwapchainKHR(device_, &createInfo, nullptr, &swapChain_) != VK_SUCCESS) {
+    // Hand the driver the outgoing swapchain so presentation continues
+    // uninterrupted during resize; the old handle is retired and
+    // destroyed once the render timeline passes the next frame
+    VkSwapchainKHR oldSwapchain = swapChain_;
+    createInfo.oldSwapchain = oldSwapchain;
+
+    VkSwapchainKHR newSwapchain = VK_NULL_HANDLE;
+    if (vkCreateSwapchainKHR(device_, &createInfo, nullptr, &newSwapchain) != VK_SUCCESS) {
         throw std::runtime_error("Failed to create swap chain!");
     }
+    swapChain_ = newSwapchain;
+
+    if (oldSwapchain != VK_NULL_HANDLE) {
+        retiredSwapchains_.push_back({oldSwapchain, renderTimelineValue_ + 1});
+    }
 
     // Get swap chain images
     vkGetSwapchainImagesKHR(device_, swapChain_, &imageCount, nullptr);
@@ -946,14 +2375,29 @@ void VulkanRenderer::createSwapChain() {
 void VulkanRenderer::recreateSwapChain() {
     VKMON_INFO("Recreating swap chain for resize...");
 
-    // Wait for any in-flight operations to complete
-    vkDeviceWaitIdle(device_);
+    // Readback buffers are sized to the outgoing extent - stop capture
+    // rather than deliver frames with a stale size
+    if (captureActive_) {
+        VKMON_WARNING("Frame capture stopped by swapchain recreation (resize during capture)");
+        stopFrameCapture();
+    }
 
-    // Clean up old swapchain-dependent resources
+    // Wait only for submitted graphics frames, not the whole device -
+    // async transfer uploads and any pending compute keep running, and
+    // the presentation engine keeps showing the old swapchain until the
+    // replacement takes over via oldSwapchain below
+    waitForGpuFrameCompletion();
+
+    // Clean up old swapchain-dependent resources; the timeline wait
+    // guarantees no submitted frame still references them
     // Cleanup framebuffers
     for (size_t i = 0; i < swapChainFramebuffers_.size(); i++) {
         vkDestroyFramebuffer(device_, swapChainFramebuffers_[i], nullptr);
     }
+    if (prePassFramebuffer_ != VK_NULL_HANDLE) {
+        vkDestroyFramebuffer(device_, prePassFramebuffer_, nullptr);
+        prePassFramebuffer_ = VK_NULL_HANDLE;
+    }
 
     // Cleanup image views
     for (size_t i = 0; i < swapChainImageViews_.size(); i++) {
@@ -965,8 +2409,9 @@ void VulkanRenderer::recreateSwapChain() {
     vkDestroyImage(device_, depthImage_, nullptr);
     vkFreeMemory(device_, depthImageMemory_, nullptr);
 
-    // Cleanup old swapchain
-    vkDestroySwapchainKHR(device_, swapChain_, nullptr);
+    // The old swapchain handle itself is NOT destroyed here - it is
+    // passed as oldSwapchain inside createSwapChain and retired once the
+    // presentation engine has moved on
 
     // Recreate swapchain with new window size
     createSwapChain();
@@ -977,19 +2422,147 @@ void VulkanRenderer::recreateSwapChain() {
         swapChainImageViews_[i] = createImageView(swapChainImages_[i], swapChainImageFormat_, VK_IMAGE_ASPECT_COLOR_BIT);
     }
 
-    // Recreate depth buffer
+    // Recreate depth buffer (SAMPLED for the Hi-Z build pass)
     VkFormat depthFormat = findDepthFormat();
     createImage(swapChainExtent_.width, swapChainExtent_.height, depthFormat, VK_IMAGE_TILING_OPTIMAL,
-               VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+               VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
                depthImage_, depthImageMemory_);
     depthImageView_ = createImageView(depthImage_, depthFormat, VK_IMAGE_ASPECT_DEPTH_BIT);
 
     // Recreate framebuffers
     createFramebuffers();
 
+    // The Hi-Z pyramid tracks the depth buffer's size and views, so it
+    // is rebuilt whenever the depth buffer is
+    if (hizBuildPipeline_ != VK_NULL_HANDLE) {
+        cleanupHiZResources();
+        createHiZResources();
+    }
+
     VKMON_INFO("Swap chain recreation completed successfully");
 }
 
+void VulkanRenderer::waitForGpuFrameCompletion() {
+    // CPU-side wait on the last submitted graphics frame. Deliberately
+    // narrower than vkDeviceWaitIdle: transfer-queue uploads keep running,
+    // and graphics completion implies the compute work it waited on is
+    // done too
+    if (renderTimelineValue_ > 0) {
+        VkSemaphoreWaitInfo waitInfo{};
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &renderTimeline_;
+        waitInfo.pValues = &renderTimelineValue_;
+        vkWaitSemaphores(device_, &waitInfo, UINT64_MAX);
+    }
+}
+
+void VulkanRenderer::destroyReadyRetiredSwapchains() {
+    // Called after the per-frame timeline wait, so any entry stamped at or
+    // below the waited value has no frame still rendering into it. The
+    // presentation engine itself is covered by oldSwapchain semantics:
+    // vkCreateSwapchainKHR detaches the retired chain from the surface
+    for (auto it = retiredSwapchains_.begin(); it != retiredSwapchains_.end();) {
+        if (it->retireAfter <= renderTimelineValue_) {
+            vkDestroySwapchainKHR(device_, it->swapchain, nullptr);
+            it = retiredSwapchains_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+VkPresentModeKHR VulkanRenderer::resolvePresentMode() const {
+    VkPresentModeKHR requested = VK_PRESENT_MODE_FIFO_KHR;
+    switch (presentModeSetting_) {
+        case PresentModeSetting::Immediate: requested = VK_PRESENT_MODE_IMMEDIATE_KHR; break;
+        case PresentModeSetting::Mailbox:   requested = VK_PRESENT_MODE_MAILBOX_KHR;   break;
+        case PresentModeSetting::Fifo:      requested = VK_PRESENT_MODE_FIFO_KHR;      break;
+    }
+
+    uint32_t modeCount = 0;
+    vkGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice_, surface_, &modeCount, nullptr);
+    std::vector<VkPresentModeKHR> modes(modeCount);
+    vkGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice_, surface_, &modeCount, modes.data());
+
+    if (std::find(modes.begin(), modes.end(), requested) != modes.end()) {
+        return requested;
+    }
+
+    // FIFO is the only mode the spec guarantees
+    VKMON_WARNING("Requested present mode unsupported by surface, falling back to FIFO");
+    return VK_PRESENT_MODE_FIFO_KHR;
+}
+
+void VulkanRenderer::setPresentMode(PresentModeSetting mode) {
+    if (mode == presentModeSetting_) {
+        return;
+    }
+    presentModeSetting_ = mode;
+
+    const char* name = mode == PresentModeSetting::Immediate ? "Immediate"
+                     : mode == PresentModeSetting::Mailbox   ? "Mailbox"
+                                                             : "Fifo";
+    VKMON_INFO(std::string("Present mode set to ") + name);
+
+    // Present mode is baked into the swapchain, so apply it by rebuilding;
+    // before initialization createSwapChain picks it up on its own
+    if (initialized_) {
+        recreateSwapChain();
+    }
+}
+
+void VulkanRenderer::setFrameRateLimit(float fps) {
+    if (fps < 0.0f) {
+        VKMON_WARNING("Ignoring negative frame rate limit");
+        return;
+    }
+    frameRateLimit_ = fps;
+    frameLimiterDeadline_ = {};  // restart pacing from the next frame
+    if (fps > 0.0f) {
+        VKMON_INFO("Frame rate limited to " + std::to_string(fps) + " FPS");
+    } else {
+        VKMON_INFO("Frame rate limit removed");
+    }
+}
+
+void VulkanRenderer::applyFrameRateLimit() {
+    if (frameRateLimit_ <= 0.0f) {
+        presentStats_.limiterWaitMs = 0.0f;
+        return;
+    }
+
+    using clock = std::chrono::high_resolution_clock;
+    auto frameBudget = std::chrono::duration_cast<clock::duration>(
+        std::chrono::duration<double>(1.0 / frameRateLimit_));
+
+    auto now = clock::now();
+    if (frameLimiterDeadline_.time_since_epoch().count() == 0 || frameLimiterDeadline_ < now) {
+        // First paced frame, or the frame ran over budget - re-anchor
+        // instead of bursting to catch up
+        frameLimiterDeadline_ = now + frameBudget;
+        presentStats_.limiterWaitMs = 0.0f;
+        return;
+    }
+
+    auto waitStart = now;
+
+    // Sleep the bulk of the wait, leaving a margin for scheduler jitter,
+    // then spin the final stretch for precise pacing
+    constexpr auto spinMargin = std::chrono::milliseconds(2);
+    if (frameLimiterDeadline_ - now > spinMargin) {
+        std::this_thread::sleep_until(frameLimiterDeadline_ - spinMargin);
+    }
+    while (clock::now() < frameLimiterDeadline_) {
+        std::this_thread::yield();
+    }
+
+    presentStats_.limiterWaitMs =
+        std::chrono::duration<float, std::milli>(clock::now() - waitStart).count();
+    frameLimiterDeadline_ += frameBudget;
+}
+
 void VulkanRenderer::createRenderPass() {
     VKMON_INFO("Creating render pass...");
     
@@ -1009,7 +2582,9 @@ void VulkanRenderer::createRenderPass() {
     depthAttachment.format = findDepthFormat();
     depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
     depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-    depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    // STORE rather than DONT_CARE: the Hi-Z build pass reads the final
+    // depth after the pass ends
+    depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
     depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
     depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
     depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
@@ -1052,6 +2627,62 @@ void VulkanRenderer::createRenderPass() {
         throw std::runtime_error("Failed to create render pass!");
     }
 
+    // Variant of the shaded pass that loads depth written by the pre-pass
+    // instead of clearing it. Load ops do not affect render pass
+    // compatibility, so the swapchain framebuffers work with both.
+    depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    depthAttachment.initialLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    dependency.srcStageMask |= VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependency.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+    std::array<VkAttachmentDescription, 2> depthLoadAttachments = {colorAttachment, depthAttachment};
+    renderPassInfo.pAttachments = depthLoadAttachments.data();
+
+    if (vkCreateRenderPass(device_, &renderPassInfo, nullptr, &renderPassDepthLoad_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create depth-load render pass!");
+    }
+
+    // Depth-only render pass for the pre-pass itself
+    VkAttachmentDescription prePassDepthAttachment{};
+    prePassDepthAttachment.format = findDepthFormat();
+    prePassDepthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    prePassDepthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    prePassDepthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    prePassDepthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    prePassDepthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    prePassDepthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    prePassDepthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference prePassDepthRef{};
+    prePassDepthRef.attachment = 0;
+    prePassDepthRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+    VkSubpassDescription prePassSubpass{};
+    prePassSubpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    prePassSubpass.colorAttachmentCount = 0;
+    prePassSubpass.pDepthStencilAttachment = &prePassDepthRef;
+
+    VkSubpassDependency prePassDependency{};
+    prePassDependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    prePassDependency.dstSubpass = 0;
+    prePassDependency.srcStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    prePassDependency.srcAccessMask = 0;
+    prePassDependency.dstStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    prePassDependency.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+    VkRenderPassCreateInfo prePassInfo{};
+    prePassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    prePassInfo.attachmentCount = 1;
+    prePassInfo.pAttachments = &prePassDepthAttachment;
+    prePassInfo.subpassCount = 1;
+    prePassInfo.pSubpasses = &prePassSubpass;
+    prePassInfo.dependencyCount = 1;
+    prePassInfo.pDependencies = &prePassDependency;
+
+    if (vkCreateRenderPass(device_, &prePassInfo, nullptr, &depthPrePassRenderPass_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create depth pre-pass render pass!");
+    }
+
     VKMON_DEBUG("Render pass created successfully");
 }
 
@@ -1081,21 +2712,211 @@ VkShaderModule VulkanRenderer::createShaderModule(const std::vector<char>& code)
     return shaderModule;
 }
 
+void VulkanRenderer::createPipelineCache() {
+    VKMON_DEBUG("Creating pipeline cache...");
+
+    // Key the cache file by the driver's pipelineCacheUUID so a driver
+    // update or GPU swap starts a fresh cache instead of feeding the
+    // driver stale blobs it would reject anyway
+    VkPhysicalDeviceProperties deviceProperties;
+    vkGetPhysicalDeviceProperties(physicalDevice_, &deviceProperties);
+
+    std::string uuidHex;
+    uuidHex.reserve(VK_UUID_SIZE * 2);
+    constexpr char hexDigits[] = "0123456789abcdef";
+    for (size_t i = 0; i < VK_UUID_SIZE; i++) {
+        uuidHex += hexDigits[deviceProperties.pipelineCacheUUID[i] >> 4];
+        uuidHex += hexDigits[deviceProperties.pipelineCacheUUID[i] & 0x0F];
+    }
+    pipelineCacheFilePath_ = std::string(PIPELINE_CACHE_DIRECTORY) + "/pipeline_cache_" + uuidHex + ".bin";
+
+    // Load previous run's cache data if it exists; a missing or
+    // unreadable file just means a cold start
+    std::vector<char> cacheData;
+    std::ifstream cacheFile(pipelineCacheFilePath_, std::ios::binary | std::ios::ate);
+    if (cacheFile.is_open()) {
+        size_t fileSize = static_cast<size_t>(cacheFile.tellg());
+        cacheData.resize(fileSize);
+        cacheFile.seekg(0);
+        cacheFile.read(cacheData.data(), fileSize);
+        if (!cacheFile) {
+            cacheData.clear();
+        }
+    }
+
+    VkPipelineCacheCreateInfo cacheInfo{};
+    cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cacheInfo.initialDataSize = cacheData.size();
+    cacheInfo.pInitialData = cacheData.empty() ? nullptr : cacheData.data();
+
+    if (vkCreatePipelineCache(device_, &cacheInfo, nullptr, &pipelineCache_) != VK_SUCCESS) {
+        // Corrupt initial data can fail creation; retry empty rather
+        // than losing pipeline caching for the whole session
+        VKMON_WARNING("Pipeline cache rejected stored data, starting with empty cache");
+        cacheInfo.initialDataSize = 0;
+        cacheInfo.pInitialData = nullptr;
+        if (vkCreatePipelineCache(device_, &cacheInfo, nullptr, &pipelineCache_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create pipeline cache!");
+        }
+        cacheData.clear();
+    }
+
+    if (!cacheData.empty()) {
+        VKMON_INFO("Pipeline cache loaded from disk (" + std::to_string(cacheData.size()) + " bytes): " + pipelineCacheFilePath_);
+    } else {
+        VKMON_INFO("Pipeline cache starting cold, will persist to: " + pipelineCacheFilePath_);
+    }
+}
+
+void VulkanRenderer::savePipelineCache() {
+    if (pipelineCache_ == VK_NULL_HANDLE || pipelineCacheFilePath_.empty()) {
+        return;
+    }
+
+    size_t cacheSize = 0;
+    if (vkGetPipelineCacheData(device_, pipelineCache_, &cacheSize, nullptr) != VK_SUCCESS || cacheSize == 0) {
+        return;
+    }
+
+    std::vector<char> cacheData(cacheSize);
+    if (vkGetPipelineCacheData(device_, pipelineCache_, &cacheSize, cacheData.data()) != VK_SUCCESS) {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(PIPELINE_CACHE_DIRECTORY, ec);
+
+    std::ofstream cacheFile(pipelineCacheFilePath_, std::ios::binary | std::ios::trunc);
+    if (!cacheFile.is_open()) {
+        VKMON_WARNING("Could not write pipeline cache to " + pipelineCacheFilePath_);
+        return;
+    }
+    cacheFile.write(cacheData.data(), static_cast<std::streamsize>(cacheSize));
+
+    VKMON_DEBUG("Pipeline cache saved (" + std::to_string(cacheSize) + " bytes): " + pipelineCacheFilePath_);
+}
+
+void VulkanRenderer::createTimestampQueryPool() {
+    VkPhysicalDeviceProperties properties{};
+    vkGetPhysicalDeviceProperties(physicalDevice_, &properties);
+
+    if (properties.limits.timestampPeriod == 0.0f || !properties.limits.timestampComputeAndGraphics) {
+        VKMON_WARNING("GPU timestamps not supported on this device, per-pass GPU timings disabled");
+        return;
+    }
+    timestampPeriodNs_ = properties.limits.timestampPeriod;
+
+    VkQueryPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    poolInfo.queryCount = TIMESTAMP_QUERY_COUNT;
+
+    if (vkCreateQueryPool(device_, &poolInfo, nullptr, &timestampQueryPool_) != VK_SUCCESS) {
+        VKMON_WARNING("Failed to create timestamp query pool, per-pass GPU timings disabled");
+        return;
+    }
+
+    gpuTimingSupported_ = true;
+    VKMON_INFO("GPU timestamp profiling enabled (" + std::to_string(timestampPeriodNs_) + " ns per tick)");
+}
+
+void VulkanRenderer::readTimestampResults() {
+    if (!gpuTimingSupported_ || !timestampsIssued_) {
+        return;
+    }
+
+    uint64_t ticks[TIMESTAMP_QUERY_COUNT] = {};
+    VkResult result = vkGetQueryPoolResults(device_, timestampQueryPool_, 0, TIMESTAMP_QUERY_COUNT,
+                                           sizeof(ticks), ticks, sizeof(uint64_t),
+                                           VK_QUERY_RESULT_64_BIT);
+    if (result != VK_SUCCESS) {
+        // VK_NOT_READY should not happen behind the in-flight fence, but
+        // keeping last frame's numbers beats corrupting the display
+        return;
+    }
+
+    auto ticksToMs = [this](uint64_t begin, uint64_t end) {
+        return end > begin ? static_cast<float>(end - begin) * timestampPeriodNs_ / 1000000.0f : 0.0f;
+    };
+
+    gpuPassTimings_.mainPassMs = ticksToMs(ticks[0], ticks[1]);
+    gpuPassTimings_.instancedPassMs = ticksToMs(ticks[1], ticks[2]);
+    gpuPassTimings_.imguiPassMs = ticksToMs(ticks[2], ticks[3]);
+    gpuPassTimings_.totalMs = ticksToMs(ticks[0], ticks[3]);
+    gpuPassTimings_.valid = true;
+}
+
 void VulkanRenderer::createGraphicsPipeline() {
     VKMON_INFO("Creating graphics pipeline...");
-    
+
+    // Push constant range for model matrix
+    VkPushConstantRange pushConstantRange{};
+    // Fragment stage reads the bindless texture index from the same range
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(PushConstants);
+
+    // Pipeline layout with multiple descriptor sets
+    VkDescriptorSetLayout descriptorSetLayouts[] = {globalDescriptorSetLayout_, materialDescriptorSetLayout_, bindlessTextureSetLayout_};
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 3; // Global (set 0) + Material (set 1) + Bindless textures (set 2)
+    pipelineLayoutInfo.pSetLayouts = descriptorSetLayouts;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+    if (vkCreatePipelineLayout(device_, &pipelineLayoutInfo, nullptr, &pipelineLayout_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create pipeline layout!");
+    }
+
+    graphicsPipeline_ = buildGraphicsPipeline(vertShaderModule_, fragShaderModule_);
+
+    VKMON_DEBUG("Graphics pipeline created successfully");
+}
+
+VkPipeline VulkanRenderer::getPipelineVariant(const ShaderFeatures& features) {
+    if (features == ShaderFeatures{}) {
+        return graphicsPipeline_;
+    }
+
+    uint32_t key = features.cacheKey();
+    auto cached = pipelineVariants_.find(key);
+    if (cached != pipelineVariants_.end()) {
+        return cached->second;
+    }
+
+    VkPipeline variant = buildGraphicsPipeline(vertShaderModule_, fragShaderModule_, features);
+    pipelineVariants_.emplace(key, variant);
+    VKMON_DEBUG("Built specialized pipeline variant (key " + std::to_string(key) + ")");
+    return variant;
+}
+
+void VulkanRenderer::destroyPipelineVariants() {
+    for (auto& [key, pipeline] : pipelineVariants_) {
+        vkDestroyPipeline(device_, pipeline, nullptr);
+    }
+    pipelineVariants_.clear();
+}
+
+VkPipeline VulkanRenderer::buildGraphicsPipeline(VkShaderModule vertModule, VkShaderModule fragModule,
+                                                 const ShaderFeatures& features) {
     // Shader stage creation
     VkPipelineShaderStageCreateInfo vertShaderStageInfo{};
     vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     vertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
-    vertShaderStageInfo.module = vertShaderModule_;
+    vertShaderStageInfo.module = vertModule;
     vertShaderStageInfo.pName = "main";
 
+    // Specialize the fragment stage: lighting feature branches fold to
+    // constants at pipeline creation instead of costing throughput
+    ShaderSpecialization specialization(features);
+
     VkPipelineShaderStageCreateInfo fragShaderStageInfo{};
     fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    fragShaderStageInfo.module = fragShaderModule_;
+    fragShaderStageInfo.module = fragModule;
     fragShaderStageInfo.pName = "main";
+    fragShaderStageInfo.pSpecializationInfo = &specialization.info;
 
     VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
 
@@ -1168,29 +2989,12 @@ void VulkanRenderer::createGraphicsPipeline() {
     depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
     depthStencil.depthTestEnable = VK_TRUE;
     depthStencil.depthWriteEnable = VK_TRUE;
-    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+    // LESS_OR_EQUAL lets shaded fragments pass at the exact depth the
+    // pre-pass laid down, and behaves like LESS when the pre-pass is off
+    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL;
     depthStencil.depthBoundsTestEnable = VK_FALSE;
     depthStencil.stencilTestEnable = VK_FALSE;
 
-    // Push constant range for model matrix
-    VkPushConstantRange pushConstantRange{};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(PushConstants);
-
-    // Pipeline layout with multiple descriptor sets
-    VkDescriptorSetLayout descriptorSetLayouts[] = {globalDescriptorSetLayout_, materialDescriptorSetLayout_};
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
-    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.setLayoutCount = 2; // Global (set 0) + Material (set 1)
-    pipelineLayoutInfo.pSetLayouts = descriptorSetLayouts;
-    pipelineLayoutInfo.pushConstantRangeCount = 1;
-    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
-
-    if (vkCreatePipelineLayout(device_, &pipelineLayoutInfo, nullptr, &pipelineLayout_) != VK_SUCCESS) {
-        throw std::runtime_error("Failed to create pipeline layout!");
-    }
-
     // Graphics pipeline
     VkGraphicsPipelineCreateInfo pipelineInfo{};
     pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
@@ -1209,11 +3013,14 @@ void VulkanRenderer::createGraphicsPipeline() {
     pipelineInfo.subpass = 0;
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 
-    if (vkCreateGraphicsPipelines(device_, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &graphicsPipeline_) != VK_SUCCESS) {
+    // The pipeline cache is internally synchronized, so this is safe to
+    // call from the shader reload worker while the main thread renders
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    if (vkCreateGraphicsPipelines(device_, pipelineCache_, 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS) {
         throw std::runtime_error("Failed to create graphics pipeline!");
     }
 
-    VKMON_DEBUG("Graphics pipeline created successfully");
+    return pipeline;
 }
 
 void VulkanRenderer::createInstancedShaderModules() {
@@ -1222,9 +3029,11 @@ void VulkanRenderer::createInstancedShaderModules() {
     // Load compiled instanced shaders
     auto instancedVertShaderCode = Utils::readFile(INSTANCED_VERTEX_SHADER_COMPILED);
     auto instancedFragShaderCode = Utils::readFile(INSTANCED_FRAGMENT_SHADER_COMPILED);
+    auto grassVertShaderCode = Utils::readFile(GRASS_VERTEX_SHADER_COMPILED);
 
     instancedVertShaderModule_ = createShaderModule(instancedVertShaderCode);
     instancedFragShaderModule_ = createShaderModule(instancedFragShaderCode);
+    grassVertShaderModule_ = createShaderModule(grassVertShaderCode);
 
     VKMON_DEBUG("Instanced shader modules created successfully");
 }
@@ -1239,11 +3048,16 @@ void VulkanRenderer::createInstancedGraphicsPipeline() {
     vertShaderStageInfo.module = instancedVertShaderModule_;
     vertShaderStageInfo.pName = "main";
 
+    // Instanced frag shader shares the specialization constant block;
+    // pin the defaults so the compiler still folds the feature branches
+    ShaderSpecialization defaultSpecialization{ShaderFeatures{}};
+
     VkPipelineShaderStageCreateInfo fragShaderStageInfo{};
     fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
     fragShaderStageInfo.module = instancedFragShaderModule_;
     fragShaderStageInfo.pName = "main";
+    fragShaderStageInfo.pSpecializationInfo = &defaultSpecialization.info;
 
     VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
 
@@ -1305,7 +3119,9 @@ void VulkanRenderer::createInstancedGraphicsPipeline() {
     depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
     depthStencil.depthTestEnable = VK_TRUE;
     depthStencil.depthWriteEnable = VK_TRUE;
-    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+    // LESS_OR_EQUAL lets shaded fragments pass at the exact depth the
+    // pre-pass laid down, and behaves like LESS when the pre-pass is off
+    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL;
     depthStencil.depthBoundsTestEnable = VK_FALSE;
     depthStencil.stencilTestEnable = VK_FALSE;
 
@@ -1339,11 +3155,19 @@ void VulkanRenderer::createInstancedGraphicsPipeline() {
     pipelineInfo.subpass = 0;
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 
-    if (vkCreateGraphicsPipelines(device_, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &instancedGraphicsPipeline_) != VK_SUCCESS) {
+    if (vkCreateGraphicsPipelines(device_, pipelineCache_, 1, &pipelineInfo, nullptr, &instancedGraphicsPipeline_) != VK_SUCCESS) {
         throw std::runtime_error("Failed to create instanced graphics pipeline!");
     }
 
-    VKMON_DEBUG("Instanced graphics pipeline created successfully");
+    // Grass variant: identical fixed-function state and layout, only the
+    // vertex shader differs (wind sway driven by the time uniform)
+    vertShaderStageInfo.module = grassVertShaderModule_;
+    shaderStages[0] = vertShaderStageInfo;
+    if (vkCreateGraphicsPipelines(device_, pipelineCache_, 1, &pipelineInfo, nullptr, &grassGraphicsPipeline_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create grass graphics pipeline!");
+    }
+
+    VKMON_DEBUG("Instanced graphics pipelines created successfully");
 }
 
 void VulkanRenderer::createFramebuffers() {
@@ -1394,6 +3218,22 @@ void VulkanRenderer::createFramebuffers() {
         }
     }
 
+    // Depth-only framebuffer for the pre-pass (shares the depth attachment)
+    if (depthPrePassRenderPass_ != VK_NULL_HANDLE) {
+        VkFramebufferCreateInfo prePassFramebufferInfo{};
+        prePassFramebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        prePassFramebufferInfo.renderPass = depthPrePassRenderPass_;
+        prePassFramebufferInfo.attachmentCount = 1;
+        prePassFramebufferInfo.pAttachments = &depthImageView_;
+        prePassFramebufferInfo.width = swapChainExtent_.width;
+        prePassFramebufferInfo.height = swapChainExtent_.height;
+        prePassFramebufferInfo.layers = 1;
+
+        if (vkCreateFramebuffer(device_, &prePassFramebufferInfo, nullptr, &prePassFramebuffer_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create depth pre-pass framebuffer!");
+        }
+    }
+
     VKMON_DEBUG("Framebuffers created successfully");
 }
 
@@ -1434,20 +3274,34 @@ void VulkanRenderer::createCommandBuffers() {
 
 void VulkanRenderer::createSyncObjects() {
     VKMON_INFO("Creating synchronization objects...");
-    
+
     VkSemaphoreCreateInfo semaphoreInfo{};
     semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
-    VkFenceCreateInfo fenceInfo{};
-    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-
+    // Swapchain handoffs must stay binary per the spec
     if (vkCreateSemaphore(device_, &semaphoreInfo, nullptr, &imageAvailableSemaphore_) != VK_SUCCESS ||
-        vkCreateSemaphore(device_, &semaphoreInfo, nullptr, &renderFinishedSemaphore_) != VK_SUCCESS ||
-        vkCreateFence(device_, &fenceInfo, nullptr, &inFlightFence_) != VK_SUCCESS) {
+        vkCreateSemaphore(device_, &semaphoreInfo, nullptr, &renderFinishedSemaphore_) != VK_SUCCESS) {
         throw std::runtime_error("Failed to create sync objects!");
     }
 
+    // Per-queue timelines replace the frame fence and the compute handoff
+    // semaphore: one CPU wait on a counter value per frame, no resets
+    VkSemaphoreTypeCreateInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    timelineInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    timelineInfo.initialValue = 0;
+
+    VkSemaphoreCreateInfo timelineCreateInfo{};
+    timelineCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    timelineCreateInfo.pNext = &timelineInfo;
+
+    if (vkCreateSemaphore(device_, &timelineCreateInfo, nullptr, &renderTimeline_) != VK_SUCCESS ||
+        vkCreateSemaphore(device_, &timelineCreateInfo, nullptr, &computeTimeline_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create timeline semaphores!");
+    }
+    renderTimelineValue_ = 0;
+    computeTimelineValue_ = 0;
+
     VKMON_INFO("Sync objects created successfully");
 }
 
@@ -1455,14 +3309,24 @@ void VulkanRenderer::createSyncObjects() {
 // Resource Creation Methods (to be extracted from main.cpp)
 // =============================================================================
 
-void VulkanRenderer::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, 
-                                VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory) {
+void VulkanRenderer::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage,
+                                VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory,
+                                bool shareWithAsyncCompute) {
     VkBufferCreateInfo bufferInfo{};
     bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     bufferInfo.size = size;
     bufferInfo.usage = usage;
     bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
+    // Buffers touched by both the graphics and async compute queues use
+    // concurrent sharing so no queue family ownership transfers are needed
+    uint32_t sharedFamilies[] = {graphicsQueueFamily_, computeQueueFamily_};
+    if (shareWithAsyncCompute && asyncComputeAvailable_) {
+        bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        bufferInfo.queueFamilyIndexCount = 2;
+        bufferInfo.pQueueFamilyIndices = sharedFamilies;
+    }
+
     if (vkCreateBuffer(device_, &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
         throw std::runtime_error("Failed to create buffer!");
     }
@@ -1601,7 +3465,19 @@ void VulkanRenderer::createGlobalDescriptorSetLayout() {
     lightingLayoutBinding.pImmutableSamplers = nullptr;
     lightingLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
 
-    std::array<VkDescriptorSetLayoutBinding, 3> bindings = {uboLayoutBinding, samplerLayoutBinding, lightingLayoutBinding};
+    // Clustered lighting storage buffers (bindings 3-5): point light
+    // array, per-cluster ranges, packed light index list
+    std::array<VkDescriptorSetLayoutBinding, 3> clusterBindings{};
+    for (uint32_t i = 0; i < clusterBindings.size(); ++i) {
+        clusterBindings[i].binding = 3 + i;
+        clusterBindings[i].descriptorCount = 1;
+        clusterBindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        clusterBindings[i].pImmutableSamplers = nullptr;
+        clusterBindings[i].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
+
+    std::array<VkDescriptorSetLayoutBinding, 6> bindings = {uboLayoutBinding, samplerLayoutBinding, lightingLayoutBinding,
+                                                            clusterBindings[0], clusterBindings[1], clusterBindings[2]};
 
     VkDescriptorSetLayoutCreateInfo layoutInfo{};
     layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
@@ -1619,10 +3495,12 @@ void VulkanRenderer::createMaterialDescriptorSetLayout() {
     VKMON_INFO("Creating material descriptor set layout (per-material data)...");
 
     // Material uniform binding (binding 0 - rebased from binding 3)
+    // Dynamic so a single descriptor set can address every material slot
+    // in MaterialSystem's ring buffer via a per-draw dynamic offset
     VkDescriptorSetLayoutBinding materialLayoutBinding{};
     materialLayoutBinding.binding = 0;
     materialLayoutBinding.descriptorCount = 1;
-    materialLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    materialLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     materialLayoutBinding.pImmutableSamplers = nullptr;
     materialLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 
@@ -1774,9 +3652,10 @@ void VulkanRenderer::createDescriptorSet() {
         throw std::runtime_error("Failed to allocate descriptor set!");
     }
 
-    // UBO descriptor write (binding 0)
+    // UBO descriptor write (binding 0) - legacy path never advances the
+    // frame ring, so it always reads frame 0's buffer
     VkDescriptorBufferInfo bufferInfo{};
-    bufferInfo.buffer = uniformBuffer_;
+    bufferInfo.buffer = uniformBuffers_[0];
     bufferInfo.offset = 0;
     bufferInfo.range = sizeof(UniformBufferObject);
 
@@ -1844,19 +3723,22 @@ void VulkanRenderer::createDescriptorSet() {
 void VulkanRenderer::createGlobalDescriptorPool() {
     VKMON_INFO("Creating global descriptor pool (UBO, texture, lighting)...");
 
-    std::array<VkDescriptorPoolSize, 2> poolSizes{};
+    std::array<VkDescriptorPoolSize, 3> poolSizes{};
     // UBO and lighting uniform buffer descriptors
     poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    poolSizes[0].descriptorCount = 2; // UBO + lighting
+    poolSizes[0].descriptorCount = 2 * MAX_FRAMES_IN_FLIGHT; // UBO + lighting
     // Texture sampler descriptor
     poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    poolSizes[1].descriptorCount = 1;
+    poolSizes[1].descriptorCount = 1 * MAX_FRAMES_IN_FLIGHT;
+    // Clustered lighting storage buffers (lights, ranges, index list)
+    poolSizes[2].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSizes[2].descriptorCount = 3 * MAX_FRAMES_IN_FLIGHT;
 
     VkDescriptorPoolCreateInfo poolInfo{};
     poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
     poolInfo.pPoolSizes = poolSizes.data();
-    poolInfo.maxSets = 1; // Only need one global descriptor set
+    poolInfo.maxSets = MAX_FRAMES_IN_FLIGHT; // One global descriptor set per frame in flight
 
     if (vkCreateDescriptorPool(device_, &poolInfo, nullptr, &globalDescriptorPool_) != VK_SUCCESS) {
         throw std::runtime_error("Failed to create global descriptor pool!");
@@ -1866,25 +3748,20 @@ void VulkanRenderer::createGlobalDescriptorPool() {
 }
 
 void VulkanRenderer::createGlobalDescriptorSet() {
-    VKMON_INFO("Creating global descriptor set (UBO, texture, lighting)...");
+    VKMON_INFO("Creating global descriptor sets (UBO, texture, lighting)...");
 
-    VkDescriptorSetLayout layouts[] = {globalDescriptorSetLayout_};
+    std::array<VkDescriptorSetLayout, MAX_FRAMES_IN_FLIGHT> layouts{};
+    layouts.fill(globalDescriptorSetLayout_);
     VkDescriptorSetAllocateInfo allocInfo{};
     allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
     allocInfo.descriptorPool = globalDescriptorPool_;
-    allocInfo.descriptorSetCount = 1;
-    allocInfo.pSetLayouts = layouts;
+    allocInfo.descriptorSetCount = MAX_FRAMES_IN_FLIGHT;
+    allocInfo.pSetLayouts = layouts.data();
 
-    if (vkAllocateDescriptorSets(device_, &allocInfo, &globalDescriptorSet_) != VK_SUCCESS) {
-        throw std::runtime_error("Failed to allocate global descriptor set!");
+    if (vkAllocateDescriptorSets(device_, &allocInfo, globalDescriptorSets_.data()) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to allocate global descriptor sets!");
     }
 
-    // UBO descriptor write (binding 0)
-    VkDescriptorBufferInfo bufferInfo{};
-    bufferInfo.buffer = uniformBuffer_;
-    bufferInfo.offset = 0;
-    bufferInfo.range = sizeof(UniformBufferObject);
-
     // Texture descriptor write (binding 1)
     VkDescriptorImageInfo imageInfo{};
     imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
@@ -1897,50 +3774,97 @@ void VulkanRenderer::createGlobalDescriptorSet() {
     lightingBufferInfo.offset = 0;
     lightingBufferInfo.range = VK_WHOLE_SIZE;
 
-    std::array<VkWriteDescriptorSet, 3> descriptorWrites{};
-
-    // UBO descriptor write
-    descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    descriptorWrites[0].dstSet = globalDescriptorSet_;
-    descriptorWrites[0].dstBinding = 0;
-    descriptorWrites[0].dstArrayElement = 0;
-    descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    descriptorWrites[0].descriptorCount = 1;
-    descriptorWrites[0].pBufferInfo = &bufferInfo;
-
-    // Texture descriptor write
-    descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    descriptorWrites[1].dstSet = globalDescriptorSet_;
-    descriptorWrites[1].dstBinding = 1;
-    descriptorWrites[1].dstArrayElement = 0;
-    descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    descriptorWrites[1].descriptorCount = 1;
-    descriptorWrites[1].pImageInfo = &imageInfo;
-
-    // Lighting descriptor write
-    descriptorWrites[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    descriptorWrites[2].dstSet = globalDescriptorSet_;
-    descriptorWrites[2].dstBinding = 2;
-    descriptorWrites[2].dstArrayElement = 0;
-    descriptorWrites[2].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    descriptorWrites[2].descriptorCount = 1;
-    descriptorWrites[2].pBufferInfo = &lightingBufferInfo;
+    // Clustered lighting storage buffers (bindings 3-5)
+    VkDescriptorBufferInfo pointLightBufferInfo{};
+    pointLightBufferInfo.buffer = lightingSystem_->getPointLightBuffer();
+    pointLightBufferInfo.offset = 0;
+    pointLightBufferInfo.range = VK_WHOLE_SIZE;
+
+    VkDescriptorBufferInfo clusterRangeBufferInfo{};
+    clusterRangeBufferInfo.buffer = lightingSystem_->getClusterRangeBuffer();
+    clusterRangeBufferInfo.offset = 0;
+    clusterRangeBufferInfo.range = VK_WHOLE_SIZE;
+
+    VkDescriptorBufferInfo lightIndexBufferInfo{};
+    lightIndexBufferInfo.buffer = lightingSystem_->getLightIndexBuffer();
+    lightIndexBufferInfo.offset = 0;
+    lightIndexBufferInfo.range = VK_WHOLE_SIZE;
+
+    // Bindings 1-5 are shared across frames; only the global UBO (binding 0)
+    // points at each frame's own buffer in the ring
+    for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+        VkDescriptorBufferInfo bufferInfo{};
+        bufferInfo.buffer = uniformBuffers_[frame];
+        bufferInfo.offset = 0;
+        bufferInfo.range = sizeof(UniformBufferObject);
+
+        std::array<VkWriteDescriptorSet, 6> descriptorWrites{};
+
+        // UBO descriptor write
+        descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrites[0].dstSet = globalDescriptorSets_[frame];
+        descriptorWrites[0].dstBinding = 0;
+        descriptorWrites[0].dstArrayElement = 0;
+        descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        descriptorWrites[0].descriptorCount = 1;
+        descriptorWrites[0].pBufferInfo = &bufferInfo;
+
+        // Texture descriptor write
+        descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrites[1].dstSet = globalDescriptorSets_[frame];
+        descriptorWrites[1].dstBinding = 1;
+        descriptorWrites[1].dstArrayElement = 0;
+        descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        descriptorWrites[1].descriptorCount = 1;
+        descriptorWrites[1].pImageInfo = &imageInfo;
+
+        // Lighting descriptor write
+        descriptorWrites[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        descriptorWrites[2].dstSet = globalDescriptorSets_[frame];
+        descriptorWrites[2].dstBinding = 2;
+        descriptorWrites[2].dstArrayElement = 0;
+        descriptorWrites[2].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        descriptorWrites[2].descriptorCount = 1;
+        descriptorWrites[2].pBufferInfo = &lightingBufferInfo;
+
+        // Clustered lighting writes
+        const VkDescriptorBufferInfo* clusterInfos[] = {&pointLightBufferInfo, &clusterRangeBufferInfo, &lightIndexBufferInfo};
+        for (uint32_t i = 0; i < 3; ++i) {
+            descriptorWrites[3 + i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrites[3 + i].dstSet = globalDescriptorSets_[frame];
+            descriptorWrites[3 + i].dstBinding = 3 + i;
+            descriptorWrites[3 + i].dstArrayElement = 0;
+            descriptorWrites[3 + i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            descriptorWrites[3 + i].descriptorCount = 1;
+            descriptorWrites[3 + i].pBufferInfo = clusterInfos[i];
+        }
 
-    vkUpdateDescriptorSets(device_, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+        vkUpdateDescriptorSets(device_, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+    }
 
-    VKMON_INFO("Global descriptor set created successfully");
+    VKMON_INFO("Global descriptor sets created successfully");
 }
 
 void VulkanRenderer::createUniformBuffer() {
-    VKMON_DEBUG("Creating uniform buffer...");
-    
+    VKMON_DEBUG("Creating uniform buffers...");
+
     VkDeviceSize bufferSize = sizeof(UniformBufferObject);
 
-    createBuffer(bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, 
-                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                uniformBuffer_, uniformBufferMemory_);
+    // One persistently mapped global UBO per frame in flight so the single
+    // per-frame write never maps, unmaps, or stalls on an in-flight read
+    for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+        createBuffer(bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                    uniformBuffers_[frame], uniformBufferMemories_[frame]);
+
+        void* mappedPtr = nullptr;
+        if (vkMapMemory(device_, uniformBufferMemories_[frame], 0, bufferSize, 0, &mappedPtr) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to map uniform buffer memory!");
+        }
+        uniformBuffersMapped_[frame] = MappedBuffer(device_, uniformBufferMemories_[frame], mappedPtr);
+    }
 
-    VKMON_DEBUG("Uniform buffer created successfully");
+    VKMON_DEBUG("Uniform buffers created successfully");
 }
 
 void VulkanRenderer::createMaterialBuffer() {
@@ -1968,8 +3892,10 @@ void VulkanRenderer::createDepthResources() {
     
     VkFormat depthFormat = findDepthFormat();
 
+    // SAMPLED so the Hi-Z build pass can read the frame's final depth
     createImage(swapChainExtent_.width, swapChainExtent_.height, depthFormat, VK_IMAGE_TILING_OPTIMAL,
-               VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+               VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
                depthImage_, depthImageMemory_);
 
     depthImageView_ = createImageView(depthImage_, depthFormat, VK_IMAGE_ASPECT_DEPTH_BIT);
@@ -2017,8 +3943,7 @@ void VulkanRenderer::drawFrame() {
         endECSFrame();
     } else {
         // Legacy fallback: use static command buffers (for backward compatibility)
-        vkWaitForFences(device_, 1, &inFlightFence_, VK_TRUE, UINT64_MAX);
-        vkResetFences(device_, 1, &inFlightFence_);
+        waitForGpuFrameCompletion();
 
         uint32_t imageIndex;
         vkAcquireNextImageKHR(device_, swapChain_, UINT64_MAX, imageAvailableSemaphore_, VK_NULL_HANDLE, &imageIndex);
@@ -2026,6 +3951,13 @@ void VulkanRenderer::drawFrame() {
         VkSubmitInfo submitInfo{};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
+        uint64_t signalValues[2] = {renderTimelineValue_ + 1, 0};
+        VkTimelineSemaphoreSubmitInfo timelineInfo{};
+        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineInfo.signalSemaphoreValueCount = 2;
+        timelineInfo.pSignalSemaphoreValues = signalValues;
+        submitInfo.pNext = &timelineInfo;
+
         VkSemaphore waitSemaphores[] = {imageAvailableSemaphore_};
         VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
         submitInfo.waitSemaphoreCount = 1;
@@ -2034,18 +3966,19 @@ void VulkanRenderer::drawFrame() {
         submitInfo.commandBufferCount = 1;
         submitInfo.pCommandBuffers = &commandBuffers_[imageIndex];
 
-        VkSemaphore signalSemaphores[] = {renderFinishedSemaphore_};
-        submitInfo.signalSemaphoreCount = 1;
+        VkSemaphore signalSemaphores[] = {renderTimeline_, renderFinishedSemaphore_};
+        submitInfo.signalSemaphoreCount = 2;
         submitInfo.pSignalSemaphores = signalSemaphores;
 
-        if (vkQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFence_) != VK_SUCCESS) {
+        if (vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
             throw std::runtime_error("Failed to submit draw command buffer!");
         }
+        ++renderTimelineValue_;
 
         VkPresentInfoKHR presentInfo{};
         presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
         presentInfo.waitSemaphoreCount = 1;
-        presentInfo.pWaitSemaphores = signalSemaphores;
+        presentInfo.pWaitSemaphores = &signalSemaphores[1];
 
         VkSwapchainKHR swapChains[] = {swapChain_};
         presentInfo.swapchainCount = 1;
@@ -2084,14 +4017,16 @@ void VulkanRenderer::recordCommandBuffers() {
         vkCmdBeginRenderPass(commandBuffers_[i], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
         vkCmdBindPipeline(commandBuffers_[i], VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline_);
         
-        // Legacy rendering path - bind global descriptor set (set 0)
-        vkCmdBindDescriptorSets(commandBuffers_[i], VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, 1, &globalDescriptorSet_, 0, nullptr);
+        // Legacy rendering path - bind global descriptor set (set 0);
+        // static recording never advances the frame ring, so frame 0's set
+        vkCmdBindDescriptorSets(commandBuffers_[i], VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, 1, &globalDescriptorSets_[0], 0, nullptr);
 
         // Legacy rendering path - bind default material descriptor set (set 1)
         if (materialSystem_ && materialSystem_->getMaterialCount() > 0) {
             VkDescriptorSet defaultMaterialDescriptorSet = materialSystem_->getDescriptorSet(0); // Use first material as default
             if (defaultMaterialDescriptorSet != VK_NULL_HANDLE) {
-                vkCmdBindDescriptorSets(commandBuffers_[i], VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 1, 1, &defaultMaterialDescriptorSet, 0, nullptr);
+                uint32_t dynamicOffset = materialSystem_->getDynamicOffset(0);
+                vkCmdBindDescriptorSets(commandBuffers_[i], VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 1, 1, &defaultMaterialDescriptorSet, 1, &dynamicOffset);
             }
         }
         
@@ -2147,12 +4082,31 @@ void VulkanRenderer::updateUniformBuffer() {
 
     // GLM was originally designed for OpenGL, where the Y coordinate of the clip coordinates is inverted
     ubo.proj[1][1] *= -1;
-    ubo._padding = 0.0f;
+    ubo.time = time;  // grass wind and other shader-side animation
 
-    void* data;
-    vkMapMemory(device_, uniformBufferMemory_, 0, sizeof(ubo), 0, &data);
-    memcpy(data, &ubo, sizeof(ubo));
-    vkUnmapMemory(device_, uniformBufferMemory_);
+    // The cull pass tests against exactly what this frame renders with;
+    // the separate matrices feed the Hi-Z sphere projection
+    cullViewProjMatrix_ = ubo.proj * ubo.view;
+    cullViewMatrix_ = ubo.view;
+    cullProjMatrix_ = ubo.proj;
+
+    // Single batched write into this frame's persistently mapped buffer;
+    // the timeline wait already guaranteed the GPU is done with this slot
+    memcpy(uniformBuffersMapped_[currentFrameInFlight_].get(), &ubo, sizeof(ubo));
+    frameRenderStats_.bufferUploadBytes += sizeof(ubo);
+
+    // Material constants rarely change; flush only when staged data is dirty
+    if (materialDataDirty_) {
+        updateMaterialBuffer();
+        materialDataDirty_ = false;
+    }
+
+    // Rebin the clustered point lights against this frame's camera
+    if (lightingSystem_) {
+        lightingSystem_->updateClusters(ubo.view, ubo.proj,
+                                        static_cast<float>(swapChainExtent_.width),
+                                        static_cast<float>(swapChainExtent_.height));
+    }
 }
 
 void VulkanRenderer::updateMaterialBuffer() {
@@ -2160,6 +4114,7 @@ void VulkanRenderer::updateMaterialBuffer() {
     vkMapMemory(device_, materialBufferMemory_, 0, sizeof(MaterialData), 0, &data);
     memcpy(data, &currentMaterialData_, sizeof(MaterialData));
     vkUnmapMemory(device_, materialBufferMemory_);
+    frameRenderStats_.bufferUploadBytes += sizeof(MaterialData);
 }
 
 // =============================================================================
@@ -2218,6 +4173,9 @@ void VulkanRenderer::initializeCoreSystemsTemporary() {
     // These systems need Vulkan device which we don't have until after createLogicalDevice()
     
     resourceManager_ = std::make_shared<ResourceManager>(device_, physicalDevice_);
+    transferManager_ = std::make_shared<TransferManager>(device_, physicalDevice_,
+                                                         graphicsQueueFamily_, graphicsQueue_,
+                                                         transferQueueFamily_, transferQueue_);
     // Create robust path to assets directory based on executable location
     std::filesystem::path executablePath = std::filesystem::current_path();
     std::filesystem::path assetsPath;
@@ -2254,11 +4212,20 @@ void VulkanRenderer::initializeCoreSystemsTemporary() {
     }
     
     assetManager_ = std::make_shared<AssetManager>(device_, physicalDevice_, commandPool_, graphicsQueue_, assetsPath.string() + "/");
+    assetManager_->setTransferManager(transferManager_);
+    assetManager_->setBindlessTextureRegistrar([this](VkImageView view, VkSampler sampler) {
+        return registerBindlessTexture(view, sampler);
+    });
+    assetManager_->setBindlessTextureUpdater([this](uint32_t slot, VkImageView view, VkSampler sampler) {
+        updateBindlessTexture(slot, view, sampler);
+    });
     modelLoader_ = std::make_shared<ModelLoader>(resourceManager_, assetManager_);
     lightingSystem_ = std::make_shared<LightingSystem>(resourceManager_);
     lightingSystem_->createLightingBuffers();
+    descriptorAllocator_ = std::make_unique<DescriptorAllocator>(device_);
     materialSystem_ = std::make_shared<MaterialSystem>(resourceManager_);
     materialSystem_->setDescriptorSetLayout(materialDescriptorSetLayout_);
+    materialSystem_->setDescriptorAllocator(descriptorAllocator_.get());
     materialSystem_->createMaterialBuffers();
 
     // Create a default material for legacy rendering compatibility
@@ -2332,15 +4299,47 @@ void VulkanRenderer::ensureStandardMaterialsExist() {
 
 void VulkanRenderer::cleanup() {
     VKMON_INFO("Beginning VulkanRenderer cleanup...");
-    
+
+    // Drain and join the frame capture consumer before anything it
+    // references (fences, readback buffers, command pool) goes away
+    stopFrameCapture();
+
     if (device_ != VK_NULL_HANDLE) {
         vkDeviceWaitIdle(device_);
     }
-    
-    cleanupSwapChain();
 
-    // Cleanup GPU instancing resources (Phase 7.1)
+    // Join the shader reload worker and release any pipeline it finished
+    // that never got swapped in
+    if (shaderReloadThread_.joinable()) {
+        shaderReloadThread_.join();
+    }
+    if (pendingGraphicsPipeline_ != VK_NULL_HANDLE) {
+        vkDestroyPipeline(device_, pendingGraphicsPipeline_, nullptr);
+        pendingGraphicsPipeline_ = VK_NULL_HANDLE;
+    }
+    if (pendingVertShaderModule_ != VK_NULL_HANDLE) {
+        vkDestroyShaderModule(device_, pendingVertShaderModule_, nullptr);
+        pendingVertShaderModule_ = VK_NULL_HANDLE;
+    }
+    if (pendingFragShaderModule_ != VK_NULL_HANDLE) {
+        vkDestroyShaderModule(device_, pendingFragShaderModule_, nullptr);
+        pendingFragShaderModule_ = VK_NULL_HANDLE;
+    }
+
+    // Drain and destroy the async uploader before the systems that own the
+    // resources it may still be writing
+    transferManager_.reset();
+
+    cleanupSwapChain();
+
+    // Cleanup GPU instancing resources (Phase 7.1)
     cleanupInstanceBuffer();
+    cleanupIndirectCommandBuffer();
+    cleanupHiZResources();
+    cleanupParticleComputeResources();  // before the cull cleanup destroys the shared compute pool
+    cleanupCullComputeResources();
+    cleanupDepthPrePassResources();
+    cleanupBindlessTextureResources();
 
     // Cleanup sync objects
     if (imageAvailableSemaphore_ != VK_NULL_HANDLE) {
@@ -2351,17 +4350,31 @@ void VulkanRenderer::cleanup() {
         vkDestroySemaphore(device_, renderFinishedSemaphore_, nullptr);
         renderFinishedSemaphore_ = VK_NULL_HANDLE;
     }
-    if (inFlightFence_ != VK_NULL_HANDLE) {
-        vkDestroyFence(device_, inFlightFence_, nullptr);
-        inFlightFence_ = VK_NULL_HANDLE;
+    if (renderTimeline_ != VK_NULL_HANDLE) {
+        vkDestroySemaphore(device_, renderTimeline_, nullptr);
+        renderTimeline_ = VK_NULL_HANDLE;
+    }
+    if (computeTimeline_ != VK_NULL_HANDLE) {
+        vkDestroySemaphore(device_, computeTimeline_, nullptr);
+        computeTimeline_ = VK_NULL_HANDLE;
     }
     
+    // Join recording workers and destroy their pools before the main pool
+    cleanupParallelRecordingResources();
+
     // Cleanup command pool
     if (commandPool_ != VK_NULL_HANDLE) {
         vkDestroyCommandPool(device_, commandPool_, nullptr);
         commandPool_ = VK_NULL_HANDLE;
     }
     
+    // Destroy pooled descriptor chunks (and every set allocated from
+    // them, including MaterialSystem's) before the device goes away
+    if (descriptorAllocator_) {
+        descriptorAllocator_->cleanup();
+        descriptorAllocator_.reset();
+    }
+
     // Cleanup descriptor resources
     if (descriptorPool_ != VK_NULL_HANDLE) {
         vkDestroyDescriptorPool(device_, descriptorPool_, nullptr);
@@ -2405,13 +4418,16 @@ void VulkanRenderer::cleanup() {
     }
     
     // Cleanup buffers
-    if (uniformBuffer_ != VK_NULL_HANDLE) {
-        vkDestroyBuffer(device_, uniformBuffer_, nullptr);
-        uniformBuffer_ = VK_NULL_HANDLE;
-    }
-    if (uniformBufferMemory_ != VK_NULL_HANDLE) {
-        vkFreeMemory(device_, uniformBufferMemory_, nullptr);
-        uniformBufferMemory_ = VK_NULL_HANDLE;
+    for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+        uniformBuffersMapped_[frame].unmap();
+        if (uniformBuffers_[frame] != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device_, uniformBuffers_[frame], nullptr);
+            uniformBuffers_[frame] = VK_NULL_HANDLE;
+        }
+        if (uniformBufferMemories_[frame] != VK_NULL_HANDLE) {
+            vkFreeMemory(device_, uniformBufferMemories_[frame], nullptr);
+            uniformBufferMemories_[frame] = VK_NULL_HANDLE;
+        }
     }
     if (materialBuffer_ != VK_NULL_HANDLE) {
         vkDestroyBuffer(device_, materialBuffer_, nullptr);
@@ -2422,6 +4438,21 @@ void VulkanRenderer::cleanup() {
         materialBufferMemory_ = VK_NULL_HANDLE;
     }
     
+    // Cleanup GPU timing resources
+    if (timestampQueryPool_ != VK_NULL_HANDLE) {
+        vkDestroyQueryPool(device_, timestampQueryPool_, nullptr);
+        timestampQueryPool_ = VK_NULL_HANDLE;
+        gpuTimingSupported_ = false;
+        timestampsIssued_ = false;
+    }
+
+    // Persist and destroy the pipeline cache
+    if (pipelineCache_ != VK_NULL_HANDLE) {
+        savePipelineCache();
+        vkDestroyPipelineCache(device_, pipelineCache_, nullptr);
+        pipelineCache_ = VK_NULL_HANDLE;
+    }
+
     // Cleanup Vulkan context
     if (device_ != VK_NULL_HANDLE) {
         vkDestroyDevice(device_, nullptr);
@@ -2462,8 +4493,13 @@ void VulkanRenderer::cleanupSwapChain() {
         }
     }
     swapChainFramebuffers_.clear();
+    if (prePassFramebuffer_ != VK_NULL_HANDLE) {
+        vkDestroyFramebuffer(device_, prePassFramebuffer_, nullptr);
+        prePassFramebuffer_ = VK_NULL_HANDLE;
+    }
     
-    // Cleanup pipeline
+    // Cleanup pipeline and any specialized variants
+    destroyPipelineVariants();
     if (graphicsPipeline_ != VK_NULL_HANDLE) {
         vkDestroyPipeline(device_, graphicsPipeline_, nullptr);
         graphicsPipeline_ = VK_NULL_HANDLE;
@@ -2474,6 +4510,10 @@ void VulkanRenderer::cleanupSwapChain() {
         vkDestroyPipeline(device_, instancedGraphicsPipeline_, nullptr);
         instancedGraphicsPipeline_ = VK_NULL_HANDLE;
     }
+    if (grassGraphicsPipeline_ != VK_NULL_HANDLE) {
+        vkDestroyPipeline(device_, grassGraphicsPipeline_, nullptr);
+        grassGraphicsPipeline_ = VK_NULL_HANDLE;
+    }
 
     if (pipelineLayout_ != VK_NULL_HANDLE) {
         vkDestroyPipelineLayout(device_, pipelineLayout_, nullptr);
@@ -2485,6 +4525,14 @@ void VulkanRenderer::cleanupSwapChain() {
         vkDestroyRenderPass(device_, renderPass_, nullptr);
         renderPass_ = VK_NULL_HANDLE;
     }
+    if (renderPassDepthLoad_ != VK_NULL_HANDLE) {
+        vkDestroyRenderPass(device_, renderPassDepthLoad_, nullptr);
+        renderPassDepthLoad_ = VK_NULL_HANDLE;
+    }
+    if (depthPrePassRenderPass_ != VK_NULL_HANDLE) {
+        vkDestroyRenderPass(device_, depthPrePassRenderPass_, nullptr);
+        depthPrePassRenderPass_ = VK_NULL_HANDLE;
+    }
     
     // Cleanup shader modules
     if (vertShaderModule_ != VK_NULL_HANDLE) {
@@ -2505,6 +4553,10 @@ void VulkanRenderer::cleanupSwapChain() {
         vkDestroyShaderModule(device_, instancedFragShaderModule_, nullptr);
         instancedFragShaderModule_ = VK_NULL_HANDLE;
     }
+    if (grassVertShaderModule_ != VK_NULL_HANDLE) {
+        vkDestroyShaderModule(device_, grassVertShaderModule_, nullptr);
+        grassVertShaderModule_ = VK_NULL_HANDLE;
+    }
     
     // Cleanup image views
     for (auto imageView : swapChainImageViews_) {
@@ -2514,6 +4566,13 @@ void VulkanRenderer::cleanupSwapChain() {
     }
     swapChainImageViews_.clear();
     
+    // Reap retired swapchains from resizes that never got a following
+    // frame - safe unconditionally, cleanup() idled the device
+    for (const auto& retired : retiredSwapchains_) {
+        vkDestroySwapchainKHR(device_, retired.swapchain, nullptr);
+    }
+    retiredSwapchains_.clear();
+
     // Cleanup swapchain
     if (swapChain_ != VK_NULL_HANDLE) {
         vkDestroySwapchainKHR(device_, swapChain_, nullptr);
@@ -2659,212 +4718,2074 @@ void VulkanRenderer::endImGuiFrame() {
 // =============================================================================
 
 void VulkanRenderer::createInstanceBuffer() {
-    VKMON_INFO("Creating GPU instance buffer for " + std::to_string(maxInstances_) + " creatures");
+    VKMON_INFO("Creating GPU instance buffers for " + std::to_string(INITIAL_INSTANCE_CAPACITY) + " creatures ("
+              + std::to_string(MAX_FRAMES_IN_FLIGHT) + " frames in flight)");
+
+    VkDeviceSize bufferSize = INITIAL_INSTANCE_CAPACITY * sizeof(VulkanMon::InstanceData);
+
+    // One persistently mapped buffer per frame in flight so CPU writes
+    // never land in a buffer the GPU is still reading
+    for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+        instanceCapacities_[frame] = INITIAL_INSTANCE_CAPACITY;
+        createBuffer(bufferSize,
+                    VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                    instanceBuffers_[frame],
+                    instanceBufferMemories_[frame],
+                    /*shareWithAsyncCompute*/ true);  // read by the cull pass
+
+        void* mappedPtr = nullptr;
+        VkResult result = vkMapMemory(device_, instanceBufferMemories_[frame], 0, bufferSize, 0, &mappedPtr);
+        if (result != VK_SUCCESS) {
+            throw std::runtime_error("Failed to map instance buffer memory!");
+        }
+
+        instanceBuffersMapped_[frame] = MappedBuffer(device_, instanceBufferMemories_[frame], mappedPtr);
+    }
+
+    VKMON_INFO("GPU instance buffers created: " + std::to_string(MAX_FRAMES_IN_FLIGHT) + " x "
+              + std::to_string(bufferSize / 1024) + " KB");
+}
+
+VulkanRenderer::InstanceOverflowBlock* VulkanRenderer::acquireInstanceOverflowBlock(uint32_t instanceCount) {
+    auto& blocks = instanceOverflowBlocks_[currentFrameInFlight_];
+
+    // A batch must stay contiguous inside one block (a draw binds a
+    // single instance buffer), so find a block with room for the whole
+    // batch before chaining a new one
+    for (auto& block : blocks) {
+        if (block.used + instanceCount <= block.capacity) {
+            return &block;
+        }
+    }
+
+    uint32_t capacity = std::max(instanceCount, OVERFLOW_BLOCK_MIN_INSTANCES);
+    InstanceOverflowBlock block;
+    block.capacity = capacity;
+
+    try {
+        VkDeviceSize blockSize = capacity * sizeof(VulkanMon::InstanceData);
+        // Vertex-only usage: the cull pass never sees overflow blocks,
+        // and they live for at most one use of this frame slot
+        createBuffer(blockSize,
+                    VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                    block.buffer,
+                    block.memory);
+
+        void* mappedPtr = nullptr;
+        if (vkMapMemory(device_, block.memory, 0, blockSize, 0, &mappedPtr) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to map instance overflow block!");
+        }
+        block.mapped = MappedBuffer(device_, block.memory, mappedPtr);
+    } catch (const std::exception& e) {
+        // Growth is an optimization over dropping - if the device is out
+        // of memory, fall back to the old behavior instead of crashing
+        VKMON_WARNING(std::string("Instance overflow block allocation failed: ") + e.what());
+        if (block.buffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device_, block.buffer, nullptr);
+        }
+        if (block.memory != VK_NULL_HANDLE) {
+            vkFreeMemory(device_, block.memory, nullptr);
+        }
+        return nullptr;
+    }
+
+    VKMON_INFO("Instance buffer full - chained overflow block for " + std::to_string(capacity) +
+              " instances (frame slot " + std::to_string(currentFrameInFlight_) + ")");
+    blocks.push_back(std::move(block));
+    return &blocks.back();
+}
+
+void VulkanRenderer::destroyInstanceOverflowBlocks(uint32_t frame) {
+    for (auto& block : instanceOverflowBlocks_[frame]) {
+        block.mapped.unmap();
+        if (block.buffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device_, block.buffer, nullptr);
+        }
+        if (block.memory != VK_NULL_HANDLE) {
+            vkFreeMemory(device_, block.memory, nullptr);
+        }
+    }
+    instanceOverflowBlocks_[frame].clear();
+}
+
+void VulkanRenderer::coalesceInstanceBuffer() {
+    // Called from beginECSFrame right after the frame slot rotation: the
+    // timeline wait guarantees the GPU finished this slot's previous use,
+    // so its buffers and cull descriptor set are safe to replace
+    uint32_t frame = currentFrameInFlight_;
+    const uint32_t capacity = instanceCapacities_[frame];
+
+    if (instanceOverflowBlocks_[frame].empty() && instanceDemandHighWater_ <= capacity) {
+        return;
+    }
+
+    if (instanceDemandHighWater_ > capacity && capacity < INSTANCE_HARD_CAP) {
+        // Double up to the observed demand so repeated spikes converge in
+        // a few frames instead of reallocating on every small increase
+        uint32_t newCapacity = capacity;
+        while (newCapacity < instanceDemandHighWater_ && newCapacity < INSTANCE_HARD_CAP) {
+            newCapacity *= 2;
+        }
+        newCapacity = std::min(newCapacity, INSTANCE_HARD_CAP);
+
+        instanceBuffersMapped_[frame] = MappedBuffer();  // unmap before destroying
+        vkDestroyBuffer(device_, instanceBuffers_[frame], nullptr);
+        vkFreeMemory(device_, instanceBufferMemories_[frame], nullptr);
+
+        VkDeviceSize newSize = static_cast<VkDeviceSize>(newCapacity) * sizeof(VulkanMon::InstanceData);
+        createBuffer(newSize,
+                    VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                    instanceBuffers_[frame],
+                    instanceBufferMemories_[frame],
+                    /*shareWithAsyncCompute*/ true);  // read by the cull pass
+
+        void* mappedPtr = nullptr;
+        if (vkMapMemory(device_, instanceBufferMemories_[frame], 0, newSize, 0, &mappedPtr) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to map grown instance buffer memory!");
+        }
+        instanceBuffersMapped_[frame] = MappedBuffer(device_, instanceBufferMemories_[frame], mappedPtr);
+        instanceCapacities_[frame] = newCapacity;
+
+        // Repoint the cull pass at the new buffer; this slot's descriptor
+        // set is idle for the same reason the buffer was safe to replace
+        if (cullDescriptorSets_[frame] != VK_NULL_HANDLE) {
+            VkDescriptorBufferInfo bufferInfo{instanceBuffers_[frame], 0, VK_WHOLE_SIZE};
+            VkWriteDescriptorSet write{};
+            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.dstSet = cullDescriptorSets_[frame];
+            write.dstBinding = 0;
+            write.descriptorCount = 1;
+            write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            write.pBufferInfo = &bufferInfo;
+            vkUpdateDescriptorSets(device_, 1, &write, 0, nullptr);
+        }
+
+        VKMON_INFO("Instance buffer coalesced to " + std::to_string(newCapacity) +
+                  " instances (" + std::to_string(newSize / 1024) + " KB, frame slot " +
+                  std::to_string(frame) + ")");
+    }
+
+    // The retired frame already consumed the blocks' contents; instance
+    // data is rewritten every frame, so no bytes need copying over
+    destroyInstanceOverflowBlocks(frame);
+}
+
+void VulkanRenderer::createIndirectCommandBuffer() {
+    VKMON_INFO("Creating indirect draw command buffer for " + std::to_string(maxIndirectDraws_) + " draws");
 
-    instanceBufferSize_ = maxInstances_ * sizeof(VulkanMon::InstanceData);
+    indirectCommandBufferSize_ = maxIndirectDraws_ * sizeof(VkDrawIndexedIndirectCommand);
 
-    // Create persistently mapped buffer for dynamic updates
-    createBuffer(instanceBufferSize_,
-                VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+    // Persistently mapped, host coherent - the command table is rewritten
+    // every frame as batches are recorded
+    createBuffer(indirectCommandBufferSize_,
+                VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                instanceBuffer_,
-                instanceBufferMemory_);
+                indirectCommandBuffer_,
+                indirectCommandBufferMemory_,
+                /*shareWithAsyncCompute*/ true);  // cull pass rewrites instanceCount
 
-    // Map the buffer persistently for efficient updates
     void* mappedPtr = nullptr;
-    VkResult result = vkMapMemory(device_, instanceBufferMemory_, 0, instanceBufferSize_, 0, &mappedPtr);
+    VkResult result = vkMapMemory(device_, indirectCommandBufferMemory_, 0, indirectCommandBufferSize_, 0, &mappedPtr);
     if (result != VK_SUCCESS) {
-        throw std::runtime_error("Failed to map instance buffer memory!");
+        throw std::runtime_error("Failed to map indirect command buffer memory!");
     }
 
-    // Create RAII wrapper for mapped memory
-    instanceBufferMapped_ = MappedBuffer(device_, instanceBufferMemory_, mappedPtr);
+    indirectCommandBufferMapped_ = MappedBuffer(device_, indirectCommandBufferMemory_, mappedPtr);
 
-    VKMON_INFO("GPU instance buffer created: " + std::to_string(instanceBufferSize_ / 1024) + " KB");
+    VKMON_INFO("Indirect draw command buffer created: " + std::to_string(indirectCommandBufferSize_ / 1024) + " KB");
 }
 
-void VulkanRenderer::updateInstanceData(const std::vector<VulkanMon::InstanceData>& instances) {
-    // SAFETY FIX: Deprecated method - force single-batch mode only to prevent corruption
-    // WARNING: This method should not be used with multi-batch rendering systems
-    VKMON_WARNING("updateInstanceData() is deprecated - use clearInstanceBuffer() + updateInstanceDataDirect()");
+void VulkanRenderer::cleanupIndirectCommandBuffer() {
+    // MappedBuffer RAII wrapper handles automatic unmapping
 
-    if (instances.empty()) {
-        return;
+    if (indirectCommandBuffer_ != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device_, indirectCommandBuffer_, nullptr);
+        indirectCommandBuffer_ = VK_NULL_HANDLE;
     }
 
-    // CRITICAL SAFETY: Force clean state to prevent any possibility of corruption
-    // This ensures we never mix single-batch and multi-batch rendering unsafely
-    clearInstanceBuffer();
+    if (indirectCommandBufferMemory_ != VK_NULL_HANDLE) {
+        vkFreeMemory(device_, indirectCommandBufferMemory_, nullptr);
+        indirectCommandBufferMemory_ = VK_NULL_HANDLE;
+    }
+}
 
-    // Use the robust, offset-aware implementation starting from clean state
-    updateInstanceDataDirect(instances.data(), static_cast<uint32_t>(instances.size()));
+void VulkanRenderer::createCullComputeResources() {
+    try {
+        // Descriptor layout: instance array in, culled array out, command
+        // table, plus the camera globals and Hi-Z pyramid the occlusion
+        // test reads (bindings 3 and 4, written by writeCullHiZDescriptors)
+        std::array<VkDescriptorSetLayoutBinding, 5> bindings{};
+        for (uint32_t i = 0; i < bindings.size(); ++i) {
+            bindings[i].binding = i;
+            bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[i].descriptorCount = 1;
+            bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        }
+        bindings[3].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        bindings[4].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+        layoutInfo.pBindings = bindings.data();
+        if (vkCreateDescriptorSetLayout(device_, &layoutInfo, nullptr, &cullDescriptorSetLayout_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create cull descriptor set layout!");
+        }
 
-    // Note: No offset restoration - this method now owns the entire buffer
-}
+        VkPushConstantRange pushRange{};
+        pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushRange.offset = 0;
+        pushRange.size = sizeof(CullPushConstants);
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &cullDescriptorSetLayout_;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushRange;
+        if (vkCreatePipelineLayout(device_, &pipelineLayoutInfo, nullptr, &cullPipelineLayout_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create cull pipeline layout!");
+        }
 
-void VulkanRenderer::updateInstanceDataDirect(const InstanceData* instances, uint32_t instanceCount) {
-    // ENHANCED PROTECTION: Multiple validation layers with corruption detection
+        auto shaderCode = Utils::readFile(CREATURE_CULL_SHADER_COMPILED);
+        VkShaderModule shaderModule = createShaderModule(shaderCode);
+
+        VkComputePipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineInfo.stage.module = shaderModule;
+        pipelineInfo.stage.pName = "main";
+        pipelineInfo.layout = cullPipelineLayout_;
+
+        VkResult pipelineResult = vkCreateComputePipelines(device_, pipelineCache_, 1, &pipelineInfo, nullptr, &cullComputePipeline_);
+        vkDestroyShaderModule(device_, shaderModule, nullptr);
+        if (pipelineResult != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create cull compute pipeline!");
+        }
 
-    // Layer 0: CRITICAL - Buffer state corruption detection
-    if (currentInstanceOffset_ > maxInstances_) {
-        VKMON_ERROR("CRITICAL: Buffer state corrupted - offset " + std::to_string(currentInstanceOffset_) +
-                   " > max " + std::to_string(maxInstances_));
-        VKMON_WARNING("Auto-recovering: Resetting buffer to safe state");
-        clearInstanceBuffer();
+        // Device-local compacted instance buffer - written by compute,
+        // read as vertex binding 1; the CPU never touches it. It stays at
+        // the initial capacity even when primaries grow: batches past it
+        // simply skip compaction rather than forcing a shared-buffer
+        // reallocation that would have to wait on both frames in flight
+        culledInstanceCapacity_ = INITIAL_INSTANCE_CAPACITY;
+        VkDeviceSize culledBufferSize = INITIAL_INSTANCE_CAPACITY * sizeof(VulkanMon::InstanceData);
+        createBuffer(culledBufferSize,
+                    VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                    culledInstanceBuffer_,
+                    culledInstanceBufferMemory_,
+                    /*shareWithAsyncCompute*/ true);  // written by compute, read as vertex input
+
+        // Host-visible globals buffer for the cull pass camera data,
+        // persistently mapped and rewritten in beginCullPass (the frame
+        // timeline wait keeps the GPU out of it while the CPU writes)
+        createBuffer(sizeof(CullGlobals),
+                    VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                    cullGlobalsBuffer_,
+                    cullGlobalsBufferMemory_,
+                    /*shareWithAsyncCompute*/ true);  // read by the cull pass
+        if (vkMapMemory(device_, cullGlobalsBufferMemory_, 0, sizeof(CullGlobals), 0, &cullGlobalsMapped_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to map cull globals buffer!");
+        }
+
+        // Dedicated pool for the culling descriptor sets, one per frame in
+        // flight because binding 0 points at that frame's instance buffer
+        std::array<VkDescriptorPoolSize, 3> poolSizes{};
+        poolSizes[0] = {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3 * MAX_FRAMES_IN_FLIGHT};
+        poolSizes[1] = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, MAX_FRAMES_IN_FLIGHT};
+        poolSizes[2] = {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, MAX_FRAMES_IN_FLIGHT};
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+        poolInfo.pPoolSizes = poolSizes.data();
+        poolInfo.maxSets = MAX_FRAMES_IN_FLIGHT;
+        if (vkCreateDescriptorPool(device_, &poolInfo, nullptr, &cullDescriptorPool_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create cull descriptor pool!");
+        }
+
+        std::array<VkDescriptorSetLayout, MAX_FRAMES_IN_FLIGHT> layouts;
+        layouts.fill(cullDescriptorSetLayout_);
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = cullDescriptorPool_;
+        allocInfo.descriptorSetCount = MAX_FRAMES_IN_FLIGHT;
+        allocInfo.pSetLayouts = layouts.data();
+        if (vkAllocateDescriptorSets(device_, &allocInfo, cullDescriptorSets_.data()) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate cull descriptor sets!");
+        }
+
+        for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+            std::array<VkDescriptorBufferInfo, 3> bufferInfos{};
+            bufferInfos[0] = {instanceBuffers_[frame], 0, VK_WHOLE_SIZE};
+            bufferInfos[1] = {culledInstanceBuffer_, 0, VK_WHOLE_SIZE};
+            bufferInfos[2] = {indirectCommandBuffer_, 0, VK_WHOLE_SIZE};
+
+            std::array<VkWriteDescriptorSet, 3> writes{};
+            for (uint32_t i = 0; i < writes.size(); ++i) {
+                writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                writes[i].dstSet = cullDescriptorSets_[frame];
+                writes[i].dstBinding = i;
+                writes[i].descriptorCount = 1;
+                writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                writes[i].pBufferInfo = &bufferInfos[i];
+            }
+            vkUpdateDescriptorSets(device_, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+        }
+
+        // The cull pass records into its own command buffer. With async
+        // compute it must come from a pool on the compute family; without,
+        // it shares the graphics pool and is submitted ahead of the
+        // graphics commands each frame
+        if (asyncComputeAvailable_) {
+            VkCommandPoolCreateInfo poolCreateInfo{};
+            poolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+            poolCreateInfo.queueFamilyIndex = computeQueueFamily_;
+            if (vkCreateCommandPool(device_, &poolCreateInfo, nullptr, &computeCommandPool_) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to create compute command pool!");
+            }
+        }
+
+        VkCommandBufferAllocateInfo cmdAllocInfo{};
+        cmdAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        cmdAllocInfo.commandPool = asyncComputeAvailable_ ? computeCommandPool_ : commandPool_;
+        cmdAllocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        cmdAllocInfo.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(device_, &cmdAllocInfo, &cullCommandBuffer_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate cull command buffer!");
+        }
+
+        VKMON_INFO("GPU culling resources created (" + std::to_string(culledBufferSize / 1024) + " KB culled instance buffer)");
+    } catch (const std::exception& e) {
+        // GPU culling is an optimization, not a requirement - clean up
+        // partial state and keep the CPU path working
+        VKMON_WARNING(std::string("GPU culling unavailable: ") + e.what());
+        cleanupCullComputeResources();
     }
+}
 
-    if (totalInstancesThisFrame_ > MAX_INSTANCES_PER_FRAME) {
-        VKMON_ERROR("CRITICAL: Frame state corrupted - total " + std::to_string(totalInstancesThisFrame_) +
-                   " > max " + std::to_string(MAX_INSTANCES_PER_FRAME));
-        VKMON_WARNING("Auto-recovering: Resetting frame state");
-        clearInstanceBuffer();
+void VulkanRenderer::cleanupCullComputeResources() {
+    VkCommandPool cullPool = (computeCommandPool_ != VK_NULL_HANDLE) ? computeCommandPool_ : commandPool_;
+    if (cullCommandBuffer_ != VK_NULL_HANDLE && cullPool != VK_NULL_HANDLE) {
+        vkFreeCommandBuffers(device_, cullPool, 1, &cullCommandBuffer_);
+        cullCommandBuffer_ = VK_NULL_HANDLE;
+    }
+    if (computeCommandPool_ != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(device_, computeCommandPool_, nullptr);
+        computeCommandPool_ = VK_NULL_HANDLE;
+    }
+    if (cullGlobalsBuffer_ != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device_, cullGlobalsBuffer_, nullptr);
+        cullGlobalsBuffer_ = VK_NULL_HANDLE;
+    }
+    if (cullGlobalsBufferMemory_ != VK_NULL_HANDLE) {
+        vkFreeMemory(device_, cullGlobalsBufferMemory_, nullptr);  // implicitly unmaps
+        cullGlobalsBufferMemory_ = VK_NULL_HANDLE;
+        cullGlobalsMapped_ = nullptr;
+    }
+    if (culledInstanceBuffer_ != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device_, culledInstanceBuffer_, nullptr);
+        culledInstanceBuffer_ = VK_NULL_HANDLE;
+        culledInstanceCapacity_ = 0;
+    }
+    if (culledInstanceBufferMemory_ != VK_NULL_HANDLE) {
+        vkFreeMemory(device_, culledInstanceBufferMemory_, nullptr);
+        culledInstanceBufferMemory_ = VK_NULL_HANDLE;
+    }
+    if (cullDescriptorPool_ != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(device_, cullDescriptorPool_, nullptr);
+        cullDescriptorPool_ = VK_NULL_HANDLE;
+        cullDescriptorSets_.fill(VK_NULL_HANDLE); // freed with their pool
+    }
+    if (cullComputePipeline_ != VK_NULL_HANDLE) {
+        vkDestroyPipeline(device_, cullComputePipeline_, nullptr);
+        cullComputePipeline_ = VK_NULL_HANDLE;
+    }
+    if (cullPipelineLayout_ != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(device_, cullPipelineLayout_, nullptr);
+        cullPipelineLayout_ = VK_NULL_HANDLE;
+    }
+    if (cullDescriptorSetLayout_ != VK_NULL_HANDLE) {
+        vkDestroyDescriptorSetLayout(device_, cullDescriptorSetLayout_, nullptr);
+        cullDescriptorSetLayout_ = VK_NULL_HANDLE;
+    }
+    gpuCullingEnabled_ = false;
+    cullPassActive_ = false;
+}
+
+void VulkanRenderer::setGpuCullingEnabled(bool enabled) {
+    if (enabled && cullComputePipeline_ == VK_NULL_HANDLE) {
+        VKMON_WARNING("GPU culling requested but compute resources are unavailable");
+        return;
     }
+    gpuCullingEnabled_ = enabled;
+    VKMON_INFO(std::string("GPU compute culling ") + (enabled ? "enabled" : "disabled"));
+}
 
-    // Layer 1: Basic parameter validation
-    if (!instances) {
-        VKMON_ERROR("Instance buffer update failed: Null instance data pointer");
+void VulkanRenderer::setOcclusionCullingEnabled(bool enabled) {
+    if (enabled && hizBuildPipeline_ == VK_NULL_HANDLE) {
+        VKMON_WARNING("Occlusion culling requested but Hi-Z resources are unavailable");
         return;
     }
+    occlusionCullingEnabled_ = enabled;
+    hiZValid_ = false;  // pyramid is rebuilt before any test reads it
+    VKMON_INFO(std::string("Hi-Z occlusion culling ") + (enabled ? "enabled" : "disabled"));
+}
 
-    if (instanceCount == 0) {
-        return; // Valid but no-op
+void VulkanRenderer::setGpuParticlesEnabled(bool enabled) {
+    if (enabled && particleComputePipeline_ == VK_NULL_HANDLE) {
+        VKMON_WARNING("GPU particles requested but compute resources are unavailable");
+        return;
     }
+    gpuParticlesEnabled_ = enabled;
+    VKMON_INFO(std::string("GPU particle simulation ") + (enabled ? "enabled" : "disabled"));
+}
 
-    // Layer 2: Buffer state validation
-    if (!instanceBufferMapped_.isValid()) {
-        VKMON_ERROR("Instance buffer update failed: Buffer not mapped");
+void VulkanRenderer::emitParticles(const VulkanMon::ParticleEmitParams& params) {
+    if (!gpuParticlesEnabled_ || particleComputePipeline_ == VK_NULL_HANDLE) {
         return;
     }
+    if (params.count == 0) {
+        return;
+    }
+    // Staged CPU-side and packed into the emit ring by the next
+    // beginParticlePass; bursts staged mid-frame land one frame later
+    pendingParticleEmits_.push_back(params);
+}
 
-    // Layer 3: Per-batch overflow protection with graceful degradation
-    if (currentInstanceOffset_ + instanceCount > maxInstances_) {
-        // Calculate how many instances we can still fit
-        uint32_t remainingSpace = maxInstances_ - currentInstanceOffset_;
+void VulkanRenderer::createParticleComputeResources() {
+    try {
+        if (asyncComputeAvailable_ && computeCommandPool_ == VK_NULL_HANDLE) {
+            // The particle pass records on the cull pass's compute pool;
+            // if that setup failed, particles cannot reach the queue either
+            throw std::runtime_error("compute command pool unavailable");
+        }
 
-        if (remainingSpace == 0) {
-            VKMON_WARNING("Instance buffer full - skipping batch of " + std::to_string(instanceCount) + " instances");
-            return; // Graceful degradation: skip this batch
+        // Descriptor layout: pool in/out, this frame's emit requests,
+        // compacted instance output, and the indirect draw command
+        std::array<VkDescriptorSetLayoutBinding, 4> bindings{};
+        for (uint32_t i = 0; i < bindings.size(); ++i) {
+            bindings[i].binding = i;
+            bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[i].descriptorCount = 1;
+            bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
         }
 
-        // Partial batch rendering: fit what we can
-        VKMON_WARNING("Instance buffer overflow - rendering partial batch: " +
-                     std::to_string(remainingSpace) + "/" + std::to_string(instanceCount) + " instances");
-        instanceCount = remainingSpace;
-    }
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+        layoutInfo.pBindings = bindings.data();
+        if (vkCreateDescriptorSetLayout(device_, &layoutInfo, nullptr, &particleDescriptorSetLayout_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create particle descriptor set layout!");
+        }
 
-    // Layer 4: Frame-level overflow protection with graceful degradation
-    if (totalInstancesThisFrame_ + instanceCount > MAX_INSTANCES_PER_FRAME) {
-        // Calculate how many instances we can still fit this frame
-        uint32_t remainingFrameSpace = MAX_INSTANCES_PER_FRAME - totalInstancesThisFrame_;
+        VkPushConstantRange pushRange{};
+        pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushRange.offset = 0;
+        pushRange.size = sizeof(ParticlePushConstants);
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &particleDescriptorSetLayout_;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushRange;
+        if (vkCreatePipelineLayout(device_, &pipelineLayoutInfo, nullptr, &particlePipelineLayout_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create particle pipeline layout!");
+        }
 
-        if (remainingFrameSpace == 0) {
-            VKMON_WARNING("Frame instance limit reached - skipping batch of " + std::to_string(instanceCount) + " instances");
-            return; // Graceful degradation: skip this batch
+        auto shaderCode = Utils::readFile(PARTICLE_UPDATE_SHADER_COMPILED);
+        VkShaderModule shaderModule = createShaderModule(shaderCode);
+
+        VkComputePipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineInfo.stage.module = shaderModule;
+        pipelineInfo.stage.pName = "main";
+        pipelineInfo.layout = particlePipelineLayout_;
+
+        VkResult pipelineResult = vkCreateComputePipelines(device_, pipelineCache_, 1, &pipelineInfo, nullptr, &particleComputePipeline_);
+        vkDestroyShaderModule(device_, shaderModule, nullptr);
+        if (pipelineResult != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create particle compute pipeline!");
         }
 
-        // Partial batch rendering: fit what we can in this frame
-        VKMON_WARNING("Frame instance overflow - rendering partial batch: " +
-                     std::to_string(remainingFrameSpace) + "/" + std::to_string(instanceCount) + " instances");
-        instanceCount = remainingFrameSpace;
-    }
+        // Device-local particle pool - GPU-owned for its whole lifetime.
+        // Zero-filled once so every slot starts dead (life <= 0)
+        VkDeviceSize poolSize = PARTICLE_POOL_CAPACITY * PARTICLE_POOL_SLOT_SIZE;
+        createBuffer(poolSize,
+                    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                    particlePoolBuffer_, particlePoolBufferMemory_,
+                    /*shareWithAsyncCompute*/ true);
+
+        VkCommandBuffer initCommands = beginSingleTimeCommands();
+        vkCmdFillBuffer(initCommands, particlePoolBuffer_, 0, poolSize, 0);
+        endSingleTimeCommands(initCommands);
+
+        // Compacted survivors - written by compute, read as vertex binding 1
+        createBuffer(PARTICLE_POOL_CAPACITY * sizeof(VulkanMon::InstanceData),
+                    VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                    particleInstanceBuffer_, particleInstanceBufferMemory_,
+                    /*shareWithAsyncCompute*/ true);
+
+        // Single indirect draw command, host-visible so the CPU can reset
+        // the count and fill in the mesh fields; instanceCount is bumped
+        // by the simulate dispatch
+        createBuffer(sizeof(VkDrawIndexedIndirectCommand),
+                    VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                    particleIndirectBuffer_, particleIndirectBufferMemory_,
+                    /*shareWithAsyncCompute*/ true);
+        void* indirectPtr = nullptr;
+        if (vkMapMemory(device_, particleIndirectBufferMemory_, 0, sizeof(VkDrawIndexedIndirectCommand), 0, &indirectPtr) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to map particle indirect buffer!");
+        }
+        particleIndirectMapped_ = MappedBuffer(device_, particleIndirectBufferMemory_, indirectPtr);
+        memset(indirectPtr, 0, sizeof(VkDrawIndexedIndirectCommand));
+
+        // Emit request ring - one buffer per frame in flight, persistently
+        // mapped, packed by beginParticlePass from the staged bursts
+        VkDeviceSize emitRingSize = MAX_PARTICLE_EMITS_PER_FRAME * sizeof(ParticleEmitRequestGpu);
+        for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+            createBuffer(emitRingSize,
+                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                        particleEmitBuffers_[frame], particleEmitBufferMemories_[frame],
+                        /*shareWithAsyncCompute*/ true);
+            void* mappedPtr = nullptr;
+            if (vkMapMemory(device_, particleEmitBufferMemories_[frame], 0, emitRingSize, 0, &mappedPtr) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to map particle emit buffer!");
+            }
+            particleEmitBuffersMapped_[frame] = MappedBuffer(device_, particleEmitBufferMemories_[frame], mappedPtr);
+        }
 
-    // Calculate offset position in buffer
-    size_t dataSize = instanceCount * sizeof(VulkanMon::InstanceData);
-    size_t offsetBytes = currentInstanceOffset_ * sizeof(VulkanMon::InstanceData);
-    char* bufferStart = static_cast<char*>(instanceBufferMapped_.get());
+        // One descriptor set per frame in flight because binding 1 points
+        // at that frame's slot of the emit ring
+        std::array<VkDescriptorPoolSize, 1> poolSizes{};
+        poolSizes[0] = {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 4 * MAX_FRAMES_IN_FLIGHT};
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+        poolInfo.pPoolSizes = poolSizes.data();
+        poolInfo.maxSets = MAX_FRAMES_IN_FLIGHT;
+        if (vkCreateDescriptorPool(device_, &poolInfo, nullptr, &particleDescriptorPool_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create particle descriptor pool!");
+        }
 
-    // Copy to offset position - append instead of overwrite
-    memcpy(bufferStart + offsetBytes, instances, dataSize);
+        std::array<VkDescriptorSetLayout, MAX_FRAMES_IN_FLIGHT> layouts;
+        layouts.fill(particleDescriptorSetLayout_);
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = particleDescriptorPool_;
+        allocInfo.descriptorSetCount = MAX_FRAMES_IN_FLIGHT;
+        allocInfo.pSetLayouts = layouts.data();
+        if (vkAllocateDescriptorSets(device_, &allocInfo, particleDescriptorSets_.data()) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate particle descriptor sets!");
+        }
 
-    // Update frame tracking (after successful write)
-    totalInstancesThisFrame_ += instanceCount;
+        for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+            std::array<VkDescriptorBufferInfo, 4> bufferInfos{};
+            bufferInfos[0] = {particlePoolBuffer_, 0, VK_WHOLE_SIZE};
+            bufferInfos[1] = {particleEmitBuffers_[frame], 0, VK_WHOLE_SIZE};
+            bufferInfos[2] = {particleInstanceBuffer_, 0, VK_WHOLE_SIZE};
+            bufferInfos[3] = {particleIndirectBuffer_, 0, VK_WHOLE_SIZE};
+
+            std::array<VkWriteDescriptorSet, 4> writes{};
+            for (uint32_t i = 0; i < writes.size(); ++i) {
+                writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                writes[i].dstSet = particleDescriptorSets_[frame];
+                writes[i].dstBinding = i;
+                writes[i].descriptorCount = 1;
+                writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                writes[i].pBufferInfo = &bufferInfos[i];
+            }
+            vkUpdateDescriptorSets(device_, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+        }
 
-    #ifdef DEBUG_VERBOSE
-    VKMON_DEBUG("Instance buffer: Added " + std::to_string(instanceCount) +
-               " instances at offset " + std::to_string(currentInstanceOffset_) +
-               " (frame total: " + std::to_string(totalInstancesThisFrame_) + ")");
-    #endif
+        // Record on the cull pass's compute pool so both passes land in
+        // one submission on the async queue (graphics pool otherwise)
+        VkCommandBufferAllocateInfo cmdAllocInfo{};
+        cmdAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        cmdAllocInfo.commandPool = asyncComputeAvailable_ ? computeCommandPool_ : commandPool_;
+        cmdAllocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        cmdAllocInfo.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(device_, &cmdAllocInfo, &particleCommandBuffer_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate particle command buffer!");
+        }
 
-    // No need to flush due to HOST_COHERENT_BIT
+        VKMON_INFO("GPU particle resources created (" + std::to_string(PARTICLE_POOL_CAPACITY) +
+                  " slot pool, " + std::to_string(poolSize / (1024 * 1024)) + " MB)");
+    } catch (const std::exception& e) {
+        // Particles are a content feature, not a requirement - clean up
+        // partial state and keep the rest of the renderer working
+        VKMON_WARNING(std::string("GPU particles unavailable: ") + e.what());
+        cleanupParticleComputeResources();
+    }
 }
 
-void VulkanRenderer::clearInstanceBuffer() {
-    // Reset frame state for clean multi-batch rendering
-    currentInstanceOffset_ = 0;
-    totalInstancesThisFrame_ = 0;
-
-    // Optional: Zero buffer memory for debugging (expensive, only in debug builds)
-    #ifdef DEBUG_CLEAR_INSTANCE_BUFFER
-    if (instanceBufferMapped_.isValid()) {
-        memset(instanceBufferMapped_.get(), 0, instanceBufferSize_);
+void VulkanRenderer::cleanupParticleComputeResources() {
+    VkCommandPool particlePool = (computeCommandPool_ != VK_NULL_HANDLE) ? computeCommandPool_ : commandPool_;
+    if (particleCommandBuffer_ != VK_NULL_HANDLE && particlePool != VK_NULL_HANDLE) {
+        vkFreeCommandBuffers(device_, particlePool, 1, &particleCommandBuffer_);
+        particleCommandBuffer_ = VK_NULL_HANDLE;
+    }
+    for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+        particleEmitBuffersMapped_[frame].unmap();
+        if (particleEmitBuffers_[frame] != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device_, particleEmitBuffers_[frame], nullptr);
+            particleEmitBuffers_[frame] = VK_NULL_HANDLE;
+        }
+        if (particleEmitBufferMemories_[frame] != VK_NULL_HANDLE) {
+            vkFreeMemory(device_, particleEmitBufferMemories_[frame], nullptr);
+            particleEmitBufferMemories_[frame] = VK_NULL_HANDLE;
+        }
     }
-    #endif
+    particleIndirectMapped_.unmap();
+    if (particleIndirectBuffer_ != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device_, particleIndirectBuffer_, nullptr);
+        particleIndirectBuffer_ = VK_NULL_HANDLE;
+    }
+    if (particleIndirectBufferMemory_ != VK_NULL_HANDLE) {
+        vkFreeMemory(device_, particleIndirectBufferMemory_, nullptr);
+        particleIndirectBufferMemory_ = VK_NULL_HANDLE;
+    }
+    if (particleInstanceBuffer_ != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device_, particleInstanceBuffer_, nullptr);
+        particleInstanceBuffer_ = VK_NULL_HANDLE;
+    }
+    if (particleInstanceBufferMemory_ != VK_NULL_HANDLE) {
+        vkFreeMemory(device_, particleInstanceBufferMemory_, nullptr);
+        particleInstanceBufferMemory_ = VK_NULL_HANDLE;
+    }
+    if (particlePoolBuffer_ != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device_, particlePoolBuffer_, nullptr);
+        particlePoolBuffer_ = VK_NULL_HANDLE;
+    }
+    if (particlePoolBufferMemory_ != VK_NULL_HANDLE) {
+        vkFreeMemory(device_, particlePoolBufferMemory_, nullptr);
+        particlePoolBufferMemory_ = VK_NULL_HANDLE;
+    }
+    if (particleComputePipeline_ != VK_NULL_HANDLE) {
+        vkDestroyPipeline(device_, particleComputePipeline_, nullptr);
+        particleComputePipeline_ = VK_NULL_HANDLE;
+    }
+    if (particlePipelineLayout_ != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(device_, particlePipelineLayout_, nullptr);
+        particlePipelineLayout_ = VK_NULL_HANDLE;
+    }
+    if (particleDescriptorPool_ != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(device_, particleDescriptorPool_, nullptr);
+        particleDescriptorPool_ = VK_NULL_HANDLE;
+    }
+    if (particleDescriptorSetLayout_ != VK_NULL_HANDLE) {
+        vkDestroyDescriptorSetLayout(device_, particleDescriptorSetLayout_, nullptr);
+        particleDescriptorSetLayout_ = VK_NULL_HANDLE;
+    }
+    gpuParticlesEnabled_ = false;
+    particlePassActive_ = false;
 }
 
-void VulkanRenderer::cleanupInstanceBuffer() {
-    // MappedBuffer RAII wrapper handles automatic unmapping
+void VulkanRenderer::beginParticlePass() {
+    particlePassActive_ = false;
+    if (!gpuParticlesEnabled_ || particleComputePipeline_ == VK_NULL_HANDLE) {
+        pendingParticleEmits_.clear();
+        return;
+    }
+
+    // Pack the staged bursts into this frame's slot of the emit ring.
+    // The frame timeline wait already guaranteed the GPU is done with it
+    auto* requests = static_cast<ParticleEmitRequestGpu*>(particleEmitBuffersMapped_[currentFrameInFlight_].get());
+    uint32_t requestCount = 0;
+    uint32_t emitThreads = 0;
+    for (const auto& emit : pendingParticleEmits_) {
+        if (requestCount >= MAX_PARTICLE_EMITS_PER_FRAME) {
+            VKMON_WARNING("Particle emit ring full (" + std::to_string(MAX_PARTICLE_EMITS_PER_FRAME) +
+                         " requests) - dropping " + std::to_string(pendingParticleEmits_.size() - requestCount) + " bursts");
+            break;
+        }
+        uint32_t count = std::min(emit.count, PARTICLE_POOL_CAPACITY);
+
+        glm::vec3 axis = emit.direction;
+        float axisLength = glm::length(axis);
+        axis = axisLength > 1e-5f ? axis / axisLength : glm::vec3(0.0f, 1.0f, 0.0f);
 
-    if (instanceBuffer_ != VK_NULL_HANDLE) {
-        vkDestroyBuffer(device_, instanceBuffer_, nullptr);
-        instanceBuffer_ = VK_NULL_HANDLE;
+        ParticleEmitRequestGpu request{};
+        request.origin = glm::vec4(emit.origin, emit.baseSpeed);
+        request.direction = glm::vec4(axis, emit.spread);
+        request.params = glm::vec4(emit.lifetimeSeconds, emit.size, emit.gravityScale, emit.drag);
+        request.slots = glm::uvec4(particlePoolCursor_, count, emitThreads, emit.materialId);
+        requests[requestCount++] = request;
+
+        particlePoolCursor_ = (particlePoolCursor_ + count) % PARTICLE_POOL_CAPACITY;
+        emitThreads += count;
     }
+    pendingParticleEmits_.clear();
 
-    if (instanceBufferMemory_ != VK_NULL_HANDLE) {
-        vkFreeMemory(device_, instanceBufferMemory_, nullptr);
-        instanceBufferMemory_ = VK_NULL_HANDLE;
+    if (emitThreads > 0) {
+        particlesEverEmitted_ = true;
+    }
+    if (!particlesEverEmitted_) {
+        return;  // pool is all-dead, skip the simulate dispatch entirely
     }
 
-    VKMON_INFO("GPU instance buffer cleanup complete");
+    // Reset this frame's draw count; the mesh-dependent fields are filled
+    // in by renderGpuParticles once the batch mesh is known
+    auto* command = static_cast<VkDrawIndexedIndirectCommand*>(particleIndirectMapped_.get());
+    command->instanceCount = 0;
+    command->firstInstance = 0;
+
+    ++particleFrameSeed_;
+
+    vkResetCommandBuffer(particleCommandBuffer_, 0);
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    if (vkBeginCommandBuffer(particleCommandBuffer_, &beginInfo) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to begin recording particle command buffer!");
+    }
+
+    vkCmdBindPipeline(particleCommandBuffer_, VK_PIPELINE_BIND_POINT_COMPUTE, particleComputePipeline_);
+    vkCmdBindDescriptorSets(particleCommandBuffer_, VK_PIPELINE_BIND_POINT_COMPUTE, particlePipelineLayout_,
+                           0, 1, &particleDescriptorSets_[currentFrameInFlight_], 0, nullptr);
+
+    constexpr uint32_t WORKGROUP_SIZE = 64;  // matches local_size_x in particle_update.comp
+
+    ParticlePushConstants push{};
+    push.poolCapacity = PARTICLE_POOL_CAPACITY;
+    push.deltaTime = std::min(lastFrameTime_ / 1000.0f, 0.1f);  // clamp hitches so particles never teleport
+    push.frameSeed = particleFrameSeed_;
+
+    if (emitThreads > 0) {
+        push.mode = PARTICLE_MODE_EMIT;
+        push.threadCount = emitThreads;
+        push.requestCount = requestCount;
+        vkCmdPushConstants(particleCommandBuffer_, particlePipelineLayout_,
+                          VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(push), &push);
+        vkCmdDispatch(particleCommandBuffer_, (emitThreads + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE, 1, 1);
+
+        // Spawn writes must land before the simulate dispatch reads the pool
+        VkMemoryBarrier emitBarrier{};
+        emitBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        emitBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        emitBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        vkCmdPipelineBarrier(particleCommandBuffer_,
+                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                            0, 1, &emitBarrier, 0, nullptr, 0, nullptr);
+    }
+
+    push.mode = PARTICLE_MODE_SIMULATE;
+    push.threadCount = PARTICLE_POOL_CAPACITY;
+    push.requestCount = 0;
+    vkCmdPushConstants(particleCommandBuffer_, particlePipelineLayout_,
+                      VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(push), &push);
+    vkCmdDispatch(particleCommandBuffer_, (PARTICLE_POOL_CAPACITY + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE, 1, 1);
+
+    particlePassActive_ = true;
 }
 
-std::vector<VkVertexInputBindingDescription> VulkanRenderer::getInstancedBindingDescriptions() {
-    std::vector<VkVertexInputBindingDescription> bindings(2);
+void VulkanRenderer::renderGpuParticles(const std::string& meshPath, uint32_t baseMaterialId) {
+    if (!ecsFrameActive_) {
+        VKMON_WARNING("renderGpuParticles called outside ECS frame - ignoring");
+        return;
+    }
+    if (!particlePassActive_) {
+        return;  // nothing simulated this frame
+    }
 
-    // Binding 0: Per-vertex data (same as before)
-    bindings[0].binding = 0;
-    bindings[0].stride = sizeof(ModelVertex);
-    bindings[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+    AssetID meshId = AssetID::intern(meshPath);
+    ensureMeshLoaded(meshId);
 
-    // Binding 1: Per-instance data (NEW for GPU instancing)
-    bindings[1].binding = 1;
-    bindings[1].stride = sizeof(VulkanMon::InstanceData);
-    bindings[1].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+    std::shared_ptr<Model> model;
+    {
+        std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
+        auto modelIt = modelCache_.find(meshId);
+        if (modelIt != modelCache_.end()) {
+            model = modelIt->second;
+        }
+    }
+    if (!model || model->meshes.empty()) {
+        VKMON_WARNING("No model cached for particle meshPath: " + meshPath);
+        return;
+    }
 
-    return bindings;
-}
+    // Fill in the mesh-dependent fields of the indirect command; the
+    // compute pass only ever touches instanceCount. Only the first
+    // submesh is drawn - particle meshes are single-piece by design
+    const auto& mesh = model->meshes.front();
+    auto* command = static_cast<VkDrawIndexedIndirectCommand*>(particleIndirectMapped_.get());
+    command->indexCount = static_cast<uint32_t>(mesh->indexCount());
+    command->firstIndex = mesh->firstIndex;
+    command->vertexOffset = mesh->baseVertex;
 
-std::vector<VkVertexInputAttributeDescription> VulkanRenderer::getInstancedAttributeDescriptions() {
-    std::vector<VkVertexInputAttributeDescription> attributes(12);
+    VkCommandBuffer commandBuffer = parallelFrameActive_ ? tailSecondaries_[currentFrameInFlight_]
+                                                         : commandBuffers_[currentImageIndex_];
 
-    // Per-vertex attributes (locations 0-3) - unchanged
-    attributes[0] = {0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(ModelVertex, position)};
-    attributes[1] = {1, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(ModelVertex, normal)};
-    attributes[2] = {2, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(ModelVertex, texCoords)};
-    attributes[3] = {3, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(ModelVertex, color)};
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, instancedGraphicsPipeline_);
+    frameRenderStats_.pipelineBinds++;
 
-    // Per-instance attributes (locations 4-11) - NEW for GPU instancing
-    // Instance model matrix (4 vec4s = locations 4,5,6,7)
-    for (uint32_t i = 0; i < 4; i++) {
-        attributes[4 + i] = {
-            4 + i,                                                    // location
-            1,                                                        // binding 1 (instance data)
-            VK_FORMAT_R32G32B32A32_SFLOAT,                           // vec4 format
-            static_cast<uint32_t>(offsetof(VulkanMon::InstanceData, modelMatrix) + sizeof(glm::vec4) * i)
-        };
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
+                           0, 1, &globalDescriptorSets_[currentFrameInFlight_], 0, nullptr);
+    frameRenderStats_.descriptorBinds++;
+
+    if (materialSystem_ && baseMaterialId < materialSystem_->getMaterialCount()) {
+        VkDescriptorSet materialDescriptorSet = materialSystem_->getDescriptorSet(baseMaterialId);
+        if (materialDescriptorSet != VK_NULL_HANDLE) {
+            uint32_t dynamicOffset = materialSystem_->getDynamicOffset(baseMaterialId);
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
+                                   1, 1, &materialDescriptorSet, 1, &dynamicOffset);
+            boundMaterialId_ = NO_MATERIAL_BOUND;
+            frameRenderStats_.descriptorBinds++;
+        }
+    }
+
+    VkBuffer vertexBuffers[] = {mesh->vertexBufferHandle, particleInstanceBuffer_};
+    VkDeviceSize offsets[] = {0, 0};
+    vkCmdBindVertexBuffers(commandBuffer, 0, 2, vertexBuffers, offsets);
+    vkCmdBindIndexBuffer(commandBuffer, mesh->indexBufferHandle, 0, VK_INDEX_TYPE_UINT32);
+    boundVertexBuffer_ = VK_NULL_HANDLE;
+    boundIndexBuffer_ = VK_NULL_HANDLE;
+
+    // The draw count lives GPU-side, so only the draw call is tallied;
+    // instancesSubmitted would require a readback to report
+    vkCmdDrawIndexedIndirect(commandBuffer, particleIndirectBuffer_, 0, 1,
+                            sizeof(VkDrawIndexedIndirectCommand));
+    frameRenderStats_.drawCalls++;
+}
+
+void VulkanRenderer::createHiZResources() {
+    if (cullComputePipeline_ == VK_NULL_HANDLE) {
+        return; // the pyramid is only ever consumed by the cull pass
     }
 
-    // Instance material params (location 8) - vec4
-    attributes[8] = {8, 1, VK_FORMAT_R32G32B32A32_SFLOAT, static_cast<uint32_t>(offsetof(VulkanMon::InstanceData, materialParams))};
+    try {
+        // Half resolution: pyramid mip 0 is already a 2x2 max-reduce of
+        // the depth buffer, saving a full-size copy pass and half the
+        // memory while keeping the test conservative
+        hiZExtent_.width = std::max(1u, swapChainExtent_.width / 2);
+        hiZExtent_.height = std::max(1u, swapChainExtent_.height / 2);
+        uint32_t maxDim = std::max(hiZExtent_.width, hiZExtent_.height);
+        hiZMipLevels_ = 1;
+        while ((maxDim >>= 1) > 0) {
+            hiZMipLevels_++;
+        }
+
+        // createImage() has no mip support, so the pyramid image is
+        // created directly
+        VkImageCreateInfo imageInfo{};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent = {hiZExtent_.width, hiZExtent_.height, 1};
+        imageInfo.mipLevels = hiZMipLevels_;
+        imageInfo.arrayLayers = 1;
+        imageInfo.format = VK_FORMAT_R32_SFLOAT;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        // Built on the graphics queue, sampled by the cull shader on the
+        // async compute queue; concurrent sharing avoids ownership transfers
+        uint32_t sharedFamilies[] = {graphicsQueueFamily_, computeQueueFamily_};
+        if (asyncComputeAvailable_) {
+            imageInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            imageInfo.queueFamilyIndexCount = 2;
+            imageInfo.pQueueFamilyIndices = sharedFamilies;
+        }
+        if (vkCreateImage(device_, &imageInfo, nullptr, &hiZImage_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create Hi-Z pyramid image!");
+        }
+
+        VkMemoryRequirements memRequirements;
+        vkGetImageMemoryRequirements(device_, hiZImage_, &memRequirements);
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = memRequirements.size;
+        allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        if (vkAllocateMemory(device_, &allocInfo, nullptr, &hiZImageMemory_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate Hi-Z pyramid memory!");
+        }
+        vkBindImageMemory(device_, hiZImage_, hiZImageMemory_, 0);
+
+        // One view per mip for the build chain, one full-chain view for
+        // the cull pass
+        VkImageViewCreateInfo viewInfo{};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = hiZImage_;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = VK_FORMAT_R32_SFLOAT;
+        viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+
+        hiZMipViews_.resize(hiZMipLevels_);
+        for (uint32_t level = 0; level < hiZMipLevels_; ++level) {
+            viewInfo.subresourceRange.baseMipLevel = level;
+            viewInfo.subresourceRange.levelCount = 1;
+            if (vkCreateImageView(device_, &viewInfo, nullptr, &hiZMipViews_[level]) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to create Hi-Z mip view!");
+            }
+        }
+        viewInfo.subresourceRange.baseMipLevel = 0;
+        viewInfo.subresourceRange.levelCount = hiZMipLevels_;
+        if (vkCreateImageView(device_, &viewInfo, nullptr, &hiZFullView_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create Hi-Z full view!");
+        }
+
+        // NEAREST everywhere: the cull shader picks an explicit mip and
+        // wants raw max-depth texels, never filtered blends
+        VkSamplerCreateInfo samplerInfo{};
+        samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        samplerInfo.magFilter = VK_FILTER_NEAREST;
+        samplerInfo.minFilter = VK_FILTER_NEAREST;
+        samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.minLod = 0.0f;
+        samplerInfo.maxLod = static_cast<float>(hiZMipLevels_);
+        if (vkCreateSampler(device_, &samplerInfo, nullptr, &hiZSampler_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create Hi-Z sampler!");
+        }
+
+        // Build pipeline: source level sampled in, destination level as
+        // storage image
+        std::array<VkDescriptorSetLayoutBinding, 2> buildBindings{};
+        buildBindings[0].binding = 0;
+        buildBindings[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        buildBindings[0].descriptorCount = 1;
+        buildBindings[0].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        buildBindings[1].binding = 1;
+        buildBindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        buildBindings[1].descriptorCount = 1;
+        buildBindings[1].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+        VkDescriptorSetLayoutCreateInfo buildLayoutInfo{};
+        buildLayoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        buildLayoutInfo.bindingCount = static_cast<uint32_t>(buildBindings.size());
+        buildLayoutInfo.pBindings = buildBindings.data();
+        if (vkCreateDescriptorSetLayout(device_, &buildLayoutInfo, nullptr, &hizBuildDescriptorSetLayout_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create Hi-Z build descriptor set layout!");
+        }
+
+        VkPushConstantRange pushRange{};
+        pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushRange.offset = 0;
+        pushRange.size = sizeof(HiZBuildPushConstants);
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &hizBuildDescriptorSetLayout_;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushRange;
+        if (vkCreatePipelineLayout(device_, &pipelineLayoutInfo, nullptr, &hizBuildPipelineLayout_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create Hi-Z build pipeline layout!");
+        }
+
+        auto shaderCode = Utils::readFile(HIZ_BUILD_SHADER_COMPILED);
+        VkShaderModule shaderModule = createShaderModule(shaderCode);
+
+        VkComputePipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineInfo.stage.module = shaderModule;
+        pipelineInfo.stage.pName = "main";
+        pipelineInfo.layout = hizBuildPipelineLayout_;
+
+        VkResult pipelineResult = vkCreateComputePipelines(device_, pipelineCache_, 1, &pipelineInfo, nullptr, &hizBuildPipeline_);
+        vkDestroyShaderModule(device_, shaderModule, nullptr);
+        if (pipelineResult != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create Hi-Z build compute pipeline!");
+        }
+
+        // One descriptor set per level; level 0 samples the depth buffer
+        std::array<VkDescriptorPoolSize, 2> poolSizes{};
+        poolSizes[0] = {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, hiZMipLevels_};
+        poolSizes[1] = {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, hiZMipLevels_};
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+        poolInfo.pPoolSizes = poolSizes.data();
+        poolInfo.maxSets = hiZMipLevels_;
+        if (vkCreateDescriptorPool(device_, &poolInfo, nullptr, &hizBuildDescriptorPool_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create Hi-Z build descriptor pool!");
+        }
+
+        std::vector<VkDescriptorSetLayout> setLayouts(hiZMipLevels_, hizBuildDescriptorSetLayout_);
+        hizBuildDescriptorSets_.resize(hiZMipLevels_);
+        VkDescriptorSetAllocateInfo setAllocInfo{};
+        setAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        setAllocInfo.descriptorPool = hizBuildDescriptorPool_;
+        setAllocInfo.descriptorSetCount = hiZMipLevels_;
+        setAllocInfo.pSetLayouts = setLayouts.data();
+        if (vkAllocateDescriptorSets(device_, &setAllocInfo, hizBuildDescriptorSets_.data()) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate Hi-Z build descriptor sets!");
+        }
+
+        for (uint32_t level = 0; level < hiZMipLevels_; ++level) {
+            VkDescriptorImageInfo srcInfo{};
+            srcInfo.sampler = hiZSampler_;
+            if (level == 0) {
+                srcInfo.imageView = depthImageView_;
+                srcInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            } else {
+                srcInfo.imageView = hiZMipViews_[level - 1];
+                srcInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+            }
+
+            VkDescriptorImageInfo dstInfo{};
+            dstInfo.imageView = hiZMipViews_[level];
+            dstInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+            std::array<VkWriteDescriptorSet, 2> writes{};
+            writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[0].dstSet = hizBuildDescriptorSets_[level];
+            writes[0].dstBinding = 0;
+            writes[0].descriptorCount = 1;
+            writes[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            writes[0].pImageInfo = &srcInfo;
+            writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[1].dstSet = hizBuildDescriptorSets_[level];
+            writes[1].dstBinding = 1;
+            writes[1].descriptorCount = 1;
+            writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            writes[1].pImageInfo = &dstInfo;
+            vkUpdateDescriptorSets(device_, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+        }
 
-    // Instance LOD params (location 9) - vec4
-    attributes[9] = {9, 1, VK_FORMAT_R32G32B32A32_SFLOAT, static_cast<uint32_t>(offsetof(VulkanMon::InstanceData, lodParams))};
+        writeCullHiZDescriptors();
+
+        hiZLayoutInitialized_ = false;
+        hiZValid_ = false;
+
+        VKMON_INFO("Hi-Z pyramid created (" + std::to_string(hiZExtent_.width) + "x" +
+                   std::to_string(hiZExtent_.height) + ", " + std::to_string(hiZMipLevels_) + " mips)");
+    } catch (const std::exception& e) {
+        // The cull shader statically references the pyramid bindings, so
+        // without them GPU culling as a whole must stand down
+        VKMON_WARNING(std::string("Hi-Z occlusion culling unavailable: ") + e.what());
+        VKMON_WARNING("Disabling GPU culling - the cull shader requires the Hi-Z bindings");
+        cleanupHiZResources();
+        cleanupCullComputeResources();
+    }
+}
+
+void VulkanRenderer::writeCullHiZDescriptors() {
+    // Bindings 3 and 4 of the per-frame cull sets: camera globals and the
+    // full pyramid view. Rewritten after every pyramid recreation.
+    for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+        if (cullDescriptorSets_[frame] == VK_NULL_HANDLE) {
+            continue;
+        }
+
+        VkDescriptorBufferInfo globalsInfo{cullGlobalsBuffer_, 0, sizeof(CullGlobals)};
+
+        VkDescriptorImageInfo pyramidInfo{};
+        pyramidInfo.sampler = hiZSampler_;
+        pyramidInfo.imageView = hiZFullView_;
+        pyramidInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+        std::array<VkWriteDescriptorSet, 2> writes{};
+        writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[0].dstSet = cullDescriptorSets_[frame];
+        writes[0].dstBinding = 3;
+        writes[0].descriptorCount = 1;
+        writes[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writes[0].pBufferInfo = &globalsInfo;
+        writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[1].dstSet = cullDescriptorSets_[frame];
+        writes[1].dstBinding = 4;
+        writes[1].descriptorCount = 1;
+        writes[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        writes[1].pImageInfo = &pyramidInfo;
+        vkUpdateDescriptorSets(device_, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+    }
+}
+
+void VulkanRenderer::cleanupHiZResources() {
+    if (hizBuildDescriptorPool_ != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(device_, hizBuildDescriptorPool_, nullptr);
+        hizBuildDescriptorPool_ = VK_NULL_HANDLE;
+        hizBuildDescriptorSets_.clear(); // freed with their pool
+    }
+    if (hizBuildPipeline_ != VK_NULL_HANDLE) {
+        vkDestroyPipeline(device_, hizBuildPipeline_, nullptr);
+        hizBuildPipeline_ = VK_NULL_HANDLE;
+    }
+    if (hizBuildPipelineLayout_ != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(device_, hizBuildPipelineLayout_, nullptr);
+        hizBuildPipelineLayout_ = VK_NULL_HANDLE;
+    }
+    if (hizBuildDescriptorSetLayout_ != VK_NULL_HANDLE) {
+        vkDestroyDescriptorSetLayout(device_, hizBuildDescriptorSetLayout_, nullptr);
+        hizBuildDescriptorSetLayout_ = VK_NULL_HANDLE;
+    }
+    if (hiZSampler_ != VK_NULL_HANDLE) {
+        vkDestroySampler(device_, hiZSampler_, nullptr);
+        hiZSampler_ = VK_NULL_HANDLE;
+    }
+    for (VkImageView view : hiZMipViews_) {
+        vkDestroyImageView(device_, view, nullptr);
+    }
+    hiZMipViews_.clear();
+    if (hiZFullView_ != VK_NULL_HANDLE) {
+        vkDestroyImageView(device_, hiZFullView_, nullptr);
+        hiZFullView_ = VK_NULL_HANDLE;
+    }
+    if (hiZImage_ != VK_NULL_HANDLE) {
+        vkDestroyImage(device_, hiZImage_, nullptr);
+        hiZImage_ = VK_NULL_HANDLE;
+    }
+    if (hiZImageMemory_ != VK_NULL_HANDLE) {
+        vkFreeMemory(device_, hiZImageMemory_, nullptr);
+        hiZImageMemory_ = VK_NULL_HANDLE;
+    }
+    hiZMipLevels_ = 0;
+    hiZLayoutInitialized_ = false;
+    hiZValid_ = false;
+    // occlusionCullingEnabled_ survives deliberately: a swapchain resize
+    // rebuilds the pyramid and the setting picks right back up
+}
+
+void VulkanRenderer::recordHiZPyramidBuild(VkCommandBuffer commandBuffer) {
+    if (hizBuildPipeline_ == VK_NULL_HANDLE || !occlusionCullingEnabled_ || !gpuCullingEnabled_) {
+        hiZValid_ = false;  // stale contents must not gate next frame's draws
+        return;
+    }
+
+    // First build after (re)creation: move the whole pyramid out of
+    // UNDEFINED. It then stays in GENERAL forever - valid for both the
+    // storage writes here and the sampled reads in the cull pass.
+    if (!hiZLayoutInitialized_) {
+        VkImageMemoryBarrier initBarrier{};
+        initBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        initBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        initBarrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+        initBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        initBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        initBarrier.image = hiZImage_;
+        initBarrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, hiZMipLevels_, 0, 1};
+        initBarrier.srcAccessMask = 0;
+        initBarrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer,
+                            VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                            0, 0, nullptr, 0, nullptr, 1, &initBarrier);
+        hiZLayoutInitialized_ = true;
+    }
+
+    VkFormat depthFormat = findDepthFormat();
+    VkImageAspectFlags depthAspect = VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (hasStencilComponent(depthFormat)) {
+        depthAspect |= VK_IMAGE_ASPECT_STENCIL_BIT;
+    }
+
+    // Depth writes from the render pass -> sampled reads in the build
+    VkImageMemoryBarrier depthToRead{};
+    depthToRead.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    depthToRead.oldLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    depthToRead.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    depthToRead.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    depthToRead.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    depthToRead.image = depthImage_;
+    depthToRead.subresourceRange = {depthAspect, 0, 1, 0, 1};
+    depthToRead.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    depthToRead.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer,
+                        VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                        0, 0, nullptr, 0, nullptr, 1, &depthToRead);
+
+    // Max-reduce level by level, each dispatch waiting on the previous
+    // level's writes
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, hizBuildPipeline_);
+
+    uint32_t levelWidth = hiZExtent_.width;
+    uint32_t levelHeight = hiZExtent_.height;
+    for (uint32_t level = 0; level < hiZMipLevels_; ++level) {
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, hizBuildPipelineLayout_,
+                               0, 1, &hizBuildDescriptorSets_[level], 0, nullptr);
+
+        HiZBuildPushConstants push{static_cast<int32_t>(levelWidth), static_cast<int32_t>(levelHeight)};
+        vkCmdPushConstants(commandBuffer, hizBuildPipelineLayout_, VK_SHADER_STAGE_COMPUTE_BIT,
+                          0, sizeof(push), &push);
+        vkCmdDispatch(commandBuffer, (levelWidth + 7) / 8, (levelHeight + 7) / 8, 1);
+
+        if (level + 1 < hiZMipLevels_) {
+            VkImageMemoryBarrier levelBarrier{};
+            levelBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            levelBarrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+            levelBarrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+            levelBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            levelBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            levelBarrier.image = hiZImage_;
+            levelBarrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, level, 1, 0, 1};
+            levelBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            levelBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer,
+                                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                0, 0, nullptr, 0, nullptr, 1, &levelBarrier);
+        }
+
+        levelWidth = std::max(1u, levelWidth / 2);
+        levelHeight = std::max(1u, levelHeight / 2);
+    }
+
+    // Return depth to attachment layout for the next frame's passes. The
+    // cull pass's pyramid reads next frame are ordered by the frame timeline wait.
+    VkImageMemoryBarrier depthToAttachment = depthToRead;
+    depthToAttachment.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    depthToAttachment.newLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    depthToAttachment.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    depthToAttachment.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer,
+                        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+                        0, 0, nullptr, 0, nullptr, 1, &depthToAttachment);
+
+    hiZValid_ = true;
+}
+
+void VulkanRenderer::createDepthPrePassResources() {
+    VKMON_DEBUG("Creating depth pre-pass resources...");
+
+    // Shared fixed-function state for both depth-only pipelines. These
+    // mirror the shaded pipelines minus fragment stage and color output.
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+    VkPipelineViewportStateCreateInfo viewportState{};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.scissorCount = 1;
+
+    VkDynamicState dynamicStates[] = {
+        VK_DYNAMIC_STATE_VIEWPORT,
+        VK_DYNAMIC_STATE_SCISSOR
+    };
+
+    VkPipelineDynamicStateCreateInfo dynamicState{};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = 2;
+    dynamicState.pDynamicStates = dynamicStates;
+
+    VkPipelineRasterizationStateCreateInfo rasterizer{};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterizer.lineWidth = 1.0f;
+    rasterizer.cullMode = VK_CULL_MODE_NONE;
+    rasterizer.frontFace = VK_FRONT_FACE_CLOCKWISE;
+    rasterizer.depthBiasEnable = VK_FALSE;
+
+    VkPipelineMultisampleStateCreateInfo multisampling{};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    // The pre-pass owns the depth write with a strict LESS test; the
+    // shaded pass then passes at equal depth without writing anything new
+    VkPipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable = VK_TRUE;
+    depthStencil.depthWriteEnable = VK_TRUE;
+    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+    depthStencil.depthBoundsTestEnable = VK_FALSE;
+    depthStencil.stencilTestEnable = VK_FALSE;
+
+    // No color attachments in the depth-only subpass
+    VkPipelineColorBlendStateCreateInfo colorBlending{};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 0;
+
+    VkGraphicsPipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.stageCount = 1;  // vertex stage only, no fragment work
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pDepthStencilState = &depthStencil;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.pDynamicState = &dynamicState;
+    pipelineInfo.layout = pipelineLayout_;
+    pipelineInfo.renderPass = depthPrePassRenderPass_;
+    pipelineInfo.subpass = 0;
+    pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+
+    // Per-object variant reuses the standard vertex shader and input layout
+    VkPipelineShaderStageCreateInfo vertStage{};
+    vertStage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    vertStage.stage = VK_SHADER_STAGE_VERTEX_BIT;
+    vertStage.module = vertShaderModule_;
+    vertStage.pName = "main";
+    pipelineInfo.pStages = &vertStage;
+
+    auto bindingDescription = ModelVertex::getBindingDescription();
+    auto attributeDescriptions = ModelVertex::getAttributeDescriptions();
+
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInputInfo.vertexBindingDescriptionCount = 1;
+    vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
+    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
+    vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+
+    if (vkCreateGraphicsPipelines(device_, pipelineCache_, 1, &pipelineInfo, nullptr, &depthPrePassPipeline_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create depth pre-pass pipeline!");
+    }
+
+    // Instanced variant reuses the instanced vertex shader and input layout
+    vertStage.module = instancedVertShaderModule_;
+
+    auto instancedBindings = getInstancedBindingDescriptions();
+    auto instancedAttributes = getInstancedAttributeDescriptions();
+
+    VkPipelineVertexInputStateCreateInfo instancedInputInfo{};
+    instancedInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    instancedInputInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(instancedBindings.size());
+    instancedInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(instancedAttributes.size());
+    instancedInputInfo.pVertexBindingDescriptions = instancedBindings.data();
+    instancedInputInfo.pVertexAttributeDescriptions = instancedAttributes.data();
+    pipelineInfo.pVertexInputState = &instancedInputInfo;
+
+    if (vkCreateGraphicsPipelines(device_, pipelineCache_, 1, &pipelineInfo, nullptr, &depthPrePassInstancedPipeline_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create instanced depth pre-pass pipeline!");
+    }
+
+    // Dedicated command buffer so the pre-pass can be recorded in parallel
+    // with the shaded pass and submitted ahead of it (same pattern as the
+    // cull compute pass)
+    VkCommandBufferAllocateInfo cmdAllocInfo{};
+    cmdAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cmdAllocInfo.commandPool = commandPool_;
+    cmdAllocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cmdAllocInfo.commandBufferCount = 1;
+
+    if (vkAllocateCommandBuffers(device_, &cmdAllocInfo, &prePassCommandBuffer_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to allocate depth pre-pass command buffer!");
+    }
+
+    VKMON_INFO("Depth pre-pass resources created successfully");
+}
+
+void VulkanRenderer::cleanupDepthPrePassResources() {
+    if (prePassCommandBuffer_ != VK_NULL_HANDLE && commandPool_ != VK_NULL_HANDLE) {
+        vkFreeCommandBuffers(device_, commandPool_, 1, &prePassCommandBuffer_);
+        prePassCommandBuffer_ = VK_NULL_HANDLE;
+    }
+    if (depthPrePassPipeline_ != VK_NULL_HANDLE) {
+        vkDestroyPipeline(device_, depthPrePassPipeline_, nullptr);
+        depthPrePassPipeline_ = VK_NULL_HANDLE;
+    }
+    if (depthPrePassInstancedPipeline_ != VK_NULL_HANDLE) {
+        vkDestroyPipeline(device_, depthPrePassInstancedPipeline_, nullptr);
+        depthPrePassInstancedPipeline_ = VK_NULL_HANDLE;
+    }
+}
+
+void VulkanRenderer::setDepthPrePassEnabled(bool enabled) {
+    if (enabled && depthPrePassPipeline_ == VK_NULL_HANDLE) {
+        VKMON_WARNING("Depth pre-pass requested but its pipelines are unavailable");
+        return;
+    }
+    depthPrePassEnabled_ = enabled;
+    VKMON_INFO(std::string("Depth pre-pass ") + (enabled ? "enabled" : "disabled"));
+}
+
+void VulkanRenderer::beginDepthPrePass() {
+    prePassActive_ = false;
+    if (!depthPrePassEnabled_ || depthPrePassPipeline_ == VK_NULL_HANDLE ||
+        prePassFramebuffer_ == VK_NULL_HANDLE) {
+        return;
+    }
+
+    vkResetCommandBuffer(prePassCommandBuffer_, 0);
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    if (vkBeginCommandBuffer(prePassCommandBuffer_, &beginInfo) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to begin depth pre-pass command buffer!");
+    }
+
+    VkClearValue depthClear{};
+    depthClear.depthStencil = {1.0f, 0};
+
+    VkRenderPassBeginInfo renderPassInfo{};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    renderPassInfo.renderPass = depthPrePassRenderPass_;
+    renderPassInfo.framebuffer = prePassFramebuffer_;
+    renderPassInfo.renderArea.offset = {0, 0};
+    renderPassInfo.renderArea.extent = swapChainExtent_;
+    renderPassInfo.clearValueCount = 1;
+    renderPassInfo.pClearValues = &depthClear;
+
+    vkCmdBeginRenderPass(prePassCommandBuffer_, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+    vkCmdBindPipeline(prePassCommandBuffer_, VK_PIPELINE_BIND_POINT_GRAPHICS, depthPrePassPipeline_);
+
+    VkExtent2D currentWindowExtent = window_->getExtent();
+    VkViewport viewport{};
+    viewport.width = static_cast<float>(currentWindowExtent.width);
+    viewport.height = static_cast<float>(currentWindowExtent.height);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    vkCmdSetViewport(prePassCommandBuffer_, 0, 1, &viewport);
+
+    VkRect2D scissor{};
+    scissor.extent = currentWindowExtent;
+    vkCmdSetScissor(prePassCommandBuffer_, 0, 1, &scissor);
+
+    // Vertex shaders still read the frame UBO through set 0
+    vkCmdBindDescriptorSets(prePassCommandBuffer_, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
+                           0, 1, &globalDescriptorSets_[currentFrameInFlight_], 0, nullptr);
+
+    prePassBoundVertexBuffer_ = VK_NULL_HANDLE;
+    prePassBoundIndexBuffer_ = VK_NULL_HANDLE;
+    prePassActive_ = true;
+}
+
+void VulkanRenderer::setParallelCommandRecordingEnabled(bool enabled) {
+    if (enabled && recordingWorkers_.empty()) {
+        VKMON_WARNING("Parallel command recording requested but the worker pool is unavailable");
+        return;
+    }
+    parallelRecordingEnabled_ = enabled;
+    VKMON_INFO(std::string("Parallel command recording ") + (enabled ? "enabled" : "disabled"));
+}
+
+void VulkanRenderer::createParallelRecordingResources() {
+    VKMON_DEBUG("Creating parallel recording worker pool...");
+
+    uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    uint32_t workerCount = std::min(MAX_RECORDING_WORKERS,
+                                    hardwareThreads > 1 ? hardwareThreads - 1 : 1u);
+
+    recordingWorkers_ = std::vector<RecordingWorker>(workerCount);
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+            // Command pools are externally synchronized, so every worker
+            // records into its own pool; one per frame in flight lets a
+            // whole pool reset while the other frame's buffers are pending
+            VkCommandPoolCreateInfo poolInfo{};
+            poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+            poolInfo.queueFamilyIndex = graphicsQueueFamily_;
+            if (vkCreateCommandPool(device_, &poolInfo, nullptr,
+                                    &recordingWorkers_[i].commandPools[frame]) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to create recording worker command pool!");
+            }
+
+            VkCommandBufferAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.commandPool = recordingWorkers_[i].commandPools[frame];
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            allocInfo.commandBufferCount = 1;
+            if (vkAllocateCommandBuffers(device_, &allocInfo,
+                                         &recordingWorkers_[i].secondaries[frame]) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to allocate recording worker secondary command buffer!");
+            }
+        }
+    }
+
+    // Trailing secondaries are recorded on the main thread and come from
+    // the main pool, which allows per-buffer resets
+    VkCommandBufferAllocateInfo tailAlloc{};
+    tailAlloc.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    tailAlloc.commandPool = commandPool_;
+    tailAlloc.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+    tailAlloc.commandBufferCount = MAX_FRAMES_IN_FLIGHT;
+    if (vkAllocateCommandBuffers(device_, &tailAlloc, tailSecondaries_.data()) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to allocate trailing secondary command buffers!");
+    }
+
+    for (uint32_t i = 0; i < workerCount; ++i) {
+        recordingWorkers_[i].thread = std::thread(&VulkanRenderer::recordingWorkerLoop, this, i);
+    }
+
+    VKMON_INFO("Parallel recording pool ready (" + std::to_string(workerCount) + " workers)");
+}
+
+void VulkanRenderer::cleanupParallelRecordingResources() {
+    if (!recordingWorkers_.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(recordingMutex_);
+            recordingShutdown_ = true;
+        }
+        recordingWorkCv_.notify_all();
+        for (auto& worker : recordingWorkers_) {
+            if (worker.thread.joinable()) {
+                worker.thread.join();
+            }
+        }
+        for (auto& worker : recordingWorkers_) {
+            for (auto pool : worker.commandPools) {
+                if (pool != VK_NULL_HANDLE) {
+                    vkDestroyCommandPool(device_, pool, nullptr);
+                }
+            }
+        }
+        recordingWorkers_.clear();
+    }
+    // Trailing secondaries are freed with commandPool_
+    tailSecondaries_ = {};
+}
+
+void VulkanRenderer::recordingWorkerLoop(uint32_t workerIndex) {
+    uint64_t lastGeneration = 0;
+    while (true) {
+        size_t first = 0;
+        size_t count = 0;
+        {
+            std::unique_lock<std::mutex> lock(recordingMutex_);
+            recordingWorkCv_.wait(lock, [&] {
+                return recordingShutdown_ || recordingGeneration_ != lastGeneration;
+            });
+            if (recordingShutdown_) {
+                return;
+            }
+            lastGeneration = recordingGeneration_;
+            first = workerIndex * recordingChunkSize_;
+            count = first < deferredDraws_.size()
+                        ? std::min(recordingChunkSize_, deferredDraws_.size() - first)
+                        : 0;
+        }
+
+        // The draw list, frame index, and render state are stable while
+        // the main thread blocks on recordingDoneCv_, so recording needs
+        // no further locking
+        if (count > 0) {
+            vkResetCommandPool(device_, recordingWorkers_[workerIndex].commandPools[currentFrameInFlight_], 0);
+            recordDrawChunk(recordingWorkers_[workerIndex].secondaries[currentFrameInFlight_], first, count);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(recordingMutex_);
+            if (--recordingPendingJobs_ == 0) {
+                recordingDoneCv_.notify_one();
+            }
+        }
+    }
+}
+
+void VulkanRenderer::recordDrawChunk(VkCommandBuffer secondary, size_t first, size_t count) {
+    VkCommandBufferInheritanceInfo inheritance{};
+    inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritance.renderPass = activeRenderPass_;
+    inheritance.subpass = 0;
+    inheritance.framebuffer = swapChainFramebuffers_[currentImageIndex_];
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                      VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    beginInfo.pInheritanceInfo = &inheritance;
+
+    if (vkBeginCommandBuffer(secondary, &beginInfo) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to begin secondary command buffer!");
+    }
+
+    // Secondaries inherit no state, so rebuild the frame-constant bindings
+    vkCmdBindPipeline(secondary, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline_);
+
+    VkExtent2D currentWindowExtent = window_->getExtent();
+    VkViewport viewport{};
+    viewport.width = static_cast<float>(currentWindowExtent.width);
+    viewport.height = static_cast<float>(currentWindowExtent.height);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    vkCmdSetViewport(secondary, 0, 1, &viewport);
+
+    VkRect2D scissor{};
+    scissor.extent = currentWindowExtent;
+    vkCmdSetScissor(secondary, 0, 1, &scissor);
+
+    vkCmdBindDescriptorSets(secondary, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
+                           0, 1, &globalDescriptorSets_[currentFrameInFlight_], 0, nullptr);
+    vkCmdBindDescriptorSets(secondary, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
+                           2, 1, &bindlessTextureSet_, 0, nullptr);
+
+    // Bind elision is tracked per chunk; the primary path's members
+    // (boundVertexBuffer_ etc.) are never touched from workers
+    VkBuffer chunkVertexBuffer = VK_NULL_HANDLE;
+    VkBuffer chunkIndexBuffer = VK_NULL_HANDLE;
+    uint32_t chunkMaterialId = NO_MATERIAL_BOUND;
+
+    for (size_t i = first; i < first + count; ++i) {
+        const DeferredDraw& draw = deferredDraws_[i];
+
+        if (materialSystem_ && draw.materialId < materialSystem_->getMaterialCount() &&
+            draw.materialId != chunkMaterialId) {
+            VkDescriptorSet materialDescriptorSet = materialSystem_->getDescriptorSet(draw.materialId);
+            if (materialDescriptorSet != VK_NULL_HANDLE) {
+                uint32_t dynamicOffset = materialSystem_->getDynamicOffset(draw.materialId);
+                vkCmdBindDescriptorSets(secondary, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_,
+                                       1, 1, &materialDescriptorSet, 1, &dynamicOffset);
+                chunkMaterialId = draw.materialId;
+            }
+        }
+
+        PushConstants pushConstants{};
+        pushConstants.model = draw.modelMatrix;
+        vkCmdPushConstants(secondary, pipelineLayout_,
+                          VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                          0, sizeof(PushConstants), &pushConstants);
+
+        for (const auto& mesh : draw.model->meshes) {
+            if (mesh->vertexBufferHandle == VK_NULL_HANDLE || mesh->indexBufferHandle == VK_NULL_HANDLE) {
+                continue;
+            }
+            if (mesh->vertexBufferHandle != chunkVertexBuffer) {
+                VkDeviceSize offset = 0;
+                vkCmdBindVertexBuffers(secondary, 0, 1, &mesh->vertexBufferHandle, &offset);
+                chunkVertexBuffer = mesh->vertexBufferHandle;
+            }
+            if (mesh->indexBufferHandle != chunkIndexBuffer) {
+                vkCmdBindIndexBuffer(secondary, mesh->indexBufferHandle, 0, VK_INDEX_TYPE_UINT32);
+                chunkIndexBuffer = mesh->indexBufferHandle;
+            }
+            vkCmdDrawIndexed(secondary, static_cast<uint32_t>(mesh->indexCount()), 1,
+                            mesh->firstIndex, mesh->baseVertex, 0);
+        }
+    }
+
+    if (vkEndCommandBuffer(secondary) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to record secondary command buffer!");
+    }
+}
+
+void VulkanRenderer::flushDeferredDraws(std::vector<VkCommandBuffer>& executed) {
+    if (deferredDraws_.empty()) {
+        return;
+    }
+
+    // Small scenes skip the worker handoff entirely: one chunk recorded
+    // right here costs less than waking the pool
+    if (deferredDraws_.size() < PARALLEL_RECORDING_MIN_DRAWS || recordingWorkers_.size() < 2) {
+        RecordingWorker& worker = recordingWorkers_.front();
+        vkResetCommandPool(device_, worker.commandPools[currentFrameInFlight_], 0);
+        recordDrawChunk(worker.secondaries[currentFrameInFlight_], 0, deferredDraws_.size());
+        executed.push_back(worker.secondaries[currentFrameInFlight_]);
+        deferredDraws_.clear();
+        return;
+    }
+
+    size_t workerCount = recordingWorkers_.size();
+    {
+        std::lock_guard<std::mutex> lock(recordingMutex_);
+        recordingChunkSize_ = (deferredDraws_.size() + workerCount - 1) / workerCount;
+        recordingPendingJobs_ = static_cast<uint32_t>(workerCount);
+        ++recordingGeneration_;
+    }
+    recordingWorkCv_.notify_all();
+
+    {
+        std::unique_lock<std::mutex> lock(recordingMutex_);
+        recordingDoneCv_.wait(lock, [this] { return recordingPendingJobs_ == 0; });
+    }
+
+    for (size_t i = 0; i < workerCount; ++i) {
+        if (i * recordingChunkSize_ < deferredDraws_.size()) {
+            executed.push_back(recordingWorkers_[i].secondaries[currentFrameInFlight_]);
+        }
+    }
+    deferredDraws_.clear();
+}
+
+void VulkanRenderer::createBindlessTextureResources() {
+    VKMON_DEBUG("Creating bindless texture array...");
+
+    // One large partially-bound sampled image array; slots are written as
+    // textures load (update-after-bind) and unused slots are never touched
+    VkDescriptorSetLayoutBinding textureArrayBinding{};
+    textureArrayBinding.binding = 0;
+    textureArrayBinding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    textureArrayBinding.descriptorCount = MAX_BINDLESS_TEXTURES;
+    textureArrayBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+    VkDescriptorBindingFlags bindingFlags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+                                            VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{};
+    bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    bindingFlagsInfo.bindingCount = 1;
+    bindingFlagsInfo.pBindingFlags = &bindingFlags;
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.pNext = &bindingFlagsInfo;
+    layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &textureArrayBinding;
+
+    if (vkCreateDescriptorSetLayout(device_, &layoutInfo, nullptr, &bindlessTextureSetLayout_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create bindless texture set layout!");
+    }
+
+    VkDescriptorPoolSize poolSize{};
+    poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSize.descriptorCount = MAX_BINDLESS_TEXTURES;
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+    poolInfo.maxSets = 1;
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+
+    if (vkCreateDescriptorPool(device_, &poolInfo, nullptr, &bindlessTexturePool_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create bindless texture descriptor pool!");
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = bindlessTexturePool_;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &bindlessTextureSetLayout_;
+
+    if (vkAllocateDescriptorSets(device_, &allocInfo, &bindlessTextureSet_) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to allocate bindless texture descriptor set!");
+    }
+
+    VKMON_INFO("Bindless texture array created (" + std::to_string(MAX_BINDLESS_TEXTURES) + " slots)");
+}
+
+void VulkanRenderer::cleanupBindlessTextureResources() {
+    if (bindlessTexturePool_ != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(device_, bindlessTexturePool_, nullptr);
+        bindlessTexturePool_ = VK_NULL_HANDLE;
+        bindlessTextureSet_ = VK_NULL_HANDLE; // freed with its pool
+    }
+    if (bindlessTextureSetLayout_ != VK_NULL_HANDLE) {
+        vkDestroyDescriptorSetLayout(device_, bindlessTextureSetLayout_, nullptr);
+        bindlessTextureSetLayout_ = VK_NULL_HANDLE;
+    }
+    nextBindlessTextureIndex_ = 0;
+}
+
+uint32_t VulkanRenderer::registerBindlessTexture(VkImageView imageView, VkSampler sampler) {
+    if (bindlessTextureSet_ == VK_NULL_HANDLE || imageView == VK_NULL_HANDLE || sampler == VK_NULL_HANDLE) {
+        return 0;
+    }
+
+    if (nextBindlessTextureIndex_ >= MAX_BINDLESS_TEXTURES) {
+        VKMON_WARNING("Bindless texture array full (" + std::to_string(MAX_BINDLESS_TEXTURES) +
+                     " slots) - falling back to default texture");
+        return 0;
+    }
+
+    uint32_t slot = nextBindlessTextureIndex_++;
+
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    imageInfo.imageView = imageView;
+    imageInfo.sampler = sampler;
+
+    // Update-after-bind lets this land without waiting for in-flight
+    // frames; no draw references the slot before this call returns
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = bindlessTextureSet_;
+    write.dstBinding = 0;
+    write.dstArrayElement = slot;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    write.descriptorCount = 1;
+    write.pImageInfo = &imageInfo;
+
+    vkUpdateDescriptorSets(device_, 1, &write, 0, nullptr);
+
+    VKMON_DEBUG("Bindless texture registered in slot " + std::to_string(slot));
+    return slot;
+}
+
+void VulkanRenderer::updateBindlessTexture(uint32_t slot, VkImageView imageView, VkSampler sampler) {
+    if (bindlessTextureSet_ == VK_NULL_HANDLE || imageView == VK_NULL_HANDLE || sampler == VK_NULL_HANDLE) {
+        return;
+    }
+    if (slot == 0 || slot >= nextBindlessTextureIndex_) {
+        VKMON_WARNING("Refusing bindless update of slot " + std::to_string(slot) +
+                     " (allocated: " + std::to_string(nextBindlessTextureIndex_) + ")");
+        return;
+    }
+
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    imageInfo.imageView = imageView;
+    imageInfo.sampler = sampler;
+
+    // Same update-after-bind guarantee as registration; the caller keeps
+    // the old image alive until this write lands, so no frame ever
+    // samples a destroyed view
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = bindlessTextureSet_;
+    write.dstBinding = 0;
+    write.dstArrayElement = slot;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    write.descriptorCount = 1;
+    write.pImageInfo = &imageInfo;
+
+    vkUpdateDescriptorSets(device_, 1, &write, 0, nullptr);
+
+    VKMON_DEBUG("Bindless texture slot " + std::to_string(slot) + " updated in place");
+}
+
+void VulkanRenderer::invalidateModelCache(const std::string& meshPath) {
+    AssetID meshId = AssetID::intern(meshPath);
+    {
+        std::shared_lock<std::shared_mutex> lock(modelCacheMutex_);
+        if (modelCache_.find(meshId) == modelCache_.end()) {
+            VKMON_DEBUG("Model changed on disk but not cached, nothing to drop: " + meshPath);
+            return;
+        }
+    }
+
+    // In-flight frames may still draw from the old geometry; idle is the
+    // simple safe fence for a save-triggered development reload
+    vkDeviceWaitIdle(device_);
+    {
+        std::unique_lock<std::shared_mutex> lock(modelCacheMutex_);
+        modelCache_.erase(meshId);
+    }
+    VKMON_INFO("Model cache entry dropped for hot reload: " + meshPath);
+}
+
+void VulkanRenderer::beginCullPass() {
+    cullPassActive_ = false;
+    if (!gpuCullingEnabled_ || cullComputePipeline_ == VK_NULL_HANDLE) {
+        return;
+    }
+
+    // Planes come from the same view-projection the frame's UBO carries,
+    // so GPU cull results match what the raster pass would show
+    extractFrustumPlanes(cullViewProjMatrix_, cullFrustumPlanes_);
+
+    // Camera globals for the Hi-Z occlusion test; the enable flag only
+    // goes live once a pyramid build has actually been submitted
+    if (cullGlobalsMapped_) {
+        CullGlobals globals{};
+        globals.view = cullViewMatrix_;
+        globals.proj = cullProjMatrix_;
+        globals.pyramid = glm::vec4(static_cast<float>(hiZExtent_.width),
+                                    static_cast<float>(hiZExtent_.height),
+                                    static_cast<float>(hiZMipLevels_),
+                                    (occlusionCullingEnabled_ && hiZValid_) ? 1.0f : 0.0f);
+        memcpy(cullGlobalsMapped_, &globals, sizeof(globals));
+    }
+
+    vkResetCommandBuffer(cullCommandBuffer_, 0);
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    if (vkBeginCommandBuffer(cullCommandBuffer_, &beginInfo) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to begin recording cull command buffer!");
+    }
+
+    vkCmdBindPipeline(cullCommandBuffer_, VK_PIPELINE_BIND_POINT_COMPUTE, cullComputePipeline_);
+    vkCmdBindDescriptorSets(cullCommandBuffer_, VK_PIPELINE_BIND_POINT_COMPUTE, cullPipelineLayout_,
+                           0, 1, &cullDescriptorSets_[currentFrameInFlight_], 0, nullptr);
+
+    cullPassActive_ = true;
+}
+
+void VulkanRenderer::updateInstanceData(const std::vector<VulkanMon::InstanceData>& instances) {
+    // SAFETY FIX: Deprecated method - force single-batch mode only to prevent corruption
+    // WARNING: This method should not be used with multi-batch rendering systems
+    VKMON_WARNING("updateInstanceData() is deprecated - use clearInstanceBuffer() + updateInstanceDataDirect()");
+
+    if (instances.empty()) {
+        return;
+    }
+
+    // CRITICAL SAFETY: Force clean state to prevent any possibility of corruption
+    // This ensures we never mix single-batch and multi-batch rendering unsafely
+    clearInstanceBuffer();
+
+    // Use the robust, offset-aware implementation starting from clean state
+    updateInstanceDataDirect(instances.data(), static_cast<uint32_t>(instances.size()));
+
+    // Note: No offset restoration - this method now owns the entire buffer
+}
+
+VulkanRenderer::InstanceWriteResult VulkanRenderer::updateInstanceDataDirect(const InstanceData* instances, uint32_t instanceCount) {
+    // ENHANCED PROTECTION: Multiple validation layers with corruption detection
+    InstanceWriteResult result{};
+
+    // Layer 0: CRITICAL - Buffer state corruption detection
+    if (currentInstanceOffset_ > instanceCapacities_[currentFrameInFlight_]) {
+        VKMON_ERROR("CRITICAL: Buffer state corrupted - offset " + std::to_string(currentInstanceOffset_) +
+                   " > capacity " + std::to_string(instanceCapacities_[currentFrameInFlight_]));
+        VKMON_WARNING("Auto-recovering: Resetting buffer to safe state");
+        clearInstanceBuffer();
+    }
+
+    // Layer 1: Basic parameter validation
+    if (!instances) {
+        VKMON_ERROR("Instance buffer update failed: Null instance data pointer");
+        return result;
+    }
+
+    if (instanceCount == 0) {
+        return result; // Valid but no-op
+    }
+
+    // Layer 2: Buffer state validation
+    if (!instanceBuffersMapped_[currentFrameInFlight_].isValid()) {
+        VKMON_ERROR("Instance buffer update failed: Buffer not mapped");
+        return result;
+    }
+
+    // Layer 3: Runaway guard - an absolute ceiling, not a capacity.
+    // Capacity pressure below it is handled by chained overflow blocks
+    if (totalInstancesThisFrame_ + instanceCount > INSTANCE_HARD_CAP) {
+        uint32_t remainingFrameSpace = INSTANCE_HARD_CAP - totalInstancesThisFrame_;
+
+        if (remainingFrameSpace == 0) {
+            VKMON_WARNING("Instance hard cap reached - skipping batch of " + std::to_string(instanceCount) + " instances");
+            return result; // Graceful degradation: skip this batch
+        }
+
+        VKMON_WARNING("Instance hard cap overflow - rendering partial batch: " +
+                     std::to_string(remainingFrameSpace) + "/" + std::to_string(instanceCount) + " instances");
+        instanceCount = remainingFrameSpace;
+    }
+
+    // Place the batch: the primary buffer while it has room, otherwise a
+    // chained overflow block. Either way the whole batch is contiguous in
+    // exactly one buffer so the draw can bind it directly
+    char* destination = nullptr;
+    if (currentInstanceOffset_ + instanceCount <= instanceCapacities_[currentFrameInFlight_]) {
+        destination = static_cast<char*>(instanceBuffersMapped_[currentFrameInFlight_].get()) +
+                      currentInstanceOffset_ * sizeof(VulkanMon::InstanceData);
+        result.buffer = instanceBuffers_[currentFrameInFlight_];
+        result.firstInstance = currentInstanceOffset_;
+        result.inPrimaryBuffer = true;
+        currentInstanceOffset_ += instanceCount;
+    } else {
+        InstanceOverflowBlock* block = acquireInstanceOverflowBlock(instanceCount);
+        if (!block) {
+            VKMON_WARNING("Instance buffer full - skipping batch of " + std::to_string(instanceCount) + " instances");
+            return result; // Graceful degradation: skip this batch
+        }
+        destination = static_cast<char*>(block->mapped.get()) +
+                      block->used * sizeof(VulkanMon::InstanceData);
+        result.buffer = block->buffer;
+        result.firstInstance = block->used;
+        block->used += instanceCount;
+    }
+
+    size_t dataSize = instanceCount * sizeof(VulkanMon::InstanceData);
+    memcpy(destination, instances, dataSize);
+    result.written = instanceCount;
+
+    // Update frame tracking (after successful write); the high-water mark
+    // sizes the coalesced primary allocation at the next safe point
+    totalInstancesThisFrame_ += instanceCount;
+    instanceDemandHighWater_ = std::max(instanceDemandHighWater_, totalInstancesThisFrame_);
+    frameRenderStats_.bufferUploadBytes += dataSize;
+
+    #ifdef DEBUG_VERBOSE
+    VKMON_DEBUG("Instance buffer: Added " + std::to_string(instanceCount) +
+               " instances at offset " + std::to_string(result.firstInstance) +
+               (result.inPrimaryBuffer ? "" : " (overflow block)") +
+               " (frame total: " + std::to_string(totalInstancesThisFrame_) + ")");
+    #endif
+
+    // No need to flush due to HOST_COHERENT_BIT
+    return result;
+}
+
+void VulkanRenderer::clearInstanceBuffer() {
+    // Reset frame state for clean multi-batch rendering
+    currentInstanceOffset_ = 0;
+    totalInstancesThisFrame_ = 0;
+    currentIndirectDrawCount_ = 0;
+    for (auto& block : instanceOverflowBlocks_[currentFrameInFlight_]) {
+        block.used = 0;
+    }
+
+    // Optional: Zero buffer memory for debugging (expensive, only in debug builds)
+    #ifdef DEBUG_CLEAR_INSTANCE_BUFFER
+    if (instanceBuffersMapped_[currentFrameInFlight_].isValid()) {
+        memset(instanceBuffersMapped_[currentFrameInFlight_].get(), 0,
+               instanceCapacities_[currentFrameInFlight_] * sizeof(VulkanMon::InstanceData));
+    }
+    #endif
+}
+
+void VulkanRenderer::cleanupInstanceBuffer() {
+    // MappedBuffer RAII wrappers handle automatic unmapping
+
+    for (uint32_t frame = 0; frame < MAX_FRAMES_IN_FLIGHT; ++frame) {
+        destroyInstanceOverflowBlocks(frame);
+        if (instanceBuffers_[frame] != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device_, instanceBuffers_[frame], nullptr);
+            instanceBuffers_[frame] = VK_NULL_HANDLE;
+        }
+        if (instanceBufferMemories_[frame] != VK_NULL_HANDLE) {
+            vkFreeMemory(device_, instanceBufferMemories_[frame], nullptr);
+            instanceBufferMemories_[frame] = VK_NULL_HANDLE;
+        }
+    }
+
+    for (auto& baked : bakedInstanceBuffers_) {
+        if (baked.buffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device_, baked.buffer, nullptr);
+            vkFreeMemory(device_, baked.memory, nullptr);
+        }
+    }
+    bakedInstanceBuffers_.clear();
+
+    VKMON_INFO("GPU instance buffer cleanup complete");
+}
+
+std::vector<VkVertexInputBindingDescription> VulkanRenderer::getInstancedBindingDescriptions() {
+    std::vector<VkVertexInputBindingDescription> bindings(2);
+
+    // Binding 0: Per-vertex data (same as before)
+    bindings[0].binding = 0;
+    bindings[0].stride = sizeof(ModelVertex);
+    bindings[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+
+    // Binding 1: Per-instance data (NEW for GPU instancing)
+    bindings[1].binding = 1;
+    bindings[1].stride = sizeof(VulkanMon::InstanceData);
+    bindings[1].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+    return bindings;
+}
+
+std::vector<VkVertexInputAttributeDescription> VulkanRenderer::getInstancedAttributeDescriptions() {
+    std::vector<VkVertexInputAttributeDescription> attributes(7);
+
+    // Per-vertex attributes (locations 0-3) - unchanged
+    attributes[0] = {0, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(ModelVertex, position)};
+    attributes[1] = {1, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(ModelVertex, normal)};
+    attributes[2] = {2, 0, VK_FORMAT_R32G32_SFLOAT, offsetof(ModelVertex, texCoords)};
+    attributes[3] = {3, 0, VK_FORMAT_R32G32B32_SFLOAT, offsetof(ModelVertex, color)};
 
-    // Reserve locations 10-11 for future expansion
-    attributes[10] = {10, 1, VK_FORMAT_R32G32B32A32_SFLOAT, 0}; // Unused
-    attributes[11] = {11, 1, VK_FORMAT_R32G32B32A32_SFLOAT, 0}; // Unused
+    // Per-instance attributes (locations 4-6) - compressed transform,
+    // decoded back into a world transform in instanced.vert
+    attributes[4] = {4, 1, VK_FORMAT_R32G32B32A32_SFLOAT, static_cast<uint32_t>(offsetof(VulkanMon::InstanceData, positionScale))};
+    attributes[5] = {5, 1, VK_FORMAT_R32G32B32A32_SFLOAT, static_cast<uint32_t>(offsetof(VulkanMon::InstanceData, rotation))};
+    attributes[6] = {6, 1, VK_FORMAT_R32G32B32A32_SFLOAT, static_cast<uint32_t>(offsetof(VulkanMon::InstanceData, materialParams))};
 
-    // Return only the first 10 attributes (0-9) for now
-    attributes.resize(10);
     return attributes;
 }
 
@@ -4,24 +4,37 @@
 #include <GLFW/glfw3.h>
 #include <vulkan/vulkan.h>
 
+#include "../core/AssetID.h"
 #include "../core/Window.h"
 // Old Camera.h dependency removed - using unified ECS camera system
 #include "ResourceManager.h"
+#include "TransferManager.h"
 #include "MappedBuffer.h"
+#include "FrameGraph.h"
+#include "DescriptorAllocator.h"
+#include "ShaderSpecialization.h"
 #include "../io/AssetManager.h"
 #include "../io/ModelLoader.h"
 #include "../systems/LightingSystem.h"
 #include "../systems/MaterialSystem.h"
 #include "../utils/Logger.h"
+#include "../utils/Task.h"
 
+#include <array>
 #include <memory>
 #include <vector>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
 
 // ImGui includes
 #include <imgui.h>
@@ -33,28 +46,53 @@ struct UniformBufferObject {
     glm::mat4 view;
     glm::mat4 proj;
     glm::vec3 cameraPos;
-    float _padding;
+    float time;  // seconds since renderer start - drives shader-side animation (grass wind)
 };
 
 struct PushConstants {
     glm::mat4 model;
+    uint32_t textureIndex;  // slot in the bindless texture array (0 = default)
+    uint32_t _padding[3];   // keep 16-byte alignment for the push range
 };
 
 // Forward declaration for instanced rendering (Phase 7.1)
 namespace VulkanMon {
     // GPU instance data structure - matches shader layout
+    //
+    // Compressed transform: creatures are rigid bodies with uniform
+    // scale, so instead of a 64-byte model matrix each instance carries
+    // position + uniform scale + unit quaternion and the instanced
+    // vertex shader decodes them, halving instance buffer size and
+    // per-frame upload bandwidth.
     struct InstanceData {
-        glm::mat4 modelMatrix;     // 64 bytes - transformation matrix
-        glm::vec4 materialParams;  // 16 bytes - material ID + custom params
-        glm::vec4 lodParams;       // 16 bytes - LOD level + distance + custom
+        glm::vec4 positionScale;   // 16 bytes - xyz: world position, w: uniform scale
+        glm::vec4 rotation;        // 16 bytes - unit quaternion (x, y, z, w)
+        glm::vec4 materialParams;  // 16 bytes - x: material ID, y: bindless texture slot,
+                                   //            z: LOD level, w: camera distance
 
         InstanceData() = default;
-        InstanceData(const glm::mat4& model, uint32_t materialId, float lodLevel = 0.0f)
-            : modelMatrix(model)
-            , materialParams(static_cast<float>(materialId), 0.0f, 0.0f, 0.0f)
-            , lodParams(lodLevel, 0.0f, 0.0f, 0.0f) {}
+        InstanceData(const glm::vec3& position, const glm::quat& rot, float scale,
+                     uint32_t materialId, float lodLevel = 0.0f)
+            : positionScale(position, scale)
+            , rotation(rot.x, rot.y, rot.z, rot.w)
+            , materialParams(static_cast<float>(materialId), 0.0f, lodLevel, 0.0f) {}
+    };
+    static_assert(sizeof(InstanceData) == 48, "InstanceData must be 48 bytes for GPU alignment");
+
+    // One staged particle burst; packed into the GPU emit request ring by
+    // beginParticlePass and expanded into individual particles on compute
+    struct ParticleEmitParams {
+        glm::vec3 origin{0.0f};
+        glm::vec3 direction{0.0f, 1.0f, 0.0f};  // cone axis, normalized by the renderer
+        float baseSpeed = 1.0f;      // m/s, jittered +/-25% per particle on the GPU
+        float spread = 0.25f;        // 0 = beam, 1 = full sphere
+        float lifetimeSeconds = 2.0f;
+        float size = 0.1f;           // uniform scale of the particle mesh
+        float gravityScale = 0.0f;   // 0 = floating spores, 1 = ballistic debris
+        float drag = 0.0f;           // per-second velocity damping
+        uint32_t materialId = 0;
+        uint32_t count = 1;
     };
-    static_assert(sizeof(InstanceData) == 96, "InstanceData must be 96 bytes for GPU alignment");
 }
 
 /**
@@ -144,10 +182,15 @@ public:
      */
     
     /**
-     * Reload shaders from disk
-     * Useful for development and hot-reloading
-     * 
-     * @throws std::runtime_error if shader compilation fails
+     * Reload shaders from disk on a background thread
+     *
+     * GLSL compilation and pipeline construction run on a worker thread
+     * while the old pipeline keeps rendering; the replacement is swapped
+     * in between frames once ready. A failed compile logs the error and
+     * leaves the previous pipeline untouched. Calls while a reload is
+     * already in flight are ignored.
+     *
+     * @throws std::runtime_error if the renderer is not initialized
      */
     void reloadShaders();
     
@@ -231,6 +274,27 @@ public:
      */
     float getFrameTime() const { return lastFrameTime_; }
 
+    /**
+     * Per-pass GPU timings measured with VkQueryPool timestamps
+     *
+     * valid stays false until the first completed frame of results lands,
+     * or permanently when the device cannot timestamp graphics queues.
+     */
+    struct GpuPassTimings {
+        float mainPassMs = 0.0f;       // per-object ECS draws (clears through first instanced batch)
+        float instancedPassMs = 0.0f;  // instanced creature batches
+        float imguiPassMs = 0.0f;      // debug interface draw data
+        float totalMs = 0.0f;          // whole submitted frame on the GPU
+        bool valid = false;
+    };
+
+    /**
+     * Get GPU timings for the most recently completed frame
+     *
+     * @return Per-pass GPU durations in milliseconds
+     */
+    const GpuPassTimings& getGpuPassTimings() const { return gpuPassTimings_; }
+
 
     // ===== SYSTEM ACCESS INTERFACE =====
 
@@ -248,6 +312,14 @@ public:
      */
     std::shared_ptr<MaterialSystem> getMaterialSystem() const { return materialSystem_; }
 
+    /**
+     * Get the pooled descriptor allocator
+     *
+     * Runtime descriptor needs (new materials, Inspector-created
+     * variants) should allocate here instead of creating ad-hoc pools
+     */
+    DescriptorAllocator* getDescriptorAllocator() const { return descriptorAllocator_.get(); }
+
     /**
      * Get the initialized asset manager
      *
@@ -268,9 +340,17 @@ public:
      * Render a single ECS entity
      *
      * @param modelMatrix Transform matrix for this object
-     * @param meshPath Path to mesh file (will be loaded if needed)
+     * @param meshId Interned mesh handle (loaded if needed)
      * @param materialId Material ID to use
      */
+    void renderECSObject(const glm::mat4& modelMatrix,
+                        AssetID meshId,
+                        uint32_t materialId);
+
+    /**
+     * String-path convenience - interns and forwards. Hot callers
+     * (RenderSystem) pass the component's cached AssetID instead
+     */
     void renderECSObject(const glm::mat4& modelMatrix,
                         const std::string& meshPath,
                         uint32_t materialId);
@@ -291,6 +371,268 @@ public:
     uint32_t getCurrentInstanceOffset() const { return currentInstanceOffset_; }
     void clearInstanceBuffer();  // Clear buffer and reset state for new frame
 
+    /**
+     * GPU compute culling: when enabled, instanced batches are frustum
+     * tested and compacted by a compute pass that writes survivor counts
+     * straight into the indirect command table, removing the CPU
+     * cull-and-copy from the frame loop. Disabled by default until the
+     * calling system opts in.
+     */
+    void setGpuCullingEnabled(bool enabled);
+    bool isGpuCullingEnabled() const { return gpuCullingEnabled_; }
+
+    /**
+     * Hi-Z occlusion culling on top of GPU frustum culling
+     *
+     * When enabled, each frame max-reduces its depth buffer into a mip
+     * pyramid, and the next frame's cull pass rejects instances whose
+     * bounding sphere is fully behind that depth. One frame of camera
+     * latency, always conservative: disoccluded creatures appear a frame
+     * late at worst. Requires GPU culling; off by default.
+     */
+    void setOcclusionCullingEnabled(bool enabled);
+    bool isOcclusionCullingEnabled() const { return occlusionCullingEnabled_; }
+
+    /**
+     * GPU particle subsystem: the particle pool lives entirely in device
+     * memory and is simulated by a compute pass on the async compute
+     * queue. The CPU stages small emit requests per frame; survivors are
+     * compacted straight into an instance buffer and drawn indirect
+     * through the instanced pipeline, so particle counts never round-trip
+     * to the CPU. Disabled by default until the calling system opts in.
+     */
+    void setGpuParticlesEnabled(bool enabled);
+    bool isGpuParticlesEnabled() const { return gpuParticlesEnabled_; }
+
+    /**
+     * Stage a burst of particles for the next emit dispatch
+     *
+     * Bursts are packed into the emit ring at the start of the next
+     * beginECSFrame, so requests staged during system update() land in
+     * the frame being built and requests staged mid-render land in the
+     * following one.
+     *
+     * Pool slots are ring-allocated: once the pool wraps, the oldest
+     * particles are overwritten. Requests beyond the per-frame ring
+     * capacity are dropped with a warning.
+     */
+    void emitParticles(const VulkanMon::ParticleEmitParams& params);
+
+    /**
+     * Draw the live particle pool as an instanced batch of the given mesh
+     *
+     * Must be called between beginECSFrame/endECSFrame. The instance data
+     * and draw count come from this frame's compute pass; only the mesh's
+     * first submesh is drawn.
+     */
+    void renderGpuParticles(const std::string& meshPath, uint32_t baseMaterialId = 0);
+
+    /**
+     * Enable or disable the depth-only pre-pass
+     *
+     * When enabled, opaque geometry is rasterized depth-only before the
+     * shaded pass, which then loads that depth and shades each pixel at
+     * most once. Worth its vertex cost in overdraw-heavy scenes (dense
+     * grass, stacked creatures); off by default.
+     *
+     * @param enabled true to run the pre-pass each frame
+     */
+    void setDepthPrePassEnabled(bool enabled);
+    bool isDepthPrePassEnabled() const { return depthPrePassEnabled_; }
+
+    /**
+     * Enable or disable multi-threaded command recording
+     *
+     * When enabled, per-object draws are deferred during the frame and
+     * recorded into secondary command buffers by a small worker pool at
+     * submit time; the render pass then runs them via
+     * vkCmdExecuteCommands. Instanced batches and ImGui record serially
+     * into a trailing secondary since their per-frame command counts are
+     * already tiny. Worth enabling once scenes exceed a few hundred
+     * non-instanced draws; off by default.
+     *
+     * @param enabled true to record draw chunks on worker threads
+     */
+    void setParallelCommandRecordingEnabled(bool enabled);
+    bool isParallelCommandRecordingEnabled() const { return parallelRecordingEnabled_; }
+
+    /**
+     * Swapchain present mode selection
+     *
+     * Immediate presents without waiting for vblank (tears, lowest
+     * latency, uncapped throughput for benchmarking), Mailbox queues the
+     * newest frame and drops stale ones (no tearing, low latency), Fifo
+     * is classic v-sync and the only mode Vulkan guarantees everywhere.
+     */
+    enum class PresentModeSetting {
+        Immediate,
+        Mailbox,
+        Fifo
+    };
+
+    /**
+     * Select the swapchain present mode at runtime
+     *
+     * Falls back to Fifo when the surface does not support the requested
+     * mode. Recreates the swapchain when the effective mode changes, so
+     * avoid calling mid-frame.
+     *
+     * @param mode Requested present mode
+     */
+    void setPresentMode(PresentModeSetting mode);
+    PresentModeSetting getPresentMode() const { return presentModeSetting_; }
+
+    /**
+     * Cap the frame rate independently of the present mode
+     *
+     * The limiter sleeps most of the remaining frame budget, then spins
+     * the final stretch for precise pacing - intended for capture rigs
+     * and fixed-rate recording where Immediate presentation would
+     * otherwise run uncapped. Zero disables the cap (the default).
+     *
+     * @param fps Target frames per second, 0 for uncapped
+     */
+    void setFrameRateLimit(float fps);
+    float getFrameRateLimit() const { return frameRateLimit_; }
+
+    /**
+     * CPU-side presentation timing for the most recent frame
+     *
+     * presentWaitMs measures time blocked inside vkQueuePresentKHR (the
+     * visible cost of Fifo back-pressure), limiterWaitMs the time the
+     * frame limiter spent sleeping and spinning.
+     */
+    struct PresentStats {
+        float presentWaitMs = 0.0f;
+        float limiterWaitMs = 0.0f;
+    };
+
+    /**
+     * Get presentation timing for the most recently presented frame
+     *
+     * @return CPU present and frame limiter wait durations in milliseconds
+     */
+    const PresentStats& getPresentStats() const { return presentStats_; }
+
+    /**
+     * A completed frame capture, handed to the capture consumer
+     *
+     * pixels points directly at the persistently mapped readback buffer
+     * (zero-copy) and is only valid for the duration of the callback -
+     * the slot goes back into the ring when the callback returns. Data
+     * is tightly packed rows in the swapchain format (typically BGRA8).
+     */
+    struct CapturedFrame {
+        const uint8_t* pixels = nullptr;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        VkFormat format = VK_FORMAT_UNDEFINED;
+        uint64_t frameNumber = 0;   // Monotonic capture-submit counter
+    };
+
+    using FrameCaptureCallback = std::function<void(const CapturedFrame&)>;
+
+    /**
+     * Begin continuous asynchronous frame capture
+     *
+     * Every presented frame is copied from the swapchain image into a
+     * host-visible readback ring on the GPU timeline - the copy rides
+     * between the render submit and present, so the main loop never
+     * waits on it. A dedicated consumer thread waits on each slot's
+     * fence and invokes the callback a few frames behind the renderer
+     * (ring depth frames of latency, zero main-loop stalls).
+     *
+     * If the consumer falls behind and the ring fills, frames are
+     * dropped rather than stalling the frame loop; see
+     * getCaptureDroppedFrames(). Capture stops automatically on
+     * swapchain recreation (the readback buffers are sized to the
+     * current extent).
+     *
+     * @param consumer Invoked on the capture thread per completed frame
+     * @return false if capture is already active or resources failed
+     */
+    bool startFrameCapture(FrameCaptureCallback consumer);
+
+    /**
+     * Stop frame capture, drain in-flight readbacks, and join the
+     * consumer thread. Safe to call when capture is not active.
+     */
+    void stopFrameCapture();
+
+    bool isFrameCaptureActive() const { return captureActive_; }
+
+    /// Frames skipped because every readback slot was still in flight
+    uint64_t getCaptureDroppedFrames() const { return captureDroppedFrames_; }
+
+    /**
+     * Per-frame draw submission statistics
+     *
+     * Tallied as renderECSObject / renderInstanced record commands and
+     * published at endECSFrame - the numbers every batching change needs
+     * to prove itself without a frame capture. Counts cover the shaded
+     * pass only; depth pre-pass mirror draws are excluded so the totals
+     * track logical scene submissions, not pass plumbing.
+     */
+    struct FrameRenderStats {
+        uint32_t drawCalls = 0;           // vkCmdDrawIndexed(+Indirect) recorded
+        uint32_t instancesSubmitted = 0;  // Sum of instance counts across draws
+        uint64_t trianglesSubmitted = 0;  // indexCount / 3, scaled by instances
+        uint64_t bufferUploadBytes = 0;   // Uniform, material, and instance uploads
+        uint32_t descriptorBinds = 0;     // vkCmdBindDescriptorSets recorded
+        uint32_t pipelineBinds = 0;       // vkCmdBindPipeline recorded
+
+        void reset() { *this = FrameRenderStats{}; }
+    };
+
+    /**
+     * Get draw statistics for the most recently completed ECS frame
+     *
+     * @return Counts published at the last endECSFrame
+     */
+    const FrameRenderStats& getFrameRenderStats() const { return lastFrameRenderStats_; }
+
+    /**
+     * Register a texture in the global bindless array
+     *
+     * Writes the image into the next free slot of the descriptor-indexed
+     * texture array and returns that slot. Draws reference the slot via
+     * push constant (per-object path) or instance data (instanced path),
+     * so switching textures never rebinds a descriptor set.
+     *
+     * @param imageView View of the loaded texture image
+     * @param sampler Sampler to pair with the image
+     * @return Array slot for per-draw indexing, 0 (default texture) when full
+     */
+    uint32_t registerBindlessTexture(VkImageView imageView, VkSampler sampler);
+
+    /**
+     * Overwrite an existing bindless array slot with a new texture
+     *
+     * Hot reload path: AssetManager re-decodes a changed texture and
+     * lands it in the slot the old version occupied, so every material
+     * and instance that recorded the index keeps working. Slot 0 (the
+     * default texture) and unallocated slots are refused.
+     *
+     * @param slot Previously assigned slot from registerBindlessTexture
+     * @param imageView View of the replacement texture image
+     * @param sampler Sampler to pair with the image
+     */
+    void updateBindlessTexture(uint32_t slot, VkImageView imageView, VkSampler sampler);
+
+    /**
+     * Drop a cached model so the next frame reloads it from disk
+     *
+     * Hot reload path for changed model files. Waits for the device to
+     * idle before erasing the cache entry, since in-flight frames may
+     * still reference the pooled geometry - acceptable for a development
+     * feature that fires on artist saves. The old mesh's slice of the
+     * pooled vertex/index buffers is not reclaimed (the pools have no
+     * free list); repeated reloads grow the pools until restart.
+     *
+     * @param meshPath Model path relative to assets/models/
+     */
+    void invalidateModelCache(const std::string& meshPath);
+
     /**
      * Render multiple instances of the same mesh with different transforms
      * This is the high-performance path for rendering hundreds of identical objects
@@ -309,10 +651,80 @@ public:
      * Convenience method for rendering instanced creatures using InstanceData struct
      * This is the preferred method for CreatureRenderSystem
      */
+    void renderInstancedCreatures(AssetID meshId,
+                                 const std::vector<VulkanMon::InstanceData>& instances,
+                                 uint32_t baseMaterialId);
+
+    /// String-path convenience - interns and forwards
     void renderInstancedCreatures(const std::string& meshPath,
                                  const std::vector<VulkanMon::InstanceData>& instances,
                                  uint32_t baseMaterialId);
 
+    /**
+     * Render instanced vegetation through the grass pipeline variant
+     *
+     * Same vertex layout and batching as renderInstancedCreatures, but the
+     * grass vertex shader animates wind sway from the frame time uniform and
+     * reads materialParams.z as per-instance wind strength instead of LOD.
+     * Grass skips the depth pre-pass: the pre-pass shader has no wind
+     * displacement, so its depth would mismatch the swaying geometry.
+     */
+    void renderInstancedGrass(const std::string& meshPath,
+                             const std::vector<VulkanMon::InstanceData>& instances,
+                             uint32_t baseMaterialId);
+
+    // ===== BAKED INSTANCE BUFFERS =====
+    // Static instance data (procedural grass placement) uploaded once into
+    // a device-local buffer at load; per-frame draws reference ranges of it
+    // without any CPU re-upload
+
+    /// Sentinel returned by bakeInstanceBuffer when the upload cannot happen
+    static constexpr uint32_t INVALID_BAKED_BUFFER = UINT32_MAX;
+
+    /**
+     * Upload static instance data into a device-local buffer
+     *
+     * The data is staged through TransferManager once and never touched by
+     * the CPU again; draws reference it via renderGrassFromBakedBuffer with
+     * a firstInstance/instanceCount range. Intended for load-time baking of
+     * procedural placement (grass blades), not per-frame data.
+     *
+     * @param instances Instance data to bake (copied to the GPU, not retained)
+     * @param debugName Label for upload logging
+     * @return Handle for draw calls, or INVALID_BAKED_BUFFER on failure
+     */
+    uint32_t bakeInstanceBuffer(const std::vector<VulkanMon::InstanceData>& instances,
+                               const std::string& debugName);
+
+    /**
+     * Destroy a baked instance buffer
+     *
+     * Waits for the device to go idle first - rebaking is a rare load-time
+     * or editor event, never a per-frame operation.
+     */
+    void destroyBakedInstanceBuffer(uint32_t handle);
+
+    /**
+     * Draw a range of a baked instance buffer through the grass pipeline
+     *
+     * No instance upload happens - the vertex stream binds the device-local
+     * baked buffer directly and the range selects which patches draw.
+     * Culling is the caller's per-patch visibility bitset, so this path
+     * skips the GPU cull pass and the indirect command table.
+     */
+    void renderGrassFromBakedBuffer(const std::string& meshPath,
+                                   uint32_t bakedBufferHandle,
+                                   uint32_t firstInstance,
+                                   uint32_t instanceCount,
+                                   uint32_t baseMaterialId);
+
+    /**
+     * Clamp a desired LOD level to the deepest _lod<N> variant file that
+     * exists for this mesh (see ModelLoader::lodVariantPath)
+     * Returns 0 (base mesh) when no ModelLoader is attached
+     */
+    uint32_t resolveCreatureLod(const std::string& meshPath, uint32_t desiredLod);
+
     // ===== ASSET PRELOADING INTERFACE =====
 
     /**
@@ -325,6 +737,31 @@ public:
      */
     bool preloadModel(const std::string& meshPath);
 
+    /**
+     * Warm the model cache from a per-scene preload manifest
+     * Fans the expensive Assimp parse/cook stage across JobSystem workers,
+     * then uploads every model on this thread via the cooked fast path.
+     * Marks warmup complete: any lazy ensureMeshLoaded afterwards is a
+     * frame hitch and logs a warning naming the missing manifest entry.
+     *
+     * @param manifest Unique mesh paths the scene will render
+     * @return Number of models now resident in the cache
+     */
+    size_t preloadModels(const std::vector<std::string>& manifest);
+
+    /**
+     * Coroutine variant of preloadModels for overlapped scene loading
+     * Hops to a Low-priority worker for the cook fan-out, then back to
+     * the main thread (MainThreadTaskQueue pump) for the GPU upload
+     * phase, so the caller's frame loop keeps running while models cook.
+     * Same warmup-complete semantics as the synchronous version.
+     *
+     * @param manifest Unique mesh paths the scene will render (by value:
+     *                 the coroutine outlives the caller's frame)
+     * @return Task yielding the number of models resident in the cache
+     */
+    Task<size_t> preloadModelsAsync(std::vector<std::string> manifest);
+
     /**
      * Perform GPU warm-up render to eliminate first-frame delay
      * Submits a dummy render pass to trigger GPU driver optimizations
@@ -376,18 +813,30 @@ private:
     std::shared_ptr<Window> window_;
     // Old camera_ member removed - using external matrices from ECS camera system
     std::shared_ptr<ResourceManager> resourceManager_;
+    std::shared_ptr<TransferManager> transferManager_;
     std::shared_ptr<AssetManager> assetManager_;
     std::shared_ptr<ModelLoader> modelLoader_;
     std::shared_ptr<LightingSystem> lightingSystem_;
     std::shared_ptr<MaterialSystem> materialSystem_;
-    
+
+    // Pooled descriptor allocation: chunked persistent pools, per-frame
+    // transient pools reset in bulk, and a (layout, bindings) set cache
+    std::unique_ptr<DescriptorAllocator> descriptorAllocator_;
+
+
     // Current model being rendered (legacy)
     std::shared_ptr<Model> currentModel_;
 
     // Model cache for multi-object ECS rendering
-    std::unordered_map<std::string, std::shared_ptr<Model>> modelCache_;
+    // Keyed by interned handle so per-draw lookups hash a uint32 instead
+    // of the path string
+    std::unordered_map<AssetID, std::shared_ptr<Model>> modelCache_;
     mutable std::shared_mutex modelCacheMutex_;  // Protects modelCache_
 
+    // Set by preloadModels once the scene manifest is resident; lazy
+    // loads after this point are frame hitches and get flagged
+    bool sceneWarmupComplete_ = false;
+
     // =========================================================================
     // UNIFIED CAMERA INTERFACE - External matrix storage
     // =========================================================================
@@ -408,8 +857,10 @@ private:
     FrameUpdateCallback frameUpdateCallback_;
     ECSRenderCallback ecsRenderCallback_;
     
-    // Material state
+    // Material state: staged CPU-side, flushed to the GPU buffer once per
+    // frame only when dirty instead of re-uploaded unconditionally
     MaterialData currentMaterialData_;
+    bool materialDataDirty_ = false;
     
     // Initialization state
     bool initialized_ = false;
@@ -420,6 +871,19 @@ private:
     VkPhysicalDevice physicalDevice_ = VK_NULL_HANDLE;
     VkDevice device_ = VK_NULL_HANDLE;
     VkQueue graphicsQueue_ = VK_NULL_HANDLE;
+    uint32_t graphicsQueueFamily_ = 0;
+
+    // Async upload queue - the graphics queue/family when the device has
+    // no dedicated transfer family
+    VkQueue transferQueue_ = VK_NULL_HANDLE;
+    uint32_t transferQueueFamily_ = 0;
+
+    // Async compute queue - compute workloads (GPU culling, future
+    // particle sims) overlap fragment-heavy graphics work when the device
+    // exposes a compute-only family; falls back to the graphics queue
+    VkQueue computeQueue_ = VK_NULL_HANDLE;
+    uint32_t computeQueueFamily_ = 0;
+    bool asyncComputeAvailable_ = false;
     
     // Swapchain and presentation
     VkSwapchainKHR swapChain_ = VK_NULL_HANDLE;
@@ -428,6 +892,17 @@ private:
     VkExtent2D swapChainExtent_;
     std::vector<VkImageView> swapChainImageViews_;
     std::vector<VkFramebuffer> swapChainFramebuffers_;
+
+    // Swapchains replaced during resize: passed as oldSwapchain to
+    // vkCreateSwapchainKHR so presentation continues, then destroyed
+    // once the render timeline passes the stamped value (the present
+    // engine has switched to the replacement by then). Avoids the
+    // vkDeviceWaitIdle freeze during window drags.
+    struct RetiredSwapchain {
+        VkSwapchainKHR swapchain = VK_NULL_HANDLE;
+        uint64_t retireAfter = 0;  // render timeline value that must complete first
+    };
+    std::vector<RetiredSwapchain> retiredSwapchains_;
     
     // Graphics pipeline
     VkRenderPass renderPass_ = VK_NULL_HANDLE;
@@ -436,19 +911,122 @@ private:
     VkPipelineLayout pipelineLayout_ = VK_NULL_HANDLE;
     VkPipeline graphicsPipeline_ = VK_NULL_HANDLE;
 
+    // Specialized variants of the main pipeline keyed on
+    // ShaderFeatures::cacheKey(); built lazily, dropped on shader reload
+    std::unordered_map<uint32_t, VkPipeline> pipelineVariants_;
+
+    // Async shader reload: the worker thread compiles GLSL and builds
+    // the replacement pipeline while the old one keeps rendering;
+    // swapPendingPipeline() installs the result between frames
+    std::thread shaderReloadThread_;
+    std::atomic<bool> shaderReloadInFlight_{false};
+    std::atomic<bool> pendingPipelineReady_{false};
+    std::mutex pendingPipelineMutex_;
+    VkShaderModule pendingVertShaderModule_ = VK_NULL_HANDLE;
+    VkShaderModule pendingFragShaderModule_ = VK_NULL_HANDLE;
+    VkPipeline pendingGraphicsPipeline_ = VK_NULL_HANDLE;
+
+    // Pipeline cache persisted to disk so repeated launches and R-key
+    // shader reloads skip driver pipeline compilation
+    VkPipelineCache pipelineCache_ = VK_NULL_HANDLE;
+    std::string pipelineCacheFilePath_;
+
+    // GPU timestamp profiling - four markers per frame bracket the main,
+    // instanced, and ImGui passes; results are read back one frame later
+    static constexpr uint32_t TIMESTAMP_QUERY_COUNT = 4;  // frame start, instanced start, imgui start, frame end
+    VkQueryPool timestampQueryPool_ = VK_NULL_HANDLE;
+    float timestampPeriodNs_ = 0.0f;       // nanoseconds per timestamp tick
+    bool gpuTimingSupported_ = false;
+    bool timestampsIssued_ = false;        // previous frame wrote queries worth reading
+    bool instancedMarkerWritten_ = false;  // first renderInstanced() of the frame writes query 1
+    GpuPassTimings gpuPassTimings_;
+
+    // Bind tracking for pooled mesh geometry - meshes suballocated from the
+    // shared pools share buffer handles, so redundant binds are skipped
+    VkBuffer boundVertexBuffer_ = VK_NULL_HANDLE;
+    VkBuffer boundIndexBuffer_ = VK_NULL_HANDLE;
+
+    // Material bind tracking - RenderSystem sorts draws by material, so
+    // consecutive same-material objects skip the set 1 rebind entirely
+    static constexpr uint32_t NO_MATERIAL_BOUND = UINT32_MAX;
+    uint32_t boundMaterialId_ = NO_MATERIAL_BOUND;
+
     // Instanced graphics pipeline (Phase 7.1)
     VkShaderModule instancedVertShaderModule_ = VK_NULL_HANDLE;
     VkShaderModule instancedFragShaderModule_ = VK_NULL_HANDLE;
     VkPipeline instancedGraphicsPipeline_ = VK_NULL_HANDLE;
+
+    // Grass pipeline variant - instanced layout with a wind-animating
+    // vertex shader, sharing the instanced fragment shader and layout
+    VkShaderModule grassVertShaderModule_ = VK_NULL_HANDLE;
+    VkPipeline grassGraphicsPipeline_ = VK_NULL_HANDLE;
+
+    // Baked instance buffers - device-local, uploaded once at load and
+    // referenced by range per draw. Freed slots are reused on rebake.
+    struct BakedInstanceBuffer {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        uint32_t instanceCount = 0;
+    };
+    std::vector<BakedInstanceBuffer> bakedInstanceBuffers_;
     
     // Command processing
     VkCommandPool commandPool_ = VK_NULL_HANDLE;
     std::vector<VkCommandBuffer> commandBuffers_;
     
     // Synchronization
+    // Swapchain acquire/present only accept binary semaphores; everything
+    // else rides the timeline semaphores below
     VkSemaphore imageAvailableSemaphore_ = VK_NULL_HANDLE;
     VkSemaphore renderFinishedSemaphore_ = VK_NULL_HANDLE;
-    VkFence inFlightFence_ = VK_NULL_HANDLE;
+
+    // One monotonically increasing timeline per queue. The CPU frame wait
+    // and the async compute -> graphics handoff are expressed as counter
+    // values instead of fence reset/wait pairs and binary semaphores
+    VkSemaphore renderTimeline_ = VK_NULL_HANDLE;
+    VkSemaphore computeTimeline_ = VK_NULL_HANDLE;
+    uint64_t renderTimelineValue_ = 0;   // last value signaled on the graphics queue
+    uint64_t computeTimelineValue_ = 0;  // last value signaled on the compute queue
+
+    // Asynchronous frame capture: a small ring of host-visible readback
+    // buffers. Per captured frame a copy submit waits on the render's
+    // binary semaphore, transitions the swapchain image through
+    // TRANSFER_SRC and back, and signals the capture semaphore (which
+    // present then waits on) plus the slot's fence. The consumer thread
+    // waits on fences and delivers slots to the user callback, so
+    // completed frames arrive ring-depth frames late with zero stalls
+    // on the frame loop.
+    static constexpr uint32_t CAPTURE_RING_SIZE = 3;
+
+    struct CaptureSlot {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        void* mapped = nullptr;
+        VkFence fence = VK_NULL_HANDLE;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        uint64_t frameNumber = 0;
+        bool inFlight = false;   // Guarded by captureMutex_
+    };
+
+    std::array<CaptureSlot, CAPTURE_RING_SIZE> captureSlots_;
+    VkSemaphore captureSemaphore_ = VK_NULL_HANDLE;
+    VkExtent2D captureExtent_{};       // Extent the slots were sized for
+    std::thread captureThread_;
+    std::mutex captureMutex_;
+    std::condition_variable captureCondition_;
+    std::deque<uint32_t> captureCompletedQueue_;  // Slot indices awaiting delivery
+    FrameCaptureCallback captureCallback_;
+    std::atomic<bool> captureActive_{false};
+    std::atomic<bool> captureStopRequested_{false};
+    std::atomic<uint64_t> captureDroppedFrames_{0};
+    uint64_t captureFrameCounter_ = 0;
+
+    bool createFrameCaptureResources();
+    void destroyFrameCaptureResources();
+    // Returns true if a copy was submitted (present must then wait on
+    // captureSemaphore_ instead of renderFinishedSemaphore_)
+    bool submitFrameCapture(uint32_t imageIndex);
+    void captureConsumerLoop();
     
     // Texture resources
     VkImage textureImage_ = VK_NULL_HANDLE;
@@ -456,11 +1034,17 @@ private:
     VkImageView textureImageView_ = VK_NULL_HANDLE;
     VkSampler textureSampler_ = VK_NULL_HANDLE;
     
+    // Frames in flight shared by every per-frame ring (uniforms, instances,
+    // descriptor sets): the CPU writes frame N's buffers while the GPU reads
+    // frame N-1's
+    static constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 2;
+
     // Descriptor resources
-    // Global descriptor set layout (UBO, texture, lighting)
+    // Global descriptor set layout (UBO, texture, lighting), one set per
+    // frame in flight so each frame binds its own global uniform buffer
     VkDescriptorSetLayout globalDescriptorSetLayout_ = VK_NULL_HANDLE;
     VkDescriptorPool globalDescriptorPool_ = VK_NULL_HANDLE;
-    VkDescriptorSet globalDescriptorSet_ = VK_NULL_HANDLE;
+    std::array<VkDescriptorSet, MAX_FRAMES_IN_FLIGHT> globalDescriptorSets_{};
 
     // Material descriptor set layout (per-material data)
     VkDescriptorSetLayout materialDescriptorSetLayout_ = VK_NULL_HANDLE;
@@ -470,9 +1054,11 @@ private:
     VkDescriptorPool descriptorPool_ = VK_NULL_HANDLE;
     VkDescriptorSet descriptorSet_ = VK_NULL_HANDLE;
     
-    // Uniform Buffer Object resources
-    VkBuffer uniformBuffer_ = VK_NULL_HANDLE;
-    VkDeviceMemory uniformBufferMemory_ = VK_NULL_HANDLE;
+    // Uniform Buffer Object resources: one persistently mapped global UBO
+    // per frame in flight, written once per frame in updateUniformBuffer
+    std::array<VkBuffer, MAX_FRAMES_IN_FLIGHT> uniformBuffers_{};
+    std::array<VkDeviceMemory, MAX_FRAMES_IN_FLIGHT> uniformBufferMemories_{};
+    std::array<MappedBuffer, MAX_FRAMES_IN_FLIGHT> uniformBuffersMapped_;  // RAII protected
     VkBuffer materialBuffer_ = VK_NULL_HANDLE;
     VkDeviceMemory materialBufferMemory_ = VK_NULL_HANDLE;
     
@@ -485,6 +1071,17 @@ private:
     std::chrono::high_resolution_clock::time_point lastFrameTimePoint_;
     float lastFrameTime_ = 0.0f;
 
+    // Presentation and frame pacing state
+    PresentModeSetting presentModeSetting_ = PresentModeSetting::Immediate;  // uncapped for development
+    float frameRateLimit_ = 0.0f;  // frames per second, 0 = uncapped
+    std::chrono::high_resolution_clock::time_point frameLimiterDeadline_;
+    PresentStats presentStats_;
+
+    // Draw submission tallies: accumulated while the ECS frame records,
+    // published as a stable copy at endECSFrame
+    FrameRenderStats frameRenderStats_;
+    FrameRenderStats lastFrameRenderStats_;
+
     // Material cycling state
     uint32_t currentMaterialPreset_ = 0;
 
@@ -499,16 +1096,199 @@ private:
     bool imguiInitialized_ = false;
 
     // GPU Instancing members (Phase 7.1)
-    VkBuffer instanceBuffer_ = VK_NULL_HANDLE;
-    VkDeviceMemory instanceBufferMemory_ = VK_NULL_HANDLE;
-    MappedBuffer instanceBufferMapped_;  // RAII protected
-    size_t instanceBufferSize_ = 0;
-    static constexpr size_t maxInstances_ = 1000;  // Target: 200+ creatures + headroom
+    // One instance buffer per frame in flight: the CPU bump-writes the
+    // current frame's buffer while the GPU reads the previous frame's,
+    // so instance uploads never wait on in-flight draws
+    std::array<VkBuffer, MAX_FRAMES_IN_FLIGHT> instanceBuffers_{};
+    std::array<VkDeviceMemory, MAX_FRAMES_IN_FLIGHT> instanceBufferMemories_{};
+    std::array<MappedBuffer, MAX_FRAMES_IN_FLIGHT> instanceBuffersMapped_;  // RAII protected
+    uint32_t currentFrameInFlight_ = 0;  // advanced in beginECSFrame
+    static constexpr uint32_t INITIAL_INSTANCE_CAPACITY = 1000;  // Target: 200+ creatures + headroom
+    std::array<uint32_t, MAX_FRAMES_IN_FLIGHT> instanceCapacities_{};  // instances, grows on demand
+
+    // Chained overflow blocks: when a frame's primary instance buffer
+    // fills mid-frame, whole batches continue into extra persistently
+    // mapped blocks instead of being dropped - population spikes are
+    // normal gameplay, not an error path. Draws bind the block their
+    // batch landed in with a block-local firstInstance. The blocks are
+    // coalesced into one larger primary allocation the next time that
+    // frame slot is idle (see coalesceInstanceBuffer)
+    struct InstanceOverflowBlock {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        MappedBuffer mapped;
+        uint32_t capacity = 0;  // instances
+        uint32_t used = 0;      // instances
+    };
+    std::array<std::vector<InstanceOverflowBlock>, MAX_FRAMES_IN_FLIGHT> instanceOverflowBlocks_;
+    static constexpr uint32_t OVERFLOW_BLOCK_MIN_INSTANCES = 512;
+    uint32_t instanceDemandHighWater_ = 0;  // peak instances in any frame, sizes the coalesced buffer
+
+    // Where a batch's instance data landed; the draw binds exactly this
+    // buffer, so overflow batches render identically to primary ones
+    struct InstanceWriteResult {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        uint32_t firstInstance = 0;    // local to `buffer`
+        uint32_t written = 0;          // 0 means the batch was dropped
+        bool inPrimaryBuffer = false;  // only primary batches can GPU cull
+    };
 
     // Instance buffer offset tracking for multi-batch rendering
     uint32_t currentInstanceOffset_ = 0;
     uint32_t totalInstancesThisFrame_ = 0;
-    static constexpr uint32_t MAX_INSTANCES_PER_FRAME = 1000;
+    static constexpr uint32_t INSTANCE_HARD_CAP = 65536;  // runaway guard, not a capacity
+
+    // Indirect draw command table: per-batch draw parameters live in a
+    // persistently mapped GPU buffer consumed by vkCmdDrawIndexedIndirect,
+    // so batch count no longer scales CPU draw-call encoding cost and a
+    // future GPU culling pass can rewrite the commands in place
+    VkBuffer indirectCommandBuffer_ = VK_NULL_HANDLE;
+    VkDeviceMemory indirectCommandBufferMemory_ = VK_NULL_HANDLE;
+    MappedBuffer indirectCommandBufferMapped_;  // RAII protected
+    size_t indirectCommandBufferSize_ = 0;
+    uint32_t currentIndirectDrawCount_ = 0;
+    static constexpr uint32_t maxIndirectDraws_ = 1024;  // batches x meshes per frame
+
+    // GPU compute culling resources: a compute pass reads the CPU-written
+    // instance array, compacts frustum survivors into a device-local
+    // culled instance buffer, and bumps instanceCount in the indirect
+    // command table. Culling commands are recorded into their own command
+    // buffer and submitted ahead of the graphics commands each frame.
+    bool gpuCullingEnabled_ = false;
+
+    // Depth pre-pass resources - depth-only geometry recorded into a
+    // second command buffer submitted ahead of the shaded pass
+    VkRenderPass depthPrePassRenderPass_ = VK_NULL_HANDLE;   // depth-only, clears and stores depth
+    VkRenderPass renderPassDepthLoad_ = VK_NULL_HANDLE;      // shaded pass variant that loads pre-pass depth
+    VkFramebuffer prePassFramebuffer_ = VK_NULL_HANDLE;      // depth attachment only
+    VkPipeline depthPrePassPipeline_ = VK_NULL_HANDLE;           // per-object path, vertex stage only
+    VkPipeline depthPrePassInstancedPipeline_ = VK_NULL_HANDLE;  // instanced path, vertex stage only
+    VkCommandBuffer prePassCommandBuffer_ = VK_NULL_HANDLE;
+    bool depthPrePassEnabled_ = false;
+
+    // Bindless texture array (descriptor indexing) - one global set of
+    // sampled images bound once per frame and indexed per draw
+    static constexpr uint32_t MAX_BINDLESS_TEXTURES = 1024;
+    VkDescriptorSetLayout bindlessTextureSetLayout_ = VK_NULL_HANDLE;
+    VkDescriptorPool bindlessTexturePool_ = VK_NULL_HANDLE;
+    VkDescriptorSet bindlessTextureSet_ = VK_NULL_HANDLE;
+    uint32_t nextBindlessTextureIndex_ = 0;
+    bool prePassActive_ = false;  // latched per frame in beginECSFrame
+    VkBuffer prePassBoundVertexBuffer_ = VK_NULL_HANDLE;
+    VkBuffer prePassBoundIndexBuffer_ = VK_NULL_HANDLE;
+    bool cullPassActive_ = false;  // compute recording open for this frame
+    VkDescriptorSetLayout cullDescriptorSetLayout_ = VK_NULL_HANDLE;
+    VkDescriptorPool cullDescriptorPool_ = VK_NULL_HANDLE;
+    std::array<VkDescriptorSet, MAX_FRAMES_IN_FLIGHT> cullDescriptorSets_{};  // one per instance buffer
+    VkPipelineLayout cullPipelineLayout_ = VK_NULL_HANDLE;
+    VkPipeline cullComputePipeline_ = VK_NULL_HANDLE;
+    VkCommandBuffer cullCommandBuffer_ = VK_NULL_HANDLE;
+    VkCommandPool computeCommandPool_ = VK_NULL_HANDLE;  // cull buffer's pool on the async family
+    VkBuffer culledInstanceBuffer_ = VK_NULL_HANDLE;
+    VkDeviceMemory culledInstanceBufferMemory_ = VK_NULL_HANDLE;
+    uint32_t culledInstanceCapacity_ = 0;  // instances; batches past it skip compaction
+    glm::vec4 cullFrustumPlanes_[6] = {};
+    glm::mat4 cullViewProjMatrix_{1.0f};  // refreshed by updateUniformBuffer
+    glm::mat4 cullViewMatrix_{1.0f};      // separate view/proj for the Hi-Z sphere projection
+    glm::mat4 cullProjMatrix_{1.0f};
+    static constexpr float DEFAULT_INSTANCE_CULL_RADIUS = 1.5f;  // model-space bound for unit creature meshes
+
+    // Frame graph describing the frame's pass schedule (cull compute,
+    // depth pre-pass, shaded pass, Hi-Z build). Compiled once at
+    // initialization; new passes declare their resource touches there
+    // instead of hand-auditing every existing barrier
+    FrameGraph frameGraph_;
+    FrameGraph::PassId fgShadedPass_ = 0;
+    FrameGraph::Resource fgCulledInstances_ = 0;
+    FrameGraph::Resource fgIndirectCommands_ = 0;
+    // Derived compute -> draw handoff barrier, recorded at the end of
+    // the cull submission
+    FrameGraph::Barrier cullToDrawBarrier_{};
+
+    // Hi-Z occlusion culling - a half-resolution max-depth pyramid
+    // rebuilt at the end of every frame from the depth buffer; the cull
+    // compute pass samples it (bindings 3/4 of the cull set) to reject
+    // instances hidden behind last frame's geometry
+    VkImage hiZImage_ = VK_NULL_HANDLE;
+    VkDeviceMemory hiZImageMemory_ = VK_NULL_HANDLE;
+    VkImageView hiZFullView_ = VK_NULL_HANDLE;      // all mips, sampled by the cull pass
+    std::vector<VkImageView> hiZMipViews_;          // one mip each, for the build chain
+    VkSampler hiZSampler_ = VK_NULL_HANDLE;
+    VkExtent2D hiZExtent_{};
+    uint32_t hiZMipLevels_ = 0;
+    VkDescriptorSetLayout hizBuildDescriptorSetLayout_ = VK_NULL_HANDLE;
+    VkDescriptorPool hizBuildDescriptorPool_ = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> hizBuildDescriptorSets_;  // one per pyramid level
+    VkPipelineLayout hizBuildPipelineLayout_ = VK_NULL_HANDLE;
+    VkPipeline hizBuildPipeline_ = VK_NULL_HANDLE;
+    VkBuffer cullGlobalsBuffer_ = VK_NULL_HANDLE;   // camera matrices + pyramid info for the cull pass
+    VkDeviceMemory cullGlobalsBufferMemory_ = VK_NULL_HANDLE;
+    void* cullGlobalsMapped_ = nullptr;
+    bool occlusionCullingEnabled_ = false;
+    bool hiZLayoutInitialized_ = false;  // pyramid transitioned to GENERAL on first build
+    bool hiZValid_ = false;              // a build has been submitted since (re)creation
+
+    // GPU particle subsystem: device-resident pool simulated by a compute
+    // pass (shared command pool / submit path with the cull pass), emit
+    // requests staged CPU-side and packed into a per-frame ring, survivors
+    // compacted into an instance buffer drawn through the instanced
+    // pipeline via vkCmdDrawIndexedIndirect
+    static constexpr uint32_t PARTICLE_POOL_CAPACITY = 262144;
+    static constexpr uint32_t MAX_PARTICLE_EMITS_PER_FRAME = 256;
+    bool gpuParticlesEnabled_ = false;
+    bool particlePassActive_ = false;  // compute recording open for this frame
+    VkDescriptorSetLayout particleDescriptorSetLayout_ = VK_NULL_HANDLE;
+    VkDescriptorPool particleDescriptorPool_ = VK_NULL_HANDLE;
+    std::array<VkDescriptorSet, MAX_FRAMES_IN_FLIGHT> particleDescriptorSets_{};  // one per emit ring slot
+    VkPipelineLayout particlePipelineLayout_ = VK_NULL_HANDLE;
+    VkPipeline particleComputePipeline_ = VK_NULL_HANDLE;
+    VkCommandBuffer particleCommandBuffer_ = VK_NULL_HANDLE;
+    VkBuffer particlePoolBuffer_ = VK_NULL_HANDLE;          // persistent pool, GPU-only
+    VkDeviceMemory particlePoolBufferMemory_ = VK_NULL_HANDLE;
+    VkBuffer particleInstanceBuffer_ = VK_NULL_HANDLE;      // compacted survivors, vertex binding 1
+    VkDeviceMemory particleInstanceBufferMemory_ = VK_NULL_HANDLE;
+    VkBuffer particleIndirectBuffer_ = VK_NULL_HANDLE;      // one indirect command, instanceCount GPU-written
+    VkDeviceMemory particleIndirectBufferMemory_ = VK_NULL_HANDLE;
+    MappedBuffer particleIndirectMapped_;
+    std::array<VkBuffer, MAX_FRAMES_IN_FLIGHT> particleEmitBuffers_{};  // emit request ring
+    std::array<VkDeviceMemory, MAX_FRAMES_IN_FLIGHT> particleEmitBufferMemories_{};
+    std::array<MappedBuffer, MAX_FRAMES_IN_FLIGHT> particleEmitBuffersMapped_;
+    std::vector<VulkanMon::ParticleEmitParams> pendingParticleEmits_;
+    uint32_t particlePoolCursor_ = 0;   // next ring slot; overwrites the oldest on wrap
+    uint32_t particleFrameSeed_ = 0;    // bumped per frame, salts the GPU spawn hash
+    bool particlesEverEmitted_ = false; // pool untouched until the first burst
+
+    // Multi-threaded command recording - per-object draws collected
+    // during the frame, then recorded into secondary command buffers in
+    // parallel chunks at submit time
+    struct DeferredDraw {
+        std::shared_ptr<Model> model;
+        glm::mat4 modelMatrix;
+        uint32_t materialId;
+    };
+    struct RecordingWorker {
+        std::thread thread;
+        // One pool per frame in flight: whole-pool resets are cheaper
+        // than per-buffer resets and never race the GPU thanks to the
+        // frame timeline wait
+        std::array<VkCommandPool, MAX_FRAMES_IN_FLIGHT> commandPools{};
+        std::array<VkCommandBuffer, MAX_FRAMES_IN_FLIGHT> secondaries{};
+    };
+    static constexpr uint32_t MAX_RECORDING_WORKERS = 4;
+    static constexpr size_t PARALLEL_RECORDING_MIN_DRAWS = 64;  // below this, one chunk on the main thread
+    std::vector<DeferredDraw> deferredDraws_;
+    std::vector<RecordingWorker> recordingWorkers_;
+    std::array<VkCommandBuffer, MAX_FRAMES_IN_FLIGHT> tailSecondaries_{};  // instanced draws + ImGui, main thread
+    std::mutex recordingMutex_;
+    std::condition_variable recordingWorkCv_;
+    std::condition_variable recordingDoneCv_;
+    uint64_t recordingGeneration_ = 0;  // bumped per dispatch so workers never re-run a stale job
+    uint32_t recordingPendingJobs_ = 0;
+    size_t recordingChunkSize_ = 0;
+    bool recordingShutdown_ = false;
+    VkRenderPass activeRenderPass_ = VK_NULL_HANDLE;  // pass begun this frame, for secondary inheritance
+    bool parallelRecordingEnabled_ = false;
+    bool parallelFrameActive_ = false;  // latched per frame in beginECSFrame
     
     // Vulkan initialization methods
     void initVulkan();
@@ -517,11 +1297,38 @@ private:
     void createLogicalDevice();
     void createSwapChain();
     void recreateSwapChain();
+    void waitForGpuFrameCompletion();   // CPU wait on the graphics timeline, not the whole device
+    void destroyReadyRetiredSwapchains();  // reap old swapchains the timeline has passed
     void createRenderPass();
     void createShaderModules();
+    void createPipelineCache();
+    void savePipelineCache();
+    void createTimestampQueryPool();
+    void readTimestampResults();
     void createGraphicsPipeline();
+    VkPipeline buildGraphicsPipeline(VkShaderModule vertModule, VkShaderModule fragModule,
+                                     const ShaderFeatures& features = {});
+    void swapPendingPipeline();
+
+    /**
+     * Get (building and caching on first use) the main pipeline variant
+     * for a feature set. Default features return graphicsPipeline_; the
+     * cache is dropped on shader reload since variants reference the
+     * old modules
+     */
+    VkPipeline getPipelineVariant(const ShaderFeatures& features);
+    void destroyPipelineVariants();
     void createInstancedShaderModules();
     void createInstancedGraphicsPipeline();
+
+    // Shared implementation behind renderInstanced/renderInstancedGrass -
+    // identical batching, differing only in pipeline and pre-pass use
+    void renderInstancedWithPipeline(AssetID meshId,
+                                    const void* instanceData,
+                                    uint32_t instanceCount,
+                                    uint32_t baseMaterialId,
+                                    VkPipeline pipeline,
+                                    bool participateInPrePass);
     
     // Shader helper methods
     VkShaderModule createShaderModule(const std::vector<char>& code);
@@ -531,8 +1338,8 @@ private:
     void createSyncObjects();
     
     // Resource creation methods
-    void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, 
-                     VkBuffer& buffer, VkDeviceMemory& bufferMemory);
+    void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties,
+                     VkBuffer& buffer, VkDeviceMemory& bufferMemory, bool shareWithAsyncCompute = false);
     void createImage(uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, 
                     VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory);
     VkImageView createImageView(VkImage image, VkFormat format, VkImageAspectFlags aspectFlags);
@@ -557,21 +1364,66 @@ private:
     void updateUniformBuffer();
     void updateMaterialBuffer();
 
+    // Presentation helpers
+    VkPresentModeKHR resolvePresentMode() const;
+    void applyFrameRateLimit();
+
     // ECS Integration helper methods
     void recordECSCommandBuffer(uint32_t imageIndex);
-    void ensureMeshLoaded(const std::string& meshPath);
+    void ensureMeshLoaded(AssetID meshId);
 
     // GPU Instancing helper methods (Phase 7.1)
     void createInstanceBuffer();
+    void coalesceInstanceBuffer();
+    InstanceOverflowBlock* acquireInstanceOverflowBlock(uint32_t instanceCount);
+    void destroyInstanceOverflowBlocks(uint32_t frame);
+    void createIndirectCommandBuffer();
+    void createCullComputeResources();
+    void cleanupCullComputeResources();
+
+    // GPU particle pass: emit request packing, compute recording, teardown
+    void createParticleComputeResources();
+    void cleanupParticleComputeResources();
+    void beginParticlePass();
+
+    // Hi-Z pyramid construction and cull-pass wiring
+    void createHiZResources();
+    void cleanupHiZResources();
+    void writeCullHiZDescriptors();
+    void recordHiZPyramidBuild(VkCommandBuffer commandBuffer);
+
+    // Frame graph construction - declares the frame's passes and derives
+    // the barriers the hand-recorded submission paths pull from it
+    void buildFrameGraph();
+
+    // Depth pre-pass pipeline creation and per-frame recording
+    void createDepthPrePassResources();
+    void cleanupDepthPrePassResources();
+    void beginDepthPrePass();
+
+    // Bindless texture array setup
+    void createBindlessTextureResources();
+    void cleanupBindlessTextureResources();
+
+    // Multi-threaded command recording
+    void createParallelRecordingResources();
+    void cleanupParallelRecordingResources();
+    void recordingWorkerLoop(uint32_t workerIndex);
+    void recordDrawChunk(VkCommandBuffer secondary, size_t first, size_t count);
+    void flushDeferredDraws(std::vector<VkCommandBuffer>& executed);
+    void beginCullPass();
     void updateInstanceData(const std::vector<VulkanMon::InstanceData>& instances);
-    void updateInstanceDataDirect(const InstanceData* instances, uint32_t instanceCount);
+    InstanceWriteResult updateInstanceDataDirect(const InstanceData* instances, uint32_t instanceCount);
     void cleanupInstanceBuffer();
+    void cleanupIndirectCommandBuffer();
     std::vector<VkVertexInputBindingDescription> getInstancedBindingDescriptions();
     std::vector<VkVertexInputAttributeDescription> getInstancedAttributeDescriptions();
     
     // Helper methods
     uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
     int findGraphicsQueueFamily();
+    int findTransferQueueFamily();
+    int findComputeQueueFamily();
     VkFormat findDepthFormat();
     VkFormat findSupportedFormat(const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features);
     bool hasStencilComponent(VkFormat format);
@@ -0,0 +1,247 @@
+#include "MortonGrid.h"
+#include "SpatialManager.h"
+
+namespace VulkanMon {
+
+namespace {
+    constexpr uint32_t MORTON_AXIS_BITS = 10; // 1024 cells per axis, 30-bit codes
+    constexpr uint32_t MORTON_AXIS_MAX = (1u << MORTON_AXIS_BITS) - 1;
+
+    // Spread the low 10 bits of v so they occupy every third bit
+    uint64_t spreadBits(uint32_t v) {
+        uint64_t x = v & MORTON_AXIS_MAX;
+        x = (x | (x << 16)) & 0x030000FFull;
+        x = (x | (x << 8))  & 0x0300F00Full;
+        x = (x | (x << 4))  & 0x030C30C3ull;
+        x = (x | (x << 2))  & 0x09249249ull;
+        return x;
+    }
+
+    uint64_t encodeMorton(uint32_t x, uint32_t y, uint32_t z) {
+        return spreadBits(x) | (spreadBits(y) << 1) | (spreadBits(z) << 2);
+    }
+}
+
+MortonGrid::MortonGrid(const BoundingBox& bounds)
+    : boundsMin_(bounds.min), boundsMax_(bounds.max) {
+    glm::vec3 size = glm::max(bounds.max - bounds.min, glm::vec3(0.001f));
+    cellScale_ = glm::vec3(static_cast<float>(MORTON_AXIS_MAX)) / size;
+}
+
+uint64_t MortonGrid::encodePosition(const glm::vec3& position,
+                                    const glm::vec3& boundsMin, const glm::vec3& boundsMax) {
+    glm::vec3 size = glm::max(boundsMax - boundsMin, glm::vec3(0.001f));
+    glm::vec3 scale = glm::vec3(static_cast<float>(MORTON_AXIS_MAX)) / size;
+    glm::vec3 local = (position - boundsMin) * scale;
+    uint32_t x = static_cast<uint32_t>(glm::clamp(local.x, 0.0f, static_cast<float>(MORTON_AXIS_MAX)));
+    uint32_t y = static_cast<uint32_t>(glm::clamp(local.y, 0.0f, static_cast<float>(MORTON_AXIS_MAX)));
+    uint32_t z = static_cast<uint32_t>(glm::clamp(local.z, 0.0f, static_cast<float>(MORTON_AXIS_MAX)));
+    return encodeMorton(x, y, z);
+}
+
+uint64_t MortonGrid::mortonKey(const glm::vec3& position) const {
+    // Clamp out-of-bounds positions into the edge cells so entities that
+    // stray past the world rim stay queryable, matching octree behavior
+    glm::vec3 local = (position - boundsMin_) * cellScale_;
+    uint32_t x = static_cast<uint32_t>(glm::clamp(local.x, 0.0f, static_cast<float>(MORTON_AXIS_MAX)));
+    uint32_t y = static_cast<uint32_t>(glm::clamp(local.y, 0.0f, static_cast<float>(MORTON_AXIS_MAX)));
+    uint32_t z = static_cast<uint32_t>(glm::clamp(local.z, 0.0f, static_cast<float>(MORTON_AXIS_MAX)));
+    return encodeMorton(x, y, z);
+}
+
+bool MortonGrid::containsPosition(const BoundingBox& region, const glm::vec3& position) {
+    return region.contains(position);
+}
+
+std::pair<size_t, size_t> MortonGrid::sortedRange(const BoundingBox& region) const {
+    // Morton codes are monotone in each axis, so every cell inside the
+    // box has a code within [key(min), key(max)]. The range is a
+    // superset (it snakes outside the box), hence the position filter
+    // applied by callers.
+    uint64_t lowKey = mortonKey(region.min);
+    uint64_t highKey = mortonKey(region.max);
+
+    auto keyLess = [](const Record& record, uint64_t key) { return record.key < key; };
+    auto first = std::lower_bound(sorted_.begin(), sorted_.end(), lowKey, keyLess);
+    auto last = std::lower_bound(first, sorted_.end(), highKey + 1, keyLess);
+    return {static_cast<size_t>(first - sorted_.begin()),
+            static_cast<size_t>(last - sorted_.begin())};
+}
+
+MortonGrid::Record* MortonGrid::findRecord(EntityID entity, const glm::vec3& position) {
+    for (Record& record : delta_) {
+        if (record.entity == entity) {
+            return &record;
+        }
+    }
+    uint64_t key = mortonKey(position);
+    auto keyLess = [](const Record& record, uint64_t k) { return record.key < k; };
+    auto it = std::lower_bound(sorted_.begin(), sorted_.end(), key, keyLess);
+    for (; it != sorted_.end() && it->key == key; ++it) {
+        if (it->entity == entity && isLive(*it)) {
+            return &(*it);
+        }
+    }
+    return nullptr;
+}
+
+void MortonGrid::insert(EntityID entity, const glm::vec3& position, uint32_t layers) {
+    delta_.push_back({mortonKey(position), entity, position, layers});
+    entityCount_++;
+    if (delta_.size() >= MERGE_THRESHOLD) {
+        mergeDelta();
+    }
+}
+
+void MortonGrid::remove(EntityID entity, const glm::vec3& position) {
+    (void)position; // flat layout locates by entity, not by cell
+
+    for (auto it = delta_.begin(); it != delta_.end(); ++it) {
+        if (it->entity == entity) {
+            *it = delta_.back();
+            delta_.pop_back();
+            entityCount_--;
+            return;
+        }
+    }
+
+    if (removed_.insert(entity).second) {
+        entityCount_--;
+        if (removed_.size() >= MERGE_THRESHOLD) {
+            mergeDelta();
+        }
+    }
+}
+
+void MortonGrid::update(EntityID entity, const glm::vec3& oldPos, const glm::vec3& newPos, uint32_t layers) {
+    uint64_t newKey = mortonKey(newPos);
+    if (Record* record = findRecord(entity, oldPos)) {
+        if (record->key == newKey) {
+            // Same cell - update in place, sort order is unaffected
+            record->position = newPos;
+            record->layers = layers;
+            return;
+        }
+    }
+    remove(entity, oldPos);
+    insert(entity, newPos, layers);
+}
+
+void MortonGrid::setEntityLayers(EntityID entity, const glm::vec3& position, uint32_t layers) {
+    if (Record* record = findRecord(entity, position)) {
+        record->layers = layers;
+    }
+}
+
+void MortonGrid::query(const BoundingBox& region, std::vector<EntityID>& results, uint32_t layerMask) const {
+    visit(region, [&](EntityID entity, const glm::vec3&) {
+        results.push_back(entity);
+        return true;
+    }, layerMask);
+}
+
+void MortonGrid::query(const Frustum& frustum, std::vector<EntityID>& results, uint32_t layerMask) const {
+    // Frustums have no useful Morton range, so scan linearly; the
+    // sorted bulk is contiguous which keeps this cache-friendly
+    for (const Record& record : sorted_) {
+        if (isLive(record) && layerPasses(record.layers, layerMask) && frustum.contains(record.position)) {
+            results.push_back(record.entity);
+        }
+    }
+    for (const Record& record : delta_) {
+        if (layerPasses(record.layers, layerMask) && frustum.contains(record.position)) {
+            results.push_back(record.entity);
+        }
+    }
+}
+
+void MortonGrid::queryRadius(const glm::vec3& center, float radius, std::vector<EntityID>& results, uint32_t layerMask) const {
+    BoundingBox sphereBounds(center - glm::vec3(radius), center + glm::vec3(radius));
+    query(sphereBounds, results, layerMask);
+}
+
+void MortonGrid::mergeDelta() {
+    if (delta_.empty() && removed_.empty()) {
+        return;
+    }
+
+    std::sort(delta_.begin(), delta_.end(),
+              [](const Record& a, const Record& b) { return a.key < b.key; });
+
+    std::vector<Record> merged;
+    merged.reserve(entityCount_);
+
+    auto sortedIt = sorted_.begin();
+    auto deltaIt = delta_.begin();
+    while (sortedIt != sorted_.end() || deltaIt != delta_.end()) {
+        bool takeSorted = deltaIt == delta_.end() ||
+                          (sortedIt != sorted_.end() && sortedIt->key <= deltaIt->key);
+        if (takeSorted) {
+            if (isLive(*sortedIt)) {
+                merged.push_back(*sortedIt);
+            }
+            ++sortedIt;
+        } else {
+            merged.push_back(*deltaIt);
+            ++deltaIt;
+        }
+    }
+
+    sorted_ = std::move(merged);
+    delta_.clear();
+    removed_.clear();
+}
+
+void MortonGrid::growToInclude(const glm::vec3& position) {
+    constexpr int MAX_GROWTH_STEPS = 32;
+    int steps = 0;
+
+    glm::vec3 newMin = boundsMin_;
+    glm::vec3 newMax = boundsMax_;
+    while (!BoundingBox(newMin, newMax).contains(position)) {
+        if (++steps > MAX_GROWTH_STEPS) {
+            return; // non-finite position; leave bounds untouched
+        }
+        glm::vec3 size = newMax - newMin;
+        if (position.x < newMin.x) newMin.x -= size.x; else newMax.x += size.x;
+        if (position.y < newMin.y) newMin.y -= size.y; else newMax.y += size.y;
+        if (position.z < newMin.z) newMin.z -= size.z; else newMax.z += size.z;
+    }
+    if (steps == 0) {
+        return;
+    }
+
+    boundsMin_ = newMin;
+    boundsMax_ = newMax;
+    glm::vec3 size = glm::max(newMax - newMin, glm::vec3(0.001f));
+    cellScale_ = glm::vec3(static_cast<float>(MORTON_AXIS_MAX)) / size;
+
+    // Quantization changed, so every key is invalid: fold the delta in,
+    // re-key everything, and resort the flat array once
+    mergeDelta();
+    for (Record& record : sorted_) {
+        record.key = mortonKey(record.position);
+    }
+    std::sort(sorted_.begin(), sorted_.end(),
+              [](const Record& a, const Record& b) { return a.key < b.key; });
+}
+
+BoundingBox MortonGrid::getBounds() const {
+    return BoundingBox(boundsMin_, boundsMax_);
+}
+
+void MortonGrid::clear() {
+    sorted_.clear();
+    delta_.clear();
+    removed_.clear();
+    entityCount_ = 0;
+}
+
+void MortonGrid::getStatistics(int& nodeCount, int& maxDepth, int& totalEntities) const {
+    // One flat array, reported as a single "node" for stat consumers
+    nodeCount += 1;
+    maxDepth = std::max(maxDepth, 1);
+    totalEntities += static_cast<int>(entityCount_);
+}
+
+} // namespace VulkanMon
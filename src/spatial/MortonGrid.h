@@ -0,0 +1,177 @@
+#pragma once
+
+#include "../core/Entity.h"
+#include "LayerMask.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace VulkanMon {
+
+struct BoundingBox;
+struct Frustum;
+
+// Morton-order linear spatial backend
+//
+// Alternative to FlatOctree for mostly-flat outdoor maps: entities live
+// in one flat array sorted by the Morton code of their quantized
+// position, and box queries binary-search the code range of the query
+// bounds then filter the (cache-linear) slice by actual position.
+// Mutations are incremental - inserts append to a small unsorted delta
+// and removals tombstone the sorted array; both are merged back when
+// they grow past a threshold, so no operation resorts the whole world.
+// Mirrors the FlatOctree query surface so SpatialManager can select
+// either backend per world.
+class MortonGrid {
+public:
+    static constexpr size_t MERGE_THRESHOLD = 256; // delta/tombstone size that triggers a merge
+
+private:
+    struct Record {
+        uint64_t key = 0;
+        EntityID entity = INVALID_ENTITY;
+        glm::vec3 position{0.0f};
+        uint32_t layers = 0;
+    };
+
+    glm::vec3 boundsMin_{0.0f};
+    glm::vec3 boundsMax_{0.0f};
+    glm::vec3 cellScale_{1.0f}; // world units -> [0, 1023] per axis
+
+    std::vector<Record> sorted_;             // Morton-ordered bulk
+    std::vector<Record> delta_;              // recent inserts, scanned linearly
+    std::unordered_set<EntityID> removed_;   // tombstones against sorted_
+    size_t entityCount_ = 0;
+
+    static bool layerPasses(uint32_t layers, uint32_t layerMask) {
+        // Same rule as the octree: LayerMask::All never filters so
+        // entities added with no layers still appear
+        return layerMask == LayerMask::All || (layers & layerMask) != 0;
+    }
+
+    bool isLive(const Record& record) const {
+        return removed_.find(record.entity) == removed_.end();
+    }
+
+public:
+    explicit MortonGrid(const BoundingBox& bounds);
+
+    // Core operations (FlatOctree-compatible signatures)
+    void insert(EntityID entity, const glm::vec3& position, uint32_t layers = LayerMask::None);
+    void remove(EntityID entity, const glm::vec3& position);
+    void update(EntityID entity, const glm::vec3& oldPos, const glm::vec3& newPos, uint32_t layers);
+    void setEntityLayers(EntityID entity, const glm::vec3& position, uint32_t layers);
+
+    // Spatial queries (candidate supersets; exact filtering stays in
+    // SpatialManager, matching the octree contract)
+    void query(const BoundingBox& region, std::vector<EntityID>& results, uint32_t layerMask = LayerMask::All) const;
+    void query(const Frustum& frustum, std::vector<EntityID>& results, uint32_t layerMask = LayerMask::All) const;
+    void queryRadius(const glm::vec3& center, float radius, std::vector<EntityID>& results, uint32_t layerMask = LayerMask::All) const;
+
+    // Visit entries inside region; visitor returns false to stop early,
+    // visit() returns false if stopped
+    template<typename Visitor>
+    bool visit(const BoundingBox& region, Visitor&& visitor, uint32_t layerMask = LayerMask::All) const {
+        auto [first, last] = sortedRange(region);
+        for (size_t i = first; i < last; ++i) {
+            const Record& record = sorted_[i];
+            if (isLive(record) && containsPosition(region, record.position) &&
+                layerPasses(record.layers, layerMask)) {
+                if (!visitor(record.entity, record.position)) {
+                    return false;
+                }
+            }
+        }
+        for (const Record& record : delta_) {
+            if (containsPosition(region, record.position) && layerPasses(record.layers, layerMask)) {
+                if (!visitor(record.entity, record.position)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // k-nearest collection into a shared max-heap (FlatOctree-compatible).
+    // A flat array has no subtrees to prune, so this is one cache-linear
+    // scan maintaining the bounded heap - the layout's strength for the
+    // uniform distributions this backend targets.
+    template<typename Filter>
+    void collectNearest(const glm::vec3& position, size_t k, float maxDistance,
+                        std::vector<std::pair<float, EntityID>>& best, Filter&& filter,
+                        uint32_t layerMask = LayerMask::All) const {
+        if (k == 0 || entityCount_ == 0) {
+            return;
+        }
+
+        auto consider = [&](const Record& record) {
+            if (!layerPasses(record.layers, layerMask)) {
+                return;
+            }
+            float distance = glm::distance(position, record.position);
+            if (distance > maxDistance || !filter(record.entity)) {
+                return;
+            }
+            if (best.size() == k) {
+                if (distance >= best.front().first) {
+                    return;
+                }
+                std::pop_heap(best.begin(), best.end());
+                best.back() = {distance, record.entity};
+            } else {
+                best.emplace_back(distance, record.entity);
+            }
+            std::push_heap(best.begin(), best.end());
+        };
+
+        for (const Record& record : sorted_) {
+            if (isLive(record)) {
+                consider(record);
+            }
+        }
+        for (const Record& record : delta_) {
+            consider(record);
+        }
+    }
+
+    // Grow the grid bounds until they contain position (same per-axis
+    // doubling as FlatOctree::growToInclude, so both backends agree on
+    // the resulting bounds). Re-quantizes and resorts all records -
+    // cheap for a flat array, and growth is a rare streaming event.
+    void growToInclude(const glm::vec3& position);
+
+    // Utility
+    void clear();
+    BoundingBox getBounds() const;
+    size_t getEntityCount() const { return entityCount_; }
+    void getStatistics(int& nodeCount, int& maxDepth, int& totalEntities) const;
+
+    // Container footprint in bytes, capacity included - feeds the
+    // memory tracker's spatial gauge
+    size_t getMemoryBytes() const {
+        return (sorted_.capacity() + delta_.capacity()) * sizeof(Record) +
+               removed_.size() * sizeof(EntityID);
+    }
+
+    // Merge the delta and tombstones back into the sorted bulk (also
+    // triggered automatically past MERGE_THRESHOLD)
+    void mergeDelta();
+
+    // Standalone Morton encoding against arbitrary bounds, same
+    // quantization as this grid's keys. Lets SpatialManager order
+    // entities by locality without a grid instance (the octree backend
+    // has no key concept of its own).
+    static uint64_t encodePosition(const glm::vec3& position,
+                                   const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+
+private:
+    uint64_t mortonKey(const glm::vec3& position) const;
+    std::pair<size_t, size_t> sortedRange(const BoundingBox& region) const;
+    static bool containsPosition(const BoundingBox& region, const glm::vec3& position);
+    Record* findRecord(EntityID entity, const glm::vec3& position);
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define VKMON_SIMD_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+namespace VulkanMon {
+
+struct Frustum;
+
+// Batched frustum-vs-AABB culling
+//
+// Tests many axis-aligned boxes (given as SoA min/max component arrays)
+// against all six frustum planes at once. The SSE2 path processes four
+// boxes per iteration using the positive-vertex test; on other targets a
+// scalar loop with identical results is used. The octree frustum
+// traversal feeds the eight children of each visited node through this
+// kernel instead of testing them one box at a time.
+namespace SimdCulling {
+
+    // Scalar positive-vertex test for one box (shared tail/fallback).
+    // planes: 6 x vec4 (nx, ny, nz, d), normalized.
+    inline bool intersectsScalar(const float (*planes)[4],
+                                 float minX, float minY, float minZ,
+                                 float maxX, float maxY, float maxZ) {
+        for (int p = 0; p < 6; ++p) {
+            float px = (planes[p][0] >= 0.0f) ? maxX : minX;
+            float py = (planes[p][1] >= 0.0f) ? maxY : minY;
+            float pz = (planes[p][2] >= 0.0f) ? maxZ : minZ;
+
+            float distance = planes[p][0] * px + planes[p][1] * py +
+                             planes[p][2] * pz + planes[p][3];
+            if (distance < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Test `count` AABBs against the six planes; writes 1 (intersects)
+    // or 0 per box into `visible`. Arrays are SoA: minX[i]..maxZ[i]
+    // describe box i.
+    inline void cullAABBs(const float (*planes)[4],
+                          const float* minX, const float* minY, const float* minZ,
+                          const float* maxX, const float* maxY, const float* maxZ,
+                          size_t count, uint8_t* visible) {
+        size_t i = 0;
+
+#if VKMON_SIMD_SSE2
+        for (; i + 4 <= count; i += 4) {
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+            for (int p = 0; p < 6; ++p) {
+                __m128 nx = _mm_set1_ps(planes[p][0]);
+                __m128 ny = _mm_set1_ps(planes[p][1]);
+                __m128 nz = _mm_set1_ps(planes[p][2]);
+                __m128 d  = _mm_set1_ps(planes[p][3]);
+
+                // Positive vertex: per-plane component sign selects the
+                // whole min or max lane vector
+                __m128 px = (planes[p][0] >= 0.0f) ? _mm_loadu_ps(maxX + i)
+                                                   : _mm_loadu_ps(minX + i);
+                __m128 py = (planes[p][1] >= 0.0f) ? _mm_loadu_ps(maxY + i)
+                                                   : _mm_loadu_ps(minY + i);
+                __m128 pz = (planes[p][2] >= 0.0f) ? _mm_loadu_ps(maxZ + i)
+                                                   : _mm_loadu_ps(minZ + i);
+
+                __m128 distance = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(nx, px), _mm_mul_ps(ny, py)),
+                    _mm_add_ps(_mm_mul_ps(nz, pz), d));
+
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+            }
+
+            int mask = _mm_movemask_ps(inside);
+            visible[i + 0] = (mask & 1) ? 1 : 0;
+            visible[i + 1] = (mask & 2) ? 1 : 0;
+            visible[i + 2] = (mask & 4) ? 1 : 0;
+            visible[i + 3] = (mask & 8) ? 1 : 0;
+        }
+#endif
+
+        for (; i < count; ++i) {
+            visible[i] = intersectsScalar(planes, minX[i], minY[i], minZ[i],
+                                          maxX[i], maxY[i], maxZ[i]) ? 1 : 0;
+        }
+    }
+
+} // namespace SimdCulling
+
+} // namespace VulkanMon
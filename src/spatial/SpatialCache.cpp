@@ -52,7 +52,67 @@ size_t PredictiveSpatialCache::hashFrustumQuery(const Frustum& frustum, uint32_t
 
 bool PredictiveSpatialCache::isEntryValid(const SpatialCacheEntry& entry) const {
     float currentTime = getCurrentTime();
-    return (currentTime - entry.timestamp) < CACHE_TTL_SECONDS;
+    if ((currentTime - entry.timestamp) >= CACHE_TTL_SECONDS) {
+        return false;
+    }
+    // Lazy staleness check against the generation counters bumped by
+    // invalidateRegion - this is where invalidation cost actually lands
+    return generationsCurrent(entry);
+}
+
+uint32_t PredictiveSpatialCache::cellSlotFor(int cellX, int cellY, int cellZ) const {
+    // Classic 3D spatial hash primes; collisions just over-invalidate
+    uint64_t hash = static_cast<uint64_t>(static_cast<uint32_t>(cellX)) * 73856093u ^
+                    static_cast<uint64_t>(static_cast<uint32_t>(cellY)) * 19349663u ^
+                    static_cast<uint64_t>(static_cast<uint32_t>(cellZ)) * 83492791u;
+    return static_cast<uint32_t>(hash % SpatialCacheData::CELL_TABLE_SIZE);
+}
+
+void PredictiveSpatialCache::captureRegionGenerations(SpatialCacheEntry& entry) const {
+    constexpr float cellSize = SpatialCacheData::COARSE_CELL_SIZE;
+    int minX = static_cast<int>(std::floor(entry.regionMin.x / cellSize));
+    int minY = static_cast<int>(std::floor(entry.regionMin.y / cellSize));
+    int minZ = static_cast<int>(std::floor(entry.regionMin.z / cellSize));
+    int maxX = static_cast<int>(std::floor(entry.regionMax.x / cellSize));
+    int maxY = static_cast<int>(std::floor(entry.regionMax.y / cellSize));
+    int maxZ = static_cast<int>(std::floor(entry.regionMax.z / cellSize));
+
+    size_t cellCount = static_cast<size_t>(maxX - minX + 1) *
+                       static_cast<size_t>(maxY - minY + 1) *
+                       static_cast<size_t>(maxZ - minZ + 1);
+
+    entry.cellGenerations.clear();
+    if (cellCount > MAX_TRACKED_CELLS) {
+        // Region too large to track per cell (frustum entries) - any
+        // invalidation anywhere makes it stale, matching the old
+        // conservative behavior for huge regions
+        entry.usesGlobalGeneration = true;
+        entry.globalGenerationSnapshot = cacheData_->globalGeneration;
+        return;
+    }
+
+    entry.usesGlobalGeneration = false;
+    entry.cellGenerations.reserve(cellCount);
+    for (int x = minX; x <= maxX; ++x) {
+        for (int y = minY; y <= maxY; ++y) {
+            for (int z = minZ; z <= maxZ; ++z) {
+                uint32_t slot = cellSlotFor(x, y, z);
+                entry.cellGenerations.emplace_back(slot, cacheData_->cellGenerations[slot]);
+            }
+        }
+    }
+}
+
+bool PredictiveSpatialCache::generationsCurrent(const SpatialCacheEntry& entry) const {
+    if (entry.usesGlobalGeneration) {
+        return entry.globalGenerationSnapshot == cacheData_->globalGeneration;
+    }
+    for (const auto& [slot, generation] : entry.cellGenerations) {
+        if (cacheData_->cellGenerations[slot] != generation) {
+            return false;
+        }
+    }
+    return true;
 }
 
 void PredictiveSpatialCache::clear() {
@@ -145,6 +205,7 @@ void PredictiveSpatialCache::cacheRadiusQuery(const glm::vec3& center, float rad
     // Calculate spatial region for targeted invalidation
     entry.regionMin = center - glm::vec3(radius);
     entry.regionMax = center + glm::vec3(radius);
+    captureRegionGenerations(entry);
 
     // Initialize LRU tracking
     float currentTime = getCurrentTime();
@@ -218,6 +279,7 @@ void PredictiveSpatialCache::cacheRegionQuery(const BoundingBox& region, uint32_
     // Calculate spatial region for targeted invalidation
     entry.regionMin = region.min;
     entry.regionMax = region.max;
+    captureRegionGenerations(entry);
 
     // Initialize LRU tracking
     float currentTime = getCurrentTime();
@@ -307,6 +369,7 @@ void PredictiveSpatialCache::cacheFrustumQuery(const Frustum& frustum, uint32_t
 
     entry.regionMin = glm::vec3(minX, minY, minZ);
     entry.regionMax = glm::vec3(maxX, maxY, maxZ);
+    captureRegionGenerations(entry);
 
     // Initialize LRU tracking
     float currentTime = getCurrentTime();
@@ -362,23 +425,40 @@ std::vector<glm::vec3> PredictiveSpatialCache::generateNearbyPoints(const glm::v
 
 // Regional invalidation implementation
 void PredictiveSpatialCache::invalidateRegion(const glm::vec3& regionMin, const glm::vec3& regionMax) {
-    auto it = cacheData_->cache.begin();
-    size_t invalidatedCount = 0;
-
-    while (it != cacheData_->cache.end()) {
-        if (regionsIntersect(it->second.regionMin, it->second.regionMax, regionMin, regionMax)) {
-            it = cacheData_->cache.erase(it);
-            invalidatedCount++;
-        } else {
-            ++it;
+    // Bump generation counters for the touched coarse cells instead of
+    // walking the cache: entries check staleness lazily at lookup, so
+    // this is O(covered cells) regardless of how many entries exist.
+    constexpr float cellSize = SpatialCacheData::COARSE_CELL_SIZE;
+    int minX = static_cast<int>(std::floor(regionMin.x / cellSize));
+    int minY = static_cast<int>(std::floor(regionMin.y / cellSize));
+    int minZ = static_cast<int>(std::floor(regionMin.z / cellSize));
+    int maxX = static_cast<int>(std::floor(regionMax.x / cellSize));
+    int maxY = static_cast<int>(std::floor(regionMax.y / cellSize));
+    int maxZ = static_cast<int>(std::floor(regionMax.z / cellSize));
+
+    size_t cellCount = static_cast<size_t>(maxX - minX + 1) *
+                       static_cast<size_t>(maxY - minY + 1) *
+                       static_cast<size_t>(maxZ - minZ + 1);
+
+    if (cellCount > MAX_TRACKED_CELLS) {
+        // Huge invalidation region (e.g. streaming a whole area in):
+        // bump every counter so per-cell entries go stale too
+        for (auto& generation : cacheData_->cellGenerations) {
+            ++generation;
+        }
+    } else {
+        for (int x = minX; x <= maxX; ++x) {
+            for (int y = minY; y <= maxY; ++y) {
+                for (int z = minZ; z <= maxZ; ++z) {
+                    ++cacheData_->cellGenerations[cellSlotFor(x, y, z)];
+                }
+            }
         }
     }
 
-    #ifdef DEBUG_VERBOSE
-    if (invalidatedCount > 0) {
-        VKMON_DEBUG("Regional invalidation: " + std::to_string(invalidatedCount) + " entries removed");
-    }
-    #endif
+    // Global-generation entries cover most of the world, so any
+    // invalidation makes them stale
+    ++cacheData_->globalGeneration;
 }
 
 void PredictiveSpatialCache::invalidateEntityMovement(const glm::vec3& oldPos, const glm::vec3& newPos, float radius) {
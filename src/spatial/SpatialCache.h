@@ -3,6 +3,7 @@
 #include "../core/Entity.h"
 #include "LayerMask.h"
 #include <glm/glm.hpp>
+#include <array>
 #include <vector>
 #include <unordered_map>
 #include <chrono>
@@ -55,6 +56,15 @@ struct SpatialCacheEntry {
     // Type-safe variant instead of unsafe union
     std::variant<RadiusQuery, RegionQuery, FrustumQuery> params;
 
+    // Generation snapshot for lazy invalidation: the coarse grid slots
+    // this entry's region covered at creation time with their counter
+    // values, or (for regions spanning too many cells, e.g. frustum
+    // entries) a snapshot of the global generation. Staleness is checked
+    // at lookup instead of walking the cache on every movement.
+    std::vector<std::pair<uint32_t, uint32_t>> cellGenerations; // (slot, generation)
+    bool usesGlobalGeneration = false;
+    uint32_t globalGenerationSnapshot = 0;
+
     // Default constructor with proper initialization
     SpatialCacheEntry() : timestamp(0.0f), layerMask(0),
                           regionMin(0.0f), regionMax(0.0f),
@@ -72,7 +82,17 @@ struct SpatialCacheEntry {
 // - If multi-threading needed in future, consider separate cache per thread
 //   or implement proper lock-free double buffering with atomic swaps
 struct SpatialCacheData {
+    // Region-bucketed generation counters: the world is hashed onto a
+    // fixed table of coarse cells and each invalidation bumps only the
+    // counters for the cells it touches, making movement invalidation
+    // O(covered cells) instead of O(cache size). Hash collisions only
+    // cause harmless extra invalidation.
+    static constexpr float COARSE_CELL_SIZE = 16.0f;
+    static constexpr size_t CELL_TABLE_SIZE = 4096;
+
     std::unordered_map<size_t, SpatialCacheEntry> cache;
+    std::array<uint32_t, CELL_TABLE_SIZE> cellGenerations{};
+    uint32_t globalGeneration = 0;
     size_t hitCount = 0;
     size_t missCount = 0;
     float timestamp = 0.0f;
@@ -165,6 +185,14 @@ public:
     size_t getCacheSize() const {
         return cacheData_->cache.size();
     }
+
+    // Cheap byte estimate, same formula as the detailed metrics but
+    // without computing the full report
+    size_t getEstimatedMemoryBytes() const {
+        return cacheData_->cache.size() * (sizeof(SpatialCacheEntry) +
+                                           sizeof(std::pair<size_t, SpatialCacheEntry>) +
+                                           64); // Average result vector overhead
+    }
     void resetStatistics() {
         cacheData_->hitCount = 0;
         cacheData_->missCount = 0;
@@ -234,6 +262,12 @@ private:
     bool isEntryValid(const SpatialCacheEntry& entry) const;
     void evictOldEntries();
 
+    // Generation-counter invalidation helpers
+    static constexpr size_t MAX_TRACKED_CELLS = 64; // beyond this, track the global generation
+    uint32_t cellSlotFor(int cellX, int cellY, int cellZ) const;
+    void captureRegionGenerations(SpatialCacheEntry& entry) const;
+    bool generationsCurrent(const SpatialCacheEntry& entry) const;
+
     // LRU eviction strategy
     void evictLRUEntries(size_t targetCount);
     void evictBasedOnMemoryPressure();
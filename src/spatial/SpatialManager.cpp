@@ -1,4 +1,6 @@
 #include "SpatialManager.h"
+#include "SimdCulling.h"
+#include "../utils/JobSystem.h"
 #include "../utils/Logger.h"
 #include <algorithm>
 #include <chrono>
@@ -64,21 +66,30 @@ void Frustum::updateFromMatrix(const glm::mat4& viewProjectionMatrix) {
         float length = glm::length(glm::vec3(planes[i]));
         planes[i] /= length;
     }
+
+    updateAbsNormals();
+}
+
+void Frustum::updateAbsNormals() {
+    for (int i = 0; i < 6; ++i) {
+        absNormals[i] = glm::abs(glm::vec3(planes[i]));
+    }
 }
 
 bool Frustum::intersects(const BoundingBox& box) const {
+    // Center/extent form of the positive-vertex test: projecting the
+    // half-extent onto the precomputed |normal| replaces the three
+    // per-plane sign branches of the min/max vertex selection
+    glm::vec3 center = box.getCenter();
+    glm::vec3 extent = (box.max - box.min) * 0.5f;
+
     for (int i = 0; i < 6; ++i) {
         const glm::vec4& plane = planes[i];
-        glm::vec3 normal = glm::vec3(plane);
-
-        // Get the positive vertex (farthest along plane normal)
-        glm::vec3 positiveVertex = box.min;
-        if (normal.x >= 0) positiveVertex.x = box.max.x;
-        if (normal.y >= 0) positiveVertex.y = box.max.y;
-        if (normal.z >= 0) positiveVertex.z = box.max.z;
+        float distance = glm::dot(glm::vec3(plane), center) + plane.w;
+        float radius = glm::dot(absNormals[i], extent);
 
-        // If positive vertex is behind plane, box is outside frustum
-        if (glm::dot(normal, positiveVertex) + plane.w < 0) {
+        // Box entirely behind this plane means outside the frustum
+        if (distance + radius < 0.0f) {
             return false;
         }
     }
@@ -95,262 +106,416 @@ bool Frustum::contains(const glm::vec3& point) const {
     return true;
 }
 
-// OctreeNode implementation
-void OctreeNode::insert(EntityID entity, const glm::vec3& position) {
-    if (!bounds_.contains(position)) {
-        return; // Position is outside this node's bounds
-    }
+// FlatOctree implementation
+FlatOctree::FlatOctree(const BoundingBox& bounds) {
+    Node root;
+    root.bounds = bounds;
+    nodes_.push_back(root);
+}
 
-    if (is_leaf_) {
-        entities_.push_back(entity);
+int FlatOctree::getChildIndex(const Node& node, const glm::vec3& position) const {
+    glm::vec3 center = node.bounds.getCenter();
 
-        // Note: Subdivision now requires position lookup from SpatialManager
-        // This will be handled by SpatialManager::insert() when needed
-    } else {
-        // Insert into appropriate child
-        int childIndex = getChildIndex(position);
-        if (children_[childIndex]) {
-            children_[childIndex]->insert(entity, position);
-        }
+    int index = 0;
+    if (position.x > center.x) index |= 1;
+    if (position.y > center.y) index |= 2;
+    if (position.z > center.z) index |= 4;
+
+    return index;
+}
+
+BoundingBox FlatOctree::childBounds(const BoundingBox& bounds, int childIndex) {
+    glm::vec3 center = bounds.getCenter();
+
+    glm::vec3 childMin = bounds.min;
+    glm::vec3 childMax = center;
+
+    if (childIndex & 1) { // x bit
+        childMin.x = center.x;
+        childMax.x = bounds.max.x;
+    }
+    if (childIndex & 2) { // y bit
+        childMin.y = center.y;
+        childMax.y = bounds.max.y;
+    }
+    if (childIndex & 4) { // z bit
+        childMin.z = center.z;
+        childMax.z = bounds.max.z;
     }
+
+    return BoundingBox(childMin, childMax);
 }
 
-void OctreeNode::remove(EntityID entity, const glm::vec3& position) {
-    if (!bounds_.contains(position)) {
-        return;
+int32_t FlatOctree::findLeaf(const glm::vec3& position) const {
+    int32_t current = 0;
+    while (!nodes_[current].isLeaf()) {
+        current = nodes_[current].firstChild + getChildIndex(nodes_[current], position);
     }
+    return current;
+}
 
-    if (is_leaf_) {
-        auto it = std::find(entities_.begin(), entities_.end(), entity);
-        if (it != entities_.end()) {
-            entities_.erase(it);
-        }
-    } else {
-        int childIndex = getChildIndex(position);
-        if (children_[childIndex]) {
-            children_[childIndex]->remove(entity, position);
-        }
+int32_t FlatOctree::allocEntry(EntityID entity, const glm::vec3& position, uint32_t layers) {
+    if (freeEntry_ != NO_ENTRY) {
+        int32_t index = freeEntry_;
+        freeEntry_ = entries_[index].next;
+        entries_[index] = EntityEntry{entity, position, layers, NO_ENTRY};
+        return index;
     }
+    entries_.push_back(EntityEntry{entity, position, layers, NO_ENTRY});
+    return static_cast<int32_t>(entries_.size() - 1);
 }
 
-void OctreeNode::update(EntityID entity, const glm::vec3& oldPos, const glm::vec3& newPos) {
-    // If both positions are in this node, handle the update internally
-    bool oldInBounds = bounds_.contains(oldPos);
-    bool newInBounds = bounds_.contains(newPos);
+void FlatOctree::pushEntity(int32_t nodeIndex, EntityID entity, const glm::vec3& position, uint32_t layers) {
+    int32_t entryIndex = allocEntry(entity, position, layers);
+    entries_[entryIndex].next = nodes_[nodeIndex].firstEntry;
+    nodes_[nodeIndex].firstEntry = entryIndex;
+    nodes_[nodeIndex].entityCount++;
+}
 
-    if (oldInBounds && !newInBounds) {
-        remove(entity, oldPos);
-    } else if (!oldInBounds && newInBounds) {
-        insert(entity, newPos);
-    } else if (oldInBounds && newInBounds) {
-        // Both positions in bounds - update children if not leaf
-        if (!is_leaf_) {
-            int oldChildIndex = getChildIndex(oldPos);
-            int newChildIndex = getChildIndex(newPos);
-
-            if (oldChildIndex != newChildIndex) {
-                if (children_[oldChildIndex]) {
-                    children_[oldChildIndex]->remove(entity, oldPos);
-                }
-                if (children_[newChildIndex]) {
-                    children_[newChildIndex]->insert(entity, newPos);
-                }
-            } else {
-                if (children_[oldChildIndex]) {
-                    children_[oldChildIndex]->update(entity, oldPos, newPos);
-                }
-            }
-        } else {
-            // LEAF NODE CASE: Entity is moving within the same leaf node
-            // The entity is already in this leaf's entities_ list, so no action needed
-            // Position tracking is handled by SpatialManager::updateEntity
-        }
+void FlatOctree::splitLeaf(int32_t nodeIndex) {
+    // Allocate 8 consecutive children (copy bounds/depth first - the
+    // push_back below may reallocate the node vector)
+    BoundingBox bounds = nodes_[nodeIndex].bounds;
+    uint8_t childDepth = static_cast<uint8_t>(nodes_[nodeIndex].depth + 1);
+    int32_t firstChild = static_cast<int32_t>(nodes_.size());
+
+    for (int i = 0; i < 8; ++i) {
+        Node child;
+        child.bounds = childBounds(bounds, i);
+        child.depth = childDepth;
+        nodes_.push_back(child);
+    }
+
+    Node& node = nodes_[nodeIndex];
+    node.firstChild = firstChild;
+
+    // Relink this node's entries into the appropriate children
+    int32_t entry = node.firstEntry;
+    node.firstEntry = NO_ENTRY;
+    node.entityCount = 0;
+
+    while (entry != NO_ENTRY) {
+        int32_t next = entries_[entry].next;
+        int32_t childIndex = firstChild + getChildIndex(nodes_[nodeIndex], entries_[entry].position);
+        entries_[entry].next = nodes_[childIndex].firstEntry;
+        nodes_[childIndex].firstEntry = entry;
+        nodes_[childIndex].entityCount++;
+        nodes_[childIndex].layerMask |= entries_[entry].layers;
+        entry = next;
     }
 }
 
-void OctreeNode::query(const BoundingBox& region, std::vector<EntityID>& results) const {
-    if (!bounds_.intersects(region)) {
-        return;
+void FlatOctree::insert(EntityID entity, const glm::vec3& position, uint32_t layers) {
+    if (!nodes_[0].bounds.contains(position)) {
+        return; // Position is outside the tree bounds
     }
 
-    if (is_leaf_) {
-        // Only add entities that need further filtering - let SpatialManager handle position checks
-        results.insert(results.end(), entities_.begin(), entities_.end());
-    } else {
-        for (int i = 0; i < 8; ++i) {
-            if (children_[i]) {
-                children_[i]->query(region, results);
-            }
-        }
+    // Descend to the leaf, OR-ing the entity's layers into every node
+    // on the path so queries can prune non-matching subtrees
+    int32_t leaf = 0;
+    nodes_[0].layerMask |= layers;
+    while (!nodes_[leaf].isLeaf()) {
+        leaf = nodes_[leaf].firstChild + getChildIndex(nodes_[leaf], position);
+        nodes_[leaf].layerMask |= layers;
+    }
+
+    pushEntity(leaf, entity, position, layers);
+    entityCount_++;
+
+    if (nodes_[leaf].entityCount > MAX_ENTITIES_PER_NODE && nodes_[leaf].depth < MAX_DEPTH) {
+        splitLeaf(leaf);
     }
 }
 
-void OctreeNode::query(const Frustum& frustum, std::vector<EntityID>& results) const {
-    if (!frustum.intersects(bounds_)) {
+void FlatOctree::remove(EntityID entity, const glm::vec3& position) {
+    if (!nodes_[0].bounds.contains(position)) {
         return;
     }
 
-    if (is_leaf_) {
-        results.insert(results.end(), entities_.begin(), entities_.end());
-    } else {
-        for (int i = 0; i < 8; ++i) {
-            if (children_[i]) {
-                children_[i]->query(frustum, results);
-            }
+    int32_t leaf = findLeaf(position);
+    int32_t* link = &nodes_[leaf].firstEntry;
+    while (*link != NO_ENTRY) {
+        int32_t entry = *link;
+        if (entries_[entry].entity == entity) {
+            *link = entries_[entry].next;
+            entries_[entry].next = freeEntry_;
+            freeEntry_ = entry;
+            nodes_[leaf].entityCount--;
+            entityCount_--;
+            return;
         }
+        link = &entries_[entry].next;
     }
 }
 
-void OctreeNode::queryRadius(const glm::vec3& center, float radius, std::vector<EntityID>& results) const {
-    // Create bounding box for sphere
-    BoundingBox sphereBounds(center, radius);
+void FlatOctree::update(EntityID entity, const glm::vec3& oldPos, const glm::vec3& newPos, uint32_t layers) {
+    bool oldInBounds = nodes_[0].bounds.contains(oldPos);
+    bool newInBounds = nodes_[0].bounds.contains(newPos);
 
-    if (!bounds_.intersects(sphereBounds)) {
+    if (oldInBounds && !newInBounds) {
+        remove(entity, oldPos);
+        return;
+    }
+    if (!oldInBounds && newInBounds) {
+        insert(entity, newPos, layers);
+        return;
+    }
+    if (!oldInBounds && !newInBounds) {
         return;
     }
 
-    if (is_leaf_) {
-        results.insert(results.end(), entities_.begin(), entities_.end());
-    } else {
-        for (int i = 0; i < 8; ++i) {
-            if (children_[i]) {
-                children_[i]->queryRadius(center, radius, results);
+    int32_t oldLeaf = findLeaf(oldPos);
+    int32_t newLeaf = findLeaf(newPos);
+    if (oldLeaf == newLeaf) {
+        // Same leaf - just refresh the stored position
+        for (int32_t entry = nodes_[oldLeaf].firstEntry; entry != NO_ENTRY; entry = entries_[entry].next) {
+            if (entries_[entry].entity == entity) {
+                entries_[entry].position = newPos;
+                return;
             }
         }
+        return;
     }
+
+    remove(entity, oldPos);
+    insert(entity, newPos, layers);
 }
 
-void OctreeNode::clear() {
-    entities_.clear();
-    for (int i = 0; i < 8; ++i) {
-        children_[i].reset();
+void FlatOctree::setEntityLayers(EntityID entity, const glm::vec3& position, uint32_t layers) {
+    if (!nodes_[0].bounds.contains(position)) {
+        return;
     }
-    is_leaf_ = true;
-}
 
-size_t OctreeNode::getEntityCount() const {
-    size_t count = entities_.size();
-    if (!is_leaf_) {
-        for (int i = 0; i < 8; ++i) {
-            if (children_[i]) {
-                count += children_[i]->getEntityCount();
-            }
+    // Refresh the stored entry and OR the new layers along the path;
+    // bits from the old layers stay in the node masks as a stale
+    // superset until a rebuild
+    int32_t leaf = 0;
+    nodes_[0].layerMask |= layers;
+    while (!nodes_[leaf].isLeaf()) {
+        leaf = nodes_[leaf].firstChild + getChildIndex(nodes_[leaf], position);
+        nodes_[leaf].layerMask |= layers;
+    }
+
+    for (int32_t entry = nodes_[leaf].firstEntry; entry != NO_ENTRY; entry = entries_[entry].next) {
+        if (entries_[entry].entity == entity) {
+            entries_[entry].layers = layers;
+            return;
         }
     }
-    return count;
 }
 
-void OctreeNode::getStatistics(int& nodeCount, int& maxDepth, int& totalEntities) const {
-    nodeCount++;
-    maxDepth = std::max(maxDepth, depth_);
-    totalEntities += static_cast<int>(entities_.size());
+void FlatOctree::appendNodeEntities(const Node& node, std::vector<EntityID>& results) const {
+    for (int32_t entry = node.firstEntry; entry != NO_ENTRY; entry = entries_[entry].next) {
+        results.push_back(entries_[entry].entity);
+    }
+}
+
+void FlatOctree::query(const BoundingBox& region, std::vector<EntityID>& results, uint32_t layerMask) const {
+    // Iterative DFS over node indices; depth is bounded so a fixed stack
+    // is sufficient (up to 7 siblings pushed per level plus the root)
+    int32_t stack[8 * MAX_DEPTH + 8];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const Node& node = nodes_[stack[--top]];
+        if (!node.bounds.intersects(region) || subtreePrunable(node, layerMask)) {
+            continue;
+        }
 
-    if (!is_leaf_) {
-        for (int i = 0; i < 8; ++i) {
-            if (children_[i]) {
-                children_[i]->getStatistics(nodeCount, maxDepth, totalEntities);
+        if (node.isLeaf()) {
+            appendNodeEntities(node, results);
+        } else {
+            for (int i = 0; i < 8; ++i) {
+                stack[top++] = node.firstChild + i;
             }
         }
     }
 }
 
-void OctreeNode::subdivide(std::function<glm::vec3(EntityID)> getPosition) {
-    if (depth_ >= MAX_DEPTH) {
-        return; // Max depth reached
+void FlatOctree::query(const Frustum& frustum, std::vector<EntityID>& results, uint32_t layerMask) const {
+    // Planes in the flat layout the batched culling kernel expects
+    float planes[6][4];
+    for (int p = 0; p < 6; ++p) {
+        planes[p][0] = frustum.planes[p].x;
+        planes[p][1] = frustum.planes[p].y;
+        planes[p][2] = frustum.planes[p].z;
+        planes[p][3] = frustum.planes[p].w;
     }
 
-    is_leaf_ = false;
-
-    // Create child nodes
-    for (int i = 0; i < 8; ++i) {
-        BoundingBox childBounds = getChildBounds(i);
-        children_[i] = std::make_unique<OctreeNode>(childBounds, depth_ + 1);
+    if (!frustum.intersects(nodes_[0].bounds) || subtreePrunable(nodes_[0], layerMask)) {
+        return;
     }
 
-    // Redistribute entities to children using position lookup with exception safety
-    std::vector<EntityID> entitiesToRedistribute = std::move(entities_);
-    entities_.clear();
+    // Stack holds nodes already known to intersect the frustum; children
+    // are tested eight at a time through the SIMD kernel before pushing
+    int32_t stack[8 * MAX_DEPTH + 8];
+    int top = 0;
+    stack[top++] = 0;
 
-    // Process entities with exception handling to prevent entity loss
-    for (size_t i = 0; i < entitiesToRedistribute.size(); ++i) {
-        EntityID entity = entitiesToRedistribute[i];
+    while (top > 0) {
+        const Node& node = nodes_[stack[--top]];
 
-        try {
-            glm::vec3 position = getPosition(entity);
-            int childIndex = getChildIndex(position);
-            if (children_[childIndex]) {
-                children_[childIndex]->insert(entity, position);
-            }
-        } catch (...) {
-            // If getPosition throws, restore all remaining entities to prevent loss
-            // This includes the current entity and all subsequent ones
-            for (size_t j = i; j < entitiesToRedistribute.size(); ++j) {
-                entities_.push_back(entitiesToRedistribute[j]);
-            }
+        if (node.isLeaf()) {
+            appendNodeEntities(node, results);
+            continue;
+        }
 
-            // Restore to leaf state since subdivision failed
-            is_leaf_ = true;
+        float minX[8], minY[8], minZ[8], maxX[8], maxY[8], maxZ[8];
+        uint8_t visible[8];
+        for (int i = 0; i < 8; ++i) {
+            const BoundingBox& bounds = nodes_[node.firstChild + i].bounds;
+            minX[i] = bounds.min.x;
+            minY[i] = bounds.min.y;
+            minZ[i] = bounds.min.z;
+            maxX[i] = bounds.max.x;
+            maxY[i] = bounds.max.y;
+            maxZ[i] = bounds.max.z;
+        }
 
-            // Clean up child nodes since subdivision is incomplete
-            for (int k = 0; k < 8; ++k) {
-                children_[k].reset();
-            }
+        SimdCulling::cullAABBs(planes, minX, minY, minZ, maxX, maxY, maxZ, 8, visible);
 
-            // Re-throw the exception to notify caller
-            throw;
+        for (int i = 0; i < 8; ++i) {
+            if (visible[i] && !subtreePrunable(nodes_[node.firstChild + i], layerMask)) {
+                stack[top++] = node.firstChild + i;
+            }
         }
     }
 }
 
-int OctreeNode::getChildIndex(const glm::vec3& position) const {
-    glm::vec3 center = bounds_.getCenter();
-
-    int index = 0;
-    if (position.x > center.x) index |= 1;
-    if (position.y > center.y) index |= 2;
-    if (position.z > center.z) index |= 4;
-
-    return index;
+void FlatOctree::queryRadius(const glm::vec3& center, float radius, std::vector<EntityID>& results, uint32_t layerMask) const {
+    // Conservative sphere-as-box test, matching the old behavior:
+    // SpatialManager distance-filters the candidates afterwards
+    BoundingBox sphereBounds(center, radius);
+    query(sphereBounds, results, layerMask);
 }
 
-BoundingBox OctreeNode::getChildBounds(int childIndex) const {
-    glm::vec3 center = bounds_.getCenter();
-    glm::vec3 size = bounds_.getSize() * 0.5f;
+void FlatOctree::growToInclude(const glm::vec3& position) {
+    // Runaway guard: each step doubles every axis, so 32 steps cover any
+    // finite position; non-finite positions would otherwise loop forever
+    constexpr int MAX_GROWTH_STEPS = 32;
+    int steps = 0;
 
-    glm::vec3 childMin = bounds_.min;
-    glm::vec3 childMax = center;
+    while (!nodes_[0].bounds.contains(position)) {
+        if (++steps > MAX_GROWTH_STEPS) {
+            VKMON_WARNING("FlatOctree::growToInclude gave up - position is not reachable by doubling (non-finite?)");
+            return;
+        }
 
-    if (childIndex & 1) { // x bit
-        childMin.x = center.x;
-        childMax.x = bounds_.max.x;
-    }
-    if (childIndex & 2) { // y bit
-        childMin.y = center.y;
-        childMax.y = bounds_.max.y;
-    }
-    if (childIndex & 4) { // z bit
-        childMin.z = center.z;
-        childMax.z = bounds_.max.z;
+        // Double toward the out-of-bounds side on each axis; the old
+        // root becomes the octant on the opposite side
+        BoundingBox oldBounds = nodes_[0].bounds;
+        glm::vec3 size = oldBounds.getSize();
+        glm::vec3 newMin = oldBounds.min;
+        glm::vec3 newMax = oldBounds.max;
+        int oldRootOctant = 0;
+        if (position.x < oldBounds.min.x) { newMin.x -= size.x; oldRootOctant |= 1; }
+        else                              { newMax.x += size.x; }
+        if (position.y < oldBounds.min.y) { newMin.y -= size.y; oldRootOctant |= 2; }
+        else                              { newMax.y += size.y; }
+        if (position.z < oldBounds.min.z) { newMin.z -= size.z; oldRootOctant |= 4; }
+        else                              { newMax.z += size.z; }
+        BoundingBox newBounds(newMin, newMax);
+
+        // Wrap: append 8 children for the doubled root, with the old
+        // root node copied into its octant slot; its firstChild /
+        // firstEntry indices are absolute and stay valid
+        Node oldRoot = nodes_[0];
+        oldRoot.depth = 1;
+        int32_t firstChild = static_cast<int32_t>(nodes_.size());
+        for (int i = 0; i < 8; ++i) {
+            if (i == oldRootOctant) {
+                nodes_.push_back(oldRoot);
+            } else {
+                Node child;
+                child.bounds = childBounds(newBounds, i);
+                child.depth = 1;
+                nodes_.push_back(child);
+            }
+        }
+
+        Node& root = nodes_[0];
+        root.bounds = newBounds;
+        root.firstChild = firstChild;
+        root.firstEntry = NO_ENTRY;
+        root.entityCount = 0;
+        root.depth = 0;
+        // root.layerMask already holds the OR of the wrapped subtree
     }
+}
 
-    return BoundingBox(childMin, childMax);
+void FlatOctree::clear() {
+    BoundingBox bounds = nodes_[0].bounds;
+    nodes_.clear();
+    entries_.clear();
+    freeEntry_ = NO_ENTRY;
+    entityCount_ = 0;
+
+    Node root;
+    root.bounds = bounds;
+    nodes_.push_back(root);
 }
 
-bool OctreeNode::shouldSubdivide() const {
-    return is_leaf_ &&
-           entities_.size() > MAX_ENTITIES_PER_NODE &&
-           depth_ < MAX_DEPTH;
+void FlatOctree::getStatistics(int& nodeCount, int& maxDepth, int& totalEntities) const {
+    nodeCount += static_cast<int>(nodes_.size());
+    totalEntities += static_cast<int>(entityCount_);
+    for (const Node& node : nodes_) {
+        maxDepth = std::max(maxDepth, static_cast<int>(node.depth));
+    }
 }
 
 // SpatialManager implementation
 SpatialManager::SpatialManager(const BoundingBox& worldBounds)
     : worldBounds_(worldBounds) {
-    octree_ = std::make_unique<OctreeNode>(worldBounds);
+    staticOctree_ = std::make_unique<FlatOctree>(worldBounds);
+    dynamicOctree_ = std::make_unique<FlatOctree>(worldBounds);
     queryCache_ = std::make_unique<PredictiveSpatialCache>();
     VKMON_INFO("SpatialManager initialized with world bounds");
 }
 
-void SpatialManager::addEntity(EntityID entity, const glm::vec3& position, uint32_t layers) {
+SpatialManager::SpatialManager(const WorldConfig& config)
+    : backend_(config.spatialBackend), worldBounds_(config.getBoundingBox()) {
+    if (backend_ == SpatialBackendType::MortonGrid) {
+        staticGrid_ = std::make_unique<MortonGrid>(worldBounds_);
+        dynamicGrid_ = std::make_unique<MortonGrid>(worldBounds_);
+        VKMON_INFO("SpatialManager initialized with Morton grid backend for world '" + config.name + "'");
+    } else {
+        staticOctree_ = std::make_unique<FlatOctree>(worldBounds_);
+        dynamicOctree_ = std::make_unique<FlatOctree>(worldBounds_);
+        VKMON_INFO("SpatialManager initialized with octree backend for world '" + config.name + "'");
+    }
+    queryCache_ = std::make_unique<PredictiveSpatialCache>();
+}
+
+void SpatialManager::ensureWorldContains(const glm::vec3& position) {
+    if (worldBounds_.contains(position)) {
+        return;
+    }
+
+    // Grow both tiers with the same doubling rule so they agree on the
+    // new bounds; growth never moves entities, so cached query results
+    // stay valid
+    forEachTier([&](auto& tier) { tier.growToInclude(position); });
+    if (backend_ == SpatialBackendType::MortonGrid) {
+        worldBounds_ = dynamicGrid_->getBounds();
+    } else {
+        worldBounds_ = dynamicOctree_->getBounds();
+    }
+
+    if (worldBounds_.contains(position)) {
+        VKMON_INFO("Spatial world bounds grown to (" +
+                   std::to_string(worldBounds_.min.x) + "," + std::to_string(worldBounds_.min.y) + "," +
+                   std::to_string(worldBounds_.min.z) + ") - (" +
+                   std::to_string(worldBounds_.max.x) + "," + std::to_string(worldBounds_.max.y) + "," +
+                   std::to_string(worldBounds_.max.z) + ")");
+    } else {
+        VKMON_WARNING("Spatial world bounds could not grow to contain entity position");
+    }
+}
+
+void SpatialManager::addEntity(EntityID entity, const glm::vec3& position, uint32_t layers, bool isStatic) {
+    ensureWorldContains(position);
+
     auto it = entityPositions_.find(entity);
     if (it != entityPositions_.end()) {
         VKMON_WARNING("Entity already exists in spatial manager, updating position");
@@ -360,28 +525,17 @@ void SpatialManager::addEntity(EntityID entity, const glm::vec3& position, uint3
     }
 
     entityPositions_[entity] = position;
+    octreePositions_[entity] = position;
     entityLayers_[entity] = layers;
-    octree_->insert(entity, position);
-
-    // POKEMON PERFORMANCE: Check if subdivision is needed after insertion
-    // This is critical for handling hundreds of creatures efficiently
-    if (needsSubdivision()) {
-        // Create position lookup lambda for subdivision
-        auto getEntityPosition = [this](EntityID entityId) -> glm::vec3 {
-            auto it = entityPositions_.find(entityId);
-            if (it != entityPositions_.end()) {
-                return it->second;
-            }
-            throw std::runtime_error("Entity position not found during subdivision");
-        };
-
-        try {
-            octree_->subdivide(getEntityPosition);
-        } catch (const std::exception& e) {
-            VKMON_WARNING("Octree subdivision failed - continuing with single node");
-            // Subdivision failure is handled gracefully by the octree itself
-        }
+
+    if (isStatic) {
+        staticEntities_.insert(entity);
+        withStaticTier([&](auto& tier) { tier.insert(entity, position, layers); });
+    } else {
+        withDynamicTier([&](auto& tier) { tier.insert(entity, position, layers); });
     }
+
+    notePersistentEntityChanged(entity);
 }
 
 void SpatialManager::removeEntity(EntityID entity) {
@@ -393,17 +547,31 @@ void SpatialManager::removeEntity(EntityID entity) {
 
     glm::vec3 position = it->second;
 
-    octree_->remove(entity, position);
+    // Remove at the position the octree last saw, which may lag the
+    // true position while a move is still queued
+    glm::vec3 committedPosition = octreePositions_.count(entity) ? octreePositions_[entity] : position;
+
+    if (staticEntities_.erase(entity) > 0) {
+        withStaticTier([&](auto& tier) { tier.remove(entity, committedPosition); });
+    } else {
+        withDynamicTier([&](auto& tier) { tier.remove(entity, committedPosition); });
+    }
     entityPositions_.erase(it);
+    octreePositions_.erase(entity);
+    pendingMoves_.erase(entity);
     entityLayers_.erase(entity);
 
     // CACHE INVALIDATION: Invalidate any cached queries that might contain this entity
     // Use a reasonable radius to invalidate queries around the removed entity's position
     float influenceRadius = 20.0f; // Generous radius to ensure all relevant queries are invalidated
     queryCache_->invalidateEntityMovement(position, position, influenceRadius);
+
+    notePersistentEntityRemoved(entity);
 }
 
 void SpatialManager::updateEntity(EntityID entity, const glm::vec3& newPosition) {
+    ensureWorldContains(newPosition);
+
     auto it = entityPositions_.find(entity);
     if (it == entityPositions_.end()) {
         VKMON_WARNING("Attempted to update entity that doesn't exist in spatial manager");
@@ -414,7 +582,27 @@ void SpatialManager::updateEntity(EntityID entity, const glm::vec3& newPosition)
     glm::vec3 oldPosition = it->second;
     it->second = newPosition;
 
-    octree_->update(entity, oldPosition, newPosition);
+    if (staticEntities_.count(entity) > 0) {
+        // A "static" entity moved: demote it to the dynamic tree rather
+        // than churning the static structure. Demotion is rare, so it
+        // commits immediately instead of going through the queue.
+        VKMON_WARNING("Static entity moved - demoting to dynamic spatial tier");
+        staticEntities_.erase(entity);
+        glm::vec3 committed = octreePositions_.count(entity) ? octreePositions_[entity] : oldPosition;
+        withStaticTier([&](auto& tier) { tier.remove(entity, committed); });
+        withDynamicTier([&](auto& tier) { tier.insert(entity, newPosition, entityLayers_[entity]); });
+        octreePositions_[entity] = newPosition;
+        pendingMoves_.erase(entity);
+    } else {
+        // Queue the reinsertion (coalescing repeated moves of the same
+        // entity) and track the largest gap between true and committed
+        // positions so queries can expand their search volume by it
+        pendingMoves_[entity] = newPosition;
+        auto committed = octreePositions_.find(entity);
+        if (committed != octreePositions_.end()) {
+            maxPendingDrift_ = std::max(maxPendingDrift_, glm::distance(committed->second, newPosition));
+        }
+    }
 
     // REGIONAL CACHE INVALIDATION: Only invalidate cache entries affected by movement
     // This replaces the nuclear "clear everything" approach with targeted invalidation
@@ -424,6 +612,64 @@ void SpatialManager::updateEntity(EntityID entity, const glm::vec3& newPosition)
         float influenceRadius = 10.0f; // Pokemon interaction/detection radius
         queryCache_->invalidateEntityMovement(oldPosition, newPosition, influenceRadius);
     }
+
+    notePersistentEntityChanged(entity);
+}
+
+void SpatialManager::rebuildStaticOctree() {
+    if (backend_ == SpatialBackendType::MortonGrid) {
+        staticGrid_ = std::make_unique<MortonGrid>(worldBounds_);
+    } else {
+        staticOctree_ = std::make_unique<FlatOctree>(worldBounds_);
+    }
+    withStaticTier([&](auto& tier) {
+        for (EntityID entity : staticEntities_) {
+            auto it = entityPositions_.find(entity);
+            if (it != entityPositions_.end()) {
+                tier.insert(entity, it->second, entityLayers_.count(entity) ? entityLayers_[entity] : LayerMask::None);
+            }
+        }
+    });
+    VKMON_INFO("Static spatial tier rebuilt with " + std::to_string(staticEntities_.size()) + " entities");
+}
+
+void SpatialManager::processPendingUpdates(float budgetMs) {
+    if (pendingMoves_.empty()) {
+        return;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    constexpr int CLOCK_CHECK_INTERVAL = 8; // commits between clock reads
+    int sinceClockCheck = 0;
+
+    auto it = pendingMoves_.begin();
+    while (it != pendingMoves_.end()) {
+        EntityID entity = it->first;
+        glm::vec3 target = it->second;
+        glm::vec3 committed = octreePositions_.count(entity) ? octreePositions_[entity] : target;
+
+        uint32_t layers = entityLayers_.count(entity) ? entityLayers_[entity] : LayerMask::None;
+        withDynamicTier([&](auto& tier) { tier.update(entity, committed, target, layers); });
+        octreePositions_[entity] = target;
+        it = pendingMoves_.erase(it);
+
+        if (budgetMs >= 0.0f && ++sinceClockCheck >= CLOCK_CHECK_INTERVAL) {
+            sinceClockCheck = 0;
+            auto now = std::chrono::high_resolution_clock::now();
+            if (std::chrono::duration<float, std::milli>(now - start).count() >= budgetMs) {
+                break;
+            }
+        }
+    }
+
+    // Recompute the drift bound over whatever is still queued
+    maxPendingDrift_ = 0.0f;
+    for (const auto& [entity, target] : pendingMoves_) {
+        auto committed = octreePositions_.find(entity);
+        if (committed != octreePositions_.end()) {
+            maxPendingDrift_ = std::max(maxPendingDrift_, glm::distance(committed->second, target));
+        }
+    }
 }
 
 void SpatialManager::updateEntityLayers(EntityID entity, uint32_t layers) {
@@ -434,31 +680,59 @@ void SpatialManager::updateEntityLayers(EntityID entity, uint32_t layers) {
     }
 
     entityLayers_[entity] = layers;
+
+    // Propagate into the octree so node masks pick up any new bits
+    // (old bits linger as a stale superset until a rebuild)
+    glm::vec3 committedPosition = octreePositions_.count(entity) ? octreePositions_[entity] : it->second;
+    if (staticEntities_.count(entity) > 0) {
+        withStaticTier([&](auto& tier) { tier.setEntityLayers(entity, committedPosition, layers); });
+    } else {
+        withDynamicTier([&](auto& tier) { tier.setEntityLayers(entity, committedPosition, layers); });
+    }
+
+    // Layer changes can flip persistent query membership too
+    notePersistentEntityChanged(entity);
 }
 
 std::vector<EntityID> SpatialManager::queryRegion(const BoundingBox& region, uint32_t layerMask) const {
+    std::vector<EntityID> results;
+    queryRegion(region, layerMask, results);
+    return results;
+}
+
+void SpatialManager::queryRegion(const BoundingBox& region, uint32_t layerMask, std::vector<EntityID>& results) const {
     auto start = std::chrono::high_resolution_clock::now();
 
-    std::vector<EntityID> results;
-    octree_->query(region, results);
+    // Collect candidates directly into the caller's buffer, then filter
+    // in place - no temporary vectors
+    // Expand the octree search by the largest queued movement so an
+    // entity whose reinsertion is still pending cannot be missed; the
+    // exact filter below still uses the caller's region
+    BoundingBox searchRegion = region;
+    if (maxPendingDrift_ > 0.0f) {
+        searchRegion.min -= glm::vec3(maxPendingDrift_);
+        searchRegion.max += glm::vec3(maxPendingDrift_);
+    }
 
-    // Apply position and layer filtering
-    std::vector<EntityID> filteredResults;
-    for (EntityID entity : results) {
+    size_t startIndex = results.size();
+    forEachTier([&](const auto& tier) { tier.query(searchRegion, results, layerMask); });
+
+    size_t write = startIndex;
+    for (size_t read = startIndex; read < results.size(); ++read) {
+        EntityID entity = results[read];
         auto it = entityPositions_.find(entity);
         if (it != entityPositions_.end()) {
             // Check if entity position is actually within the region
             if (region.contains(it->second) && passesLayerFilter(entity, layerMask)) {
-                filteredResults.push_back(entity);
+                results[write++] = entity;
             }
         }
     }
+    results.resize(write);
 
     auto end = std::chrono::high_resolution_clock::now();
     float queryTime = std::chrono::duration<float, std::milli>(end - start).count();
-    updateStatistics(queryTime, filteredResults.size());
-
-    return filteredResults;
+    updateStatistics(queryTime, write - startIndex);
 }
 
 std::vector<EntityID> SpatialManager::queryFrustum(const Frustum& frustum, uint32_t layerMask) const {
@@ -474,25 +748,43 @@ std::vector<EntityID> SpatialManager::queryFrustum(const Frustum& frustum, uint3
         return results;
     }
 
-    // Cache miss - perform octree query
-    octree_->query(frustum, results);
+    // Cache miss - perform octree query into the result buffer
+    queryFrustum(frustum, layerMask, results);
 
-    // Apply layer filtering
-    std::vector<EntityID> filteredResults;
-    for (EntityID entity : results) {
-        if (passesLayerFilter(entity, layerMask)) {
-            filteredResults.push_back(entity);
+    // Cache the result for future queries
+    queryCache_->cacheFrustumQuery(frustum, layerMask, results);
+
+    return results;
+}
+
+void SpatialManager::queryFrustum(const Frustum& frustum, uint32_t layerMask, std::vector<EntityID>& results) const {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    size_t startIndex = results.size();
+    if (maxPendingDrift_ > 0.0f) {
+        // Push every plane outward by the drift bound (planes are
+        // normalized) so entities with a queued move stay visible
+        Frustum expanded = frustum;
+        for (int i = 0; i < 6; ++i) {
+            expanded.planes[i].w += maxPendingDrift_;
         }
+        forEachTier([&](const auto& tier) { tier.query(expanded, results, layerMask); });
+    } else {
+        forEachTier([&](const auto& tier) { tier.query(frustum, results, layerMask); });
     }
 
-    // Cache the result for future queries
-    queryCache_->cacheFrustumQuery(frustum, layerMask, filteredResults);
+    // Apply layer filtering in place
+    size_t write = startIndex;
+    for (size_t read = startIndex; read < results.size(); ++read) {
+        if (passesLayerFilter(results[read], layerMask)) {
+            results[write++] = results[read];
+        }
+    }
+    results.resize(write);
 
     auto end = std::chrono::high_resolution_clock::now();
     float queryTime = std::chrono::duration<float, std::milli>(end - start).count();
-    updateStatistics(queryTime, filteredResults.size());
-
-    return filteredResults;
+    updateStatistics(queryTime, write - startIndex);
 }
 
 std::vector<EntityID> SpatialManager::queryRadius(const glm::vec3& center, float radius, uint32_t layerMask) const {
@@ -508,29 +800,71 @@ std::vector<EntityID> SpatialManager::queryRadius(const glm::vec3& center, float
         return results;
     }
 
-    // Cache miss - perform octree query
-    octree_->queryRadius(center, radius, results);
+    // Cache miss - perform octree query into the result buffer
+    queryRadius(center, radius, layerMask, results);
+
+    // Cache the result for future queries
+    queryCache_->cacheRadiusQuery(center, radius, layerMask, results);
 
-    // Filter results by actual distance and layers (octree query returns candidates)
-    std::vector<EntityID> filteredResults;
-    for (EntityID entity : results) {
+    return results;
+}
+
+void SpatialManager::queryRadius(const glm::vec3& center, float radius, uint32_t layerMask, std::vector<EntityID>& results) const {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // Candidate gathering expands by the pending-move drift bound; the
+    // distance filter below uses true positions and the caller's radius
+    size_t startIndex = results.size();
+    forEachTier([&](const auto& tier) { tier.queryRadius(center, radius + maxPendingDrift_, results, layerMask); });
+
+    // Filter candidates by actual distance and layers in place
+    size_t write = startIndex;
+    for (size_t read = startIndex; read < results.size(); ++read) {
+        EntityID entity = results[read];
         auto it = entityPositions_.find(entity);
         if (it != entityPositions_.end()) {
             float distance = glm::distance(center, it->second);
             if (distance <= radius && passesLayerFilter(entity, layerMask)) {
-                filteredResults.push_back(entity);
+                results[write++] = entity;
             }
         }
     }
-
-    // Cache the result for future queries
-    queryCache_->cacheRadiusQuery(center, radius, layerMask, filteredResults);
+    results.resize(write);
 
     auto end = std::chrono::high_resolution_clock::now();
     float queryTime = std::chrono::duration<float, std::milli>(end - start).count();
-    updateStatistics(queryTime, filteredResults.size());
+    updateStatistics(queryTime, write - startIndex);
+}
 
-    return filteredResults;
+size_t SpatialManager::queryRadiusCount(const glm::vec3& center, float radius, uint32_t layerMask,
+                                        size_t maxCount) const {
+    if (maxCount == 0) {
+        return 0;
+    }
+
+    // Octree entries carry their position, so counting needs no hash
+    // lookups and no result storage; traversal stops as soon as
+    // maxCount matches have been seen
+    // Count tolerates positions up to one queued move stale; the search
+    // volume is expanded by the drift bound so nothing is skipped
+    BoundingBox sphereBounds(center, radius + maxPendingDrift_);
+    size_t count = 0;
+    auto visitor = [&](EntityID entity, const glm::vec3& position) {
+        if (glm::distance(center, position) <= radius && passesLayerFilter(entity, layerMask)) {
+            if (++count >= maxCount) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    bool keepGoing = true;
+    forEachTier([&](const auto& tier) {
+        if (keepGoing) {
+            keepGoing = tier.visit(sphereBounds, visitor, layerMask);
+        }
+    });
+    return count;
 }
 
 // PERFORMANCE OPTIMIZATION: Batched radius queries for massive creature counts
@@ -541,36 +875,90 @@ std::vector<SpatialManager::BatchedQueryResult> SpatialManager::queryRadiusBatch
 
     auto start = std::chrono::high_resolution_clock::now();
 
-    std::vector<BatchedQueryResult> results;
-    results.reserve(queries.size());
-
-    // LOCK-FREE OPTIMIZATION: Direct octree queries without cache overhead
-    size_t totalEntitiesReturned = 0;
-
-    for (const auto& query : queries) {
-        BatchedQueryResult result;
-        result.sourceEntity = query.sourceEntity;
-
-        // Perform octree query directly
-        std::vector<EntityID> octreeResults;
-        octree_->queryRadius(query.center, query.radius, octreeResults);
-
-        // Filter results by actual distance and layers
-        for (EntityID entity : octreeResults) {
-            // Skip self-queries
-            if (entity == query.sourceEntity) continue;
+    // Pre-sized result slots: each worker writes only its own range, so
+    // the fan-out needs no synchronization on the result container
+    std::vector<BatchedQueryResult> results(queries.size());
+
+    // CACHE PRE-PASS (main thread - the predictive cache is not
+    // thread-safe): batches arrive with throttled, repeating centers
+    // (creature detection re-queries the same spot every interval), so
+    // hits here skip the octree entirely. Cached entries keep the source
+    // entity because the same center can be queried by different sources.
+    SmallVector<size_t, 64> missIndices; // inline for a full 64-query batch
+    std::vector<EntityID> cachedEntities;
+
+    for (size_t i = 0; i < queries.size(); ++i) {
+        const BatchedRadiusQuery& query = queries[i];
+        results[i].sourceEntity = query.sourceEntity;
+
+        cachedEntities.clear();
+        if (queryCache_->tryGetRadiusQuery(query.center, query.radius, query.layerMask, cachedEntities)) {
+            for (EntityID entity : cachedEntities) {
+                if (entity != query.sourceEntity) {
+                    results[i].nearbyEntities.push_back(entity);
+                }
+            }
+        } else {
+            missIndices.push_back(i);
+        }
+    }
 
-            auto it = entityPositions_.find(entity);
-            if (it != entityPositions_.end()) {
-                float distance = glm::distance(query.center, it->second);
-                if (distance <= query.radius && passesLayerFilter(entity, query.layerMask)) {
-                    result.nearbyEntities.push_back(entity);
+    // LOCK-FREE OPTIMIZATION: Direct octree queries for the misses.
+    // Queries are read-only against both octrees and the position/layer
+    // maps, so contiguous chunks can run concurrently. The per-worker
+    // scratch buffer is reused across the chunk to avoid per-query
+    // allocation. Raw (pre self-exclusion) results are kept per miss so
+    // the main thread can feed them back into the cache afterwards.
+    std::vector<std::vector<EntityID>> rawMissResults(missIndices.size());
+
+    auto processRange = [this, &queries, &results, &missIndices, &rawMissResults](size_t begin, size_t end) {
+        std::vector<EntityID> scratch;
+        for (size_t missSlot = begin; missSlot < end; ++missSlot) {
+            size_t i = missIndices[missSlot];
+            const BatchedRadiusQuery& query = queries[i];
+            BatchedQueryResult& result = results[i];
+            std::vector<EntityID>& raw = rawMissResults[missSlot];
+
+            // Perform the spatial query directly
+            scratch.clear();
+            forEachTier([&](const auto& tier) {
+                tier.queryRadius(query.center, query.radius + maxPendingDrift_, scratch, query.layerMask);
+            });
+
+            // Filter results by actual distance and layers
+            for (EntityID entity : scratch) {
+                auto it = entityPositions_.find(entity);
+                if (it != entityPositions_.end()) {
+                    float distance = glm::distance(query.center, it->second);
+                    if (distance <= query.radius && passesLayerFilter(entity, query.layerMask)) {
+                        raw.push_back(entity);
+                        // Skip self-queries in the delivered result
+                        if (entity != query.sourceEntity) {
+                            result.nearbyEntities.push_back(entity);
+                        }
+                    }
                 }
             }
         }
+    };
+
+    // Fan out over the engine-wide JobSystem pool; small batches run
+    // inline because thread handoff costs more than the work
+    constexpr size_t MIN_QUERIES_PER_WORKER = 16;
+    JobSystem::getInstance().parallelFor(missIndices.size(), MIN_QUERIES_PER_WORKER,
+                                         processRange, JobPriority::High);
+
+    // CACHE POST-PASS (main thread): publish the missed queries so the
+    // next interval's identical batch hits
+    for (size_t missSlot = 0; missSlot < missIndices.size(); ++missSlot) {
+        const BatchedRadiusQuery& query = queries[missIndices[missSlot]];
+        queryCache_->cacheRadiusQuery(query.center, query.radius, query.layerMask,
+                                      rawMissResults[missSlot]);
+    }
 
+    size_t totalEntitiesReturned = 0;
+    for (const auto& result : results) {
         totalEntitiesReturned += result.nearbyEntities.size();
-        results.push_back(std::move(result));
     }
 
     auto end = std::chrono::high_resolution_clock::now();
@@ -583,6 +971,157 @@ std::vector<SpatialManager::BatchedQueryResult> SpatialManager::queryRadiusBatch
     return results;
 }
 
+SpatialManager::PersistentQueryHandle SpatialManager::registerRadiusQuery(const glm::vec3& center,
+                                                                          float radius, uint32_t layerMask) {
+    PersistentQueryHandle handle = nextPersistentQueryHandle_++;
+    PersistentQuery& query = persistentQueries_[handle];
+    query.shape = PersistentQuery::Shape::Radius;
+    query.center = center;
+    query.radius = radius;
+    query.layerMask = layerMask;
+    return handle;
+}
+
+SpatialManager::PersistentQueryHandle SpatialManager::registerFrustumQuery(const Frustum& frustum,
+                                                                           uint32_t layerMask) {
+    PersistentQueryHandle handle = nextPersistentQueryHandle_++;
+    PersistentQuery& query = persistentQueries_[handle];
+    query.shape = PersistentQuery::Shape::Frustum;
+    query.frustum = frustum;
+    query.layerMask = layerMask;
+    return handle;
+}
+
+void SpatialManager::moveRadiusQuery(PersistentQueryHandle handle, const glm::vec3& newCenter) {
+    auto it = persistentQueries_.find(handle);
+    if (it == persistentQueries_.end() || it->second.shape != PersistentQuery::Shape::Radius) {
+        VKMON_WARNING("moveRadiusQuery: unknown or mismatched persistent query handle");
+        return;
+    }
+    if (it->second.center != newCenter) {
+        it->second.center = newCenter;
+        it->second.volumeDirty = true;
+    }
+}
+
+void SpatialManager::moveFrustumQuery(PersistentQueryHandle handle, const Frustum& newFrustum) {
+    auto it = persistentQueries_.find(handle);
+    if (it == persistentQueries_.end() || it->second.shape != PersistentQuery::Shape::Frustum) {
+        VKMON_WARNING("moveFrustumQuery: unknown or mismatched persistent query handle");
+        return;
+    }
+    it->second.frustum = newFrustum;
+    it->second.volumeDirty = true;
+}
+
+void SpatialManager::unregisterPersistentQuery(PersistentQueryHandle handle) {
+    persistentQueries_.erase(handle);
+    if (persistentQueries_.empty()) {
+        changedSinceRefresh_.clear();
+        removedSinceRefresh_.clear();
+    }
+}
+
+bool SpatialManager::persistentQueryContains(const PersistentQuery& query, EntityID entity) const {
+    auto it = entityPositions_.find(entity);
+    if (it == entityPositions_.end() || !passesLayerFilter(entity, query.layerMask)) {
+        return false;
+    }
+    if (query.shape == PersistentQuery::Shape::Radius) {
+        return glm::distance(query.center, it->second) <= query.radius;
+    }
+    return query.frustum.contains(it->second);
+}
+
+void SpatialManager::notePersistentEntityChanged(EntityID entity) {
+    if (!persistentQueries_.empty()) {
+        changedSinceRefresh_.insert(entity);
+    }
+}
+
+void SpatialManager::notePersistentEntityRemoved(EntityID entity) {
+    if (!persistentQueries_.empty()) {
+        changedSinceRefresh_.erase(entity);
+        removedSinceRefresh_.push_back(entity);
+    }
+}
+
+void SpatialManager::refreshPersistentQueries() {
+    if (persistentQueries_.empty()) {
+        return;
+    }
+
+    for (auto& [handle, query] : persistentQueries_) {
+        query.delta.entered.clear();
+        query.delta.exited.clear();
+
+        if (query.volumeDirty) {
+            // The volume moved (or this is the first refresh): run the
+            // query in full and diff the membership set. Candidates are
+            // exact-filtered through the same containment test the
+            // incremental path uses, so the two paths never disagree.
+            persistentScratch_.clear();
+            if (query.shape == PersistentQuery::Shape::Radius) {
+                queryRadius(query.center, query.radius, query.layerMask, persistentScratch_);
+            } else {
+                queryFrustum(query.frustum, query.layerMask, persistentScratch_);
+            }
+
+            std::unordered_set<EntityID> newInside;
+            newInside.reserve(persistentScratch_.size());
+            for (EntityID entity : persistentScratch_) {
+                if (!persistentQueryContains(query, entity)) {
+                    continue;  // frustum candidates are node-granular
+                }
+                newInside.insert(entity);
+                if (query.inside.count(entity) == 0) {
+                    query.delta.entered.push_back(entity);
+                }
+            }
+            for (EntityID entity : query.inside) {
+                if (newInside.count(entity) == 0) {
+                    query.delta.exited.push_back(entity);
+                }
+            }
+            query.inside = std::move(newInside);
+            query.volumeDirty = false;
+        } else {
+            // Stable volume: only entities that changed this frame can
+            // flip membership, so the delta costs O(churn) regardless
+            // of how much the query contains
+            for (EntityID entity : removedSinceRefresh_) {
+                if (query.inside.erase(entity) > 0) {
+                    query.delta.exited.push_back(entity);
+                }
+            }
+            for (EntityID entity : changedSinceRefresh_) {
+                bool nowInside = persistentQueryContains(query, entity);
+                bool wasInside = query.inside.count(entity) > 0;
+                if (nowInside && !wasInside) {
+                    query.inside.insert(entity);
+                    query.delta.entered.push_back(entity);
+                } else if (!nowInside && wasInside) {
+                    query.inside.erase(entity);
+                    query.delta.exited.push_back(entity);
+                }
+            }
+        }
+    }
+
+    changedSinceRefresh_.clear();
+    removedSinceRefresh_.clear();
+}
+
+const SpatialManager::PersistentQueryDelta* SpatialManager::getPersistentQueryDelta(PersistentQueryHandle handle) const {
+    auto it = persistentQueries_.find(handle);
+    return it != persistentQueries_.end() ? &it->second.delta : nullptr;
+}
+
+const std::unordered_set<EntityID>* SpatialManager::getPersistentQueryResults(PersistentQueryHandle handle) const {
+    auto it = persistentQueries_.find(handle);
+    return it != persistentQueries_.end() ? &it->second.inside : nullptr;
+}
+
 std::vector<EntityID> SpatialManager::findCreaturesInRadius(const glm::vec3& center, float radius) const {
     return queryRadius(center, radius, LayerMask::Creatures);
 }
@@ -592,32 +1131,33 @@ std::vector<EntityID> SpatialManager::findVisibleCreatures(const Frustum& camera
 }
 
 std::vector<EntityID> SpatialManager::findNearestEntities(const glm::vec3& position, int count, float maxDistance, uint32_t layerMask) const {
-    // Query a region and sort by distance
-    BoundingBox searchRegion(position, maxDistance);
-    std::vector<EntityID> candidates = queryRegion(searchRegion, layerMask);
-
-    // Calculate distances and sort
-    std::vector<std::pair<float, EntityID>> distanceEntityPairs;
-    for (EntityID entity : candidates) {
-        auto it = entityPositions_.find(entity);
-        if (it != entityPositions_.end()) {
-            float distance = glm::distance(position, it->second);
-            if (distance <= maxDistance) {
-                distanceEntityPairs.emplace_back(distance, entity);
-            }
-        }
+    if (count <= 0) {
+        return {};
     }
 
-    // Sort by distance
-    std::sort(distanceEntityPairs.begin(), distanceEntityPairs.end());
+    // Best-first traversal over both trees sharing one k-best heap, so
+    // the dynamic tree is pruned against the static tree's results.
+    // Cost scales with k instead of with everything inside maxDistance.
+    size_t k = static_cast<size_t>(count);
+    std::vector<std::pair<float, EntityID>> best;
+    best.reserve(k);
+
+    auto filter = [this, layerMask](EntityID entity) {
+        return passesLayerFilter(entity, layerMask);
+    };
+
+    forEachTier([&](const auto& tier) {
+        tier.collectNearest(position, k, maxDistance, best, filter, layerMask);
+    });
+
+    // Heap order to nearest-first order
+    std::sort(best.begin(), best.end());
 
-    // Return top N
     std::vector<EntityID> results;
-    int resultCount = std::min(count, static_cast<int>(distanceEntityPairs.size()));
-    for (int i = 0; i < resultCount; ++i) {
-        results.push_back(distanceEntityPairs[i].second);
+    results.reserve(best.size());
+    for (const auto& [distance, entity] : best) {
+        results.push_back(entity);
     }
-
     return results;
 }
 
@@ -626,18 +1166,66 @@ EntityID SpatialManager::findNearestEntity(const glm::vec3& position, float maxD
     return nearest.empty() ? INVALID_ENTITY : nearest[0];
 }
 
+std::vector<EntityID> SpatialManager::getEntitiesInSpatialOrder() const {
+    // Key every tracked entity by the Morton code of its true position
+    // (entityPositions_, not the possibly-stale octree placement) so the
+    // order works identically under either backend. Ties break on entity
+    // ID, keeping the order deterministic for repeated compaction passes.
+    std::vector<std::pair<uint64_t, EntityID>> keyed;
+    keyed.reserve(entityPositions_.size());
+    for (const auto& [entity, position] : entityPositions_) {
+        keyed.emplace_back(MortonGrid::encodePosition(position, worldBounds_.min, worldBounds_.max),
+                           entity);
+    }
+    std::sort(keyed.begin(), keyed.end());
+
+    std::vector<EntityID> order;
+    order.reserve(keyed.size());
+    for (const auto& [key, entity] : keyed) {
+        order.push_back(entity);
+    }
+    return order;
+}
+
 void SpatialManager::getStatistics(int& nodeCount, int& maxDepth, int& totalEntities) const {
     nodeCount = 0;
     maxDepth = 0;
     totalEntities = 0;
-    octree_->getStatistics(nodeCount, maxDepth, totalEntities);
+    forEachTier([&](const auto& tier) { tier.getStatistics(nodeCount, maxDepth, totalEntities); });
+}
+
+size_t SpatialManager::getEstimatedMemoryBytes() const {
+    size_t bytes = 0;
+    forEachTier([&](const auto& tier) { bytes += tier.getMemoryBytes(); });
+
+    // Bookkeeping maps: entry payload plus a rough node overhead per
+    // element; close enough for a budget gauge
+    constexpr size_t MAP_NODE_OVERHEAD = 32;
+    bytes += entityPositions_.size() * (sizeof(EntityID) + sizeof(glm::vec3) + MAP_NODE_OVERHEAD);
+    bytes += octreePositions_.size() * (sizeof(EntityID) + sizeof(glm::vec3) + MAP_NODE_OVERHEAD);
+    bytes += staticEntities_.size() * (sizeof(EntityID) + MAP_NODE_OVERHEAD);
+
+    bytes += queryCache_->getEstimatedMemoryBytes();
+    return bytes;
 }
 
 void SpatialManager::clear() {
-    octree_->clear();
+    forEachTier([](auto& tier) { tier.clear(); });
+    staticEntities_.clear();
     entityPositions_.clear();
+    octreePositions_.clear();
+    pendingMoves_.clear();
+    maxPendingDrift_ = 0.0f;
     entityLayers_.clear();
 
+    // Registered queries survive a clear; the next refresh re-executes
+    // them against the (now empty) world and reports everything exited
+    changedSinceRefresh_.clear();
+    removedSinceRefresh_.clear();
+    for (auto& [handle, query] : persistentQueries_) {
+        query.volumeDirty = true;
+    }
+
     // Reset statistics with thread safety
     {
         std::lock_guard<std::mutex> lock(statsMutex_);
@@ -646,7 +1234,9 @@ void SpatialManager::clear() {
 }
 
 bool SpatialManager::needsSubdivision() const {
-    return octree_->shouldSubdivide();
+    // FlatOctree splits overfull leaves internally on insert; there is
+    // never outstanding subdivision work
+    return false;
 }
 
 void SpatialManager::updateStatistics(float queryTimeMs, size_t entitiesReturned) const {
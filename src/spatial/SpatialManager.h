@@ -1,9 +1,14 @@
 #pragma once
 
 #include "../core/Entity.h"
+#include "../utils/SmallVector.h"
 #include "LayerMask.h"
 #include "SpatialCache.h"
+#include "WorldConfig.h"
+#include "MortonGrid.h"
 #include <glm/glm.hpp>
+#include <algorithm>
+#include <queue>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -45,53 +50,218 @@ struct BoundingBox {
 };
 
 struct Frustum {
-    glm::vec4 planes[6]; // Left, Right, Bottom, Top, Near, Far
+    glm::vec4 planes[6];      // Left, Right, Bottom, Top, Near, Far
+    glm::vec3 absNormals[6];  // componentwise |normal| per plane, precomputed
+                              // so intersects() needs no sign branches
 
     void updateFromMatrix(const glm::mat4& viewProjectionMatrix);
+    void updateAbsNormals(); // call after writing planes directly
     bool intersects(const BoundingBox& box) const;
     bool contains(const glm::vec3& point) const;
 };
 
-class OctreeNode {
+// Pointer-free octree stored in flat arrays
+//
+// Nodes live in one contiguous vector and reference their eight children
+// by a single 32-bit index (children are always allocated as a
+// consecutive block). Entity membership lives in a pooled entry array
+// linked per-node, so traversal never chases owning pointers across the
+// heap - deep queries walk two flat vectors. Entries also carry the
+// entity position, which lets leaves split themselves when they overflow
+// instead of requiring an external position-lookup callback.
+class FlatOctree {
 public:
     static constexpr int MAX_ENTITIES_PER_NODE = 16;
     static constexpr int MAX_DEPTH = 8;
 
 private:
-    BoundingBox bounds_;
-    std::vector<EntityID> entities_;
-    std::unique_ptr<OctreeNode> children_[8];
-    int depth_;
-    bool is_leaf_;
+    static constexpr int32_t NO_NODE = -1;
+    static constexpr int32_t NO_ENTRY = -1;
+
+    struct Node {
+        BoundingBox bounds;
+        int32_t firstChild = NO_NODE;  // index of 8 consecutive child nodes
+        int32_t firstEntry = NO_ENTRY; // head of this node's entity list
+        uint32_t layerMask = 0;        // OR of subtree entity layers (stale superset after removes)
+        uint16_t entityCount = 0;
+        uint8_t depth = 0;
+
+        bool isLeaf() const { return firstChild == NO_NODE; }
+    };
 
-public:
-    OctreeNode(const BoundingBox& bounds, int depth = 0)
-        : bounds_(bounds), depth_(depth), is_leaf_(true) {}
+    struct EntityEntry {
+        EntityID entity = INVALID_ENTITY;
+        glm::vec3 position{0.0f};
+        uint32_t layers = 0;
+        int32_t next = NO_ENTRY;
+    };
 
-    // Core octree operations
-    void insert(EntityID entity, const glm::vec3& position);
+    std::vector<Node> nodes_;
+    std::vector<EntityEntry> entries_;
+    int32_t freeEntry_ = NO_ENTRY; // recycled entry slots
+    size_t entityCount_ = 0;
+
+public:
+    explicit FlatOctree(const BoundingBox& bounds);
+
+    // Core octree operations (subdivision happens internally on overflow).
+    // Entity layers are OR-aggregated into every node on the insertion
+    // path so queries can skip whole subtrees with no matching layers;
+    // removal leaves node masks as a stale superset, which only costs
+    // precision, never correctness. Rebuilding or clearing refreshes them.
+    void insert(EntityID entity, const glm::vec3& position, uint32_t layers = LayerMask::None);
     void remove(EntityID entity, const glm::vec3& position);
-    void update(EntityID entity, const glm::vec3& oldPos, const glm::vec3& newPos);
+    void update(EntityID entity, const glm::vec3& oldPos, const glm::vec3& newPos, uint32_t layers);
+    void setEntityLayers(EntityID entity, const glm::vec3& position, uint32_t layers);
+
+    // Spatial queries (layerMask prunes subtrees whose aggregated mask
+    // has no overlap; per-entity filtering still happens in the caller)
+    void query(const BoundingBox& region, std::vector<EntityID>& results, uint32_t layerMask = LayerMask::All) const;
+    void query(const Frustum& frustum, std::vector<EntityID>& results, uint32_t layerMask = LayerMask::All) const;
+    void queryRadius(const glm::vec3& center, float radius, std::vector<EntityID>& results, uint32_t layerMask = LayerMask::All) const;
+
+    // Visit every stored entry whose leaf intersects region, without
+    // building a result vector. Visitor signature:
+    //     bool visitor(EntityID entity, const glm::vec3& position)
+    // Return false from the visitor to stop early; visit() returns
+    // false if the traversal was stopped.
+    template<typename Visitor>
+    bool visit(const BoundingBox& region, Visitor&& visitor, uint32_t layerMask = LayerMask::All) const {
+        int32_t stack[8 * MAX_DEPTH + 8];
+        int top = 0;
+        stack[top++] = 0;
+
+        while (top > 0) {
+            const Node& node = nodes_[stack[--top]];
+            if (!node.bounds.intersects(region) || subtreePrunable(node, layerMask)) {
+                continue;
+            }
+
+            if (node.isLeaf()) {
+                for (int32_t entry = node.firstEntry; entry != NO_ENTRY; entry = entries_[entry].next) {
+                    if (!visitor(entries_[entry].entity, entries_[entry].position)) {
+                        return false;
+                    }
+                }
+            } else {
+                for (int i = 0; i < 8; ++i) {
+                    stack[top++] = node.firstChild + i;
+                }
+            }
+        }
+        return true;
+    }
 
-    // Subdivision with position lookup
-    void subdivide(std::function<glm::vec3(EntityID)> getPosition);
+    // Best-first nearest-neighbor traversal: visits nodes in order of
+    // minimum distance to position and prunes any subtree that cannot
+    // beat the current k-th best result, so cost scales with k rather
+    // than with world population. `best` is a max-heap of
+    // (distance, entity) pairs shared across calls - running a second
+    // tree against the same heap prunes it with the first tree's
+    // results. Filter signature: bool filter(EntityID).
+    template<typename Filter>
+    void collectNearest(const glm::vec3& position, size_t k, float maxDistance,
+                        std::vector<std::pair<float, EntityID>>& best, Filter&& filter,
+                        uint32_t layerMask = LayerMask::All) const {
+        if (k == 0 || entityCount_ == 0) {
+            return;
+        }
+
+        auto minDistToBounds = [&position](const BoundingBox& bounds) {
+            glm::vec3 clamped(
+                std::max(bounds.min.x, std::min(position.x, bounds.max.x)),
+                std::max(bounds.min.y, std::min(position.y, bounds.max.y)),
+                std::max(bounds.min.z, std::min(position.z, bounds.max.z)));
+            return glm::distance(position, clamped);
+        };
+
+        // Prune against the k-th best once the heap is full
+        auto worstAllowed = [&best, k, maxDistance]() {
+            return (best.size() == k) ? best.front().first : maxDistance;
+        };
+
+        using NodeRef = std::pair<float, int32_t>; // (min distance, node index)
+        std::priority_queue<NodeRef, std::vector<NodeRef>, std::greater<NodeRef>> frontier;
+        frontier.emplace(minDistToBounds(nodes_[0].bounds), 0);
+
+        while (!frontier.empty()) {
+            auto [nodeDist, nodeIndex] = frontier.top();
+            frontier.pop();
+
+            // Frontier is min-ordered: once the nearest unvisited node
+            // cannot improve the result, nothing after it can either
+            if (nodeDist > worstAllowed()) {
+                break;
+            }
+
+            const Node& node = nodes_[nodeIndex];
+            if (node.isLeaf()) {
+                for (int32_t entry = node.firstEntry; entry != NO_ENTRY; entry = entries_[entry].next) {
+                    float distance = glm::distance(position, entries_[entry].position);
+                    if (distance > maxDistance || !filter(entries_[entry].entity)) {
+                        continue;
+                    }
+                    if (best.size() == k) {
+                        if (distance >= best.front().first) {
+                            continue;
+                        }
+                        std::pop_heap(best.begin(), best.end());
+                        best.back() = {distance, entries_[entry].entity};
+                    } else {
+                        best.emplace_back(distance, entries_[entry].entity);
+                    }
+                    std::push_heap(best.begin(), best.end());
+                }
+            } else {
+                for (int i = 0; i < 8; ++i) {
+                    int32_t child = node.firstChild + i;
+                    if (subtreePrunable(nodes_[child], layerMask)) {
+                        continue;
+                    }
+                    float childDist = minDistToBounds(nodes_[child].bounds);
+                    if (childDist <= worstAllowed()) {
+                        frontier.emplace(childDist, child);
+                    }
+                }
+            }
+        }
+    }
 
-    // Spatial queries
-    void query(const BoundingBox& region, std::vector<EntityID>& results) const;
-    void query(const Frustum& frustum, std::vector<EntityID>& results) const;
-    void queryRadius(const glm::vec3& center, float radius, std::vector<EntityID>& results) const;
+    // Grow the tree until its bounds contain position, by repeatedly
+    // wrapping the current root as one octant of a doubled root. The
+    // old root node is copied into its child slot in O(1) - subtree
+    // node indices are absolute, so nothing else moves. Existing depth
+    // fields become stale relative to the new root, which only relaxes
+    // the split depth limit slightly; it never affects query results.
+    void growToInclude(const glm::vec3& position);
 
     // Utility
     void clear();
-    const BoundingBox& getBounds() const { return bounds_; }
-    size_t getEntityCount() const;
+    const BoundingBox& getBounds() const { return nodes_[0].bounds; }
+    size_t getEntityCount() const { return entityCount_; }
     void getStatistics(int& nodeCount, int& maxDepth, int& totalEntities) const;
 
-    bool shouldSubdivide() const;
+    // Container footprint in bytes, capacity included - feeds the
+    // memory tracker's spatial gauge
+    size_t getMemoryBytes() const {
+        return nodes_.capacity() * sizeof(Node) + entries_.capacity() * sizeof(EntityEntry);
+    }
 
 private:
-    int getChildIndex(const glm::vec3& position) const;
-    BoundingBox getChildBounds(int childIndex) const;
+    // Layer pruning: entities added with LayerMask::None contribute no
+    // bits to node masks but must still be returned by unrestricted
+    // queries, so LayerMask::All never prunes
+    static bool subtreePrunable(const Node& node, uint32_t layerMask) {
+        return layerMask != LayerMask::All && (node.layerMask & layerMask) == 0;
+    }
+
+    int32_t findLeaf(const glm::vec3& position) const;
+    int getChildIndex(const Node& node, const glm::vec3& position) const;
+    static BoundingBox childBounds(const BoundingBox& bounds, int childIndex);
+    int32_t allocEntry(EntityID entity, const glm::vec3& position, uint32_t layers);
+    void pushEntity(int32_t nodeIndex, EntityID entity, const glm::vec3& position, uint32_t layers);
+    void splitLeaf(int32_t nodeIndex);
+    void appendNodeEntities(const Node& node, std::vector<EntityID>& results) const;
 };
 
 class SpatialManager {
@@ -107,13 +277,69 @@ public:
         size_t cacheSize = 0;
     };
 
+    // Persistent query support types (public for registration callers)
+    using PersistentQueryHandle = uint32_t;
+    static constexpr PersistentQueryHandle INVALID_PERSISTENT_QUERY = 0;
+
+    struct PersistentQueryDelta {
+        std::vector<EntityID> entered;
+        std::vector<EntityID> exited;
+    };
+
 private:
-    std::unique_ptr<OctreeNode> octree_;
+    // Two-tier storage: terrain/platforms/grass live in a static
+    // structure that is only touched on explicit invalidation, movers
+    // live in a small dynamic structure that absorbs all per-frame
+    // maintenance. Queries merge both tiers. Which concrete structure
+    // backs the tiers is chosen at construction from WorldConfig -
+    // either pair of pointers is populated, never both.
+    SpatialBackendType backend_ = SpatialBackendType::Octree;
+    std::unique_ptr<FlatOctree> staticOctree_;
+    std::unique_ptr<FlatOctree> dynamicOctree_;
+    std::unique_ptr<MortonGrid> staticGrid_;
+    std::unique_ptr<MortonGrid> dynamicGrid_;
     BoundingBox worldBounds_;
 
     // Entity tracking for updates
     std::unordered_map<EntityID, glm::vec3> entityPositions_;
     std::unordered_map<EntityID, uint32_t> entityLayers_;
+    std::unordered_set<EntityID> staticEntities_;
+
+    // Deferred reinsertion: movement updates are queued (coalesced per
+    // entity) and committed by processPendingUpdates under a per-frame
+    // time budget, so boundary-crossing reinsertion spikes are spread
+    // across frames. entityPositions_ always holds the true position;
+    // octreePositions_ holds what the octree last saw. Queries expand
+    // their search volume by the largest pending drift so stale octree
+    // placement never drops a result.
+    std::unordered_map<EntityID, glm::vec3> octreePositions_;
+    std::unordered_map<EntityID, glm::vec3> pendingMoves_;
+    float maxPendingDrift_ = 0.0f;
+
+    // Persistent queries: registered once, refreshed each frame into an
+    // entered/exited delta. On stable frames the delta is maintained
+    // from this frame's entity churn in O(changed entities x queries);
+    // a full re-execution only happens when the query volume itself
+    // moves (volumeDirty). Membership tests use true entity positions,
+    // so deltas never lag behind queued octree reinsertion.
+    struct PersistentQuery {
+        enum class Shape : uint8_t { Radius, Frustum } shape = Shape::Radius;
+        glm::vec3 center{0.0f};
+        float radius = 0.0f;
+        Frustum frustum{};
+        uint32_t layerMask = LayerMask::All;
+        bool volumeDirty = true;  // forces a full re-execution on next refresh
+        std::unordered_set<EntityID> inside;
+        PersistentQueryDelta delta;
+    };
+    std::unordered_map<PersistentQueryHandle, PersistentQuery> persistentQueries_;
+    PersistentQueryHandle nextPersistentQueryHandle_ = 1;
+
+    // Entity churn since the last refresh (only tracked while at least
+    // one persistent query is registered)
+    std::unordered_set<EntityID> changedSinceRefresh_;
+    std::vector<EntityID> removedSinceRefresh_;
+    mutable std::vector<EntityID> persistentScratch_;
 
     // PERFORMANCE OPTIMIZATION: Lock-free spatial cache for query acceleration
     mutable std::unique_ptr<PredictiveSpatialCache> queryCache_;
@@ -125,19 +351,55 @@ private:
 
 public:
     SpatialManager(const BoundingBox& worldBounds);
+    explicit SpatialManager(const WorldConfig& config);
     ~SpatialManager() = default;
 
-    // Entity management
-    void addEntity(EntityID entity, const glm::vec3& position, uint32_t layers = LayerMask::None);
+    SpatialBackendType getBackendType() const { return backend_; }
+
+    // Entity management. Static entities go into the static tree and are
+    // expected not to move; if one does move it is demoted to the
+    // dynamic tree automatically.
+    void addEntity(EntityID entity, const glm::vec3& position, uint32_t layers = LayerMask::None,
+                   bool isStatic = false);
     void removeEntity(EntityID entity);
     void updateEntity(EntityID entity, const glm::vec3& newPosition);
     void updateEntityLayers(EntityID entity, uint32_t layers);
 
+    // Explicit invalidation hook: rebuilds the static octree from the
+    // currently tracked static entities (e.g. after streaming in terrain)
+    void rebuildStaticOctree();
+
+    // Deferred reinsertion maintenance. Commits queued movement updates
+    // into the octree until budgetMs is spent (checked every few
+    // commits); SpatialSystem calls this once per frame. Pass a negative
+    // budget to drain the queue completely.
+    static constexpr float DEFAULT_UPDATE_BUDGET_MS = 0.2f;
+    void processPendingUpdates(float budgetMs = DEFAULT_UPDATE_BUDGET_MS);
+    size_t getPendingUpdateCount() const { return pendingMoves_.size(); }
+
+    bool isEntityStatic(EntityID entity) const {
+        return staticEntities_.count(entity) > 0;
+    }
+    size_t getStaticEntityCount() const { return staticEntities_.size(); }
+
     // Spatial queries for Pokemon gameplay
     std::vector<EntityID> queryRegion(const BoundingBox& region, uint32_t layerMask = LayerMask::All) const;
     std::vector<EntityID> queryFrustum(const Frustum& frustum, uint32_t layerMask = LayerMask::All) const;
     std::vector<EntityID> queryRadius(const glm::vec3& center, float radius, uint32_t layerMask = LayerMask::All) const;
 
+    // Zero-allocation variants: append filtered matches into a
+    // caller-provided buffer that can be reused across frames. These
+    // bypass the predictive cache - they exist for hot per-frame callers
+    // where the cache's result copy is itself the overhead being avoided.
+    void queryRegion(const BoundingBox& region, uint32_t layerMask, std::vector<EntityID>& results) const;
+    void queryFrustum(const Frustum& frustum, uint32_t layerMask, std::vector<EntityID>& results) const;
+    void queryRadius(const glm::vec3& center, float radius, uint32_t layerMask, std::vector<EntityID>& results) const;
+
+    // Count matches without materializing them; stops traversal early
+    // once maxCount is reached (e.g. "is anything within 5m?" checks)
+    size_t queryRadiusCount(const glm::vec3& center, float radius, uint32_t layerMask = LayerMask::All,
+                            size_t maxCount = std::numeric_limits<size_t>::max()) const;
+
     // PERFORMANCE OPTIMIZATION: Batched spatial queries for massive creature counts
     struct BatchedRadiusQuery {
         EntityID sourceEntity;
@@ -148,13 +410,47 @@ public:
 
     struct BatchedQueryResult {
         EntityID sourceEntity;
-        std::vector<EntityID> nearbyEntities;
+        // Inline storage for the typical detection result (a creature
+        // rarely has more than a dozen neighbors in range) - a 64-query
+        // batch produces zero per-result heap allocations in the common
+        // case
+        SmallVector<EntityID, 16> nearbyEntities;
     };
 
-    // Execute multiple radius queries in a single optimized batch operation
-    // Eliminates per-query mutex overhead and enables spatial optimizations
+    // Execute multiple radius queries in a single optimized batch operation.
+    // Eliminates per-query mutex overhead, serves repeats from the
+    // predictive cache, and fans cache misses out across the shared
+    // JobSystem pool.
     std::vector<BatchedQueryResult> queryRadiusBatch(const std::vector<BatchedRadiusQuery>& queries) const;
 
+    // Persistent queries with incremental enter/exit deltas. Systems
+    // that re-issue the same shaped query every frame (camera frustum,
+    // player radius, creature detection) register it once and read the
+    // delta after each refreshPersistentQueries() instead of paying a
+    // full re-execution. Subscribers that want enter/exit semantics
+    // (detection triggers, aggro ranges) get them directly from the
+    // delta rather than diffing result lists themselves.
+    PersistentQueryHandle registerRadiusQuery(const glm::vec3& center, float radius,
+                                              uint32_t layerMask = LayerMask::All);
+    PersistentQueryHandle registerFrustumQuery(const Frustum& frustum, uint32_t layerMask = LayerMask::All);
+
+    // Move a registered query's volume; the next refresh re-executes it
+    // in full and reports the membership change as entered/exited
+    void moveRadiusQuery(PersistentQueryHandle handle, const glm::vec3& newCenter);
+    void moveFrustumQuery(PersistentQueryHandle handle, const Frustum& newFrustum);
+    void unregisterPersistentQuery(PersistentQueryHandle handle);
+
+    // Recompute deltas for every registered query from this frame's
+    // entity churn; SpatialSystem calls this once per frame right after
+    // processPendingUpdates commits queued moves
+    void refreshPersistentQueries();
+
+    // Delta and membership views from the last refresh; both stay valid
+    // until the next refresh or unregister. Null for unknown handles.
+    const PersistentQueryDelta* getPersistentQueryDelta(PersistentQueryHandle handle) const;
+    const std::unordered_set<EntityID>* getPersistentQueryResults(PersistentQueryHandle handle) const;
+    size_t getPersistentQueryCount() const { return persistentQueries_.size(); }
+
     // Pokemon-specific queries
     std::vector<EntityID> findCreaturesInRadius(const glm::vec3& center, float radius) const;
     std::vector<EntityID> findVisibleCreatures(const Frustum& cameraFrustum) const;
@@ -163,8 +459,19 @@ public:
     std::vector<EntityID> findNearestEntities(const glm::vec3& position, int count, float maxDistance = std::numeric_limits<float>::max(), uint32_t layerMask = LayerMask::All) const;
     EntityID findNearestEntity(const glm::vec3& position, float maxDistance = std::numeric_limits<float>::max(), uint32_t layerMask = LayerMask::All) const;
 
+    // Every tracked entity sorted by the Morton code of its true
+    // position. This is the octree-locality order the ECS storage
+    // compaction pass consumes (EntityManager::compactStorage): entities
+    // near each other in space become near each other in component memory
+    std::vector<EntityID> getEntitiesInSpatialOrder() const;
+
     // Performance and debugging
     void getStatistics(int& nodeCount, int& maxDepth, int& totalEntities) const;
+
+    // Estimated bytes held by the spatial tiers, bookkeeping maps, and
+    // query cache - refreshed into the memory tracker by SpatialSystem
+    size_t getEstimatedMemoryBytes() const;
+
     SpatialStats getPerformanceStats() const {
         std::lock_guard<std::mutex> lock(statsMutex_);
         SpatialStats result = stats_;
@@ -181,8 +488,63 @@ public:
     const BoundingBox& getWorldBounds() const { return worldBounds_; }
 
 private:
+    // Backend dispatch. FlatOctree and MortonGrid expose the same
+    // operation surface but that surface is template-heavy (visit,
+    // collectNearest), so virtual dispatch cannot express it; generic
+    // lambdas give the same polymorphism with static calls instead.
+    template<typename Fn>
+    void forEachTier(Fn&& fn) {
+        if (backend_ == SpatialBackendType::MortonGrid) {
+            fn(*staticGrid_);
+            fn(*dynamicGrid_);
+        } else {
+            fn(*staticOctree_);
+            fn(*dynamicOctree_);
+        }
+    }
+
+    template<typename Fn>
+    void forEachTier(Fn&& fn) const {
+        if (backend_ == SpatialBackendType::MortonGrid) {
+            fn(*staticGrid_);
+            fn(*dynamicGrid_);
+        } else {
+            fn(*staticOctree_);
+            fn(*dynamicOctree_);
+        }
+    }
+
+    template<typename Fn>
+    void withStaticTier(Fn&& fn) {
+        if (backend_ == SpatialBackendType::MortonGrid) {
+            fn(*staticGrid_);
+        } else {
+            fn(*staticOctree_);
+        }
+    }
+
+    template<typename Fn>
+    void withDynamicTier(Fn&& fn) {
+        if (backend_ == SpatialBackendType::MortonGrid) {
+            fn(*dynamicGrid_);
+        } else {
+            fn(*dynamicOctree_);
+        }
+    }
+
+    // Dynamic root expansion: when an entity lands outside the world
+    // bounds, both tiers grow in place (root wrapping for the octree,
+    // re-key for the grid) instead of the manager being recreated
+    void ensureWorldContains(const glm::vec3& position);
+
     void updateStatistics(float queryTimeMs, size_t entitiesReturned) const;
     bool passesLayerFilter(EntityID entity, uint32_t layerMask) const;
+
+    // Exact membership test for a persistent query (true position +
+    // layer filter); shared by the full and incremental refresh paths
+    bool persistentQueryContains(const PersistentQuery& query, EntityID entity) const;
+    void notePersistentEntityChanged(EntityID entity);
+    void notePersistentEntityRemoved(EntityID entity);
 };
 
 } // namespace VulkanMon
\ No newline at end of file
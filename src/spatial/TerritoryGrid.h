@@ -0,0 +1,172 @@
+#pragma once
+
+#include "../core/Entity.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace VulkanMon {
+
+// =============================================================================
+// TERRITORY GRID - Coarse 2D spatial hash for creature home ranges
+// =============================================================================
+//
+// Territories are circles on the XZ plane (homePosition + territoryRadius
+// from SpatialComponent). The octree answers "what is near this point right
+// now", but territorial behavior asks a different question - "whose claimed
+// range covers this position" - and the claims change only when a creature
+// is assigned a new home, not when it moves. A coarse hash keyed on cell
+// coordinates turns both containment and overlap queries into bucket scans
+// instead of per-creature distance sweeps, and stays O(1) to maintain
+// because each territory registers once into the handful of cells its
+// bounds overlap.
+//
+// Cell size defaults to roughly a typical territory radius so most
+// territories touch 1-4 cells.
+class TerritoryGrid {
+public:
+    static constexpr float DEFAULT_CELL_SIZE = 32.0f;
+
+    explicit TerritoryGrid(float cellSize = DEFAULT_CELL_SIZE)
+        : cellSize_(cellSize) {}
+
+    // Register or move a territory. No-ops when the stored claim already
+    // matches, so callers can sync unconditionally each frame.
+    void assign(EntityID entity, const glm::vec3& homePosition, float radius) {
+        glm::vec2 center(homePosition.x, homePosition.z);
+
+        auto it = territories_.find(entity);
+        if (it != territories_.end()) {
+            if (it->second.center == center && it->second.radius == radius) {
+                return; // steady state - nothing to re-bucket
+            }
+            removeFromCells(entity, it->second);
+            it->second = Territory{center, radius};
+        } else {
+            it = territories_.emplace(entity, Territory{center, radius}).first;
+        }
+        insertIntoCells(entity, it->second);
+    }
+
+    void remove(EntityID entity) {
+        auto it = territories_.find(entity);
+        if (it == territories_.end()) {
+            return;
+        }
+        removeFromCells(entity, it->second);
+        territories_.erase(it);
+    }
+
+    bool contains(EntityID entity) const {
+        return territories_.find(entity) != territories_.end();
+    }
+
+    // Who claims this position - one bucket scan plus precise circle tests.
+    // Results are appended so hot callers can reuse a buffer.
+    void claimantsAt(const glm::vec3& position, std::vector<EntityID>& results) const {
+        glm::vec2 point(position.x, position.z);
+        auto cell = cells_.find(keyFor(cellCoord(point.x), cellCoord(point.y)));
+        if (cell == cells_.end()) {
+            return;
+        }
+        for (EntityID entity : cell->second) {
+            const Territory& territory = territories_.at(entity);
+            glm::vec2 offset = point - territory.center;
+            if (glm::dot(offset, offset) <= territory.radius * territory.radius) {
+                results.push_back(entity);
+            }
+        }
+    }
+
+    // Territories whose circles intersect the given circle (e.g. a
+    // prospective new home range). Appended results are deduplicated -
+    // large territories span multiple cells.
+    void overlapping(const glm::vec3& center, float radius, std::vector<EntityID>& results) const {
+        glm::vec2 queryCenter(center.x, center.z);
+        size_t firstNew = results.size();
+
+        int32_t minX = cellCoord(queryCenter.x - radius);
+        int32_t maxX = cellCoord(queryCenter.x + radius);
+        int32_t minZ = cellCoord(queryCenter.y - radius);
+        int32_t maxZ = cellCoord(queryCenter.y + radius);
+
+        for (int32_t cx = minX; cx <= maxX; ++cx) {
+            for (int32_t cz = minZ; cz <= maxZ; ++cz) {
+                auto cell = cells_.find(keyFor(cx, cz));
+                if (cell == cells_.end()) {
+                    continue;
+                }
+                for (EntityID entity : cell->second) {
+                    const Territory& territory = territories_.at(entity);
+                    glm::vec2 offset = queryCenter - territory.center;
+                    float combined = radius + territory.radius;
+                    if (glm::dot(offset, offset) <= combined * combined) {
+                        results.push_back(entity);
+                    }
+                }
+            }
+        }
+
+        std::sort(results.begin() + firstNew, results.end());
+        results.erase(std::unique(results.begin() + firstNew, results.end()), results.end());
+    }
+
+    size_t territoryCount() const { return territories_.size(); }
+    float cellSize() const { return cellSize_; }
+
+private:
+    struct Territory {
+        glm::vec2 center = glm::vec2(0.0f); // XZ plane
+        float radius = 0.0f;
+    };
+
+    int32_t cellCoord(float value) const {
+        return static_cast<int32_t>(std::floor(value / cellSize_));
+    }
+
+    static int64_t keyFor(int32_t cx, int32_t cz) {
+        return (static_cast<int64_t>(cx) << 32) | static_cast<int64_t>(static_cast<uint32_t>(cz));
+    }
+
+    void insertIntoCells(EntityID entity, const Territory& territory) {
+        forEachCell(territory, [&](int64_t key) {
+            cells_[key].push_back(entity);
+        });
+    }
+
+    void removeFromCells(EntityID entity, const Territory& territory) {
+        forEachCell(territory, [&](int64_t key) {
+            auto cell = cells_.find(key);
+            if (cell == cells_.end()) {
+                return;
+            }
+            auto& bucket = cell->second;
+            bucket.erase(std::remove(bucket.begin(), bucket.end(), entity), bucket.end());
+            if (bucket.empty()) {
+                cells_.erase(cell);
+            }
+        });
+    }
+
+    template <typename Func>
+    void forEachCell(const Territory& territory, Func&& func) const {
+        int32_t minX = cellCoord(territory.center.x - territory.radius);
+        int32_t maxX = cellCoord(territory.center.x + territory.radius);
+        int32_t minZ = cellCoord(territory.center.y - territory.radius);
+        int32_t maxZ = cellCoord(territory.center.y + territory.radius);
+        for (int32_t cx = minX; cx <= maxX; ++cx) {
+            for (int32_t cz = minZ; cz <= maxZ; ++cz) {
+                func(keyFor(cx, cz));
+            }
+        }
+    }
+
+    float cellSize_;
+    std::unordered_map<EntityID, Territory> territories_;
+    std::unordered_map<int64_t, std::vector<EntityID>> cells_;
+};
+
+} // namespace VulkanMon
@@ -8,11 +8,21 @@ namespace VulkanMon {
 
 struct BoundingBox;
 
+// Spatial backend selection per world. Octree (the default) adapts to
+// clustered vertical worlds; MortonGrid keeps entities in one flat
+// Morton-sorted array and suits mostly-flat outdoor maps with uniform
+// entity spread.
+enum class SpatialBackendType {
+    Octree,
+    MortonGrid
+};
+
 struct WorldConfig {
     glm::vec3 minBounds;
     glm::vec3 maxBounds;
     int maxOctreeDepth = 8;
     float minNodeSize = 1.0f;
+    SpatialBackendType spatialBackend = SpatialBackendType::Octree;
     std::string name = "Default";
 
     WorldConfig()
@@ -101,16 +101,26 @@ glm::vec3 CameraSystem::getActiveCameraPosition(EntityManager& entityManager) {
     return glm::vec3(0.0f);
 }
 
-Frustum CameraSystem::getActiveCameraFrustum(EntityManager& entityManager) {
-    Frustum frustum;
+const Frustum& CameraSystem::getActiveCameraFrustum(EntityManager& entityManager) {
+    Camera* camera = getActiveCamera(entityManager);
 
-    // Get view-projection matrix from active camera
-    glm::mat4 viewProjectionMatrix = getActiveViewProjectionMatrix(entityManager);
+    if (!camera) {
+        // No active camera: keep the old identity-matrix behavior (warns
+        // inside getActiveViewProjectionMatrix), rebuilt on every call
+        cachedFrustum_.updateFromMatrix(getActiveViewProjectionMatrix(entityManager));
+        cachedFrustumCamera_ = INVALID_ENTITY;
+        return cachedFrustum_;
+    }
 
-    // Generate frustum planes from matrix
-    frustum.updateFromMatrix(viewProjectionMatrix);
+    // Re-extract only when the camera's matrices changed or a different
+    // camera became active; otherwise hand out the cached planes
+    if (camera->frustumDirty || cachedFrustumCamera_ != activeCameraEntity) {
+        cachedFrustum_.updateFromMatrix(camera->getViewProjectionMatrix());
+        camera->frustumDirty = false;
+        cachedFrustumCamera_ = activeCameraEntity;
+    }
 
-    return frustum;
+    return cachedFrustum_;
 }
 
 void CameraSystem::handleWindowResize(int width, int height, EntityManager& entityManager) {
@@ -12,6 +12,12 @@ class CameraSystem : public System<Transform, Camera> {
 private:
     EntityID activeCameraEntity = INVALID_ENTITY;
 
+    // Frustum cache: extracted once per camera change (Camera::frustumDirty)
+    // and handed out by const reference - RenderSystem, CreatureRenderSystem,
+    // and GrassSystem all ask every frame
+    Frustum cachedFrustum_{};
+    EntityID cachedFrustumCamera_ = INVALID_ENTITY;
+
 public:
     void update(float deltaTime, EntityManager& entityManager) override;
 
@@ -32,8 +38,10 @@ public:
     // Helper to get camera position for distance calculations
     glm::vec3 getActiveCameraPosition(EntityManager& entityManager);
 
-    // Generate frustum from active camera for spatial culling
-    Frustum getActiveCameraFrustum(EntityManager& entityManager);
+    // Frustum from the active camera for spatial culling. Cached: only
+    // re-extracted when the camera's matrices changed or the active
+    // camera switched, so per-frame callers share one computation
+    const Frustum& getActiveCameraFrustum(EntityManager& entityManager);
 
     // Window resize handling - updates camera aspect ratio
     void handleWindowResize(int width, int height, EntityManager& entityManager);
@@ -0,0 +1,201 @@
+#include "CharacterControllerSystem.h"
+#include "PhysicsSystem.h"
+#include "../core/EntityManager.h"
+#include "../utils/Logger.h"
+#include <chrono>
+#include <cmath>
+
+namespace VulkanMon {
+
+namespace {
+    // Footprint ray offsets around the capsule center, scaled by
+    // groundCheckRadius in the gather pass (center ray first)
+    constexpr glm::vec2 FOOTPRINT_OFFSETS[] = {
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {-1.0f, 0.0f},
+        {0.0f, 1.0f},
+        {0.0f, -1.0f},
+    };
+    static_assert(sizeof(FOOTPRINT_OFFSETS) / sizeof(FOOTPRINT_OFFSETS[0]) ==
+                  CharacterControllerSystem::GROUND_RAYS_PER_CHARACTER,
+                  "Footprint offsets must match GROUND_RAYS_PER_CHARACTER");
+}
+
+void CharacterControllerSystem::update(float deltaTime, EntityManager& entityManager) {
+    auto start = std::chrono::high_resolution_clock::now();
+    stats_ = SystemStats{};
+
+    auto& entities = entityManager.getEntitiesWithComponent<CharacterControllerComponent>();
+    if (entities.empty()) {
+        return;
+    }
+
+    // Shared request batch, reused across frames (single-instance system,
+    // so the static cache is safe per the engine's ownership model)
+    static std::vector<PhysicsSystem::RaycastRequest> groundRays;
+    groundRays.clear();
+    batchEntries_.clear();
+
+    // Gather pass: collect every character's ground-probe rays into one
+    // batch. Rays start at stepHeight above the feet so walkable steps
+    // register as ground instead of as a wall of air below the capsule.
+    bool castGround = groundDetectionEnabled_ && physicsSystem_ != nullptr;
+    for (EntityID entity : entities) {
+        if (!hasRequiredComponents(entity, entityManager)) {
+            continue;
+        }
+        auto& controller = entityManager.getComponent<CharacterControllerComponent>(entity);
+        const auto& transform = entityManager.getComponent<Transform>(entity);
+
+        CharacterBatchEntry entry;
+        entry.entity = entity;
+        entry.firstRay = groundRays.size();
+
+        if (castGround) {
+            glm::vec3 rayStart = transform.position + glm::vec3(0.0f, controller.stepHeight, 0.0f);
+            float rayLength = controller.stepHeight + controller.groundCheckDistance;
+            for (const glm::vec2& offset : FOOTPRINT_OFFSETS) {
+                PhysicsSystem::RaycastRequest request;
+                request.origin = rayStart + glm::vec3(offset.x, 0.0f, offset.y) * controller.groundCheckRadius;
+                request.direction = glm::vec3(0.0f, -1.0f, 0.0f);
+                request.maxDistance = rayLength;
+                request.layerMask = groundLayerMask_;
+                groundRays.push_back(request);
+            }
+            entry.rayCount = GROUND_RAYS_PER_CHARACTER;
+        }
+
+        batchEntries_.push_back(entry);
+    }
+
+    // One blocking submit for the whole frame's characters; the batch is
+    // fanned out across the physics job system threads
+    std::vector<PhysicsSystem::RaycastHit> hits;
+    if (!groundRays.empty()) {
+        hits = physicsSystem_->raycastBatch(groundRays);
+        stats_.groundRaysSubmitted = groundRays.size();
+    }
+
+    // Resolve pass: reduce each character's ray slice to a ground
+    // contact, then advance its movement state and position
+    for (const CharacterBatchEntry& entry : batchEntries_) {
+        auto& controller = entityManager.getComponent<CharacterControllerComponent>(entry.entity);
+        auto& transform = entityManager.getComponent<Transform>(entry.entity);
+
+        GroundInfo ground;
+        for (size_t i = 0; i < entry.rayCount; ++i) {
+            const auto& hit = hits[entry.firstRay + i];
+            if (!hit.hit) {
+                continue;
+            }
+            float slopeAngle = glm::degrees(std::acos(glm::clamp(hit.normal.y, -1.0f, 1.0f)));
+            if (!controller.isSlopeWalkable(slopeAngle)) {
+                continue;
+            }
+            if (!ground.isGrounded || hit.distance < ground.distance) {
+                ground.isGrounded = true;
+                ground.groundPoint = hit.point;
+                ground.groundNormal = hit.normal;
+                ground.distance = hit.distance;
+                ground.slopeAngle = slopeAngle;
+            }
+        }
+        // Distances were measured from stepHeight above the feet
+        if (ground.isGrounded) {
+            ground.distance = std::max(0.0f, ground.distance - controller.stepHeight);
+            stats_.charactersGrounded++;
+        }
+
+        resolveCharacter(controller, transform, ground, deltaTime);
+        stats_.charactersProcessed++;
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    stats_.updateTimeMs = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+void CharacterControllerSystem::resolveCharacter(CharacterControllerComponent& controller,
+                                                 Transform& transform,
+                                                 const GroundInfo& ground,
+                                                 float deltaTime) {
+    controller.isGrounded = ground.isGrounded;
+    controller.groundNormal = ground.groundNormal;
+    controller.groundDistance = ground.distance;
+    controller.updateTiming(deltaTime);
+
+    updateMovementState(controller, ground);
+
+    // Horizontal movement toward the input direction; vertical velocity
+    // is owned by gravity and jumping below
+    glm::vec3 targetVelocity = controller.inputDirection * controller.getEffectiveSpeed();
+    targetVelocity.y = controller.velocity.y;
+    float rate = glm::length(glm::vec3(controller.inputDirection.x, 0.0f, controller.inputDirection.z)) > 0.0f
+                     ? controller.acceleration
+                     : controller.deceleration;
+    controller.velocity = applyAcceleration(controller.velocity, targetVelocity, rate, deltaTime);
+
+    if (controller.wantsToJump) {
+        handleJumping(controller);
+        controller.wantsToJump = false;
+    }
+    applyGravity(controller, deltaTime);
+
+    transform.position += controller.velocity * deltaTime;
+
+    // Snap down onto the contact while descending so characters track
+    // slopes and steps instead of staircasing through the air
+    if (controller.isGrounded && controller.velocity.y <= 0.0f) {
+        transform.position.y = ground.groundPoint.y;
+        controller.velocity.y = 0.0f;
+    }
+    transform.markDirty();
+}
+
+void CharacterControllerSystem::updateMovementState(CharacterControllerComponent& controller,
+                                                    const GroundInfo& ground) {
+    using MovementState = CharacterControllerComponent::MovementState;
+
+    if (controller.isInWater) {
+        controller.transitionToState(MovementState::Swimming);
+    } else if (controller.isOnClimbableSurface) {
+        controller.transitionToState(MovementState::Climbing);
+    } else if (ground.isGrounded) {
+        controller.transitionToState(MovementState::Grounded);
+    } else {
+        controller.transitionToState(MovementState::Airborne);
+    }
+}
+
+glm::vec3 CharacterControllerSystem::applyAcceleration(const glm::vec3& currentVelocity,
+                                                       const glm::vec3& targetVelocity,
+                                                       float acceleration,
+                                                       float deltaTime) {
+    glm::vec3 delta = targetVelocity - currentVelocity;
+    float maxStep = acceleration * deltaTime;
+    float deltaLength = glm::length(delta);
+    if (deltaLength <= maxStep || deltaLength < 1e-6f) {
+        return targetVelocity;
+    }
+    return currentVelocity + delta * (maxStep / deltaLength);
+}
+
+void CharacterControllerSystem::handleJumping(CharacterControllerComponent& controller) {
+    if (!controller.canJump()) {
+        return;
+    }
+    controller.velocity.y = controller.jumpForce;
+    controller.timeSinceJump = 0.0f;
+    controller.isGrounded = false;
+    controller.transitionToState(CharacterControllerComponent::MovementState::Airborne);
+}
+
+void CharacterControllerSystem::applyGravity(CharacterControllerComponent& controller, float deltaTime) {
+    if (controller.isGrounded && controller.velocity.y <= 0.0f) {
+        return;
+    }
+    controller.velocity += controller.getGravityVector() * deltaTime;
+    controller.velocity.y = std::max(controller.velocity.y, -controller.maxFallSpeed);
+}
+
+} // namespace VulkanMon
@@ -1,11 +1,9 @@
 #pragma once
 
-#include "../core/System.h"
-#include "../core/EntityManager.h"
+#include "../core/SystemImpl.h"
 #include "../components/CharacterControllerComponent.h"
 #include "../components/Transform.h"
-#include "../components/RigidBodyComponent.h"
-#include <memory>
+#include <vector>
 
 namespace VulkanMon {
 
@@ -19,13 +17,20 @@ class PhysicsSystem;
  * for any game type. Integrates with PhysicsSystem for ground detection and
  * physics-based movement.
  *
+ * The update is a batched two-pass solver: the gather pass collects every
+ * character's ground-probe rays into one request batch, a single
+ * raycastBatch call fans the whole batch across the physics job system,
+ * and the resolve pass consumes the hits to advance movement state and
+ * positions. Serial per-character casts pay Jolt's query entry cost per
+ * character; the batch pays it once for the player plus every NPC.
+ *
  * Key Features:
- * - Ground detection using raycasting
+ * - Ground detection via a batched footprint of downward rays
  * - Movement state management (grounded, airborne, swimming, etc.)
  * - Physics integration without coupling to game-specific logic
- * - Performance optimization for large numbers of characters
+ * - Scales to dozens of simultaneous characters per frame
  */
-class CharacterControllerSystem : public System {
+class CharacterControllerSystem : public System<Transform, CharacterControllerComponent> {
 public:
     CharacterControllerSystem() = default;
     ~CharacterControllerSystem() = default;
@@ -33,8 +38,9 @@ public:
     // System interface
     void update(float deltaTime, EntityManager& entityManager) override;
 
-    // Physics system integration
-    void setPhysicsSystem(std::shared_ptr<PhysicsSystem> physicsSystem) {
+    // Physics system integration (raw pointer - PhysicsSystem is owned
+    // by the World alongside this system)
+    void setPhysicsSystem(PhysicsSystem* physicsSystem) {
         physicsSystem_ = physicsSystem;
     }
 
@@ -42,35 +48,31 @@ public:
     void setGroundDetectionEnabled(bool enabled) { groundDetectionEnabled_ = enabled; }
     void setGroundLayerMask(uint32_t layerMask) { groundLayerMask_ = layerMask; }
 
-    // Performance settings
-    void setUpdateFrequency(float frequency) { updateFrequency_ = frequency; }
-    void setMaxProcessingDistance(float distance) { maxProcessingDistance_ = distance; }
+    // Statistics (for debugging/profiling)
+    struct SystemStats {
+        size_t charactersProcessed = 0;
+        size_t groundRaysSubmitted = 0;
+        size_t charactersGrounded = 0;
+        float updateTimeMs = 0.0f;
+    };
+    const SystemStats& getStats() const { return stats_; }
+    void resetStats() { stats_ = SystemStats{}; }
+
+    // Rays per character in the ground batch: one through the capsule
+    // center plus four around the groundCheckRadius footprint, so edge
+    // standing and slope transitions resolve without a full shape cast
+    static constexpr uint32_t GROUND_RAYS_PER_CHARACTER = 5;
 
 private:
-    // Core processing methods
-    void processCharacterController(EntityID entity,
-                                  CharacterControllerComponent& controller,
-                                  Transform& transform,
-                                  EntityManager& entityManager,
-                                  float deltaTime);
-
-    void updateGroundDetection(EntityID entity,
-                             CharacterControllerComponent& controller,
-                             const Transform& transform);
-
-    void updateMovementState(CharacterControllerComponent& controller, float deltaTime);
-
-    void applyMovement(EntityID entity,
-                      CharacterControllerComponent& controller,
-                      Transform& transform,
-                      EntityManager& entityManager,
-                      float deltaTime);
-
-    void applyPhysicsForces(EntityID entity,
-                           const CharacterControllerComponent& controller,
-                           EntityManager& entityManager);
-
-    // Ground detection helpers
+    // Gather pass bookkeeping: which slice of the shared request batch
+    // belongs to which character
+    struct CharacterBatchEntry {
+        EntityID entity;
+        size_t firstRay = 0;
+        size_t rayCount = 0;
+    };
+
+    // Resolved ground contact for one character (best hit of its slice)
     struct GroundInfo {
         bool isGrounded = false;
         glm::vec3 groundPoint{0.0f};
@@ -79,54 +81,33 @@ private:
         float slopeAngle = 0.0f;
     };
 
-    GroundInfo performGroundCheck(const glm::vec3& position,
-                                 const CharacterControllerComponent& controller);
+    // Resolve pass
+    void resolveCharacter(CharacterControllerComponent& controller,
+                          Transform& transform,
+                          const GroundInfo& ground,
+                          float deltaTime);
 
-    bool isPointOnGround(const glm::vec3& point,
-                        const CharacterControllerComponent& controller);
+    void updateMovementState(CharacterControllerComponent& controller,
+                             const GroundInfo& ground);
 
     // Movement calculation helpers
-    glm::vec3 calculateDesiredVelocity(const CharacterControllerComponent& controller);
-
     glm::vec3 applyAcceleration(const glm::vec3& currentVelocity,
-                               const glm::vec3& targetVelocity,
-                               float acceleration,
-                               float deltaTime);
-
-    void handleJumping(CharacterControllerComponent& controller, float deltaTime);
+                                const glm::vec3& targetVelocity,
+                                float acceleration,
+                                float deltaTime);
 
+    void handleJumping(CharacterControllerComponent& controller);
     void applyGravity(CharacterControllerComponent& controller, float deltaTime);
 
-    // Balance and stability
-    void applyAutoBalance(EntityID entity,
-                         const CharacterControllerComponent& controller,
-                         EntityManager& entityManager);
-
-    // Performance optimization
-    bool shouldProcessEntity(EntityID entity, const Transform& transform);
-
     // Configuration
-    std::shared_ptr<PhysicsSystem> physicsSystem_;
+    PhysicsSystem* physicsSystem_ = nullptr;
     bool groundDetectionEnabled_ = true;
     uint32_t groundLayerMask_ = 0xFFFFFFFF; // Default to all layers
 
-    // Performance settings
-    float updateFrequency_ = 60.0f;  // Updates per second
-    float maxProcessingDistance_ = 100.0f; // Max distance to process characters
-    float lastUpdateTime_ = 0.0f;
+    // Gather-pass scratch, reused across frames
+    std::vector<CharacterBatchEntry> batchEntries_;
 
-    // Statistics (for debugging/profiling)
-    struct SystemStats {
-        int charactersProcessed = 0;
-        int groundChecksPerformed = 0;
-        float averageProcessingTime = 0.0f;
-        int charactersSkippedDistance = 0;
-    } stats_;
-
-public:
-    // Debug/profiling interface
-    const SystemStats& getStats() const { return stats_; }
-    void resetStats() { stats_ = SystemStats{}; }
+    SystemStats stats_;
 };
 
-} // namespace VulkanMon
\ No newline at end of file
+} // namespace VulkanMon
@@ -10,11 +10,12 @@ CreatureRenderSystem::CreatureRenderSystem(CameraSystem* cameraSystem, SpatialSy
     VKMON_INFO("CreatureRenderSystem initialized - GPU instancing enabled");
     VKMON_INFO("Target performance: 200+ creatures at 60+ FPS");
 
-    // Pre-reserve space for common batch counts
-    // DESIGN DECISION: Using std::map for deterministic batch ordering
-    // Trade-off: No reserve() capability vs guaranteed consistent iteration order
-    // Scale: Expected <20 batches, so O(log n) vs O(1) performance difference is negligible
-    // Priority: Deterministic rendering > micro-performance optimization
+    // DESIGN DECISION: Batches live in a sorted flat vector keyed by
+    // packed (mesh handle, material) integers. Iteration order stays
+    // deterministic - which the instance buffer layout depends on - and
+    // lookups compare integers instead of strings.
+    // Scale: Expected <20 batches, so linear probing of a sorted vector
+    // beats tree or hash overhead anyway
 }
 
 void CreatureRenderSystem::update(float deltaTime, EntityManager& entityManager) {
@@ -59,6 +60,11 @@ void CreatureRenderSystem::render(VulkanRenderer& renderer, EntityManager& entit
     // CRITICAL: Clear instance buffer for new frame (prevents ghost instances)
     renderer.clearInstanceBuffer();
 
+    // Flip to this frame's batch buffer; the other keeps the previous
+    // frame's snapshot intact for any consumer still reading it
+    batchWrite_ ^= 1;
+    clearBatches();
+
     auto frameStart = std::chrono::high_resolution_clock::now();
 
     // Step 1: Get camera position for distance calculations
@@ -81,13 +87,14 @@ void CreatureRenderSystem::render(VulkanRenderer& renderer, EntityManager& entit
 
     // Step 3: Build instanced batches from visible creatures
     auto batchStart = std::chrono::high_resolution_clock::now();
-    buildInstanceBatches(visibleCreatures, entityManager, cameraPos);
+    buildInstanceBatches(renderer, visibleCreatures, entityManager, cameraPos);
     auto batchEnd = std::chrono::high_resolution_clock::now();
 
     frameStats_.batchingTimeMs = std::chrono::duration<float, std::milli>(batchEnd - batchStart).count();
-    frameStats_.instanceBatches = instanceBatches_.size();
+    frameStats_.instanceBatches = writeBatches().size();
 
-    // Step 4: Render all instanced batches
+    // Step 4: Render all instanced batches - consumes only the batch
+    // snapshot, never live ECS state
     auto renderStart = std::chrono::high_resolution_clock::now();
     renderInstanceBatches(renderer);
     auto renderEnd = std::chrono::high_resolution_clock::now();
@@ -103,9 +110,6 @@ void CreatureRenderSystem::render(VulkanRenderer& renderer, EntityManager& entit
     if (renderFrameCount_ % LOG_EVERY_N_RENDERS == 0) {
         logPerformanceStats();
     }
-
-    // Clear batches for next frame
-    clearBatches();
 }
 
 std::vector<EntityID> CreatureRenderSystem::collectVisibleCreatures(EntityManager& entityManager, const glm::vec3& cameraPos) {
@@ -120,7 +124,8 @@ std::vector<EntityID> CreatureRenderSystem::collectVisibleCreatures(EntityManage
         #endif
     } else {
         // Fallback: Get all creatures
-        candidates = entityManager.getEntitiesWithComponent<CreatureComponent>();
+        const auto& allCreatures = entityManager.getEntitiesWithComponent<CreatureComponent>();
+        candidates.assign(allCreatures.begin(), allCreatures.end());
 
         #ifdef DEBUG_VERBOSE
         VKMON_DEBUG("Using fallback: " + std::to_string(candidates.size()) + " total creatures");
@@ -141,13 +146,14 @@ std::vector<EntityID> CreatureRenderSystem::collectVisibleCreatures(EntityManage
 
 std::vector<EntityID> CreatureRenderSystem::performFrustumCulling(EntityManager& entityManager) {
     try {
-        Frustum cameraFrustum = cameraSystem_->getActiveCameraFrustum(entityManager);
+        const Frustum& cameraFrustum = cameraSystem_->getActiveCameraFrustum(entityManager);
 
         // Query spatial system for creatures in camera frustum
         return spatialSystem_->queryFrustum(cameraFrustum, LayerMask::Creatures);
     } catch (const std::exception& e) {
         VKMON_WARNING("Frustum culling failed: " + std::string(e.what()) + " - falling back to all creatures");
-        return entityManager.getEntitiesWithComponent<CreatureComponent>();
+        const auto& allCreatures = entityManager.getEntitiesWithComponent<CreatureComponent>();
+        return {allCreatures.begin(), allCreatures.end()};
     }
 }
 
@@ -180,7 +186,8 @@ std::vector<EntityID> CreatureRenderSystem::performDistanceCulling(const std::ve
     return visibleCreatures;
 }
 
-void CreatureRenderSystem::buildInstanceBatches(const std::vector<EntityID>& visibleCreatures,
+void CreatureRenderSystem::buildInstanceBatches(VulkanRenderer& renderer,
+                                               const std::vector<EntityID>& visibleCreatures,
                                                EntityManager& entityManager,
                                                const glm::vec3& cameraPos) {
     // Pre-reserve batch capacity for performance
@@ -193,26 +200,47 @@ void CreatureRenderSystem::buildInstanceBatches(const std::vector<EntityID>& vis
         }
 
         const Transform& transform = entityManager.getComponent<Transform>(entity);
-        const Renderable& renderable = entityManager.getComponent<Renderable>(entity);
+        Renderable& renderable = entityManager.getComponent<Renderable>(entity);
 
-        // Calculate distance for LOD (future enhancement)
+        // Select the LOD from camera distance (already computed for culling)
+        // and clamp to the variant files that actually exist for this mesh.
+        // The resolve cache keys on interned handles, so the per-creature
+        // cost is one integer map lookup instead of path probing and
+        // string concatenation
         float distance = glm::length(transform.position - cameraPos);
-
-        // Create instance data
+        uint32_t desiredLod = selectLodLevel(distance, renderable.lodDistance);
+
+        AssetID baseMeshId = renderable.meshId;
+        uint64_t lodKey = (static_cast<uint64_t>(baseMeshId.value()) << 32) | desiredLod;
+        auto lodIt = lodResolveCache_.find(lodKey);
+        if (lodIt == lodResolveCache_.end()) {
+            uint32_t resolvedLevel = renderer.resolveCreatureLod(renderable.meshPath(), desiredLod);
+            AssetID lodMeshId = AssetID::intern(
+                ModelLoader::lodVariantPath(renderable.meshPath(), resolvedLevel));
+            lodIt = lodResolveCache_.emplace(lodKey, ResolvedLod{resolvedLevel, lodMeshId}).first;
+        }
+        uint32_t lodLevel = lodIt->second.level;
+        renderable.currentLod = lodLevel; // Inspector shows live selection
+
+        // Create compressed instance data. Uniform scale takes the
+        // largest axis so the cull sphere stays conservative if a
+        // transform drifts slightly non-uniform
+        float uniformScale = std::max(transform.scale.x,
+                             std::max(transform.scale.y, transform.scale.z));
         InstanceData instanceData(
-            transform.getModelMatrix(),
+            transform.position,
+            transform.rotation,
+            uniformScale,
             renderable.materialId,
-            0.0f // LOD level - will be calculated later
+            static_cast<float>(lodLevel)
         );
+        instanceData.materialParams.w = distance;
 
-        // Generate batch key (mesh + material combination)
-        std::string batchKey = generateBatchKey(renderable.meshPath, renderable.materialId);
-
-        // Add to appropriate batch
-        auto& batch = instanceBatches_[batchKey];
-        if (batch.meshPath.empty()) {
+        // Add to the batch for this (LOD mesh, material) combination
+        auto& batch = findOrCreateBatch(makeBatchKey(lodIt->second.meshId, renderable.materialId));
+        if (!batch.meshId.valid()) {
             // Initialize new batch
-            batch.meshPath = renderable.meshPath;
+            batch.meshId = lodIt->second.meshId;
             batch.baseMaterialId = renderable.materialId;
         }
 
@@ -223,7 +251,7 @@ void CreatureRenderSystem::buildInstanceBatches(const std::vector<EntityID>& vis
 void CreatureRenderSystem::renderInstanceBatches(VulkanRenderer& renderer) {
     frameStats_.totalDrawCalls = 0;
 
-    for (auto& [batchKey, batch] : instanceBatches_) {
+    for (auto& [batchKey, batch] : writeBatches()) {
         if (batch.empty()) {
             continue;
         }
@@ -234,7 +262,7 @@ void CreatureRenderSystem::renderInstanceBatches(VulkanRenderer& renderer) {
 
         try {
             // ENHANCED ERROR HANDLING: Graceful batch rendering with recovery
-            renderer.renderInstancedCreatures(batch.meshPath, batch.instances, batch.baseMaterialId);
+            renderer.renderInstancedCreatures(batch.meshId, batch.instances, batch.baseMaterialId);
 
             // Mark successful rendering
             renderSuccess = true;
@@ -242,7 +270,7 @@ void CreatureRenderSystem::renderInstanceBatches(VulkanRenderer& renderer) {
 
         } catch (const std::exception& e) {
             // ERROR RECOVERY: Log and continue with remaining batches
-            VKMON_ERROR("Batch rendering failed for " + batchKey + ": " + e.what());
+            VKMON_ERROR("Batch rendering failed for " + batch.meshId.str() + ": " + e.what());
             VKMON_WARNING("Continuing with remaining batches (graceful degradation)");
 
             // renderSuccess remains false - timing will reflect failure
@@ -259,7 +287,7 @@ void CreatureRenderSystem::renderInstanceBatches(VulkanRenderer& renderer) {
     }
 
     #ifdef DEBUG_VERBOSE
-    if (!instanceBatches_.empty()) {
+    if (!writeBatches().empty()) {
         VKMON_DEBUG("Rendered " + std::to_string(frameStats_.renderedCreatures) +
                    " creatures in " + std::to_string(frameStats_.instanceBatches) +
                    " batches with " + std::to_string(frameStats_.totalDrawCalls) + " draw calls");
@@ -268,26 +296,26 @@ void CreatureRenderSystem::renderInstanceBatches(VulkanRenderer& renderer) {
 }
 
 void CreatureRenderSystem::clearBatches() {
-    for (auto& [key, batch] : instanceBatches_) {
+    for (auto& [key, batch] : writeBatches()) {
         batch.clear();
     }
 }
 
 void CreatureRenderSystem::reserveBatchCapacity(const std::vector<EntityID>& entities, EntityManager& entityManager) {
     // Estimate batch sizes by counting meshes
-    std::unordered_map<std::string, size_t> meshCounts;
+    std::unordered_map<AssetID, size_t> meshCounts;
 
     for (EntityID entity : entities) {
         if (hasRequiredComponents(entity, entityManager)) {
-            const Renderable& renderable = entityManager.getComponent<Renderable>(entity);
-            meshCounts[renderable.meshPath]++;
+            Renderable& renderable = entityManager.getComponent<Renderable>(entity);
+            meshCounts[renderable.meshId]++;
         }
     }
 
     // Reserve capacity for each batch
-    for (const auto& [meshPath, count] : meshCounts) {
-        for (auto& [batchKey, batch] : instanceBatches_) {
-            if (batch.meshPath == meshPath) {
+    for (const auto& [meshId, count] : meshCounts) {
+        for (auto& [batchKey, batch] : writeBatches()) {
+            if (batch.meshId == meshId) {
                 batch.reserve(count);
                 break;
             }
@@ -295,8 +323,14 @@ void CreatureRenderSystem::reserveBatchCapacity(const std::vector<EntityID>& ent
     }
 }
 
-std::string CreatureRenderSystem::generateBatchKey(const std::string& meshPath, uint32_t materialId) const {
-    return meshPath + "_mat" + std::to_string(materialId);
+InstancedBatch& CreatureRenderSystem::findOrCreateBatch(uint64_t batchKey) {
+    BatchBuffer& batches = writeBatches();
+    auto it = std::lower_bound(batches.begin(), batches.end(), batchKey,
+                               [](const auto& entry, uint64_t key) { return entry.first < key; });
+    if (it == batches.end() || it->first != batchKey) {
+        it = batches.insert(it, {batchKey, InstancedBatch{}});
+    }
+    return it->second;
 }
 
 void CreatureRenderSystem::logPerformanceStats() {
@@ -317,18 +351,19 @@ void CreatureRenderSystem::logPerformanceStats() {
 
 std::vector<std::string> CreatureRenderSystem::getBatchMeshPaths() const {
     std::vector<std::string> paths;
-    paths.reserve(instanceBatches_.size());
+    paths.reserve(writeBatches().size());
 
-    for (const auto& [key, batch] : instanceBatches_) {
-        paths.push_back(batch.meshPath);
+    for (const auto& [key, batch] : writeBatches()) {
+        paths.push_back(batch.meshId.str());
     }
 
     return paths;
 }
 
 const InstancedBatch* CreatureRenderSystem::getBatch(const std::string& meshPath) const {
-    for (const auto& [key, batch] : instanceBatches_) {
-        if (batch.meshPath == meshPath) {
+    AssetID meshId = AssetID::intern(meshPath);
+    for (const auto& [key, batch] : writeBatches()) {
+        if (batch.meshId == meshId) {
             return &batch;
         }
     }
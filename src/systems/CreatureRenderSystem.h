@@ -11,9 +11,9 @@
 #include "SpatialSystem.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <array>
 #include <vector>
 #include <unordered_map>
-#include <map>
 #include <string>
 #include <memory>
 #include <chrono>
@@ -24,7 +24,7 @@ namespace VulkanMon {
 // InstanceData is defined in VulkanRenderer.h
 // Batch of identical creatures for instanced rendering
 struct InstancedBatch {
-    std::string meshPath;
+    AssetID meshId;
     uint32_t baseMaterialId;
     std::vector<InstanceData> instances;
     std::vector<EntityID> entityIds;  // For debugging/selection
@@ -102,10 +102,34 @@ private:
     CameraSystem* cameraSystem_ = nullptr;   // Safe: World guarantees lifetime
     SpatialSystem* spatialSystem_ = nullptr; // Safe: World guarantees lifetime
 
-    // Instanced rendering data
-    // ROBUSTNESS FIX: Use std::map for deterministic batch ordering
-    // This ensures consistent instance buffer layout across runs
-    std::map<std::string, InstancedBatch> instanceBatches_;
+    // Instanced rendering data, keyed by packed (mesh handle, material)
+    // and kept sorted so iteration order - and therefore instance buffer
+    // layout - stays deterministic, which the old std::map<std::string>
+    // bought at the cost of string compares on every creature every frame.
+    // A sorted flat vector keeps the determinism with integer compares
+    // and contiguous iteration.
+    //
+    // Double-buffered: extraction snapshots into one buffer while the
+    // other holds the previous frame's batches untouched, so command
+    // recording can consume a stable packet off-thread. Both buffers
+    // keep their per-batch capacity across frames (<20 batches, so the
+    // duplication is cheap)
+    using BatchBuffer = std::vector<std::pair<uint64_t, InstancedBatch>>;
+    std::array<BatchBuffer, 2> batchBuffers_;
+    uint32_t batchWrite_ = 0;
+
+    BatchBuffer& writeBatches() { return batchBuffers_[batchWrite_]; }
+    const BatchBuffer& writeBatches() const { return batchBuffers_[batchWrite_]; }
+
+    // (base mesh, desired LOD) -> resolved level and interned variant
+    // path. Variant availability is fixed once files are probed, so the
+    // string work (clampToAvailableLod + lodVariantPath + intern) runs
+    // once per combination instead of once per creature per frame
+    struct ResolvedLod {
+        uint32_t level;
+        AssetID meshId;
+    };
+    std::unordered_map<uint64_t, ResolvedLod> lodResolveCache_;
 
     // Performance and configuration
     CreatureRenderStats frameStats_;
@@ -154,15 +178,26 @@ public:
     const CreatureRenderStats& getFrameStats() const { return frameStats_; }
     void logPerformanceStats();
 
-    // Debug and inspection
-    size_t getBatchCount() const { return instanceBatches_.size(); }
+    // Distance-based LOD selection, driven by the same per-entity
+    // lodDistance the Inspector exposes (which is also the cull distance):
+    // full detail inside 25% of it, first LOD inside 50%, deepest beyond.
+    // Returned levels stay below ModelLoader::MAX_LOD_LEVELS; missing
+    // variant files clamp down at resolve time.
+    static uint32_t selectLodLevel(float distance, float lodDistance) {
+        if (lodDistance <= 0.0f || distance < lodDistance * 0.25f) return 0;
+        if (distance < lodDistance * 0.5f) return 1;
+        return 2;
+    }
+
+    // Debug and inspection (read the last extracted buffer)
+    size_t getBatchCount() const { return writeBatches().size(); }
     std::vector<std::string> getBatchMeshPaths() const;
     const InstancedBatch* getBatch(const std::string& meshPath) const;
 
 private:
     // Core rendering pipeline
     std::vector<EntityID> collectVisibleCreatures(EntityManager& entityManager, const glm::vec3& cameraPos);
-    void buildInstanceBatches(const std::vector<EntityID>& visibleCreatures, EntityManager& entityManager, const glm::vec3& cameraPos);
+    void buildInstanceBatches(VulkanRenderer& renderer, const std::vector<EntityID>& visibleCreatures, EntityManager& entityManager, const glm::vec3& cameraPos);
     void renderInstanceBatches(VulkanRenderer& renderer);
 
     // Culling operations
@@ -172,7 +207,15 @@ private:
     // Batch management
     void clearBatches();
     void reserveBatchCapacity(const std::vector<EntityID>& entities, EntityManager& entityManager);
-    std::string generateBatchKey(const std::string& meshPath, uint32_t materialId) const;
+
+    // Mesh handle in the high bits, material in the low - instances of
+    // the same creature at different LOD levels draw different geometry,
+    // so the LOD variant's own handle is what goes into the key
+    static uint64_t makeBatchKey(AssetID meshId, uint32_t materialId) {
+        return (static_cast<uint64_t>(meshId.value()) << 32) | materialId;
+    }
+
+    InstancedBatch& findOrCreateBatch(uint64_t batchKey);
 
     // Performance utilities (none needed - frame counter handles this)
 };
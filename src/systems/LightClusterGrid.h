@@ -0,0 +1,198 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace VulkanMon {
+
+// GPU-layout point light: two vec4s, matching the std430 PointLight
+// struct in the fragment shaders. Radius is the influence radius -
+// attenuation reaches zero there, so the binning is exact, not a bias
+struct PointLight {
+    glm::vec4 positionRadius;   // xyz world position, w influence radius
+    glm::vec4 colorIntensity;   // rgb linear color, a intensity multiplier
+
+    PointLight() : positionRadius(0.0f), colorIntensity(0.0f) {}
+    PointLight(const glm::vec3& position, float radius,
+               const glm::vec3& color, float intensity)
+        : positionRadius(position, radius), colorIntensity(color, intensity) {}
+};
+
+// Froxel grid binning for clustered forward (Forward+) shading
+//
+// View space is carved into a 16x9x24 grid: uniform screen tiles in
+// X/Y, exponential slices in Z so near clusters stay small where
+// geometry density is highest. Each frame the active point lights are
+// binned into the clusters their influence sphere touches, producing
+// two flat GPU arrays: a per-cluster (offset, count) range and a packed
+// light index list. The fragment shader derives its cluster from
+// gl_FragCoord plus view depth and iterates only that cluster's lights.
+//
+// Binning runs on the CPU - at the engine's light budget (256) it is a
+// few microseconds, and the buffer layout is exactly what a compute
+// binner would produce, so moving the pass onto the GPU later (the
+// creature cull pass is the template) changes no shader code.
+namespace LightClusterGrid {
+
+    constexpr uint32_t DIM_X = 16;
+    constexpr uint32_t DIM_Y = 9;
+    constexpr uint32_t DIM_Z = 24;
+    constexpr uint32_t CLUSTER_COUNT = DIM_X * DIM_Y * DIM_Z;
+
+    constexpr uint32_t MAX_POINT_LIGHTS = 256;
+    constexpr uint32_t MAX_LIGHT_INDICES = 64 * 1024;
+
+    // uvec2 in the shader: x = offset into the index list, y = count
+    struct ClusterRange {
+        uint32_t offset = 0;
+        uint32_t count = 0;
+    };
+
+    inline uint32_t clusterIndex(uint32_t x, uint32_t y, uint32_t z) {
+        return (z * DIM_Y + y) * DIM_X + x;
+    }
+
+    namespace detail {
+        // Grid-cell bounds of one light's influence sphere. Y follows
+        // screen convention (0 at the top), matching gl_FragCoord
+        struct CellBounds {
+            uint32_t minX, maxX, minY, maxY, minZ, maxZ;
+            bool visible = false;
+
+            uint32_t cellCount() const {
+                return (maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1);
+            }
+        };
+
+        inline uint32_t depthSlice(float viewZ, float zNear, float invLogDepthRange) {
+            float slice = std::log(std::max(viewZ, zNear) / zNear) * invLogDepthRange * DIM_Z;
+            return std::min(static_cast<uint32_t>(std::max(slice, 0.0f)), DIM_Z - 1);
+        }
+
+        inline CellBounds computeBounds(const PointLight& light, const glm::mat4& view,
+                                        float tanHalfFovY, float aspect,
+                                        float zNear, float zFar, float invLogDepthRange) {
+            CellBounds bounds{};
+
+            glm::vec3 viewPos = glm::vec3(view * glm::vec4(glm::vec3(light.positionRadius), 1.0f));
+            float radius = light.positionRadius.w;
+            float viewZ = -viewPos.z;  // camera looks down -Z
+
+            if (radius <= 0.0f || viewZ + radius < zNear || viewZ - radius > zFar) {
+                return bounds;
+            }
+
+            bounds.minZ = depthSlice(viewZ - radius, zNear, invLogDepthRange);
+            bounds.maxZ = depthSlice(viewZ + radius, zNear, invLogDepthRange);
+
+            // Screen extent is widest at the sphere's closest depth -
+            // conservative for the rest of the slice range
+            float closestZ = std::max(viewZ - radius, zNear);
+            float halfHeight = closestZ * tanHalfFovY;
+            float halfWidth = halfHeight * aspect;
+
+            // Normalized [0,1] screen coordinates, Y flipped to match
+            // Vulkan's top-left origin
+            float uMin = ((viewPos.x - radius) / halfWidth + 1.0f) * 0.5f;
+            float uMax = ((viewPos.x + radius) / halfWidth + 1.0f) * 0.5f;
+            float vMin = (1.0f - (viewPos.y + radius) / halfHeight) * 0.5f;
+            float vMax = (1.0f - (viewPos.y - radius) / halfHeight) * 0.5f;
+
+            if (uMax < 0.0f || uMin > 1.0f || vMax < 0.0f || vMin > 1.0f) {
+                return bounds;
+            }
+
+            auto toCell = [](float t, uint32_t dim) {
+                float clamped = std::clamp(t, 0.0f, 1.0f);
+                return std::min(static_cast<uint32_t>(clamped * dim), dim - 1);
+            };
+            bounds.minX = toCell(uMin, DIM_X);
+            bounds.maxX = toCell(uMax, DIM_X);
+            bounds.minY = toCell(vMin, DIM_Y);
+            bounds.maxY = toCell(vMax, DIM_Y);
+            bounds.visible = true;
+            return bounds;
+        }
+    } // namespace detail
+
+    // Bin `lightCount` (<= MAX_POINT_LIGHTS) lights into the cluster
+    // grid. `ranges` must hold CLUSTER_COUNT entries, `indices` at least
+    // `indexCapacity`. Lights whose cells would overflow the index list
+    // are dropped whole, keeping every written range consistent.
+    // Returns the number of indices written.
+    inline size_t binPointLights(const PointLight* lights, size_t lightCount,
+                                 const glm::mat4& view, float tanHalfFovY, float aspect,
+                                 float zNear, float zFar,
+                                 ClusterRange* ranges,
+                                 uint32_t* indices, size_t indexCapacity,
+                                 size_t* droppedLights = nullptr) {
+        std::fill(ranges, ranges + CLUSTER_COUNT, ClusterRange{});
+        if (droppedLights) {
+            *droppedLights = 0;
+        }
+        if (lightCount == 0 || zFar <= zNear || zNear <= 0.0f) {
+            return 0;
+        }
+
+        float invLogDepthRange = 1.0f / std::log(zFar / zNear);
+
+        // Bounds for every light up front; drop whole lights once the
+        // index budget is spent
+        detail::CellBounds bounds[MAX_POINT_LIGHTS];
+        lightCount = std::min(lightCount, static_cast<size_t>(MAX_POINT_LIGHTS));
+
+        size_t totalIndices = 0;
+        for (size_t i = 0; i < lightCount; ++i) {
+            bounds[i] = detail::computeBounds(lights[i], view, tanHalfFovY, aspect,
+                                              zNear, zFar, invLogDepthRange);
+            if (!bounds[i].visible) {
+                continue;
+            }
+            if (totalIndices + bounds[i].cellCount() > indexCapacity) {
+                bounds[i].visible = false;
+                if (droppedLights) {
+                    (*droppedLights)++;
+                }
+                continue;
+            }
+            totalIndices += bounds[i].cellCount();
+        }
+
+        // Counting pass
+        for (size_t i = 0; i < lightCount; ++i) {
+            if (!bounds[i].visible) continue;
+            for (uint32_t z = bounds[i].minZ; z <= bounds[i].maxZ; ++z)
+                for (uint32_t y = bounds[i].minY; y <= bounds[i].maxY; ++y)
+                    for (uint32_t x = bounds[i].minX; x <= bounds[i].maxX; ++x)
+                        ranges[clusterIndex(x, y, z)].count++;
+        }
+
+        // Prefix sum into offsets; counts reset and reused as cursors
+        uint32_t running = 0;
+        for (uint32_t c = 0; c < CLUSTER_COUNT; ++c) {
+            ranges[c].offset = running;
+            running += ranges[c].count;
+            ranges[c].count = 0;
+        }
+
+        // Fill pass
+        for (size_t i = 0; i < lightCount; ++i) {
+            if (!bounds[i].visible) continue;
+            for (uint32_t z = bounds[i].minZ; z <= bounds[i].maxZ; ++z)
+                for (uint32_t y = bounds[i].minY; y <= bounds[i].maxY; ++y)
+                    for (uint32_t x = bounds[i].minX; x <= bounds[i].maxX; ++x) {
+                        ClusterRange& range = ranges[clusterIndex(x, y, z)];
+                        indices[range.offset + range.count] = static_cast<uint32_t>(i);
+                        range.count++;
+                    }
+        }
+
+        return totalIndices;
+    }
+
+} // namespace LightClusterGrid
+
+} // namespace VulkanMon
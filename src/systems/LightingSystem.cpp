@@ -1,6 +1,7 @@
 #include "LightingSystem.h"
 #include "../rendering/ResourceManager.h"
 #include "../utils/Logger.h"
+#include <cmath>
 #include <cstring>
 
 using namespace VulkanMon;
@@ -38,7 +39,9 @@ void LightingSystem::createLightingBuffers() {
     
     lightingBuffer = lightingBufferManaged->getBuffer();
     lightingBufferMemory = lightingBufferManaged->getMemory();
-    
+
+    createClusterBuffers();
+
     createDescriptorSetLayout();
     createDescriptorPool();
     createDescriptorSet();
@@ -49,6 +52,40 @@ void LightingSystem::createLightingBuffers() {
     VKMON_INFO("LightingSystem buffers created successfully");
 }
 
+void LightingSystem::createClusterBuffers() {
+    VKMON_INFO("Creating clustered lighting storage buffers");
+
+    using namespace LightClusterGrid;
+
+    // CPU staging sized once; rebinning reuses it every frame
+    clusterRanges.resize(CLUSTER_COUNT);
+    lightIndices.resize(MAX_LIGHT_INDICES);
+
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    const VkMemoryPropertyFlags properties =
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    pointLightBufferManaged = resourceManager->createBuffer(
+        MAX_POINT_LIGHTS * sizeof(PointLight), usage, properties, "PointLightBuffer");
+    clusterRangeBufferManaged = resourceManager->createBuffer(
+        CLUSTER_COUNT * sizeof(ClusterRange), usage, properties, "ClusterRangeBuffer");
+    lightIndexBufferManaged = resourceManager->createBuffer(
+        MAX_LIGHT_INDICES * sizeof(uint32_t), usage, properties, "ClusterLightIndexBuffer");
+
+    if (!pointLightBufferManaged || !clusterRangeBufferManaged || !lightIndexBufferManaged) {
+        throw std::runtime_error("Failed to create clustered lighting buffers");
+    }
+
+    pointLightBuffer = pointLightBufferManaged->getBuffer();
+    clusterRangeBuffer = clusterRangeBufferManaged->getBuffer();
+    lightIndexBuffer = lightIndexBufferManaged->getBuffer();
+
+    // Zeroed ranges mean "no lights" - the shaders are safe to run
+    // before the first updateClusters()
+    clusterRangeBufferManaged->updateData(clusterRanges.data(),
+                                          CLUSTER_COUNT * sizeof(ClusterRange));
+}
+
 void LightingSystem::createDescriptorSetLayout() {
     VkDescriptorSetLayoutBinding lightingLayoutBinding{};
     lightingLayoutBinding.binding = 0;
@@ -144,23 +181,10 @@ void LightingSystem::updateDescriptorSet() {
 void LightingSystem::updateLighting(const LightingData& lightingData) {
     currentLighting = lightingData;
     
-    void* data;
-    VkResult result = vkMapMemory(
-        resourceManager->getDevice(),
-        lightingBufferMemory,
-        0,
-        sizeof(LightingData),
-        0,
-        &data
-    );
-    
-    if (result != VK_SUCCESS) {
-        VKMON_ERROR("Failed to map lighting buffer memory");
-        return;
-    }
-    
-    std::memcpy(data, &currentLighting, sizeof(LightingData));
-    vkUnmapMemory(resourceManager->getDevice(), lightingBufferMemory);
+    // Write through the wrapper: with sub-allocated memory the buffer
+    // lives at an offset inside a shared block, so mapping the raw
+    // VkDeviceMemory at offset 0 would hit another resource's data
+    lightingBufferManaged->updateData(&currentLighting, sizeof(LightingData));
 }
 
 void LightingSystem::setDirectionalLight(const glm::vec3& direction, float intensity, const glm::vec3& color) {
@@ -180,6 +204,63 @@ void LightingSystem::setAmbientLight(const glm::vec3& color, float intensity) {
     VKMON_DEBUG("Updated ambient light");
 }
 
+void LightingSystem::setPointLights(const std::vector<VulkanMon::PointLight>& lights) {
+    using namespace LightClusterGrid;
+
+    pointLights = lights;
+    if (pointLights.size() > MAX_POINT_LIGHTS) {
+        VKMON_WARNING("LightingSystem: " + std::to_string(pointLights.size()) +
+                      " point lights exceeds budget of " + std::to_string(MAX_POINT_LIGHTS) +
+                      " - extra lights dropped");
+        pointLights.resize(MAX_POINT_LIGHTS);
+    }
+
+    if (pointLightBufferManaged && !pointLights.empty()) {
+        pointLightBufferManaged->updateData(pointLights.data(),
+                                            pointLights.size() * sizeof(PointLight));
+    }
+}
+
+void LightingSystem::updateClusters(const glm::mat4& viewMatrix, const glm::mat4& projMatrix,
+                                    float screenWidth, float screenHeight) {
+    using namespace LightClusterGrid;
+
+    if (!clusterRangeBufferManaged) {
+        return;
+    }
+
+    // Recover the perspective parameters from the (Vulkan-flipped)
+    // projection matrix: GLM's default -1..1 depth convention gives
+    // near = P32 / (P22 - 1) and far = P32 / (P22 + 1)
+    float tanHalfFovY = 1.0f / std::abs(projMatrix[1][1]);
+    float aspect = std::abs(projMatrix[1][1] / projMatrix[0][0]);
+    float p22 = projMatrix[2][2];
+    float p32 = projMatrix[3][2];
+    float zNear = p32 / (p22 - 1.0f);
+    float zFar = p32 / (p22 + 1.0f);
+
+    if (!(zFar > zNear) || zNear <= 0.0f) {
+        VKMON_WARNING("LightingSystem: could not recover near/far from projection - skipping cluster rebuild");
+        return;
+    }
+
+    size_t written = binPointLights(pointLights.data(), pointLights.size(),
+                                    viewMatrix, tanHalfFovY, aspect, zNear, zFar,
+                                    clusterRanges.data(),
+                                    lightIndices.data(), lightIndices.size());
+
+    clusterRangeBufferManaged->updateData(clusterRanges.data(),
+                                          CLUSTER_COUNT * sizeof(ClusterRange));
+    if (written > 0) {
+        lightIndexBufferManaged->updateData(lightIndices.data(),
+                                            written * sizeof(uint32_t));
+    }
+
+    // Publish the lookup parameters the fragment shaders need
+    currentLighting.clusterInfo = glm::vec4(zNear, zFar, screenWidth, screenHeight);
+    lightingBufferManaged->updateData(&currentLighting, sizeof(LightingData));
+}
+
 void LightingSystem::cleanup() {
     if (resourceManager && resourceManager->getDevice() != VK_NULL_HANDLE) {
         if (descriptorSetLayout != VK_NULL_HANDLE) {
@@ -195,6 +276,13 @@ void LightingSystem::cleanup() {
         lightingBufferManaged.reset();
         lightingBuffer = VK_NULL_HANDLE;
         lightingBufferMemory = VK_NULL_HANDLE;
+
+        pointLightBufferManaged.reset();
+        clusterRangeBufferManaged.reset();
+        lightIndexBufferManaged.reset();
+        pointLightBuffer = VK_NULL_HANDLE;
+        clusterRangeBuffer = VK_NULL_HANDLE;
+        lightIndexBuffer = VK_NULL_HANDLE;
     }
     
     VKMON_INFO("LightingSystem cleanup completed");
@@ -1,8 +1,11 @@
 #pragma once
 
+#include "LightClusterGrid.h"
+
 #include <glm/glm.hpp>
 #include <vulkan/vulkan.h>
 #include <memory>
+#include <vector>
 
 namespace VulkanMon {
     class ResourceManager;
@@ -25,9 +28,15 @@ struct LightingData {
     DirectionalLight directionalLight;
     glm::vec3 ambientColor;
     float ambientIntensity;
-    
-    LightingData() 
-        : directionalLight(), ambientColor(0.2f, 0.2f, 0.3f), ambientIntensity(0.3f) {}
+
+    // Cluster lookup parameters for the fragment shaders:
+    // x = zNear, y = zFar, z = screen width, w = screen height.
+    // Refreshed by updateClusters() each frame
+    glm::vec4 clusterInfo;
+
+    LightingData()
+        : directionalLight(), ambientColor(0.2f, 0.2f, 0.3f), ambientIntensity(0.3f)
+        , clusterInfo(0.1f, 100.0f, 1.0f, 1.0f) {}
 };
 
 class LightingSystem {
@@ -47,7 +56,22 @@ public:
     
     void setDirectionalLight(const glm::vec3& direction, float intensity, const glm::vec3& color);
     void setAmbientLight(const glm::vec3& color, float intensity);
-    
+
+    // Clustered point lights (torches, glow, spell effects). The set is
+    // uploaded once on change; updateClusters() rebins it per frame
+    void setPointLights(const std::vector<VulkanMon::PointLight>& lights);
+    const std::vector<VulkanMon::PointLight>& getPointLights() const { return pointLights; }
+
+    // Rebin the point lights against this frame's camera and upload the
+    // cluster grid. Called by the renderer right after the per-frame
+    // uniforms are written; expects the Vulkan-flipped projection matrix
+    void updateClusters(const glm::mat4& viewMatrix, const glm::mat4& projMatrix,
+                        float screenWidth, float screenHeight);
+
+    VkBuffer getPointLightBuffer() const { return pointLightBuffer; }
+    VkBuffer getClusterRangeBuffer() const { return clusterRangeBuffer; }
+    VkBuffer getLightIndexBuffer() const { return lightIndexBuffer; }
+
     void cleanup();
 
 private:
@@ -59,9 +83,23 @@ private:
     VkDescriptorSetLayout descriptorSetLayout;
     VkDescriptorPool descriptorPool;
     VkDescriptorSet descriptorSet;
-    
+
+    // Clustered lighting storage buffers (point light array, per-cluster
+    // ranges, packed light index list) plus their CPU-side staging
+    std::unique_ptr<VulkanMon::ManagedBuffer> pointLightBufferManaged;
+    std::unique_ptr<VulkanMon::ManagedBuffer> clusterRangeBufferManaged;
+    std::unique_ptr<VulkanMon::ManagedBuffer> lightIndexBufferManaged;
+    VkBuffer pointLightBuffer = VK_NULL_HANDLE;
+    VkBuffer clusterRangeBuffer = VK_NULL_HANDLE;
+    VkBuffer lightIndexBuffer = VK_NULL_HANDLE;
+
+    std::vector<VulkanMon::PointLight> pointLights;
+    std::vector<VulkanMon::LightClusterGrid::ClusterRange> clusterRanges;
+    std::vector<uint32_t> lightIndices;
+
     LightingData currentLighting;
-    
+
+    void createClusterBuffers();
     void createDescriptorSetLayout();
     void createDescriptorPool();
     void createDescriptorSet();
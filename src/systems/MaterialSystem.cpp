@@ -1,7 +1,9 @@
 #include "MaterialSystem.h"
+#include "../rendering/DescriptorAllocator.h"
 #include "../rendering/ResourceManager.h"
 #include "../io/ModelLoader.h"
 #include "../utils/Logger.h"
+#include <cstring>
 #include <stdexcept>
 
 namespace VulkanMon {
@@ -16,11 +18,37 @@ MaterialSystem::~MaterialSystem() {
 }
 
 void MaterialSystem::createMaterialBuffers() {
-    VKMON_DEBUG("MaterialSystem: Creating material descriptor pool");
+    VKMON_DEBUG("MaterialSystem: Creating material ring buffer and descriptor set");
     if (descriptorSetLayout == VK_NULL_HANDLE) {
         throw std::runtime_error("MaterialSystem: Descriptor set layout must be set before creating material buffers");
     }
-    createDescriptorPool();
+
+    // Each material slot must start at a legal dynamic uniform offset
+    VkPhysicalDeviceProperties properties{};
+    vkGetPhysicalDeviceProperties(resourceManager->getPhysicalDevice(), &properties);
+    VkDeviceSize minAlignment = properties.limits.minUniformBufferOffsetAlignment;
+    alignedStride_ = sizeof(MaterialData);
+    if (minAlignment > 0) {
+        alignedStride_ = (alignedStride_ + minAlignment - 1) & ~(minAlignment - 1);
+    }
+
+    // One region per frame in flight so Inspector edits never touch data
+    // the GPU is still reading
+    VkDeviceSize bufferSize = alignedStride_ * MAX_MATERIALS * FRAMES_IN_FLIGHT;
+    materialRingBuffer_ = resourceManager->createBuffer(
+        bufferSize,
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+    );
+    materialRingBuffer_->map();  // persistently mapped for per-frame uploads
+
+    if (!descriptorAllocator_) {
+        createDescriptorPool();
+    }
+    createDescriptorSet();
+
+    VKMON_DEBUG("MaterialSystem: Created material ring buffer (" + std::to_string(bufferSize) +
+                " bytes, stride " + std::to_string(alignedStride_) + ")");
 }
 
 void MaterialSystem::setDescriptorSetLayout(VkDescriptorSetLayout layout) {
@@ -28,159 +56,129 @@ void MaterialSystem::setDescriptorSetLayout(VkDescriptorSetLayout layout) {
     VKMON_DEBUG("MaterialSystem: Set external descriptor set layout");
 }
 
+void MaterialSystem::setDescriptorAllocator(VulkanMon::DescriptorAllocator* allocator) {
+    descriptorAllocator_ = allocator;
+    VKMON_DEBUG("MaterialSystem: Using pooled descriptor allocator");
+}
+
 // createDescriptorSetLayout() method removed - descriptor set layout is now provided by VulkanRenderer
 
 void MaterialSystem::createDescriptorPool() {
-    // Start with capacity for 16 materials, will expand as needed
-    ensureDescriptorPoolCapacity(16);
-}
-
-void MaterialSystem::ensureDescriptorPoolCapacity(size_t requiredCapacity) {
-    if (descriptorPool != VK_NULL_HANDLE && materials.capacity() >= requiredCapacity) {
-        return; // Current pool is sufficient
-    }
-    
-    // Clean up existing pool if it exists
-    if (descriptorPool != VK_NULL_HANDLE) {
-        VkDevice device = resourceManager->getDevice();
-        vkDestroyDescriptorPool(device, descriptorPool, nullptr);
-        VKMON_INFO("MaterialSystem: Destroyed old descriptor pool for expansion");
-    }
-    
-    // Create new pool with increased capacity
-    size_t poolSize = std::max(requiredCapacity, size_t(32));
-    
+    // A single dynamic uniform descriptor serves every material
     VkDescriptorPoolSize poolSizes{};
-    poolSizes.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    poolSizes.descriptorCount = static_cast<uint32_t>(poolSize);
+    poolSizes.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    poolSizes.descriptorCount = 1;
 
     VkDescriptorPoolCreateInfo poolInfo{};
     poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     poolInfo.poolSizeCount = 1;
     poolInfo.pPoolSizes = &poolSizes;
-    poolInfo.maxSets = static_cast<uint32_t>(poolSize);
-    poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    poolInfo.maxSets = 1;
 
     VkDevice device = resourceManager->getDevice();
     if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &descriptorPool) != VK_SUCCESS) {
         throw std::runtime_error("MaterialSystem: Failed to create descriptor pool");
     }
-    
-    VKMON_DEBUG("MaterialSystem: Created descriptor pool with capacity for " + std::to_string(poolSize) + " materials");
-    
-    // Reserve vector capacity to match descriptor pool
-    materials.reserve(poolSize);
-    
-    // Recreate descriptor sets for existing materials
-    for (size_t i = 0; i < materials.size(); ++i) {
-        createDescriptorSet(static_cast<uint32_t>(i));
+}
+
+void MaterialSystem::createDescriptorSet() {
+    if (descriptorAllocator_) {
+        // Pooled path: the allocator writes and caches the set keyed on
+        // (layout, ring buffer binding), so re-creating buffers after a
+        // device-level reset reuses the identical set
+        descriptorSet = descriptorAllocator_->getOrCreate(
+            descriptorSetLayout,
+            DescriptorAllocator::Bindings().addBuffer(
+                0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+                materialRingBuffer_->getBuffer(), 0, sizeof(MaterialData)));
+        return;
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = descriptorPool;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &descriptorSetLayout;
+
+    VkDevice device = resourceManager->getDevice();
+    if (vkAllocateDescriptorSets(device, &allocInfo, &descriptorSet) != VK_SUCCESS) {
+        throw std::runtime_error("MaterialSystem: Failed to allocate material descriptor set");
     }
+
+    // The range covers a single material; the dynamic offset provided at
+    // bind time selects which slot in the ring the shader reads
+    VkDescriptorBufferInfo bufferInfo{};
+    bufferInfo.buffer = materialRingBuffer_->getBuffer();
+    bufferInfo.offset = 0;
+    bufferInfo.range = sizeof(MaterialData);
+
+    VkWriteDescriptorSet descriptorWrite{};
+    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptorWrite.dstSet = descriptorSet;
+    descriptorWrite.dstBinding = 0; // Material data is at binding 0 in set 1
+    descriptorWrite.dstArrayElement = 0;
+    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    descriptorWrite.descriptorCount = 1;
+    descriptorWrite.pBufferInfo = &bufferInfo;
+
+    vkUpdateDescriptorSets(device, 1, &descriptorWrite, 0, nullptr);
 }
 
 uint32_t MaterialSystem::createMaterial(const MaterialData& materialData) {
-    ensureDescriptorPoolCapacity(materials.size() + 1);
-    
+    if (materials.size() >= MAX_MATERIALS) {
+        throw std::runtime_error("MaterialSystem: Material capacity exceeded (" +
+                                 std::to_string(MAX_MATERIALS) + ")");
+    }
+
     uint32_t materialId = nextMaterialId++;
-    
-    MaterialBufferSet bufferSet;
-    bufferSet.data = materialData;
-    
-    // Create uniform buffer
-    VkDeviceSize bufferSize = sizeof(MaterialData);
-    bufferSet.materialBufferManaged = resourceManager->createBuffer(
-        bufferSize,
-        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-    
-    bufferSet.materialBuffer = bufferSet.materialBufferManaged->getBuffer();
-    bufferSet.materialBufferMemory = bufferSet.materialBufferManaged->getMemory();
-    
-    // Add to materials vector
+
     if (materialId >= materials.size()) {
         materials.resize(materialId + 1);
     }
-    materials[materialId] = std::move(bufferSet);
-    
-    // Create descriptor set
-    createDescriptorSet(materialId);
-    
-    // Update the buffer with material data
-    updateMaterial(materialId, materialData);
-    
+    materials[materialId] = materialData;
+
     VKMON_INFO("MaterialSystem: Created material " + std::to_string(materialId));
     return materialId;
 }
 
 uint32_t MaterialSystem::createMaterialFromModelMaterial(const VulkanMon::Material& material) {
     MaterialData materialData(material.ambient, material.diffuse, material.specular, material.shininess);
-    
+
     uint32_t materialId = createMaterial(materialData);
-    
+
     // Store name mapping if the material has a name
     if (!material.name.empty()) {
         materialNameMap[material.name] = materialId;
         VKMON_INFO("MaterialSystem: Mapped material name '" + material.name + "' to ID " + std::to_string(materialId));
     }
-    
+
     return materialId;
 }
 
-void MaterialSystem::createDescriptorSet(uint32_t materialId) {
-    if (materialId >= materials.size()) {
-        throw std::runtime_error("MaterialSystem: Invalid material ID for descriptor set creation");
+void MaterialSystem::beginFrame() {
+    if (!materialRingBuffer_) {
+        return; // Buffers not created yet (unit tests, early init)
     }
-    
-    VkDescriptorSetAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-    allocInfo.descriptorPool = descriptorPool;
-    allocInfo.descriptorSetCount = 1;
-    allocInfo.pSetLayouts = &descriptorSetLayout;
 
-    VkDevice device = resourceManager->getDevice();
-    if (vkAllocateDescriptorSets(device, &allocInfo, &materials[materialId].descriptorSet) != VK_SUCCESS) {
-        throw std::runtime_error("MaterialSystem: Failed to allocate descriptor set for material " + std::to_string(materialId));
-    }
-    
-    updateDescriptorSet(materialId);
-}
+    currentFrameSlot_ = (currentFrameSlot_ + 1) % FRAMES_IN_FLIGHT;
 
-void MaterialSystem::updateDescriptorSet(uint32_t materialId) {
-    if (materialId >= materials.size()) {
-        throw std::runtime_error("MaterialSystem: Invalid material ID for descriptor set update");
+    // Material counts are tiny (a handful of presets plus model imports),
+    // so re-uploading everything each frame is cheaper than tracking dirt
+    char* base = static_cast<char*>(materialRingBuffer_->map()) +
+                 static_cast<size_t>(currentFrameSlot_) * alignedStride_ * MAX_MATERIALS;
+    for (size_t i = 0; i < materials.size(); ++i) {
+        std::memcpy(base + i * alignedStride_, &materials[i], sizeof(MaterialData));
     }
-    
-    VkDescriptorBufferInfo bufferInfo{};
-    bufferInfo.buffer = materials[materialId].materialBuffer;
-    bufferInfo.offset = 0;
-    bufferInfo.range = sizeof(MaterialData);
-
-    VkWriteDescriptorSet descriptorWrite{};
-    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    descriptorWrite.dstSet = materials[materialId].descriptorSet;
-    descriptorWrite.dstBinding = 0; // Material data is now at binding 0 in set 1
-    descriptorWrite.dstArrayElement = 0;
-    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    descriptorWrite.descriptorCount = 1;
-    descriptorWrite.pBufferInfo = &bufferInfo;
-
-    VkDevice device = resourceManager->getDevice();
-    vkUpdateDescriptorSets(device, 1, &descriptorWrite, 0, nullptr);
 }
 
 void MaterialSystem::updateMaterial(uint32_t materialId, const MaterialData& materialData) {
     if (materialId >= materials.size()) {
         throw std::runtime_error("MaterialSystem: Invalid material ID for update");
     }
-    
-    materials[materialId].data = materialData;
-    
-    // Update the uniform buffer
-    void* data;
-    VkDevice device = resourceManager->getDevice();
-    vkMapMemory(device, materials[materialId].materialBufferMemory, 0, sizeof(MaterialData), 0, &data);
-    memcpy(data, &materialData, sizeof(MaterialData));
-    vkUnmapMemory(device, materials[materialId].materialBufferMemory);
+
+    // CPU-side only; the next beginFrame() uploads into a region the GPU
+    // is not reading
+    materials[materialId] = materialData;
 }
 
 void MaterialSystem::updateMaterialFromModelMaterial(uint32_t materialId, const VulkanMon::Material& material) {
@@ -192,42 +190,51 @@ VkBuffer MaterialSystem::getMaterialBuffer(uint32_t materialId) const {
     if (materialId >= materials.size()) {
         throw std::runtime_error("MaterialSystem: Invalid material ID for buffer access");
     }
-    return materials[materialId].materialBuffer;
+    return materialRingBuffer_ ? materialRingBuffer_->getBuffer() : VK_NULL_HANDLE;
 }
 
 VkDescriptorSet MaterialSystem::getDescriptorSet(uint32_t materialId) const {
     if (materialId >= materials.size()) {
         throw std::runtime_error("MaterialSystem: Invalid material ID for descriptor set access");
     }
-    return materials[materialId].descriptorSet;
+    return descriptorSet;
+}
+
+uint32_t MaterialSystem::getDynamicOffset(uint32_t materialId) const {
+    if (materialId >= materials.size()) {
+        throw std::runtime_error("MaterialSystem: Invalid material ID for dynamic offset");
+    }
+    return static_cast<uint32_t>((static_cast<VkDeviceSize>(currentFrameSlot_) * MAX_MATERIALS + materialId) * alignedStride_);
 }
 
 const MaterialData& MaterialSystem::getMaterialData(uint32_t materialId) const {
     if (materialId >= materials.size()) {
         throw std::runtime_error("MaterialSystem: Invalid material ID for data access");
     }
-    return materials[materialId].data;
+    return materials[materialId];
 }
 
 void MaterialSystem::cleanup() {
     VkDevice device = resourceManager->getDevice();
-    
+
+    materialRingBuffer_.reset();
+
     if (descriptorPool != VK_NULL_HANDLE) {
         vkDestroyDescriptorPool(device, descriptorPool, nullptr);
         descriptorPool = VK_NULL_HANDLE;
         VKMON_INFO("MaterialSystem: Destroyed descriptor pool");
     }
-    
+
     if (descriptorSetLayout != VK_NULL_HANDLE) {
         vkDestroyDescriptorSetLayout(device, descriptorSetLayout, nullptr);
         descriptorSetLayout = VK_NULL_HANDLE;
         VKMON_INFO("MaterialSystem: Destroyed descriptor set layout");
     }
-    
+
     materials.clear();
     materialNameMap.clear();
 
     VKMON_INFO("MaterialSystem: Cleanup completed");
 }
 
-} // namespace VulkanMon
\ No newline at end of file
+} // namespace VulkanMon
@@ -10,6 +10,7 @@
 namespace VulkanMon {
     class ResourceManager;
     class ManagedBuffer;
+    class DescriptorAllocator;
     struct Material; // Forward declaration from ModelLoader.h
 
 struct MaterialData {
@@ -30,20 +31,52 @@ struct MaterialData {
 
 class MaterialSystem {
 public:
+    // All materials live in one dynamic uniform buffer, ring-buffered per
+    // frame in flight; draws select a material via dynamic offset instead
+    // of binding a per-material descriptor set
+    static constexpr uint32_t MAX_MATERIALS = 256;
+    static constexpr uint32_t FRAMES_IN_FLIGHT = 2;  // matches VulkanRenderer::MAX_FRAMES_IN_FLIGHT
+
     MaterialSystem(std::shared_ptr<VulkanMon::ResourceManager> resourceManager);
     ~MaterialSystem();
     
     void createMaterialBuffers();
     void setDescriptorSetLayout(VkDescriptorSetLayout layout);
+
+    /**
+     * Route descriptor set allocation through the renderer's pooled
+     * allocator instead of a private single-set pool. Must be called
+     * before createMaterialBuffers(); without it the legacy private
+     * pool path is used (unit tests, headless init)
+     */
+    void setDescriptorAllocator(VulkanMon::DescriptorAllocator* allocator);
     void updateMaterial(uint32_t materialId, const MaterialData& materialData);
     void updateMaterialFromModelMaterial(uint32_t materialId, const VulkanMon::Material& material);
     
     uint32_t createMaterial(const MaterialData& materialData);
     uint32_t createMaterialFromModelMaterial(const VulkanMon::Material& material);
     
+    /**
+     * Upload all material data into this frame's ring region
+     * Called once per frame before any material is read by the GPU, so
+     * Inspector edits never race the frame still in flight
+     */
+    void beginFrame();
+
     VkBuffer getMaterialBuffer(uint32_t materialId) const;
     VkDescriptorSetLayout getDescriptorSetLayout() const { return descriptorSetLayout; }
+
+    /**
+     * Get the shared material descriptor set
+     * The materialId selects data through getDynamicOffset(), not through
+     * a distinct set; the parameter is kept for validation only
+     */
     VkDescriptorSet getDescriptorSet(uint32_t materialId) const;
+
+    /**
+     * Get the dynamic offset selecting materialId in this frame's ring region
+     */
+    uint32_t getDynamicOffset(uint32_t materialId) const;
     
     const MaterialData& getMaterialData(uint32_t materialId) const;
     size_t getMaterialCount() const { return materials.size(); }
@@ -53,24 +86,28 @@ public:
 private:
     std::shared_ptr<VulkanMon::ResourceManager> resourceManager;
     
-    struct MaterialBufferSet {
-        std::unique_ptr<VulkanMon::ManagedBuffer> materialBufferManaged;
-        VkBuffer materialBuffer;
-        VkDeviceMemory materialBufferMemory;
-        VkDescriptorSet descriptorSet;
-        MaterialData data;
-    };
-    
-    std::vector<MaterialBufferSet> materials;
+    // CPU-side material data; the GPU copy is re-uploaded each frame
+    std::vector<MaterialData> materials;
     std::unordered_map<std::string, uint32_t> materialNameMap;
     
     VkDescriptorSetLayout descriptorSetLayout;
     VkDescriptorPool descriptorPool;
-    
+    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+
+    // Pooled allocator owned by the renderer; when set, the material
+    // descriptor set comes from its (layout, bindings) cache and no
+    // private pool is created
+    VulkanMon::DescriptorAllocator* descriptorAllocator_ = nullptr;
+
+    // One persistently mapped buffer: FRAMES_IN_FLIGHT regions of
+    // MAX_MATERIALS slots, each slot aligned to the device's
+    // minUniformBufferOffsetAlignment
+    std::unique_ptr<VulkanMon::ManagedBuffer> materialRingBuffer_;
+    VkDeviceSize alignedStride_ = 0;
+    uint32_t currentFrameSlot_ = 0;
+
     void createDescriptorPool();
-    void createDescriptorSet(uint32_t materialId);
-    void updateDescriptorSet(uint32_t materialId);
-    void ensureDescriptorPoolCapacity(size_t requiredCapacity);
+    void createDescriptorSet();
     
     uint32_t nextMaterialId = 0;
 };
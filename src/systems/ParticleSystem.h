@@ -0,0 +1,110 @@
+#pragma once
+
+#include "../core/SystemImpl.h"
+#include "../components/Transform.h"
+#include "../components/ParticleEmitterComponent.h"
+#include "../rendering/VulkanRenderer.h"
+#include "../utils/Logger.h"
+#include <string>
+#include <vector>
+
+namespace VulkanMon {
+
+/**
+ * ParticleSystem
+ *
+ * Bridges ParticleEmitterComponent entities to the renderer's GPU
+ * particle pass. Each update drains continuous-rate accumulators and
+ * one-shot bursts into staged emit requests; render() forwards those to
+ * the renderer and issues the single indirect draw for the live pool.
+ *
+ * The CPU cost is proportional to emitter count, not particle count -
+ * simulation, compaction, and the draw count all stay on the GPU.
+ * Staged bursts reach the compute pass at the next beginECSFrame, so
+ * effects appear one frame after the gameplay event that spawned them.
+ */
+class ParticleSystem : public System<Transform, ParticleEmitterComponent> {
+private:
+    // Single mesh shared by every particle this frame; per-particle
+    // variety comes from the material ID carried in the instance data
+    std::string particleMeshPath_ = "sphere.obj";
+
+    std::vector<ParticleEmitParams> stagedBursts_;
+
+    struct ParticleSystemStats {
+        size_t emittersProcessed = 0;
+        size_t burstsStaged = 0;
+        uint32_t particlesRequested = 0;
+    } frameStats_;
+
+public:
+    ParticleSystem() {
+        VKMON_INFO("ParticleSystem initialized (GPU-resident simulation)");
+    }
+
+    void update(float deltaTime, EntityManager& entityManager) override {
+        frameStats_ = ParticleSystemStats{};
+
+        auto& entities = entityManager.getEntitiesWithComponent<ParticleEmitterComponent>();
+        for (EntityID entity : entities) {
+            auto& emitter = entityManager.getComponent<ParticleEmitterComponent>(entity);
+            if (!emitter.enabled || !entityManager.hasComponent<Transform>(entity)) {
+                continue;
+            }
+            frameStats_.emittersProcessed++;
+
+            // Whole particles owed this frame: continuous rate carry-over
+            // plus any bursts gameplay code queued since last update
+            emitter.emissionAccumulator += emitter.emissionRate * deltaTime;
+            uint32_t count = static_cast<uint32_t>(emitter.emissionAccumulator) + emitter.pendingBurst;
+            emitter.emissionAccumulator -= static_cast<float>(static_cast<uint32_t>(emitter.emissionAccumulator));
+            emitter.pendingBurst = 0;
+            if (count == 0) {
+                continue;
+            }
+
+            const Transform& transform = entityManager.getComponent<Transform>(entity);
+
+            ParticleEmitParams params;
+            params.origin = transform.position + emitter.localOffset;
+            params.direction = emitter.direction;
+            params.baseSpeed = emitter.baseSpeed;
+            params.spread = emitter.spread;
+            params.lifetimeSeconds = emitter.lifetimeSeconds;
+            params.size = emitter.particleSize;
+            params.gravityScale = emitter.gravityScale;
+            params.drag = emitter.drag;
+            params.materialId = emitter.materialId;
+            params.count = count;
+            stagedBursts_.push_back(params);
+
+            frameStats_.burstsStaged++;
+            frameStats_.particlesRequested += count;
+        }
+    }
+
+    void render(VulkanRenderer& renderer, EntityManager& entityManager) override {
+        if (!renderer.isGpuParticlesEnabled()) {
+            stagedBursts_.clear();
+            return;
+        }
+
+        for (const auto& burst : stagedBursts_) {
+            renderer.emitParticles(burst);
+        }
+        stagedBursts_.clear();
+
+        renderer.renderGpuParticles(particleMeshPath_);
+    }
+
+    // Mesh used for every particle instance (first submesh only)
+    void setParticleMesh(const std::string& meshPath) {
+        particleMeshPath_ = meshPath;
+        VKMON_INFO("Particle mesh set to: " + meshPath);
+    }
+    const std::string& getParticleMesh() const { return particleMeshPath_; }
+
+    const ParticleSystemStats& getFrameStats() const { return frameStats_; }
+};
+
+} // namespace VulkanMon
@@ -35,20 +35,50 @@ void PhysicsSystem::update(float deltaTime, EntityManager& entityManager) {
             // Create Jolt bodies for any new entities with physics components
             createJoltBodiesForNewEntities(entityManager);
 
-            // Convert deltaTime from milliseconds to seconds for Jolt Physics
-            float deltaTimeSeconds = scaledDeltaTime / 1000.0f;
+            // Retier creature bodies by distance at a slow cadence - the
+            // tier boundaries are far enough apart that twice a second is
+            // plenty
+            lodTimerMs_ += scaledDeltaTime;
+            if (lodTimerMs_ >= PHYSICS_LOD_UPDATE_INTERVAL_MS) {
+                lodTimerMs_ = 0.0f;
+                updatePhysicsLOD(entityManager);
+            }
 
-            // Clamp timestep to prevent physics instability at low framerates
-            const float maxTimestep = 1.0f / 30.0f;  // Cap at 30 FPS minimum
-            float clampedDeltaSeconds = std::min(deltaTimeSeconds, maxTimestep);
+            // Octree-driven region activation on its own, faster cadence -
+            // a region crossing a creature should wake it within a couple
+            // of frames, not half a second
+            if (!activationRegionCenters_.empty()) {
+                regionActivationTimerMs_ += scaledDeltaTime;
+                if (regionActivationTimerMs_ >= REGION_ACTIVATION_UPDATE_INTERVAL_MS) {
+                    regionActivationTimerMs_ = 0.0f;
+                    updateRegionActivation(entityManager);
+                }
+            }
+
+            // Accumulate frame time and advance the simulation in fixed
+            // increments. The backlog cap keeps a long hitch from queueing
+            // ever more steps; the simulation slows down instead.
+            physicsAccumulatorMs_ += scaledDeltaTime;
+            const float maxBacklogMs = FIXED_TIMESTEP_MS * MAX_STEPS_PER_FRAME;
+            if (physicsAccumulatorMs_ > maxBacklogMs) {
+                physicsAccumulatorMs_ = maxBacklogMs;
+            }
 
-            const int collisionSteps = 1;
+            const float stepSeconds = FIXED_TIMESTEP_MS / 1000.0f;
+            while (physicsAccumulatorMs_ >= FIXED_TIMESTEP_MS) {
+                stepSimulation(stepSeconds, entityManager);
+                physicsAccumulatorMs_ -= FIXED_TIMESTEP_MS;
+            }
 
-            // Update Jolt Physics
-            joltPhysics_->Update(clampedDeltaSeconds, collisionSteps, tempAllocator_.get(), jobSystem_.get());
+            // Render from a blend of the last two physics states: the
+            // leftover accumulator is how far this frame sits between
+            // fixed steps
+            float alpha = interpolationEnabled_ ? (physicsAccumulatorMs_ / FIXED_TIMESTEP_MS) : 1.0f;
+            applyInterpolatedTransforms(entityManager, alpha);
 
-            // Sync transforms from Jolt back to ECS components
-            syncTransformsFromJolt(entityManager);
+            // Contacts collected during the steps above go out as one
+            // sorted batch, never mid-step
+            deliverContactEvents();
 
             // Update statistics with enhanced monitoring
             updateStatsFromJolt();
@@ -103,11 +133,242 @@ void PhysicsSystem::shutdown(EntityManager& entityManager) {
 // Physics-specific methods
 
 void PhysicsSystem::fixedUpdate(EntityManager& entityManager, float fixedDeltaTime) {
-    if (!initialized_) return;
+    if (!initialized_ || !joltPhysics_) return;
+
+    // Exactly one simulation step, bypassing the frame-time accumulator -
+    // callers control determinism by controlling the step size
+    try {
+        createJoltBodiesForNewEntities(entityManager);
+        stepSimulation(fixedDeltaTime, entityManager);
+        applyInterpolatedTransforms(entityManager, 1.0f);
+        deliverContactEvents();
+    } catch (const std::exception& e) {
+        VKMON_ERROR("Jolt Physics fixed update failed: " + std::string(e.what()));
+    }
+}
+
+void PhysicsSystem::setActivationRegions(std::vector<glm::vec3> centers, float radius) {
+    activationRegionCenters_ = std::move(centers);
+    activationRegionRadius_ = radius;
 
-    // Fixed timestep is now handled internally by Jolt Physics
-    // This method exists for API compatibility but delegates to main update
-    update(fixedDeltaTime * 1000.0f, entityManager); // Convert to milliseconds for update()
+    // Disabling the pass must not leave bodies stranded asleep
+    if (activationRegionCenters_.empty() && !regionSleptBodies_.empty() && joltPhysics_) {
+        JPH::BodyInterface& bodyInterface = joltPhysics_->GetBodyInterface();
+        for (EntityID entityID : regionSleptBodies_) {
+            auto it = entityToBodyMap_.find(entityID);
+            if (it != entityToBodyMap_.end()) {
+                bodyInterface.ActivateBody(it->second);
+            }
+        }
+        regionSleptBodies_.clear();
+    }
+}
+
+void PhysicsSystem::updateRegionActivation(EntityManager& entityManager) {
+    if (!spatialSystem_ || !joltPhysics_ || activationRegionCenters_.empty()) return;
+
+    // One octree query per region center; the union is the set of
+    // entities allowed to simulate this interval
+    regionScratch_.clear();
+    std::vector<EntityID> queryResults;
+    for (const glm::vec3& center : activationRegionCenters_) {
+        queryResults.clear();
+        spatialSystem_->queryRadius(center, activationRegionRadius_, LayerMask::All, queryResults);
+        regionScratch_.insert(queryResults.begin(), queryResults.end());
+    }
+
+    JPH::BodyInterface& bodyInterface = joltPhysics_->GetBodyInterface();
+
+    for (const auto& [entityID, bodyID] : entityToBodyMap_) {
+        if (bodyID.IsInvalid()) continue;
+
+        // Same scope as LOD tiering: only dynamic creature bodies.
+        // Environment is static anyway, and player/projectile bodies must
+        // never be slept out from under their systems.
+        if (!entityManager.hasComponent<CreaturePhysicsComponent>(entityID)) continue;
+        if (entityManager.hasComponent<RigidBodyComponent>(entityID) &&
+            !entityManager.getComponent<RigidBodyComponent>(entityID).isDynamic) {
+            continue;
+        }
+        // Parked and Frozen bodies are already asleep under other owners
+        if (parkedBodies_.count(entityID) > 0) continue;
+        if (getPhysicsLOD(entityID) == PhysicsLOD::Frozen) continue;
+
+        bool inRegion = regionScratch_.count(entityID) > 0;
+
+        if (!inRegion) {
+            // Deactivating an already-sleeping body is a no-op, so this
+            // is safe to repeat every interval
+            bodyInterface.DeactivateBody(bodyID);
+            regionSleptBodies_.insert(entityID);
+        } else if (regionSleptBodies_.count(entityID) > 0) {
+            // Only wake bodies this pass put to sleep - Jolt's own
+            // velocity-threshold sleeping stays untouched
+            bodyInterface.ActivateBody(bodyID);
+            regionSleptBodies_.erase(entityID);
+        }
+    }
+}
+
+void PhysicsSystem::updatePhysicsLOD(EntityManager& entityManager) {
+    if (!lodReferenceSet_ || !joltPhysics_) return;
+
+    JPH::BodyInterface& bodyInterface = joltPhysics_->GetBodyInterface();
+
+    for (const auto& [entityID, bodyID] : entityToBodyMap_) {
+        if (bodyID.IsInvalid()) continue;
+
+        // Only creature bodies tier down; environment, player and
+        // projectiles always simulate at full fidelity
+        if (!entityManager.hasComponent<CreaturePhysicsComponent>(entityID) ||
+            !entityManager.hasComponent<Transform>(entityID)) {
+            continue;
+        }
+        if (entityManager.hasComponent<RigidBodyComponent>(entityID) &&
+            !entityManager.getComponent<RigidBodyComponent>(entityID).isDynamic) {
+            continue;
+        }
+
+        const auto& transform = entityManager.getComponent<Transform>(entityID);
+        float distance = glm::distance(transform.position, lodReference_);
+        PhysicsLOD desired = lodForDistance(distance);
+
+        if (desired == PhysicsLOD::Frozen) {
+            // Periodic teleport: keep the sleeping body where gameplay
+            // says the creature is, so raycasts and overlaps stay honest
+            bodyInterface.SetPositionAndRotation(
+                bodyID,
+                JPH::Vec3(transform.position.x, transform.position.y, transform.position.z),
+                JPH::Quat(transform.rotation.x, transform.rotation.y,
+                          transform.rotation.z, transform.rotation.w),
+                JPH::EActivation::DontActivate);
+        }
+
+        PhysicsLOD current = getPhysicsLOD(entityID);
+        if (desired == current) continue;
+
+        switch (desired) {
+            case PhysicsLOD::Full:
+                // Velocities were dropped on the way down; creature AI
+                // re-drives movement within a step or two
+                bodyInterface.SetMotionType(bodyID, JPH::EMotionType::Dynamic,
+                                            JPH::EActivation::Activate);
+                break;
+            case PhysicsLOD::Kinematic:
+                bodyInterface.SetMotionType(bodyID, JPH::EMotionType::Kinematic,
+                                            JPH::EActivation::DontActivate);
+                break;
+            case PhysicsLOD::Frozen:
+                bodyInterface.SetMotionType(bodyID, JPH::EMotionType::Kinematic,
+                                            JPH::EActivation::DontActivate);
+                bodyInterface.DeactivateBody(bodyID);
+                break;
+        }
+        bodyLODs_[entityID] = desired;
+    }
+}
+
+void PhysicsSystem::stepSimulation(float stepSeconds, EntityManager& entityManager) {
+    const int collisionSteps = 1;
+    joltPhysics_->Update(stepSeconds, collisionSteps, tempAllocator_.get(), jobSystem_.get());
+
+    capturePosesFromJolt(entityManager);
+}
+
+void PhysicsSystem::capturePosesFromJolt(EntityManager& entityManager) {
+    JPH::BodyInterface& bodyInterface = joltPhysics_->GetBodyInterface();
+
+    // Only bodies that moved this step: the activation tracker hands us
+    // awake bodies plus any that just went to sleep (their final pose)
+    bodyActivationTracker_->snapshot(activeBodyScratch_);
+    capturedScratch_.clear();
+
+    for (const JPH::BodyID& bodyID : activeBodyScratch_) {
+        if (bodyID.IsInvalid()) {
+            continue;
+        }
+        auto entityIt = bodyToEntityMap_.find(bodyID);
+        if (entityIt == bodyToEntityMap_.end()) {
+            continue; // destroyed since the snapshot
+        }
+        EntityID entityID = entityIt->second;
+
+        JPH::Vec3 position = bodyInterface.GetPosition(bodyID);
+        JPH::Quat rotation = bodyInterface.GetRotation(bodyID);
+
+        BodyPose pose;
+        pose.position = glm::vec3(position.GetX(), position.GetY(), position.GetZ());
+        pose.rotation = glm::quat(rotation.GetW(), rotation.GetX(), rotation.GetY(), rotation.GetZ());
+
+        auto it = bodyPoses_.find(entityID);
+        if (it == bodyPoses_.end()) {
+            // First sight of this body: seed both endpoints so the first
+            // interpolated frame does not sweep in from the origin
+            bodyPoses_[entityID] = InterpolationState{pose, pose};
+        } else {
+            // The pre-step pose becomes the interpolation tail
+            it->second.previous = it->second.current;
+            it->second.current = pose;
+        }
+        capturedScratch_.insert(entityID);
+        interpolatingEntities_.insert(entityID);
+
+        // Sync velocity to RigidBodyComponent so gameplay code reads the
+        // simulated values (velocity needs no interpolation)
+        if (entityManager.hasComponent<RigidBodyComponent>(entityID)) {
+            auto& rigidBody = entityManager.getComponent<RigidBodyComponent>(entityID);
+            JPH::Vec3 velocity = bodyInterface.GetLinearVelocity(bodyID);
+            JPH::Vec3 angularVelocity = bodyInterface.GetAngularVelocity(bodyID);
+            rigidBody.velocity = glm::vec3(velocity.GetX(), velocity.GetY(), velocity.GetZ());
+            rigidBody.angularVelocity = glm::vec3(angularVelocity.GetX(), angularVelocity.GetY(), angularVelocity.GetZ());
+        }
+    }
+
+    // Bodies that stopped moving: freeze both endpoints, queue one final
+    // Transform write, then they cost nothing until Jolt reactivates them
+    for (auto it = interpolatingEntities_.begin(); it != interpolatingEntities_.end();) {
+        if (capturedScratch_.find(*it) == capturedScratch_.end()) {
+            auto poseIt = bodyPoses_.find(*it);
+            if (poseIt != bodyPoses_.end()) {
+                poseIt->second.previous = poseIt->second.current;
+            }
+            settledEntities_.push_back(*it);
+            it = interpolatingEntities_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PhysicsSystem::applyInterpolatedTransforms(EntityManager& entityManager, float alpha) {
+    // Moving bodies: blend between the last two physics states
+    for (EntityID entityID : interpolatingEntities_) {
+        auto poseIt = bodyPoses_.find(entityID);
+        if (poseIt == bodyPoses_.end() || !entityManager.hasComponent<Transform>(entityID)) {
+            continue;
+        }
+
+        const InterpolationState& state = poseIt->second;
+        auto& transform = entityManager.getComponent<Transform>(entityID);
+        transform.position = glm::mix(state.previous.position, state.current.position, alpha);
+        transform.rotation = glm::slerp(state.previous.rotation, state.current.rotation, alpha);
+        transform.markDirty();
+    }
+
+    // Freshly slept bodies: write the exact final pose once, then they
+    // are skipped entirely until reactivated
+    for (EntityID entityID : settledEntities_) {
+        auto poseIt = bodyPoses_.find(entityID);
+        if (poseIt == bodyPoses_.end() || !entityManager.hasComponent<Transform>(entityID)) {
+            continue;
+        }
+
+        auto& transform = entityManager.getComponent<Transform>(entityID);
+        transform.position = poseIt->second.current.position;
+        transform.rotation = poseIt->second.current.rotation;
+        transform.markDirty();
+    }
+    settledEntities_.clear();
 }
 
 void PhysicsSystem::setCollisionMatrix(uint32_t layer1, uint32_t layer2, bool canCollide) {
@@ -242,6 +503,80 @@ PhysicsSystem::RaycastHit PhysicsSystem::raycast(const glm::vec3& origin,
     return hit;
 }
 
+void PhysicsSystem::runQueryBatch(size_t requestCount,
+                                  const std::function<void(size_t, size_t)>& runRange) {
+    // Small batches are cheaper inline than through the job system
+    constexpr size_t MIN_BATCH_FOR_JOBS = 8;
+    if (!jobSystem_ || requestCount < MIN_BATCH_FOR_JOBS) {
+        runRange(0, requestCount);
+        return;
+    }
+
+    // One chunk per worker thread; remainders land in the last chunk
+    const size_t chunkCount = std::min(requestCount,
+                                       static_cast<size_t>(jobSystem_->GetMaxConcurrency()));
+    const size_t chunkSize = (requestCount + chunkCount - 1) / chunkCount;
+
+    JPH::JobSystem::Barrier* barrier = jobSystem_->CreateBarrier();
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        const size_t begin = chunk * chunkSize;
+        const size_t end = std::min(begin + chunkSize, requestCount);
+        if (begin >= end) {
+            break;
+        }
+
+        JPH::JobHandle job = jobSystem_->CreateJob("PhysicsQueryBatch", JPH::Color::sCyan,
+            [&runRange, begin, end]() {
+                runRange(begin, end);
+            });
+        barrier->AddJob(job);
+    }
+
+    jobSystem_->WaitForJobs(barrier);
+    jobSystem_->DestroyBarrier(barrier);
+}
+
+std::vector<PhysicsSystem::RaycastHit> PhysicsSystem::raycastBatch(const std::vector<RaycastRequest>& requests) {
+    std::vector<RaycastHit> results(requests.size());
+    if (requests.empty()) {
+        return results;
+    }
+    if (!joltPhysics_) {
+        VKMON_WARNING("PhysicsSystem: Cannot perform raycast batch - Jolt Physics not initialized");
+        return results;
+    }
+
+    runQueryBatch(requests.size(), [this, &requests, &results](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const RaycastRequest& request = requests[i];
+            results[i] = raycast(request.origin, request.direction,
+                                 request.maxDistance, request.layerMask);
+        }
+    });
+
+    return results;
+}
+
+std::vector<std::vector<EntityID>> PhysicsSystem::overlapSphereBatch(const std::vector<OverlapSphereRequest>& requests) {
+    std::vector<std::vector<EntityID>> results(requests.size());
+    if (requests.empty()) {
+        return results;
+    }
+    if (!joltPhysics_) {
+        VKMON_WARNING("PhysicsSystem: Cannot perform overlap batch - Jolt Physics not initialized");
+        return results;
+    }
+
+    runQueryBatch(requests.size(), [this, &requests, &results](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const OverlapSphereRequest& request = requests[i];
+            results[i] = overlapSphere(request.center, request.radius, request.layerMask);
+        }
+    });
+
+    return results;
+}
+
 std::vector<EntityID> PhysicsSystem::overlapSphere(const glm::vec3& center,
                                                    float radius,
                                                    uint32_t layerMask) {
@@ -763,15 +1098,11 @@ void PhysicsSystem::initializeJoltPhysics() {
     // Create temp allocator for Jolt (10MB should be enough for most games)
     tempAllocator_ = std::make_unique<JPH::TempAllocatorImpl>(10 * 1024 * 1024);
 
-    // Create job system for multi-threading
-    // Use configured thread count, or auto-detect if not set
-    uint32_t actualThreadCount = threadCount_;
-    if (actualThreadCount == 0) {
-        actualThreadCount = std::max(1u, std::thread::hardware_concurrency() - 1);
-    }
-    jobSystem_ = std::make_unique<JPH::JobSystemThreadPool>(JPH::cMaxPhysicsJobs,
-                                                            JPH::cMaxPhysicsBarriers,
-                                                            actualThreadCount);
+    // Schedule physics jobs onto the engine-wide shared worker pool
+    // instead of spinning up a Jolt-private thread pool - one pool serves
+    // physics, ECS parallel-for, and asset IO without oversubscription
+    jobSystem_ = std::make_unique<SharedEngineJobSystem>(JPH::cMaxPhysicsJobs,
+                                                         JPH::cMaxPhysicsBarriers);
 
     // Configure physics system settings for game engine use
     const uint32_t cMaxBodies = 1024;           // Support up to 1024 physics bodies
@@ -792,10 +1123,21 @@ void PhysicsSystem::initializeJoltPhysics() {
     // Set gravity
     joltPhysics_->SetGravity(JPH::Vec3(worldGravity_.x, worldGravity_.y, worldGravity_.z));
 
+    // Track sleep/wake transitions so the ECS sync only visits bodies
+    // that actually moved (callbacks arrive on physics threads)
+    bodyActivationTracker_ = std::make_unique<BodyActivationTrackerImpl>();
+    joltPhysics_->SetBodyActivationListener(bodyActivationTracker_.get());
+
+    // Collect contact/trigger events into per-thread buffers for batched
+    // main-thread delivery after each update
+    contactEventCollector_ = std::make_unique<ContactEventCollectorImpl>();
+    contactEventCollector_->setBodyEntityLookup(&bodyToEntityMap_);
+    joltPhysics_->SetContactListener(contactEventCollector_.get());
+
     // Setup collision layers
     setupJoltLayers();
 
-    VKMON_INFO("Jolt Physics initialized with " + std::to_string(actualThreadCount) + " threads");
+    VKMON_INFO("Jolt Physics initialized on " + std::to_string(getThreadCount()) + " shared JobSystem workers");
 }
 
 void PhysicsSystem::shutdownJoltPhysics() {
@@ -803,12 +1145,20 @@ void PhysicsSystem::shutdownJoltPhysics() {
 
     VKMON_INFO("Shutting down Jolt Physics...");
 
-    // Clear entity mappings
+    // Clear entity mappings and shared shapes (shape refs must drop
+    // before Jolt types unregister)
+    shapeCache_.clear();
     entityToBodyMap_.clear();
     bodyToEntityMap_.clear();
+    bodyPoses_.clear();
+    bodyLODs_.clear();
+    interpolatingEntities_.clear();
+    settledEntities_.clear();
 
     // Destroy Jolt objects in reverse order
     joltPhysics_.reset();
+    contactEventCollector_.reset();
+    bodyActivationTracker_.reset();
     objectLayerPairFilter_.reset();
     objectVsBroadPhaseLayerFilter_.reset();
     broadPhaseLayerInterface_.reset();
@@ -1124,6 +1474,22 @@ std::string PhysicsSystem::timeToDebugString(Seconds s) const {
 // =============================================================================
 
 JPH::ShapeRefC PhysicsSystem::createJoltShape(const CollisionComponent& collision) {
+    // Shapes are immutable in Jolt, so identical dimensions can share one
+    // instance across any number of bodies. Species spawn in waves with
+    // exactly equal component values, so exact float comparison is the
+    // right key - near-equal dimensions are genuinely different shapes.
+    ShapeCacheKey key{collision.shapeType, collision.dimensions};
+    auto cached = shapeCache_.find(key);
+    if (cached != shapeCache_.end()) {
+        return cached->second;
+    }
+
+    JPH::ShapeRefC shape = buildJoltShape(collision);
+    shapeCache_[key] = shape;
+    return shape;
+}
+
+JPH::ShapeRefC PhysicsSystem::buildJoltShape(const CollisionComponent& collision) {
     switch (collision.shapeType) {
         case CollisionComponent::ShapeType::Box: {
             glm::vec3 halfExtents = collision.dimensions * 0.5f;
@@ -1183,10 +1549,22 @@ JPH::BodyID PhysicsSystem::createJoltBody(EntityID entity, const RigidBodyCompon
         bodySettings.mMotionQuality = JPH::EMotionQuality::Discrete;
     }
 
+    // Physics LOD retiers creature bodies between dynamic and kinematic
+    // at runtime, which Jolt only allows when requested up front
+    if (rigidBody.isDynamic) {
+        bodySettings.mAllowDynamicOrKinematic = true;
+    }
+
     // Set material properties
     bodySettings.mRestitution = rigidBody.restitution;
     bodySettings.mFriction = rigidBody.friction;
 
+    // Entity ID rides in body user data so contact callbacks can report
+    // entities without a map lookup; trigger components become Jolt
+    // sensors (overlap events, no collision response)
+    bodySettings.mUserData = static_cast<JPH::uint64>(entity);
+    bodySettings.mIsSensor = collision.isTrigger;
+
     // Set mass properties for dynamic bodies
     if (bodySettings.mMotionType == JPH::EMotionType::Dynamic) {
         bodySettings.mMassPropertiesOverride = JPH::MassProperties();
@@ -1218,6 +1596,12 @@ JPH::BodyID PhysicsSystem::createJoltBody(EntityID entity, const RigidBodyCompon
     entityToBodyMap_[entity] = bodyID;
     bodyToEntityMap_[bodyID] = entity;
 
+    // OnContactRemoved only hands back BodyIDs, so sensor membership is
+    // tracked here for classifying end events
+    if (contactEventCollector_ && collision.isTrigger) {
+        contactEventCollector_->registerSensorBody(bodyID);
+    }
+
     return bodyID;
 }
 
@@ -1235,7 +1619,18 @@ void PhysicsSystem::destroyJoltBody(EntityID entity) {
     // Destroy the body
     joltPhysics_->GetBodyInterface().DestroyBody(bodyID);
 
-    // Remove from mappings
+    // Remove from mappings and interpolation state
+    if (bodyActivationTracker_) {
+        bodyActivationTracker_->forget(bodyID);
+    }
+    if (contactEventCollector_) {
+        contactEventCollector_->forgetBody(bodyID);
+    }
+    bodyPoses_.erase(entity);
+    bodyLODs_.erase(entity);
+    parkedBodies_.erase(entity);
+    regionSleptBodies_.erase(entity);
+    interpolatingEntities_.erase(entity);
     bodyToEntityMap_.erase(bodyID);
     entityToBodyMap_.erase(it);
 
@@ -1264,67 +1659,53 @@ void PhysicsSystem::updateJoltBodyFromComponent(EntityID entity, const RigidBody
     }
 }
 
-void PhysicsSystem::syncTransformsFromJolt(EntityManager& entityManager) {
-    if (!joltPhysics_) {
-        VKMON_DEBUG("syncTransformsFromJolt: No Jolt physics system");
-        return;
-    }
+void PhysicsSystem::parkBody(EntityID entity, const glm::vec3& parkPosition) {
+    if (!joltPhysics_) return;
 
-    try {
-        VKMON_DEBUG("syncTransformsFromJolt: Getting body interface...");
-        JPH::BodyInterface& bodyInterface = joltPhysics_->GetBodyInterface();
-        VKMON_DEBUG("syncTransformsFromJolt: Body interface obtained, processing " + std::to_string(entityToBodyMap_.size()) + " bodies");
-        int syncCount = 0;
-
-        for (const auto& [entityID, bodyID] : entityToBodyMap_) {
-            VKMON_DEBUG("syncTransformsFromJolt: Processing entity " + std::to_string(entityID));
-            try {
-                // Check if body is valid
-                if (bodyID.IsInvalid()) {
-                    VKMON_WARNING("syncTransformsFromJolt: Invalid bodyID for entity " + std::to_string(entityID));
-                    continue;
-                }
+    // Mark parked even before the body exists - pooled entities can be
+    // parked the frame they are created, before createJoltBodiesForNewEntities
+    // has run, and the deferred creation path checks this set
+    parkedBodies_.insert(entity);
 
-                // Sync ALL physics entities every frame for reliable ECS integration
-                if (entityManager.hasComponent<Transform>(entityID)) {
-                    auto& transform = entityManager.getComponent<Transform>(entityID);
+    auto it = entityToBodyMap_.find(entity);
+    if (it == entityToBodyMap_.end()) return;
 
-                    // Get position and rotation from Jolt
-                    JPH::Vec3 position = bodyInterface.GetPosition(bodyID);
-                    JPH::Quat rotation = bodyInterface.GetRotation(bodyID);
+    JPH::BodyInterface& bodyInterface = joltPhysics_->GetBodyInterface();
+    bodyInterface.SetLinearAndAngularVelocity(it->second, JPH::Vec3::sZero(), JPH::Vec3::sZero());
+    bodyInterface.SetPositionAndRotation(
+        it->second,
+        JPH::Vec3(parkPosition.x, parkPosition.y, parkPosition.z),
+        JPH::Quat::sIdentity(),
+        JPH::EActivation::DontActivate);
+    bodyInterface.DeactivateBody(it->second);
+}
 
-                    // Update Transform component
-                    transform.position = glm::vec3(position.GetX(), position.GetY(), position.GetZ());
-                    transform.rotation = glm::quat(rotation.GetW(), rotation.GetX(), rotation.GetY(), rotation.GetZ());
+void PhysicsSystem::reviveBody(EntityID entity, const glm::vec3& position, const RigidBodyComponent& rigidBody) {
+    if (!joltPhysics_) return;
 
-                    // Mark transform as dirty for rendering
-                    transform.markDirty();
-                    syncCount++;
-                }
+    auto it = entityToBodyMap_.find(entity);
+    if (it == entityToBodyMap_.end()) return;
 
-                // Also sync velocity to RigidBodyComponent for test compatibility
-                if (entityManager.hasComponent<RigidBodyComponent>(entityID)) {
-                    auto& rigidBody = entityManager.getComponent<RigidBodyComponent>(entityID);
+    JPH::BodyID bodyID = it->second;
+    JPH::BodyInterface& bodyInterface = joltPhysics_->GetBodyInterface();
 
-                    // Get velocity from Jolt
-                    JPH::Vec3 velocity = bodyInterface.GetLinearVelocity(bodyID);
-                    JPH::Vec3 angularVelocity = bodyInterface.GetAngularVelocity(bodyID);
+    // Teleport first while still asleep so the body never simulates a
+    // frame at the park position
+    bodyInterface.SetPositionAndRotation(
+        bodyID,
+        JPH::Vec3(position.x, position.y, position.z),
+        JPH::Quat::sIdentity(),
+        JPH::EActivation::DontActivate);
 
-                    // Update RigidBodyComponent velocity
-                    rigidBody.velocity = glm::vec3(velocity.GetX(), velocity.GetY(), velocity.GetZ());
-                    rigidBody.angularVelocity = glm::vec3(angularVelocity.GetX(), angularVelocity.GetY(), angularVelocity.GetZ());
-                }
-            } catch (const std::exception& e) {
-                VKMON_ERROR("syncTransformsFromJolt: Error syncing entity " + std::to_string(entityID) + ": " + e.what());
-            }
-        }
+    bodyInterface.SetRestitution(bodyID, rigidBody.restitution);
+    bodyInterface.SetFriction(bodyID, rigidBody.friction);
+    bodyInterface.SetLinearAndAngularVelocity(
+        bodyID,
+        JPH::Vec3(rigidBody.velocity.x, rigidBody.velocity.y, rigidBody.velocity.z),
+        JPH::Vec3(rigidBody.angularVelocity.x, rigidBody.angularVelocity.y, rigidBody.angularVelocity.z));
+    bodyInterface.ActivateBody(bodyID);
 
-        if (syncCount > 0) {
-            VKMON_DEBUG("syncTransformsFromJolt: Synced " + std::to_string(syncCount) + " entities");
-        }
-    } catch (const std::exception& e) {
-        VKMON_ERROR("syncTransformsFromJolt: Critical error: " + std::string(e.what()));
-    }
+    parkedBodies_.erase(entity);
 }
 
 void PhysicsSystem::syncTransformsToJolt(EntityManager& entityManager) {
@@ -1333,6 +1714,9 @@ void PhysicsSystem::syncTransformsToJolt(EntityManager& entityManager) {
     JPH::BodyInterface& bodyInterface = joltPhysics_->GetBodyInterface();
 
     for (const auto& [entityID, bodyID] : entityToBodyMap_) {
+        // Parked pooled bodies stay asleep regardless of Transform writes
+        if (parkedBodies_.count(entityID) > 0) continue;
+
         if (entityManager.hasComponent<Transform>(entityID)) {
             const auto& transform = entityManager.getComponent<Transform>(entityID);
 
@@ -1383,6 +1767,27 @@ void PhysicsSystem::updateStatsFromJolt() {
                 ", Avg velocity: " + std::to_string(stats_.averageVelocity));
 }
 
+void PhysicsSystem::deliverContactEvents() {
+    frameContactEvents_.clear();
+    if (!contactEventCollector_) return;
+
+    contactEventCollector_->drainTo(frameContactEvents_);
+    if (frameContactEvents_.empty()) return;
+
+    // Per-thread buffering makes event order depend on Jolt's thread
+    // scheduling; sorting restores a deterministic order frame to frame
+    std::sort(frameContactEvents_.begin(), frameContactEvents_.end(),
+        [](const ContactEvent& a, const ContactEvent& b) {
+            if (a.entityA != b.entityA) return a.entityA < b.entityA;
+            if (a.entityB != b.entityB) return a.entityB < b.entityB;
+            return a.type < b.type;
+        });
+
+    if (contactEventCallback_) {
+        contactEventCallback_(frameContactEvents_);
+    }
+}
+
 void PhysicsSystem::createJoltBodiesForNewEntities(EntityManager& entityManager) {
     if (!joltPhysics_) return;
 
@@ -1416,6 +1821,12 @@ void PhysicsSystem::createJoltBodiesForNewEntities(EntityManager& entityManager)
             continue;
         }
 
+        // Entity was parked before its body existed (pool prewarm) -
+        // put the fresh body straight to sleep at the parked Transform
+        if (parkedBodies_.count(entity) > 0) {
+            joltPhysics_->GetBodyInterface().DeactivateBody(bodyID);
+        }
+
         newBodies++;
         VKMON_DEBUG("PhysicsSystem: Created Jolt body for entity " + std::to_string(entity) +
                     " (Dynamic: " + (rigidBody.isDynamic ? "true" : "false") +
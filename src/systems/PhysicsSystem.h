@@ -7,13 +7,17 @@
 #include "../components/CreaturePhysicsComponent.h"
 #include "../components/Transform.h"
 #include "../spatial/LayerMask.h"
+#include "../utils/JobSystem.h"
 #include <glm/glm.hpp>
 #include <memory>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <algorithm>
+#include <mutex>
 #include <thread>
 #include <chrono>
+#include <functional>
 #include <string>
 
 // Jolt Physics includes
@@ -21,7 +25,8 @@
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/TempAllocator.h>
-#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
 #include <Jolt/Physics/PhysicsSystem.h>
 #include <Jolt/Physics/PhysicsSettings.h>
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
@@ -31,6 +36,7 @@
 #include <Jolt/Physics/Body/BodyActivationListener.h>
 #include <Jolt/Physics/Collision/ObjectLayer.h>
 #include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h>
+#include <Jolt/Physics/Collision/ContactListener.h>
 #include <Jolt/Physics/Collision/RayCast.h>
 #include <Jolt/Physics/Collision/CastResult.h>
 #include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
@@ -211,6 +217,222 @@ public:
     }
 };
 
+// Body activation tracker - records sleep/wake transitions from Jolt's
+// physics threads so the ECS transform sync only touches bodies that
+// actually moved. Sleeping bodies cost nothing per frame.
+class BodyActivationTrackerImpl : public JPH::BodyActivationListener {
+public:
+    void OnBodyActivated(const JPH::BodyID& inBodyID, JPH::uint64 inBodyUserData) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        active_.insert(inBodyID);
+    }
+
+    void OnBodyDeactivated(const JPH::BodyID& inBodyID, JPH::uint64 inBodyUserData) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        active_.erase(inBodyID);
+        deactivated_.insert(inBodyID);
+    }
+
+    // Snapshot for the sync pass: bodies currently awake, plus bodies that
+    // went to sleep since the last snapshot (they need one final sync)
+    void snapshot(std::vector<JPH::BodyID>& outBodies) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        outBodies.assign(active_.begin(), active_.end());
+        outBodies.insert(outBodies.end(), deactivated_.begin(), deactivated_.end());
+        deactivated_.clear();
+    }
+
+    // Drop all record of a body being destroyed, whatever its state
+    void forget(const JPH::BodyID& bodyID) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        active_.erase(bodyID);
+        deactivated_.erase(bodyID);
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_set<JPH::BodyID> active_;
+    std::unordered_set<JPH::BodyID> deactivated_;
+};
+
+// Contact/trigger transition between two entities, captured during a
+// physics step and delivered on the main thread after it
+struct ContactEvent {
+    enum class Type : uint8_t {
+        ContactBegin,   // Solid bodies started touching
+        ContactEnd,     // Solid bodies separated
+        TriggerBegin,   // A body entered a trigger (sensor) volume
+        TriggerEnd      // A body left a trigger volume
+    };
+
+    Type type = Type::ContactBegin;
+    EntityID entityA = 0;
+    EntityID entityB = 0;
+    glm::vec3 point{0.0f};   // World-space contact point (begin events only)
+    glm::vec3 normal{0.0f};  // World-space normal, from A towards B (begin events only)
+};
+
+// Contact listener with per-thread event buffers
+//
+// Jolt fires contact callbacks from its worker threads mid-step, so a
+// shared event list would need a lock per contact. Each thread instead
+// appends to its own buffer (two thread_local reads and a push_back per
+// event - the registry mutex is taken once per thread lifetime), and the
+// main thread drains every buffer into one batch after stepping.
+//
+// Entity IDs ride in Jolt body user data. Sensor membership and the
+// body-to-entity map are only written between steps, so callbacks can
+// read them without synchronization.
+class ContactEventCollectorImpl final : public JPH::ContactListener {
+public:
+    void OnContactAdded(const JPH::Body& inBody1, const JPH::Body& inBody2,
+                        const JPH::ContactManifold& inManifold,
+                        JPH::ContactSettings& ioSettings) override {
+        ContactEvent event;
+        bool trigger = inBody1.IsSensor() || inBody2.IsSensor();
+        event.type = trigger ? ContactEvent::Type::TriggerBegin : ContactEvent::Type::ContactBegin;
+        event.entityA = static_cast<EntityID>(inBody1.GetUserData());
+        event.entityB = static_cast<EntityID>(inBody2.GetUserData());
+
+        JPH::RVec3 point = inManifold.GetWorldSpaceContactPointOn1(0);
+        event.point = glm::vec3(point.GetX(), point.GetY(), point.GetZ());
+        event.normal = glm::vec3(inManifold.mWorldSpaceNormal.GetX(),
+                                 inManifold.mWorldSpaceNormal.GetY(),
+                                 inManifold.mWorldSpaceNormal.GetZ());
+
+        localBuffer().push_back(event);
+    }
+
+    void OnContactRemoved(const JPH::SubShapeIDPair& inSubShapePair) override {
+        JPH::BodyID body1 = inSubShapePair.GetBody1ID();
+        JPH::BodyID body2 = inSubShapePair.GetBody2ID();
+
+        ContactEvent event;
+        bool trigger = sensorBodies_.count(body1) > 0 || sensorBodies_.count(body2) > 0;
+        event.type = trigger ? ContactEvent::Type::TriggerEnd : ContactEvent::Type::ContactEnd;
+        event.entityA = lookupEntity(body1);
+        event.entityB = lookupEntity(body2);
+
+        localBuffer().push_back(event);
+    }
+
+    // Body bookkeeping - main thread only, never during a step
+    void setBodyEntityLookup(const std::unordered_map<JPH::BodyID, EntityID>* bodyToEntity) {
+        bodyToEntity_ = bodyToEntity;
+    }
+    void registerSensorBody(const JPH::BodyID& bodyID) { sensorBodies_.insert(bodyID); }
+    void forgetBody(const JPH::BodyID& bodyID) { sensorBodies_.erase(bodyID); }
+
+    // Move every thread's events into out - called after stepping, when
+    // no physics worker is producing
+    void drainTo(std::vector<ContactEvent>& out) {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        for (auto& buffer : buffers_) {
+            out.insert(out.end(), buffer->begin(), buffer->end());
+            buffer->clear();
+        }
+    }
+
+private:
+    using ThreadBuffer = std::vector<ContactEvent>;
+
+    ThreadBuffer& localBuffer() {
+        // Safe as a function-static thread_local because exactly one
+        // PhysicsSystem (and thus one collector) exists per process - see
+        // OwnershipModel.h. The owner check re-registers after a physics
+        // restart.
+        thread_local ContactEventCollectorImpl* owner = nullptr;
+        thread_local ThreadBuffer* buffer = nullptr;
+
+        if (owner != this) {
+            auto newBuffer = std::make_unique<ThreadBuffer>();
+            buffer = newBuffer.get();
+            {
+                std::lock_guard<std::mutex> lock(registryMutex_);
+                buffers_.push_back(std::move(newBuffer));
+            }
+            owner = this;
+        }
+        return *buffer;
+    }
+
+    EntityID lookupEntity(const JPH::BodyID& bodyID) const {
+        if (!bodyToEntity_) return 0;
+        auto it = bodyToEntity_->find(bodyID);
+        return (it != bodyToEntity_->end()) ? it->second : 0;
+    }
+
+    std::mutex registryMutex_;  // Guards buffer registration, once per thread
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+    std::unordered_set<JPH::BodyID> sensorBodies_;
+    const std::unordered_map<JPH::BodyID, EntityID>* bodyToEntity_ = nullptr;
+};
+
+// Jolt adapter over the engine-wide JobSystem - physics jobs run on the
+// same shared workers as ECS parallel-for and asset IO instead of Jolt
+// owning a private JobSystemThreadPool. Physics queues at High priority
+// so a backlog of background work never delays a simulation step.
+// Barriers and dependency counting come from JPH::JobSystemWithBarrier;
+// this class only supplies job storage and the queueing hook.
+class SharedEngineJobSystem final : public JPH::JobSystemWithBarrier {
+public:
+    SharedEngineJobSystem(JPH::uint inMaxJobs, JPH::uint inMaxBarriers)
+        : JPH::JobSystemWithBarrier(inMaxBarriers) {
+        jobs_.Init(inMaxJobs, inMaxJobs);
+    }
+
+    int GetMaxConcurrency() const override {
+        // Workers plus the calling thread, which WaitForJobs keeps busy
+        return static_cast<int>(JobSystem::getInstance().getWorkerCount()) + 1;
+    }
+
+    JobHandle CreateJob(const char* inName, JPH::ColorArg inColor,
+                        const JobFunction& inJobFunction, JPH::uint32 inNumDependencies = 0) override {
+        // Same allocation loop as Jolt's own thread pool: the free list
+        // only transiently runs dry while finished jobs are being released
+        JPH::uint32 index;
+        for (;;) {
+            index = jobs_.ConstructObject(inName, inColor, this, inJobFunction, inNumDependencies);
+            if (index != AvailableJobs::cInvalidObjectIndex) {
+                break;
+            }
+            JPH_ASSERT(false, "No jobs available!");
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        Job* job = &jobs_.Get(index);
+        JobHandle handle(job);
+        if (inNumDependencies == 0) {
+            QueueJob(job);
+        }
+        return handle;
+    }
+
+protected:
+    void QueueJob(Job* inJob) override {
+        // The queue holds a reference until the job has executed
+        inJob->AddRef();
+        JobSystem::getInstance().submit([inJob]() {
+            inJob->Execute();
+            inJob->Release();
+        }, JobPriority::High);
+    }
+
+    void QueueJobs(Job** inJobs, JPH::uint inNumJobs) override {
+        for (JPH::uint i = 0; i < inNumJobs; ++i) {
+            QueueJob(inJobs[i]);
+        }
+    }
+
+    void FreeJob(Job* inJob) override {
+        jobs_.DestructObject(inJob);
+    }
+
+private:
+    using AvailableJobs = JPH::FixedSizeFreeList<Job>;
+    AvailableJobs jobs_;
+};
+
 /**
  * @brief Modern Jolt Physics integration for VulkanMon ECS architecture
  * @details Provides professional physics simulation with automatic ECS synchronization.
@@ -294,10 +516,131 @@ public:
     // =============================================================================
 
 
-    // Fixed timestep physics update - delegates to Jolt Physics internal timestep management
-    // @param fixedDeltaTime Fixed timestep in MILLISECONDS (converted for main update)
+    // Fixed timestep physics update - runs exactly one simulation step
+    // with no accumulator and no interpolation remainder, for deterministic
+    // tests and tools
+    // @param fixedDeltaTime Step size in SECONDS
     void fixedUpdate(EntityManager& entityManager, float fixedDeltaTime);
 
+    // =============================================================================
+    // FIXED TIMESTEP AND RENDER INTERPOLATION
+    // =============================================================================
+
+    // The simulation always advances in FIXED_TIMESTEP_MS increments
+    // regardless of frame rate: update() accumulates frame time and steps
+    // zero or more times, then writes Transforms blended between the last
+    // two physics states. Identical simulation results at 30, 60 or 240 Hz,
+    // and smooth motion on displays faster than the step rate.
+    static constexpr float FIXED_TIMESTEP_MS = 1000.0f / 60.0f;
+
+    // Step backlog cap after a long hitch - stepping more would lengthen
+    // the frame, which queues more steps (the classic death spiral). The
+    // simulation slows down instead.
+    static constexpr int MAX_STEPS_PER_FRAME = 4;
+
+    // =============================================================================
+    // PHYSICS LOD TIERING
+    // =============================================================================
+
+    // Distance-tiered simulation fidelity for creature bodies, re-evaluated
+    // every PHYSICS_LOD_UPDATE_INTERVAL_MS against the LOD reference (the
+    // active camera / player). Environment, player and projectile bodies
+    // always simulate at full fidelity.
+    //
+    //   Full      (< NEAR): normal dynamic simulation
+    //   Kinematic (< FAR):  no force integration or constraint solving;
+    //                       AI moves the body with kinematic sweeps
+    //   Frozen    (>= FAR): body deactivated, periodically teleported to
+    //                       the gameplay Transform so queries stay honest
+    enum class PhysicsLOD : uint8_t { Full, Kinematic, Frozen };
+
+    static constexpr float PHYSICS_LOD_NEAR_DISTANCE = 30.0f;
+    static constexpr float PHYSICS_LOD_FAR_DISTANCE = 80.0f;
+    static constexpr float PHYSICS_LOD_UPDATE_INTERVAL_MS = 500.0f;
+
+    // World position distances are measured from, typically the active
+    // camera; until set, every body stays at full fidelity
+    void setLODReference(const glm::vec3& position) {
+        lodReference_ = position;
+        lodReferenceSet_ = true;
+    }
+
+    // Tier a creature body currently simulates at (Full when untracked)
+    PhysicsLOD getPhysicsLOD(EntityID entity) const {
+        auto it = bodyLODs_.find(entity);
+        return (it != bodyLODs_.end()) ? it->second : PhysicsLOD::Full;
+    }
+
+    static PhysicsLOD lodForDistance(float distance) {
+        if (distance < PHYSICS_LOD_NEAR_DISTANCE) return PhysicsLOD::Full;
+        if (distance < PHYSICS_LOD_FAR_DISTANCE) return PhysicsLOD::Kinematic;
+        return PhysicsLOD::Frozen;
+    }
+
+    // =============================================================================
+    // SPATIAL ACTIVATION REGIONS
+    // =============================================================================
+
+    // Octree-driven sleeping control by gameplay region. Jolt only puts a
+    // body to sleep once its velocity stays under threshold, so a big
+    // world full of idle creatures still pays broad-phase and islanding
+    // cost. The octree in SpatialManager knows where gameplay is
+    // happening (players, cameras) before velocities settle: a periodic
+    // pass queries it around each region center and force-sleeps dynamic
+    // creature bodies outside every region, waking them again when a
+    // region reaches them.
+    //
+    // Only bodies this pass put to sleep are ever woken by it, so Jolt's
+    // own velocity-threshold sleeping and the Frozen LOD tier are never
+    // overridden. Environment, player and projectile bodies are left
+    // alone entirely.
+
+    static constexpr float ACTIVATION_REGION_RADIUS = 60.0f;
+    static constexpr float REGION_ACTIVATION_UPDATE_INTERVAL_MS = 250.0f;
+
+    // Region centers are typically player/camera positions, refreshed by
+    // the application as they move. An empty list disables the pass and
+    // wakes everything it had put to sleep.
+    void setActivationRegions(std::vector<glm::vec3> centers,
+                              float radius = ACTIVATION_REGION_RADIUS);
+
+    // Whether this pass currently holds the entity's body asleep
+    bool isRegionDeactivated(EntityID entity) const {
+        return regionSleptBodies_.count(entity) > 0;
+    }
+
+    size_t getRegionDeactivatedCount() const { return regionSleptBodies_.size(); }
+
+    // =============================================================================
+    // BODY PARKING (ENTITY POOLING SUPPORT)
+    // =============================================================================
+
+    // Pooled entities keep their Jolt bodies alive between uses instead of
+    // paying body creation on every spawn. Parking teleports the body to a
+    // holding position, clears its velocities and deactivates it; parked
+    // bodies are excluded from transform sync so they stay asleep until
+    // revived with a fresh position and velocity.
+
+    // Park an entity's body out of play (no-op if the entity has no body)
+    void parkBody(EntityID entity, const glm::vec3& parkPosition);
+
+    // Return a parked body to play at the given position with the
+    // component's velocities and material properties applied
+    void reviveBody(EntityID entity, const glm::vec3& position, const RigidBodyComponent& rigidBody);
+
+    bool isBodyParked(EntityID entity) const {
+        return parkedBodies_.count(entity) > 0;
+    }
+
+    // Disable to snap Transforms to the newest physics state (alpha = 1),
+    // e.g. when capturing deterministic screenshots
+    void setInterpolationEnabled(bool enabled) { interpolationEnabled_ = enabled; }
+    bool isInterpolationEnabled() const { return interpolationEnabled_; }
+
+    // Fraction of a fixed step the current frame sits past the last
+    // simulated state; in [0, 1)
+    float getInterpolationAlpha() const { return physicsAccumulatorMs_ / FIXED_TIMESTEP_MS; }
+
     // =============================================================================
     // PHYSICS CONFIGURATION
     // =============================================================================
@@ -316,14 +659,25 @@ public:
         positionIterations_ = positionIterations;
     }
 
-    // Thread configuration for Jolt Physics multithreading
+    // Shared collision shapes currently cached (one per unique
+    // type+dimensions pair); see createJoltShape
+    size_t getShapeCacheSize() const { return shapeCache_.size(); }
+
+    // Physics threads come from the engine-wide JobSystem pool; the count
+    // reported here is that pool's worker count. setThreadCount is kept
+    // for API compatibility but no longer owns threads - the shared pool
+    // is sized once at startup.
     void setThreadCount(uint32_t threadCount) {
         threadCount_ = threadCount;
         if (threadCount_ == 0) {
-            threadCount_ = std::max(1u, std::thread::hardware_concurrency() - 1);
+            threadCount_ = static_cast<uint32_t>(JobSystem::getInstance().getWorkerCount());
         }
     }
-    uint32_t getThreadCount() const { return threadCount_; }
+    uint32_t getThreadCount() const {
+        return threadCount_ != 0
+                   ? threadCount_
+                   : static_cast<uint32_t>(JobSystem::getInstance().getWorkerCount());
+    }
 
     // =============================================================================
     // COLLISION DETECTION AND RESPONSE
@@ -337,6 +691,28 @@ public:
     void setCollisionMatrix(uint32_t layer1, uint32_t layer2, bool canCollide);
     bool shouldLayersCollide(uint32_t layer1, uint32_t layer2) const;
 
+    // =============================================================================
+    // CONTACT / TRIGGER EVENTS
+    // =============================================================================
+
+    // Jolt contact callbacks fire on physics worker threads mid-step;
+    // instead of pushing that threading problem onto every consumer, the
+    // events are buffered per thread (no per-contact locking) and handed
+    // out here as one batch after stepping - a single, main-thread
+    // iteration point per frame, sorted by entity pair for coherent
+    // processing. Bodies with CollisionComponent::isTrigger set become
+    // Jolt sensors and report Trigger begin/end instead of contacts.
+
+    // Events from the most recent physics update; valid until the next one
+    const std::vector<ContactEvent>& getContactEvents() const { return frameContactEvents_; }
+
+    // Invoked once per frame on the main thread after stepping, only when
+    // events occurred
+    using ContactEventCallback = std::function<void(const std::vector<ContactEvent>&)>;
+    void setContactEventCallback(ContactEventCallback callback) {
+        contactEventCallback_ = std::move(callback);
+    }
+
     // =============================================================================
     // PHYSICS QUERIES
     // =============================================================================
@@ -363,6 +739,48 @@ public:
     RaycastHit raycast(const glm::vec3& origin, const glm::vec3& direction,
                       float maxDistance = 100.0f, uint32_t layerMask = 0xFFFFFFFF);
 
+    // =============================================================================
+    // BATCHED QUERIES
+    // =============================================================================
+
+    // Submit many queries in one call and get all results back together.
+    // The batch is fanned out across Jolt's job system threads - queries
+    // are read-only against the physics world, so they run concurrently
+    // with each other (never with a simulation step; issue batches between
+    // updates). Creature AI line-of-sight easily needs 40+ rays per frame,
+    // which is exactly the shape this amortizes.
+
+    struct RaycastRequest {
+        glm::vec3 origin{0.0f};
+        glm::vec3 direction{0.0f, 0.0f, -1.0f};
+        float maxDistance = 100.0f;
+        uint32_t layerMask = 0xFFFFFFFF;
+    };
+
+    struct OverlapSphereRequest {
+        glm::vec3 center{0.0f};
+        float radius = 1.0f;
+        uint32_t layerMask = 0xFFFFFFFF;
+    };
+
+    /**
+     * @brief Perform many raycasts in one call
+     * @param requests Rays to cast; results index-match this vector
+     * @return One RaycastHit per request, in request order
+     * @note Blocks until the whole batch completes
+     * @see raycast
+     */
+    std::vector<RaycastHit> raycastBatch(const std::vector<RaycastRequest>& requests);
+
+    /**
+     * @brief Perform many sphere overlap queries in one call
+     * @param requests Spheres to test; results index-match this vector
+     * @return One entity list per request, in request order
+     * @note Blocks until the whole batch completes
+     * @see overlapSphere
+     */
+    std::vector<std::vector<EntityID>> overlapSphereBatch(const std::vector<OverlapSphereRequest>& requests);
+
     /**
      * @brief Find all entities within a spherical area
      * @param center World space center point of the sphere
@@ -464,16 +882,37 @@ private:
     void destroyJoltBody(EntityID entity);
     void updateJoltBodyFromComponent(EntityID entity, const RigidBodyComponent& rigidBody);
 
-    // Jolt shape creation
+    // Jolt shape creation - identical (type, dimensions) pairs share one
+    // immutable ref-counted shape from the cache
     JPH::ShapeRefC createJoltShape(const CollisionComponent& collision);
+    JPH::ShapeRefC buildJoltShape(const CollisionComponent& collision);
 
-    // Transform synchronization
-    void syncTransformsFromJolt(EntityManager& entityManager);
+    // Transform synchronization (ECS -> Jolt; the reverse direction goes
+    // through capturePosesFromJolt + applyInterpolatedTransforms)
     void syncTransformsToJolt(EntityManager& entityManager);
 
+    // Batched query fan-out: run runRange(begin, end) chunks across
+    // Jolt's job system threads and block until all complete
+    void runQueryBatch(size_t requestCount, const std::function<void(size_t, size_t)>& runRange);
+
+    // Physics LOD pass - retier creature bodies by distance
+    void updatePhysicsLOD(EntityManager& entityManager);
+
+    // Region activation pass - octree queries decide which creature
+    // bodies stay awake
+    void updateRegionActivation(EntityManager& entityManager);
+
+    // Fixed-timestep stepping and render interpolation
+    void stepSimulation(float stepSeconds, EntityManager& entityManager);
+    void capturePosesFromJolt(EntityManager& entityManager);
+    void applyInterpolatedTransforms(EntityManager& entityManager, float alpha);
+
     // Jolt statistics update
     void updateStatsFromJolt();
 
+    // Drain per-thread contact buffers, sort, and invoke the callback
+    void deliverContactEvents();
+
     // Automatic Jolt body management
     void createJoltBodiesForNewEntities(EntityManager& entityManager);
     void createJoltBodiesForAllEntities(EntityManager& entityManager);
@@ -582,17 +1021,90 @@ private:
     // Core Jolt Physics objects
     std::unique_ptr<JPH::PhysicsSystem> joltPhysics_;
     std::unique_ptr<JPH::TempAllocatorImpl> tempAllocator_;
-    std::unique_ptr<JPH::JobSystemThreadPool> jobSystem_;
+    std::unique_ptr<SharedEngineJobSystem> jobSystem_;
 
     // Jolt interface implementations
     std::unique_ptr<BroadPhaseLayerInterfaceImpl> broadPhaseLayerInterface_;
     std::unique_ptr<ObjectVsBroadPhaseLayerFilterImpl> objectVsBroadPhaseLayerFilter_;
     std::unique_ptr<ObjectLayerPairFilterImpl> objectLayerPairFilter_;
 
+    // Shared shape cache - Jolt shapes are immutable and internally
+    // ref-counted, so every body with the same type and dimensions can
+    // hold the same instance. 200 creatures of one species cost one
+    // capsule shape instead of 200.
+    struct ShapeCacheKey {
+        CollisionComponent::ShapeType type;
+        glm::vec3 dimensions;
+
+        bool operator==(const ShapeCacheKey& other) const {
+            return type == other.type && dimensions == other.dimensions;
+        }
+    };
+    struct ShapeCacheKeyHash {
+        size_t operator()(const ShapeCacheKey& key) const {
+            size_t hash = std::hash<uint8_t>{}(static_cast<uint8_t>(key.type));
+            auto mix = [&hash](float value) {
+                hash ^= std::hash<float>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            };
+            mix(key.dimensions.x);
+            mix(key.dimensions.y);
+            mix(key.dimensions.z);
+            return hash;
+        }
+    };
+    std::unordered_map<ShapeCacheKey, JPH::ShapeRefC, ShapeCacheKeyHash> shapeCache_;
+
     // Entity mapping for Jolt integration
     std::unordered_map<EntityID, JPH::BodyID> entityToBodyMap_;  // Entity -> Jolt Body mapping
     std::unordered_map<JPH::BodyID, EntityID> bodyToEntityMap_;  // Jolt Body -> Entity mapping
 
+    // Bodies parked by entity pooling - excluded from transform sync so
+    // dirty Transforms on pooled entities cannot wake them
+    std::unordered_set<EntityID> parkedBodies_;
+
+    // Physics LOD state
+    glm::vec3 lodReference_{0.0f};                 // Distance reference point (camera/player)
+    bool lodReferenceSet_{false};                  // Tiering only runs once a reference exists
+    float lodTimerMs_{0.0f};                       // Time since the last LOD pass
+    std::unordered_map<EntityID, PhysicsLOD> bodyLODs_;  // Current tier per creature body
+
+    // Spatial activation region state
+    std::vector<glm::vec3> activationRegionCenters_;     // Empty disables the pass
+    float activationRegionRadius_{ACTIVATION_REGION_RADIUS};
+    float regionActivationTimerMs_{0.0f};                // Time since the last region pass
+    std::unordered_set<EntityID> regionSleptBodies_;     // Bodies this pass put to sleep
+    std::unordered_set<EntityID> regionScratch_;         // In-region set, reused across passes
+
+    // Fixed timestep state
+    float physicsAccumulatorMs_{0.0f};             // Unsimulated frame time carried between updates
+    bool interpolationEnabled_{true};              // Blend Transforms between physics states
+
+    // Last two physics states per body, the endpoints render
+    // interpolation blends between
+    struct BodyPose {
+        glm::vec3 position{0.0f};
+        glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+    };
+    struct InterpolationState {
+        BodyPose previous;
+        BodyPose current;
+    };
+    std::unordered_map<EntityID, InterpolationState> bodyPoses_;
+
+    // Active-body sync state: only entities in interpolatingEntities_ get
+    // Transform writes each frame; settledEntities_ get one final write
+    // when their body goes to sleep
+    std::unique_ptr<BodyActivationTrackerImpl> bodyActivationTracker_;
+    std::unique_ptr<ContactEventCollectorImpl> contactEventCollector_;
+
+    // This frame's sorted contact/trigger batch and its consumer
+    std::vector<ContactEvent> frameContactEvents_;
+    ContactEventCallback contactEventCallback_;
+    std::vector<JPH::BodyID> activeBodyScratch_;
+    std::unordered_set<EntityID> capturedScratch_;
+    std::unordered_set<EntityID> interpolatingEntities_;
+    std::vector<EntityID> settledEntities_;
+
     // Performance tracking
     PhysicsStats stats_;                           // Current frame statistics
 
@@ -8,6 +8,12 @@
 
 namespace VulkanMon {
 
+namespace {
+    // Where pooled projectiles and their parked bodies wait between uses -
+    // far below the world so nothing queries or renders them
+    const glm::vec3 POOL_PARK_POSITION(0.0f, -10000.0f, 0.0f);
+}
+
 ProjectileSystem::ProjectileSystem(CameraSystem* cameraSystem, MaterialSystem* materialSystem)
     : cameraSystem_(cameraSystem)
     , materialSystem_(materialSystem)
@@ -34,9 +40,12 @@ void ProjectileSystem::update(float deltaTime, EntityManager& entityManager) {
     // Get all entities with ProjectileComponent
     auto projectileEntities = entityManager.getEntitiesWithComponent<ProjectileComponent>();
 
-    // Filter to only those that also have Transform
+    // Filter to only those that also have Transform, skipping parked pool entities
     std::vector<EntityID> entities;
     for (EntityID entity : projectileEntities) {
+        if (pooledProjectiles_.count(entity) > 0) {
+            continue;
+        }
         if (entityManager.hasComponent<Transform>(entity)) {
             entities.push_back(entity);
         }
@@ -50,7 +59,7 @@ void ProjectileSystem::update(float deltaTime, EntityManager& entityManager) {
         auto& transform = entityManager.getComponent<Transform>(entity);
 
         // Update projectile physics and movement
-        updateProjectilePhysics(entity, projectile, transform, deltaTime);
+        updateProjectilePhysics(entity, projectile, transform, entityManager, deltaTime);
 
         // Update projectile internal state
         projectile.update(deltaTime, transform.position);
@@ -58,9 +67,15 @@ void ProjectileSystem::update(float deltaTime, EntityManager& entityManager) {
         // Check for lifetime expiration and cleanup
         updateProjectileLifetime(entity, projectile, entityManager, deltaTime);
 
+        // Released to the pool this frame - skip collision handling so the
+        // parked entity cannot be released twice
+        if (pooledProjectiles_.count(entity) > 0) {
+            continue;
+        }
+
         // Handle collision detection if enabled
         if (projectile.enableCollisionDetection) {
-            handleProjectileCollisions(entity, projectile, transform, entityManager);
+            handleProjectileCollisions(entity, projectile, transform, entityManager, deltaTime);
         }
     }
 
@@ -194,6 +209,9 @@ std::vector<EntityID> ProjectileSystem::getActiveProjectiles(EntityManager& enti
     auto projectileEntities = entityManager.getEntitiesWithComponent<ProjectileComponent>();
     std::vector<EntityID> result;
     for (EntityID entity : projectileEntities) {
+        if (pooledProjectiles_.count(entity) > 0) {
+            continue;
+        }
         if (entityManager.hasComponent<Transform>(entity)) {
             result.push_back(entity);
         }
@@ -208,8 +226,8 @@ size_t ProjectileSystem::getProjectileCount(EntityManager& entityManager) {
 void ProjectileSystem::destroyProjectile(EntityID entity, EntityManager& entityManager) {
     if (entityManager.hasComponent<ProjectileComponent>(entity)) {
         auto& projectile = entityManager.getComponent<ProjectileComponent>(entity);
-        logProjectileDestroy(entity, projectile, "Manual destruction");
-        stats_.projectilesDestroyed++;
+        releaseProjectileToPool(entity, projectile, entityManager, "Manual destruction");
+        return;
     }
 
     entityManager.destroyEntity(entity);
@@ -225,6 +243,41 @@ void ProjectileSystem::destroyAllProjectiles(EntityManager& entityManager) {
         "Destroyed all projectiles (count: " + std::to_string(projectiles.size()) + ")");
 }
 
+void ProjectileSystem::prewarmPool(size_t bodylessCount, size_t bodiedCount, EntityManager& entityManager) {
+    // Build pool entries through the normal creation path, then immediately
+    // park them - identical component layout to a live projectile, so reuse
+    // is a pure reset
+    bool previousLogging = debugLogging_;
+    debugLogging_ = false;  // Suppress per-entity spawn/destroy spam during warmup
+
+    for (size_t i = 0; i < bodylessCount + bodiedCount; ++i) {
+        ProjectileComponent prototype = ProjectileComponent::createBullet();
+        if (i >= bodylessCount) {
+            prototype = ProjectileComponent::createPhysicsObject(1.0f, 0.6f);
+            prototype.useHighPrecisionPhysics = true;
+        }
+
+        EntityID entity = createProjectileEntity(
+            POOL_PARK_POSITION, glm::vec3(0.0f, -1.0f, 0.0f), prototype, ProjectileMaterials::Type::DEFAULT_PROJECTILE, entityManager);
+        if (entity != INVALID_ENTITY) {
+            auto& projectile = entityManager.getComponent<ProjectileComponent>(entity);
+            releaseProjectileToPool(entity, projectile, entityManager, "Pool prewarm");
+        }
+    }
+
+    debugLogging_ = previousLogging;
+    stats_.projectilesSpawned = 0;
+    stats_.projectilesDestroyed = 0;
+
+    Logger::getInstance().log(LogLevel::INFO_LEVEL,
+        "ProjectileSystem: Prewarmed pool with " + std::to_string(bodylessCount) + " body-less and " +
+        std::to_string(bodiedCount) + " bodied projectiles");
+}
+
+size_t ProjectileSystem::getPooledProjectileCount() const {
+    return pooledProjectiles_.size();
+}
+
 void ProjectileSystem::setPhysicsSystem(PhysicsSystem* physicsSystem) {
     physicsSystem_ = physicsSystem;
     Logger::getInstance().log(LogLevel::INFO_LEVEL,
@@ -267,7 +320,18 @@ void ProjectileSystem::resetPerformanceStats() {
 
 // Private helper methods
 
-void ProjectileSystem::updateProjectilePhysics(EntityID entity, ProjectileComponent& projectile, Transform& transform, float deltaTime) {
+void ProjectileSystem::updateProjectilePhysics(EntityID entity, ProjectileComponent& projectile, Transform& transform, EntityManager& entityManager, float deltaTime) {
+    // Body-backed projectiles are integrated by Jolt; PhysicsSystem writes the
+    // Transform back each step. Just mirror the body's velocity so lifetime
+    // tracking and debug output stay meaningful.
+    if (physicsEnabled_ && physicsSystem_ && projectile.useHighPrecisionPhysics) {
+        if (entityManager.hasComponent<RigidBodyComponent>(entity)) {
+            projectile.currentVelocity = entityManager.getComponent<RigidBodyComponent>(entity).velocity;
+        }
+        return;
+    }
+
+    // Body-less fast path: analytic trajectory integration
     // Apply gravity if enabled
     if (projectile.affectedByGravity && projectile.gravityScale > 0.0f) {
         const float gravity = 9.81f * projectile.gravityScale;
@@ -280,13 +344,6 @@ void ProjectileSystem::updateProjectilePhysics(EntityID entity, ProjectileCompon
     // Update position based on velocity
     glm::vec3 movement = projectile.currentVelocity * deltaTime;
     transform.position += movement;
-
-    // If using physics system, sync with physics body
-    // TODO: Add proper physics synchronization when needed
-    // if (physicsEnabled_ && physicsSystem_) {
-    //     // Physics system will handle position updates
-    //     // We just need to read back the physics position
-    // }
 }
 
 void ProjectileSystem::updateProjectileLifetime(EntityID entity, ProjectileComponent& projectile, EntityManager& entityManager, float deltaTime) {
@@ -298,16 +355,46 @@ void ProjectileSystem::updateProjectileLifetime(EntityID entity, ProjectileCompo
             reason = "Distance limit reached (" + std::to_string(projectile.distanceTraveled) + "m)";
         }
 
-        logProjectileDestroy(entity, projectile, reason);
-        stats_.projectilesDestroyed++;
-        entityManager.destroyEntity(entity);
+        releaseProjectileToPool(entity, projectile, entityManager, reason);
     }
 }
 
-void ProjectileSystem::handleProjectileCollisions(EntityID entity, ProjectileComponent& projectile, Transform& transform, EntityManager& entityManager) {
-    // Simplified collision detection - in a real implementation this would integrate with physics system
-    // For now, just implement basic ground collision
+void ProjectileSystem::handleProjectileCollisions(EntityID entity, ProjectileComponent& projectile, Transform& transform, EntityManager& entityManager, float deltaTime) {
+    // Body-backed projectiles collide through Jolt contacts - nothing to do here
+    if (physicsEnabled_ && physicsSystem_ && projectile.useHighPrecisionPhysics) {
+        return;
+    }
 
+    // Body-less fast path: one swept raycast covering this frame's movement.
+    // This is exact continuous collision for a point projectile - no tunneling
+    // at any speed, and far cheaper than a Jolt body with CCD enabled.
+    if (physicsEnabled_ && physicsSystem_) {
+        glm::vec3 movement = projectile.currentVelocity * deltaTime;
+        float distance = glm::length(movement);
+        if (distance > 1e-6f) {
+            glm::vec3 start = transform.position - movement;  // Position was already advanced this frame
+            auto hit = physicsSystem_->raycast(start, movement / distance, distance, projectile.collisionMask);
+            if (hit.hit) {
+                float impactSpeed = glm::length(projectile.currentVelocity);
+
+                // Snap to the impact point so bounces reflect off the surface, not past it
+                transform.position = hit.point;
+
+                if (collisionCallback_) {
+                    collisionCallback_(entity, hit.entity, hit.point, hit.normal, impactSpeed);
+                }
+
+                projectile.handleCollision(hit.normal, impactSpeed);
+
+                if (projectile.destroyOnAnyCollision || projectile.collisionResponse == ProjectileComponent::CollisionResponse::DESTROY) {
+                    releaseProjectileToPool(entity, projectile, entityManager, "Raycast collision");
+                }
+            }
+        }
+        return;
+    }
+
+    // No physics world connected - fall back to basic ground plane collision
     const float groundHeight = 0.0f;
     if (transform.position.y <= groundHeight && projectile.currentVelocity.y < 0.0f) {
         // Ground collision detected
@@ -329,9 +416,7 @@ void ProjectileSystem::handleProjectileCollisions(EntityID entity, ProjectileCom
 
         // Destroy if configured to destroy on any collision
         if (projectile.destroyOnAnyCollision || projectile.collisionResponse == ProjectileComponent::CollisionResponse::DESTROY) {
-            logProjectileDestroy(entity, projectile, "Ground collision");
-            stats_.projectilesDestroyed++;
-            entityManager.destroyEntity(entity);
+            releaseProjectileToPool(entity, projectile, entityManager, "Ground collision");
         }
     }
 }
@@ -343,6 +428,15 @@ EntityID ProjectileSystem::createProjectileEntity(
     ProjectileMaterials::Type materialType,
     EntityManager& entityManager)
 {
+    // Reuse a parked pool entity when one matches the physics mode -
+    // spawn by reset avoids entity, component, and Jolt body construction
+    bool wantsBody = physicsEnabled_ && projectileComponent.useHighPrecisionPhysics && physicsSystem_;
+    EntityID pooled = acquirePooledProjectile(wantsBody);
+    if (pooled != INVALID_ENTITY) {
+        resetPooledProjectile(pooled, position, direction, projectileComponent, materialType, entityManager);
+        return pooled;
+    }
+
     EntityID entity = entityManager.createEntity();
 
     // Add Transform component
@@ -358,7 +452,7 @@ EntityID ProjectileSystem::createProjectileEntity(
 
     // Add Renderable component for visual representation
     Renderable renderable;
-    renderable.meshPath = "projectile_sphere.obj";  // SHORT PATH - assets/models/ prefix added automatically
+    renderable.setMesh("projectile_sphere.obj");  // SHORT PATH - assets/models/ prefix added automatically
     renderable.materialId = static_cast<uint32_t>(materialType);
     renderable.isVisible = true;
     entityManager.addComponent(entity, renderable);
@@ -370,8 +464,9 @@ EntityID ProjectileSystem::createProjectileEntity(
     spatial.behavior = SpatialBehavior::DYNAMIC;
     entityManager.addComponent(entity, spatial);
 
-    // Add physics if enabled
-    if (physicsEnabled_) {
+    // Full Jolt body only for projectiles that need real contacts (rolling, settling);
+    // everything else flies body-less with swept-raycast collision
+    if (physicsEnabled_ && projectile.useHighPrecisionPhysics) {
         setupProjectilePhysics(entity, projectile, entityManager);
     }
 
@@ -400,6 +495,92 @@ void ProjectileSystem::setupProjectilePhysics(EntityID entity, const ProjectileC
     entityManager.addComponent(entity, collision);
 }
 
+EntityID ProjectileSystem::acquirePooledProjectile(bool wantsBody) {
+    auto& freeList = wantsBody ? freeBodiedProjectiles_ : freeBodylessProjectiles_;
+    if (freeList.empty()) {
+        return INVALID_ENTITY;
+    }
+
+    EntityID entity = freeList.back();
+    freeList.pop_back();
+    pooledProjectiles_.erase(entity);
+    return entity;
+}
+
+void ProjectileSystem::releaseProjectileToPool(EntityID entity, ProjectileComponent& projectile, EntityManager& entityManager, const std::string& reason) {
+    if (pooledProjectiles_.count(entity) > 0) {
+        return;  // Already parked
+    }
+
+    logProjectileDestroy(entity, projectile, reason);
+    stats_.projectilesDestroyed++;
+
+    // Pool at capacity - fall back to real destruction
+    if (pooledProjectiles_.size() >= MAX_POOLED_PROJECTILES) {
+        entityManager.destroyEntity(entity);
+        return;
+    }
+
+    // Hide and park instead of destroying - the entity keeps its full
+    // component layout (and Jolt body, if any) for the next spawn
+    if (entityManager.hasComponent<Renderable>(entity)) {
+        entityManager.getComponent<Renderable>(entity).isVisible = false;
+    }
+    if (entityManager.hasComponent<Transform>(entity)) {
+        entityManager.getComponent<Transform>(entity).setPosition(POOL_PARK_POSITION);
+    }
+
+    bool hasBody = entityManager.hasComponent<RigidBodyComponent>(entity);
+    if (hasBody) {
+        auto& rigidBody = entityManager.getComponent<RigidBodyComponent>(entity);
+        rigidBody.velocity = glm::vec3(0.0f);
+        rigidBody.angularVelocity = glm::vec3(0.0f);
+        if (physicsSystem_) {
+            physicsSystem_->parkBody(entity, POOL_PARK_POSITION);
+        }
+    }
+
+    (hasBody ? freeBodiedProjectiles_ : freeBodylessProjectiles_).push_back(entity);
+    pooledProjectiles_.insert(entity);
+}
+
+void ProjectileSystem::resetPooledProjectile(
+    EntityID entity,
+    const glm::vec3& position,
+    const glm::vec3& direction,
+    const ProjectileComponent& projectileComponent,
+    ProjectileMaterials::Type materialType,
+    EntityManager& entityManager)
+{
+    auto& transform = entityManager.getComponent<Transform>(entity);
+    transform.setPosition(position);
+    transform.setRotation(glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+    transform.setScale(glm::vec3(0.1f));
+
+    // Overwrite the recycled component wholesale - same effect as the
+    // copy-and-initialize in createProjectileEntity
+    auto& projectile = entityManager.getComponent<ProjectileComponent>(entity);
+    projectile = projectileComponent;
+    projectile.initialize(position, direction);
+
+    auto& renderable = entityManager.getComponent<Renderable>(entity);
+    renderable.materialId = static_cast<uint32_t>(materialType);
+    renderable.isVisible = true;
+
+    // Bodied reuse: refresh the component state and wake the parked body
+    // at the spawn position with the launch velocity
+    if (entityManager.hasComponent<RigidBodyComponent>(entity)) {
+        auto& rigidBody = entityManager.getComponent<RigidBodyComponent>(entity);
+        rigidBody.mass = projectile.mass;
+        rigidBody.useGravity = projectile.affectedByGravity;
+        rigidBody.velocity = projectile.currentVelocity;
+        rigidBody.angularVelocity = glm::vec3(0.0f);
+        if (physicsSystem_) {
+            physicsSystem_->reviveBody(entity, position, rigidBody);
+        }
+    }
+}
+
 void ProjectileSystem::logProjectileSpawn(EntityID entity, const ProjectileComponent& projectile, const glm::vec3& position, const glm::vec3& direction) {
     if (!debugLogging_) return;
 
@@ -11,6 +11,7 @@
 #include <memory>
 #include <vector>
 #include <functional>
+#include <unordered_set>
 
 namespace VulkanMon {
 
@@ -121,6 +122,10 @@ public:
 
     /**
      * Destroy projectile immediately
+     *
+     * The entity is returned to the projectile pool rather than destroyed:
+     * it is hidden, parked out of play, and reused by the next spawn. Only
+     * when the pool is full is the entity actually destroyed.
      * @param entity Projectile entity to destroy
      * @param entityManager ECS entity manager
      */
@@ -132,6 +137,25 @@ public:
      */
     void destroyAllProjectiles(EntityManager& entityManager);
 
+    // =========================================================================
+    // ENTITY POOLING
+    // =========================================================================
+
+    /**
+     * Pre-create inactive pooled projectiles so the first throws of a
+     * session reuse entities instead of paying entity, component, and Jolt
+     * body construction (~1ms per body) at spawn time
+     * @param bodylessCount Pooled entities for the swept-raycast fast path
+     * @param bodiedCount Pooled entities with parked Jolt bodies
+     * @param entityManager ECS entity manager
+     */
+    void prewarmPool(size_t bodylessCount, size_t bodiedCount, EntityManager& entityManager);
+
+    /**
+     * Get number of inactive projectiles currently parked in the pool
+     */
+    size_t getPooledProjectileCount() const;
+
     // =========================================================================
     // PHYSICS INTEGRATION
     // =========================================================================
@@ -216,15 +240,24 @@ private:
     // Collision handling
     CollisionCallback collisionCallback_;
 
+    // Entity pool - released projectiles are hidden and parked instead of
+    // destroyed, then spawned by reset rather than reconstruction. Bodied
+    // and body-less entities are pooled separately because reuse must match
+    // whether a Jolt body already exists.
+    static constexpr size_t MAX_POOLED_PROJECTILES = 64;
+    std::vector<EntityID> freeBodylessProjectiles_;
+    std::vector<EntityID> freeBodiedProjectiles_;
+    std::unordered_set<EntityID> pooledProjectiles_;   // Fast "is parked" lookup for update/query filtering
+
     // Performance tracking
     mutable PerformanceStats stats_ = {};
     mutable float updateTimeAccumulator_ = 0.0f;
     mutable size_t updateSampleCount_ = 0;
 
     // Private helper methods
-    void updateProjectilePhysics(EntityID entity, ProjectileComponent& projectile, Transform& transform, float deltaTime);
+    void updateProjectilePhysics(EntityID entity, ProjectileComponent& projectile, Transform& transform, EntityManager& entityManager, float deltaTime);
     void updateProjectileLifetime(EntityID entity, ProjectileComponent& projectile, EntityManager& entityManager, float deltaTime);
-    void handleProjectileCollisions(EntityID entity, ProjectileComponent& projectile, Transform& transform, EntityManager& entityManager);
+    void handleProjectileCollisions(EntityID entity, ProjectileComponent& projectile, Transform& transform, EntityManager& entityManager, float deltaTime);
 
     EntityID createProjectileEntity(
         const glm::vec3& position,
@@ -235,6 +268,18 @@ private:
     );
 
     void setupProjectilePhysics(EntityID entity, const ProjectileComponent& projectile, EntityManager& entityManager);
+
+    // Pooling helpers
+    EntityID acquirePooledProjectile(bool wantsBody);
+    void releaseProjectileToPool(EntityID entity, ProjectileComponent& projectile, EntityManager& entityManager, const std::string& reason);
+    void resetPooledProjectile(
+        EntityID entity,
+        const glm::vec3& position,
+        const glm::vec3& direction,
+        const ProjectileComponent& projectileComponent,
+        ProjectileMaterials::Type materialType,
+        EntityManager& entityManager
+    );
     void logProjectileSpawn(EntityID entity, const ProjectileComponent& projectile, const glm::vec3& position, const glm::vec3& direction);
     void logProjectileDestroy(EntityID entity, const ProjectileComponent& projectile, const std::string& reason);
 };
@@ -2,6 +2,7 @@
 #include "SpatialSystem.h"
 #include <cassert>
 #include "../utils/Logger.h"
+#include "../utils/SimdTransforms.h"
 #include "../game/CreatureDetectionSystem.h"  // For CreatureComponent
 
 namespace VulkanMon {
@@ -24,6 +25,29 @@ void RenderSystem::render(VulkanRenderer& renderer, EntityManager& entityManager
     renderedObjectCount = 0;
     culledObjectCount = 0;
 
+    // Extraction: snapshot this frame's draws into the write packet.
+    // The other packet holds the previous frame's snapshot untouched,
+    // so a recording thread consuming it would never race this write
+    packetWrite_ ^= 1;
+    RenderPacket& packet = packets_[packetWrite_];
+    packet.clear();
+    extractRenderData(packet, entityManager);
+
+    // Submission: the packet is self-contained, so nothing past this
+    // point reads live ECS state
+    submitPacket(renderer, packet);
+
+    // Log rendering statistics (only in debug builds)
+    #ifdef DEBUG
+    if ((renderedObjectCount + culledObjectCount) > 0) {
+        std::string cullingMethod = (spatialSystem && cameraSystem) ? "spatial+frustum" : "fallback";
+        VKMON_DEBUG("RenderSystem (" + cullingMethod + "): Rendered " + std::to_string(renderedObjectCount) +
+                   " objects, culled " + std::to_string(culledObjectCount));
+    }
+    #endif
+}
+
+void RenderSystem::extractRenderData(RenderPacket& packet, EntityManager& entityManager) {
     // Get camera position for distance calculations (fallback)
     glm::vec3 cameraPos(0.0f, 80.0f, 120.0f);  // Updated fallback to match actual camera position
     if (cameraSystem) {
@@ -37,7 +61,7 @@ void RenderSystem::render(VulkanRenderer& renderer, EntityManager& entityManager
 
     if (spatialSystem && cameraSystem) {
         // NEW: Use spatial frustum culling for efficiency
-        Frustum cameraFrustum = cameraSystem->getActiveCameraFrustum(entityManager);
+        const Frustum& cameraFrustum = cameraSystem->getActiveCameraFrustum(entityManager);
         candidateEntities = spatialSystem->queryFrustum(cameraFrustum);
 
         #ifdef DEBUG_VERBOSE
@@ -45,15 +69,22 @@ void RenderSystem::render(VulkanRenderer& renderer, EntityManager& entityManager
         #endif
     } else {
         // Fallback: Get all entities with Transform component
-        candidateEntities = entityManager.getEntitiesWithComponent<Transform>();
+        const auto& allTransformEntities = entityManager.getEntitiesWithComponent<Transform>();
+        candidateEntities.assign(allTransformEntities.begin(), allTransformEntities.end());
 
         #ifdef DEBUG_VERBOSE
         VKMON_DEBUG("Using fallback entity collection: " + std::to_string(candidateEntities.size()) + " entities");
         #endif
     }
 
-    // Build render commands from candidate entities
-    std::vector<RenderCommand> renderCommands;
+    // Build render commands from candidate entities (frame arena backed -
+    // reclaimed wholesale at the next World::update, no per-frame heap churn)
+    ArenaVector<RenderCommand> renderCommands;
+    renderCommands.reserve(candidateEntities.size());
+
+    // Transforms that changed this frame, composed in one SIMD batch
+    // below instead of one scalar rebuild each inside getModelMatrix()
+    ArenaVector<Transform*> dirtyTransforms;
 
     for (EntityID entity : candidateEntities) {
         // Check if entity has both Transform and Renderable components
@@ -72,7 +103,8 @@ void RenderSystem::render(VulkanRenderer& renderer, EntityManager& entityManager
             }
 
             // Calculate distance to camera for LOD and additional culling
-            float distance = glm::length(transform.position - cameraPos);
+            // (world position, so parented entities cull where they sit)
+            float distance = glm::length(transform.getWorldPosition() - cameraPos);
 
             // Additional distance-based culling for very far objects
             if (!renderable.shouldRender(distance) || distance > maxRenderDistance) {
@@ -80,52 +112,124 @@ void RenderSystem::render(VulkanRenderer& renderer, EntityManager& entityManager
                 continue;
             }
 
-            // Add to render commands
+            // Add to render commands, keyed for the radix sort below
             renderCommands.push_back({
-                entity,
+                makeSortKey(renderable.renderLayer, renderable.materialId,
+                            renderable.meshId, distance, maxRenderDistance),
                 &transform,
-                &renderable,
-                distance
+                &renderable
             });
+
+            if (transform.isDirty) {
+                dirtyTransforms.push_back(&transform);
+            }
+        }
+    }
+
+    // Batch-compose model matrices for the dirty transforms: SoA gather
+    // into the frame arena, four entities per SSE pass, scatter back
+    // into the component caches. Clean transforms keep their cached
+    // matrix and cost nothing here
+    if (!dirtyTransforms.empty()) {
+        const size_t dirtyCount = dirtyTransforms.size();
+        FrameArena& arena = FrameArena::frame();
+
+        float* soa = arena.allocate<float>(dirtyCount * 10);
+        float* px = soa;
+        float* py = soa + dirtyCount;
+        float* pz = soa + dirtyCount * 2;
+        float* qx = soa + dirtyCount * 3;
+        float* qy = soa + dirtyCount * 4;
+        float* qz = soa + dirtyCount * 5;
+        float* qw = soa + dirtyCount * 6;
+        float* sx = soa + dirtyCount * 7;
+        float* sy = soa + dirtyCount * 8;
+        float* sz = soa + dirtyCount * 9;
+        glm::mat4* composed = arena.allocate<glm::mat4>(dirtyCount);
+
+        for (size_t i = 0; i < dirtyCount; ++i) {
+            const Transform& t = *dirtyTransforms[i];
+            px[i] = t.position.x; py[i] = t.position.y; pz[i] = t.position.z;
+            qx[i] = t.rotation.x; qy[i] = t.rotation.y; qz[i] = t.rotation.z;
+            qw[i] = t.rotation.w;
+            sx[i] = t.scale.x; sy[i] = t.scale.y; sz[i] = t.scale.z;
+        }
+
+        SimdTransforms::composeMatrices(px, py, pz, qx, qy, qz, qw,
+                                        sx, sy, sz, composed, dirtyCount);
+
+        for (size_t i = 0; i < dirtyCount; ++i) {
+            dirtyTransforms[i]->modelMatrix = composed[i];
+            dirtyTransforms[i]->isDirty = false;
         }
     }
 
     // Sort render commands for optimal rendering
-    std::sort(renderCommands.begin(), renderCommands.end());
+    radixSortCommands(renderCommands);
 
-    // Submit render commands to renderer
+    // Snapshot the sorted draws: matrices by value, interned mesh
+    // handles, material ids. The packet carries no component pointers,
+    // so it stays valid after this frame's simulation mutates state
+    packet.objectDraws.reserve(renderCommands.size());
     for (const auto& cmd : renderCommands) {
-        submitRenderCommand(renderer, cmd);
-        renderedObjectCount++;
+        packet.objectDraws.push_back({
+            cmd.transform->getWorldMatrix(),
+            cmd.renderable->meshId,
+            cmd.renderable->materialId
+        });
     }
+}
 
-    // Log rendering statistics (only in debug builds)
-    #ifdef DEBUG
-    if ((renderedObjectCount + culledObjectCount) > 0) {
-        std::string cullingMethod = (spatialSystem && cameraSystem) ? "spatial+frustum" : "fallback";
-        VKMON_DEBUG("RenderSystem (" + cullingMethod + "): Rendered " + std::to_string(renderedObjectCount) +
-                   " objects, culled " + std::to_string(culledObjectCount));
+void RenderSystem::radixSortCommands(ArenaVector<RenderCommand>& commands) {
+    const size_t count = commands.size();
+    if (count < 2) {
+        return;
+    }
+
+    // Scratch buffer comes from the frame arena like the command vector
+    // itself - reclaimed wholesale at the next World::update
+    ArenaVector<RenderCommand> scratch(count);
+
+    RenderCommand* src = commands.data();
+    RenderCommand* dst = scratch.data();
+
+    // Eight counting-sort passes over 8-bit digits, least significant
+    // first. Passes where every key shares the digit (all layer 0, few
+    // distinct materials) are skipped outright
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t bucketCounts[256] = {};
+        for (size_t i = 0; i < count; ++i) {
+            bucketCounts[(src[i].sortKey >> shift) & 0xFF]++;
+        }
+        if (bucketCounts[(src[0].sortKey >> shift) & 0xFF] == count) {
+            continue; // every key identical in this digit
+        }
+
+        size_t offsets[256];
+        size_t running = 0;
+        for (size_t bucket = 0; bucket < 256; ++bucket) {
+            offsets[bucket] = running;
+            running += bucketCounts[bucket];
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            dst[offsets[(src[i].sortKey >> shift) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    // An odd number of executed passes leaves the result in the scratch
+    // buffer - copy it home
+    if (src != commands.data()) {
+        std::copy(src, src + count, commands.data());
     }
-    #endif
 }
 
-void RenderSystem::submitRenderCommand(VulkanRenderer& renderer, const RenderCommand& cmd) {
-    // Get the model matrix from transform
-    const glm::mat4& modelMatrix = cmd.transform->getModelMatrix();
-
-    // Submit render command to VulkanRenderer
-    renderer.renderECSObject(
-        modelMatrix,
-        cmd.renderable->meshPath,
-        cmd.renderable->materialId
-    );
-
-    // Log render command for debugging (verbose)
-    #ifdef DEBUG_VERBOSE
-    VKMON_DEBUG("Submitted ECS render command for entity " + std::to_string(cmd.entity) +
-               " with mesh: " + cmd.renderable->meshPath +
-               ", material: " + std::to_string(cmd.renderable->materialId));
-    #endif
+void RenderSystem::submitPacket(VulkanRenderer& renderer, const RenderPacket& packet) {
+    for (const auto& draw : packet.objectDraws) {
+        renderer.renderECSObject(draw.modelMatrix, draw.meshId, draw.materialId);
+        renderedObjectCount++;
+    }
 }
 
 } // namespace VulkanMon
\ No newline at end of file
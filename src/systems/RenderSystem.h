@@ -4,8 +4,11 @@
 #include "../components/Transform.h"
 #include "../components/Renderable.h"
 #include "../rendering/VulkanRenderer.h"
+#include "../rendering/RenderPacket.h"
+#include "../utils/FrameArena.h"
 #include "../utils/Logger.h"
 #include "CameraSystem.h"
+#include <array>
 #include <vector>
 #include <algorithm>
 #include <cassert>
@@ -30,28 +33,21 @@ private:
     CameraSystem* cameraSystem = nullptr;   // Safe: World guarantees lifetime
     SpatialSystem* spatialSystem = nullptr; // Safe: World guarantees lifetime
 
-    // Render command structure for sorting
+    // Double-buffered extraction output: each frame snapshots into one
+    // packet while the other holds the previous frame's, so recording
+    // can move off-thread without racing the next extraction
+    std::array<RenderPacket, 2> packets_;
+    uint32_t packetWrite_ = 0;
+
+    // Render command with a packed 64-bit sort key generated at
+    // creation. One integer compare orders layer, then material, then
+    // mesh, then depth - the old multi-field comparator semantics with
+    // mesh added so identical geometry draws back to back - and integer
+    // keys let a radix sort replace comparator-based std::sort
     struct RenderCommand {
-        EntityID entity;
-        Transform* transform;
-        Renderable* renderable;
-        float distanceToCamera;
-
-        // Comparator for sorting (back-to-front for transparency, front-to-back for opaque)
-        bool operator<(const RenderCommand& other) const {
-            // First sort by render layer
-            if (renderable->renderLayer != other.renderable->renderLayer) {
-                return renderable->renderLayer < other.renderable->renderLayer;
-            }
-
-            // Then by material (to minimize state changes)
-            if (renderable->materialId != other.renderable->materialId) {
-                return renderable->materialId < other.renderable->materialId;
-            }
-
-            // Finally by distance (front-to-back for opaque objects)
-            return distanceToCamera < other.distanceToCamera;
-        }
+        uint64_t sortKey = 0;
+        Transform* transform = nullptr;
+        Renderable* renderable = nullptr;
     };
 
 public:
@@ -83,8 +79,41 @@ public:
     void setMaxRenderDistance(float distance) { maxRenderDistance = distance; }
     float getMaxRenderDistance() const { return maxRenderDistance; }
 
+    // The packet the last extraction produced (the one submission used)
+    const RenderPacket& getLastExtractedPacket() const { return packets_[packetWrite_]; }
+
+    // Pack (layer, material, mesh, depth) into one radix-sortable key.
+    // Layout, most significant first:
+    //   [63:56] render layer    [55:40] material id
+    //   [39:24] mesh handle     [23:0]  quantized depth (front to back)
+    // Depth quantizes distance/maxDistance into 24 bits and saturates
+    // beyond maxDistance; fields wider than their slot are masked (a
+    // mesh-handle collision only costs state-change ordering, never
+    // correctness)
+    static uint64_t makeSortKey(uint32_t renderLayer, uint32_t materialId,
+                                AssetID meshId, float distance, float maxDistance) {
+        constexpr uint32_t DEPTH_MAX = (1u << 24) - 1;
+        float normalized = maxDistance > 0.0f ? distance / maxDistance : 0.0f;
+        normalized = std::clamp(normalized, 0.0f, 1.0f);
+        uint64_t depth = static_cast<uint64_t>(normalized * static_cast<float>(DEPTH_MAX));
+
+        return (static_cast<uint64_t>(renderLayer & 0xFFu) << 56) |
+               (static_cast<uint64_t>(materialId & 0xFFFFu) << 40) |
+               (static_cast<uint64_t>(meshId.value() & 0xFFFFu) << 24) |
+               depth;
+    }
+
 private:
-    void submitRenderCommand(VulkanRenderer& renderer, const RenderCommand& cmd);
+    // Extraction: snapshot culled, sorted draws into the packet. Every
+    // EntityManager read in the render path happens here
+    void extractRenderData(RenderPacket& packet, EntityManager& entityManager);
+
+    // Submission: record draws from the packet alone, no live ECS state
+    void submitPacket(VulkanRenderer& renderer, const RenderPacket& packet);
+
+    // LSD radix sort over the packed keys - stable, comparator-free,
+    // scratch buffer taken from the frame arena
+    void radixSortCommands(ArenaVector<RenderCommand>& commands);
 };
 
 } // namespace VulkanMon
\ No newline at end of file
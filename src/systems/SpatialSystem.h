@@ -4,7 +4,10 @@
 #include "../components/Transform.h"
 #include "../components/SpatialComponent.h"
 #include "../spatial/SpatialManager.h"
+#include "../spatial/TerritoryGrid.h"
+#include "../utils/FrameProfiler.h"
 #include "../utils/Logger.h"
+#include "../utils/MemoryTracker.h"
 #include <memory>
 #include <chrono>
 #include <limits>
@@ -15,6 +18,11 @@ class SpatialSystem : public System<Transform, SpatialComponent> {
 private:
     std::unique_ptr<SpatialManager> spatialManager_;
 
+    // Coarse XZ hash of creature home ranges - kept in sync from each
+    // entity's homePosition/territoryRadius so territory containment and
+    // overlap checks never fall back to per-creature distance sweeps
+    TerritoryGrid territoryGrid_;
+
     // Performance tracking
     struct SpatialSystemStats {
         size_t entitiesTracked = 0;
@@ -40,9 +48,17 @@ public:
         VKMON_INFO("SpatialSystem initialized with world bounds");
     }
 
+    // Preferred construction path: the world config also selects the
+    // spatial backend (octree vs Morton grid)
+    explicit SpatialSystem(const WorldConfig& worldConfig) {
+        spatialManager_ = std::make_unique<SpatialManager>(worldConfig);
+        VKMON_INFO("SpatialSystem initialized from world config '" + worldConfig.name + "'");
+    }
+
     ~SpatialSystem() = default;
 
     void update(float deltaTime, EntityManager& entityManager) override {
+        VKMON_PROFILE_SCOPE("SpatialSystem::update");
         auto start = std::chrono::high_resolution_clock::now();
 
         frameStats_ = SpatialSystemStats{};
@@ -85,12 +101,25 @@ public:
         frameStats_.entitiesProcessed = entitiesProcessed;
         frameStats_.staticEntitiesSkipped = staticEntitiesSkipped;
 
+        // Commit queued octree reinsertions under the per-frame budget;
+        // anything left over carries into the next frame and queries
+        // compensate with an epsilon expansion
+        spatialManager_->processPendingUpdates();
+
+        // Refresh persistent query deltas against this frame's churn so
+        // subscribers read current enter/exit events during their update
+        spatialManager_->refreshPersistentQueries();
+
         auto end = std::chrono::high_resolution_clock::now();
         frameStats_.updateTimeMs = std::chrono::duration<float, std::milli>(end - start).count();
 
-        // Performance logging with frame-based throttling
+        // Performance logging with frame-based throttling; the memory
+        // gauge refreshes on the same cadence - walking container
+        // capacities every frame would cost more than it tells
         static int frameCount = 0;
         if (++frameCount >= 1800) { // Every ~30 seconds at 60 FPS
+            MemoryTracker::getInstance().setUsage(MemoryTag::SpatialSystem,
+                                                  spatialManager_->getEstimatedMemoryBytes());
             logPerformanceStats();
             frameCount = 0;
         }
@@ -113,6 +142,64 @@ public:
         return spatialManager_->queryRadius(center, radius, layerMask);
     }
 
+    // Zero-allocation variants for hot per-frame callers: results are
+    // appended into a reusable caller-provided buffer
+    void queryFrustum(const Frustum& frustum, uint32_t layerMask, std::vector<EntityID>& results) const {
+        spatialManager_->queryFrustum(frustum, layerMask, results);
+    }
+
+    void queryRadius(const glm::vec3& center, float radius, uint32_t layerMask, std::vector<EntityID>& results) const {
+        spatialManager_->queryRadius(center, radius, layerMask, results);
+    }
+
+    void queryRegion(const BoundingBox& region, uint32_t layerMask, std::vector<EntityID>& results) const {
+        spatialManager_->queryRegion(region, layerMask, results);
+    }
+
+    // Octree-locality entity order for the storage compaction pass
+    // (World::compactStorage); run it during loading screens or idle
+    // frames so long sessions keep fresh-boot iteration locality
+    std::vector<EntityID> getEntitiesInSpatialOrder() const {
+        return spatialManager_->getEntitiesInSpatialOrder();
+    }
+
+    size_t queryRadiusCount(const glm::vec3& center, float radius, uint32_t layerMask = LayerMask::All,
+                            size_t maxCount = std::numeric_limits<size_t>::max()) const {
+        return spatialManager_->queryRadiusCount(center, radius, layerMask, maxCount);
+    }
+
+    // Persistent queries: register once, read entered/exited deltas
+    // each frame instead of re-executing the same shaped query
+    SpatialManager::PersistentQueryHandle registerRadiusQuery(const glm::vec3& center, float radius,
+                                                              uint32_t layerMask = LayerMask::All) {
+        return spatialManager_->registerRadiusQuery(center, radius, layerMask);
+    }
+
+    SpatialManager::PersistentQueryHandle registerFrustumQuery(const Frustum& frustum,
+                                                               uint32_t layerMask = LayerMask::All) {
+        return spatialManager_->registerFrustumQuery(frustum, layerMask);
+    }
+
+    void moveRadiusQuery(SpatialManager::PersistentQueryHandle handle, const glm::vec3& newCenter) {
+        spatialManager_->moveRadiusQuery(handle, newCenter);
+    }
+
+    void moveFrustumQuery(SpatialManager::PersistentQueryHandle handle, const Frustum& newFrustum) {
+        spatialManager_->moveFrustumQuery(handle, newFrustum);
+    }
+
+    void unregisterPersistentQuery(SpatialManager::PersistentQueryHandle handle) {
+        spatialManager_->unregisterPersistentQuery(handle);
+    }
+
+    const SpatialManager::PersistentQueryDelta* getPersistentQueryDelta(SpatialManager::PersistentQueryHandle handle) const {
+        return spatialManager_->getPersistentQueryDelta(handle);
+    }
+
+    const std::unordered_set<EntityID>* getPersistentQueryResults(SpatialManager::PersistentQueryHandle handle) const {
+        return spatialManager_->getPersistentQueryResults(handle);
+    }
+
     // Pokemon-specific queries
     std::vector<EntityID> findCreaturesInRadius(const glm::vec3& center, float radius) const {
         return spatialManager_->findCreaturesInRadius(center, radius);
@@ -138,9 +225,34 @@ public:
 
     void removeEntity(EntityID entity) {
         spatialManager_->removeEntity(entity);
+        territoryGrid_.remove(entity);
         frameStats_.entitiesRemoved++;
     }
 
+    // ===== TERRITORY QUERIES =====
+    // Backed by the coarse territory hash - O(1) bucket lookups regardless
+    // of creature count
+
+    /// Creatures whose claimed home range covers this position
+    std::vector<EntityID> findTerritoryClaimants(const glm::vec3& position) const {
+        std::vector<EntityID> results;
+        territoryGrid_.claimantsAt(position, results);
+        return results;
+    }
+
+    void findTerritoryClaimants(const glm::vec3& position, std::vector<EntityID>& results) const {
+        territoryGrid_.claimantsAt(position, results);
+    }
+
+    /// Territories intersecting the given circle - e.g. to validate a
+    /// prospective new home range before assigning it
+    void findOverlappingTerritories(const glm::vec3& center, float radius,
+                                   std::vector<EntityID>& results) const {
+        territoryGrid_.overlapping(center, radius, results);
+    }
+
+    const TerritoryGrid& getTerritoryGrid() const { return territoryGrid_; }
+
     // Performance and debugging
     const SpatialSystemStats& getFrameStats() const { return frameStats_; }
 
@@ -162,8 +274,10 @@ private:
         if (spatial.needsSpatialUpdate) {
             // Check if this is the first time we're seeing this entity
             if (!spatial.isInitialized) {
-                // First time - add the entity to spatial manager
-                spatialManager_->addEntity(entity, transform.position, spatial.spatialLayers);
+                // First time - add the entity to spatial manager; static
+                // entities go into the rebuild-only static tier
+                spatialManager_->addEntity(entity, transform.position, spatial.spatialLayers,
+                                           spatial.behavior == SpatialBehavior::STATIC);
                 spatial.setHomePosition(transform.position);
                 spatial.isInitialized = true;
                 frameStats_.entitiesAdded++;
@@ -177,6 +291,13 @@ private:
             spatial.needsSpatialUpdate = false;
         }
 
+        // Keep the territory hash in sync - assign() no-ops when the claim
+        // is unchanged, so this is one hash probe per creature per frame
+        // and only re-buckets on a new home or Inspector-edited radius
+        if (spatial.hasLayer(LayerMask::Creatures) && spatial.territoryRadius > 0.0f) {
+            territoryGrid_.assign(entity, spatial.homePosition, spatial.territoryRadius);
+        }
+
         // Update query throttling timer
         spatial.timeSinceLastQuery += deltaTime;
     }
@@ -194,6 +315,7 @@ private:
         VKMON_INFO("  Entities updated: " + std::to_string(frameStats_.entitiesUpdated));
         VKMON_INFO("  Entities added: " + std::to_string(frameStats_.entitiesAdded));
         VKMON_INFO("  Entities removed: " + std::to_string(frameStats_.entitiesRemoved));
+        VKMON_INFO("  Pending spatial updates: " + std::to_string(spatialManager_->getPendingUpdateCount()));
         VKMON_INFO("  Frame update time: " + std::to_string(frameStats_.updateTimeMs) + "ms");
         VKMON_INFO("Spatial Manager:");
         VKMON_INFO("  Total queries: " + std::to_string(spatialStats.totalQueries));
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "../core/SystemImpl.h"
+#include "../components/Transform.h"
+#include "../utils/Logger.h"
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace VulkanMon {
+
+// Composes world matrices for parented transforms
+//
+// Entities whose Transform carries a parent follow that parent: their
+// world matrix is parentWorld * local. The system keeps a flat update
+// order with parents before children, so one linear walk composes the
+// whole forest, and it is dirty-tracked end to end - a subtree only
+// recomputes when its own local transform or an ancestor's world
+// matrix changed this frame. A static rider on a static creature costs
+// two version compares per frame, not a matrix multiply.
+//
+// The order is rebuilt only when topology changes (an entity parented,
+// reparented, or unparented), detected by comparing the (entity,
+// parent) link snapshot. Cycles and dangling parents are demoted to
+// roots with a warning rather than hanging the walk.
+//
+// Registered after the systems that move transforms (physics,
+// projectiles) so children compose against this frame's parent state.
+class TransformHierarchySystem : public System<Transform> {
+private:
+    struct Link {
+        EntityID entity;
+        EntityID parent;
+
+        bool operator==(const Link& other) const {
+            return entity == other.entity && parent == other.parent;
+        }
+    };
+
+    // Snapshot of parent links used to detect topology changes
+    std::vector<Link> topology_;
+
+    // Parented entities, parents before children
+    std::vector<EntityID> updateOrder_;
+
+    // Local change tick each entity's world matrix was last composed
+    // against (also tracks root parents, so a moved root re-dirties
+    // its subtree exactly once)
+    std::unordered_map<EntityID, uint64_t> composedVersions_;
+
+    struct HierarchyStats {
+        size_t parentedEntities = 0;
+        size_t composedThisFrame = 0;
+        size_t orderRebuilds = 0;
+    } frameStats_;
+
+public:
+    void update(float deltaTime, EntityManager& entityManager) override {
+        (void)deltaTime;
+
+        frameStats_.composedThisFrame = 0;
+
+        refreshTopology(entityManager);
+        frameStats_.parentedEntities = updateOrder_.size();
+        if (updateOrder_.empty()) {
+            return;
+        }
+
+        // Entities whose WORLD matrix changed this frame; children of
+        // anything in here must recompose
+        std::unordered_set<EntityID> worldChanged;
+
+        for (EntityID entity : updateOrder_) {
+            Transform& transform = entityManager.getComponent<Transform>(entity);
+            EntityID parent = transform.parent;
+
+            if (!entityManager.hasComponent<Transform>(parent)) {
+                // Parent vanished since the rebuild - behave as a root
+                // until the next topology refresh
+                transform.worldComposed = false;
+                continue;
+            }
+            Transform& parentTransform = entityManager.getComponent<Transform>(parent);
+
+            // Root parents are not walked themselves, so fold their
+            // local changes into the changed set on first encounter
+            if (parentTransform.parent == INVALID_ENTITY &&
+                worldChanged.find(parent) == worldChanged.end()) {
+                uint64_t& seen = composedVersions_[parent];
+                if (seen != parentTransform.changeVersion) {
+                    seen = parentTransform.changeVersion;
+                    worldChanged.insert(parent);
+                }
+            }
+
+            uint64_t& composedVersion = composedVersions_[entity];
+            bool localChanged = composedVersion != transform.changeVersion;
+            bool parentChanged = worldChanged.find(parent) != worldChanged.end();
+            if (!localChanged && !parentChanged && transform.worldComposed) {
+                continue;
+            }
+
+            // Parents precede children in updateOrder_, so a parented
+            // parent's world matrix is already current here
+            transform.worldMatrix = parentTransform.getWorldMatrix() * transform.getModelMatrix();
+            transform.worldComposed = true;
+            composedVersion = transform.changeVersion;
+            worldChanged.insert(entity);
+            frameStats_.composedThisFrame++;
+        }
+    }
+
+    void render(VulkanRenderer& renderer, EntityManager& entityManager) override {
+        // Nothing to render
+    }
+
+    const HierarchyStats& getFrameStats() const { return frameStats_; }
+
+private:
+    void refreshTopology(EntityManager& entityManager) {
+        // Gather the current parent links
+        std::vector<Link> links;
+        auto& entities = entityManager.getEntitiesWithComponent<Transform>();
+        for (EntityID entity : entities) {
+            Transform& transform = entityManager.getComponent<Transform>(entity);
+            if (transform.parent != INVALID_ENTITY) {
+                links.push_back({entity, transform.parent});
+            }
+        }
+
+        if (links == topology_) {
+            return;
+        }
+
+        // Entities that were parented but no longer are must stop
+        // serving their stale composed matrix
+        std::unordered_set<EntityID> nowParented;
+        for (const Link& link : links) {
+            nowParented.insert(link.entity);
+        }
+        for (const Link& old : topology_) {
+            if (nowParented.find(old.entity) == nowParented.end() &&
+                entityManager.hasComponent<Transform>(old.entity)) {
+                entityManager.getComponent<Transform>(old.entity).worldComposed = false;
+            }
+        }
+
+        rebuildUpdateOrder(links);
+        topology_ = std::move(links);
+        frameStats_.orderRebuilds++;
+    }
+
+    void rebuildUpdateOrder(const std::vector<Link>& links) {
+        updateOrder_.clear();
+        updateOrder_.reserve(links.size());
+
+        // Children grouped by parent, restricted to parented entities -
+        // root parents are entry points, not nodes
+        std::unordered_map<EntityID, std::vector<EntityID>> children;
+        std::unordered_set<EntityID> parented;
+        for (const Link& link : links) {
+            children[link.parent].push_back(link.entity);
+            parented.insert(link.entity);
+        }
+
+        // Breadth-first from every entity whose parent is a root: each
+        // entity is emitted after its parent, giving the linear
+        // parent-before-child walk update() relies on
+        std::unordered_set<EntityID> emitted;
+        for (const Link& link : links) {
+            if (parented.find(link.parent) == parented.end()) {
+                emitSubtree(link.entity, children, emitted);
+            }
+        }
+
+        // Anything not reached sits in a parent cycle - demote to root
+        if (emitted.size() != parented.size()) {
+            for (const Link& link : links) {
+                if (emitted.find(link.entity) == emitted.end()) {
+                    VKMON_WARNING("TransformHierarchySystem: parent cycle involving entity " +
+                                  std::to_string(static_cast<uint32_t>(link.entity)) +
+                                  " - treating as root");
+                }
+            }
+        }
+    }
+
+    void emitSubtree(EntityID entity,
+                     const std::unordered_map<EntityID, std::vector<EntityID>>& children,
+                     std::unordered_set<EntityID>& emitted) {
+        if (!emitted.insert(entity).second) {
+            return; // already emitted (shared ancestor paths)
+        }
+        updateOrder_.push_back(entity);
+
+        auto it = children.find(entity);
+        if (it != children.end()) {
+            for (EntityID child : it->second) {
+                emitSubtree(child, children, emitted);
+            }
+        }
+    }
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,97 @@
+#include "CpuFeatures.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define VKMON_CPU_X86 1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace VulkanMon {
+
+namespace {
+
+#if VKMON_CPU_X86
+
+void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t out[4]) {
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subleaf));
+    out[0] = static_cast<uint32_t>(regs[0]);
+    out[1] = static_cast<uint32_t>(regs[1]);
+    out[2] = static_cast<uint32_t>(regs[2]);
+    out[3] = static_cast<uint32_t>(regs[3]);
+#else
+    __cpuid_count(leaf, subleaf, out[0], out[1], out[2], out[3]);
+#endif
+}
+
+uint64_t xgetbv0() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    // xgetbv encoded as bytes so no -mxsave build flag is needed
+    __asm__ volatile(".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+CpuFeatures detect() {
+    CpuFeatures features;
+
+    uint32_t regs[4];
+    cpuid(0, 0, regs);
+    uint32_t maxLeaf = regs[0];
+    if (maxLeaf < 1) {
+        return features;
+    }
+
+    cpuid(1, 0, regs);
+    const uint32_t ecx = regs[2];
+    const uint32_t edx = regs[3];
+    features.sse2 = (edx & (1u << 26)) != 0;
+    features.sse41 = (ecx & (1u << 19)) != 0;
+
+    // AVX family requires the OS to save the extended register state:
+    // OSXSAVE + XGETBV XMM|YMM for AVX/AVX2, plus opmask|ZMM for AVX-512
+    const bool osxsave = (ecx & (1u << 27)) != 0;
+    const bool avxCpuBit = (ecx & (1u << 28)) != 0;
+    if (osxsave && avxCpuBit) {
+        const uint64_t xcr0 = xgetbv0();
+        const bool ymmState = (xcr0 & 0x6) == 0x6;
+        const bool zmmState = (xcr0 & 0xe6) == 0xe6;
+
+        features.avx = ymmState;
+        features.fma = ymmState && (ecx & (1u << 12)) != 0;
+        if (ymmState && maxLeaf >= 7) {
+            cpuid(7, 0, regs);
+            const uint32_t ebx7 = regs[1];
+            features.avx2 = (ebx7 & (1u << 5)) != 0;
+            features.avx512f = zmmState && (ebx7 & (1u << 16)) != 0;
+        }
+    }
+
+    return features;
+}
+
+#else // !VKMON_CPU_X86
+
+CpuFeatures detect() {
+    return CpuFeatures{};
+}
+
+#endif
+
+} // namespace
+
+const CpuFeatures& CpuFeatures::get() {
+    static const CpuFeatures features = detect();
+    return features;
+}
+
+} // namespace VulkanMon
@@ -0,0 +1,30 @@
+#pragma once
+
+namespace VulkanMon {
+
+// =============================================================================
+// CPU FEATURES - One-time CPUID-based instruction set detection
+// =============================================================================
+//
+// Queried once (thread-safe static) so SIMD kernels can be selected at
+// startup instead of compiled for the lowest common denominator. AVX
+// and wider require both the CPUID feature bit and OS support for the
+// extended register state (XGETBV) - a kernel that saves only XMM state
+// would corrupt YMM/ZMM registers across context switches, so both
+// checks gate the flags below.
+//
+// On non-x86 targets every flag reads false and dispatch falls back to
+// the portable scalar paths.
+struct CpuFeatures {
+    bool sse2 = false;
+    bool sse41 = false;
+    bool avx = false;
+    bool fma = false;
+    bool avx2 = false;
+    bool avx512f = false;
+
+    // Detection runs on first call and is cached for the process
+    static const CpuFeatures& get();
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace VulkanMon {
+
+// Per-frame linear (bump) allocator for transient allocations
+//
+// Hot paths build thousands of short-lived vectors per frame (render
+// commands, spatial query results, instance batches). FrameArena hands
+// out memory with a pointer bump and releases everything at once when
+// reset() is called at the start of the next frame. Blocks are retained
+// across resets, so steady-state frames perform zero heap allocations.
+//
+// Freed memory is never reclaimed mid-frame - growth inside an arena
+// container abandons the old storage until reset. That is by design:
+// transient per-frame data only.
+//
+// The engine-wide frame arena (frameArena()) follows the documented
+// single-World/static-cache model: World::update resets it once per
+// frame on the main thread. Do not allocate from it on worker threads.
+class FrameArena {
+private:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 256 * 1024; // 256 KiB
+
+    struct Block {
+        std::unique_ptr<std::byte[]> memory;
+        size_t size = 0;
+    };
+
+    std::vector<Block> blocks;
+    size_t currentBlock = 0;
+    size_t currentOffset = 0;
+    size_t blockSize;
+
+    void addBlock(size_t minimumSize) {
+        Block block;
+        block.size = std::max(blockSize, minimumSize);
+        block.memory = std::make_unique<std::byte[]>(block.size);
+        blocks.push_back(std::move(block));
+    }
+
+public:
+    explicit FrameArena(size_t blockSize = DEFAULT_BLOCK_SIZE)
+        : blockSize(blockSize) {}
+
+    // Non-copyable (owns memory blocks referenced by outstanding pointers)
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Allocate raw bytes with the requested alignment
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        if (blocks.empty()) {
+            addBlock(bytes);
+        }
+
+        while (true) {
+            Block& block = blocks[currentBlock];
+            uintptr_t base = reinterpret_cast<uintptr_t>(block.memory.get());
+            uintptr_t aligned = (base + currentOffset + alignment - 1) & ~(alignment - 1);
+            size_t newOffset = (aligned - base) + bytes;
+
+            if (newOffset <= block.size) {
+                currentOffset = newOffset;
+                return reinterpret_cast<void*>(aligned);
+            }
+
+            // Current block exhausted - move to (or create) the next one
+            if (currentBlock + 1 >= blocks.size()) {
+                addBlock(bytes + alignment);
+            }
+            currentBlock++;
+            currentOffset = 0;
+        }
+    }
+
+    // Typed allocation of count default-constructible slots
+    template<typename T>
+    T* allocate(size_t count) {
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // Rewind the arena; all previously handed-out memory becomes invalid.
+    // Retains blocks so the next frame reuses them without heap traffic.
+    void reset() {
+        currentBlock = 0;
+        currentOffset = 0;
+    }
+
+    // Total capacity currently held (for memory tracking)
+    size_t capacityBytes() const {
+        size_t total = 0;
+        for (const Block& block : blocks) {
+            total += block.size;
+        }
+        return total;
+    }
+
+    // Bytes handed out since the last reset
+    size_t usedBytes() const {
+        size_t total = 0;
+        for (size_t i = 0; i < currentBlock && i < blocks.size(); ++i) {
+            total += blocks[i].size;
+        }
+        return total + currentOffset;
+    }
+
+    // Engine-wide frame arena, reset once per frame by World::update
+    static FrameArena& frame() {
+        static FrameArena instance;
+        return instance;
+    }
+};
+
+// std-compatible allocator adapter so hot paths can keep using standard
+// containers: std::vector<RenderCommand, FrameArenaAllocator<RenderCommand>>
+template<typename T>
+class FrameArenaAllocator {
+private:
+    FrameArena* arena;
+
+public:
+    using value_type = T;
+
+    explicit FrameArenaAllocator(FrameArena& arena = FrameArena::frame())
+        : arena(&arena) {}
+
+    template<typename U>
+    FrameArenaAllocator(const FrameArenaAllocator<U>& other)
+        : arena(other.getArena()) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) {
+        // Linear arena: memory is reclaimed wholesale on reset()
+    }
+
+    FrameArena* getArena() const { return arena; }
+
+    template<typename U>
+    bool operator==(const FrameArenaAllocator<U>& other) const {
+        return arena == other.getArena();
+    }
+    template<typename U>
+    bool operator!=(const FrameArenaAllocator<U>& other) const {
+        return arena != other.getArena();
+    }
+};
+
+// Convenience alias for per-frame transient vectors
+template<typename T>
+using ArenaVector = std::vector<T, FrameArenaAllocator<T>>;
+
+} // namespace VulkanMon
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace VulkanMon {
+
+// =============================================================================
+// FRAME PROFILER - Hierarchical scoped-zone CPU timing with frame history
+// =============================================================================
+//
+// One place for CPU frame timing instead of per-system stat structs and
+// ad-hoc Logger timing calls. Systems mark their work with
+// VKMON_PROFILE_SCOPE("SpatialSystem::update"); nesting scopes builds a
+// per-frame timing tree, and the last HISTORY_FRAMES completed frames are
+// kept in a ring so the Inspector can show both a flame-style breakdown of
+// the latest frame and a frame-time history plot.
+//
+// Main-thread only by design, matching the single-threaded ECS ownership
+// model: update and render both run on the main thread, so zones need no
+// synchronization and cost two clock reads plus a vector push each.
+// Worker-side jobs report through their own stats; this tree answers
+// "where did the main thread's frame go".
+//
+// Zone names must be string literals (the tree stores the pointer, not a
+// copy) - the VKMON_PROFILE_SCOPE macro makes that the natural usage.
+class FrameProfiler {
+public:
+    static constexpr size_t HISTORY_FRAMES = 120;
+
+    // Runaway-recursion guard; a frame tree should be tens of zones
+    static constexpr size_t MAX_ZONES_PER_FRAME = 1024;
+
+    struct Zone {
+        const char* name = nullptr;   // String literal from the macro
+        float durationMs = 0.0f;
+        uint16_t depth = 0;           // Nesting level - drives flame indentation
+        int32_t parent = -1;          // Index into the frame's zone vector, -1 for roots
+    };
+
+    struct FrameRecord {
+        uint64_t frameNumber = 0;
+        float totalMs = 0.0f;
+        std::vector<Zone> zones;      // Recorded in begin order (pre-order traversal)
+    };
+
+    static FrameProfiler& getInstance() {
+        static FrameProfiler instance;
+        return instance;
+    }
+
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+    bool isEnabled() const { return enabled_; }
+
+    // Closes the previous frame into the history ring and opens a new
+    // one. Call once per frame, before any zones.
+    void beginFrame() {
+        auto now = Clock::now();
+
+        if (frameOpen_) {
+            current_.totalMs = toMs(now - frameStart_);
+
+            // Swap keeps both vectors' capacities recycling through the ring
+            FrameRecord& slot = history_[writeIndex_];
+            slot.frameNumber = current_.frameNumber;
+            slot.totalMs = current_.totalMs;
+            std::swap(slot.zones, current_.zones);
+
+            writeIndex_ = (writeIndex_ + 1) % HISTORY_FRAMES;
+            if (completedFrames_ < HISTORY_FRAMES) {
+                completedFrames_++;
+            }
+        }
+
+        current_.zones.clear();
+        current_.frameNumber = nextFrameNumber_++;
+        openZones_.clear();
+        frameStart_ = now;
+        frameOpen_ = true;
+    }
+
+    void beginZone(const char* name) {
+        if (!enabled_ || !frameOpen_ || current_.zones.size() >= MAX_ZONES_PER_FRAME) {
+            return;
+        }
+
+        Zone zone;
+        zone.name = name;
+        zone.depth = static_cast<uint16_t>(openZones_.size());
+        zone.parent = openZones_.empty() ? -1 : static_cast<int32_t>(openZones_.back().zoneIndex);
+        current_.zones.push_back(zone);
+
+        openZones_.push_back(OpenZone{current_.zones.size() - 1, Clock::now()});
+    }
+
+    void endZone() {
+        if (!enabled_ || !frameOpen_ || openZones_.empty()) {
+            return; // Balanced by construction when used through the macro
+        }
+
+        const OpenZone& open = openZones_.back();
+        current_.zones[open.zoneIndex].durationMs = toMs(Clock::now() - open.start);
+        openZones_.pop_back();
+    }
+
+    // Completed frames, newest first: framesBack 0 is the latest closed
+    // frame. Returns an empty record when no frame has completed yet.
+    const FrameRecord& getHistoryFrame(size_t framesBack = 0) const {
+        static const FrameRecord empty;
+        if (framesBack >= completedFrames_) {
+            return empty;
+        }
+        size_t index = (writeIndex_ + HISTORY_FRAMES - 1 - framesBack) % HISTORY_FRAMES;
+        return history_[index];
+    }
+
+    size_t getCompletedFrameCount() const { return completedFrames_; }
+
+private:
+    using Clock = std::chrono::high_resolution_clock;
+
+    FrameProfiler() {
+        openZones_.reserve(32);
+        current_.zones.reserve(64);
+    }
+
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    static float toMs(Clock::duration duration) {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+
+    struct OpenZone {
+        size_t zoneIndex = 0;
+        Clock::time_point start;
+    };
+
+    bool enabled_ = true;
+    bool frameOpen_ = false;
+    uint64_t nextFrameNumber_ = 0;
+    Clock::time_point frameStart_;
+
+    FrameRecord current_;
+    std::vector<OpenZone> openZones_;
+
+    std::array<FrameRecord, HISTORY_FRAMES> history_;
+    size_t writeIndex_ = 0;
+    size_t completedFrames_ = 0;
+};
+
+// RAII zone helper - prefer the macro below
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) {
+        FrameProfiler::getInstance().beginZone(name);
+    }
+    ~ProfileScope() {
+        FrameProfiler::getInstance().endZone();
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+} // namespace VulkanMon
+
+#define VKMON_PROFILE_CONCAT_INNER(a, b) a##b
+#define VKMON_PROFILE_CONCAT(a, b) VKMON_PROFILE_CONCAT_INNER(a, b)
+
+// Times the enclosing scope as a zone in the frame tree; name must be a
+// string literal
+#define VKMON_PROFILE_SCOPE(name) \
+    ::VulkanMon::ProfileScope VKMON_PROFILE_CONCAT(vkmonProfileScope_, __LINE__)(name)
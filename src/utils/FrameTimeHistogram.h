@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace VulkanMon {
+
+// =============================================================================
+// FRAME TIME HISTOGRAM - Percentile tracking and spike detection
+// =============================================================================
+//
+// Average FPS hides the frames that actually hurt: a run of 7ms frames
+// with an occasional 20ms spike averages fine and plays badly. This
+// histogram records every frame time into fixed-width buckets so the
+// distribution's tail stays visible - p50/p95/p99/max instead of a mean.
+//
+// Spike detection compares each frame against the running median rather
+// than a hard threshold: a frame is a spike when it exceeds both an
+// absolute floor (so 144Hz noise never trips it) and a multiple of p50
+// (so a heavy debug build with 15ms frames doesn't flag all of them).
+// The caller pairs a detected spike with FrameProfiler's zone tree for
+// that frame to attribute the time.
+//
+// Main-thread only, like FrameProfiler: record() is called once per
+// frame from Application::processFrame, so no synchronization needed.
+class FrameTimeHistogram {
+public:
+    // 0..50ms at 0.25ms resolution; anything slower lands in the
+    // overflow bucket and still counts toward percentiles and max
+    static constexpr size_t BUCKET_COUNT = 200;
+    static constexpr float BUCKET_WIDTH_MS = 0.25f;
+
+    // Spike = frame time > max(floor, factor * p50), after warmup
+    static constexpr float SPIKE_FLOOR_MS = 10.0f;
+    static constexpr float SPIKE_FACTOR = 2.0f;
+    static constexpr size_t SPIKE_WARMUP_FRAMES = 120;
+
+    // Records one frame and reports whether it qualifies as a spike.
+    // The first SPIKE_WARMUP_FRAMES never report spikes - startup frames
+    // (shader warmup, first-touch page faults) would drown the signal.
+    bool record(float frameTimeMs) {
+        // Spike test runs against the distribution *before* this frame
+        // so one bad frame can't raise the bar it is judged by
+        bool spike = totalFrames_ >= SPIKE_WARMUP_FRAMES &&
+                     frameTimeMs > SPIKE_FLOOR_MS &&
+                     frameTimeMs > SPIKE_FACTOR * percentile(50.0f);
+
+        buckets_[bucketFor(frameTimeMs)]++;
+        totalFrames_++;
+        if (frameTimeMs > maxMs_) {
+            maxMs_ = frameTimeMs;
+        }
+        if (spike) {
+            spikeCount_++;
+        }
+        return spike;
+    }
+
+    // Percentile from the bucketed distribution, reported as the upper
+    // edge of the bucket containing the p-th frame (conservative: never
+    // understates the tail). Returns 0 before any frames are recorded.
+    float percentile(float p) const {
+        if (totalFrames_ == 0) {
+            return 0.0f;
+        }
+
+        uint64_t target = static_cast<uint64_t>(p / 100.0f * totalFrames_);
+        if (target >= totalFrames_) {
+            target = totalFrames_ - 1;
+        }
+
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+            seen += buckets_[bucket];
+            if (seen > target) {
+                // The last bucket holds everything past the cap, so its
+                // upper edge is unknown - max is the honest answer there
+                return (bucket == BUCKET_COUNT - 1) ? maxMs_
+                                                    : (bucket + 1) * BUCKET_WIDTH_MS;
+            }
+        }
+        return maxMs_;
+    }
+
+    float getMaxMs() const { return maxMs_; }
+    uint64_t getFrameCount() const { return totalFrames_; }
+    uint64_t getSpikeCount() const { return spikeCount_; }
+
+    // Restart the distribution (scene change, new measurement window).
+    // Warmup restarts too - the new scene's baseline is unknown.
+    void reset() {
+        buckets_.fill(0);
+        totalFrames_ = 0;
+        spikeCount_ = 0;
+        maxMs_ = 0.0f;
+    }
+
+private:
+    static size_t bucketFor(float frameTimeMs) {
+        if (frameTimeMs <= 0.0f) {
+            return 0;
+        }
+        size_t bucket = static_cast<size_t>(frameTimeMs / BUCKET_WIDTH_MS);
+        return (bucket < BUCKET_COUNT) ? bucket : BUCKET_COUNT - 1;
+    }
+
+    std::array<uint64_t, BUCKET_COUNT> buckets_{};
+    uint64_t totalFrames_ = 0;
+    uint64_t spikeCount_ = 0;
+    float maxMs_ = 0.0f;
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,154 @@
+#include "JobSystem.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace VulkanMon {
+
+JobSystem& JobSystem::getInstance() {
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::JobSystem() {
+    // Leave one core for the main thread; it participates in parallelFor
+    // anyway, so every core stays busy without oversubscribing
+    unsigned hardwareThreads = std::thread::hardware_concurrency();
+    size_t workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+
+    workers_.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers_.emplace_back(&JobSystem::workerLoop, this);
+    }
+
+    Logger::getInstance().log(LogLevel::INFO_LEVEL,
+        "JobSystem started with " + std::to_string(workerCount) + " shared workers");
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopRequested_ = true;
+    }
+    workAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void JobSystem::submit(std::function<void()> job, JobPriority priority) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queues_[static_cast<size_t>(priority)].push_back(std::move(job));
+    }
+    workAvailable_.notify_one();
+}
+
+void JobSystem::parallelFor(size_t count, size_t chunkSize,
+                            const std::function<void(size_t, size_t)>& fn,
+                            JobPriority priority) {
+    if (count == 0) {
+        return;
+    }
+    if (chunkSize == 0) {
+        chunkSize = 1;
+    }
+    if (count <= chunkSize || workers_.empty()) {
+        fn(0, count);
+        return;
+    }
+
+    const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    // Shared cursor: the calling thread and every helper pull chunks from
+    // the same counter until none remain
+    struct BatchState {
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> remainingChunks{0};
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    auto state = std::make_shared<BatchState>();
+    state->remainingChunks.store(chunkCount);
+
+    // fn outlives the batch - parallelFor blocks until the last chunk
+    // finishes - so helpers can safely hold a pointer to it
+    const auto* body = &fn;
+    auto drainChunks = [state, body, count, chunkSize, chunkCount]() {
+        for (;;) {
+            size_t chunk = state->nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunkCount) {
+                return;
+            }
+
+            size_t begin = chunk * chunkSize;
+            size_t end = std::min(begin + chunkSize, count);
+            (*body)(begin, end);
+
+            if (state->remainingChunks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->done.notify_all();
+            }
+        }
+    };
+
+    // No point queueing more helpers than there are chunks for them
+    size_t helperCount = std::min(chunkCount - 1, workers_.size());
+    for (size_t i = 0; i < helperCount; ++i) {
+        submit(drainChunks, priority);
+    }
+
+    drainChunks();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&state]() {
+        return state->remainingChunks.load(std::memory_order_acquire) == 0;
+    });
+}
+
+void JobSystem::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    allIdle_.wait(lock, [this]() {
+        return runningJobs_ == 0 &&
+               queues_[0].empty() && queues_[1].empty() && queues_[2].empty();
+    });
+}
+
+void JobSystem::workerLoop() {
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            workAvailable_.wait(lock, [this]() {
+                return stopRequested_ ||
+                       !queues_[0].empty() || !queues_[1].empty() || !queues_[2].empty();
+            });
+            if (stopRequested_) {
+                return;
+            }
+
+            // Highest priority class with pending work wins
+            for (auto& queue : queues_) {
+                if (!queue.empty()) {
+                    job = std::move(queue.front());
+                    queue.pop_front();
+                    break;
+                }
+            }
+            ++runningJobs_;
+        }
+
+        job();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --runningJobs_;
+        }
+        allIdle_.notify_all();
+    }
+}
+
+} // namespace VulkanMon
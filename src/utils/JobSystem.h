@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace VulkanMon {
+
+// Priority classes for submitted work. Workers always drain higher
+// priorities first, so a backlog of asset decodes can never delay a
+// physics step queued behind it.
+enum class JobPriority : uint8_t {
+    High = 0,    // Frame-critical: physics jobs, query batches, culling
+    Normal = 1,  // Per-frame parallel work: ECS parallelForEach chunks
+    Low = 2      // Background IO: asset decode, cooking, streaming
+};
+
+// Engine-wide shared worker pool
+//
+// Jolt, ECS parallel-for, spatial query batches, and asset decoding each
+// spinning up their own threads oversubscribes the machine: N subsystems
+// x (cores - 1) threads fight the OS scheduler and the contention shows
+// up as frame time noise. JobSystem owns the one pool (cores - 1
+// workers) and every subsystem schedules onto it - Jolt through a
+// JPH::JobSystem adapter in PhysicsSystem, everything else through
+// submit() and parallelFor() directly.
+//
+// parallelFor uses a shared chunk cursor: the calling thread and the
+// queued helpers all pull chunks from the same atomic counter, so the
+// caller never blocks while work remains and stragglers are balanced
+// automatically. This also makes nested use from a worker safe - the
+// caller drains its own chunks even if every helper is busy.
+//
+// Follows the engine's single-instance pattern (see OwnershipModel.h):
+// one process-wide pool, accessed through getInstance().
+class JobSystem {
+public:
+    static JobSystem& getInstance();
+
+    // Fire-and-forget job; runs on a worker at the given priority
+    void submit(std::function<void()> job, JobPriority priority = JobPriority::Normal);
+
+    // Run fn(begin, end) over [0, count) in chunks of chunkSize and block
+    // until every chunk has finished. Counts of chunkSize or less run
+    // inline - thread handoff costs more than the work.
+    void parallelFor(size_t count, size_t chunkSize,
+                     const std::function<void(size_t, size_t)>& fn,
+                     JobPriority priority = JobPriority::Normal);
+
+    // Worker thread count (excludes the calling thread, which parallelFor
+    // also puts to work)
+    size_t getWorkerCount() const { return workers_.size(); }
+
+    // Block until all queued and running jobs have finished. Shutdown and
+    // test synchronization only - not for per-frame waits.
+    void waitIdle();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    ~JobSystem();
+
+private:
+    JobSystem();
+
+    void workerLoop();
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> queues_[3];  // Indexed by JobPriority
+    mutable std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable allIdle_;
+    size_t runningJobs_ = 0;
+    bool stopRequested_ = false;
+};
+
+} // namespace VulkanMon
@@ -14,12 +14,136 @@ Logger& Logger::getInstance() {
 }
 
 Logger::~Logger() {
+    disableAsyncMode();
     flush();
     if (fileStream_) {
         fileStream_->close();
     }
 }
 
+void Logger::enableAsyncMode() {
+    if (asyncMode_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    if (!asyncQueue_) {
+        asyncQueue_ = std::make_unique<AsyncRecord[]>(ASYNC_QUEUE_CAPACITY);
+    }
+    for (size_t i = 0; i < ASYNC_QUEUE_CAPACITY; ++i) {
+        asyncQueue_[i].sequence.store(i, std::memory_order_relaxed);
+        asyncQueue_[i].message.clear();
+    }
+    enqueuePos_.store(0, std::memory_order_relaxed);
+    dequeuePos_.store(0, std::memory_order_relaxed);
+    droppedRecords_.store(0, std::memory_order_relaxed);
+    asyncStopRequested_.store(false, std::memory_order_relaxed);
+
+    asyncWorker_ = std::thread(&Logger::asyncWorkerLoop, this);
+    asyncMode_.store(true, std::memory_order_release);
+}
+
+void Logger::disableAsyncMode() {
+    if (!asyncMode_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    // New records go synchronous from here; the worker drains whatever is
+    // already queued before exiting
+    asyncMode_.store(false, std::memory_order_release);
+    asyncStopRequested_.store(true, std::memory_order_release);
+    if (asyncWorker_.joinable()) {
+        asyncWorker_.join();
+    }
+
+    // A producer that observed async mode just before it flipped may have
+    // published after the worker's final sweep - one more drain catches it
+    drainAsyncQueue();
+}
+
+bool Logger::tryEnqueueAsync(LogLevel level, const std::string& message) {
+    size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    for (;;) {
+        AsyncRecord& slot = asyncQueue_[pos & (ASYNC_QUEUE_CAPACITY - 1)];
+        size_t seq = slot.sequence.load(std::memory_order_acquire);
+        intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (dif == 0) {
+            // Slot is free at our position - claim it with one CAS
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.level = level;
+                slot.timestamp = std::chrono::system_clock::now();
+                slot.message = message;
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+            // Lost the race - pos was reloaded by compare_exchange, retry
+        } else if (dif < 0) {
+            return false; // Ring is full - caller counts the drop
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+size_t Logger::drainAsyncQueue() {
+    size_t consumed = 0;
+    size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+
+    for (;;) {
+        AsyncRecord& slot = asyncQueue_[pos & (ASYNC_QUEUE_CAPACITY - 1)];
+        size_t seq = slot.sequence.load(std::memory_order_acquire);
+        if (seq != pos + 1) {
+            break; // Next record not published yet
+        }
+
+        // Formatting happens here, on the worker, not on the caller
+        std::ostringstream oss;
+        if (timestamps_) {
+            oss << "[" << formatTimestamp(slot.timestamp) << "] ";
+        }
+        oss << "[" << getLevelString(slot.level) << "] " << slot.message;
+
+        {
+            std::lock_guard<std::mutex> lock(logMutex_);
+            writeToOutputs(oss.str());
+        }
+
+        slot.message.clear(); // Release the string's allocation back
+        slot.sequence.store(pos + ASYNC_QUEUE_CAPACITY, std::memory_order_release);
+        pos++;
+        consumed++;
+    }
+
+    dequeuePos_.store(pos, std::memory_order_release);
+    return consumed;
+}
+
+void Logger::asyncWorkerLoop() {
+    uint64_t reportedDrops = 0;
+
+    for (;;) {
+        size_t consumed = drainAsyncQueue();
+
+        // Surface overflow as a log line of its own so dropped records
+        // never disappear silently
+        uint64_t drops = droppedRecords_.load(std::memory_order_relaxed);
+        if (drops > reportedDrops) {
+            std::lock_guard<std::mutex> lock(logMutex_);
+            writeToOutputs("[" + formatTimestamp(std::chrono::system_clock::now()) +
+                           "] [WARN ] Async log queue overflow: " +
+                           std::to_string(drops - reportedDrops) + " records dropped");
+            reportedDrops = drops;
+        }
+
+        if (consumed == 0) {
+            if (asyncStopRequested_.load(std::memory_order_acquire)) {
+                break; // Queue fully drained and shutdown requested
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
 void Logger::enableFileOutput(const std::string& filename) {
     std::lock_guard<std::mutex> lock(logMutex_);
     
@@ -58,7 +182,16 @@ void Logger::log(LogLevel level, const std::string& message) {
     if (level < logLevel_) {
         return;
     }
-    
+
+    // Async fast path: hand the record to the background thread. A full
+    // ring counts the drop instead of blocking the caller.
+    if (asyncMode_.load(std::memory_order_acquire)) {
+        if (!tryEnqueueAsync(level, message)) {
+            droppedRecords_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(logMutex_);
     
     // Format the message
@@ -121,8 +254,19 @@ void Logger::performanceLog(const std::string& operation, double milliseconds) {
 }
 
 void Logger::flush() {
+    // In async mode wait (bounded) for the worker to catch up, so callers
+    // like fatal() get their record on disk before continuing
+    if (asyncMode_.load(std::memory_order_acquire)) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+        while (dequeuePos_.load(std::memory_order_acquire) <
+               enqueuePos_.load(std::memory_order_acquire) &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
     std::lock_guard<std::mutex> lock(logMutex_);
-    
+
     if (consoleOutput_) {
         std::cout.flush();
         std::cerr.flush();
@@ -145,11 +289,14 @@ std::string Logger::getLevelString(LogLevel level) const {
 }
 
 std::string Logger::getCurrentTimestamp() const {
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
+    return formatTimestamp(std::chrono::system_clock::now());
+}
+
+std::string Logger::formatTimestamp(std::chrono::system_clock::time_point when) const {
+    auto time_t = std::chrono::system_clock::to_time_t(when);
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()) % 1000;
-    
+        when.time_since_epoch()) % 1000;
+
     std::ostringstream oss;
     oss << std::put_time(std::localtime(&time_t), "%H:%M:%S");
     oss << "." << std::setfill('0') << std::setw(3) << ms.count();
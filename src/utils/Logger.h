@@ -3,9 +3,12 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 /**
  * VulkanMon Logging System
@@ -48,11 +51,27 @@ public:
     
     // Configuration methods
     void setLogLevel(LogLevel level) { logLevel_ = level; }
+    LogLevel getLogLevel() const { return logLevel_; }
+
+    // Cheap runtime gate used by the logging macros: call sites check
+    // this before building their message, so a level disabled with
+    // setLogLevel() costs one comparison instead of a string format
+    bool isLevelEnabled(LogLevel level) const { return level >= logLevel_; }
     void enableFileOutput(const std::string& filename);
     void disableFileOutput();
     void enableConsoleOutput(bool enable) { consoleOutput_ = enable; }
     void enableTimestamps(bool enable) { timestamps_ = enable; }
-    
+
+    // Async mode: producers push records into a lock-free MPSC ring
+    // buffer and a background thread does the formatting and console/file
+    // I/O. When the ring is full the record is counted as dropped rather
+    // than blocking the caller - logging in a hot loop costs one CAS and
+    // a string move, never a mutex or a syscall.
+    void enableAsyncMode();
+    void disableAsyncMode();
+    bool isAsyncMode() const { return asyncMode_.load(std::memory_order_acquire); }
+    uint64_t getDroppedRecordCount() const { return droppedRecords_.load(std::memory_order_relaxed); }
+
     // Core logging methods
     void log(LogLevel level, const std::string& message);
     void debug(const std::string& message);
@@ -85,8 +104,14 @@ private:
     // Helper methods
     std::string getLevelString(LogLevel level) const;
     std::string getCurrentTimestamp() const;
+    std::string formatTimestamp(std::chrono::system_clock::time_point when) const;
     void writeToOutputs(const std::string& formattedMessage);
-    
+
+    // Async sink internals
+    bool tryEnqueueAsync(LogLevel level, const std::string& message);
+    size_t drainAsyncQueue();
+    void asyncWorkerLoop();
+
     // Configuration
     LogLevel logLevel_ = LogLevel::INFO_LEVEL;
     bool consoleOutput_ = true;
@@ -98,32 +123,125 @@ private:
     
     // Thread safety
     std::mutex logMutex_;
+
+    // Async sink: bounded MPSC ring (Vyukov-style sequence slots).
+    // Producers claim a slot with one CAS on enqueuePos_ and publish by
+    // bumping the slot's sequence; the single consumer thread owns
+    // dequeuePos_. Timestamps are captured at enqueue so records carry
+    // the time the event happened, not the time it got written.
+    struct AsyncRecord {
+        std::atomic<size_t> sequence{0};
+        LogLevel level = LogLevel::INFO_LEVEL;
+        std::chrono::system_clock::time_point timestamp;
+        std::string message;
+    };
+    static constexpr size_t ASYNC_QUEUE_CAPACITY = 4096; // Power of two - index math is a mask
+
+    std::unique_ptr<AsyncRecord[]> asyncQueue_;
+    std::atomic<size_t> enqueuePos_{0};
+    std::atomic<size_t> dequeuePos_{0};  // Written by the worker only; atomic so flush() can observe it
+    std::atomic<bool> asyncMode_{false};
+    std::atomic<bool> asyncStopRequested_{false};
+    std::atomic<uint64_t> droppedRecords_{0};
+    std::thread asyncWorker_;
 };
 
 } // namespace VulkanMon
 
-// Convenient macros for logging (only active in debug builds for performance)
-#ifdef DEBUG
-    #define VKMON_DEBUG(msg)    VulkanMon::Logger::getInstance().debug(msg)
-    #define VKMON_INFO(msg)     VulkanMon::Logger::getInstance().info(msg)
-    #define VKMON_WARNING(msg)  VulkanMon::Logger::getInstance().warning(msg)
-    #define VKMON_ERROR(msg)    VulkanMon::Logger::getInstance().error(msg)
-    #define VKMON_FATAL(msg)    VulkanMon::Logger::getInstance().fatal(msg)
-    
-    #define VKMON_VK_INFO(op, details)    VulkanMon::Logger::getInstance().vulkanInfo(op, details)
-    #define VKMON_VK_ERROR(op, error)     VulkanMon::Logger::getInstance().vulkanError(op, error)
-    #define VKMON_RESOURCE(type, action, name) VulkanMon::Logger::getInstance().resourceInfo(type, action, name)
-    #define VKMON_PERF(op, ms)            VulkanMon::Logger::getInstance().performanceLog(op, ms)
+// Compile-time log level stripping
+//
+// VKMON_LOG_LEVEL is the minimum level compiled into the binary: macro
+// calls below it expand to ((void)0), so their message expressions
+// (string formatting, concatenation) are never evaluated or even
+// emitted. Override it on the compiler command line, e.g.
+// -DVKMON_LOG_LEVEL=VKMON_LOG_LEVEL_WARNING, or use
+// VKMON_LOG_LEVEL_OFF to remove every site. The default preserves the
+// old behavior: everything in debug builds, INFO and above in release.
+//
+// Call sites that survive the compile-time cut are additionally gated
+// on the runtime level BEFORE their arguments are evaluated, so a
+// level disabled with setLogLevel() costs one comparison per call
+// instead of building a string that log() then throws away.
+#define VKMON_LOG_LEVEL_DEBUG   0
+#define VKMON_LOG_LEVEL_INFO    1
+#define VKMON_LOG_LEVEL_WARNING 2
+#define VKMON_LOG_LEVEL_ERROR   3
+#define VKMON_LOG_LEVEL_FATAL   4
+#define VKMON_LOG_LEVEL_OFF     5
+
+#ifndef VKMON_LOG_LEVEL
+    #ifdef DEBUG
+        #define VKMON_LOG_LEVEL VKMON_LOG_LEVEL_DEBUG
+    #else
+        #define VKMON_LOG_LEVEL VKMON_LOG_LEVEL_INFO
+    #endif
+#endif
+
+// Expression-shaped lazy dispatch (some call sites wrap these macros in
+// expressions, e.g. REQUIRE_NOTHROW): msg only evaluates when the
+// runtime level check passes
+#define VKMON_LOG_LAZY(levelEnum, method, msg)                                \
+    (VulkanMon::Logger::getInstance().isLevelEnabled(levelEnum)               \
+         ? VulkanMon::Logger::getInstance().method(msg)                       \
+         : (void)0)
+
+#if VKMON_LOG_LEVEL <= VKMON_LOG_LEVEL_DEBUG
+    #define VKMON_DEBUG(msg)   VKMON_LOG_LAZY(VulkanMon::LogLevel::DEBUG_LEVEL, debug, msg)
 #else
-    // In release builds, logging is minimal for performance
-    #define VKMON_DEBUG(msg)    ((void)0)
-    #define VKMON_INFO(msg)     VulkanMon::Logger::getInstance().info(msg)
-    #define VKMON_WARNING(msg)  VulkanMon::Logger::getInstance().warning(msg)  
-    #define VKMON_ERROR(msg)    VulkanMon::Logger::getInstance().error(msg)
-    #define VKMON_FATAL(msg)    VulkanMon::Logger::getInstance().fatal(msg)
-    
-    #define VKMON_VK_INFO(op, details)    ((void)0)
-    #define VKMON_VK_ERROR(op, error)     VulkanMon::Logger::getInstance().vulkanError(op, error)
+    #define VKMON_DEBUG(msg)   ((void)0)
+#endif
+
+#if VKMON_LOG_LEVEL <= VKMON_LOG_LEVEL_INFO
+    #define VKMON_INFO(msg)    VKMON_LOG_LAZY(VulkanMon::LogLevel::INFO_LEVEL, info, msg)
+#else
+    #define VKMON_INFO(msg)    ((void)0)
+#endif
+
+#if VKMON_LOG_LEVEL <= VKMON_LOG_LEVEL_WARNING
+    #define VKMON_WARNING(msg) VKMON_LOG_LAZY(VulkanMon::LogLevel::WARNING_LEVEL, warning, msg)
+#else
+    #define VKMON_WARNING(msg) ((void)0)
+#endif
+
+#if VKMON_LOG_LEVEL <= VKMON_LOG_LEVEL_ERROR
+    #define VKMON_ERROR(msg)   VKMON_LOG_LAZY(VulkanMon::LogLevel::ERROR_LEVEL, error, msg)
+#else
+    #define VKMON_ERROR(msg)   ((void)0)
+#endif
+
+#if VKMON_LOG_LEVEL <= VKMON_LOG_LEVEL_FATAL
+    #define VKMON_FATAL(msg)   VKMON_LOG_LAZY(VulkanMon::LogLevel::FATAL_LEVEL, fatal, msg)
+#else
+    #define VKMON_FATAL(msg)   ((void)0)
+#endif
+
+// Helper macros keep their historical debug-build-only scope: the
+// Vulkan/resource/perf chatter is development tooling, so it is tied
+// to the DEBUG compile level rather than its runtime severity
+#if VKMON_LOG_LEVEL <= VKMON_LOG_LEVEL_DEBUG
+    #define VKMON_VK_INFO(op, details)                                            \
+        (VulkanMon::Logger::getInstance().isLevelEnabled(VulkanMon::LogLevel::INFO_LEVEL) \
+             ? VulkanMon::Logger::getInstance().vulkanInfo(op, details)           \
+             : (void)0)
+    #define VKMON_RESOURCE(type, action, name)                                    \
+        (VulkanMon::Logger::getInstance().isLevelEnabled(VulkanMon::LogLevel::DEBUG_LEVEL) \
+             ? VulkanMon::Logger::getInstance().resourceInfo(type, action, name)  \
+             : (void)0)
+    #define VKMON_PERF(op, ms)                                                    \
+        (VulkanMon::Logger::getInstance().isLevelEnabled(VulkanMon::LogLevel::DEBUG_LEVEL) \
+             ? VulkanMon::Logger::getInstance().performanceLog(op, ms)            \
+             : (void)0)
+#else
+    #define VKMON_VK_INFO(op, details)         ((void)0)
     #define VKMON_RESOURCE(type, action, name) ((void)0)
-    #define VKMON_PERF(op, ms)            ((void)0)
+    #define VKMON_PERF(op, ms)                 ((void)0)
+#endif
+
+#if VKMON_LOG_LEVEL <= VKMON_LOG_LEVEL_ERROR
+    #define VKMON_VK_ERROR(op, error)                                             \
+        (VulkanMon::Logger::getInstance().isLevelEnabled(VulkanMon::LogLevel::ERROR_LEVEL) \
+             ? VulkanMon::Logger::getInstance().vulkanError(op, error)            \
+             : (void)0)
+#else
+    #define VKMON_VK_ERROR(op, error) ((void)0)
 #endif
\ No newline at end of file
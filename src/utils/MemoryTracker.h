@@ -0,0 +1,169 @@
+#pragma once
+
+#include "Logger.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace VulkanMon {
+
+// =============================================================================
+// MEMORY TRACKER - Tagged per-subsystem memory accounting with budget alarms
+// =============================================================================
+//
+// Answers "where did the memory go" without attaching an external heap
+// profiler: subsystems report their bytes under a tag, the Inspector shows
+// live totals, and an optional per-tag budget logs a warning the moment a
+// subsystem crosses it. Two reporting styles cover the codebase:
+//
+//   recordAllocation / recordFree - paired hooks at RAII choke points.
+//     Every byte of Vulkan device memory flows through ManagedBuffer and
+//     ManagedImage, so those two classes account for the whole GPU side.
+//
+//   setUsage - absolute gauge for self-sizing subsystems that already know
+//     their own footprint (spatial cache and octree) and refresh it on
+//     their existing stats cadence instead of instrumenting every node.
+//
+// Tags are disjoint by convention: each byte is reported under exactly one
+// tag, so getTotalUsage() is a real sum and never double counts. Texture
+// and model cache contents live in ManagedImage/ManagedBuffer memory and
+// therefore show under the Vulkan tags; AssetManager's own texture budget
+// remains the eviction authority for that cache.
+//
+// Counters are relaxed atomics - allocations happen on loader threads as
+// well as the main thread, and these totals are diagnostics, not
+// synchronization points. Budget warnings fire once per crossing and
+// re-arm only after usage falls back under 90% of the budget, so a
+// subsystem hovering at the line does not spam the log.
+enum class MemoryTag : uint8_t {
+    VulkanBuffers = 0,   // ManagedBuffer device memory (vertex/index/uniform/staging)
+    VulkanImages,        // ManagedImage device memory (textures, depth, render targets)
+    SpatialSystem,       // Octree/grid nodes plus the spatial query cache
+    Physics,             // Jolt body and shape storage
+    Other,
+    COUNT
+};
+
+class MemoryTracker {
+public:
+    static MemoryTracker& getInstance() {
+        static MemoryTracker instance;
+        return instance;
+    }
+
+    static const char* tagName(MemoryTag tag) {
+        switch (tag) {
+            case MemoryTag::VulkanBuffers: return "Vulkan Buffers";
+            case MemoryTag::VulkanImages:  return "Vulkan Images";
+            case MemoryTag::SpatialSystem: return "Spatial System";
+            case MemoryTag::Physics:       return "Physics";
+            case MemoryTag::Other:         return "Other";
+            default:                       return "Unknown";
+        }
+    }
+
+    void recordAllocation(MemoryTag tag, size_t bytes) {
+        size_t usage = slot(tag).usage.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        checkBudget(tag, usage);
+    }
+
+    void recordFree(MemoryTag tag, size_t bytes) {
+        size_t usage = slot(tag).usage.fetch_sub(bytes, std::memory_order_relaxed) - bytes;
+        maybeRearmAlarm(tag, usage);
+    }
+
+    // Absolute gauge for subsystems that size themselves
+    void setUsage(MemoryTag tag, size_t bytes) {
+        slot(tag).usage.store(bytes, std::memory_order_relaxed);
+        checkBudget(tag, bytes);
+        maybeRearmAlarm(tag, bytes);
+    }
+
+    size_t getUsage(MemoryTag tag) const {
+        return slot(tag).usage.load(std::memory_order_relaxed);
+    }
+
+    size_t getTotalUsage() const {
+        size_t total = 0;
+        for (const TagSlot& tagSlot : slots_) {
+            total += tagSlot.usage.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    // Zero disables the alarm for that tag
+    void setBudget(MemoryTag tag, size_t bytes) {
+        slot(tag).budget.store(bytes, std::memory_order_relaxed);
+        slot(tag).alarmed.store(false, std::memory_order_relaxed);
+        checkBudget(tag, getUsage(tag));
+    }
+
+    size_t getBudget(MemoryTag tag) const {
+        return slot(tag).budget.load(std::memory_order_relaxed);
+    }
+
+    bool isOverBudget(MemoryTag tag) const {
+        size_t budget = getBudget(tag);
+        return budget > 0 && getUsage(tag) > budget;
+    }
+
+    // Test support - clears every tag's usage, budget, and alarm state
+    void resetAll() {
+        for (TagSlot& tagSlot : slots_) {
+            tagSlot.usage.store(0, std::memory_order_relaxed);
+            tagSlot.budget.store(0, std::memory_order_relaxed);
+            tagSlot.alarmed.store(false, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    MemoryTracker() = default;
+    MemoryTracker(const MemoryTracker&) = delete;
+    MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+    struct TagSlot {
+        std::atomic<size_t> usage{0};
+        std::atomic<size_t> budget{0};
+        std::atomic<bool> alarmed{false};
+    };
+
+    TagSlot& slot(MemoryTag tag) {
+        return slots_[static_cast<size_t>(tag)];
+    }
+
+    const TagSlot& slot(MemoryTag tag) const {
+        return slots_[static_cast<size_t>(tag)];
+    }
+
+    void checkBudget(MemoryTag tag, size_t usage) {
+        TagSlot& tagSlot = slot(tag);
+        size_t budget = tagSlot.budget.load(std::memory_order_relaxed);
+        if (budget == 0 || usage <= budget) {
+            return;
+        }
+
+        bool expected = false;
+        if (tagSlot.alarmed.compare_exchange_strong(expected, true,
+                                                    std::memory_order_relaxed)) {
+            VKMON_WARNING(std::string(tagName(tag)) + " memory over budget: " +
+                          std::to_string(usage) + " / " + std::to_string(budget) + " bytes");
+        }
+    }
+
+    void maybeRearmAlarm(MemoryTag tag, size_t usage) {
+        TagSlot& tagSlot = slot(tag);
+        size_t budget = tagSlot.budget.load(std::memory_order_relaxed);
+        if (budget == 0) {
+            return;
+        }
+        if (usage < budget - budget / 10) {
+            tagSlot.alarmed.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    std::array<TagSlot, static_cast<size_t>(MemoryTag::COUNT)> slots_;
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,67 @@
+#include "SimdDispatch.h"
+
+#include "CpuFeatures.h"
+#include "Logger.h"
+#include "SimdTransforms.h"
+
+namespace VulkanMon {
+
+// ISA translation units export their kernels through these
+// declarations; each unit also reports whether it was actually built
+// with its target flags so a misconfigured build falls back cleanly
+namespace SimdKernelsAvx2 {
+    extern const bool compiledWithAvx2;
+    void composeMatrices(const float* px, const float* py, const float* pz,
+                         const float* qx, const float* qy, const float* qz, const float* qw,
+                         const float* sx, const float* sy, const float* sz,
+                         glm::mat4* out, size_t count);
+}
+
+namespace SimdDispatch {
+
+namespace {
+
+// Non-capturing lambda-style wrapper so the baseline (an inline header
+// function) has an address the table can hold
+void composeMatricesBaselineEntry(const float* px, const float* py, const float* pz,
+                                  const float* qx, const float* qy, const float* qz,
+                                  const float* qw,
+                                  const float* sx, const float* sy, const float* sz,
+                                  glm::mat4* out, size_t count) {
+    SimdTransforms::composeMatricesBaseline(px, py, pz, qx, qy, qz, qw,
+                                            sx, sy, sz, out, count);
+}
+
+KernelTable buildTable() {
+    const CpuFeatures& cpu = CpuFeatures::get();
+
+    KernelTable table;
+    table.composeMatrices = &composeMatricesBaselineEntry;
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    table.isaName = "sse2";
+#else
+    table.isaName = "scalar";
+#endif
+
+    // The AVX2 kernels use FMA, so both feature bits gate the upgrade
+    // (every AVX2 part ships FMA, but CPUID is the authority here)
+    if (cpu.avx2 && cpu.fma && SimdKernelsAvx2::compiledWithAvx2) {
+        table.composeMatrices = &SimdKernelsAvx2::composeMatrices;
+        table.isaName = "avx2";
+    }
+
+    VKMON_INFO("SIMD dispatch: " + std::string(table.isaName) + " kernels selected" +
+               (cpu.avx512f ? " (avx512f present, no wider variants shipped yet)" : ""));
+    return table;
+}
+
+} // namespace
+
+const KernelTable& kernels() {
+    static const KernelTable table = buildTable();
+    return table;
+}
+
+} // namespace SimdDispatch
+
+} // namespace VulkanMon
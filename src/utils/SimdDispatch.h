@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+
+#include <glm/glm.hpp>
+
+namespace VulkanMon {
+
+// =============================================================================
+// SIMD DISPATCH - Runtime ISA selection for vectorized kernels
+// =============================================================================
+//
+// One binary ships across machines from SSE2 up through AVX-512, so
+// kernels beyond the SSE2 baseline live in translation units compiled
+// with wider instruction sets (e.g. SimdTransformsAvx2.cpp built with
+// -mavx2 / /arch:AVX2) and are never inlined into portable code. This
+// table picks the widest implementation the running CPU and OS support
+// - checked once via CpuFeatures on first use - and the hot paths call
+// through the resulting function pointers.
+//
+// The indirect call costs a few cycles per batch, which the kernels
+// amortize over their whole input; the alternative is either a
+// lowest-common-denominator binary or illegal-instruction crashes on
+// the older half of the fleet.
+namespace SimdDispatch {
+
+    // Batched TRS compose, signature shared by every ISA variant (see
+    // SimdTransforms::composeMatricesBaseline for the contract)
+    using ComposeMatricesFn = void (*)(const float* px, const float* py, const float* pz,
+                                       const float* qx, const float* qy, const float* qz,
+                                       const float* qw,
+                                       const float* sx, const float* sy, const float* sz,
+                                       glm::mat4* out, size_t count);
+
+    struct KernelTable {
+        ComposeMatricesFn composeMatrices = nullptr;
+        const char* isaName = "";   // "scalar", "sse2", "avx2" - for logs and tests
+    };
+
+    // Selected on first call (thread-safe static) and fixed for the
+    // process; every pointer in the returned table is non-null
+    const KernelTable& kernels();
+
+} // namespace SimdDispatch
+
+} // namespace VulkanMon
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "SimdDispatch.h"
+
+#include <cstddef>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#ifndef VKMON_SIMD_SSE2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define VKMON_SIMD_SSE2 1
+    #include <emmintrin.h>
+#endif
+#endif
+
+namespace VulkanMon {
+
+// Batched TRS-to-matrix composition
+//
+// Converts packed translate/rotate/scale arrays (SoA) into column-major
+// mat4s. The SSE2 path computes the twelve rotation-scale elements for
+// four entities per pass and transposes them into per-entity columns;
+// other targets run a scalar loop with identical results. Render
+// extraction gathers the frame's dirty transforms through this kernel
+// instead of rebuilding each model matrix one at a time - the compose
+// is pure dense math, exactly the shape that vectorizes.
+namespace SimdTransforms {
+
+    // Scalar compose for one entity (shared tail/fallback). Writes the
+    // standard T * R * S matrix directly - no intermediate matrices
+    inline void composeScalar(const glm::vec3& position,
+                              const glm::quat& rotation,
+                              const glm::vec3& scale,
+                              glm::mat4& out) {
+        float xx = rotation.x * rotation.x;
+        float yy = rotation.y * rotation.y;
+        float zz = rotation.z * rotation.z;
+        float xy = rotation.x * rotation.y;
+        float xz = rotation.x * rotation.z;
+        float yz = rotation.y * rotation.z;
+        float wx = rotation.w * rotation.x;
+        float wy = rotation.w * rotation.y;
+        float wz = rotation.w * rotation.z;
+
+        out[0] = glm::vec4((1.0f - 2.0f * (yy + zz)) * scale.x,
+                           (2.0f * (xy + wz)) * scale.x,
+                           (2.0f * (xz - wy)) * scale.x,
+                           0.0f);
+        out[1] = glm::vec4((2.0f * (xy - wz)) * scale.y,
+                           (1.0f - 2.0f * (xx + zz)) * scale.y,
+                           (2.0f * (yz + wx)) * scale.y,
+                           0.0f);
+        out[2] = glm::vec4((2.0f * (xz + wy)) * scale.z,
+                           (2.0f * (yz - wx)) * scale.z,
+                           (1.0f - 2.0f * (xx + yy)) * scale.z,
+                           0.0f);
+        out[3] = glm::vec4(position, 1.0f);
+    }
+
+    // Baseline compose for `count` matrices from SoA TRS arrays (SSE2
+    // where available, scalar elsewhere). Quaternions are (x, y, z, w)
+    // component arrays and must be normalized, matching
+    // Transform::setRotation. `out` receives one mat4 per entity.
+    //
+    // Hot paths call composeMatrices below, which routes through the
+    // runtime dispatch table and picks up the wider per-ISA variants;
+    // this baseline is what the table falls back to and what the ISA
+    // translation units are verified against.
+    inline void composeMatricesBaseline(const float* px, const float* py, const float* pz,
+                                        const float* qx, const float* qy, const float* qz, const float* qw,
+                                        const float* sx, const float* sy, const float* sz,
+                                        glm::mat4* out, size_t count) {
+        size_t i = 0;
+
+#if VKMON_SIMD_SSE2
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+        const __m128 zero = _mm_setzero_ps();
+
+        for (; i + 4 <= count; i += 4) {
+            __m128 x = _mm_loadu_ps(qx + i);
+            __m128 y = _mm_loadu_ps(qy + i);
+            __m128 z = _mm_loadu_ps(qz + i);
+            __m128 w = _mm_loadu_ps(qw + i);
+
+            __m128 xx = _mm_mul_ps(x, x);
+            __m128 yy = _mm_mul_ps(y, y);
+            __m128 zz = _mm_mul_ps(z, z);
+            __m128 xy = _mm_mul_ps(x, y);
+            __m128 xz = _mm_mul_ps(x, z);
+            __m128 yz = _mm_mul_ps(y, z);
+            __m128 wx = _mm_mul_ps(w, x);
+            __m128 wy = _mm_mul_ps(w, y);
+            __m128 wz = _mm_mul_ps(w, z);
+
+            __m128 vsx = _mm_loadu_ps(sx + i);
+            __m128 vsy = _mm_loadu_ps(sy + i);
+            __m128 vsz = _mm_loadu_ps(sz + i);
+
+            // Twelve element lanes: m<row><col> holds that element for
+            // all four entities
+            __m128 m00 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), vsx);
+            __m128 m10 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), vsx);
+            __m128 m20 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), vsx);
+
+            __m128 m01 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), vsy);
+            __m128 m11 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), vsy);
+            __m128 m21 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), vsy);
+
+            __m128 m02 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), vsz);
+            __m128 m12 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), vsz);
+            __m128 m22 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), vsz);
+
+            // Transpose each lane quartet into per-entity columns and
+            // store straight into the column-major output matrices
+            __m128 c0a = m00, c0b = m10, c0c = m20, c0d = zero;
+            _MM_TRANSPOSE4_PS(c0a, c0b, c0c, c0d);
+
+            __m128 c1a = m01, c1b = m11, c1c = m21, c1d = zero;
+            _MM_TRANSPOSE4_PS(c1a, c1b, c1c, c1d);
+
+            __m128 c2a = m02, c2b = m12, c2c = m22, c2d = zero;
+            _MM_TRANSPOSE4_PS(c2a, c2b, c2c, c2d);
+
+            __m128 c3a = _mm_loadu_ps(px + i);
+            __m128 c3b = _mm_loadu_ps(py + i);
+            __m128 c3c = _mm_loadu_ps(pz + i);
+            __m128 c3d = one;
+            _MM_TRANSPOSE4_PS(c3a, c3b, c3c, c3d);
+
+            float* dst0 = &out[i + 0][0][0];
+            _mm_storeu_ps(dst0 + 0, c0a);
+            _mm_storeu_ps(dst0 + 4, c1a);
+            _mm_storeu_ps(dst0 + 8, c2a);
+            _mm_storeu_ps(dst0 + 12, c3a);
+
+            float* dst1 = &out[i + 1][0][0];
+            _mm_storeu_ps(dst1 + 0, c0b);
+            _mm_storeu_ps(dst1 + 4, c1b);
+            _mm_storeu_ps(dst1 + 8, c2b);
+            _mm_storeu_ps(dst1 + 12, c3b);
+
+            float* dst2 = &out[i + 2][0][0];
+            _mm_storeu_ps(dst2 + 0, c0c);
+            _mm_storeu_ps(dst2 + 4, c1c);
+            _mm_storeu_ps(dst2 + 8, c2c);
+            _mm_storeu_ps(dst2 + 12, c3c);
+
+            float* dst3 = &out[i + 3][0][0];
+            _mm_storeu_ps(dst3 + 0, c0d);
+            _mm_storeu_ps(dst3 + 4, c1d);
+            _mm_storeu_ps(dst3 + 8, c2d);
+            _mm_storeu_ps(dst3 + 12, c3d);
+        }
+#endif
+
+        for (; i < count; ++i) {
+            composeScalar(glm::vec3(px[i], py[i], pz[i]),
+                          glm::quat(qw[i], qx[i], qy[i], qz[i]),
+                          glm::vec3(sx[i], sy[i], sz[i]),
+                          out[i]);
+        }
+    }
+
+    // Dispatching entry point: calls the widest compose kernel the
+    // running CPU supports (selected once via CPUID, see SimdDispatch)
+    inline void composeMatrices(const float* px, const float* py, const float* pz,
+                                const float* qx, const float* qy, const float* qz, const float* qw,
+                                const float* sx, const float* sy, const float* sz,
+                                glm::mat4* out, size_t count) {
+        SimdDispatch::kernels().composeMatrices(px, py, pz, qx, qy, qz, qw,
+                                                sx, sy, sz, out, count);
+    }
+
+} // namespace SimdTransforms
+
+} // namespace VulkanMon
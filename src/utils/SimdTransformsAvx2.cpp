@@ -0,0 +1,164 @@
+// AVX2 variant of the batched TRS compose kernel.
+//
+// This translation unit is the only one built with -mavx2 / /arch:AVX2
+// (see the set_source_files_properties call in CMakeLists.txt), so AVX2
+// instructions never leak into code that runs unconditionally; the
+// dispatch table only routes here after CpuFeatures confirms CPU and OS
+// support at runtime.
+//
+// Eight entities per pass: the twelve rotation-scale element lanes are
+// computed as 256-bit vectors, then each 128-bit half is transposed
+// into per-entity columns with the same pattern the SSE2 baseline uses.
+
+#include "SimdTransforms.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+namespace VulkanMon {
+namespace SimdKernelsAvx2 {
+
+// Dispatch checks this so a build that somehow missed the AVX2 flag
+// falls back to the baseline instead of mislabeling it as "avx2".
+// extern: const at namespace scope would otherwise be internal linkage
+extern const bool compiledWithAvx2 = true;
+
+namespace {
+
+// Transpose the given 128-bit lane quartets (one element for four
+// entities each) into four column vectors and store them into the
+// column-major output matrices starting at `out`
+inline void storeFourEntities(__m128 c0a, __m128 c0b, __m128 c0c,
+                              __m128 c1a, __m128 c1b, __m128 c1c,
+                              __m128 c2a, __m128 c2b, __m128 c2c,
+                              __m128 t0, __m128 t1, __m128 t2,
+                              glm::mat4* out) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    __m128 r0 = c0a, r1 = c0b, r2 = c0c, r3 = zero;
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    __m128 col0[4] = {r0, r1, r2, r3};
+
+    r0 = c1a; r1 = c1b; r2 = c1c; r3 = zero;
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    __m128 col1[4] = {r0, r1, r2, r3};
+
+    r0 = c2a; r1 = c2b; r2 = c2c; r3 = zero;
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    __m128 col2[4] = {r0, r1, r2, r3};
+
+    r0 = t0; r1 = t1; r2 = t2; r3 = one;
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    __m128 col3[4] = {r0, r1, r2, r3};
+
+    for (int entity = 0; entity < 4; ++entity) {
+        float* dst = &out[entity][0][0];
+        _mm_storeu_ps(dst + 0, col0[entity]);
+        _mm_storeu_ps(dst + 4, col1[entity]);
+        _mm_storeu_ps(dst + 8, col2[entity]);
+        _mm_storeu_ps(dst + 12, col3[entity]);
+    }
+}
+
+} // namespace
+
+void composeMatrices(const float* px, const float* py, const float* pz,
+                     const float* qx, const float* qy, const float* qz, const float* qw,
+                     const float* sx, const float* sy, const float* sz,
+                     glm::mat4* out, size_t count) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_loadu_ps(qx + i);
+        __m256 y = _mm256_loadu_ps(qy + i);
+        __m256 z = _mm256_loadu_ps(qz + i);
+        __m256 w = _mm256_loadu_ps(qw + i);
+
+        __m256 xx = _mm256_mul_ps(x, x);
+        __m256 yy = _mm256_mul_ps(y, y);
+        __m256 zz = _mm256_mul_ps(z, z);
+        __m256 xy = _mm256_mul_ps(x, y);
+        __m256 xz = _mm256_mul_ps(x, z);
+        __m256 yz = _mm256_mul_ps(y, z);
+        __m256 wx = _mm256_mul_ps(w, x);
+        __m256 wy = _mm256_mul_ps(w, y);
+        __m256 wz = _mm256_mul_ps(w, z);
+
+        __m256 vsx = _mm256_loadu_ps(sx + i);
+        __m256 vsy = _mm256_loadu_ps(sy + i);
+        __m256 vsz = _mm256_loadu_ps(sz + i);
+
+        // Same twelve element lanes as the SSE2 baseline, eight
+        // entities wide, with FMA folding the 1 - 2*(a+b) terms
+        __m256 m00 = _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(yy, zz), one), vsx);
+        __m256 m10 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), vsx);
+        __m256 m20 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), vsx);
+
+        __m256 m01 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), vsy);
+        __m256 m11 = _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(xx, zz), one), vsy);
+        __m256 m21 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), vsy);
+
+        __m256 m02 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), vsz);
+        __m256 m12 = _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), vsz);
+        __m256 m22 = _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(xx, yy), one), vsz);
+
+        __m256 tx = _mm256_loadu_ps(px + i);
+        __m256 ty = _mm256_loadu_ps(py + i);
+        __m256 tz = _mm256_loadu_ps(pz + i);
+
+        storeFourEntities(_mm256_castps256_ps128(m00), _mm256_castps256_ps128(m10),
+                          _mm256_castps256_ps128(m20),
+                          _mm256_castps256_ps128(m01), _mm256_castps256_ps128(m11),
+                          _mm256_castps256_ps128(m21),
+                          _mm256_castps256_ps128(m02), _mm256_castps256_ps128(m12),
+                          _mm256_castps256_ps128(m22),
+                          _mm256_castps256_ps128(tx), _mm256_castps256_ps128(ty),
+                          _mm256_castps256_ps128(tz),
+                          out + i);
+
+        storeFourEntities(_mm256_extractf128_ps(m00, 1), _mm256_extractf128_ps(m10, 1),
+                          _mm256_extractf128_ps(m20, 1),
+                          _mm256_extractf128_ps(m01, 1), _mm256_extractf128_ps(m11, 1),
+                          _mm256_extractf128_ps(m21, 1),
+                          _mm256_extractf128_ps(m02, 1), _mm256_extractf128_ps(m12, 1),
+                          _mm256_extractf128_ps(m22, 1),
+                          _mm256_extractf128_ps(tx, 1), _mm256_extractf128_ps(ty, 1),
+                          _mm256_extractf128_ps(tz, 1),
+                          out + i + 4);
+    }
+
+    // Baseline handles the sub-8 tail with identical math
+    if (i < count) {
+        SimdTransforms::composeMatricesBaseline(px + i, py + i, pz + i,
+                                                qx + i, qy + i, qz + i, qw + i,
+                                                sx + i, sy + i, sz + i,
+                                                out + i, count - i);
+    }
+}
+
+} // namespace SimdKernelsAvx2
+} // namespace VulkanMon
+
+#else // built without AVX2 support - keep the symbols, fall back
+
+namespace VulkanMon {
+namespace SimdKernelsAvx2 {
+
+extern const bool compiledWithAvx2 = false;
+
+void composeMatrices(const float* px, const float* py, const float* pz,
+                     const float* qx, const float* qy, const float* qz, const float* qw,
+                     const float* sx, const float* sy, const float* sz,
+                     glm::mat4* out, size_t count) {
+    SimdTransforms::composeMatricesBaseline(px, py, pz, qx, qy, qz, qw,
+                                            sx, sy, sz, out, count);
+}
+
+} // namespace SimdKernelsAvx2
+} // namespace VulkanMon
+
+#endif
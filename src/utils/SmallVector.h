@@ -0,0 +1,191 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace VulkanMon {
+
+// Vector with inline storage for the first N elements
+//
+// Hot paths build many short-lived lists that almost always hold a
+// handful of elements - spatial query results, per-batch index lists,
+// per-creature neighbor sets. std::vector heap-allocates for every one
+// of them. SmallVector keeps the first N elements in the object itself
+// and only touches the heap when a list actually outgrows its inline
+// capacity; sized for the common case, a frame full of queries does no
+// allocation at all.
+//
+// Deliberately minimal: the subset of the std::vector interface the
+// engine uses (push/emplace/clear/resize/reserve, iteration, indexing,
+// equality). Contiguous storage, so it satisfies std::span and
+// range-for like std::vector does. Single-threaded like every other
+// per-frame container in the engine.
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(N > 0, "SmallVector needs at least one inline slot");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() = default;
+
+    explicit SmallVector(size_t count) { resize(count); }
+
+    SmallVector(const SmallVector& other) {
+        reserve(other.size_);
+        std::uninitialized_copy(other.begin(), other.end(), data_);
+        size_ = other.size_;
+    }
+
+    SmallVector(SmallVector&& other) noexcept { moveFrom(std::move(other)); }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+            std::uninitialized_copy(other.begin(), other.end(), data_);
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept {
+        if (this != &other) {
+            destroyAll();
+            moveFrom(std::move(other));
+        }
+        return *this;
+    }
+
+    ~SmallVector() { destroyAll(); }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            grow(capacity_ * 2);
+        }
+        T* slot = data_ + size_;
+        new (slot) T(std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    void pop_back() {
+        assert(size_ > 0 && "pop_back on empty SmallVector");
+        data_[--size_].~T();
+    }
+
+    void clear() {
+        std::destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    void reserve(size_t newCapacity) {
+        if (newCapacity > capacity_) {
+            grow(newCapacity);
+        }
+    }
+
+    void resize(size_t newSize) {
+        if (newSize < size_) {
+            std::destroy(data_ + newSize, data_ + size_);
+        } else {
+            reserve(newSize);
+            std::uninitialized_value_construct(data_ + size_, data_ + newSize);
+        }
+        size_ = newSize;
+    }
+
+    size_t size() const { return size_; }
+    size_t capacity() const { return capacity_; }
+    bool empty() const { return size_ == 0; }
+
+    // True while elements still live in the inline buffer (no heap yet)
+    bool isInline() const { return data_ == inlineData(); }
+
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+
+    T& operator[](size_t index) {
+        assert(index < size_ && "SmallVector index out of range");
+        return data_[index];
+    }
+    const T& operator[](size_t index) const {
+        assert(index < size_ && "SmallVector index out of range");
+        return data_[index];
+    }
+
+    T& front() { return (*this)[0]; }
+    const T& front() const { return (*this)[0]; }
+    T& back() { return (*this)[size_ - 1]; }
+    const T& back() const { return (*this)[size_ - 1]; }
+
+    iterator begin() { return data_; }
+    iterator end() { return data_ + size_; }
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + size_; }
+
+    friend bool operator==(const SmallVector& a, const SmallVector& b) {
+        return a.size_ == b.size_ && std::equal(a.begin(), a.end(), b.begin());
+    }
+
+private:
+    T* inlineData() { return reinterpret_cast<T*>(inlineStorage_); }
+    const T* inlineData() const { return reinterpret_cast<const T*>(inlineStorage_); }
+
+    void grow(size_t requested) {
+        size_t newCapacity = std::max(requested, capacity_ * 2);
+        T* newData = std::allocator<T>{}.allocate(newCapacity);
+        std::uninitialized_move(data_, data_ + size_, newData);
+        std::destroy(data_, data_ + size_);
+        releaseHeap();
+        data_ = newData;
+        capacity_ = newCapacity;
+    }
+
+    // Steal the heap buffer when the source spilled; element-wise move
+    // when it is still inline (its buffer dies with it)
+    void moveFrom(SmallVector&& other) noexcept {
+        if (other.isInline()) {
+            data_ = inlineData();
+            capacity_ = N;
+            std::uninitialized_move(other.begin(), other.end(), data_);
+            size_ = other.size_;
+            other.clear();
+        } else {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inlineData();
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+    }
+
+    void destroyAll() {
+        std::destroy(data_, data_ + size_);
+        releaseHeap();
+    }
+
+    void releaseHeap() {
+        if (!isInline()) {
+            std::allocator<T>{}.deallocate(data_, capacity_);
+        }
+    }
+
+    alignas(T) unsigned char inlineStorage_[N * sizeof(T)];
+    T* data_ = inlineData();
+    size_t size_ = 0;
+    size_t capacity_ = N;
+};
+
+} // namespace VulkanMon
@@ -0,0 +1,323 @@
+#pragma once
+
+#include "JobSystem.h"
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * VulkanMon Coroutine Tasks
+ *
+ * C++20 coroutine support layered on the shared JobSystem pool, so
+ * multi-stage load pipelines (decode -> upload -> register) read as
+ * straight-line code instead of callback chains while every stage still
+ * runs where it belongs:
+ *
+ *     Task<size_t> warmup() {
+ *         co_await resumeOnWorker(JobPriority::Low);  // cook off-thread
+ *         cookEverything();
+ *         co_await resumeOnMainThread();              // GPU upload point
+ *         co_return uploadEverything();
+ *     }
+ *
+ * Task<T> is lazy: nothing runs until it is co_awaited (composing into a
+ * parent task) or startDetached() fires it as a root. Awaiters:
+ *
+ *  - resumeOnWorker(priority): continue on a JobSystem worker
+ *  - resumeOnMainThread(): continue at the next main-thread pump
+ *  - resumeWhen(predicate): park until the predicate turns true, checked
+ *    once per pump on the main thread (AsyncTextureLoad's co_await is
+ *    built on this)
+ *
+ * MainThreadTaskQueue::pump() is the main-thread sync point - the
+ * Application calls it once per frame, after the per-frame asset
+ * finalization, so a texture awaited in a coroutine resumes the same
+ * frame its GPU upload completes. Follows the engine's single-instance
+ * pattern (see OwnershipModel.h).
+ */
+
+namespace VulkanMon {
+
+// Parked and queued coroutine resumption on the main thread
+class MainThreadTaskQueue {
+public:
+    static MainThreadTaskQueue& getInstance() {
+        static MainThreadTaskQueue instance;
+        return instance;
+    }
+
+    /// Resume the handle at the next pump
+    void post(std::coroutine_handle<> handle) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready_.push_back(handle);
+    }
+
+    /// Resume the handle at the first pump where predicate() is true
+    void postWhen(std::function<bool()> predicate, std::coroutine_handle<> handle) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        waiting_.push_back({std::move(predicate), handle});
+    }
+
+    /**
+     * Resume everything that is due (main thread, once per frame)
+     *
+     * Handles posted or un-parked during a resumption run on the next
+     * pump, not this one - the swap keeps the queue re-entrant.
+     */
+    void pump() {
+        std::vector<std::coroutine_handle<>> due;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            due.swap(ready_);
+            for (auto it = waiting_.begin(); it != waiting_.end();) {
+                if (it->predicate()) {
+                    due.push_back(it->handle);
+                    it = waiting_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        for (auto handle : due) {
+            handle.resume();
+        }
+    }
+
+    size_t getPendingCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return ready_.size() + waiting_.size();
+    }
+
+    MainThreadTaskQueue(const MainThreadTaskQueue&) = delete;
+    MainThreadTaskQueue& operator=(const MainThreadTaskQueue&) = delete;
+
+private:
+    MainThreadTaskQueue() = default;
+
+    struct ConditionEntry {
+        std::function<bool()> predicate;
+        std::coroutine_handle<> handle;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<std::coroutine_handle<>> ready_;
+    std::vector<ConditionEntry> waiting_;
+};
+
+namespace Detail {
+
+// Shared promise machinery: continuation chaining via symmetric transfer,
+// detached-root cleanup, exception capture
+template<typename Promise>
+struct TaskFinalAwaiter {
+    bool await_ready() const noexcept { return false; }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept {
+        auto& promise = handle.promise();
+        if (promise.continuation) {
+            return promise.continuation;  // resume the awaiting parent
+        }
+        if (promise.detached) {
+            handle.destroy();  // fire-and-forget root owns itself
+        }
+        return std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept {}
+};
+
+struct TaskPromiseBase {
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+    bool detached = false;
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    void unhandled_exception() { exception = std::current_exception(); }
+};
+
+} // namespace Detail
+
+/**
+ * Lazy coroutine task producing T (or void)
+ *
+ * Move-only owner of the coroutine frame. co_await it from another task
+ * to compose; call startDetached() to launch a root task that cleans
+ * itself up on completion. Exceptions thrown inside the coroutine
+ * rethrow at the co_await in the parent (detached roots terminate, like
+ * an unhandled exception on any thread).
+ */
+template<typename T = void>
+class [[nodiscard]] Task {
+public:
+    struct promise_type : Detail::TaskPromiseBase {
+        std::optional<T> value;
+
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        Detail::TaskFinalAwaiter<promise_type> final_suspend() noexcept { return {}; }
+        void return_value(T result) { value = std::move(result); }
+    };
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() { destroy(); }
+
+    // Composition point: starts the child, suspends the parent until the
+    // child's final_suspend transfers control back
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> child;
+
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> parent) noexcept {
+                child.promise().continuation = parent;
+                return child;  // symmetric transfer into the child
+            }
+            T await_resume() {
+                auto& promise = child.promise();
+                if (promise.exception) {
+                    std::rethrow_exception(promise.exception);
+                }
+                return std::move(*promise.value);
+            }
+        };
+        return Awaiter{handle_};
+    }
+
+    /// Launch as a self-owning root task; the frame is destroyed when it
+    /// finishes. The Task object no longer owns anything afterwards.
+    void startDetached() {
+        auto handle = std::exchange(handle_, nullptr);
+        handle.promise().detached = true;
+        handle.resume();
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    void destroy() {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_ = nullptr;
+};
+
+template<>
+class [[nodiscard]] Task<void> {
+public:
+    struct promise_type : Detail::TaskPromiseBase {
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        Detail::TaskFinalAwaiter<promise_type> final_suspend() noexcept { return {}; }
+        void return_void() {}
+    };
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() { destroy(); }
+
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> child;
+
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> parent) noexcept {
+                child.promise().continuation = parent;
+                return child;
+            }
+            void await_resume() {
+                if (child.promise().exception) {
+                    std::rethrow_exception(child.promise().exception);
+                }
+            }
+        };
+        return Awaiter{handle_};
+    }
+
+    void startDetached() {
+        auto handle = std::exchange(handle_, nullptr);
+        handle.promise().detached = true;
+        handle.resume();
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    void destroy() {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_ = nullptr;
+};
+
+/// co_await resumeOnWorker(priority): continue on a JobSystem worker
+inline auto resumeOnWorker(JobPriority priority = JobPriority::Normal) {
+    struct Awaiter {
+        JobPriority priority;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const {
+            JobSystem::getInstance().submit([handle] { handle.resume(); }, priority);
+        }
+        void await_resume() const noexcept {}
+    };
+    return Awaiter{priority};
+}
+
+/// co_await resumeOnMainThread(): continue at the next main-thread pump
+inline auto resumeOnMainThread() {
+    struct Awaiter {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const {
+            MainThreadTaskQueue::getInstance().post(handle);
+        }
+        void await_resume() const noexcept {}
+    };
+    return Awaiter{};
+}
+
+/// co_await resumeWhen(pred): park until pred() is true, resumed on the
+/// main thread. pred is evaluated once per pump - keep it cheap.
+inline auto resumeWhen(std::function<bool()> predicate) {
+    struct Awaiter {
+        std::function<bool()> predicate;
+
+        bool await_ready() const { return predicate(); }
+        void await_suspend(std::coroutine_handle<> handle) {
+            MainThreadTaskQueue::getInstance().postWhen(std::move(predicate), handle);
+        }
+        void await_resume() const noexcept {}
+    };
+    return Awaiter{std::move(predicate)};
+}
+
+} // namespace VulkanMon
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace VulkanMon::Bench {
+
+// =============================================================================
+// BENCH HARNESS - Statistical benchmarks with baseline comparison
+// =============================================================================
+//
+// Replacement for threshold-assert performance tests, which flake: a single
+// noisy sample against a hardcoded ceiling either spuriously fails or the
+// ceiling gets loosened until it catches nothing. This harness instead runs
+// each benchmark through a warmup phase and a sampled phase, reports
+// median/p99 (median for comparison - it shrugs off scheduler spikes -
+// and p99 for the tail), emits machine-readable JSON, and diffs the median
+// against a checked-in baseline for the same machine profile with a
+// configurable tolerance.
+//
+// Baselines are per machine profile (platform-compiler-buildtype) because
+// a debug build on CI and a release build on a dev box have nothing to say
+// about each other. A missing or mismatched baseline is reported, never
+// failed - only a real regression against a comparable baseline fails.
+
+struct BenchResult {
+    std::string name;
+    size_t samples = 0;
+    double minMs = 0.0;
+    double medianMs = 0.0;
+    double p99Ms = 0.0;
+    double meanMs = 0.0;
+};
+
+class BenchHarness {
+public:
+    // Samples default to 100 so p99 is the second-worst sample rather
+    // than pure noise
+    static constexpr int DEFAULT_WARMUP_ITERATIONS = 10;
+    static constexpr int DEFAULT_SAMPLE_ITERATIONS = 100;
+
+    void add(const std::string& name, std::function<void()> body,
+             int warmupIterations = DEFAULT_WARMUP_ITERATIONS,
+             int sampleIterations = DEFAULT_SAMPLE_ITERATIONS) {
+        entries_.push_back(Entry{name, std::move(body), warmupIterations, sampleIterations});
+    }
+
+    std::vector<BenchResult> runAll() {
+        std::vector<BenchResult> results;
+        results.reserve(entries_.size());
+
+        for (const Entry& entry : entries_) {
+            std::cout << "Running " << entry.name << " (" << entry.warmupIterations
+                      << " warmup + " << entry.sampleIterations << " samples)..." << std::endl;
+
+            for (int i = 0; i < entry.warmupIterations; ++i) {
+                entry.body();
+            }
+
+            std::vector<double> samples(entry.sampleIterations);
+            for (int i = 0; i < entry.sampleIterations; ++i) {
+                auto start = Clock::now();
+                entry.body();
+                samples[i] = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            }
+
+            results.push_back(summarize(entry.name, samples));
+        }
+        return results;
+    }
+
+    // platform-compiler-buildtype, e.g. "linux-gcc-debug" - the key that
+    // decides which baseline this run may be compared against
+    static std::string machineProfile() {
+#if defined(_WIN32)
+        const char* platform = "windows";
+#elif defined(__APPLE__)
+        const char* platform = "macos";
+#else
+        const char* platform = "linux";
+#endif
+#if defined(_MSC_VER)
+        const char* compiler = "msvc";
+#elif defined(__clang__)
+        const char* compiler = "clang";
+#else
+        const char* compiler = "gcc";
+#endif
+#if defined(NDEBUG)
+        const char* buildType = "release";
+#else
+        const char* buildType = "debug";
+#endif
+        return std::string(platform) + "-" + compiler + "-" + buildType;
+    }
+
+    static bool writeJson(const std::string& path, const std::string& profile,
+                          const std::vector<BenchResult>& results) {
+        std::ofstream out(path);
+        if (!out.is_open()) {
+            std::cerr << "Failed to open result file: " << path << std::endl;
+            return false;
+        }
+
+        out << "{\n";
+        out << "  \"profile\": \"" << profile << "\",\n";
+        out << "  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& result = results[i];
+            out << "    {\n";
+            out << "      \"name\": \"" << result.name << "\",\n";
+            out << "      \"samples\": " << result.samples << ",\n";
+            out << "      \"min_ms\": " << result.minMs << ",\n";
+            out << "      \"median_ms\": " << result.medianMs << ",\n";
+            out << "      \"p99_ms\": " << result.p99Ms << ",\n";
+            out << "      \"mean_ms\": " << result.meanMs << "\n";
+            out << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n";
+        out << "}\n";
+        return true;
+    }
+
+    struct Baseline {
+        std::string profile;
+        std::map<std::string, double> medianMsByName;
+    };
+
+    // Minimal parser for the exact schema writeJson emits (and baselines
+    // are checked in using that schema) - this is not a general JSON
+    // reader and does not try to be
+    static bool loadBaseline(const std::string& path, Baseline& baseline) {
+        std::ifstream in(path);
+        if (!in.is_open()) {
+            return false;
+        }
+
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        std::string text = buffer.str();
+
+        baseline.profile = extractString(text, 0, "\"profile\"");
+
+        size_t cursor = 0;
+        while (true) {
+            size_t namePos = text.find("\"name\"", cursor);
+            if (namePos == std::string::npos) {
+                break;
+            }
+            std::string name = extractString(text, namePos, "\"name\"");
+            double median = extractNumber(text, namePos, "\"median_ms\"");
+            if (!name.empty() && median >= 0.0) {
+                baseline.medianMsByName[name] = median;
+            }
+            cursor = namePos + 1;
+        }
+        return !baseline.medianMsByName.empty();
+    }
+
+    // Returns the number of regressions: benchmarks whose median exceeds
+    // the baseline median by more than tolerancePercent
+    static int compareAgainstBaseline(const std::vector<BenchResult>& results,
+                                      const Baseline& baseline, double tolerancePercent) {
+        int regressions = 0;
+        for (const BenchResult& result : results) {
+            auto it = baseline.medianMsByName.find(result.name);
+            if (it == baseline.medianMsByName.end()) {
+                std::cout << "  [NEW]  " << result.name << ": " << result.medianMs
+                          << " ms median (no baseline entry)" << std::endl;
+                continue;
+            }
+
+            double baselineMs = it->second;
+            double deltaPercent = baselineMs > 0.0
+                ? (result.medianMs - baselineMs) / baselineMs * 100.0 : 0.0;
+
+            if (deltaPercent > tolerancePercent) {
+                std::cout << "  [FAIL] " << result.name << ": " << result.medianMs
+                          << " ms median vs baseline " << baselineMs << " ms (+"
+                          << deltaPercent << "%, tolerance " << tolerancePercent << "%)"
+                          << std::endl;
+                regressions++;
+            } else if (deltaPercent < -tolerancePercent) {
+                std::cout << "  [FAST] " << result.name << ": " << result.medianMs
+                          << " ms median vs baseline " << baselineMs << " ms ("
+                          << deltaPercent << "%) - consider refreshing the baseline"
+                          << std::endl;
+            } else {
+                std::cout << "  [OK]   " << result.name << ": " << result.medianMs
+                          << " ms median vs baseline " << baselineMs << " ms ("
+                          << (deltaPercent >= 0.0 ? "+" : "") << deltaPercent << "%)"
+                          << std::endl;
+            }
+        }
+        return regressions;
+    }
+
+    // Sorted-sample statistics; public so scene runs that collect their
+    // own sample vectors can report through the same pipeline
+    static BenchResult summarize(const std::string& name, std::vector<double> samples) {
+        std::sort(samples.begin(), samples.end());
+
+        BenchResult result;
+        result.name = name;
+        result.samples = samples.size();
+        result.minMs = samples.front();
+        result.medianMs = samples[samples.size() / 2];
+        result.p99Ms = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+        for (double sample : samples) {
+            result.meanMs += sample;
+        }
+        result.meanMs /= static_cast<double>(samples.size());
+        return result;
+    }
+
+private:
+    using Clock = std::chrono::high_resolution_clock;
+
+    struct Entry {
+        std::string name;
+        std::function<void()> body;
+        int warmupIterations;
+        int sampleIterations;
+    };
+
+    // Value of the first `"key": "value"` pair at or after `from`
+    static std::string extractString(const std::string& text, size_t from, const std::string& key) {
+        size_t keyPos = text.find(key, from);
+        if (keyPos == std::string::npos) {
+            return "";
+        }
+        size_t open = text.find('"', text.find(':', keyPos));
+        size_t close = text.find('"', open + 1);
+        if (open == std::string::npos || close == std::string::npos) {
+            return "";
+        }
+        return text.substr(open + 1, close - open - 1);
+    }
+
+    // Value of the first `"key": number` pair at or after `from`; -1 when absent
+    static double extractNumber(const std::string& text, size_t from, const std::string& key) {
+        size_t keyPos = text.find(key, from);
+        if (keyPos == std::string::npos) {
+            return -1.0;
+        }
+        size_t colon = text.find(':', keyPos);
+        if (colon == std::string::npos) {
+            return -1.0;
+        }
+        try {
+            return std::stod(text.substr(colon + 1));
+        } catch (...) {
+            return -1.0;
+        }
+    }
+
+    std::vector<Entry> entries_;
+};
+
+} // namespace VulkanMon::Bench
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "../../src/core/HeadlessEngine.h"
+#include "../../src/components/Transform.h"
+#include "../../src/components/SpatialComponent.h"
+#include "../../src/components/RigidBodyComponent.h"
+#include "../../src/components/CollisionComponent.h"
+#include "../../src/components/CreaturePhysicsComponent.h"
+#include "../../src/components/Camera.h"
+#include "../../src/game/CreatureDetectionSystem.h"
+
+#include <cmath>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace VulkanMon::Bench {
+
+// =============================================================================
+// BENCH SCENES - Parameterized synthetic worlds for scene-scale benchmarks
+// =============================================================================
+//
+// "How many creatures can we afford" used to be answered by hand-editing
+// ApplicationSetup.cpp. These generators build the same kind of scene
+// deterministically from a handful of parameters, at headless-engine scale:
+// creatures spread across species with varied sizes and temperaments,
+// static vegetation as spatial load (grass rendering needs a GPU, but its
+// spatial-query cost does not), and a projectile stream for the capture-
+// device path. A scripted camera orbit keeps the LOD and detection
+// reference point moving the way a player would.
+
+struct SceneSpec {
+    const char* name;
+    const char* description;
+    size_t creatureCount;
+    size_t speciesCount;        // Varies size, mass, and temperament
+    size_t vegetationCount;     // Static spatial entities standing in for grass
+    float projectilesPerSecond; // Capture-device spawn rate from the camera
+    float cameraOrbitRadius;
+    float worldExtent;          // Half-size of the square spawn area
+};
+
+inline const std::vector<SceneSpec>& allScenes() {
+    static const std::vector<SceneSpec> scenes = {
+        {"creatures1k", "1,000 creatures across 8 species",
+         1000, 8, 0, 0.0f, 40.0f, 80.0f},
+        {"creatures10k", "10,000 creatures across 16 species",
+         10000, 16, 0, 0.0f, 60.0f, 250.0f},
+        {"creatures10k_grass", "10,000 creatures in 50,000 vegetation entities",
+         10000, 16, 50000, 0.0f, 60.0f, 250.0f},
+        {"projectile_storm", "2,000 creatures under 120 projectiles/second",
+         2000, 8, 0, 120.0f, 40.0f, 100.0f},
+    };
+    return scenes;
+}
+
+inline const SceneSpec* findScene(const std::string& name) {
+    for (const SceneSpec& scene : allScenes()) {
+        if (name == scene.name) {
+            return &scene;
+        }
+    }
+    return nullptr;
+}
+
+inline WorldConfig worldConfigForScene(const SceneSpec& spec) {
+    return WorldConfig(glm::vec3(-spec.worldExtent, -10.0f, -spec.worldExtent),
+                       glm::vec3(spec.worldExtent, 60.0f, spec.worldExtent),
+                       spec.name);
+}
+
+// Drives one scene: populates the world deterministically (fixed seed, so
+// two runs of the same spec measure the same workload) and advances the
+// scripted parts every tick
+class SceneDriver {
+public:
+    SceneDriver(HeadlessEngine& engine, const SceneSpec& spec)
+        : engine_(engine), spec_(spec), rng_(42) {}
+
+    void populate() {
+        auto& entityManager = engine_.getEntityManager();
+        std::uniform_real_distribution<float> spread(-spec_.worldExtent * 0.9f,
+                                                     spec_.worldExtent * 0.9f);
+
+        for (size_t i = 0; i < spec_.creatureCount; ++i) {
+            size_t species = i % spec_.speciesCount;
+            float boundingRadius = 0.5f + species * 0.1f;
+
+            EntityID creature = entityManager.createEntity();
+            Transform transform;
+            transform.position = glm::vec3(spread(rng_), boundingRadius, spread(rng_));
+            entityManager.addComponent(creature, transform);
+            entityManager.addComponent(creature,
+                SpatialComponent(boundingRadius, SpatialBehavior::DYNAMIC,
+                                 LayerMask::Creatures));
+            entityManager.addComponent(creature,
+                RigidBodyComponent::dynamic(1.0f + species * 0.3f));
+            entityManager.addComponent(creature, CollisionComponent::sphere(boundingRadius));
+            entityManager.addComponent(creature, CreaturePhysicsComponent{});
+
+            auto temperament = static_cast<CreatureComponent::CreatureType>(
+                species % 3); // PEACEFUL / NEUTRAL / AGGRESSIVE
+            entityManager.addComponent(creature,
+                CreatureComponent(temperament, 10.0f + species));
+        }
+
+        for (size_t i = 0; i < spec_.vegetationCount; ++i) {
+            EntityID plant = entityManager.createEntity();
+            Transform transform;
+            transform.position = glm::vec3(spread(rng_), 0.0f, spread(rng_));
+            entityManager.addComponent(plant, transform);
+            entityManager.addComponent(plant,
+                SpatialComponent(0.5f, SpatialBehavior::STATIC, LayerMask::Vegetation));
+        }
+
+        // Scripted camera - the detection staggering and crowd LOD follow it
+        camera_ = entityManager.createEntity();
+        Transform cameraTransform;
+        cameraTransform.position = orbitPosition(0.0f);
+        entityManager.addComponent(camera_, cameraTransform);
+        entityManager.addComponent(camera_, Camera{});
+    }
+
+    // Advance the scripted parts by one fixed step: orbit the camera and
+    // emit/retire projectiles at the configured rate
+    void tick(uint64_t tickIndex, float fixedStepSeconds) {
+        auto& entityManager = engine_.getEntityManager();
+
+        float elapsed = static_cast<float>(tickIndex) * fixedStepSeconds;
+        entityManager.getComponent<Transform>(camera_).position = orbitPosition(elapsed);
+
+        projectileDebt_ += spec_.projectilesPerSecond * fixedStepSeconds;
+        while (projectileDebt_ >= 1.0f) {
+            projectileDebt_ -= 1.0f;
+            spawnProjectile(tickIndex);
+        }
+
+        // Retire projectiles after their flight window so the entity count
+        // stays steady-state instead of growing without bound
+        while (!liveProjectiles_.empty() &&
+               liveProjectiles_.front().expiryTick <= tickIndex) {
+            entityManager.destroyEntity(liveProjectiles_.front().entity);
+            liveProjectiles_.pop_front();
+        }
+    }
+
+    EntityID getCameraEntity() const { return camera_; }
+
+private:
+    static constexpr uint64_t PROJECTILE_LIFETIME_TICKS = 180; // 3 seconds at 60 Hz
+    static constexpr float CAMERA_ORBIT_RADIANS_PER_SECOND = 0.2f;
+
+    glm::vec3 orbitPosition(float elapsedSeconds) const {
+        float angle = elapsedSeconds * CAMERA_ORBIT_RADIANS_PER_SECOND;
+        return glm::vec3(std::cos(angle) * spec_.cameraOrbitRadius, 12.0f,
+                         std::sin(angle) * spec_.cameraOrbitRadius);
+    }
+
+    void spawnProjectile(uint64_t tickIndex) {
+        auto& entityManager = engine_.getEntityManager();
+        std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+
+        EntityID projectile = entityManager.createEntity();
+        Transform transform;
+        transform.position = entityManager.getComponent<Transform>(camera_).position;
+        entityManager.addComponent(projectile, transform);
+        entityManager.addComponent(projectile,
+            SpatialComponent(0.15f, SpatialBehavior::DYNAMIC, LayerMask::CaptureDevices));
+
+        // Thrown toward the world center with a little spread, pokeball style
+        glm::vec3 direction = glm::normalize(
+            glm::vec3(jitter(rng_), -0.2f + jitter(rng_), jitter(rng_)) -
+            glm::normalize(transform.position));
+        auto body = RigidBodyComponent::dynamic(0.2f);
+        body.velocity = direction * 30.0f;
+        entityManager.addComponent(projectile, body);
+        entityManager.addComponent(projectile,
+            CollisionComponent::sphere(0.15f, LayerMask::CaptureDevices));
+
+        liveProjectiles_.push_back({projectile, tickIndex + PROJECTILE_LIFETIME_TICKS});
+    }
+
+    struct LiveProjectile {
+        EntityID entity;
+        uint64_t expiryTick;
+    };
+
+    HeadlessEngine& engine_;
+    const SceneSpec& spec_;
+    std::mt19937 rng_;
+    EntityID camera_ = INVALID_ENTITY;
+    float projectileDebt_ = 0.0f;
+    std::deque<LiveProjectile> liveProjectiles_;
+};
+
+} // namespace VulkanMon::Bench
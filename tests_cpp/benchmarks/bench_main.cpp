@@ -0,0 +1,291 @@
+#include "BenchHarness.h"
+#include "BenchScenes.h"
+
+#include "../../src/core/HeadlessEngine.h"
+#include "../../src/components/Transform.h"
+#include "../../src/components/SpatialComponent.h"
+#include "../../src/components/RigidBodyComponent.h"
+#include "../../src/components/CollisionComponent.h"
+#include "../../src/spatial/SpatialManager.h"
+#include "../../src/utils/Logger.h"
+
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+
+using namespace VulkanMon;
+using namespace VulkanMon::Bench;
+
+// =============================================================================
+// VulkanMon performance benchmark harness
+// =============================================================================
+//
+// Usage:
+//   vulkanmon_bench [--json <out.json>] [--baseline <baseline.json>]
+//                   [--tolerance <percent>]
+//                   [--scene <name>] [--ticks <count>] [--list-scenes]
+//
+// Without --scene, runs the engine's micro-benchmark hot paths at Pokemon
+// Legends scale. With --scene, generates a synthetic world from the named
+// spec (see BenchScenes.h), drives it through a scripted camera orbit for
+// the requested tick count, and reports per-tick and per-system timings.
+// Either mode prints a summary, optionally writes JSON results, and
+// optionally diffs medians against a checked-in baseline
+// (tests_cpp/benchmarks/baselines/<profile>.json). Exit code is the number
+// of regressions beyond tolerance, so CI can gate on it directly.
+// Baselines only apply to the matching machine profile; a mismatch reports
+// and skips comparison instead of failing.
+
+namespace {
+
+constexpr double DEFAULT_TOLERANCE_PERCENT = 10.0;
+
+// 32x32 creature grid matching the regression-test scenario so numbers
+// stay comparable with historical measurements
+std::unique_ptr<SpatialManager> makePokemonScaleSpatialManager() {
+    BoundingBox worldBounds{glm::vec3(-50.0f, -10.0f, -50.0f),
+                            glm::vec3(50.0f, 20.0f, 50.0f)};
+    auto spatialManager = std::make_unique<SpatialManager>(worldBounds);
+
+    const int GRID_SIZE = 32;
+    const float SPACING = 3.0f;
+    const float OFFSET = -(GRID_SIZE - 1) * SPACING * 0.5f;
+
+    for (int x = 0; x < GRID_SIZE; x++) {
+        for (int z = 0; z < GRID_SIZE; z++) {
+            EntityID entity = static_cast<EntityID>(x * GRID_SIZE + z + 1);
+            glm::vec3 position(OFFSET + x * SPACING, 0.0f, OFFSET + z * SPACING);
+            spatialManager->addEntity(entity, position, LayerMask::Creatures);
+        }
+    }
+    return spatialManager;
+}
+
+void registerSpatialBenchmarks(BenchHarness& harness, SpatialManager& spatialManager) {
+    harness.add("spatial_radius_query_1024", [&spatialManager]() {
+        auto results = spatialManager.queryRadius(glm::vec3(0.0f), 15.0f, LayerMask::Creatures);
+        if (results.empty()) {
+            std::cerr << "spatial_radius_query_1024 returned no entities" << std::endl;
+        }
+    });
+
+    harness.add("spatial_batch_radius_64", [&spatialManager]() {
+        std::vector<SpatialManager::BatchedRadiusQuery> queries;
+        queries.reserve(64);
+        for (int i = 0; i < 64; i++) {
+            SpatialManager::BatchedRadiusQuery query;
+            query.sourceEntity = static_cast<EntityID>(i + 1);
+            query.center = glm::vec3((i % 8 - 4) * 6.0f, 0.0f, ((i / 8) % 8 - 4) * 6.0f);
+            query.radius = 8.0f + (i % 5);
+            query.layerMask = LayerMask::Creatures;
+            queries.push_back(query);
+        }
+        auto results = spatialManager.queryRadiusBatch(queries);
+        if (results.size() != 64) {
+            std::cerr << "spatial_batch_radius_64 returned wrong result count" << std::endl;
+        }
+    });
+
+    harness.add("spatial_frustum_cull_1024", [&spatialManager]() {
+        Frustum frustum;
+        frustum.planes[0] = glm::vec4(1, 0, 0, 25);
+        frustum.planes[1] = glm::vec4(-1, 0, 0, 25);
+        frustum.planes[2] = glm::vec4(0, 1, 0, 15);
+        frustum.planes[3] = glm::vec4(0, -1, 0, 15);
+        frustum.planes[4] = glm::vec4(0, 0, 1, 5);
+        frustum.planes[5] = glm::vec4(0, 0, -1, 100);
+        frustum.updateAbsNormals();
+        auto visible = spatialManager.queryFrustum(frustum, LayerMask::Creatures);
+        if (visible.empty()) {
+            std::cerr << "spatial_frustum_cull_1024 culled everything" << std::endl;
+        }
+    });
+}
+
+// Full simulation tick (spatial + physics + creature AI) through the
+// headless engine - the closest thing to "a frame" without a GPU
+void registerSimulationBenchmark(BenchHarness& harness, HeadlessEngine& engine) {
+    auto& entityManager = engine.getEntityManager();
+    const int GRID_SIZE = 8; // 64 physics-backed creatures
+    for (int x = 0; x < GRID_SIZE; x++) {
+        for (int z = 0; z < GRID_SIZE; z++) {
+            EntityID creature = entityManager.createEntity();
+            Transform transform;
+            transform.position = glm::vec3((x - 4) * 4.0f, 2.0f, (z - 4) * 4.0f);
+            entityManager.addComponent(creature, transform);
+            entityManager.addComponent(creature,
+                SpatialComponent(1.0f, SpatialBehavior::DYNAMIC, LayerMask::Creatures));
+            entityManager.addComponent(creature, RigidBodyComponent::dynamic(1.0f));
+            entityManager.addComponent(creature, CollisionComponent::sphere(1.0f));
+        }
+    }
+
+    harness.add("headless_tick_64_creatures", [&engine]() {
+        engine.runTicks(1);
+    });
+}
+
+// Inspector-style cleanup of typeid names for stable benchmark keys
+std::string cleanSystemName(std::string name) {
+    size_t classPos = name.find("class ");
+    if (classPos != std::string::npos) {
+        name = name.substr(classPos + 6);
+    }
+    size_t namespacePos = name.find("VulkanMon::");
+    if (namespacePos != std::string::npos) {
+        name = name.substr(namespacePos + 11);
+    }
+    return name;
+}
+
+// Scene-scale run: full pipeline through the headless engine with the
+// scripted driver, capturing per-tick wall time and each system's own
+// update time from the SystemManager
+std::vector<BenchResult> runScene(const SceneSpec& spec, uint64_t tickCount) {
+    std::cout << "Scene '" << spec.name << "': " << spec.description << std::endl;
+
+    HeadlessEngine engine(worldConfigForScene(spec));
+    engine.initialize();
+
+    SceneDriver driver(engine, spec);
+    driver.populate();
+
+    constexpr float STEP_SECONDS = HeadlessEngine::DEFAULT_FIXED_STEP_SECONDS;
+    constexpr uint64_t WARMUP_TICKS = 120;
+
+    std::cout << "Populated " << spec.creatureCount << " creatures, "
+              << spec.vegetationCount << " vegetation entities; running "
+              << WARMUP_TICKS << " warmup + " << tickCount << " measured ticks..."
+              << std::endl;
+
+    uint64_t tickIndex = 0;
+    for (; tickIndex < WARMUP_TICKS; ++tickIndex) {
+        driver.tick(tickIndex, STEP_SECONDS);
+        engine.runTicks(1);
+    }
+
+    std::vector<double> tickSamples;
+    tickSamples.reserve(tickCount);
+    std::map<std::string, std::vector<double>> systemSamples;
+
+    using Clock = std::chrono::high_resolution_clock;
+    for (uint64_t measured = 0; measured < tickCount; ++measured, ++tickIndex) {
+        auto start = Clock::now();
+        driver.tick(tickIndex, STEP_SECONDS);
+        engine.runTicks(1);
+        tickSamples.push_back(
+            std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+
+        for (const auto& [typeIndex, perfData] :
+             engine.getWorld().getSystemManager().getPerformanceData()) {
+            systemSamples[cleanSystemName(perfData.name)].push_back(perfData.updateTime);
+        }
+    }
+
+    std::vector<BenchResult> results;
+    std::string prefix = std::string("scene_") + spec.name;
+    results.push_back(BenchHarness::summarize(prefix + "_tick", std::move(tickSamples)));
+    for (auto& [systemName, samples] : systemSamples) {
+        results.push_back(
+            BenchHarness::summarize(prefix + "_" + systemName, std::move(samples)));
+    }
+
+    engine.shutdown();
+    return results;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string jsonPath;
+    std::string baselinePath;
+    std::string sceneName;
+    uint64_t sceneTicks = 600;
+    double tolerancePercent = DEFAULT_TOLERANCE_PERCENT;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baselinePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerancePercent = std::stod(argv[++i]);
+        } else if (std::strcmp(argv[i], "--scene") == 0 && i + 1 < argc) {
+            sceneName = argv[++i];
+        } else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            sceneTicks = std::stoull(argv[++i]);
+        } else if (std::strcmp(argv[i], "--list-scenes") == 0) {
+            for (const auto& scene : allScenes()) {
+                std::cout << scene.name << " - " << scene.description << std::endl;
+            }
+            return 0;
+        } else {
+            std::cerr << "Usage: vulkanmon_bench [--json <out.json>] "
+                         "[--baseline <baseline.json>] [--tolerance <percent>] "
+                         "[--scene <name>] [--ticks <count>] [--list-scenes]" << std::endl;
+            return 1;
+        }
+    }
+
+    // Engine logging would dominate benchmark output; keep only problems
+    Logger::getInstance().setLogLevel(LogLevel::WARNING_LEVEL);
+
+    std::string profile = BenchHarness::machineProfile();
+    std::cout << "Machine profile: " << profile << std::endl;
+
+    std::vector<BenchResult> results;
+    if (!sceneName.empty()) {
+        const SceneSpec* spec = findScene(sceneName);
+        if (spec == nullptr) {
+            std::cerr << "Unknown scene '" << sceneName
+                      << "' - use --list-scenes for the available specs" << std::endl;
+            return 1;
+        }
+        results = runScene(*spec, sceneTicks);
+    } else {
+        BenchHarness harness;
+
+        auto spatialManager = makePokemonScaleSpatialManager();
+        registerSpatialBenchmarks(harness, *spatialManager);
+
+        HeadlessEngine engine;
+        engine.initialize();
+        registerSimulationBenchmark(harness, engine);
+
+        results = harness.runAll();
+        engine.shutdown();
+    }
+
+    std::cout << "\nResults:" << std::endl;
+    for (const auto& result : results) {
+        std::cout << "  " << result.name << ": median " << result.medianMs
+                  << " ms, p99 " << result.p99Ms << " ms, min " << result.minMs
+                  << " ms (" << result.samples << " samples)" << std::endl;
+    }
+
+    if (!jsonPath.empty() && !BenchHarness::writeJson(jsonPath, profile, results)) {
+        return 1;
+    }
+
+    int regressions = 0;
+    if (!baselinePath.empty()) {
+        BenchHarness::Baseline baseline;
+        if (!BenchHarness::loadBaseline(baselinePath, baseline)) {
+            std::cout << "\nNo usable baseline at " << baselinePath
+                      << " - skipping comparison" << std::endl;
+        } else if (baseline.profile != profile) {
+            std::cout << "\nBaseline profile '" << baseline.profile
+                      << "' does not match this machine ('" << profile
+                      << "') - skipping comparison" << std::endl;
+        } else {
+            std::cout << "\nBaseline comparison (tolerance " << tolerancePercent
+                      << "%):" << std::endl;
+            regressions = BenchHarness::compareAgainstBaseline(results, baseline,
+                                                               tolerancePercent);
+        }
+    }
+
+    return regressions;
+}
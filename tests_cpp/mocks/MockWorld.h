@@ -47,7 +47,7 @@ public:
         EntityID entity = entityManager_->createEntity();
         Transform transform;
         Renderable renderable;
-        renderable.meshPath = meshPath;
+        renderable.setMesh(meshPath);
         renderable.materialId = materialId;
         renderable.isVisible = true;
         entityManager_->addComponent(entity, transform);
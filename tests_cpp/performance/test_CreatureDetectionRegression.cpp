@@ -295,4 +295,31 @@ TEST_CASE("Performance Regression: CreatureDetection Stress Test", "[performance
         INFO("  Average frame time: " << avgFrameTimeMs << "ms");
         INFO("  Estimated FPS capability: " << (1000.0f / avgFrameTimeMs) << " FPS");
     }
-}
\ No newline at end of file
+}
+TEST_CASE("CreatureDetection Staggered Intervals", "[performance][creatures][staggering]") {
+    SECTION("Interval scale follows distance bands") {
+        // Base rate near the player, slowest rate far out, monotonic between
+        REQUIRE(CreatureDetectionSystem::intervalScaleForDistance(0.0f) == 1.0f);
+        REQUIRE(CreatureDetectionSystem::intervalScaleForDistance(
+                    CreatureDetectionSystem::DETECTION_NEAR_DISTANCE) == 1.0f);
+        REQUIRE(CreatureDetectionSystem::intervalScaleForDistance(
+                    CreatureDetectionSystem::DETECTION_FAR_DISTANCE) ==
+                CreatureDetectionSystem::DETECTION_FAR_INTERVAL_SCALE);
+        REQUIRE(CreatureDetectionSystem::intervalScaleForDistance(300.0f) ==
+                CreatureDetectionSystem::DETECTION_FAR_INTERVAL_SCALE);
+
+        float midScale = CreatureDetectionSystem::intervalScaleForDistance(
+            (CreatureDetectionSystem::DETECTION_NEAR_DISTANCE +
+             CreatureDetectionSystem::DETECTION_FAR_DISTANCE) * 0.5f);
+        REQUIRE(midScale > 1.0f);
+        REQUIRE(midScale < CreatureDetectionSystem::DETECTION_FAR_INTERVAL_SCALE);
+    }
+
+    SECTION("Far scale keeps far creatures at gameplay-relevant rates") {
+        // 0.2s base interval stretched by the far scale must stay within
+        // the 2-4Hz band far detection is specced at
+        float farInterval = 0.2f * CreatureDetectionSystem::DETECTION_FAR_INTERVAL_SCALE;
+        REQUIRE(farInterval >= 0.25f);
+        REQUIRE(farInterval <= 0.5f);
+    }
+}
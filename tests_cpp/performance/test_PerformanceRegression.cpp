@@ -153,6 +153,7 @@ TEST_CASE("Performance Regression: Pokemon Legends Scale Spatial Queries", "[per
         testFrustum.planes[3] = glm::vec4(0, -1, 0, 5);   // Top: y < 5
         testFrustum.planes[4] = glm::vec4(0, 0, 1, 5);    // Near: z > -5
         testFrustum.planes[5] = glm::vec4(0, 0, -1, 15);  // Far: z < 15
+        testFrustum.updateAbsNormals(); // required after writing planes directly
 
         auto start = std::chrono::high_resolution_clock::now();
 
@@ -227,6 +228,7 @@ TEST_CASE("Performance Benchmarks: Pokemon Legends Scale", "[performance][benchm
         frustum.planes[3] = glm::vec4(0, -1, 0, 15);
         frustum.planes[4] = glm::vec4(0, 0, 1, 5);
         frustum.planes[5] = glm::vec4(0, 0, -1, 100);
+        frustum.updateAbsNormals();
 
         std::vector<EntityID> visible = spatialManager->queryFrustum(frustum, LayerMask::Creatures);
         return visible.size();
@@ -254,6 +256,7 @@ TEST_CASE("Performance Regression: Full System Integration", "[performance][regr
         renderFrustum.planes[3] = glm::vec4(0, -1, 0, 20);
         renderFrustum.planes[4] = glm::vec4(0, 0, 1, 10);
         renderFrustum.planes[5] = glm::vec4(0, 0, -1, 200);
+        renderFrustum.updateAbsNormals();
 
         std::vector<EntityID> renderCandidates = spatialManager->queryFrustum(renderFrustum, LayerMask::Creatures);
 
@@ -2,6 +2,7 @@
 #include <catch2/catch_approx.hpp>
 
 #include "../../src/systems/PhysicsSystem.h"
+#include "../../src/systems/SpatialSystem.h"
 #include "../../src/core/EntityManager.h"
 #include "../../src/components/RigidBodyComponent.h"
 #include "../../src/components/CollisionComponent.h"
@@ -598,4 +599,460 @@ TEST_CASE("Clean Jolt-ECS Integration", "[Physics][Integration][New]") {
     }
 
     physicsSystem.shutdown(entityManager);
-}
\ No newline at end of file
+}
+// =============================================================================
+// FIXED TIMESTEP AND RENDER INTERPOLATION TESTS
+// =============================================================================
+
+TEST_CASE("PhysicsSystem Fixed Timestep Accumulator", "[Physics][PhysicsSystem]") {
+    PhysicsSystem physicsSystem;
+    EntityManager entityManager;
+
+    physicsSystem.initialize(entityManager);
+
+    SECTION("Simulation advances in fixed increments") {
+        REQUIRE(PhysicsSystem::FIXED_TIMESTEP_MS == Catch::Approx(1000.0f / 60.0f));
+
+        // Half a step accumulates without simulating; alpha reports how
+        // far the frame sits past the last physics state
+        physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS * 0.5f, entityManager);
+        REQUIRE(physicsSystem.getInterpolationAlpha() == Catch::Approx(0.5f).margin(0.01f));
+
+        // The second half crosses the step boundary and drains the accumulator
+        physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS * 0.5f, entityManager);
+        REQUIRE(physicsSystem.getInterpolationAlpha() < 0.5f);
+    }
+
+    SECTION("Backlog is capped after a frame hitch") {
+        // A 100-step hitch must not queue 100 catch-up steps - the cap
+        // trades simulation time for frame time (no death spiral)
+        physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS * 100.0f, entityManager);
+
+        // Whatever was simulated, the leftover is less than one step
+        REQUIRE(physicsSystem.getInterpolationAlpha() >= 0.0f);
+        REQUIRE(physicsSystem.getInterpolationAlpha() < 1.0f);
+    }
+
+    SECTION("Interpolation toggle") {
+        // On by default for smooth rendering; disabling snaps Transforms
+        // to the newest physics state for deterministic captures
+        REQUIRE(physicsSystem.isInterpolationEnabled());
+        physicsSystem.setInterpolationEnabled(false);
+        REQUIRE_FALSE(physicsSystem.isInterpolationEnabled());
+    }
+
+    physicsSystem.shutdown(entityManager);
+}
+
+TEST_CASE("PhysicsSystem Active Body Sync", "[Physics][PhysicsSystem]") {
+    PhysicsSystem physicsSystem;
+    EntityManager entityManager;
+
+    physicsSystem.initialize(entityManager);
+
+    SECTION("Moving bodies sync to ECS transforms") {
+        EntityID entity = entityManager.createEntity();
+
+        Transform transform;
+        transform.position = glm::vec3(0.0f, 10.0f, 0.0f);
+        entityManager.addComponent(entity, transform);
+
+        CollisionComponent collision = CollisionComponent::createCreature(0.5f);
+        entityManager.addComponent(entity, collision);
+
+        RigidBodyComponent rigidBody;
+        rigidBody.isDynamic = true;
+        rigidBody.useGravity = true;
+        entityManager.addComponent(entity, rigidBody);
+
+        // Half a second of simulated falling
+        for (int i = 0; i < 30; ++i) {
+            physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+        }
+
+        // The activation tracker must have routed this awake body's poses
+        // through to the Transform component
+        auto& updatedTransform = entityManager.getComponent<Transform>(entity);
+        REQUIRE(updatedTransform.position.y < 10.0f);
+    }
+
+    SECTION("Static bodies never touch their transforms") {
+        EntityID entity = entityManager.createEntity();
+
+        Transform transform;
+        transform.position = glm::vec3(3.0f, 2.0f, 1.0f);
+        entityManager.addComponent(entity, transform);
+
+        CollisionComponent collision = CollisionComponent::createEnvironment(glm::vec3(1.0f));
+        entityManager.addComponent(entity, collision);
+
+        RigidBodyComponent rigidBody;
+        rigidBody.isDynamic = false;
+        rigidBody.useGravity = false;
+        entityManager.addComponent(entity, rigidBody);
+
+        for (int i = 0; i < 10; ++i) {
+            physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+        }
+
+        // Static bodies are never activated, so the sync never visits
+        // them - the ECS-authored position stays exact
+        auto& updatedTransform = entityManager.getComponent<Transform>(entity);
+        REQUIRE(updatedTransform.position == glm::vec3(3.0f, 2.0f, 1.0f));
+    }
+
+    physicsSystem.shutdown(entityManager);
+}
+
+TEST_CASE("PhysicsSystem Batched Queries", "[Physics][PhysicsSystem]") {
+    PhysicsSystem physicsSystem;
+    EntityManager entityManager;
+
+    physicsSystem.initialize(entityManager);
+
+    // A row of static targets for the queries to find
+    for (int i = 0; i < 5; ++i) {
+        EntityID entity = entityManager.createEntity();
+
+        Transform transform;
+        transform.position = glm::vec3(static_cast<float>(i) * 4.0f, 0.0f, 0.0f);
+        entityManager.addComponent(entity, transform);
+
+        CollisionComponent collision = CollisionComponent::createEnvironment(glm::vec3(1.0f));
+        entityManager.addComponent(entity, collision);
+
+        RigidBodyComponent rigidBody;
+        rigidBody.isDynamic = false;
+        rigidBody.useGravity = false;
+        entityManager.addComponent(entity, rigidBody);
+    }
+
+    // One update creates the Jolt bodies
+    physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+
+    SECTION("Batch results index-match their requests") {
+        // Enough rays to cross the inline threshold and hit the job path
+        std::vector<PhysicsSystem::RaycastRequest> requests;
+        for (int i = 0; i < 20; ++i) {
+            PhysicsSystem::RaycastRequest request;
+            request.origin = glm::vec3(static_cast<float>(i % 5) * 4.0f, 10.0f, 0.0f);
+            request.direction = glm::vec3(0.0f, -1.0f, 0.0f);
+            request.maxDistance = 20.0f;
+            requests.push_back(request);
+        }
+
+        auto batchResults = physicsSystem.raycastBatch(requests);
+        REQUIRE(batchResults.size() == requests.size());
+
+        // Every batch entry must agree with the equivalent single query
+        for (size_t i = 0; i < requests.size(); ++i) {
+            auto single = physicsSystem.raycast(requests[i].origin, requests[i].direction,
+                                                requests[i].maxDistance, requests[i].layerMask);
+            REQUIRE(batchResults[i].hit == single.hit);
+            if (single.hit) {
+                REQUIRE(batchResults[i].entity == single.entity);
+            }
+        }
+    }
+
+    SECTION("Sphere overlap batch") {
+        std::vector<PhysicsSystem::OverlapSphereRequest> requests;
+        for (int i = 0; i < 10; ++i) {
+            PhysicsSystem::OverlapSphereRequest request;
+            request.center = glm::vec3(static_cast<float>(i % 5) * 4.0f, 0.0f, 0.0f);
+            request.radius = 1.5f;
+            requests.push_back(request);
+        }
+
+        auto batchResults = physicsSystem.overlapSphereBatch(requests);
+        REQUIRE(batchResults.size() == requests.size());
+
+        for (size_t i = 0; i < requests.size(); ++i) {
+            auto single = physicsSystem.overlapSphere(requests[i].center, requests[i].radius,
+                                                      requests[i].layerMask);
+            REQUIRE(batchResults[i].size() == single.size());
+        }
+    }
+
+    SECTION("Empty batches are harmless") {
+        REQUIRE(physicsSystem.raycastBatch({}).empty());
+        REQUIRE(physicsSystem.overlapSphereBatch({}).empty());
+    }
+
+    physicsSystem.shutdown(entityManager);
+}
+
+TEST_CASE("PhysicsSystem Shared Shape Cache", "[Physics][PhysicsSystem]") {
+    PhysicsSystem physicsSystem;
+    EntityManager entityManager;
+
+    physicsSystem.initialize(entityManager);
+    REQUIRE(physicsSystem.getShapeCacheSize() == 0);
+
+    // A spawning wave: many creatures with identical capsule dimensions
+    for (int i = 0; i < 20; ++i) {
+        EntityID entity = entityManager.createEntity();
+
+        Transform transform;
+        transform.position = glm::vec3(static_cast<float>(i) * 2.0f, 5.0f, 0.0f);
+        entityManager.addComponent(entity, transform);
+
+        entityManager.addComponent(entity, CollisionComponent::createCreature(0.5f, 1.8f));
+
+        RigidBodyComponent rigidBody;
+        rigidBody.isDynamic = true;
+        entityManager.addComponent(entity, rigidBody);
+    }
+
+    physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+
+    SECTION("Identical dimensions share one shape") {
+        // 20 bodies, one cached capsule
+        REQUIRE(physicsSystem.getShapeCacheSize() == 1);
+    }
+
+    SECTION("Different dimensions are different shapes") {
+        EntityID entity = entityManager.createEntity();
+
+        Transform transform;
+        transform.position = glm::vec3(0.0f, 20.0f, 0.0f);
+        entityManager.addComponent(entity, transform);
+
+        entityManager.addComponent(entity, CollisionComponent::createCreature(1.2f, 3.0f));
+
+        RigidBodyComponent rigidBody;
+        rigidBody.isDynamic = true;
+        entityManager.addComponent(entity, rigidBody);
+
+        physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+        REQUIRE(physicsSystem.getShapeCacheSize() == 2);
+    }
+
+    physicsSystem.shutdown(entityManager);
+}
+
+TEST_CASE("PhysicsSystem Physics LOD Tiering", "[Physics][PhysicsSystem]") {
+    PhysicsSystem physicsSystem;
+    EntityManager entityManager;
+
+    physicsSystem.initialize(entityManager);
+    physicsSystem.setLODReference(glm::vec3(0.0f));
+
+    auto makeCreature = [&](const glm::vec3& position) {
+        EntityID entity = entityManager.createEntity();
+
+        Transform transform;
+        transform.position = position;
+        entityManager.addComponent(entity, transform);
+
+        entityManager.addComponent(entity, CollisionComponent::createCreature(0.5f, 1.8f));
+
+        RigidBodyComponent rigidBody;
+        rigidBody.isDynamic = true;
+        entityManager.addComponent(entity, rigidBody);
+
+        CreaturePhysicsComponent creaturePhysics;
+        entityManager.addComponent(entity, creaturePhysics);
+        return entity;
+    };
+
+    EntityID nearCreature = makeCreature(glm::vec3(5.0f, 0.0f, 0.0f));
+    EntityID midCreature = makeCreature(glm::vec3(50.0f, 0.0f, 0.0f));
+    EntityID farCreature = makeCreature(glm::vec3(200.0f, 0.0f, 0.0f));
+
+    // First update creates bodies; second crosses the LOD interval
+    physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+    physicsSystem.update(PhysicsSystem::PHYSICS_LOD_UPDATE_INTERVAL_MS, entityManager);
+
+    SECTION("Tiers follow distance from the reference") {
+        REQUIRE(physicsSystem.getPhysicsLOD(nearCreature) == PhysicsSystem::PhysicsLOD::Full);
+        REQUIRE(physicsSystem.getPhysicsLOD(midCreature) == PhysicsSystem::PhysicsLOD::Kinematic);
+        REQUIRE(physicsSystem.getPhysicsLOD(farCreature) == PhysicsSystem::PhysicsLOD::Frozen);
+    }
+
+    SECTION("Tier boundaries") {
+        REQUIRE(PhysicsSystem::lodForDistance(0.0f) == PhysicsSystem::PhysicsLOD::Full);
+        REQUIRE(PhysicsSystem::lodForDistance(PhysicsSystem::PHYSICS_LOD_NEAR_DISTANCE)
+                == PhysicsSystem::PhysicsLOD::Kinematic);
+        REQUIRE(PhysicsSystem::lodForDistance(PhysicsSystem::PHYSICS_LOD_FAR_DISTANCE)
+                == PhysicsSystem::PhysicsLOD::Frozen);
+    }
+
+    SECTION("Creatures promote when the reference approaches") {
+        physicsSystem.setLODReference(glm::vec3(200.0f, 0.0f, 0.0f));
+        physicsSystem.update(PhysicsSystem::PHYSICS_LOD_UPDATE_INTERVAL_MS, entityManager);
+
+        REQUIRE(physicsSystem.getPhysicsLOD(farCreature) == PhysicsSystem::PhysicsLOD::Full);
+        REQUIRE(physicsSystem.getPhysicsLOD(nearCreature) == PhysicsSystem::PhysicsLOD::Frozen);
+    }
+
+    physicsSystem.shutdown(entityManager);
+}
+
+TEST_CASE("PhysicsSystem Contact Events", "[Physics][PhysicsSystem][ContactEvents]") {
+    PhysicsSystem physicsSystem;
+    EntityManager entityManager;
+
+    physicsSystem.initialize(entityManager);
+
+    auto makeGround = [&]() {
+        EntityID ground = entityManager.createEntity();
+        Transform groundTransform;
+        groundTransform.position = glm::vec3(0.0f, -2.0f, 0.0f);
+        entityManager.addComponent(ground, groundTransform);
+        entityManager.addComponent(ground, CollisionComponent::createEnvironment(glm::vec3(20.0f, 1.0f, 20.0f)));
+        RigidBodyComponent groundBody;
+        groundBody.isDynamic = false;
+        groundBody.mass = 0.0f;
+        entityManager.addComponent(ground, groundBody);
+        return ground;
+    };
+
+    auto makeFallingSphere = [&](const glm::vec3& position) {
+        EntityID entity = entityManager.createEntity();
+        Transform transform;
+        transform.position = position;
+        entityManager.addComponent(entity, transform);
+        entityManager.addComponent(entity, CollisionComponent::createCreature(0.5f));
+        RigidBodyComponent rigidBody;
+        rigidBody.isDynamic = true;
+        rigidBody.velocity = glm::vec3(0.0f, -10.0f, 0.0f);
+        rigidBody.useGravity = true;
+        entityManager.addComponent(entity, rigidBody);
+        return entity;
+    };
+
+    SECTION("No events before anything touches") {
+        makeFallingSphere(glm::vec3(0.0f, 100.0f, 0.0f));
+        physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+
+        REQUIRE(physicsSystem.getContactEvents().empty());
+    }
+
+    SECTION("Body landing on ground reports a contact begin") {
+        EntityID ground = makeGround();
+        EntityID sphere = makeFallingSphere(glm::vec3(0.0f, 0.5f, 0.0f));
+
+        bool sawContactBegin = false;
+        for (int i = 0; i < 30 && !sawContactBegin; ++i) {
+            physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+            for (const auto& event : physicsSystem.getContactEvents()) {
+                if (event.type != ContactEvent::Type::ContactBegin) continue;
+                bool pairMatches = (event.entityA == sphere && event.entityB == ground) ||
+                                   (event.entityA == ground && event.entityB == sphere);
+                if (pairMatches) sawContactBegin = true;
+            }
+        }
+
+        REQUIRE(sawContactBegin);
+    }
+
+    SECTION("Trigger volumes report trigger events and do not block") {
+        EntityID zone = entityManager.createEntity();
+        Transform zoneTransform;
+        zoneTransform.position = glm::vec3(0.0f, 0.0f, 0.0f);
+        entityManager.addComponent(zone, zoneTransform);
+        entityManager.addComponent(zone, CollisionComponent::createTriggerZone(2.0f));
+        RigidBodyComponent zoneBody;
+        zoneBody.isDynamic = false;
+        zoneBody.mass = 0.0f;
+        entityManager.addComponent(zone, zoneBody);
+
+        EntityID sphere = makeFallingSphere(glm::vec3(0.0f, 4.0f, 0.0f));
+
+        bool sawTriggerBegin = false;
+        for (int i = 0; i < 60; ++i) {
+            physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+            for (const auto& event : physicsSystem.getContactEvents()) {
+                if (event.type == ContactEvent::Type::TriggerBegin) sawTriggerBegin = true;
+            }
+        }
+
+        REQUIRE(sawTriggerBegin);
+        // Sensors generate events without collision response, so the
+        // sphere keeps falling straight through the zone
+        REQUIRE(entityManager.getComponent<Transform>(sphere).position.y < -2.0f);
+    }
+
+    SECTION("Callback receives the frame batch") {
+        EntityID ground = makeGround();
+        makeFallingSphere(glm::vec3(0.0f, 0.5f, 0.0f));
+
+        size_t callbackEvents = 0;
+        physicsSystem.setContactEventCallback(
+            [&callbackEvents](const std::vector<ContactEvent>& events) {
+                callbackEvents += events.size();
+            });
+
+        for (int i = 0; i < 30; ++i) {
+            physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+        }
+
+        REQUIRE(callbackEvents > 0);
+        (void)ground;
+    }
+
+    physicsSystem.shutdown(entityManager);
+}
+
+TEST_CASE("PhysicsSystem Spatial Activation Regions", "[Physics][PhysicsSystem][ActivationRegions]") {
+    PhysicsSystem physicsSystem;
+    EntityManager entityManager;
+    SpatialSystem spatialSystem(BoundingBox(glm::vec3(-500.0f), glm::vec3(500.0f)));
+
+    physicsSystem.initialize(entityManager);
+    physicsSystem.setSpatialSystem(&spatialSystem);
+
+    auto makeCreature = [&](const glm::vec3& position) {
+        EntityID entity = entityManager.createEntity();
+
+        Transform transform;
+        transform.position = position;
+        entityManager.addComponent(entity, transform);
+
+        entityManager.addComponent(entity, CollisionComponent::createCreature(0.5f));
+
+        RigidBodyComponent rigidBody;
+        rigidBody.isDynamic = true;
+        rigidBody.useGravity = false;
+        entityManager.addComponent(entity, rigidBody);
+
+        CreaturePhysicsComponent creaturePhysics;
+        entityManager.addComponent(entity, creaturePhysics);
+
+        spatialSystem.addEntity(entity, position, LayerMask::Creatures);
+        return entity;
+    };
+
+    EntityID nearCreature = makeCreature(glm::vec3(10.0f, 0.0f, 0.0f));
+    EntityID farCreature = makeCreature(glm::vec3(300.0f, 0.0f, 0.0f));
+
+    // First update creates bodies; the region pass runs once its interval
+    // has elapsed
+    physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+    physicsSystem.setActivationRegions({glm::vec3(0.0f)});
+    physicsSystem.update(PhysicsSystem::REGION_ACTIVATION_UPDATE_INTERVAL_MS, entityManager);
+
+    SECTION("Bodies outside every region are put to sleep") {
+        REQUIRE_FALSE(physicsSystem.isRegionDeactivated(nearCreature));
+        REQUIRE(physicsSystem.isRegionDeactivated(farCreature));
+        REQUIRE(physicsSystem.getRegionDeactivatedCount() == 1);
+    }
+
+    SECTION("Bodies wake when a region reaches them") {
+        physicsSystem.setActivationRegions({glm::vec3(300.0f, 0.0f, 0.0f)});
+        physicsSystem.update(PhysicsSystem::REGION_ACTIVATION_UPDATE_INTERVAL_MS, entityManager);
+
+        REQUIRE_FALSE(physicsSystem.isRegionDeactivated(farCreature));
+        REQUIRE(physicsSystem.isRegionDeactivated(nearCreature));
+    }
+
+    SECTION("Clearing regions wakes everything the pass slept") {
+        physicsSystem.setActivationRegions({});
+
+        REQUIRE_FALSE(physicsSystem.isRegionDeactivated(farCreature));
+        REQUIRE(physicsSystem.getRegionDeactivatedCount() == 0);
+    }
+
+    physicsSystem.shutdown(entityManager);
+}
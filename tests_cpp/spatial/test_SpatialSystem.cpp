@@ -1,11 +1,13 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 #include "../../src/spatial/SpatialManager.h"
+#include "../../src/spatial/SimdCulling.h"
 #include "../../src/components/SpatialComponent.h"
 #include "../../src/systems/SpatialSystem.h"
 #include "../../src/core/World.h"
 #include "../../src/components/Transform.h"
 #include <random>
+#include <algorithm>
 
 using namespace VulkanMon;
 
@@ -343,4 +345,770 @@ TEST_CASE("Frustum Culling", "[spatial]") {
         }
         CHECK(foundE1);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("SpatialManager static/dynamic partitioning", "[spatial][static]") {
+    BoundingBox worldBounds(glm::vec3(-100, -100, -100), glm::vec3(100, 100, 100));
+    SpatialManager manager(worldBounds);
+
+    SECTION("Static entities are tracked in the static tier") {
+        manager.addEntity(1, glm::vec3(0, 0, 0), LayerMask::Environment, true);
+        manager.addEntity(2, glm::vec3(1, 0, 0), LayerMask::Creatures, false);
+
+        REQUIRE(manager.isEntityStatic(1));
+        REQUIRE_FALSE(manager.isEntityStatic(2));
+        REQUIRE(manager.getStaticEntityCount() == 1);
+
+        // Queries merge both tiers
+        auto results = manager.queryRadius(glm::vec3(0, 0, 0), 5.0f);
+        REQUIRE(results.size() == 2);
+    }
+
+    SECTION("Moving a static entity demotes it to the dynamic tier") {
+        manager.addEntity(1, glm::vec3(0, 0, 0), LayerMask::Environment, true);
+        manager.updateEntity(1, glm::vec3(10, 0, 0));
+
+        REQUIRE_FALSE(manager.isEntityStatic(1));
+        REQUIRE(manager.getStaticEntityCount() == 0);
+
+        auto results = manager.queryRadius(glm::vec3(10, 0, 0), 1.0f);
+        REQUIRE(results.size() == 1);
+        REQUIRE(results[0] == 1);
+    }
+
+    SECTION("Static octree rebuild preserves queryability") {
+        for (EntityID e = 1; e <= 20; ++e) {
+            manager.addEntity(e, glm::vec3(static_cast<float>(e), 0, 0), LayerMask::Environment, true);
+        }
+
+        manager.rebuildStaticOctree();
+
+        auto results = manager.queryRadius(glm::vec3(10.0f, 0, 0), 3.0f);
+        REQUIRE(results.size() >= 5); // entities 8..12 within radius 3 of x=10 (inclusive edges)
+    }
+}
+
+TEST_CASE("SimdCulling batched AABB test matches scalar frustum test", "[spatial][simd]") {
+    // Build a frustum-like plane set by hand: an axis-aligned slab plus
+    // wide-open planes, then a set of randomized planes
+    Frustum frustum;
+    frustum.planes[0] = glm::vec4(1, 0, 0, 10);   // x >= -10
+    frustum.planes[1] = glm::vec4(-1, 0, 0, 10);  // x <= 10
+    frustum.planes[2] = glm::vec4(0, 1, 0, 5);    // y >= -5
+    frustum.planes[3] = glm::vec4(0, -1, 0, 5);   // y <= 5
+    frustum.planes[4] = glm::vec4(0, 0, 1, 20);   // z >= -20
+    frustum.planes[5] = glm::vec4(0, 0, -1, 20);  // z <= 20
+    frustum.updateAbsNormals(); // required after writing planes directly
+
+    float planes[6][4];
+    for (int p = 0; p < 6; ++p) {
+        planes[p][0] = frustum.planes[p].x;
+        planes[p][1] = frustum.planes[p].y;
+        planes[p][2] = frustum.planes[p].z;
+        planes[p][3] = frustum.planes[p].w;
+    }
+
+    SECTION("Kernel agrees with Frustum::intersects for randomized boxes") {
+        std::mt19937 rng(12345);
+        std::uniform_real_distribution<float> centerDist(-30.0f, 30.0f);
+        std::uniform_real_distribution<float> extentDist(0.1f, 4.0f);
+
+        // Odd count exercises both the 4-wide SIMD body and the scalar tail
+        constexpr size_t boxCount = 101;
+        std::vector<float> minX(boxCount), minY(boxCount), minZ(boxCount);
+        std::vector<float> maxX(boxCount), maxY(boxCount), maxZ(boxCount);
+        std::vector<BoundingBox> boxes;
+        boxes.reserve(boxCount);
+
+        for (size_t i = 0; i < boxCount; ++i) {
+            glm::vec3 center(centerDist(rng), centerDist(rng), centerDist(rng));
+            glm::vec3 extent(extentDist(rng), extentDist(rng), extentDist(rng));
+            boxes.emplace_back(center - extent, center + extent);
+            minX[i] = boxes[i].min.x; minY[i] = boxes[i].min.y; minZ[i] = boxes[i].min.z;
+            maxX[i] = boxes[i].max.x; maxY[i] = boxes[i].max.y; maxZ[i] = boxes[i].max.z;
+        }
+
+        std::vector<uint8_t> visible(boxCount, 0);
+        SimdCulling::cullAABBs(planes, minX.data(), minY.data(), minZ.data(),
+                               maxX.data(), maxY.data(), maxZ.data(),
+                               boxCount, visible.data());
+
+        for (size_t i = 0; i < boxCount; ++i) {
+            bool scalar = frustum.intersects(boxes[i]);
+            REQUIRE((visible[i] != 0) == scalar);
+        }
+    }
+
+    SECTION("Octree frustum query misses no entity inside the frustum") {
+        BoundingBox worldBounds(glm::vec3(-50, -50, -50), glm::vec3(50, 50, 50));
+        SpatialManager manager(worldBounds);
+
+        std::vector<EntityID> insideEntities;
+        for (int i = 0; i < 200; ++i) {
+            float x = (i % 20) * 4.0f - 40.0f;
+            float z = (i / 20) * 4.0f - 20.0f;
+            EntityID entity = static_cast<EntityID>(i + 1);
+            manager.addEntity(entity, glm::vec3(x, 0, z), LayerMask::Creatures);
+            if (frustum.contains(glm::vec3(x, 0, z))) {
+                insideEntities.push_back(entity);
+            }
+        }
+
+        auto results = manager.queryFrustum(frustum, LayerMask::All);
+
+        REQUIRE(insideEntities.size() > 0);
+        for (EntityID entity : insideEntities) {
+            REQUIRE(std::find(results.begin(), results.end(), entity) != results.end());
+        }
+    }
+}
+
+TEST_CASE("SpatialManager zero-allocation query overloads", "[spatial][buffers]") {
+    BoundingBox worldBounds(glm::vec3(-100, -100, -100), glm::vec3(100, 100, 100));
+    SpatialManager manager(worldBounds);
+
+    for (int i = 0; i < 50; ++i) {
+        float x = (i % 10) * 2.0f - 9.0f;
+        float z = (i / 10) * 2.0f - 4.0f;
+        manager.addEntity(static_cast<EntityID>(i + 1), glm::vec3(x, 0, z), LayerMask::Creatures);
+    }
+
+    SECTION("Buffer overload appends and matches the by-value result") {
+        auto byValue = manager.queryRadius(glm::vec3(0, 0, 0), 6.0f, LayerMask::All);
+
+        std::vector<EntityID> buffer;
+        buffer.push_back(INVALID_ENTITY); // pre-existing content must survive
+        manager.queryRadius(glm::vec3(0, 0, 0), 6.0f, LayerMask::All, buffer);
+
+        REQUIRE(buffer.size() == byValue.size() + 1);
+        REQUIRE(buffer[0] == INVALID_ENTITY);
+
+        // Buffer reuse: second query appends after a clear without shrinking capacity
+        size_t capacity = buffer.capacity();
+        buffer.clear();
+        manager.queryRadius(glm::vec3(0, 0, 0), 6.0f, LayerMask::All, buffer);
+        REQUIRE(buffer.size() == byValue.size());
+        REQUIRE(buffer.capacity() == capacity);
+    }
+
+    SECTION("queryRadiusCount matches result size and honors maxCount") {
+        auto byValue = manager.queryRadius(glm::vec3(0, 0, 0), 6.0f, LayerMask::All);
+        REQUIRE(byValue.size() > 3);
+
+        REQUIRE(manager.queryRadiusCount(glm::vec3(0, 0, 0), 6.0f, LayerMask::All) == byValue.size());
+        REQUIRE(manager.queryRadiusCount(glm::vec3(0, 0, 0), 6.0f, LayerMask::All, 3) == 3);
+        REQUIRE(manager.queryRadiusCount(glm::vec3(500, 0, 0), 1.0f, LayerMask::All) == 0);
+    }
+
+    SECTION("Region buffer overload filters by position and layers") {
+        BoundingBox region(glm::vec3(-5, -1, -5), glm::vec3(5, 1, 5));
+        auto byValue = manager.queryRegion(region, LayerMask::Creatures);
+
+        std::vector<EntityID> buffer;
+        manager.queryRegion(region, LayerMask::Creatures, buffer);
+        REQUIRE(buffer.size() == byValue.size());
+
+        buffer.clear();
+        manager.queryRegion(region, LayerMask::Player, buffer);
+        REQUIRE(buffer.empty());
+    }
+}
+
+TEST_CASE("SpatialManager parallel batched radius queries", "[spatial][batch]") {
+    BoundingBox worldBounds(glm::vec3(-100, -100, -100), glm::vec3(100, 100, 100));
+    SpatialManager manager(worldBounds);
+
+    for (int i = 0; i < 300; ++i) {
+        float x = (i % 20) * 4.0f - 38.0f;
+        float z = (i / 20) * 4.0f - 28.0f;
+        manager.addEntity(static_cast<EntityID>(i + 1), glm::vec3(x, 0, z), LayerMask::Creatures);
+    }
+
+    // Enough queries to cross the parallel fan-out threshold
+    std::vector<SpatialManager::BatchedRadiusQuery> batch;
+    for (int i = 0; i < 120; ++i) {
+        SpatialManager::BatchedRadiusQuery query;
+        query.sourceEntity = static_cast<EntityID>(i + 1);
+        query.center = glm::vec3((i % 20) * 4.0f - 38.0f, 0, (i / 20) * 4.0f - 28.0f);
+        query.radius = 9.0f;
+        query.layerMask = LayerMask::All;
+        batch.push_back(query);
+    }
+
+    auto results = manager.queryRadiusBatch(batch);
+    REQUIRE(results.size() == batch.size());
+
+    // Every slot must match its query and agree with a serial query
+    // (minus the excluded source entity)
+    for (size_t i = 0; i < batch.size(); ++i) {
+        REQUIRE(results[i].sourceEntity == batch[i].sourceEntity);
+
+        auto serial = manager.queryRadius(batch[i].center, batch[i].radius, batch[i].layerMask);
+        size_t expectedCount = 0;
+        for (EntityID entity : serial) {
+            if (entity != batch[i].sourceEntity) ++expectedCount;
+        }
+        REQUIRE(results[i].nearbyEntities.size() == expectedCount);
+    }
+}
+
+TEST_CASE("SpatialManager batched queries reuse the predictive cache", "[spatial][batch][cache]") {
+    BoundingBox worldBounds(glm::vec3(-100, -100, -100), glm::vec3(100, 100, 100));
+    SpatialManager manager(worldBounds);
+
+    for (int i = 0; i < 100; ++i) {
+        float x = (i % 10) * 6.0f - 27.0f;
+        float z = (i / 10) * 6.0f - 27.0f;
+        manager.addEntity(static_cast<EntityID>(i + 1), glm::vec3(x, 0, z), LayerMask::Creatures);
+    }
+
+    // Detection-style batch: throttled creatures re-query the same
+    // centers every interval
+    std::vector<SpatialManager::BatchedRadiusQuery> batch;
+    for (int i = 0; i < 40; ++i) {
+        SpatialManager::BatchedRadiusQuery query;
+        query.sourceEntity = static_cast<EntityID>(i + 1);
+        query.center = glm::vec3((i % 10) * 6.0f - 27.0f, 0, (i / 10) * 6.0f - 27.0f);
+        query.radius = 10.0f;
+        query.layerMask = LayerMask::All;
+        batch.push_back(query);
+    }
+
+    auto coldResults = manager.queryRadiusBatch(batch);
+    auto warmResults = manager.queryRadiusBatch(batch);
+
+    SECTION("Cached repeats return identical results") {
+        REQUIRE(warmResults.size() == coldResults.size());
+        for (size_t i = 0; i < coldResults.size(); ++i) {
+            REQUIRE(warmResults[i].sourceEntity == coldResults[i].sourceEntity);
+            REQUIRE(warmResults[i].nearbyEntities == coldResults[i].nearbyEntities);
+        }
+    }
+
+    SECTION("Second batch actually hits the cache") {
+        REQUIRE(manager.getPerformanceStats().cacheHitRate > 0.0f);
+    }
+
+    SECTION("Cached entries exclude each query's own source entity") {
+        for (size_t i = 0; i < warmResults.size(); ++i) {
+            for (EntityID entity : warmResults[i].nearbyEntities) {
+                REQUIRE(entity != batch[i].sourceEntity);
+            }
+        }
+    }
+}
+
+TEST_CASE("SpatialManager best-first kNN matches brute force", "[spatial][knn]") {
+    BoundingBox worldBounds(glm::vec3(-100, -100, -100), glm::vec3(100, 100, 100));
+    SpatialManager manager(worldBounds);
+
+    std::mt19937 rng(777);
+    std::uniform_real_distribution<float> posDist(-90.0f, 90.0f);
+
+    std::vector<glm::vec3> positions;
+    positions.push_back(glm::vec3(0)); // entity IDs start at 1
+    for (int i = 1; i <= 300; ++i) {
+        glm::vec3 position(posDist(rng), posDist(rng), posDist(rng));
+        positions.push_back(position);
+        manager.addEntity(static_cast<EntityID>(i), position, LayerMask::Creatures, i % 2 == 0);
+    }
+
+    glm::vec3 queryPoint(5.0f, -3.0f, 12.0f);
+
+    SECTION("Results are the true k nearest in ascending distance order") {
+        std::vector<std::pair<float, EntityID>> bruteForce;
+        for (int i = 1; i <= 300; ++i) {
+            bruteForce.emplace_back(glm::distance(queryPoint, positions[i]), static_cast<EntityID>(i));
+        }
+        std::sort(bruteForce.begin(), bruteForce.end());
+
+        for (int k : {1, 7, 50}) {
+            auto results = manager.findNearestEntities(queryPoint, k);
+            REQUIRE(results.size() == static_cast<size_t>(k));
+            for (int i = 0; i < k; ++i) {
+                float expected = bruteForce[i].first;
+                float actual = glm::distance(queryPoint, positions[results[i]]);
+                REQUIRE(actual == Catch::Approx(expected));
+            }
+        }
+    }
+
+    SECTION("maxDistance bounds the result set") {
+        auto results = manager.findNearestEntities(queryPoint, 300, 25.0f);
+        for (EntityID entity : results) {
+            REQUIRE(glm::distance(queryPoint, positions[entity]) <= 25.0f);
+        }
+    }
+
+    SECTION("Layer filtering excludes non-matching entities") {
+        auto results = manager.findNearestEntities(queryPoint, 10, 1000.0f, LayerMask::Player);
+        REQUIRE(results.empty());
+    }
+}
+
+TEST_CASE("PredictiveSpatialCache generation-counter invalidation", "[spatial][cache]") {
+    PredictiveSpatialCache cache;
+    std::vector<EntityID> results = {1, 2, 3};
+    glm::vec3 center(10, 0, 10);
+    std::vector<EntityID> out;
+
+    cache.cacheRadiusQuery(center, 5.0f, LayerMask::All, results);
+    REQUIRE(cache.tryGetRadiusQuery(center, 5.0f, LayerMask::All, out));
+
+    SECTION("Movement far from the cached region keeps the entry valid") {
+        cache.invalidateEntityMovement(glm::vec3(500, 0, 500), glm::vec3(505, 0, 500), 5.0f);
+        out.clear();
+        REQUIRE(cache.tryGetRadiusQuery(center, 5.0f, LayerMask::All, out));
+        REQUIRE(out.size() == 3);
+    }
+
+    SECTION("Movement overlapping the cached region makes the entry stale") {
+        cache.invalidateEntityMovement(glm::vec3(8, 0, 8), glm::vec3(12, 0, 12), 5.0f);
+        out.clear();
+        REQUIRE_FALSE(cache.tryGetRadiusQuery(center, 5.0f, LayerMask::All, out));
+
+        // Re-caching after invalidation serves hits again
+        cache.cacheRadiusQuery(center, 5.0f, LayerMask::All, results);
+        out.clear();
+        REQUIRE(cache.tryGetRadiusQuery(center, 5.0f, LayerMask::All, out));
+    }
+
+    SECTION("Frustum entries track the global generation") {
+        Frustum frustum;
+        for (int p = 0; p < 6; ++p) frustum.planes[p] = glm::vec4(0, 1, 0, 1000);
+        cache.cacheFrustumQuery(frustum, LayerMask::All, results);
+        out.clear();
+        REQUIRE(cache.tryGetFrustumQuery(frustum, LayerMask::All, out));
+
+        // Any movement anywhere invalidates world-spanning entries
+        cache.invalidateEntityMovement(glm::vec3(500, 0, 500), glm::vec3(505, 0, 500), 5.0f);
+        out.clear();
+        REQUIRE_FALSE(cache.tryGetFrustumQuery(frustum, LayerMask::All, out));
+    }
+}
+
+TEST_CASE("FlatOctree layer mask aggregation prunes subtrees correctly", "[spatial][layers]") {
+    BoundingBox worldBounds(glm::vec3(-100, -100, -100), glm::vec3(100, 100, 100));
+    SpatialManager manager(worldBounds);
+
+    // Dense vegetation field that forces subdivision, plus a few creatures
+    for (int i = 0; i < 200; ++i) {
+        float x = (i % 20) * 2.0f - 19.0f;
+        float z = (i / 20) * 2.0f - 9.0f;
+        manager.addEntity(static_cast<EntityID>(i + 1), glm::vec3(x, 0, z), LayerMask::Grass, true);
+    }
+    for (int i = 0; i < 5; ++i) {
+        manager.addEntity(static_cast<EntityID>(1000 + i), glm::vec3(i * 3.0f, 1, 0), LayerMask::Creatures);
+    }
+
+    SECTION("Creature queries return only creatures despite dense vegetation") {
+        auto creatures = manager.findCreaturesInRadius(glm::vec3(0, 0, 0), 50.0f);
+        REQUIRE(creatures.size() == 5);
+    }
+
+    SECTION("Entities with no layers survive unrestricted queries") {
+        manager.addEntity(2000, glm::vec3(0, 2, 0), LayerMask::None);
+        auto all = manager.queryRadius(glm::vec3(0, 1, 0), 5.0f, LayerMask::All);
+        REQUIRE(std::find(all.begin(), all.end(), EntityID(2000)) != all.end());
+    }
+
+    SECTION("Layer changes propagate into node masks") {
+        manager.addEntity(2000, glm::vec3(0, 2, 0), LayerMask::None);
+        manager.updateEntityLayers(2000, LayerMask::Player);
+
+        auto players = manager.queryRadius(glm::vec3(0, 2, 0), 5.0f, LayerMask::Player);
+        REQUIRE(players.size() == 1);
+        REQUIRE(players[0] == EntityID(2000));
+    }
+
+    SECTION("Moving entities keep their layers in the new node path") {
+        manager.updateEntity(1000, glm::vec3(40, 1, 40));
+        auto moved = manager.queryRadius(glm::vec3(40, 1, 40), 2.0f, LayerMask::Creatures);
+        REQUIRE(moved.size() == 1);
+        REQUIRE(moved[0] == EntityID(1000));
+    }
+}
+
+TEST_CASE("SpatialManager deferred reinsertion with query epsilon", "[spatial][deferred]") {
+    BoundingBox worldBounds(glm::vec3(-100, -100, -100), glm::vec3(100, 100, 100));
+    SpatialManager manager(worldBounds);
+
+    for (int i = 0; i < 100; ++i) {
+        float x = (i % 10) * 4.0f - 18.0f;
+        float z = (i / 10) * 4.0f - 18.0f;
+        manager.addEntity(static_cast<EntityID>(i + 1), glm::vec3(x, 0, z), LayerMask::Creatures);
+    }
+
+    SECTION("Queries at the new position succeed while the move is queued") {
+        manager.updateEntity(1, glm::vec3(50, 0, 50));
+        REQUIRE(manager.getPendingUpdateCount() == 1);
+
+        auto atNew = manager.queryRadius(glm::vec3(50, 0, 50), 2.0f);
+        REQUIRE(std::find(atNew.begin(), atNew.end(), EntityID(1)) != atNew.end());
+
+        // The true-position filter keeps it out of old-position queries
+        auto atOld = manager.queryRadius(glm::vec3(-18, 0, -18), 1.0f);
+        REQUIRE(std::find(atOld.begin(), atOld.end(), EntityID(1)) == atOld.end());
+    }
+
+    SECTION("Unlimited-budget drain empties the queue") {
+        manager.updateEntity(1, glm::vec3(50, 0, 50));
+        manager.updateEntity(2, glm::vec3(-50, 0, 50));
+
+        manager.processPendingUpdates(-1.0f);
+        REQUIRE(manager.getPendingUpdateCount() == 0);
+
+        auto results = manager.queryRadius(glm::vec3(50, 0, 50), 2.0f);
+        REQUIRE(std::find(results.begin(), results.end(), EntityID(1)) != results.end());
+    }
+
+    SECTION("Removing an entity drops its queued move") {
+        manager.updateEntity(3, glm::vec3(-50, 0, -50));
+        manager.removeEntity(3);
+
+        manager.processPendingUpdates(-1.0f);
+        auto results = manager.queryRadius(glm::vec3(-50, 0, -50), 5.0f);
+        REQUIRE(std::find(results.begin(), results.end(), EntityID(3)) == results.end());
+    }
+
+    SECTION("Repeated moves of one entity coalesce into one queue slot") {
+        manager.updateEntity(4, glm::vec3(10, 0, 10));
+        manager.updateEntity(4, glm::vec3(20, 0, 20));
+        manager.updateEntity(4, glm::vec3(30, 0, 30));
+        REQUIRE(manager.getPendingUpdateCount() == 1);
+
+        auto results = manager.queryRadius(glm::vec3(30, 0, 30), 2.0f);
+        REQUIRE(std::find(results.begin(), results.end(), EntityID(4)) != results.end());
+    }
+}
+
+TEST_CASE("MortonGrid backend matches octree backend query results", "[spatial][morton]") {
+    WorldConfig octreeConfig(glm::vec3(-50, -10, -50), glm::vec3(50, 40, 50), "OctreeWorld");
+    WorldConfig mortonConfig(glm::vec3(-50, -10, -50), glm::vec3(50, 40, 50), "MortonWorld");
+    mortonConfig.spatialBackend = SpatialBackendType::MortonGrid;
+
+    SpatialManager octreeManager(octreeConfig);
+    SpatialManager mortonManager(mortonConfig);
+    REQUIRE(octreeManager.getBackendType() == SpatialBackendType::Octree);
+    REQUIRE(mortonManager.getBackendType() == SpatialBackendType::MortonGrid);
+
+    // Identical population in both managers, spanning layers, static
+    // entities, and enough inserts to exercise the grid's delta merge
+    std::vector<glm::vec3> positions;
+    for (int i = 0; i < 400; ++i) {
+        float x = ((i * 37) % 95) - 47.0f;
+        float y = ((i * 13) % 45) - 8.0f;
+        float z = ((i * 53) % 95) - 47.0f;
+        glm::vec3 pos(x, y, z);
+        positions.push_back(pos);
+        uint32_t layers = (i % 3 == 0) ? LayerMask::Creatures
+                        : (i % 3 == 1) ? LayerMask::Environment
+                                       : LayerMask::None;
+        bool isStatic = (i % 5 == 0);
+        octreeManager.addEntity(static_cast<EntityID>(i + 1), pos, layers, isStatic);
+        mortonManager.addEntity(static_cast<EntityID>(i + 1), pos, layers, isStatic);
+    }
+
+    auto sortedCopy = [](std::vector<EntityID> v) {
+        std::sort(v.begin(), v.end());
+        return v;
+    };
+
+    SECTION("Region and radius queries return the same entities") {
+        BoundingBox region(glm::vec3(-20, -5, -20), glm::vec3(20, 25, 20));
+        REQUIRE(sortedCopy(octreeManager.queryRegion(region)) ==
+                sortedCopy(mortonManager.queryRegion(region)));
+        REQUIRE(sortedCopy(octreeManager.queryRegion(region, LayerMask::Creatures)) ==
+                sortedCopy(mortonManager.queryRegion(region, LayerMask::Creatures)));
+
+        REQUIRE(sortedCopy(octreeManager.queryRadius(glm::vec3(5, 5, 5), 18.0f)) ==
+                sortedCopy(mortonManager.queryRadius(glm::vec3(5, 5, 5), 18.0f)));
+        REQUIRE(octreeManager.queryRadiusCount(glm::vec3(5, 5, 5), 18.0f) ==
+                mortonManager.queryRadiusCount(glm::vec3(5, 5, 5), 18.0f));
+    }
+
+    SECTION("Nearest-neighbor queries agree") {
+        auto octreeNearest = octreeManager.findNearestEntities(glm::vec3(0, 2, 0), 6, 60.0f);
+        auto mortonNearest = mortonManager.findNearestEntities(glm::vec3(0, 2, 0), 6, 60.0f);
+        REQUIRE(octreeNearest == mortonNearest);
+        REQUIRE(octreeManager.findNearestEntity(glm::vec3(12, 0, -7)) ==
+                mortonManager.findNearestEntity(glm::vec3(12, 0, -7)));
+    }
+
+    SECTION("Moves, removals, and layer changes stay in sync") {
+        for (int i = 1; i < 400; i += 3) {
+            if (i % 5 == 0) continue;
+            glm::vec3 pos = positions[(i + 200) % 400];
+            octreeManager.updateEntity(static_cast<EntityID>(i + 1), pos);
+            mortonManager.updateEntity(static_cast<EntityID>(i + 1), pos);
+        }
+        octreeManager.processPendingUpdates(-1.0f);
+        mortonManager.processPendingUpdates(-1.0f);
+
+        for (int i = 0; i < 400; i += 7) {
+            octreeManager.removeEntity(static_cast<EntityID>(i + 1));
+            mortonManager.removeEntity(static_cast<EntityID>(i + 1));
+        }
+
+        octreeManager.updateEntityLayers(2, LayerMask::Grass);
+        mortonManager.updateEntityLayers(2, LayerMask::Grass);
+
+        BoundingBox everything(glm::vec3(-50, -10, -50), glm::vec3(50, 40, 50));
+        REQUIRE(sortedCopy(octreeManager.queryRegion(everything)) ==
+                sortedCopy(mortonManager.queryRegion(everything)));
+        REQUIRE(sortedCopy(octreeManager.queryRadius(glm::vec3(0, 0, 0), 30.0f, LayerMask::Grass)) ==
+                sortedCopy(mortonManager.queryRadius(glm::vec3(0, 0, 0), 30.0f, LayerMask::Grass)));
+    }
+
+    SECTION("Static tier rebuild preserves grid contents") {
+        mortonManager.rebuildStaticOctree();
+        BoundingBox everything(glm::vec3(-50, -10, -50), glm::vec3(50, 40, 50));
+        REQUIRE(sortedCopy(octreeManager.queryRegion(everything)) ==
+                sortedCopy(mortonManager.queryRegion(everything)));
+    }
+}
+
+TEST_CASE("SpatialManager grows world bounds by wrapping the root", "[spatial][growth]") {
+    WorldConfig config(glm::vec3(-10, -5, -10), glm::vec3(10, 10, 10), "SmallWorld");
+    SpatialManager manager(config);
+
+    for (int i = 0; i < 40; ++i) {
+        glm::vec3 pos((i % 5) * 3.0f - 6.0f, 1.0f, ((i / 5) % 5) * 3.0f - 6.0f);
+        manager.addEntity(static_cast<EntityID>(i + 1), pos, LayerMask::Creatures, i % 4 == 0);
+    }
+
+    SECTION("Adding an entity outside bounds expands them in place") {
+        manager.addEntity(500, glm::vec3(120, 3, -90), LayerMask::Creatures);
+
+        REQUIRE(manager.getWorldBounds().contains(glm::vec3(120, 3, -90)));
+
+        auto atNew = manager.queryRadius(glm::vec3(120, 3, -90), 2.0f);
+        REQUIRE(atNew.size() == 1);
+        REQUIRE(atNew[0] == EntityID(500));
+
+        // Every pre-growth entity survived the root wrap
+        BoundingBox everything(manager.getWorldBounds());
+        REQUIRE(manager.queryRegion(everything).size() == 41);
+    }
+
+    SECTION("Movement outside bounds grows through the update path") {
+        manager.updateEntity(2, glm::vec3(-200, 0, 0));
+        manager.processPendingUpdates(-1.0f);
+
+        REQUIRE(manager.getWorldBounds().contains(glm::vec3(-200, 0, 0)));
+        auto moved = manager.queryRadius(glm::vec3(-200, 0, 0), 1.0f);
+        REQUIRE(moved.size() == 1);
+        REQUIRE(moved[0] == EntityID(2));
+    }
+
+    SECTION("Wrapped subtree still answers layer-filtered and kNN queries") {
+        manager.addEntity(500, glm::vec3(120, 3, -90), LayerMask::Grass);
+
+        auto creatures = manager.queryRadius(glm::vec3(0, 1, 0), 15.0f, LayerMask::Creatures);
+        REQUIRE(creatures.size() == 40);
+        REQUIRE(manager.queryRadius(glm::vec3(120, 3, -90), 2.0f, LayerMask::Creatures).empty());
+
+        auto nearest = manager.findNearestEntities(glm::vec3(120, 3, -90), 1, 500.0f);
+        REQUIRE(nearest.size() == 1);
+        REQUIRE(nearest[0] == EntityID(500));
+    }
+
+    SECTION("MortonGrid backend grows to identical bounds") {
+        WorldConfig mortonConfig(glm::vec3(-10, -5, -10), glm::vec3(10, 10, 10), "SmallMorton");
+        mortonConfig.spatialBackend = SpatialBackendType::MortonGrid;
+        SpatialManager mortonManager(mortonConfig);
+
+        mortonManager.addEntity(1, glm::vec3(0, 1, 0), LayerMask::Creatures);
+        mortonManager.addEntity(2, glm::vec3(120, 3, -90), LayerMask::Creatures);
+        manager.addEntity(500, glm::vec3(120, 3, -90), LayerMask::Creatures);
+
+        REQUIRE(mortonManager.getWorldBounds().min.x == manager.getWorldBounds().min.x);
+        REQUIRE(mortonManager.getWorldBounds().max.z == manager.getWorldBounds().max.z);
+        auto found = mortonManager.queryRadius(glm::vec3(120, 3, -90), 2.0f);
+        REQUIRE(found.size() == 1);
+        REQUIRE(found[0] == EntityID(2));
+    }
+}
+
+TEST_CASE("SpatialManager persistent queries deliver enter/exit deltas", "[spatial][persistent]") {
+    BoundingBox worldBounds(glm::vec3(-50, -50, -50), glm::vec3(50, 50, 50));
+    SpatialManager spatialManager(worldBounds);
+
+    auto contains = [](const std::vector<EntityID>& list, EntityID entity) {
+        return std::find(list.begin(), list.end(), entity) != list.end();
+    };
+
+    SECTION("First refresh reports existing entities as entered") {
+        spatialManager.addEntity(EntityID(1), glm::vec3(0, 0, 0));
+        spatialManager.addEntity(EntityID(2), glm::vec3(30, 0, 0));
+
+        auto handle = spatialManager.registerRadiusQuery(glm::vec3(0, 0, 0), 10.0f);
+        spatialManager.refreshPersistentQueries();
+
+        const auto* delta = spatialManager.getPersistentQueryDelta(handle);
+        REQUIRE(delta != nullptr);
+        REQUIRE(delta->entered.size() == 1);
+        CHECK(contains(delta->entered, EntityID(1)));
+        CHECK(delta->exited.empty());
+    }
+
+    SECTION("Stable frames produce empty deltas, movement produces events") {
+        spatialManager.addEntity(EntityID(1), glm::vec3(0, 0, 0));
+        auto handle = spatialManager.registerRadiusQuery(glm::vec3(0, 0, 0), 10.0f);
+        spatialManager.refreshPersistentQueries();
+
+        // Nothing changed: the delta must be empty, not a re-report
+        spatialManager.refreshPersistentQueries();
+        const auto* delta = spatialManager.getPersistentQueryDelta(handle);
+        CHECK(delta->entered.empty());
+        CHECK(delta->exited.empty());
+
+        // Entity walks out of range
+        spatialManager.updateEntity(EntityID(1), glm::vec3(25, 0, 0));
+        spatialManager.processPendingUpdates(-1.0f);
+        spatialManager.refreshPersistentQueries();
+        delta = spatialManager.getPersistentQueryDelta(handle);
+        CHECK(delta->entered.empty());
+        REQUIRE(delta->exited.size() == 1);
+        CHECK(contains(delta->exited, EntityID(1)));
+
+        // And back in
+        spatialManager.updateEntity(EntityID(1), glm::vec3(2, 0, 0));
+        spatialManager.processPendingUpdates(-1.0f);
+        spatialManager.refreshPersistentQueries();
+        delta = spatialManager.getPersistentQueryDelta(handle);
+        REQUIRE(delta->entered.size() == 1);
+        CHECK(contains(delta->entered, EntityID(1)));
+    }
+
+    SECTION("Deltas track churn even before deferred moves commit") {
+        spatialManager.addEntity(EntityID(1), glm::vec3(0, 0, 0));
+        auto handle = spatialManager.registerRadiusQuery(glm::vec3(0, 0, 0), 10.0f);
+        spatialManager.refreshPersistentQueries();
+
+        // Queue the move but do not commit it into the octree; the
+        // membership test uses true positions so the exit still fires
+        spatialManager.updateEntity(EntityID(1), glm::vec3(25, 0, 0));
+        spatialManager.refreshPersistentQueries();
+        const auto* delta = spatialManager.getPersistentQueryDelta(handle);
+        REQUIRE(delta->exited.size() == 1);
+    }
+
+    SECTION("Moving the query volume re-executes and diffs") {
+        spatialManager.addEntity(EntityID(1), glm::vec3(0, 0, 0));
+        spatialManager.addEntity(EntityID(2), glm::vec3(30, 0, 0));
+        auto handle = spatialManager.registerRadiusQuery(glm::vec3(0, 0, 0), 10.0f);
+        spatialManager.refreshPersistentQueries();
+
+        spatialManager.moveRadiusQuery(handle, glm::vec3(30, 0, 0));
+        spatialManager.refreshPersistentQueries();
+
+        const auto* delta = spatialManager.getPersistentQueryDelta(handle);
+        REQUIRE(delta->entered.size() == 1);
+        CHECK(contains(delta->entered, EntityID(2)));
+        REQUIRE(delta->exited.size() == 1);
+        CHECK(contains(delta->exited, EntityID(1)));
+
+        const auto* inside = spatialManager.getPersistentQueryResults(handle);
+        REQUIRE(inside != nullptr);
+        CHECK(inside->size() == 1);
+        CHECK(inside->count(EntityID(2)) == 1);
+    }
+
+    SECTION("Removal and layer changes flip membership") {
+        spatialManager.addEntity(EntityID(1), glm::vec3(0, 0, 0), LayerMask::Creatures);
+        auto handle = spatialManager.registerRadiusQuery(glm::vec3(0, 0, 0), 10.0f, LayerMask::Creatures);
+        spatialManager.refreshPersistentQueries();
+
+        // Layer change moves the entity off the query's mask
+        spatialManager.updateEntityLayers(EntityID(1), LayerMask::Environment);
+        spatialManager.refreshPersistentQueries();
+        const auto* delta = spatialManager.getPersistentQueryDelta(handle);
+        REQUIRE(delta->exited.size() == 1);
+
+        spatialManager.updateEntityLayers(EntityID(1), LayerMask::Creatures);
+        spatialManager.refreshPersistentQueries();
+        delta = spatialManager.getPersistentQueryDelta(handle);
+        REQUIRE(delta->entered.size() == 1);
+
+        spatialManager.removeEntity(EntityID(1));
+        spatialManager.refreshPersistentQueries();
+        delta = spatialManager.getPersistentQueryDelta(handle);
+        REQUIRE(delta->exited.size() == 1);
+    }
+
+    SECTION("Persistent frustum query tracks entities crossing planes") {
+        Frustum frustum;
+        // Axis-aligned box frustum around the origin: x/y/z in [-10, 10]
+        frustum.planes[0] = glm::vec4(1, 0, 0, 10);    // left
+        frustum.planes[1] = glm::vec4(-1, 0, 0, 10);   // right
+        frustum.planes[2] = glm::vec4(0, 1, 0, 10);    // bottom
+        frustum.planes[3] = glm::vec4(0, -1, 0, 10);   // top
+        frustum.planes[4] = glm::vec4(0, 0, 1, 10);    // near
+        frustum.planes[5] = glm::vec4(0, 0, -1, 10);   // far
+        frustum.updateAbsNormals();
+
+        spatialManager.addEntity(EntityID(1), glm::vec3(0, 0, 0));
+        auto handle = spatialManager.registerFrustumQuery(frustum);
+        spatialManager.refreshPersistentQueries();
+
+        const auto* delta = spatialManager.getPersistentQueryDelta(handle);
+        REQUIRE(delta->entered.size() == 1);
+
+        spatialManager.updateEntity(EntityID(1), glm::vec3(20, 0, 0));
+        spatialManager.processPendingUpdates(-1.0f);
+        spatialManager.refreshPersistentQueries();
+        delta = spatialManager.getPersistentQueryDelta(handle);
+        REQUIRE(delta->exited.size() == 1);
+    }
+
+    SECTION("Unregistered handles return null views") {
+        auto handle = spatialManager.registerRadiusQuery(glm::vec3(0), 5.0f);
+        spatialManager.unregisterPersistentQuery(handle);
+        CHECK(spatialManager.getPersistentQueryDelta(handle) == nullptr);
+        CHECK(spatialManager.getPersistentQueryResults(handle) == nullptr);
+        CHECK(spatialManager.getPersistentQueryCount() == 0);
+    }
+}
+
+TEST_CASE("SpatialManager spatial order clusters nearby entities", "[spatial][compaction]") {
+    BoundingBox worldBounds(glm::vec3(-100, -100, -100), glm::vec3(100, 100, 100));
+    SpatialManager manager(worldBounds);
+
+    SECTION("Two far-apart clusters come out contiguous") {
+        // Interleave insertions so creation order carries no locality
+        manager.addEntity(1, glm::vec3(-90, -90, -90));   // cluster A (near bounds min)
+        manager.addEntity(2, glm::vec3(90, 90, 90));      // cluster B (near bounds max)
+        manager.addEntity(3, glm::vec3(-89, -90, -90));   // A
+        manager.addEntity(4, glm::vec3(89, 90, 90));      // B
+        manager.addEntity(5, glm::vec3(-90, -89, -90));   // A
+        manager.addEntity(6, glm::vec3(90, 89, 90));      // B
+
+        std::vector<EntityID> order = manager.getEntitiesInSpatialOrder();
+        REQUIRE(order.size() == 6);
+
+        // Morton codes are monotone per axis: everything in the min
+        // corner sorts before everything in the max corner
+        auto isClusterA = [](EntityID entity) { return entity % 2 == 1; };
+        REQUIRE(isClusterA(order[0]));
+        REQUIRE(isClusterA(order[1]));
+        REQUIRE(isClusterA(order[2]));
+        REQUIRE_FALSE(isClusterA(order[3]));
+        REQUIRE_FALSE(isClusterA(order[4]));
+        REQUIRE_FALSE(isClusterA(order[5]));
+    }
+
+    SECTION("Order is deterministic across calls") {
+        manager.addEntity(10, glm::vec3(5, 0, 5));
+        manager.addEntity(11, glm::vec3(5, 0, 5));  // identical position - ID breaks the tie
+        manager.addEntity(12, glm::vec3(-5, 0, -5));
+
+        std::vector<EntityID> first = manager.getEntitiesInSpatialOrder();
+        std::vector<EntityID> second = manager.getEntitiesInSpatialOrder();
+        REQUIRE(first == second);
+        REQUIRE(first.size() == 3);
+    }
+
+    SECTION("Empty manager yields an empty order") {
+        REQUIRE(manager.getEntitiesInSpatialOrder().empty());
+    }
+}
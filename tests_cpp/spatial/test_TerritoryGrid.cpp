@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/spatial/TerritoryGrid.h"
+
+using namespace VulkanMon;
+
+TEST_CASE("TerritoryGrid claim lookup", "[TerritoryGrid][Spatial]") {
+    TerritoryGrid grid;
+
+    SECTION("Claimants at a position respect the territory circle") {
+        grid.assign(1, glm::vec3(0.0f, 0.0f, 0.0f), 10.0f);
+        grid.assign(2, glm::vec3(50.0f, 0.0f, 0.0f), 10.0f);
+
+        std::vector<EntityID> claimants;
+        grid.claimantsAt(glm::vec3(5.0f, 0.0f, 5.0f), claimants);
+        REQUIRE(claimants.size() == 1);
+        REQUIRE(claimants[0] == 1);
+
+        claimants.clear();
+        grid.claimantsAt(glm::vec3(25.0f, 0.0f, 0.0f), claimants);
+        REQUIRE(claimants.empty());
+    }
+
+    SECTION("Lookup ignores the Y axis - territories are XZ ranges") {
+        grid.assign(1, glm::vec3(0.0f, 0.0f, 0.0f), 10.0f);
+
+        std::vector<EntityID> claimants;
+        grid.claimantsAt(glm::vec3(3.0f, 100.0f, 3.0f), claimants);
+        REQUIRE(claimants.size() == 1);
+    }
+
+    SECTION("Overlapping territories at one position all report") {
+        grid.assign(1, glm::vec3(0.0f), 20.0f);
+        grid.assign(2, glm::vec3(15.0f, 0.0f, 0.0f), 20.0f);
+
+        std::vector<EntityID> claimants;
+        grid.claimantsAt(glm::vec3(7.0f, 0.0f, 0.0f), claimants);
+        REQUIRE(claimants.size() == 2);
+    }
+}
+
+TEST_CASE("TerritoryGrid overlap queries", "[TerritoryGrid][Spatial]") {
+    TerritoryGrid grid;
+    grid.assign(1, glm::vec3(0.0f), 15.0f);
+    grid.assign(2, glm::vec3(100.0f, 0.0f, 100.0f), 15.0f);
+
+    SECTION("Circle-circle intersection reports only touching territories") {
+        std::vector<EntityID> overlaps;
+        grid.overlapping(glm::vec3(25.0f, 0.0f, 0.0f), 12.0f, overlaps);
+        REQUIRE(overlaps.size() == 1);
+        REQUIRE(overlaps[0] == 1);
+    }
+
+    SECTION("Results are deduplicated for territories spanning many cells") {
+        // Radius far larger than the cell size registers in many buckets
+        grid.assign(3, glm::vec3(0.0f), 100.0f);
+
+        std::vector<EntityID> overlaps;
+        grid.overlapping(glm::vec3(0.0f), 150.0f, overlaps);
+        REQUIRE(std::count(overlaps.begin(), overlaps.end(), 3) == 1);
+    }
+}
+
+TEST_CASE("TerritoryGrid incremental maintenance", "[TerritoryGrid][Spatial]") {
+    TerritoryGrid grid;
+
+    SECTION("Reassignment moves the claim to the new home") {
+        grid.assign(1, glm::vec3(0.0f), 10.0f);
+        grid.assign(1, glm::vec3(200.0f, 0.0f, 200.0f), 10.0f);
+        REQUIRE(grid.territoryCount() == 1);
+
+        std::vector<EntityID> claimants;
+        grid.claimantsAt(glm::vec3(0.0f), claimants);
+        REQUIRE(claimants.empty());
+
+        grid.claimantsAt(glm::vec3(200.0f, 0.0f, 200.0f), claimants);
+        REQUIRE(claimants.size() == 1);
+    }
+
+    SECTION("Unchanged reassignment is a no-op") {
+        grid.assign(1, glm::vec3(5.0f, 0.0f, 5.0f), 10.0f);
+        grid.assign(1, glm::vec3(5.0f, 0.0f, 5.0f), 10.0f);
+        REQUIRE(grid.territoryCount() == 1);
+
+        std::vector<EntityID> claimants;
+        grid.claimantsAt(glm::vec3(5.0f, 0.0f, 5.0f), claimants);
+        REQUIRE(claimants.size() == 1);
+    }
+
+    SECTION("Removal clears every bucket the territory touched") {
+        grid.assign(1, glm::vec3(0.0f), 80.0f);
+        grid.remove(1);
+        REQUIRE(grid.territoryCount() == 0);
+        REQUIRE_FALSE(grid.contains(1));
+
+        std::vector<EntityID> claimants;
+        grid.claimantsAt(glm::vec3(40.0f, 0.0f, 40.0f), claimants);
+        REQUIRE(claimants.empty());
+    }
+}
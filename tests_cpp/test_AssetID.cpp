@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/AssetID.h"
+#include "../src/components/Renderable.h"
+
+using namespace VulkanMon;
+
+TEST_CASE("AssetID interning", "[AssetID][Core]") {
+    SECTION("Same path always yields the same handle") {
+        AssetID first = AssetID::intern("assets/models/cube.obj");
+        AssetID second = AssetID::intern("assets/models/cube.obj");
+
+        REQUIRE(first == second);
+        REQUIRE(first.valid());
+    }
+
+    SECTION("Distinct paths yield distinct handles") {
+        AssetID cube = AssetID::intern("assets/models/cube.obj");
+        AssetID sphere = AssetID::intern("assets/models/sphere.obj");
+
+        REQUIRE(cube != sphere);
+    }
+
+    SECTION("Handles round-trip back to their string") {
+        AssetID id = AssetID::intern("assets/models/pyramid.obj");
+
+        REQUIRE(id.str() == "assets/models/pyramid.obj");
+    }
+
+    SECTION("Empty string maps to the invalid handle") {
+        AssetID empty = AssetID::intern("");
+
+        REQUIRE_FALSE(empty.valid());
+        REQUIRE(empty == AssetID{});
+        REQUIRE(empty.str().empty());
+    }
+}
+
+TEST_CASE("Renderable mesh handle stays usable", "[AssetID][Core]") {
+    SECTION("Constructor interns the mesh path") {
+        Renderable renderable("test_mesh.obj");
+
+        REQUIRE(renderable.meshId.valid());
+        REQUIRE(renderable.meshId.str() == "test_mesh.obj");
+    }
+
+    SECTION("setMesh keeps path and handle in sync") {
+        Renderable renderable("test_mesh.obj");
+        renderable.setMesh("other_mesh.obj");
+
+        REQUIRE(renderable.meshPath() == "other_mesh.obj");
+        REQUIRE(renderable.meshId.str() == "other_mesh.obj");
+    }
+
+    SECTION("Path strings resolve from the intern table") {
+        // The component carries only handles; the strings live in the
+        // AssetID table and resolve on demand
+        Renderable renderable("hot_cold.obj", "hot_cold.png");
+
+        REQUIRE(renderable.meshPath() == "hot_cold.obj");
+        REQUIRE(renderable.texturePath() == "hot_cold.png");
+
+        Renderable empty;
+        REQUIRE_FALSE(empty.meshId.valid());
+        REQUIRE(empty.meshPath().empty());
+    }
+}
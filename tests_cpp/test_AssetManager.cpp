@@ -425,4 +425,158 @@ TEST_CASE("AssetManager Cache Management", "[AssetManager][Cache]") {
         // Test cache count
         REQUIRE(mockTextures.size() == 4);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("AsyncTextureLoad Handle Behavior", "[AssetManager][Async]") {
+    SECTION("Default handle is never ready and never fails") {
+        VulkanMon::AsyncTextureLoad handle;
+
+        REQUIRE_FALSE(handle.isReady());
+        REQUIRE_FALSE(handle.hasFailed());
+        REQUIRE(handle.get() == nullptr);
+    }
+
+    SECTION("Placeholder resolves to the default bindless texture") {
+        // While a load is in flight (or after failure), draws fall back
+        // to bindless slot 0 - the default texture - so nothing renders
+        // untextured or waits on the loader pool
+        VulkanMon::AsyncTextureLoad handle;
+
+        REQUIRE(handle.getBindlessIndex() == 0);
+    }
+}
+
+TEST_CASE("AssetPack Path Hashing and Round Trip", "[AssetManager][AssetPack]") {
+    SECTION("Path normalization folds Windows separators") {
+        REQUIRE(AssetPack::normalizePath("textures\\grass.png") == "textures/grass.png");
+        REQUIRE(AssetPack::normalizePath("textures/grass.png") == "textures/grass.png");
+    }
+
+    SECTION("Hashing is stable and separator-insensitive after normalization") {
+        std::string windows = AssetPack::normalizePath("models\\creature.obj");
+        std::string posix = AssetPack::normalizePath("models/creature.obj");
+        REQUIRE(AssetPack::hashPath(windows) == AssetPack::hashPath(posix));
+        REQUIRE(AssetPack::hashPath("a") != AssetPack::hashPath("b"));
+    }
+
+    SECTION("A built pack serves back its files byte-for-byte") {
+        namespace fs = std::filesystem;
+        fs::path root = fs::temp_directory_path() / "vkmon_pack_test";
+        fs::create_directories(root / "textures");
+        {
+            std::ofstream out(root / "textures" / "a.bin", std::ios::binary);
+            out << "pokemon";
+        }
+        fs::path packPath = fs::temp_directory_path() / "vkmon_pack_test.vkpack";
+
+        REQUIRE(AssetPack::buildFromDirectory(root.string(), packPath.string()));
+
+        AssetPack pack;
+        REQUIRE(pack.open(packPath.string()));
+        REQUIRE(pack.entryCount() == 1);
+        REQUIRE(pack.contains("textures/a.bin"));
+        REQUIRE_FALSE(pack.contains("textures/missing.bin"));
+
+        size_t size = 0;
+        const unsigned char* data = pack.find("textures/a.bin", size);
+        REQUIRE(data != nullptr);
+        REQUIRE(size == 7);
+        REQUIRE(std::string(reinterpret_cast<const char*>(data), size) == "pokemon");
+
+        pack = AssetPack{};
+        fs::remove_all(root);
+        fs::remove(packPath);
+    }
+
+    SECTION("Garbage files refuse to mount") {
+        namespace fs = std::filesystem;
+        fs::path bogus = fs::temp_directory_path() / "vkmon_bogus.vkpack";
+        {
+            std::ofstream out(bogus, std::ios::binary);
+            out << "not a pack at all";
+        }
+        AssetPack pack;
+        REQUIRE_FALSE(pack.open(bogus.string()));
+        REQUIRE_FALSE(pack.isOpen());
+        fs::remove(bogus);
+    }
+}
+
+TEST_CASE("Texture Memory Budget Design", "[AssetManager][Budget]") {
+    SECTION("LoadedTexture carries LRU bookkeeping") {
+        // The cache evicts unreferenced textures oldest-use first; both
+        // fields must be atomics since cache hits bump them under a
+        // shared (read) lock
+        REQUIRE(std::is_same_v<decltype(LoadedTexture::referenceCount), std::atomic<size_t>>);
+        REQUIRE(std::is_same_v<decltype(LoadedTexture::lastUsedTick), std::atomic<uint64_t>>);
+    }
+
+    SECTION("Budget accounting uses decoded RGBA size") {
+        // Eviction compares width * height * 4 against the budget, the
+        // same formula getTotalTextureMemory reports
+        uint32_t width = 2048, height = 2048;
+        size_t expected = static_cast<size_t>(width) * height * 4;
+        REQUIRE(expected == 16 * 1024 * 1024);
+    }
+
+    SECTION("Zero budget means unlimited") {
+        // Default behavior is unchanged: no budget, no eviction
+        REQUIRE(std::is_member_function_pointer_v<decltype(&AssetManager::setTextureMemoryBudget)>);
+        REQUIRE(std::is_member_function_pointer_v<decltype(&AssetManager::getTextureMemoryBudget)>);
+    }
+}
+
+TEST_CASE("Distance-Based Texture Streaming Design", "[AssetManager][Streaming]") {
+    SECTION("Tier mapping is monotonic with distance") {
+        REQUIRE(AssetManager::mipDropForDistance(0.0f) == 0);
+        REQUIRE(AssetManager::mipDropForDistance(AssetManager::STREAM_NEAR_DISTANCE - 1.0f) == 0);
+        REQUIRE(AssetManager::mipDropForDistance(AssetManager::STREAM_NEAR_DISTANCE) == 1);
+        REQUIRE(AssetManager::mipDropForDistance(AssetManager::STREAM_MID_DISTANCE) == 2);
+        REQUIRE(AssetManager::mipDropForDistance(AssetManager::STREAM_FAR_DISTANCE) == 3);
+        REQUIRE(AssetManager::mipDropForDistance(1000.0f) == 3);
+
+        // Each halving quarters memory: three drops leave 1/64 resident
+        // for the farthest tier
+        uint32_t farDrop = AssetManager::mipDropForDistance(200.0f);
+        REQUIRE((1u << (2 * farDrop)) == 64);
+    }
+
+    SECTION("Each mip tier is its own cache entry") {
+        TextureLoadInfo full("creature.png");
+        TextureLoadInfo dropped("creature.png");
+        dropped.mipDrop = 2;
+
+        REQUIRE(full.cacheKey() == "creature.png");
+        REQUIRE(dropped.cacheKey() == "creature.png#drop2");
+        REQUIRE(full.cacheKey() != dropped.cacheKey());
+
+        // The file on disk is the same either way - only the decode differs
+        REQUIRE(full.filename == dropped.filename);
+    }
+}
+
+TEST_CASE("Compressed Texture Variant Paths", "[AssetManager][Compressed]") {
+    SECTION("Source extensions map to .ktx2 siblings") {
+        REQUIRE(AssetManager::compressedVariantPath("creature.png") == "creature.ktx2");
+        REQUIRE(AssetManager::compressedVariantPath("textures/grass.jpg") == "textures/grass.ktx2");
+
+        // The cooked file lives next to its source, so pack lookups and
+        // loose-file lookups both resolve through the same relative path
+        REQUIRE(AssetManager::compressedVariantPath("a/b/rock.png") == "a/b/rock.ktx2");
+    }
+
+    SECTION("Dots in directory names are not extensions") {
+        REQUIRE(AssetManager::compressedVariantPath("pack.v2/leaf.png") == "pack.v2/leaf.ktx2");
+        REQUIRE(AssetManager::compressedVariantPath("pack.v2/leaf") == "pack.v2/leaf.ktx2");
+        REQUIRE(AssetManager::compressedVariantPath("noextension") == "noextension.ktx2");
+    }
+
+    SECTION("Compressed loads keep full cache identity") {
+        // The cache key stays the source filename: callers ask for
+        // "creature.png" and transparently get the BC variant when cooked.
+        // Streaming tiers (mipDrop > 0) always use the RGBA path, so the
+        // same key never aliases two formats.
+        TextureLoadInfo info("creature.png");
+        REQUIRE(info.cacheKey() == "creature.png");
+        REQUIRE(info.mipDrop == 0);
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ * VulkanMon AssetWatcher Unit Tests
+ *
+ * Tests for the asset hot-reload file watcher focusing on:
+ * - Watched-file filtering (directories and derived-file extensions)
+ * - Change detection with the one-cycle write-time debounce
+ * - Baseline seeding (startup never reports the existing tree)
+ *
+ * Scans are driven synchronously through pollOnce() so the debounce is
+ * deterministic - the background thread is never started here.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "../src/io/AssetWatcher.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace VulkanMon;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Temporary assets tree, removed on destruction
+struct TempAssetsDir {
+    fs::path root;
+
+    TempAssetsDir() {
+        root = fs::temp_directory_path() / "vulkanmon_watcher_test";
+        fs::remove_all(root);
+        fs::create_directories(root / "textures");
+        fs::create_directories(root / "models");
+    }
+
+    ~TempAssetsDir() {
+        std::error_code ec;
+        fs::remove_all(root, ec);
+    }
+
+    void writeFile(const std::string& relativePath, const std::string& contents) {
+        std::ofstream file(root / relativePath, std::ios::binary);
+        file << contents;
+    }
+
+    // Bump the file's write time explicitly so the test never depends on
+    // filesystem timestamp granularity
+    void touchFile(const std::string& relativePath, int secondsForward) {
+        auto path = root / relativePath;
+        auto current = fs::last_write_time(path);
+        fs::last_write_time(path, current + std::chrono::seconds(secondsForward));
+    }
+};
+
+} // namespace
+
+TEST_CASE("AssetWatcher file filtering", "[AssetWatcher][Filter]") {
+    SECTION("Textures and models are watched") {
+        REQUIRE(AssetWatcher::isWatchedFile("textures/creature.png"));
+        REQUIRE(AssetWatcher::isWatchedFile("models/creature.obj"));
+        REQUIRE(AssetWatcher::isWatchedFile("textures/terrain/grass.jpg"));
+    }
+
+    SECTION("Other asset directories are not watched") {
+        REQUIRE_FALSE(AssetWatcher::isWatchedFile("shaders/triangle.vert"));
+        REQUIRE_FALSE(AssetWatcher::isWatchedFile("audio/cry.wav"));
+        REQUIRE_FALSE(AssetWatcher::isWatchedFile("creature.png"));
+    }
+
+    SECTION("Derived and transient files are ignored") {
+        // Cooked sidecars and compiled shaders are written by the engine;
+        // watching them would reload every model twice
+        REQUIRE_FALSE(AssetWatcher::isWatchedFile("models/creature.obj.vkmesh"));
+        REQUIRE_FALSE(AssetWatcher::isWatchedFile("textures/creature.spv"));
+        REQUIRE_FALSE(AssetWatcher::isWatchedFile("textures/creature.png.tmp"));
+    }
+}
+
+TEST_CASE("AssetWatcher change detection", "[AssetWatcher][Polling]") {
+    TempAssetsDir assets;
+    assets.writeFile("textures/creature.png", "pixels-v1");
+    assets.writeFile("models/creature.obj", "mesh-v1");
+
+    AssetWatcher watcher(assets.root.string());
+
+    SECTION("Baseline scan reports nothing") {
+        watcher.pollOnce();
+        REQUIRE(watcher.drainChanges().empty());
+
+        // Stable follow-up scans stay quiet too
+        watcher.pollOnce();
+        REQUIRE(watcher.drainChanges().empty());
+    }
+
+    SECTION("A modified file is reported after its write time settles") {
+        watcher.pollOnce();  // baseline
+        assets.touchFile("textures/creature.png", 10);
+
+        // First sighting of the new write time: debounced, not reported
+        watcher.pollOnce();
+        REQUIRE(watcher.drainChanges().empty());
+
+        // Write time held for a full cycle: reported once
+        watcher.pollOnce();
+        auto changes = watcher.drainChanges();
+        REQUIRE(changes.size() == 1);
+        REQUIRE(changes[0] == "textures/creature.png");
+
+        // Drained and stable: no repeat reports
+        watcher.pollOnce();
+        REQUIRE(watcher.drainChanges().empty());
+    }
+
+    SECTION("A file still being written keeps waiting") {
+        watcher.pollOnce();  // baseline
+        assets.touchFile("models/creature.obj", 10);
+        watcher.pollOnce();
+        assets.touchFile("models/creature.obj", 20);  // save still in progress
+        watcher.pollOnce();
+        REQUIRE(watcher.drainChanges().empty());
+
+        watcher.pollOnce();  // now stable
+        auto changes = watcher.drainChanges();
+        REQUIRE(changes.size() == 1);
+        REQUIRE(changes[0] == "models/creature.obj");
+    }
+
+    SECTION("A file added after baseline is reported once stable") {
+        watcher.pollOnce();  // baseline
+        assets.writeFile("textures/new_texture.png", "pixels");
+
+        watcher.pollOnce();  // debounce cycle
+        watcher.pollOnce();  // stable
+        auto changes = watcher.drainChanges();
+        REQUIRE(changes.size() == 1);
+        REQUIRE(changes[0] == "textures/new_texture.png");
+    }
+
+    SECTION("A deleted file is forgotten without a report") {
+        watcher.pollOnce();  // baseline
+        fs::remove(assets.root / "textures/creature.png");
+
+        watcher.pollOnce();
+        watcher.pollOnce();
+        REQUIRE(watcher.drainChanges().empty());
+    }
+}
@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+#include "benchmarks/BenchHarness.h"
+#include "benchmarks/BenchScenes.h"
+#include <cstdio>
+
+using namespace VulkanMon::Bench;
+
+TEST_CASE("BenchHarness JSON round trip", "[Bench][Performance]") {
+    std::vector<BenchResult> results;
+    BenchResult first;
+    first.name = "query_a";
+    first.samples = 100;
+    first.minMs = 0.5;
+    first.medianMs = 1.25;
+    first.p99Ms = 3.0;
+    first.meanMs = 1.4;
+    results.push_back(first);
+
+    BenchResult second;
+    second.name = "query_b";
+    second.samples = 100;
+    second.medianMs = 4.5;
+    results.push_back(second);
+
+    const std::string path = "bench_roundtrip_test.json";
+    REQUIRE(BenchHarness::writeJson(path, "linux-gcc-debug", results));
+
+    BenchHarness::Baseline baseline;
+    REQUIRE(BenchHarness::loadBaseline(path, baseline));
+    REQUIRE(baseline.profile == "linux-gcc-debug");
+    REQUIRE(baseline.medianMsByName.size() == 2);
+    REQUIRE(baseline.medianMsByName.at("query_a") == 1.25);
+    REQUIRE(baseline.medianMsByName.at("query_b") == 4.5);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("BenchHarness baseline comparison", "[Bench][Performance]") {
+    BenchHarness::Baseline baseline;
+    baseline.profile = "linux-gcc-debug";
+    baseline.medianMsByName["stable"] = 1.0;
+    baseline.medianMsByName["regressed"] = 1.0;
+    baseline.medianMsByName["improved"] = 1.0;
+
+    std::vector<BenchResult> results(4);
+    results[0].name = "stable";
+    results[0].medianMs = 1.05;   // +5%, inside tolerance
+    results[1].name = "regressed";
+    results[1].medianMs = 1.25;   // +25%, regression
+    results[2].name = "improved";
+    results[2].medianMs = 0.6;    // faster, never a failure
+    results[3].name = "brand_new";
+    results[3].medianMs = 9.0;    // no baseline entry, never a failure
+
+    int regressions = BenchHarness::compareAgainstBaseline(results, baseline, 10.0);
+    REQUIRE(regressions == 1);
+
+    // A tight tolerance flags the 5% drift too
+    REQUIRE(BenchHarness::compareAgainstBaseline(results, baseline, 1.0) == 2);
+}
+
+TEST_CASE("BenchHarness machine profile", "[Bench][Performance]") {
+    std::string profile = BenchHarness::machineProfile();
+
+    // platform-compiler-buildtype, all three parts present
+    REQUIRE_FALSE(profile.empty());
+    size_t firstDash = profile.find('-');
+    size_t secondDash = profile.find('-', firstDash + 1);
+    REQUIRE(firstDash != std::string::npos);
+    REQUIRE(secondDash != std::string::npos);
+    REQUIRE(secondDash + 1 < profile.size());
+}
+
+TEST_CASE("BenchHarness statistical run", "[Bench][Performance]") {
+    BenchHarness harness;
+    int invocations = 0;
+    harness.add("counter", [&invocations]() { invocations++; }, 5, 20);
+
+    auto results = harness.runAll();
+    REQUIRE(results.size() == 1);
+    REQUIRE(results[0].name == "counter");
+    REQUIRE(results[0].samples == 20);
+    REQUIRE(invocations == 25); // warmup + samples
+
+    // Sorted statistics preserve ordering invariants
+    REQUIRE(results[0].minMs <= results[0].medianMs);
+    REQUIRE(results[0].medianMs <= results[0].p99Ms);
+}
+
+TEST_CASE("Bench scene registry", "[Bench][Performance]") {
+    REQUIRE_FALSE(allScenes().empty());
+
+    for (const SceneSpec& scene : allScenes()) {
+        // Every listed scene resolves back to itself by name
+        REQUIRE(findScene(scene.name) == &scene);
+
+        // Generators divide creatures across species and need room to spawn
+        REQUIRE(scene.creatureCount > 0);
+        REQUIRE(scene.speciesCount > 0);
+        REQUIRE(scene.worldExtent > scene.cameraOrbitRadius * 0.5f);
+
+        // The scene's world config must contain the spawn area
+        WorldConfig config = worldConfigForScene(scene);
+        REQUIRE(config.minBounds.x <= -scene.worldExtent);
+        REQUIRE(config.maxBounds.x >= scene.worldExtent);
+    }
+
+    REQUIRE(findScene("no_such_scene") == nullptr);
+}
@@ -0,0 +1,112 @@
+/*
+ * VulkanMon CharacterControllerSystem Unit Tests
+ *
+ * Tests for the batched character controller solver focusing on:
+ * - CharacterControllerComponent factory methods and jump gating
+ * - Kinematic integration without a physics backend (no ground rays)
+ * - Movement state transitions and gravity behavior
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "../src/systems/CharacterControllerSystem.h"
+#include "../src/components/CharacterControllerComponent.h"
+#include "../src/components/Transform.h"
+#include "../src/core/World.h"
+
+using namespace VulkanMon;
+using Catch::Approx;
+
+TEST_CASE("CharacterControllerComponent factory methods", "[CharacterController][Component]") {
+    SECTION("createHumanoid uses standard movement tuning") {
+        auto humanoid = CharacterControllerComponent::createHumanoid(5.0f);
+        REQUIRE(humanoid.moveSpeed == Approx(5.0f));
+        REQUIRE(humanoid.jumpForce > 0.0f);
+        REQUIRE(humanoid.useGravity == true);
+    }
+
+    SECTION("createFlying disables gravity and starts airborne") {
+        auto flying = CharacterControllerComponent::createFlying();
+        REQUIRE(flying.useGravity == false);
+        REQUIRE(flying.currentState == CharacterControllerComponent::MovementState::Airborne);
+        REQUIRE(flying.getGravityVector() == glm::vec3(0.0f));
+    }
+
+    SECTION("canJump gates on grounding, coyote time, and cooldown") {
+        CharacterControllerComponent controller;
+        controller.isGrounded = true;
+        controller.timeSinceJump = 1.0f;
+        REQUIRE(controller.canJump());
+
+        controller.isGrounded = false;
+        controller.timeSinceGrounded = controller.coyoteTime + 0.1f;
+        REQUIRE_FALSE(controller.canJump());
+
+        controller.timeSinceGrounded = 0.0f;  // within coyote window
+        REQUIRE(controller.canJump());
+
+        controller.timeSinceJump = 0.0f;      // cooldown not elapsed
+        REQUIRE_FALSE(controller.canJump());
+    }
+}
+
+TEST_CASE("CharacterControllerSystem kinematic integration", "[CharacterController][System]") {
+    World world;
+    auto* controllerSystem = world.addSystem<CharacterControllerSystem>();
+    // No physics system connected: the batch submits zero rays and every
+    // character resolves as airborne
+
+    auto entity = world.createEntity();
+    Transform transform;
+    transform.position = glm::vec3(0.0f, 10.0f, 0.0f);
+    world.addComponent(entity, transform);
+    world.addComponent(entity, CharacterControllerComponent::createHumanoid());
+
+    SECTION("Gravity accelerates an unsupported character downward") {
+        world.update(0.1f);
+
+        auto& controller = world.getComponent<CharacterControllerComponent>(entity);
+        auto& result = world.getComponent<Transform>(entity);
+        CHECK(controller.velocity.y < 0.0f);
+        CHECK(result.position.y < 10.0f);
+        CHECK(controller.currentState == CharacterControllerComponent::MovementState::Airborne);
+        CHECK(controllerSystem->getStats().charactersProcessed == 1);
+        CHECK(controllerSystem->getStats().groundRaysSubmitted == 0);
+    }
+
+    SECTION("Fall speed is clamped to the terminal velocity") {
+        auto& controller = world.getComponent<CharacterControllerComponent>(entity);
+        controller.velocity.y = -controller.maxFallSpeed;
+
+        world.update(0.5f);
+        CHECK(controller.velocity.y == Approx(-controller.maxFallSpeed));
+    }
+
+    SECTION("Input direction drives horizontal velocity toward target speed") {
+        auto& controller = world.getComponent<CharacterControllerComponent>(entity);
+        controller.useGravity = false;
+        controller.inputDirection = glm::vec3(1.0f, 0.0f, 0.0f);
+        controller.currentState = CharacterControllerComponent::MovementState::Grounded;
+        controller.isGrounded = false;  // no physics, so stays kinematic
+
+        for (int i = 0; i < 60; ++i) {
+            world.update(1.0f / 60.0f);
+        }
+
+        CHECK(controller.velocity.x > 0.0f);
+        CHECK(controller.velocity.x <= controller.maxAirSpeed + 0.001f);
+        auto& result = world.getComponent<Transform>(entity);
+        CHECK(result.position.x > 0.0f);
+    }
+
+    SECTION("Jump input is consumed and refused while airborne") {
+        auto& controller = world.getComponent<CharacterControllerComponent>(entity);
+        controller.timeSinceGrounded = 1.0f;  // well past coyote time
+        controller.wantsToJump = true;
+
+        world.update(1.0f / 60.0f);
+        CHECK(controller.wantsToJump == false);
+        CHECK(controller.velocity.y < 0.0f);  // gravity only, no jump impulse
+    }
+}
@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/game/CrowdLODController.h"
+
+using namespace VulkanMon;
+
+TEST_CASE("CrowdLODController rate tiers", "[CrowdLOD][Creature]") {
+    SECTION("Screen fraction maps to the three update tiers") {
+        REQUIRE(CrowdLODController::rateForScreenFraction(0.5f) == CreatureUpdateRate::EveryFrame);
+        REQUIRE(CrowdLODController::rateForScreenFraction(0.05f) == CreatureUpdateRate::EveryFrame);
+        REQUIRE(CrowdLODController::rateForScreenFraction(0.03f) == CreatureUpdateRate::EveryFourthFrame);
+        REQUIRE(CrowdLODController::rateForScreenFraction(0.001f) == CreatureUpdateRate::EverySixteenthFrame);
+    }
+
+    SECTION("Projected size shrinks with distance") {
+        float tanHalfFov = 1.0f;
+        float near = CrowdLODController::screenHeightFraction(10.0f, 1.0f, tanHalfFov);
+        float far = CrowdLODController::screenHeightFraction(100.0f, 1.0f, tanHalfFov);
+        REQUIRE(near > far);
+        REQUIRE(near == 0.1f);
+    }
+
+    SECTION("Without camera state every creature runs at full rate") {
+        CrowdLODController controller;
+        REQUIRE(controller.rateFor(glm::vec3(1000.0f, 0.0f, 0.0f), 1.0f) ==
+                CreatureUpdateRate::EveryFrame);
+    }
+
+    SECTION("With camera state distant creatures tier down") {
+        CrowdLODController controller;
+        controller.setCameraState(glm::vec3(0.0f), 75.0f);
+        REQUIRE(controller.rateFor(glm::vec3(2.0f, 0.0f, 0.0f), 1.0f) ==
+                CreatureUpdateRate::EveryFrame);
+        REQUIRE(controller.rateFor(glm::vec3(500.0f, 0.0f, 0.0f), 1.0f) ==
+                CreatureUpdateRate::EverySixteenthFrame);
+    }
+}
+
+TEST_CASE("CrowdLODController frame scheduling", "[CrowdLOD][Creature]") {
+    CrowdLODController controller;
+
+    SECTION("Each tier fires exactly once per period") {
+        for (auto rate : {CreatureUpdateRate::EveryFrame,
+                          CreatureUpdateRate::EveryFourthFrame,
+                          CreatureUpdateRate::EverySixteenthFrame}) {
+            size_t period = static_cast<size_t>(rate);
+            size_t fired = 0;
+            for (size_t frame = 0; frame < period; ++frame) {
+                controller.beginFrame();
+                if (controller.shouldUpdate(EntityID(42), rate)) {
+                    fired++;
+                }
+            }
+            REQUIRE(fired == 1);
+        }
+    }
+
+    SECTION("Entity IDs stagger same-tier phases across the period") {
+        controller.beginFrame();
+        size_t firingThisFrame = 0;
+        for (uint32_t id = 0; id < 16; ++id) {
+            if (controller.shouldUpdate(EntityID(id), CreatureUpdateRate::EverySixteenthFrame)) {
+                firingThisFrame++;
+            }
+        }
+        // Sixteen consecutive IDs spread over a 16-frame period - exactly
+        // one lands on any given frame
+        REQUIRE(firingThisFrame == 1);
+    }
+}
@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/rendering/DescriptorAllocator.h"
+
+using namespace VulkanMon;
+
+namespace {
+
+// Non-dispatchable handles are opaque 64-bit values; fabricate distinct
+// ones without a device so the cache key logic is testable in isolation
+template <typename HandleT>
+HandleT fakeHandle(uint64_t value) {
+    return (HandleT)value;
+}
+
+} // namespace
+
+TEST_CASE("Identical binding recordings produce equal cache keys", "[DescriptorAllocator]") {
+    auto record = [] {
+        return DescriptorAllocator::Bindings()
+            .addBuffer(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+                       fakeHandle<VkBuffer>(0x1000), 0, 256)
+            .addImage(1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                      fakeHandle<VkImageView>(0x2000), fakeHandle<VkSampler>(0x3000),
+                      VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    };
+
+    DescriptorAllocator::Bindings a = record();
+    DescriptorAllocator::Bindings b = record();
+
+    REQUIRE(a == b);
+    REQUIRE(a.hash() == b.hash());
+}
+
+TEST_CASE("Any differing binding field changes the cache key", "[DescriptorAllocator]") {
+    DescriptorAllocator::Bindings base = DescriptorAllocator::Bindings()
+        .addBuffer(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                   fakeHandle<VkBuffer>(0x1000), 0, 256);
+
+    SECTION("Different buffer handle") {
+        DescriptorAllocator::Bindings other = DescriptorAllocator::Bindings()
+            .addBuffer(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                       fakeHandle<VkBuffer>(0x1001), 0, 256);
+        REQUIRE_FALSE(base == other);
+    }
+
+    SECTION("Different offset") {
+        DescriptorAllocator::Bindings other = DescriptorAllocator::Bindings()
+            .addBuffer(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                       fakeHandle<VkBuffer>(0x1000), 64, 256);
+        REQUIRE_FALSE(base == other);
+    }
+
+    SECTION("Different descriptor type") {
+        DescriptorAllocator::Bindings other = DescriptorAllocator::Bindings()
+            .addBuffer(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                       fakeHandle<VkBuffer>(0x1000), 0, 256);
+        REQUIRE_FALSE(base == other);
+    }
+
+    SECTION("Different binding slot") {
+        DescriptorAllocator::Bindings other = DescriptorAllocator::Bindings()
+            .addBuffer(1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                       fakeHandle<VkBuffer>(0x1000), 0, 256);
+        REQUIRE_FALSE(base == other);
+    }
+}
+
+TEST_CASE("Buffer and image entries with matching handles stay distinct", "[DescriptorAllocator]") {
+    // A buffer at handle X must never collide with an image view at the
+    // same numeric handle value
+    DescriptorAllocator::Bindings buffer = DescriptorAllocator::Bindings()
+        .addBuffer(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                   fakeHandle<VkBuffer>(0x4000), 0, 0);
+    DescriptorAllocator::Bindings image = DescriptorAllocator::Bindings()
+        .addImage(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                  fakeHandle<VkImageView>(0x4000), fakeHandle<VkSampler>(0), VK_IMAGE_LAYOUT_UNDEFINED);
+
+    REQUIRE_FALSE(buffer == image);
+}
+
+TEST_CASE("Recording order is part of the key", "[DescriptorAllocator]") {
+    // Callers record in ascending binding order; a reordered recording
+    // is a different key by design, keeping comparison trivial
+    DescriptorAllocator::Bindings forward = DescriptorAllocator::Bindings()
+        .addBuffer(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, fakeHandle<VkBuffer>(0x1), 0, 16)
+        .addBuffer(1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, fakeHandle<VkBuffer>(0x2), 0, 16);
+    DescriptorAllocator::Bindings reversed = DescriptorAllocator::Bindings()
+        .addBuffer(1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, fakeHandle<VkBuffer>(0x2), 0, 16)
+        .addBuffer(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, fakeHandle<VkBuffer>(0x1), 0, 16);
+
+    REQUIRE_FALSE(forward == reversed);
+    REQUIRE(forward.size() == 2);
+    REQUIRE_FALSE(forward.empty());
+}
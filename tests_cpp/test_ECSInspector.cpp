@@ -69,7 +69,7 @@ TEST_CASE("ECS Inspector Entity Operations", "[ECSInspector][Entity]") {
         EntityID entity2 = world.createEntity();
         Transform transform2;
         Renderable renderable2;
-        renderable2.meshPath = "sphere.obj";
+        renderable2.setMesh("sphere.obj");
         renderable2.materialId = 1;
         world.addComponent(entity2, transform2);
         world.addComponent(entity2, renderable2);
@@ -122,7 +122,7 @@ TEST_CASE("ECS Inspector Component Validation", "[ECSInspector][Components]") {
         EntityID entity = world.createEntity();
         Transform transform;
         Renderable renderable;
-        renderable.meshPath = "pyramid.obj";
+        renderable.setMesh("pyramid.obj");
         renderable.materialId = 2;
         renderable.isVisible = true;
 
@@ -133,7 +133,7 @@ TEST_CASE("ECS Inspector Component Validation", "[ECSInspector][Components]") {
         const auto& storedRenderable = world.getComponent<Renderable>(entity);
 
         // Validate initial values
-        REQUIRE(storedRenderable.meshPath == "pyramid.obj");
+        REQUIRE(storedRenderable.meshPath() == "pyramid.obj");
         REQUIRE(storedRenderable.materialId == 2);
         REQUIRE(storedRenderable.isVisible == true);
     }
@@ -194,19 +194,19 @@ TEST_CASE("ECS Inspector Component Modification", "[ECSInspector][Modification]"
         EntityID entity = world.createEntity();
         Transform transform;
         Renderable renderable;
-        renderable.meshPath = "cube.obj";
+        renderable.setMesh("cube.obj");
         world.addComponent(entity, transform);
         world.addComponent(entity, renderable);
 
         // Modify renderable
         auto& modifiableRenderable = world.getComponent<Renderable>(entity);
-        modifiableRenderable.meshPath = "plane.obj";
+        modifiableRenderable.setMesh("plane.obj");
         modifiableRenderable.materialId = 4;
         modifiableRenderable.isVisible = false;
 
         // Validate modifications
         const auto& validatedRenderable = world.getComponent<Renderable>(entity);
-        REQUIRE(validatedRenderable.meshPath == "plane.obj");
+        REQUIRE(validatedRenderable.meshPath() == "plane.obj");
         REQUIRE(validatedRenderable.materialId == 4);
         REQUIRE(validatedRenderable.isVisible == false);
     }
@@ -225,7 +225,7 @@ TEST_CASE("ECS Inspector Entity Management", "[ECSInspector][Management]") {
         EntityID cubeEntity = world.createEntity();
         Transform transform1;
         Renderable renderable1;
-        renderable1.meshPath = "cube.obj";
+        renderable1.setMesh("cube.obj");
         renderable1.materialId = 0;
         world.addComponent(cubeEntity, transform1);
         world.addComponent(cubeEntity, renderable1);
@@ -233,7 +233,7 @@ TEST_CASE("ECS Inspector Entity Management", "[ECSInspector][Management]") {
         EntityID sphereEntity = world.createEntity();
         Transform transform2;
         Renderable renderable2;
-        renderable2.meshPath = "sphere.obj";
+        renderable2.setMesh("sphere.obj");
         renderable2.materialId = 1;
         world.addComponent(sphereEntity, transform2);
         world.addComponent(sphereEntity, renderable2);
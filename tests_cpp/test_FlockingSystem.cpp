@@ -0,0 +1,188 @@
+/*
+ * VulkanMon FlockingSystem Unit Tests
+ *
+ * Tests for the shared-neighborhood herd movement solver focusing on:
+ * - Cluster formation: one spatial gather per flock, not per member
+ * - Separation/alignment/cohesion steering written to inputDirection
+ * - Survival-state creatures being left to the detection AI
+ * - Solve cadence throttling
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "../src/game/FlockingSystem.h"
+#include "../src/systems/SpatialSystem.h"
+#include "../src/core/World.h"
+#include "../src/components/Transform.h"
+#include "../src/components/SpatialComponent.h"
+#include "../src/components/CreaturePhysicsComponent.h"
+
+using namespace VulkanMon;
+using Catch::Approx;
+
+namespace {
+
+EntityID spawnFlockCreature(World& world, const glm::vec3& position, uint32_t flockId,
+                            const glm::vec3& heading = glm::vec3(0.0f)) {
+    auto entity = world.createEntity();
+
+    Transform transform;
+    transform.position = position;
+    world.addComponent(entity, transform);
+
+    SpatialComponent spatial(1.0f, SpatialBehavior::DYNAMIC, LayerMask::Creatures);
+    spatial.markDirty();
+    world.addComponent(entity, spatial);
+
+    CreaturePhysicsComponent physics;
+    physics.inputDirection = heading;
+    world.addComponent(entity, physics);
+
+    world.addComponent(entity, FlockComponent(flockId));
+    return entity;
+}
+
+// One solve: register entities with the spatial manager, then push the
+// flocking timer past its interval in a single update
+void solveOnce(World& world, SpatialSystem* spatialSystem, FlockingSystem* flockingSystem) {
+    spatialSystem->update(0.016f, world.getEntityManager());
+    flockingSystem->update(FlockingSystem::FLOCK_SOLVE_INTERVAL, world.getEntityManager());
+}
+
+} // namespace
+
+TEST_CASE("FlockingSystem cluster formation", "[Flocking][Creature]") {
+    BoundingBox worldBounds(glm::vec3(-100.0f), glm::vec3(100.0f));
+    World world;
+    auto* spatialSystem = world.addSystem<SpatialSystem>(worldBounds);
+    auto* flockingSystem = world.addSystem<FlockingSystem>();
+    flockingSystem->setSpatialSystem(spatialSystem);
+
+    SECTION("One spatial gather per cluster, not per member") {
+        // Flock 1: three members near the origin
+        spawnFlockCreature(world, glm::vec3(0.0f, 0.0f, 0.0f), 1);
+        spawnFlockCreature(world, glm::vec3(3.0f, 0.0f, 0.0f), 1);
+        spawnFlockCreature(world, glm::vec3(0.0f, 0.0f, 3.0f), 1);
+        // Flock 2: two members far away
+        spawnFlockCreature(world, glm::vec3(50.0f, 0.0f, 50.0f), 2);
+        spawnFlockCreature(world, glm::vec3(53.0f, 0.0f, 50.0f), 2);
+
+        solveOnce(world, spatialSystem, flockingSystem);
+
+        auto& stats = flockingSystem->getFrameStats();
+        CHECK(stats.clustersSolved == 2);
+        CHECK(stats.spatialQueriesIssued == 2);  // the whole point of the solver
+        CHECK(stats.membersSteered == 5);
+    }
+
+    SECTION("A herd of one has nothing to flock with") {
+        auto loner = spawnFlockCreature(world, glm::vec3(10.0f, 0.0f, 10.0f), 3);
+
+        solveOnce(world, spatialSystem, flockingSystem);
+
+        CHECK(flockingSystem->getFrameStats().clustersSolved == 0);
+        CHECK(world.getComponent<CreaturePhysicsComponent>(loner).inputDirection ==
+              glm::vec3(0.0f));
+    }
+
+    SECTION("Without a spatial system the update is a no-op") {
+        FlockingSystem detached;
+        spawnFlockCreature(world, glm::vec3(0.0f), 1);
+        spawnFlockCreature(world, glm::vec3(1.0f, 0.0f, 0.0f), 1);
+
+        detached.update(FlockingSystem::FLOCK_SOLVE_INTERVAL, world.getEntityManager());
+
+        CHECK(detached.getFrameStats().clustersSolved == 0);
+        CHECK(detached.getFrameStats().spatialQueriesIssued == 0);
+    }
+}
+
+TEST_CASE("FlockingSystem steering behaviors", "[Flocking][Creature]") {
+    BoundingBox worldBounds(glm::vec3(-100.0f), glm::vec3(100.0f));
+    World world;
+    auto* spatialSystem = world.addSystem<SpatialSystem>(worldBounds);
+    auto* flockingSystem = world.addSystem<FlockingSystem>();
+    flockingSystem->setSpatialSystem(spatialSystem);
+
+    SECTION("Separation pushes crowded members apart on the ground plane") {
+        auto left = spawnFlockCreature(world, glm::vec3(0.0f, 0.0f, 0.0f), 7);
+        auto right = spawnFlockCreature(world, glm::vec3(1.0f, 0.0f, 0.0f), 7);
+
+        solveOnce(world, spatialSystem, flockingSystem);
+
+        auto& leftDir = world.getComponent<CreaturePhysicsComponent>(left).inputDirection;
+        auto& rightDir = world.getComponent<CreaturePhysicsComponent>(right).inputDirection;
+        CHECK(leftDir.x < 0.0f);
+        CHECK(rightDir.x > 0.0f);
+        CHECK(leftDir.y == 0.0f);   // herds steer on the ground plane
+        CHECK(rightDir.y == 0.0f);
+    }
+
+    SECTION("Cohesion draws a straggler back toward the herd") {
+        spawnFlockCreature(world, glm::vec3(0.0f, 0.0f, 0.0f), 4);
+        spawnFlockCreature(world, glm::vec3(1.0f, 0.0f, 0.0f), 4);
+        auto straggler = spawnFlockCreature(world, glm::vec3(20.0f, 0.0f, 0.0f), 4);
+
+        solveOnce(world, spatialSystem, flockingSystem);
+
+        // Too far for separation; only cohesion acts, pulling toward the
+        // centroid in -X
+        CHECK(world.getComponent<CreaturePhysicsComponent>(straggler).inputDirection.x < 0.0f);
+    }
+
+    SECTION("Alignment carries the herd's heading to idle members") {
+        spawnFlockCreature(world, glm::vec3(0.0f, 0.0f, 0.0f), 5, glm::vec3(1.0f, 0.0f, 0.0f));
+        auto follower = spawnFlockCreature(world, glm::vec3(10.0f, 0.0f, 0.0f), 5);
+
+        solveOnce(world, spatialSystem, flockingSystem);
+
+        // Alignment (weight 1.0) toward +X beats cohesion (weight 0.8)
+        // toward the centroid in -X; the normalized blend lands on +X
+        CHECK(world.getComponent<CreaturePhysicsComponent>(follower).inputDirection.x ==
+              Approx(1.0f));
+    }
+
+    SECTION("Creatures in survival states are left to the detection AI") {
+        auto fleeing = spawnFlockCreature(world, glm::vec3(0.0f, 0.0f, 0.0f), 9,
+                                          glm::vec3(0.0f, 0.0f, 1.0f));
+        auto calm = spawnFlockCreature(world, glm::vec3(1.0f, 0.0f, 0.0f), 9);
+
+        CreatureComponent creature;
+        creature.state = CreatureState::FLEEING;
+        world.addComponent(fleeing, creature);
+
+        solveOnce(world, spatialSystem, flockingSystem);
+
+        CHECK(world.getComponent<CreaturePhysicsComponent>(fleeing).inputDirection ==
+              glm::vec3(0.0f, 0.0f, 1.0f));
+        CHECK(world.getComponent<CreaturePhysicsComponent>(calm).inputDirection !=
+              glm::vec3(0.0f));
+        CHECK(flockingSystem->getFrameStats().membersSteered == 1);
+    }
+}
+
+TEST_CASE("FlockingSystem solve cadence", "[Flocking][Creature]") {
+    BoundingBox worldBounds(glm::vec3(-100.0f), glm::vec3(100.0f));
+    World world;
+    auto* spatialSystem = world.addSystem<SpatialSystem>(worldBounds);
+    auto* flockingSystem = world.addSystem<FlockingSystem>();
+    flockingSystem->setSpatialSystem(spatialSystem);
+
+    spawnFlockCreature(world, glm::vec3(0.0f, 0.0f, 0.0f), 1);
+    spawnFlockCreature(world, glm::vec3(1.0f, 0.0f, 0.0f), 1);
+    spatialSystem->update(0.016f, world.getEntityManager());
+
+    SECTION("Solves accumulate toward the interval instead of running per frame") {
+        float step = FlockingSystem::FLOCK_SOLVE_INTERVAL * 0.4f;
+
+        flockingSystem->update(step, world.getEntityManager());
+        CHECK(flockingSystem->getFrameStats().clustersSolved == 0);
+
+        flockingSystem->update(step, world.getEntityManager());
+        CHECK(flockingSystem->getFrameStats().clustersSolved == 0);
+
+        flockingSystem->update(step, world.getEntityManager());  // crosses the interval
+        CHECK(flockingSystem->getFrameStats().clustersSolved == 1);
+    }
+}
@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/rendering/FrameGraph.h"
+
+using namespace VulkanMon;
+
+TEST_CASE("FrameGraph derives compute to draw barriers", "[FrameGraph][Rendering]") {
+    FrameGraph graph;
+    auto culled = graph.createResource("CulledInstances", true);
+    auto commands = graph.createResource("IndirectCommands", true);
+
+    auto cull = graph.addPass("CullCompute");
+    graph.addWrite(cull, culled, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+    graph.addWrite(cull, commands, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+
+    auto draw = graph.addPass("ShadedPass");
+    graph.addRead(draw, commands, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT);
+    graph.addRead(draw, culled, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT);
+
+    graph.compile();
+
+    SECTION("First pass has no hazards to wait on") {
+        REQUIRE(graph.barrierBefore(cull).empty());
+    }
+
+    SECTION("Merged barrier covers both read-after-write hazards") {
+        const auto& barrier = graph.barrierBefore(draw);
+        REQUIRE(barrier.srcStageMask == VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+        REQUIRE(barrier.srcAccessMask == VK_ACCESS_SHADER_WRITE_BIT);
+        REQUIRE(barrier.dstStageMask ==
+                (VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT));
+        REQUIRE(barrier.dstAccessMask ==
+                (VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT));
+    }
+
+    SECTION("Resource-filtered barrier drops unrelated hazards") {
+        auto barrier = graph.barrierBefore(draw, {commands});
+        REQUIRE(barrier.dstStageMask == VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT);
+        REQUIRE(barrier.dstAccessMask == VK_ACCESS_INDIRECT_COMMAND_READ_BIT);
+    }
+}
+
+TEST_CASE("FrameGraph elides hazards an earlier barrier made visible", "[FrameGraph][Rendering]") {
+    FrameGraph graph;
+    auto buffer = graph.createResource("SharedBuffer");
+
+    auto producer = graph.addPass("Producer");
+    graph.addWrite(producer, buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+
+    auto firstReader = graph.addPass("FirstReader");
+    graph.addRead(firstReader, buffer, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+
+    auto secondReader = graph.addPass("SecondReader");
+    graph.addRead(secondReader, buffer, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+
+    graph.compile();
+
+    // The first reader's barrier already made the write visible to
+    // vertex shader reads, so the second reader needs nothing
+    REQUIRE_FALSE(graph.barrierBefore(firstReader).empty());
+    REQUIRE(graph.barrierBefore(secondReader).empty());
+
+    SECTION("A reader at new stages still gets its own barrier") {
+        auto fragmentReader = graph.addPass("FragmentReader");
+        graph.addRead(fragmentReader, buffer,
+                      VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+        graph.compile();
+
+        const auto& barrier = graph.barrierBefore(fragmentReader);
+        REQUIRE(barrier.dstStageMask == VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+    }
+}
+
+TEST_CASE("FrameGraph orders write-after-read as an execution dependency", "[FrameGraph][Rendering]") {
+    FrameGraph graph;
+    auto pyramid = graph.createResource("HiZPyramid");
+
+    // Cull samples last frame's pyramid before the build pass rewrites it
+    auto cull = graph.addPass("CullCompute");
+    graph.addRead(cull, pyramid, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+
+    auto build = graph.addPass("HiZBuild");
+    graph.addWrite(build, pyramid, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+
+    graph.compile();
+
+    const auto& barrier = graph.barrierBefore(build);
+    REQUIRE(barrier.srcStageMask == VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+    REQUIRE(barrier.srcAccessMask == 0);  // reads leave nothing to flush
+    REQUIRE(barrier.dstStageMask == VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+    REQUIRE(barrier.dstAccessMask == VK_ACCESS_SHADER_WRITE_BIT);
+}
+
+TEST_CASE("FrameGraph aliases transients with disjoint lifetimes", "[FrameGraph][Rendering]") {
+    FrameGraph graph;
+    auto early = graph.createResource("EarlyScratch", true);
+    auto late = graph.createResource("LateScratch", true);
+    auto spanning = graph.createResource("SpansFrame", true);
+    auto persistent = graph.createResource("Persistent");
+
+    auto passA = graph.addPass("A");
+    graph.addWrite(passA, early, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+    graph.addWrite(passA, spanning, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+
+    auto passB = graph.addPass("B");
+    graph.addRead(passB, early, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+
+    auto passC = graph.addPass("C");
+    graph.addWrite(passC, late, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+    graph.addRead(passC, spanning, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+    graph.addRead(passC, persistent, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT);
+
+    graph.compile();
+    auto groups = graph.aliasGroups();
+
+    // EarlyScratch dies at pass B, so LateScratch can reuse its memory;
+    // SpansFrame overlaps both and gets its own group. Persistent
+    // resources never appear
+    REQUIRE(groups.size() == 2);
+
+    bool foundSharedGroup = false;
+    for (const auto& group : groups) {
+        for (auto resource : group) {
+            REQUIRE(resource != persistent);
+        }
+        if (group.size() == 2) {
+            foundSharedGroup = true;
+            REQUIRE(group[0] == early);
+            REQUIRE(group[1] == late);
+        }
+    }
+    REQUIRE(foundSharedGroup);
+}
@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/utils/FrameProfiler.h"
+#include <thread>
+
+using namespace VulkanMon;
+
+TEST_CASE("FrameProfiler zone tree", "[FrameProfiler][Performance]") {
+    auto& profiler = FrameProfiler::getInstance();
+    profiler.setEnabled(true);
+
+    SECTION("Nested scopes record depth and parent links") {
+        profiler.beginFrame();
+        {
+            VKMON_PROFILE_SCOPE("outer");
+            {
+                VKMON_PROFILE_SCOPE("inner");
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        profiler.beginFrame(); // Closes the instrumented frame into history
+
+        const auto& frame = profiler.getHistoryFrame(0);
+        REQUIRE(frame.zones.size() == 2);
+
+        REQUIRE(std::string(frame.zones[0].name) == "outer");
+        REQUIRE(frame.zones[0].depth == 0);
+        REQUIRE(frame.zones[0].parent == -1);
+
+        REQUIRE(std::string(frame.zones[1].name) == "inner");
+        REQUIRE(frame.zones[1].depth == 1);
+        REQUIRE(frame.zones[1].parent == 0);
+
+        // Parent encloses the child, so it cannot be shorter
+        REQUIRE(frame.zones[0].durationMs >= frame.zones[1].durationMs);
+        REQUIRE(frame.zones[1].durationMs > 0.0f);
+    }
+
+    SECTION("Siblings share a parent at the same depth") {
+        profiler.beginFrame();
+        {
+            VKMON_PROFILE_SCOPE("parent");
+            { VKMON_PROFILE_SCOPE("first"); }
+            { VKMON_PROFILE_SCOPE("second"); }
+        }
+        profiler.beginFrame();
+
+        const auto& frame = profiler.getHistoryFrame(0);
+        REQUIRE(frame.zones.size() == 3);
+        REQUIRE(frame.zones[1].parent == 0);
+        REQUIRE(frame.zones[2].parent == 0);
+        REQUIRE(frame.zones[1].depth == frame.zones[2].depth);
+    }
+
+    SECTION("Disabled profiler records no zones") {
+        profiler.setEnabled(false);
+        profiler.beginFrame();
+        { VKMON_PROFILE_SCOPE("ignored"); }
+        profiler.beginFrame();
+
+        REQUIRE(profiler.getHistoryFrame(0).zones.empty());
+        profiler.setEnabled(true);
+    }
+}
+
+TEST_CASE("FrameProfiler history ring", "[FrameProfiler][Performance]") {
+    auto& profiler = FrameProfiler::getInstance();
+    profiler.setEnabled(true);
+
+    SECTION("History is ordered newest first") {
+        profiler.beginFrame();
+        { VKMON_PROFILE_SCOPE("older"); }
+        profiler.beginFrame();
+        { VKMON_PROFILE_SCOPE("newer"); }
+        profiler.beginFrame();
+
+        REQUIRE(std::string(profiler.getHistoryFrame(0).zones[0].name) == "newer");
+        REQUIRE(std::string(profiler.getHistoryFrame(1).zones[0].name) == "older");
+        REQUIRE(profiler.getHistoryFrame(0).frameNumber >
+                profiler.getHistoryFrame(1).frameNumber);
+    }
+
+    SECTION("Out-of-range history returns the empty record") {
+        const auto& frame = profiler.getHistoryFrame(FrameProfiler::HISTORY_FRAMES + 1);
+        REQUIRE(frame.zones.empty());
+        REQUIRE(frame.totalMs == 0.0f);
+    }
+
+    SECTION("Unbalanced endZone is ignored") {
+        profiler.beginFrame();
+        FrameProfiler::getInstance().endZone(); // Nothing open - must not crash
+        profiler.beginFrame();
+        REQUIRE(profiler.getHistoryFrame(0).zones.empty());
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * VulkanMon FrameTimeHistogram Unit Tests
+ *
+ * Tests for the frame-time distribution tracker:
+ * - Percentile reporting against known distributions
+ * - Spike detection (warmup, absolute floor, median-relative factor)
+ * - Overflow-bucket handling and reset
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/utils/FrameTimeHistogram.h"
+
+using namespace VulkanMon;
+
+TEST_CASE("FrameTimeHistogram percentiles", "[FrameTimeHistogram]") {
+    SECTION("known distribution reports bucket-conservative percentiles") {
+        // 90 frames at 7ms, 9 at 9ms, 1 at 20ms: the classic profile
+        // the histogram exists for - healthy median, ugly tail
+        FrameTimeHistogram histogram;
+        for (int i = 0; i < 90; ++i) histogram.record(7.0f);
+        for (int i = 0; i < 9; ++i) histogram.record(9.0f);
+        histogram.record(20.0f);
+
+        REQUIRE(histogram.getFrameCount() == 100);
+        // Percentiles report the upper bucket edge, so each lands within
+        // one bucket width above the true value
+        REQUIRE(histogram.percentile(50.0f) >= 7.0f);
+        REQUIRE(histogram.percentile(50.0f) <= 7.0f + FrameTimeHistogram::BUCKET_WIDTH_MS);
+        REQUIRE(histogram.percentile(95.0f) >= 9.0f);
+        REQUIRE(histogram.percentile(95.0f) <= 9.0f + FrameTimeHistogram::BUCKET_WIDTH_MS);
+        REQUIRE(histogram.percentile(99.0f) >= 20.0f);
+        REQUIRE(histogram.getMaxMs() == 20.0f);
+    }
+
+    SECTION("empty histogram reports zero") {
+        FrameTimeHistogram histogram;
+        REQUIRE(histogram.percentile(50.0f) == 0.0f);
+        REQUIRE(histogram.getMaxMs() == 0.0f);
+    }
+
+    SECTION("frames past the bucket cap report max for tail percentiles") {
+        FrameTimeHistogram histogram;
+        for (int i = 0; i < 99; ++i) histogram.record(5.0f);
+        histogram.record(80.0f); // beyond BUCKET_COUNT * BUCKET_WIDTH_MS
+
+        REQUIRE(histogram.percentile(99.9f) == 80.0f);
+    }
+
+    SECTION("reset clears the distribution") {
+        FrameTimeHistogram histogram;
+        histogram.record(7.0f);
+        histogram.record(20.0f);
+        histogram.reset();
+
+        REQUIRE(histogram.getFrameCount() == 0);
+        REQUIRE(histogram.getMaxMs() == 0.0f);
+        REQUIRE(histogram.getSpikeCount() == 0);
+    }
+}
+
+TEST_CASE("FrameTimeHistogram spike detection", "[FrameTimeHistogram]") {
+    SECTION("warmup frames never flag, even when slow") {
+        FrameTimeHistogram histogram;
+        bool flagged = false;
+        for (size_t i = 0; i < FrameTimeHistogram::SPIKE_WARMUP_FRAMES; ++i) {
+            flagged |= histogram.record(i == 60 ? 50.0f : 7.0f);
+        }
+        REQUIRE_FALSE(flagged);
+    }
+
+    SECTION("spike needs both the floor and the median-relative factor") {
+        FrameTimeHistogram histogram;
+        for (size_t i = 0; i < FrameTimeHistogram::SPIKE_WARMUP_FRAMES; ++i) {
+            histogram.record(7.0f);
+        }
+
+        // 20ms on a 7ms baseline: over the floor and over 2x p50
+        REQUIRE(histogram.record(20.0f));
+        // 9ms: under the absolute floor - frame-rate noise, not a spike
+        REQUIRE_FALSE(histogram.record(9.0f));
+        // 12ms: over the floor but under 2x p50 - just a slow-ish frame
+        REQUIRE_FALSE(histogram.record(12.0f));
+        REQUIRE(histogram.getSpikeCount() == 1);
+    }
+
+    SECTION("a uniformly heavy baseline does not flag itself") {
+        // Debug builds run 15ms frames all day; the median-relative
+        // factor keeps them from drowning the log
+        FrameTimeHistogram histogram;
+        bool flagged = false;
+        for (size_t i = 0; i < FrameTimeHistogram::SPIKE_WARMUP_FRAMES + 100; ++i) {
+            flagged |= histogram.record(15.0f);
+        }
+        REQUIRE_FALSE(flagged);
+
+        // A genuine spike on that baseline still registers
+        REQUIRE(histogram.record(35.0f));
+    }
+}
@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/game/GrassSystem.h"
+
+#include <glm/glm.hpp>
+
+using namespace VulkanMon;
+
+TEST_CASE("GrassSystem blade generation", "[GrassSystem][Rendering]") {
+    SECTION("Generation is deterministic per entity") {
+        GrassComponent grass(GrassComponent::GrassType::TALL_GRASS, 4.0f);
+        glm::vec3 patchPosition(10.0f, 0.0f, -5.0f);
+
+        auto first = GrassSystem::generateBladeInstances(42, patchPosition, grass);
+        auto second = GrassSystem::generateBladeInstances(42, patchPosition, grass);
+
+        REQUIRE(first.size() == grass.bladeCount);
+        REQUIRE(first.size() == second.size());
+        for (size_t i = 0; i < first.size(); ++i) {
+            REQUIRE(first[i].positionScale == second[i].positionScale);
+            REQUIRE(first[i].rotation == second[i].rotation);
+        }
+    }
+
+    SECTION("Different entities produce different blade layouts") {
+        GrassComponent grass(GrassComponent::GrassType::SHORT_GRASS, 3.0f);
+        glm::vec3 patchPosition(0.0f);
+
+        auto patchA = GrassSystem::generateBladeInstances(1, patchPosition, grass);
+        auto patchB = GrassSystem::generateBladeInstances(2, patchPosition, grass);
+
+        REQUIRE(patchA.size() == patchB.size());
+        REQUIRE(patchA[0].positionScale != patchB[0].positionScale);
+    }
+
+    SECTION("Blades stay within the patch radius") {
+        GrassComponent grass(GrassComponent::GrassType::DENSE_BRUSH, 2.5f);
+        glm::vec3 patchPosition(-3.0f, 1.0f, 7.0f);
+
+        auto blades = GrassSystem::generateBladeInstances(7, patchPosition, grass);
+        for (const auto& blade : blades) {
+            glm::vec3 bladePos(blade.positionScale);
+            float distance = glm::length(glm::vec2(bladePos.x - patchPosition.x,
+                                                   bladePos.z - patchPosition.z));
+            REQUIRE(distance <= grass.patchRadius + 0.001f);
+            REQUIRE(bladePos.y == patchPosition.y);  // blades sit on the patch plane
+        }
+    }
+
+    SECTION("Blade scale jitter stays within the documented 30 percent band") {
+        GrassComponent grass(GrassComponent::GrassType::TALL_GRASS, 3.0f);
+
+        auto blades = GrassSystem::generateBladeInstances(99, glm::vec3(0.0f), grass);
+        for (const auto& blade : blades) {
+            float scale = blade.positionScale.w;
+            REQUIRE(scale >= grass.bladeScale * 0.7f);
+            REQUIRE(scale <= grass.bladeScale * 1.3f);
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/core/HeadlessEngine.h"
+#include "../src/components/Transform.h"
+#include "../src/components/SpatialComponent.h"
+#include "../src/components/RigidBodyComponent.h"
+#include "../src/components/CollisionComponent.h"
+
+using namespace VulkanMon;
+
+TEST_CASE("HeadlessEngine lifecycle", "[Headless][Core]") {
+    SECTION("Initializes simulation systems without a renderer") {
+        HeadlessEngine engine;
+        REQUIRE_FALSE(engine.isInitialized());
+
+        engine.initialize();
+        REQUIRE(engine.isInitialized());
+        REQUIRE(engine.getSpatialSystem() != nullptr);
+        REQUIRE(engine.getPhysicsSystem() != nullptr);
+        REQUIRE(engine.getCreatureDetectionSystem() != nullptr);
+        REQUIRE(engine.getCameraSystem() != nullptr);
+
+        engine.shutdown();
+        REQUIRE_FALSE(engine.isInitialized());
+    }
+
+    SECTION("Double initialize is a no-op") {
+        HeadlessEngine engine;
+        engine.initialize();
+        auto* spatialBefore = engine.getSpatialSystem();
+        engine.initialize();
+        REQUIRE(engine.getSpatialSystem() == spatialBefore);
+    }
+}
+
+TEST_CASE("HeadlessEngine fixed-step loop", "[Headless][Core]") {
+    HeadlessEngine engine;
+    engine.initialize();
+
+    SECTION("Ticks run to count and invoke the scenario callback") {
+        uint64_t callbackTicks = 0;
+        engine.runTicks(25, HeadlessEngine::DEFAULT_FIXED_STEP_SECONDS,
+            [&callbackTicks](uint64_t tick, World& world) {
+                REQUIRE(tick == callbackTicks);
+                callbackTicks++;
+            });
+
+        REQUIRE(callbackTicks == 25);
+        REQUIRE(engine.getTicksSimulated() == 25);
+    }
+
+    SECTION("Physics advances under the fixed step") {
+        auto& entityManager = engine.getEntityManager();
+
+        EntityID body = entityManager.createEntity();
+        Transform transform;
+        transform.position = glm::vec3(0.0f, 10.0f, 0.0f);
+        entityManager.addComponent(body, transform);
+        entityManager.addComponent(body, SpatialComponent(0.5f, SpatialBehavior::DYNAMIC,
+                                                          LayerMask::Creatures));
+        entityManager.addComponent(body, RigidBodyComponent::dynamic(1.0f));
+        entityManager.addComponent(body, CollisionComponent::sphere(0.5f));
+
+        // One simulated second of free fall
+        engine.runTicks(60);
+
+        float finalY = entityManager.getComponent<Transform>(body).position.y;
+        REQUIRE(finalY < 10.0f);
+    }
+
+    SECTION("runTicks before initialize logs and returns") {
+        HeadlessEngine uninitialized;
+        uninitialized.runTicks(10);
+        REQUIRE(uninitialized.getTicksSimulated() == 0);
+    }
+}
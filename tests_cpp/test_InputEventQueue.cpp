@@ -0,0 +1,95 @@
+/**
+ * VulkanMon InputEventQueue Unit Tests
+ *
+ * Testing timestamped input event buffering:
+ * - Events drain in arrival order (sub-frame ordering survives)
+ * - Draining empties the queue
+ * - Recording captures the stream for deterministic replay
+ *
+ * Pure data structure - no GLFW or window dependency required.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/InputEventQueue.h"
+
+using VulkanMon::InputEvent;
+using VulkanMon::InputEventQueue;
+
+TEST_CASE("InputEventQueue drains events in arrival order", "[InputEventQueue]") {
+    InputEventQueue queue;
+
+    queue.push(InputEvent::keyEvent(0.001, 'W', 0, 1, 0));
+    queue.push(InputEvent::mouseMoveEvent(0.002, 100.0, 200.0));
+    queue.push(InputEvent::keyEvent(0.003, 'W', 0, 0, 0));
+
+    auto events = queue.drain();
+    REQUIRE(events.size() == 3);
+    REQUIRE(events[0].type == InputEvent::Type::Key);
+    REQUIRE(events[0].action == 1);
+    REQUIRE(events[1].type == InputEvent::Type::MouseMove);
+    REQUIRE(events[1].x == 100.0);
+    REQUIRE(events[1].y == 200.0);
+    REQUIRE(events[2].type == InputEvent::Type::Key);
+    REQUIRE(events[2].action == 0);
+
+    // Timestamps carried through untouched - sub-frame timing is the
+    // whole point of queueing instead of acting in the callback
+    REQUIRE(events[0].timestamp < events[1].timestamp);
+    REQUIRE(events[1].timestamp < events[2].timestamp);
+}
+
+TEST_CASE("InputEventQueue drain empties the queue", "[InputEventQueue]") {
+    InputEventQueue queue;
+    REQUIRE(queue.empty());
+
+    queue.push(InputEvent::mouseButtonEvent(0.5, 0, 1, 0));
+    REQUIRE(queue.size() == 1);
+
+    auto events = queue.drain();
+    REQUIRE(events.size() == 1);
+    REQUIRE(queue.empty());
+    REQUIRE(queue.drain().empty());
+}
+
+TEST_CASE("InputEventQueue records pushed events for replay", "[InputEventQueue]") {
+    InputEventQueue queue;
+
+    // Events pushed before recording starts are not captured
+    queue.push(InputEvent::keyEvent(0.1, 'A', 0, 1, 0));
+    queue.drain();
+
+    queue.startRecording();
+    REQUIRE(queue.isRecording());
+
+    queue.push(InputEvent::keyEvent(1.0, 'W', 0, 1, 0));
+    queue.push(InputEvent::mouseMoveEvent(1.5, 50.0, 60.0));
+    queue.drain();  // consumption does not affect the recording
+    queue.push(InputEvent::keyEvent(2.0, 'W', 0, 0, 0));
+
+    auto recorded = queue.stopRecording();
+    REQUIRE_FALSE(queue.isRecording());
+    REQUIRE(recorded.size() == 3);
+    REQUIRE(recorded[0].key == 'W');
+    REQUIRE(recorded[1].type == InputEvent::Type::MouseMove);
+    REQUIRE(recorded[2].action == 0);
+}
+
+TEST_CASE("InputEventQueue replay feeds recorded events back through the queue", "[InputEventQueue]") {
+    InputEventQueue queue;
+
+    queue.startRecording();
+    queue.push(InputEvent::keyEvent(1.0, 'D', 0, 1, 0));
+    queue.push(InputEvent::keyEvent(1.2, 'D', 0, 0, 0));
+    queue.drain();
+    auto recorded = queue.stopRecording();
+
+    // Replayed events drain exactly like the live stream did, which is
+    // what makes benchmark camera paths reproducible
+    queue.replay(recorded);
+    auto events = queue.drain();
+    REQUIRE(events.size() == 2);
+    REQUIRE(events[0].key == 'D');
+    REQUIRE(events[0].action == 1);
+    REQUIRE(events[1].action == 0);
+    REQUIRE(events[0].timestamp == recorded[0].timestamp);
+}
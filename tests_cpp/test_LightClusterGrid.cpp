@@ -0,0 +1,157 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/systems/LightClusterGrid.h"
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <vector>
+
+using namespace VulkanMon;
+using namespace VulkanMon::LightClusterGrid;
+
+namespace {
+
+// Camera at the origin looking down -Z (identity view), 45 degree
+// vertical FOV at 16:9 - matches what updateClusters() recovers from a
+// typical projection matrix
+constexpr float Z_NEAR = 0.1f;
+constexpr float Z_FAR = 100.0f;
+const float TAN_HALF_FOV_Y = std::tan(glm::radians(22.5f));
+constexpr float ASPECT = 16.0f / 9.0f;
+
+struct BinResult {
+    std::vector<ClusterRange> ranges;
+    std::vector<uint32_t> indices;
+    size_t written = 0;
+    size_t dropped = 0;
+};
+
+BinResult bin(const std::vector<PointLight>& lights,
+              size_t indexCapacity = MAX_LIGHT_INDICES) {
+    BinResult result;
+    result.ranges.resize(CLUSTER_COUNT);
+    result.indices.resize(indexCapacity);
+    result.written = binPointLights(lights.data(), lights.size(),
+                                    glm::mat4(1.0f), TAN_HALF_FOV_Y, ASPECT,
+                                    Z_NEAR, Z_FAR,
+                                    result.ranges.data(),
+                                    result.indices.data(), indexCapacity,
+                                    &result.dropped);
+    return result;
+}
+
+size_t totalCount(const BinResult& result) {
+    size_t sum = 0;
+    for (const auto& range : result.ranges) {
+        sum += range.count;
+    }
+    return sum;
+}
+
+} // namespace
+
+TEST_CASE("Centered light bins into the middle of the grid", "[LightClusterGrid]") {
+    // Small light straight ahead of the camera - its sphere covers the
+    // screen center without reaching the edges
+    std::vector<PointLight> lights = {
+        PointLight(glm::vec3(0.0f, 0.0f, -10.0f), 1.0f, glm::vec3(1.0f), 1.0f)
+    };
+
+    BinResult result = bin(lights);
+
+    REQUIRE(result.written > 0);
+    REQUIRE(result.dropped == 0);
+
+    // The cluster at the screen center and the light's depth slice must
+    // contain it
+    float invLogDepthRange = 1.0f / std::log(Z_FAR / Z_NEAR);
+    uint32_t slice = detail::depthSlice(10.0f, Z_NEAR, invLogDepthRange);
+    uint32_t center = clusterIndex(DIM_X / 2, DIM_Y / 2, slice);
+
+    REQUIRE(result.ranges[center].count >= 1);
+    bool found = false;
+    for (uint32_t i = 0; i < result.ranges[center].count; ++i) {
+        if (result.indices[result.ranges[center].offset + i] == 0) {
+            found = true;
+        }
+    }
+    REQUIRE(found);
+
+    // A small light must not touch clusters at the opposite screen corner
+    REQUIRE(result.ranges[clusterIndex(0, 0, slice)].count == 0);
+    REQUIRE(result.ranges[clusterIndex(DIM_X - 1, DIM_Y - 1, slice)].count == 0);
+}
+
+TEST_CASE("Lights outside the view volume bin nothing", "[LightClusterGrid]") {
+    std::vector<PointLight> lights = {
+        PointLight(glm::vec3(0.0f, 0.0f, 10.0f), 2.0f, glm::vec3(1.0f), 1.0f),    // behind camera
+        PointLight(glm::vec3(0.0f, 0.0f, -500.0f), 2.0f, glm::vec3(1.0f), 1.0f),  // past far plane
+        PointLight(glm::vec3(0.0f, 0.0f, -10.0f), 0.0f, glm::vec3(1.0f), 1.0f)    // zero radius
+    };
+
+    BinResult result = bin(lights);
+
+    REQUIRE(result.written == 0);
+    REQUIRE(totalCount(result) == 0);
+}
+
+TEST_CASE("Cluster ranges are consistent with the index list", "[LightClusterGrid]") {
+    std::vector<PointLight> lights;
+    for (int i = 0; i < 20; ++i) {
+        float x = static_cast<float>(i % 5 - 2) * 3.0f;
+        float z = -5.0f - static_cast<float>(i) * 2.0f;
+        lights.push_back(PointLight(glm::vec3(x, 0.0f, z), 4.0f, glm::vec3(1.0f), 1.0f));
+    }
+
+    BinResult result = bin(lights);
+
+    REQUIRE(result.written > 0);
+    REQUIRE(totalCount(result) == result.written);
+
+    // Every range stays inside the written portion of the index list and
+    // only references real lights
+    for (const auto& range : result.ranges) {
+        REQUIRE(range.offset + range.count <= result.written);
+        for (uint32_t i = 0; i < range.count; ++i) {
+            REQUIRE(result.indices[range.offset + i] < lights.size());
+        }
+    }
+}
+
+TEST_CASE("Index budget overflow drops whole lights", "[LightClusterGrid]") {
+    // A huge light first (covers many clusters), then a small one that
+    // still fits in a tiny budget
+    std::vector<PointLight> lights = {
+        PointLight(glm::vec3(0.0f, 0.0f, -20.0f), 50.0f, glm::vec3(1.0f), 1.0f),
+        PointLight(glm::vec3(0.0f, 0.0f, -10.0f), 1.0f, glm::vec3(1.0f), 1.0f)
+    };
+
+    BinResult result = bin(lights, 64);
+
+    REQUIRE(result.dropped == 1);
+    REQUIRE(result.written <= 64);
+    REQUIRE(totalCount(result) == result.written);
+
+    // The surviving light is the small one - every stored index is 1
+    for (const auto& range : result.ranges) {
+        for (uint32_t i = 0; i < range.count; ++i) {
+            REQUIRE(result.indices[range.offset + i] == 1);
+        }
+    }
+}
+
+TEST_CASE("Empty light set clears all ranges", "[LightClusterGrid]") {
+    BinResult stale = bin({ PointLight(glm::vec3(0.0f, 0.0f, -10.0f), 5.0f, glm::vec3(1.0f), 1.0f) });
+    REQUIRE(stale.written > 0);
+
+    // Rebinning with no lights over the same buffers must zero every range
+    size_t written = binPointLights(nullptr, 0,
+                                    glm::mat4(1.0f), TAN_HALF_FOV_Y, ASPECT,
+                                    Z_NEAR, Z_FAR,
+                                    stale.ranges.data(),
+                                    stale.indices.data(), stale.indices.size());
+
+    REQUIRE(written == 0);
+    for (const auto& range : stale.ranges) {
+        REQUIRE(range.count == 0);
+    }
+}
@@ -70,6 +70,47 @@ TEST_CASE("Logger File Output", "[Logger][File]") {
     }
 }
 
+TEST_CASE("Logger Async Mode", "[Logger][Async]") {
+    SECTION("Concurrent async records all reach the log file") {
+        auto& logger = Logger::getInstance();
+        std::string tempFile = "test_async_log_output.txt";
+
+        logger.enableFileOutput(tempFile);
+        logger.enableAsyncMode();
+        REQUIRE(logger.isAsyncMode());
+
+        ThreadTestHelpers::runConcurrently([&logger]() {
+            logger.info("Async sink test record");
+        }, 4, 25);
+
+        // Disable drains the ring before the worker exits
+        logger.disableAsyncMode();
+        REQUIRE_FALSE(logger.isAsyncMode());
+        logger.disableFileOutput();
+
+        std::ifstream file(tempFile);
+        size_t recordCount = 0;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.find("Async sink test record") != std::string::npos) {
+                recordCount++;
+            }
+        }
+        file.close();
+        std::filesystem::remove(tempFile);
+
+        // 100 records against a 4096-slot ring - nothing should drop
+        REQUIRE(logger.getDroppedRecordCount() == 0);
+        REQUIRE(recordCount == 100);
+    }
+
+    SECTION("Synchronous logging still works after disabling async mode") {
+        auto& logger = Logger::getInstance();
+        logger.disableAsyncMode(); // No-op if already synchronous
+        REQUIRE_NOTHROW(logger.info("Synchronous after async test"));
+    }
+}
+
 TEST_CASE("Logger Performance Macros", "[Logger][Performance]") {
     SECTION("Performance logging macro") {
         auto& logger = Logger::getInstance();
@@ -80,6 +121,43 @@ TEST_CASE("Logger Performance Macros", "[Logger][Performance]") {
     }
 }
 
+TEST_CASE("Logger Macro Lazy Evaluation", "[Logger][Macros]") {
+    SECTION("Disabled levels never evaluate their message arguments") {
+        auto& logger = Logger::getInstance();
+        logger.setLogLevel(LogLevel::ERROR_LEVEL);
+
+        int evaluations = 0;
+        auto buildMessage = [&evaluations]() {
+            evaluations++;
+            return std::string("expensive message");
+        };
+
+        // Below the runtime level: the lambda must not run
+        VKMON_DEBUG(buildMessage());
+        VKMON_INFO(buildMessage());
+        VKMON_WARNING(buildMessage());
+        REQUIRE(evaluations == 0);
+
+        // At or above the runtime level the argument evaluates as usual
+        VKMON_ERROR(buildMessage());
+        REQUIRE(evaluations == 1);
+
+        logger.setLogLevel(LogLevel::INFO_LEVEL); // restore default for other tests
+    }
+
+    SECTION("isLevelEnabled mirrors the runtime threshold") {
+        auto& logger = Logger::getInstance();
+        logger.setLogLevel(LogLevel::WARNING_LEVEL);
+
+        REQUIRE_FALSE(logger.isLevelEnabled(LogLevel::DEBUG_LEVEL));
+        REQUIRE_FALSE(logger.isLevelEnabled(LogLevel::INFO_LEVEL));
+        REQUIRE(logger.isLevelEnabled(LogLevel::WARNING_LEVEL));
+        REQUIRE(logger.isLevelEnabled(LogLevel::ERROR_LEVEL));
+
+        logger.setLogLevel(LogLevel::INFO_LEVEL); // restore default for other tests
+    }
+}
+
 TEST_CASE("Logger Vulkan Integration", "[Logger][Vulkan]") {
     SECTION("Vulkan-specific logging helpers") {
         REQUIRE_NOTHROW(VKMON_VK_INFO("Test Operation", "Additional details"));
@@ -238,6 +238,34 @@ TEST_CASE("MaterialSystem Vulkan Integration", "[MaterialSystem][Vulkan]") {
     }
 }
 
+TEST_CASE("MaterialSystem Dynamic Ring Design", "[MaterialSystem][Ring]") {
+    SECTION("Ring capacity constants") {
+        // One ring region per frame in flight keeps CPU writes off data
+        // the GPU is still reading
+        REQUIRE(MaterialSystem::MAX_MATERIALS == 256);
+        REQUIRE(MaterialSystem::FRAMES_IN_FLIGHT == 2);
+    }
+
+    SECTION("Dynamic offset arithmetic") {
+        // Offsets are slot-index * aligned stride within a frame region;
+        // verify the math for a worst-case 256-byte device alignment
+        VkDeviceSize minAlignment = 256;
+        VkDeviceSize alignedStride = (sizeof(MaterialData) + minAlignment - 1) & ~(minAlignment - 1);
+        REQUIRE(alignedStride % minAlignment == 0);
+        REQUIRE(alignedStride >= sizeof(MaterialData));
+
+        // Offsets for consecutive materials must not overlap a MaterialData
+        VkDeviceSize offset0 = 0 * alignedStride;
+        VkDeviceSize offset1 = 1 * alignedStride;
+        REQUIRE(offset1 - offset0 >= sizeof(MaterialData));
+
+        // Second frame region starts past the whole first region
+        VkDeviceSize frameSpan = alignedStride * MaterialSystem::MAX_MATERIALS;
+        REQUIRE(frameSpan + offset1 > frameSpan);
+        REQUIRE(frameSpan % minAlignment == 0);
+    }
+}
+
 TEST_CASE("MaterialSystem Performance Characteristics", "[MaterialSystem][Performance]") {
     SECTION("Material data creation performance") {
         // Test that material creation is efficient
@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/utils/MemoryTracker.h"
+
+using namespace VulkanMon;
+
+TEST_CASE("MemoryTracker tagged accounting", "[MemoryTracker][Performance]") {
+    auto& tracker = MemoryTracker::getInstance();
+    tracker.resetAll();
+
+    SECTION("Allocations and frees balance per tag") {
+        tracker.recordAllocation(MemoryTag::VulkanBuffers, 1024);
+        tracker.recordAllocation(MemoryTag::VulkanBuffers, 2048);
+        tracker.recordAllocation(MemoryTag::VulkanImages, 4096);
+
+        REQUIRE(tracker.getUsage(MemoryTag::VulkanBuffers) == 3072);
+        REQUIRE(tracker.getUsage(MemoryTag::VulkanImages) == 4096);
+        REQUIRE(tracker.getTotalUsage() == 7168);
+
+        tracker.recordFree(MemoryTag::VulkanBuffers, 2048);
+        REQUIRE(tracker.getUsage(MemoryTag::VulkanBuffers) == 1024);
+
+        tracker.recordFree(MemoryTag::VulkanBuffers, 1024);
+        tracker.recordFree(MemoryTag::VulkanImages, 4096);
+        REQUIRE(tracker.getTotalUsage() == 0);
+    }
+
+    SECTION("Gauge tags report absolute usage") {
+        tracker.setUsage(MemoryTag::SpatialSystem, 5000);
+        REQUIRE(tracker.getUsage(MemoryTag::SpatialSystem) == 5000);
+
+        // A gauge overwrites rather than accumulates
+        tracker.setUsage(MemoryTag::SpatialSystem, 3000);
+        REQUIRE(tracker.getUsage(MemoryTag::SpatialSystem) == 3000);
+    }
+
+    SECTION("Every tag has a display name") {
+        for (uint8_t i = 0; i < static_cast<uint8_t>(MemoryTag::COUNT); ++i) {
+            const char* name = MemoryTracker::tagName(static_cast<MemoryTag>(i));
+            REQUIRE(name != nullptr);
+            REQUIRE(std::string(name) != "Unknown");
+        }
+    }
+
+    tracker.resetAll();
+}
+
+TEST_CASE("MemoryTracker budget alarms", "[MemoryTracker][Performance]") {
+    auto& tracker = MemoryTracker::getInstance();
+    tracker.resetAll();
+
+    SECTION("Over-budget state tracks usage against the budget") {
+        tracker.setBudget(MemoryTag::Other, 1000);
+        REQUIRE_FALSE(tracker.isOverBudget(MemoryTag::Other));
+
+        tracker.recordAllocation(MemoryTag::Other, 800);
+        REQUIRE_FALSE(tracker.isOverBudget(MemoryTag::Other));
+
+        tracker.recordAllocation(MemoryTag::Other, 400);
+        REQUIRE(tracker.isOverBudget(MemoryTag::Other));
+
+        tracker.recordFree(MemoryTag::Other, 400);
+        REQUIRE_FALSE(tracker.isOverBudget(MemoryTag::Other));
+    }
+
+    SECTION("Zero budget never alarms") {
+        tracker.recordAllocation(MemoryTag::Other, 1'000'000'000);
+        REQUIRE_FALSE(tracker.isOverBudget(MemoryTag::Other));
+    }
+
+    SECTION("Setting a budget below current usage flags immediately") {
+        tracker.recordAllocation(MemoryTag::Other, 5000);
+        tracker.setBudget(MemoryTag::Other, 1000);
+        REQUIRE(tracker.isOverBudget(MemoryTag::Other));
+    }
+
+    tracker.resetAll();
+}
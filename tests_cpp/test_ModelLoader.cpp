@@ -23,6 +23,7 @@
 #include <type_traits>
 #include <unordered_set>
 #include <algorithm>
+#include <array>
 
 using namespace VulkanMon::Testing;
 using namespace VulkanMon;
@@ -350,6 +351,19 @@ TEST_CASE("Mesh Data Structure Integrity", "[ModelLoader][Mesh]") {
         }
     }
     
+    SECTION("Mesh geometry location defaults") {
+        // Before buffer creation a mesh has no GPU residence: null handles
+        // and zero pool offsets
+        Mesh mesh;
+
+        REQUIRE(mesh.vertexBufferHandle == VK_NULL_HANDLE);
+        REQUIRE(mesh.indexBufferHandle == VK_NULL_HANDLE);
+        REQUIRE(mesh.baseVertex == 0);
+        REQUIRE(mesh.firstIndex == 0);
+        REQUIRE(mesh.vertexBuffer == nullptr);
+        REQUIRE(mesh.indexBuffer == nullptr);
+    }
+
     SECTION("Empty mesh validation") {
         // Test empty mesh construction
         Mesh emptyMesh;
@@ -641,4 +655,173 @@ TEST_CASE("ModelLoader Statistics and Performance", "[ModelLoader][Performance]"
             REQUIRE(totalMemory < 100 * 1024 * 1024); // Less than 100MB for test models
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("LOD Chain Path Resolution", "[ModelLoader][LOD]") {
+    SECTION("Level 0 returns the base path unchanged") {
+        REQUIRE(ModelLoader::lodVariantPath("creature.obj", 0) == "creature.obj");
+        REQUIRE(ModelLoader::lodVariantPath("models/creature.fbx", 0) == "models/creature.fbx");
+    }
+
+    SECTION("Suffix is inserted before the extension") {
+        REQUIRE(ModelLoader::lodVariantPath("creature.obj", 1) == "creature_lod1.obj");
+        REQUIRE(ModelLoader::lodVariantPath("creature.obj", 2) == "creature_lod2.obj");
+        REQUIRE(ModelLoader::lodVariantPath("models/pikachu.gltf", 1) == "models/pikachu_lod1.gltf");
+    }
+
+    SECTION("Paths without an extension get the suffix appended") {
+        REQUIRE(ModelLoader::lodVariantPath("creature", 1) == "creature_lod1");
+
+        // A dot in a directory name is not an extension separator
+        REQUIRE(ModelLoader::lodVariantPath("models/v1.2/creature", 1) == "models/v1.2/creature_lod1");
+    }
+
+    SECTION("Selection levels fit the chain depth") {
+        // selectLodLevel in CreatureRenderSystem returns at most level 2,
+        // which must be a valid chain index
+        REQUIRE(ModelLoader::MAX_LOD_LEVELS == 3);
+    }
+}
+
+TEST_CASE("Cooked Mesh Sidecar Paths", "[ModelLoader][Cooked]") {
+    SECTION("Sidecar lives next to the source model") {
+        REQUIRE(ModelLoader::cookedMeshPath("creature.obj") == "creature.obj.vkmesh");
+        REQUIRE(ModelLoader::cookedMeshPath("models/pikachu.fbx") == "models/pikachu.fbx.vkmesh");
+    }
+
+    SECTION("LOD variants cook independently") {
+        // Each _lod<N> sibling is its own source file, so it gets its own
+        // sidecar and its own invalidation stamp
+        std::string lodPath = ModelLoader::lodVariantPath("creature.obj", 1);
+        REQUIRE(ModelLoader::cookedMeshPath(lodPath) == "creature_lod1.obj.vkmesh");
+    }
+
+    SECTION("Format version is pinned") {
+        // Bump VKMESH_VERSION whenever the on-disk layout changes; old
+        // sidecars then fail validation and re-cook instead of misloading
+        REQUIRE(ModelLoader::VKMESH_VERSION == 1);
+    }
+}
+
+TEST_CASE("Mesh Counts Survive Zero-Copy Loads", "[ModelLoader][Cooked]") {
+    SECTION("Counts are stored, not derived from the CPU vectors") {
+        // Cooked loads upload straight from the file mapping and never
+        // fill the vectors; draw encoding reads indexCount(), which must
+        // stay authoritative either way
+        Mesh mesh;
+        REQUIRE(mesh.vertexCount() == 0);
+        REQUIRE(mesh.indexCount() == 0);
+
+        mesh.numVertices = 58;
+        mesh.numIndices = 288;
+        REQUIRE(mesh.vertices.empty());
+        REQUIRE(mesh.vertexCount() == 58);
+        REQUIRE(mesh.indexCount() == 288);
+        REQUIRE(mesh.triangleCount() == 96);
+    }
+
+    SECTION("The counting constructor keeps both in sync") {
+        std::vector<ModelVertex> vertices(5);
+        std::vector<uint32_t> indices = {0, 1, 2, 2, 3, 4};
+        Mesh mesh(std::move(vertices), std::move(indices));
+        REQUIRE(mesh.vertexCount() == mesh.vertices.size());
+        REQUIRE(mesh.indexCount() == mesh.indices.size());
+    }
+}
+
+TEST_CASE("Vertex Cache and Fetch Optimization", "[ModelLoader][Optimize]") {
+    // Build an 8x8 grid of quads indexed in a deliberately cache-hostile
+    // column-major order
+    constexpr uint32_t GRID = 8;
+    std::vector<ModelVertex> vertices((GRID + 1) * (GRID + 1));
+    for (uint32_t y = 0; y <= GRID; ++y) {
+        for (uint32_t x = 0; x <= GRID; ++x) {
+            vertices[y * (GRID + 1) + x].position =
+                glm::vec3(static_cast<float>(x), static_cast<float>(y), 0.0f);
+        }
+    }
+    std::vector<uint32_t> indices;
+    for (uint32_t x = 0; x < GRID; ++x) {
+        for (uint32_t y = 0; y < GRID; ++y) {
+            uint32_t v0 = y * (GRID + 1) + x;
+            uint32_t v1 = v0 + 1;
+            uint32_t v2 = v0 + (GRID + 1);
+            uint32_t v3 = v2 + 1;
+            indices.insert(indices.end(), {v0, v1, v2, v1, v3, v2});
+        }
+    }
+
+    // FIFO cache miss counter - the standard ACMR measurement
+    auto cacheMisses = [](const std::vector<uint32_t>& idx, size_t cacheSize) {
+        std::vector<uint32_t> fifo;
+        size_t misses = 0;
+        for (uint32_t v : idx) {
+            if (std::find(fifo.begin(), fifo.end(), v) == fifo.end()) {
+                misses++;
+                fifo.insert(fifo.begin(), v);
+                if (fifo.size() > cacheSize) fifo.pop_back();
+            }
+        }
+        return misses;
+    };
+
+    SECTION("Cache optimization preserves the triangle set") {
+        auto optimized = indices;
+        ModelLoader::optimizeVertexCacheOrder(optimized, vertices.size());
+        REQUIRE(optimized.size() == indices.size());
+
+        auto canonicalTriangles = [](const std::vector<uint32_t>& idx) {
+            std::vector<std::array<uint32_t, 3>> tris;
+            for (size_t t = 0; t + 2 < idx.size(); t += 3) {
+                std::array<uint32_t, 3> tri = {idx[t], idx[t + 1], idx[t + 2]};
+                // Rotate the smallest index first - winding preserved
+                auto smallest = std::min_element(tri.begin(), tri.end());
+                std::rotate(tri.begin(), smallest, tri.end());
+                tris.push_back(tri);
+            }
+            std::sort(tris.begin(), tris.end());
+            return tris;
+        };
+        REQUIRE(canonicalTriangles(optimized) == canonicalTriangles(indices));
+    }
+
+    SECTION("Cache optimization does not increase misses on a hostile order") {
+        auto optimized = indices;
+        ModelLoader::optimizeVertexCacheOrder(optimized, vertices.size());
+        REQUIRE(cacheMisses(optimized, 16) <= cacheMisses(indices, 16));
+    }
+
+    SECTION("Fetch optimization produces first-use order") {
+        auto reorderedVertices = vertices;
+        auto reorderedIndices = indices;
+        ModelLoader::optimizeVertexCacheOrder(reorderedIndices, reorderedVertices.size());
+        ModelLoader::optimizeVertexFetchOrder(reorderedVertices, reorderedIndices);
+
+        REQUIRE(reorderedVertices.size() == vertices.size());
+
+        // Each new index must be at most one past the highest seen so far
+        uint32_t highest = 0;
+        for (uint32_t idx : reorderedIndices) {
+            REQUIRE(idx <= highest + 1);
+            highest = std::max(highest, idx);
+        }
+
+        // Geometry is unchanged: an index still resolves to a vertex that
+        // exists in the original buffer
+        REQUIRE(std::find_if(vertices.begin(), vertices.end(),
+                             [&](const ModelVertex& v) {
+                                 return v.position == reorderedVertices[reorderedIndices[0]].position;
+                             }) != vertices.end());
+    }
+
+    SECTION("Degenerate inputs pass through untouched") {
+        std::vector<uint32_t> single = {0, 1, 2};
+        auto copy = single;
+        ModelLoader::optimizeVertexCacheOrder(copy, 3);
+        REQUIRE(copy == single);
+
+        std::vector<ModelVertex> none;
+        std::vector<uint32_t> empty;
+        ModelLoader::optimizeVertexFetchOrder(none, empty);
+        REQUIRE(none.empty());
+    }
+}
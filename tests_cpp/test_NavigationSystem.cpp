@@ -0,0 +1,181 @@
+/*
+ * VulkanMon NavigationSystem Unit Tests
+ *
+ * Tests for the async path/steering request queue focusing on:
+ * - Goal queueing semantics (newest intent wins, cancel, despawn)
+ * - Path publication on the frame after dispatch
+ * - Waypoint following writing CreaturePhysicsComponent::inputDirection
+ * - Graceful no-op without a physics backend
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "../src/game/NavigationSystem.h"
+#include "../src/systems/PhysicsSystem.h"
+#include "../src/core/EntityManager.h"
+#include "../src/components/Transform.h"
+#include "../src/components/CreaturePhysicsComponent.h"
+#include "../src/components/RigidBodyComponent.h"
+#include "../src/components/CollisionComponent.h"
+#include "../src/utils/JobSystem.h"
+
+using namespace VulkanMon;
+using Catch::Approx;
+
+namespace {
+
+// Flat static terrain with its top surface at y = 0 for probes to hit
+void spawnGround(EntityManager& entityManager) {
+    EntityID ground = entityManager.createEntity();
+
+    Transform transform;
+    transform.position = glm::vec3(0.0f, -1.0f, 0.0f);
+    entityManager.addComponent(ground, transform);
+
+    entityManager.addComponent(ground, CollisionComponent::createTerrain());
+
+    RigidBodyComponent rigidBody;
+    rigidBody.isDynamic = false;
+    rigidBody.useGravity = false;
+    entityManager.addComponent(ground, rigidBody);
+}
+
+EntityID spawnCreature(EntityManager& entityManager, const glm::vec3& position) {
+    EntityID creature = entityManager.createEntity();
+
+    Transform transform;
+    transform.position = position;
+    entityManager.addComponent(creature, transform);
+
+    entityManager.addComponent(creature, CreaturePhysicsComponent{});
+    return creature;
+}
+
+// The solve job publishes on the update after it completes; waiting on
+// the job system first makes that second update deterministic
+void publishPaths(NavigationSystem& navSystem, EntityManager& entityManager) {
+    JobSystem::getInstance().waitIdle();
+    navSystem.update(0.016f, entityManager);
+}
+
+} // namespace
+
+TEST_CASE("NavigationSystem goal queue semantics", "[Navigation][Creature]") {
+    PhysicsSystem physicsSystem;
+    EntityManager entityManager;
+    physicsSystem.initialize(entityManager);
+    spawnGround(entityManager);
+    physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+
+    NavigationSystem navSystem;
+    navSystem.setPhysicsSystem(&physicsSystem);
+
+    EntityID creature = spawnCreature(entityManager, glm::vec3(0.0f, 1.0f, 0.0f));
+
+    SECTION("The newest goal for a creature replaces its pending one") {
+        navSystem.requestMoveTo(creature, glm::vec3(10.0f, 1.0f, 0.0f));
+        navSystem.requestMoveTo(creature, glm::vec3(0.0f, 1.0f, 12.0f));
+
+        navSystem.update(0.016f, entityManager);
+        CHECK(navSystem.getFrameStats().goalsDispatched == 1);
+
+        publishPaths(navSystem, entityManager);
+        // Steering heads toward the replacement goal in +Z, not the
+        // original +X one
+        auto& direction = entityManager.getComponent<CreaturePhysicsComponent>(creature).inputDirection;
+        CHECK(direction.z == Approx(1.0f));
+    }
+
+    SECTION("Goals already within reach dispatch nothing") {
+        navSystem.requestMoveTo(creature, glm::vec3(0.0f, 1.0f, 0.0f));
+
+        navSystem.update(0.016f, entityManager);
+        CHECK(navSystem.getFrameStats().goalsDispatched == 0);
+        CHECK(navSystem.getFrameStats().terrainProbesIssued == 0);
+    }
+
+    SECTION("cancelNavigation drops a queued goal") {
+        navSystem.requestMoveTo(creature, glm::vec3(10.0f, 1.0f, 0.0f));
+        navSystem.cancelNavigation(creature);
+
+        navSystem.update(0.016f, entityManager);
+        CHECK(navSystem.getFrameStats().goalsDispatched == 0);
+    }
+
+    SECTION("Creatures despawned while queued are skipped") {
+        EntityID doomed = spawnCreature(entityManager, glm::vec3(5.0f, 1.0f, 5.0f));
+        navSystem.requestMoveTo(doomed, glm::vec3(15.0f, 1.0f, 5.0f));
+        entityManager.destroyEntity(doomed);
+
+        navSystem.update(0.016f, entityManager);
+        CHECK(navSystem.getFrameStats().goalsDispatched == 0);
+        CHECK_FALSE(navSystem.isNavigating(doomed));
+    }
+
+    physicsSystem.shutdown(entityManager);
+}
+
+TEST_CASE("NavigationSystem path publication and following", "[Navigation][Creature]") {
+    PhysicsSystem physicsSystem;
+    EntityManager entityManager;
+    physicsSystem.initialize(entityManager);
+    spawnGround(entityManager);
+    physicsSystem.update(PhysicsSystem::FIXED_TIMESTEP_MS, entityManager);
+
+    NavigationSystem navSystem;
+    navSystem.setPhysicsSystem(&physicsSystem);
+
+    EntityID creature = spawnCreature(entityManager, glm::vec3(0.0f, 1.0f, 0.0f));
+    navSystem.requestMoveTo(creature, glm::vec3(12.0f, 1.0f, 0.0f));
+
+    // Frame N: the goal dispatches (one downward probe every PROBE_SPACING
+    // meters along the 12m goal line) but nothing steers yet
+    navSystem.update(0.016f, entityManager);
+    CHECK(navSystem.getFrameStats().goalsDispatched == 1);
+    CHECK(navSystem.getFrameStats().terrainProbesIssued == 6);
+    CHECK_FALSE(navSystem.isNavigating(creature));
+
+    // Frame N+1: the solved path publishes and steering begins
+    publishPaths(navSystem, entityManager);
+    CHECK(navSystem.getFrameStats().pathsPublished == 1);
+    CHECK(navSystem.getFrameStats().creaturesFollowing == 1);
+    REQUIRE(navSystem.isNavigating(creature));
+
+    auto& physics = entityManager.getComponent<CreaturePhysicsComponent>(creature);
+    CHECK(physics.inputDirection.x == Approx(1.0f));
+    CHECK(physics.inputDirection.y == 0.0f);
+
+    SECTION("Following the steering output walks the creature to the goal") {
+        auto& transform = entityManager.getComponent<Transform>(creature);
+        for (int i = 0; i < 200 && navSystem.isNavigating(creature); ++i) {
+            transform.position += physics.inputDirection * 0.4f;
+            navSystem.update(0.016f, entityManager);
+        }
+
+        CHECK_FALSE(navSystem.isNavigating(creature));
+        CHECK(physics.inputDirection == glm::vec3(0.0f));
+        CHECK(transform.position.x > 10.0f);  // last waypoint reached within tolerance
+    }
+
+    SECTION("cancelNavigation stops an active path") {
+        navSystem.cancelNavigation(creature);
+        CHECK_FALSE(navSystem.isNavigating(creature));
+    }
+
+    physicsSystem.shutdown(entityManager);
+}
+
+TEST_CASE("NavigationSystem without a physics backend is inert", "[Navigation][Creature]") {
+    EntityManager entityManager;
+    NavigationSystem navSystem;
+    // No physics system connected: goals queue but updates are no-ops
+
+    EntityID creature = spawnCreature(entityManager, glm::vec3(0.0f, 1.0f, 0.0f));
+    navSystem.requestMoveTo(creature, glm::vec3(10.0f, 1.0f, 0.0f));
+
+    navSystem.update(0.016f, entityManager);
+    CHECK(navSystem.getFrameStats().goalsDispatched == 0);
+    CHECK(navSystem.getFrameStats().terrainProbesIssued == 0);
+    CHECK_FALSE(navSystem.isNavigating(creature));
+}
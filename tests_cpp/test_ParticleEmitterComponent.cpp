@@ -0,0 +1,80 @@
+/*
+ * VulkanMon ParticleEmitterComponent Unit Tests
+ *
+ * Tests for the GPU particle emitter component focusing on:
+ * - Factory presets for the common effect archetypes
+ * - Burst staging and combination with continuous emission
+ * - Sensible defaults for the GPU emit request fields
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include "../src/components/ParticleEmitterComponent.h"
+
+using namespace VulkanMon;
+using Catch::Approx;
+
+TEST_CASE("ParticleEmitterComponent defaults", "[Particle][Component]") {
+    ParticleEmitterComponent emitter;
+
+    REQUIRE(emitter.enabled == true);
+    REQUIRE(emitter.emissionRate == 0.0f);
+    REQUIRE(emitter.emissionAccumulator == 0.0f);
+    REQUIRE(emitter.pendingBurst == 0);
+    REQUIRE(emitter.spread >= 0.0f);
+    REQUIRE(emitter.spread <= 1.0f);
+    REQUIRE(emitter.lifetimeSeconds > 0.0f);
+    REQUIRE(emitter.particleSize > 0.0f);
+}
+
+TEST_CASE("ParticleEmitterComponent factory presets", "[Particle][Component]") {
+    SECTION("createTrail emits continuously with short-lived particles") {
+        auto trail = ParticleEmitterComponent::createTrail(3, 120.0f);
+
+        REQUIRE(trail.emissionRate == Approx(120.0f));
+        REQUIRE(trail.pendingBurst == 0);
+        REQUIRE(trail.materialId == 3);
+        REQUIRE(trail.lifetimeSeconds < 1.0f);   // trails dissipate quickly
+        REQUIRE(trail.spread < 0.5f);            // narrow cone behind the projectile
+        REQUIRE(trail.drag > 0.0f);              // trail particles slow and hang
+    }
+
+    SECTION("createImpactBurst is one-shot and ballistic") {
+        auto burst = ParticleEmitterComponent::createImpactBurst(1, 64);
+
+        REQUIRE(burst.emissionRate == 0.0f);     // no continuous emission
+        REQUIRE(burst.pendingBurst == 64);
+        REQUIRE(burst.spread == Approx(1.0f));   // full sphere
+        REQUIRE(burst.gravityScale == Approx(1.0f)); // debris falls
+        REQUIRE(burst.materialId == 1);
+    }
+
+    SECTION("createAmbientSpores drifts slowly with long lifetimes") {
+        auto spores = ParticleEmitterComponent::createAmbientSpores(2, 8.0f);
+
+        REQUIRE(spores.emissionRate == Approx(8.0f));
+        REQUIRE(spores.baseSpeed < 1.0f);
+        REQUIRE(spores.lifetimeSeconds > 2.0f);
+        REQUIRE(spores.gravityScale < 0.0f);     // gentle updraft
+        REQUIRE(spores.materialId == 2);
+    }
+}
+
+TEST_CASE("ParticleEmitterComponent burst staging", "[Particle][Component]") {
+    ParticleEmitterComponent emitter;
+
+    SECTION("triggerBurst accumulates across calls") {
+        emitter.triggerBurst(10);
+        emitter.triggerBurst(5);
+        REQUIRE(emitter.pendingBurst == 15);
+    }
+
+    SECTION("bursts stack on top of continuous emission") {
+        auto trail = ParticleEmitterComponent::createTrail();
+        trail.triggerBurst(32);
+
+        REQUIRE(trail.emissionRate > 0.0f);
+        REQUIRE(trail.pendingBurst == 32);
+    }
+}
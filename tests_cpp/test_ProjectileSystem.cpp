@@ -18,6 +18,8 @@
 #include "../src/components/Renderable.h"
 #include "../src/components/SpatialComponent.h"
 #include "../src/core/World.h"
+#include "../src/systems/PhysicsSystem.h"
+#include "../src/components/CollisionComponent.h"
 #include "../src/systems/CameraSystem.h"
 #include "../src/systems/MaterialSystem.h"
 
@@ -352,8 +354,9 @@ TEST_CASE("ProjectileSystem Update and Cleanup", "[Projectile][System]") {
             projectileSystem->update(0.016f, entityManager);
         }
 
-        // Projectile should be destroyed
-        REQUIRE_FALSE(entityManager.hasComponent<ProjectileComponent>(projectile));
+        // Projectile is released to the pool rather than destroyed outright
+        REQUIRE(projectileSystem->getProjectileCount(entityManager) == 0);
+        REQUIRE(projectileSystem->getPooledProjectileCount() == 1);
     }
 
     SECTION("getProjectileCount returns correct count") {
@@ -410,6 +413,74 @@ TEST_CASE("ProjectileSystem Update and Cleanup", "[Projectile][System]") {
     }
 }
 
+TEST_CASE("ProjectileSystem Entity Pooling", "[Projectile][System]") {
+    SECTION("destroyed projectile is parked and reused by the next spawn") {
+        World world;
+        auto& entityManager = world.getEntityManager();
+
+        auto cameraSystem = std::make_unique<CameraSystem>();
+        EntityID cameraEntity = entityManager.createEntity();
+        Transform cameraTransform;
+        entityManager.addComponent(cameraEntity, cameraTransform);
+        Camera camera;
+        entityManager.addComponent(cameraEntity, camera);
+
+        auto projectileSystem = std::make_unique<ProjectileSystem>(cameraSystem.get(), nullptr);
+
+        EntityID first = projectileSystem->spawnProjectile(
+            glm::vec3(0.0f, 5.0f, 0.0f),
+            glm::vec3(0.0f, 0.0f, -1.0f),
+            entityManager,
+            ProjectileComponent::Type::BULLET);
+
+        projectileSystem->destroyProjectile(first, entityManager);
+
+        // Entity survives in the pool - hidden, parked, inactive
+        REQUIRE(projectileSystem->getProjectileCount(entityManager) == 0);
+        REQUIRE(projectileSystem->getPooledProjectileCount() == 1);
+        REQUIRE(entityManager.hasComponent<ProjectileComponent>(first));
+        REQUIRE_FALSE(entityManager.getComponent<Renderable>(first).isVisible);
+
+        // Next spawn reuses the parked entity by reset, not reconstruction
+        EntityID second = projectileSystem->spawnProjectile(
+            glm::vec3(2.0f, 5.0f, 0.0f),
+            glm::vec3(0.0f, 0.0f, -1.0f),
+            entityManager,
+            ProjectileComponent::Type::MAGIC_SPELL);
+
+        REQUIRE(second == first);
+        REQUIRE(projectileSystem->getPooledProjectileCount() == 0);
+        REQUIRE(entityManager.getComponent<Renderable>(second).isVisible);
+        REQUIRE(entityManager.getComponent<Transform>(second).position.x == Approx(2.0f));
+        REQUIRE(entityManager.getComponent<ProjectileComponent>(second).type == ProjectileComponent::Type::MAGIC_SPELL);
+        REQUIRE(entityManager.getComponent<ProjectileComponent>(second).timeSinceSpawn == 0.0f);
+    }
+
+    SECTION("prewarmPool pre-creates inactive pooled projectiles") {
+        World world;
+        auto& entityManager = world.getEntityManager();
+
+        auto cameraSystem = std::make_unique<CameraSystem>();
+        EntityID cameraEntity = entityManager.createEntity();
+        Transform cameraTransform;
+        entityManager.addComponent(cameraEntity, cameraTransform);
+        Camera camera;
+        entityManager.addComponent(cameraEntity, camera);
+
+        auto projectileSystem = std::make_unique<ProjectileSystem>(cameraSystem.get(), nullptr);
+
+        projectileSystem->prewarmPool(4, 0, entityManager);
+
+        REQUIRE(projectileSystem->getPooledProjectileCount() == 4);
+        REQUIRE(projectileSystem->getProjectileCount(entityManager) == 0);
+
+        // Prewarm must not count toward spawn/destroy statistics
+        auto stats = projectileSystem->getPerformanceStats();
+        REQUIRE(stats.projectilesSpawned == 0);
+        REQUIRE(stats.projectilesDestroyed == 0);
+    }
+}
+
 TEST_CASE("ProjectileSystem Performance", "[Projectile][System][Performance]") {
     SECTION("performance stats track update time") {
         World world;
@@ -441,3 +512,122 @@ TEST_CASE("ProjectileSystem Performance", "[Projectile][System][Performance]") {
         REQUIRE(stats.lastFrameUpdateTime >= 0.0f);
     }
 }
+
+TEST_CASE("ProjectileSystem Body-Less Fast Path", "[Projectile][System][Physics]") {
+    SECTION("factory presets choose the right physics mode") {
+        // Fast projectiles fly body-less - a swept raycast is exact CCD for a point
+        REQUIRE_FALSE(ProjectileComponent::createBullet().useHighPrecisionPhysics);
+        REQUIRE_FALSE(ProjectileComponent::createPokeball().useHighPrecisionPhysics);
+        REQUIRE_FALSE(ProjectileComponent::createMagicSpell().useHighPrecisionPhysics);
+
+        // Physics objects roll and settle - they need real Jolt contacts
+        REQUIRE(ProjectileComponent::createPhysicsObject().useHighPrecisionPhysics);
+    }
+
+    SECTION("body-less projectiles skip Jolt body creation") {
+        World world;
+        auto& entityManager = world.getEntityManager();
+
+        auto cameraSystem = std::make_unique<CameraSystem>();
+        EntityID cameraEntity = entityManager.createEntity();
+        Transform cameraTransform;
+        entityManager.addComponent(cameraEntity, cameraTransform);
+        Camera camera;
+        entityManager.addComponent(cameraEntity, camera);
+
+        PhysicsSystem physicsSystem;
+        physicsSystem.initialize(entityManager);
+
+        auto projectileSystem = std::make_unique<ProjectileSystem>(cameraSystem.get(), nullptr);
+        projectileSystem->setPhysicsSystem(&physicsSystem);
+
+        EntityID bullet = projectileSystem->spawnProjectile(
+            glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+            entityManager, ProjectileComponent::Type::BULLET);
+        REQUIRE_FALSE(entityManager.hasComponent<RigidBodyComponent>(bullet));
+        REQUIRE_FALSE(entityManager.hasComponent<CollisionComponent>(bullet));
+
+        EntityID crate = projectileSystem->spawnProjectile(
+            glm::vec3(1.0f, 5.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+            entityManager, ProjectileComponent::Type::PHYSICS_OBJECT);
+        REQUIRE(entityManager.hasComponent<RigidBodyComponent>(crate));
+        REQUIRE(entityManager.hasComponent<CollisionComponent>(crate));
+
+        physicsSystem.shutdown(entityManager);
+    }
+
+    SECTION("swept raycast catches a bullet that would tunnel") {
+        World world;
+        auto& entityManager = world.getEntityManager();
+
+        auto cameraSystem = std::make_unique<CameraSystem>();
+        EntityID cameraEntity = entityManager.createEntity();
+        Transform cameraTransform;
+        entityManager.addComponent(cameraEntity, cameraTransform);
+        Camera camera;
+        entityManager.addComponent(cameraEntity, camera);
+
+        PhysicsSystem physicsSystem;
+        physicsSystem.initialize(entityManager);
+
+        // Thin wall 10m down range
+        EntityID wall = entityManager.createEntity();
+        Transform wallTransform;
+        wallTransform.position = glm::vec3(0.0f, 5.0f, -10.0f);
+        entityManager.addComponent(wall, wallTransform);
+        entityManager.addComponent(wall, CollisionComponent::createEnvironment(glm::vec3(5.0f, 5.0f, 0.5f)));
+        RigidBodyComponent wallBody;
+        wallBody.isDynamic = false;
+        wallBody.mass = 0.0f;
+        entityManager.addComponent(wall, wallBody);
+
+        // Let the physics system create the wall's Jolt body
+        physicsSystem.update(16.7f, entityManager);
+
+        auto projectileSystem = std::make_unique<ProjectileSystem>(cameraSystem.get(), nullptr);
+        projectileSystem->setPhysicsSystem(&physicsSystem);
+
+        EntityID bullet = projectileSystem->spawnProjectile(
+            glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+            entityManager, ProjectileComponent::Type::BULLET, 100.0f);
+
+        // One 200ms frame moves the bullet 20m - straight through the wall for
+        // discrete collision, but the frame's swept raycast must catch it
+        projectileSystem->update(0.2f, entityManager);
+
+        REQUIRE_FALSE(entityManager.hasComponent<ProjectileComponent>(bullet));
+        REQUIRE(projectileSystem->getPerformanceStats().projectilesDestroyed == 1);
+
+        physicsSystem.shutdown(entityManager);
+    }
+
+    SECTION("body-less projectile flies freely with no obstacle") {
+        World world;
+        auto& entityManager = world.getEntityManager();
+
+        auto cameraSystem = std::make_unique<CameraSystem>();
+        EntityID cameraEntity = entityManager.createEntity();
+        Transform cameraTransform;
+        entityManager.addComponent(cameraEntity, cameraTransform);
+        Camera camera;
+        entityManager.addComponent(cameraEntity, camera);
+
+        PhysicsSystem physicsSystem;
+        physicsSystem.initialize(entityManager);
+
+        auto projectileSystem = std::make_unique<ProjectileSystem>(cameraSystem.get(), nullptr);
+        projectileSystem->setPhysicsSystem(&physicsSystem);
+
+        EntityID bullet = projectileSystem->spawnProjectile(
+            glm::vec3(0.0f, 5.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+            entityManager, ProjectileComponent::Type::BULLET, 50.0f);
+
+        projectileSystem->update(0.016f, entityManager);
+
+        REQUIRE(entityManager.hasComponent<ProjectileComponent>(bullet));
+        auto& transform = entityManager.getComponent<Transform>(bullet);
+        REQUIRE(transform.position.z < -0.5f);  // Moved down range analytically
+
+        physicsSystem.shutdown(entityManager);
+    }
+}
@@ -0,0 +1,47 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/systems/RenderSystem.h"
+
+using namespace VulkanMon;
+
+TEST_CASE("Packed render sort keys order layer, material, mesh, depth", "[RenderSystem][Rendering]") {
+    AssetID meshA = AssetID::intern("sortkey_mesh_a.obj");
+    AssetID meshB = AssetID::intern("sortkey_mesh_b.obj");
+    constexpr float MAX_DISTANCE = 1000.0f;
+
+    SECTION("Render layer dominates every other field") {
+        uint64_t lowLayer = RenderSystem::makeSortKey(0, 0xFFFF, meshB, MAX_DISTANCE, MAX_DISTANCE);
+        uint64_t highLayer = RenderSystem::makeSortKey(1, 0, meshA, 0.0f, MAX_DISTANCE);
+
+        REQUIRE(lowLayer < highLayer);
+    }
+
+    SECTION("Material groups draws within a layer") {
+        uint64_t materialTwoNear = RenderSystem::makeSortKey(0, 2, meshA, 1.0f, MAX_DISTANCE);
+        uint64_t materialThreeFar = RenderSystem::makeSortKey(0, 3, meshA, 999.0f, MAX_DISTANCE);
+
+        REQUIRE(materialTwoNear < materialThreeFar);
+    }
+
+    SECTION("Identical meshes sort adjacent within a material") {
+        uint64_t sameMeshFar = RenderSystem::makeSortKey(0, 1, meshA, 900.0f, MAX_DISTANCE);
+        uint64_t sameMeshNear = RenderSystem::makeSortKey(0, 1, meshA, 10.0f, MAX_DISTANCE);
+        uint64_t otherMesh = RenderSystem::makeSortKey(0, 1, meshB, 10.0f, MAX_DISTANCE);
+
+        // Both meshA draws fall on the same side of the meshB draw
+        REQUIRE(((sameMeshFar < otherMesh) == (sameMeshNear < otherMesh)));
+    }
+
+    SECTION("Depth orders front to back within a mesh") {
+        uint64_t nearKey = RenderSystem::makeSortKey(0, 1, meshA, 10.0f, MAX_DISTANCE);
+        uint64_t farKey = RenderSystem::makeSortKey(0, 1, meshA, 500.0f, MAX_DISTANCE);
+
+        REQUIRE(nearKey < farKey);
+    }
+
+    SECTION("Depth saturates beyond the cull distance") {
+        uint64_t atLimit = RenderSystem::makeSortKey(0, 1, meshA, MAX_DISTANCE, MAX_DISTANCE);
+        uint64_t beyondLimit = RenderSystem::makeSortKey(0, 1, meshA, MAX_DISTANCE * 10.0f, MAX_DISTANCE);
+
+        REQUIRE(atLimit == beyondLimit);
+    }
+}
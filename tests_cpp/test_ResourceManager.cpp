@@ -202,6 +202,63 @@ TEST_CASE("ResourceManager Memory Management", "[ResourceManager][Memory]") {
     }
 }
 
+TEST_CASE("BufferPool Suballocation Design", "[ResourceManager][BufferPool]") {
+    SECTION("BufferPool RAII design validation") {
+        // Test that BufferPool follows move-only RAII principles
+        REQUIRE_FALSE(std::is_copy_constructible_v<VulkanMon::BufferPool>);
+        REQUIRE_FALSE(std::is_copy_assignable_v<VulkanMon::BufferPool>);
+        REQUIRE(std::is_move_constructible_v<VulkanMon::BufferPool>);
+        REQUIRE(std::is_move_assignable_v<VulkanMon::BufferPool>);
+    }
+
+    SECTION("Invalid offset sentinel is distinguishable from real offsets") {
+        // INVALID_OFFSET marks pool exhaustion; it must never collide with
+        // a valid suballocation offset inside any practical pool capacity
+        REQUIRE(VulkanMon::BufferPool::INVALID_OFFSET == ~VkDeviceSize(0));
+
+        VkDeviceSize practicalCapacity = VkDeviceSize(256) * 1024 * 1024;
+        REQUIRE(VulkanMon::BufferPool::INVALID_OFFSET > practicalCapacity);
+    }
+}
+
+TEST_CASE("MemoryAllocator Suballocation Design", "[ResourceManager][MemoryAllocator]") {
+    SECTION("MemoryAllocator is pinned in place") {
+        // Managed resources hold raw pointers back to the allocator, so
+        // it must be neither copyable nor movable
+        REQUIRE_FALSE(std::is_copy_constructible_v<VulkanMon::MemoryAllocator>);
+        REQUIRE_FALSE(std::is_copy_assignable_v<VulkanMon::MemoryAllocator>);
+        REQUIRE_FALSE(std::is_move_constructible_v<VulkanMon::MemoryAllocator>);
+        REQUIRE_FALSE(std::is_move_assignable_v<VulkanMon::MemoryAllocator>);
+    }
+
+    SECTION("Default allocation is distinguishable from a real one") {
+        // A default-constructed Allocation must read as invalid so
+        // cleanup paths can skip freeing moved-from resources
+        VulkanMon::MemoryAllocator::Allocation allocation;
+        REQUIRE_FALSE(allocation.isValid());
+        REQUIRE(allocation.memory == VK_NULL_HANDLE);
+        REQUIRE(allocation.blockIndex == UINT32_MAX);
+    }
+
+    SECTION("Block size keeps allocation counts under driver caps") {
+        // 64MB blocks mean even multi-gigabyte scenes stay far below the
+        // common 4096 vkAllocateMemory driver limit
+        constexpr VkDeviceSize blockSize = VulkanMon::MemoryAllocator::DEFAULT_BLOCK_SIZE;
+        REQUIRE(blockSize == VkDeviceSize(64) * 1024 * 1024);
+
+        VkDeviceSize fourGigabytes = VkDeviceSize(4) * 1024 * 1024 * 1024;
+        REQUIRE(fourGigabytes / blockSize < 4096);
+    }
+
+    SECTION("Statistics start empty") {
+        VulkanMon::MemoryAllocator::Statistics stats;
+        REQUIRE(stats.blockCount == 0);
+        REQUIRE(stats.activeAllocations == 0);
+        REQUIRE(stats.usedBytes == 0);
+        REQUIRE(stats.freeRangeCount == 0);
+    }
+}
+
 // Note: Full functional tests requiring actual Vulkan device and context
 // should be in integration test suite. These tests validate interface design,
 // RAII principles, and move semantics at compile time without requiring
@@ -0,0 +1,81 @@
+/**
+ * VulkanMon ShaderSpecialization Unit Tests
+ *
+ * Testing compile-time shader feature selection:
+ * - ShaderFeatures cache keys distinguish every feature combination
+ * - ShaderSpecialization builds a VkSpecializationInfo that maps the
+ *   constant IDs shared with the fragment shaders
+ *
+ * No Vulkan device is required - specialization data is pure CPU state.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "../src/rendering/ShaderSpecialization.h"
+
+#include <set>
+
+using VulkanMon::ShaderFeatures;
+using VulkanMon::ShaderSpecialization;
+
+TEST_CASE("ShaderFeatures cache keys are unique per combination", "[ShaderSpecialization]") {
+    std::set<uint32_t> keys;
+    for (VkBool32 ambient : {VK_FALSE, VK_TRUE}) {
+        for (uint32_t model : {ShaderFeatures::SPECULAR_OFF,
+                               ShaderFeatures::SPECULAR_BLINN_PHONG,
+                               ShaderFeatures::SPECULAR_PHONG}) {
+            ShaderFeatures features;
+            features.enableAmbient = ambient;
+            features.specularModel = model;
+            keys.insert(features.cacheKey());
+        }
+    }
+
+    // 2 ambient states x 3 specular models = 6 distinct variants
+    REQUIRE(keys.size() == 6);
+}
+
+TEST_CASE("ShaderFeatures default matches the shader defaults", "[ShaderSpecialization]") {
+    ShaderFeatures features;
+
+    // Must mirror the constant_id initializers in triangle.frag and
+    // instanced.frag so the unspecialized pipeline renders identically
+    REQUIRE(features.enableAmbient == VK_TRUE);
+    REQUIRE(features.specularModel == ShaderFeatures::SPECULAR_BLINN_PHONG);
+    REQUIRE(features == ShaderFeatures{});
+}
+
+TEST_CASE("ShaderSpecialization maps both constant IDs", "[ShaderSpecialization]") {
+    ShaderFeatures features;
+    features.enableAmbient = VK_FALSE;
+    features.specularModel = ShaderFeatures::SPECULAR_PHONG;
+
+    ShaderSpecialization spec(features);
+
+    REQUIRE(spec.info.mapEntryCount == 2);
+    REQUIRE(spec.info.pMapEntries == spec.entries.data());
+    REQUIRE(spec.info.dataSize == sizeof(ShaderFeatures));
+    REQUIRE(spec.info.pData == &spec.features);
+
+    REQUIRE(spec.entries[0].constantID == ShaderSpecialization::CONSTANT_ID_ENABLE_AMBIENT);
+    REQUIRE(spec.entries[0].offset == offsetof(ShaderFeatures, enableAmbient));
+    REQUIRE(spec.entries[0].size == sizeof(VkBool32));
+
+    REQUIRE(spec.entries[1].constantID == ShaderSpecialization::CONSTANT_ID_SPECULAR_MODEL);
+    REQUIRE(spec.entries[1].offset == offsetof(ShaderFeatures, specularModel));
+    REQUIRE(spec.entries[1].size == sizeof(uint32_t));
+}
+
+TEST_CASE("ShaderSpecialization carries the requested feature values", "[ShaderSpecialization]") {
+    ShaderFeatures features;
+    features.enableAmbient = VK_FALSE;
+    features.specularModel = ShaderFeatures::SPECULAR_OFF;
+
+    ShaderSpecialization spec(features);
+
+    // The driver reads pData through the map entries - verify the copied
+    // payload holds exactly what was requested
+    const auto* payload = static_cast<const ShaderFeatures*>(spec.info.pData);
+    REQUIRE(payload->enableAmbient == VK_FALSE);
+    REQUIRE(payload->specularModel == ShaderFeatures::SPECULAR_OFF);
+    REQUIRE(*payload == features);
+}
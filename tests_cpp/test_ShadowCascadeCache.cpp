@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/rendering/ShadowCascadeCache.h"
+
+#include <glm/glm.hpp>
+#include <cmath>
+
+using namespace VulkanMon;
+
+namespace {
+
+// Camera at the origin looking down -Z, 45 degree vertical FOV at 16:9
+const float TAN_HALF_FOV_Y = std::tan(glm::radians(22.5f));
+constexpr float ASPECT = 16.0f / 9.0f;
+constexpr float Z_NEAR = 0.1f;
+const glm::vec3 SUN_DIR(0.0f, -1.0f, 0.0f);
+
+glm::mat4 cameraAtX(float x) {
+    glm::mat4 view(1.0f);
+    view[3][0] = -x;
+    return view;
+}
+
+void renderAllStatics(ShadowCascadeCache& cache) {
+    for (uint32_t i = 0; i < cache.cascadeCount(); ++i) {
+        cache.markStaticRendered(i);
+    }
+}
+
+bool anyStaticDirty(const ShadowCascadeCache& cache) {
+    for (uint32_t i = 0; i < cache.cascadeCount(); ++i) {
+        if (cache.cascade(i).staticDirty) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+TEST_CASE("Cascade splits cover near to max shadow distance", "[ShadowCascadeCache]") {
+    ShadowCascadeCache cache;
+    cache.update(cameraAtX(0.0f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR, SUN_DIR, 1);
+
+    float previous = Z_NEAR;
+    for (uint32_t i = 0; i < cache.cascadeCount(); ++i) {
+        const auto& cascade = cache.cascade(i);
+        REQUIRE(cascade.splitNear == previous);
+        REQUIRE(cascade.splitFar > cascade.splitNear);
+        previous = cascade.splitFar;
+    }
+    REQUIRE(previous == Catch::Approx(cache.config().maxShadowDistance));
+}
+
+TEST_CASE("Static layer is cached while nothing moves", "[ShadowCascadeCache]") {
+    ShadowCascadeCache cache;
+
+    // First frame: no cached map exists yet, everything renders
+    cache.update(cameraAtX(0.0f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR, SUN_DIR, 1);
+    REQUIRE(anyStaticDirty(cache));
+    renderAllStatics(cache);
+
+    // Identical frame: every cascade reuses its cached static layer
+    cache.update(cameraAtX(0.0f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR, SUN_DIR, 1);
+    REQUIRE_FALSE(anyStaticDirty(cache));
+}
+
+TEST_CASE("Sub-texel camera motion keeps the cache, larger motion sheds it", "[ShadowCascadeCache]") {
+    ShadowCascadeCache cache;
+    cache.update(cameraAtX(0.0f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR, SUN_DIR, 1);
+    renderAllStatics(cache);
+
+    // Texel-snapped placement absorbs a pan far below one shadow texel
+    cache.update(cameraAtX(0.00001f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR, SUN_DIR, 1);
+    REQUIRE_FALSE(anyStaticDirty(cache));
+
+    // A pan of many texels moves the cascades and invalidates the cache
+    cache.update(cameraAtX(5.0f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR, SUN_DIR, 1);
+    REQUIRE(anyStaticDirty(cache));
+}
+
+TEST_CASE("Static content version tick re-renders every cascade", "[ShadowCascadeCache]") {
+    ShadowCascadeCache cache;
+    cache.update(cameraAtX(0.0f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR, SUN_DIR, 1);
+    renderAllStatics(cache);
+
+    cache.update(cameraAtX(0.0f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR, SUN_DIR, 2);
+    for (uint32_t i = 0; i < cache.cascadeCount(); ++i) {
+        REQUIRE(cache.cascade(i).staticDirty);
+    }
+}
+
+TEST_CASE("Light direction change invalidates the cache", "[ShadowCascadeCache]") {
+    ShadowCascadeCache cache;
+    cache.update(cameraAtX(0.0f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR, SUN_DIR, 1);
+    renderAllStatics(cache);
+
+    cache.update(cameraAtX(0.0f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR,
+                 glm::vec3(0.3f, -1.0f, 0.2f), 1);
+    REQUIRE(anyStaticDirty(cache));
+}
+
+TEST_CASE("Points inside a cascade slice land inside its clip box", "[ShadowCascadeCache]") {
+    ShadowCascadeCache cache;
+    cache.update(cameraAtX(0.0f), TAN_HALF_FOV_Y, ASPECT, Z_NEAR, SUN_DIR, 1);
+
+    for (uint32_t i = 0; i < cache.cascadeCount(); ++i) {
+        const auto& cascade = cache.cascade(i);
+        float depth = 0.5f * (cascade.splitNear + cascade.splitFar);
+        glm::vec4 clip = cascade.lightViewProj * glm::vec4(0.0f, 0.0f, -depth, 1.0f);
+
+        REQUIRE(std::abs(clip.x) <= 1.0f);
+        REQUIRE(std::abs(clip.y) <= 1.0f);
+        REQUIRE(std::abs(clip.z) <= 1.0f);
+    }
+}
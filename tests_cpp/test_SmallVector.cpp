@@ -0,0 +1,104 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/utils/SmallVector.h"
+
+#include <string>
+#include <utility>
+
+using VulkanMon::SmallVector;
+
+TEST_CASE("SmallVector inline storage and heap spill", "[SmallVector][Utils]") {
+    SECTION("Stays inline up to N elements") {
+        SmallVector<int, 4> v;
+        REQUIRE(v.empty());
+        REQUIRE(v.isInline());
+        REQUIRE(v.capacity() == 4);
+
+        for (int i = 0; i < 4; ++i) {
+            v.push_back(i);
+        }
+        REQUIRE(v.isInline());
+        REQUIRE(v.size() == 4);
+    }
+
+    SECTION("Spills to the heap past N and keeps contents") {
+        SmallVector<int, 4> v;
+        for (int i = 0; i < 10; ++i) {
+            v.push_back(i);
+        }
+        REQUIRE_FALSE(v.isInline());
+        REQUIRE(v.size() == 10);
+        for (int i = 0; i < 10; ++i) {
+            REQUIRE(v[i] == i);
+        }
+    }
+
+    SECTION("clear keeps capacity, resize value-constructs growth") {
+        SmallVector<int, 2> v;
+        v.push_back(7);
+        v.push_back(8);
+        v.push_back(9);
+        size_t spilledCapacity = v.capacity();
+
+        v.clear();
+        REQUIRE(v.empty());
+        REQUIRE(v.capacity() == spilledCapacity);
+
+        v.resize(3);
+        REQUIRE(v.size() == 3);
+        REQUIRE(v[0] == 0); // value-constructed, not stale
+    }
+}
+
+TEST_CASE("SmallVector copy and move semantics", "[SmallVector][Utils]") {
+    SECTION("Copies compare equal element-wise") {
+        SmallVector<std::string, 2> v;
+        v.push_back("one");
+        v.push_back("two");
+        v.push_back("three"); // spilled
+
+        SmallVector<std::string, 2> copy = v;
+        REQUIRE(copy == v);
+        REQUIRE(copy[2] == "three");
+    }
+
+    SECTION("Moving a spilled vector steals the heap buffer") {
+        SmallVector<std::string, 1> v;
+        v.push_back("a");
+        v.push_back("b");
+        const std::string* heapData = v.data();
+
+        SmallVector<std::string, 1> moved = std::move(v);
+        REQUIRE(moved.data() == heapData); // buffer stolen, no copy
+        REQUIRE(moved.size() == 2);
+        REQUIRE(v.empty());
+        REQUIRE(v.isInline()); // source reset to its inline buffer
+    }
+
+    SECTION("Moving an inline vector moves elements, source stays usable") {
+        SmallVector<std::string, 4> v;
+        v.push_back("inline");
+
+        SmallVector<std::string, 4> moved = std::move(v);
+        REQUIRE(moved.isInline());
+        REQUIRE(moved[0] == "inline");
+        REQUIRE(v.empty());
+
+        v.push_back("reused");
+        REQUIRE(v.size() == 1);
+    }
+}
+
+TEST_CASE("SmallVector supports range iteration", "[SmallVector][Utils]") {
+    SmallVector<int, 8> v;
+    for (int i = 1; i <= 5; ++i) {
+        v.push_back(i);
+    }
+
+    int sum = 0;
+    for (int value : v) {
+        sum += value;
+    }
+    REQUIRE(sum == 15);
+    REQUIRE(v.front() == 1);
+    REQUIRE(v.back() == 5);
+}
@@ -0,0 +1,155 @@
+/*
+ * VulkanMon Coroutine Task Unit Tests
+ *
+ * Tests for the Task<T> coroutine type and its JobSystem awaiters:
+ * - Lazy start, co_await composition, and value/exception propagation
+ * - Detached root launch and self-cleanup
+ * - resumeOnWorker / resumeOnMainThread thread hops
+ * - resumeWhen parking and MainThreadTaskQueue pumping
+ *
+ * The main-thread queue is pumped manually here (no Application frame
+ * loop), which makes the resume points deterministic.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/utils/Task.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using namespace VulkanMon;
+
+namespace {
+
+// Drain both queues so one test's stragglers never resume inside another
+void settle() {
+    JobSystem::getInstance().waitIdle();
+    MainThreadTaskQueue::getInstance().pump();
+}
+
+Task<int> returnSeven() {
+    co_return 7;
+}
+
+Task<int> sumOfLeaves() {
+    int a = co_await returnSeven();
+    int b = co_await returnSeven();
+    co_return a + b;
+}
+
+Task<int> throwingTask() {
+    throw std::runtime_error("task failure");
+    co_return 0;  // unreachable, keeps this a coroutine
+}
+
+} // namespace
+
+TEST_CASE("Task composition and lifetime", "[Task]") {
+    SECTION("co_await chains child results synchronously") {
+        std::atomic<int> result{0};
+        std::atomic<bool> finished{false};
+
+        auto root = [&]() -> Task<> {
+            result = co_await sumOfLeaves();
+            finished = true;
+        };
+        root().startDetached();
+
+        // No thread hops in the chain: the detached root runs to
+        // completion inside startDetached()
+        REQUIRE(finished.load());
+        REQUIRE(result.load() == 14);
+    }
+
+    SECTION("unstarted task destroys its frame without running") {
+        std::atomic<bool> ran{false};
+        {
+            auto task = [&]() -> Task<int> {
+                ran = true;
+                co_return 42;
+            }();
+            // Task is lazy: dropped before start, the body never runs
+        }
+        REQUIRE_FALSE(ran.load());
+    }
+
+    SECTION("exceptions rethrow at the parent's co_await") {
+        std::atomic<bool> caught{false};
+
+        auto root = [&]() -> Task<> {
+            try {
+                (void)co_await throwingTask();
+            } catch (const std::runtime_error&) {
+                caught = true;
+            }
+        };
+        root().startDetached();
+
+        REQUIRE(caught.load());
+    }
+}
+
+TEST_CASE("Task scheduling awaiters", "[Task]") {
+    auto& queue = MainThreadTaskQueue::getInstance();
+
+    SECTION("resumeOnWorker then resumeOnMainThread round-trips") {
+        const auto mainThreadId = std::this_thread::get_id();
+        std::atomic<bool> hoppedOffMain{false};
+        std::atomic<bool> resumedOnMain{false};
+
+        auto root = [&]() -> Task<> {
+            co_await resumeOnWorker(JobPriority::Low);
+            hoppedOffMain = (std::this_thread::get_id() != mainThreadId);
+            co_await resumeOnMainThread();
+            resumedOnMain = (std::this_thread::get_id() == mainThreadId);
+        };
+        root().startDetached();
+
+        // Pump until the worker hop lands back on this thread
+        for (int i = 0; i < 500 && !resumedOnMain.load(); ++i) {
+            queue.pump();
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+
+        REQUIRE(hoppedOffMain.load());
+        REQUIRE(resumedOnMain.load());
+        settle();
+    }
+
+    SECTION("resumeWhen parks until the predicate turns true") {
+        std::atomic<bool> condition{false};
+        std::atomic<bool> resumed{false};
+
+        auto root = [&]() -> Task<> {
+            co_await resumeWhen([&] { return condition.load(); });
+            resumed = true;
+        };
+        root().startDetached();
+
+        queue.pump();
+        REQUIRE_FALSE(resumed.load());
+        REQUIRE(queue.getPendingCount() == 1);
+
+        condition = true;
+        queue.pump();
+        REQUIRE(resumed.load());
+        REQUIRE(queue.getPendingCount() == 0);
+    }
+
+    SECTION("resumeWhen with an already-true predicate never suspends") {
+        std::atomic<bool> resumed{false};
+
+        auto root = [&]() -> Task<> {
+            co_await resumeWhen([] { return true; });
+            resumed = true;
+        };
+        root().startDetached();
+
+        // Completed inside startDetached - nothing was queued
+        REQUIRE(resumed.load());
+        REQUIRE(queue.getPendingCount() == 0);
+    }
+}
@@ -0,0 +1,35 @@
+/*
+ * VulkanMon TransferManager Unit Tests
+ *
+ * Focused tests for the async upload system following our philosophy:
+ * - "Simple is Powerful" - Test interface contracts without full Vulkan setup
+ * - "Test, Test, Test" - Verify RAII principles and sizing invariants
+ * - "Document Often" - Clear test names that document expected behavior
+ *
+ * Note: Functional upload tests require a real Vulkan device and queues;
+ * these validate design-level properties at compile time
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <type_traits>
+
+#include "../src/rendering/TransferManager.h"
+
+using namespace VulkanMon;
+
+TEST_CASE("TransferManager RAII Design", "[TransferManager][RAII]") {
+    SECTION("Non-copyable and non-movable") {
+        // The manager owns queues, pools, and a persistently mapped ring;
+        // it is pinned in place for its whole lifetime
+        REQUIRE_FALSE(std::is_copy_constructible_v<TransferManager>);
+        REQUIRE_FALSE(std::is_copy_assignable_v<TransferManager>);
+        REQUIRE_FALSE(std::is_move_constructible_v<TransferManager>);
+        REQUIRE_FALSE(std::is_move_assignable_v<TransferManager>);
+    }
+
+    SECTION("Destructor drains uploads") {
+        // Compile-time check that destruction is well-defined; the
+        // destructor blocks on waitForAllUploads before freeing staging
+        REQUIRE(std::is_destructible_v<TransferManager>);
+    }
+}
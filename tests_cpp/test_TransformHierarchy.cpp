@@ -0,0 +1,139 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/core/World.h"
+#include "../src/components/Transform.h"
+#include "../src/systems/TransformHierarchySystem.h"
+
+#include <glm/glm.hpp>
+
+using namespace VulkanMon;
+
+namespace {
+
+EntityID makeEntity(World& world, const glm::vec3& position, EntityID parent = INVALID_ENTITY) {
+    EntityID entity = world.createEntity();
+    Transform transform;
+    transform.setPosition(position);
+    transform.parent = parent;
+    world.addComponent(entity, transform);
+    return entity;
+}
+
+} // namespace
+
+TEST_CASE("TransformHierarchy world matrix composition", "[TransformHierarchy][ECS]") {
+    World world;
+    world.addSystem<TransformHierarchySystem>();
+    world.initialize();
+
+    SECTION("Child composes parent world with local offset") {
+        EntityID parent = makeEntity(world, glm::vec3(10.0f, 0.0f, 0.0f));
+        EntityID child = makeEntity(world, glm::vec3(0.0f, 2.0f, 0.0f), parent);
+
+        world.update(0.016f);
+
+        Transform& childTransform = world.getComponent<Transform>(child);
+        REQUIRE(childTransform.worldComposed);
+
+        glm::vec3 worldPos = childTransform.getWorldPosition();
+        REQUIRE(worldPos.x == Catch::Approx(10.0f).margin(0.001f));
+        REQUIRE(worldPos.y == Catch::Approx(2.0f).margin(0.001f));
+        REQUIRE(worldPos.z == Catch::Approx(0.0f).margin(0.001f));
+
+        // Roots never get a composed matrix - world equals local
+        Transform& parentTransform = world.getComponent<Transform>(parent);
+        REQUIRE_FALSE(parentTransform.worldComposed);
+    }
+
+    SECTION("Grandchild chains compose through the whole lineage") {
+        EntityID root = makeEntity(world, glm::vec3(5.0f, 0.0f, 0.0f));
+        EntityID child = makeEntity(world, glm::vec3(0.0f, 3.0f, 0.0f), root);
+        EntityID grandchild = makeEntity(world, glm::vec3(0.0f, 0.0f, 1.0f), child);
+
+        world.update(0.016f);
+
+        glm::vec3 worldPos = world.getComponent<Transform>(grandchild).getWorldPosition();
+        REQUIRE(worldPos.x == Catch::Approx(5.0f).margin(0.001f));
+        REQUIRE(worldPos.y == Catch::Approx(3.0f).margin(0.001f));
+        REQUIRE(worldPos.z == Catch::Approx(1.0f).margin(0.001f));
+    }
+}
+
+TEST_CASE("TransformHierarchy dirty tracking", "[TransformHierarchy][ECS]") {
+    World world;
+    auto* hierarchy = world.addSystem<TransformHierarchySystem>();
+    world.initialize();
+
+    EntityID parent = makeEntity(world, glm::vec3(1.0f, 0.0f, 0.0f));
+    EntityID childA = makeEntity(world, glm::vec3(0.0f, 1.0f, 0.0f), parent);
+    EntityID childB = makeEntity(world, glm::vec3(0.0f, -1.0f, 0.0f), parent);
+
+    world.update(0.016f);
+    REQUIRE(hierarchy->getFrameStats().composedThisFrame == 2);
+
+    SECTION("Static subtrees compose nothing") {
+        world.update(0.016f);
+        REQUIRE(hierarchy->getFrameStats().composedThisFrame == 0);
+    }
+
+    SECTION("Moving the root recomposes every child") {
+        world.getComponent<Transform>(parent).setPosition(glm::vec3(2.0f, 0.0f, 0.0f));
+        world.update(0.016f);
+
+        REQUIRE(hierarchy->getFrameStats().composedThisFrame == 2);
+        glm::vec3 worldPos = world.getComponent<Transform>(childA).getWorldPosition();
+        REQUIRE(worldPos.x == Catch::Approx(2.0f).margin(0.001f));
+    }
+
+    SECTION("Moving one child leaves its sibling untouched") {
+        world.getComponent<Transform>(childA).setPosition(glm::vec3(0.0f, 5.0f, 0.0f));
+        world.update(0.016f);
+
+        REQUIRE(hierarchy->getFrameStats().composedThisFrame == 1);
+    }
+
+    SECTION("Update order rebuilds only on topology change") {
+        size_t rebuilds = hierarchy->getFrameStats().orderRebuilds;
+        world.update(0.016f);
+        REQUIRE(hierarchy->getFrameStats().orderRebuilds == rebuilds);
+
+        world.getComponent<Transform>(childB).setParent(INVALID_ENTITY);
+        world.update(0.016f);
+        REQUIRE(hierarchy->getFrameStats().orderRebuilds == rebuilds + 1);
+    }
+}
+
+TEST_CASE("TransformHierarchy reparenting", "[TransformHierarchy][ECS]") {
+    World world;
+    auto* hierarchy = world.addSystem<TransformHierarchySystem>();
+    world.initialize();
+
+    EntityID parent = makeEntity(world, glm::vec3(4.0f, 0.0f, 0.0f));
+    EntityID child = makeEntity(world, glm::vec3(0.0f, 1.0f, 0.0f), parent);
+
+    world.update(0.016f);
+    REQUIRE(world.getComponent<Transform>(child).worldComposed);
+
+    SECTION("Detaching clears the composed matrix") {
+        world.getComponent<Transform>(child).setParent(INVALID_ENTITY);
+        world.update(0.016f);
+
+        Transform& childTransform = world.getComponent<Transform>(child);
+        REQUIRE_FALSE(childTransform.worldComposed);
+
+        // World falls back to local space
+        glm::vec3 worldPos = childTransform.getWorldPosition();
+        REQUIRE(worldPos.x == Catch::Approx(0.0f).margin(0.001f));
+        REQUIRE(worldPos.y == Catch::Approx(1.0f).margin(0.001f));
+    }
+
+    SECTION("Reparenting composes against the new parent") {
+        EntityID newParent = makeEntity(world, glm::vec3(-3.0f, 0.0f, 0.0f));
+        world.getComponent<Transform>(child).setParent(newParent);
+        world.update(0.016f);
+
+        glm::vec3 worldPos = world.getComponent<Transform>(child).getWorldPosition();
+        REQUIRE(worldPos.x == Catch::Approx(-3.0f).margin(0.001f));
+        REQUIRE(worldPos.y == Catch::Approx(1.0f).margin(0.001f));
+    }
+}
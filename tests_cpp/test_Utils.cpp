@@ -311,4 +311,35 @@ TEST_CASE("Utils Error Handling", "[Utils][ErrorHandling]") {
             // TODO: Fix character encoding issue in Utils::readFile error message construction
         }
     }
-}
\ No newline at end of file
+}
+#include "../src/utils/FrameArena.h"
+
+TEST_CASE("FrameArena linear allocation and reset", "[Utils][FrameArena]") {
+    VulkanMon::FrameArena arena(1024);
+
+    SECTION("Allocations respect alignment") {
+        void* ptr = arena.allocate(100, 64);
+        REQUIRE(reinterpret_cast<uintptr_t>(ptr) % 64 == 0);
+        REQUIRE(arena.usedBytes() >= 100);
+    }
+
+    SECTION("Reset retains block capacity for the next frame") {
+        arena.allocate(2048, 8); // exceeds the first block
+        size_t capacity = arena.capacityBytes();
+
+        arena.reset();
+        REQUIRE(arena.usedBytes() == 0);
+
+        arena.allocate(512, 8);
+        REQUIRE(arena.capacityBytes() == capacity);
+    }
+
+    SECTION("ArenaVector works as a standard container") {
+        VulkanMon::ArenaVector<int> values{VulkanMon::FrameArenaAllocator<int>(arena)};
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(i);
+        }
+        REQUIRE(values.size() == 100);
+        REQUIRE(values[99] == 99);
+    }
+}
@@ -16,8 +16,11 @@
 #include "../src/core/Window.h"
 #include "../src/systems/CameraSystem.h"
 #include "fixtures/TestHelpers.h"
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <set>
+#include <type_traits>
 
 using namespace VulkanMon;
 using namespace VulkanMon::Testing;
@@ -144,8 +147,107 @@ TEST_CASE("VulkanRenderer ECS Integration", "[VulkanRenderer][ECS]") {
 // Note: Full integration tests that require actual Vulkan initialization
 // should be in a separate integration test suite
 //
+TEST_CASE("VulkanRenderer GPU Pass Timings", "[VulkanRenderer][GpuTiming]") {
+    SECTION("Timings default to invalid until a frame completes") {
+        // Timestamp results arrive one frame late; consumers must check
+        // valid before trusting the values
+        VulkanMon::VulkanRenderer::GpuPassTimings timings{};
+        REQUIRE_FALSE(timings.valid);
+        REQUIRE(timings.mainPassMs == 0.0f);
+        REQUIRE(timings.instancedPassMs == 0.0f);
+        REQUIRE(timings.imguiPassMs == 0.0f);
+        REQUIRE(timings.totalMs == 0.0f);
+    }
+}
+
 // Phase 6.1 Multi-Object ECS Rendering implementation completed:
 // - Model caching system working with 4 distinct model types
 // - Per-object material assignment with 5 material presets
 // - 58-vertex high-detail UV sphere, 5-vertex pyramid, 25-vertex plane
-// - ECS integration via callback system to VulkanRenderer
\ No newline at end of file
+// - ECS integration via callback system to VulkanRenderer
+TEST_CASE("VulkanRenderer Hi-Z Occlusion Culling Design", "[VulkanRenderer][HiZ]") {
+    SECTION("Pyramid mip chain reaches 1x1 from a half-resolution base") {
+        // Mirrors the mip count computed in createHiZResources
+        auto mipLevels = [](uint32_t width, uint32_t height) {
+            uint32_t maxDim = std::max(std::max(1u, width / 2), std::max(1u, height / 2));
+            uint32_t levels = 1;
+            while ((maxDim >>= 1) > 0) levels++;
+            return levels;
+        };
+
+        REQUIRE(mipLevels(1920, 1080) == 10);  // 960x540 base -> 960 halves to 1 in 9 steps
+        REQUIRE(mipLevels(2, 2) == 1);         // 1x1 base is already the full chain
+        REQUIRE(mipLevels(1, 1) == 1);         // degenerate window still yields a valid chain
+    }
+
+    SECTION("Occlusion toggle defaults and interface") {
+        // Occlusion culling is opt-in like GPU culling and the pre-pass;
+        // the setters exist so calling systems can flip them at runtime
+        REQUIRE(std::is_member_function_pointer_v<decltype(&VulkanRenderer::setOcclusionCullingEnabled)>);
+        REQUIRE(std::is_member_function_pointer_v<decltype(&VulkanRenderer::isOcclusionCullingEnabled)>);
+    }
+}
+
+TEST_CASE("VulkanRenderer Async Shader Reload Design", "[VulkanRenderer][ShaderReload]") {
+    SECTION("Reload interface exists and does not block the frame loop") {
+        // reloadShaders kicks off a worker thread; the old pipeline keeps
+        // rendering until the replacement is swapped in between frames
+        REQUIRE(std::is_member_function_pointer_v<decltype(&VulkanRenderer::reloadShaders)>);
+
+        INFO("Async shader reload contract:");
+        INFO("- R key returns immediately, compilation happens off-thread");
+        INFO("- failed compiles log and keep the previous pipeline");
+        INFO("- swap happens after the frame fence, never mid-frame");
+    }
+}
+
+TEST_CASE("VulkanRenderer Compressed Instance Data", "[VulkanRenderer][Instancing]") {
+    SECTION("Instance data is half the size of a matrix-based layout") {
+        // position + scale, quaternion, and packed params replace the
+        // 64-byte model matrix; the cull shader and instanced.vert must
+        // agree on this exact layout
+        REQUIRE(sizeof(InstanceData) == 48);
+        REQUIRE(offsetof(InstanceData, positionScale) == 0);
+        REQUIRE(offsetof(InstanceData, rotation) == 16);
+        REQUIRE(offsetof(InstanceData, materialParams) == 32);
+    }
+
+    SECTION("Constructor packs transform and shading parameters") {
+        glm::quat rotation = glm::angleAxis(glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        InstanceData instance(glm::vec3(1.0f, 2.0f, 3.0f), rotation, 2.5f, 3, 1.0f);
+
+        REQUIRE(instance.positionScale.x == 1.0f);
+        REQUIRE(instance.positionScale.y == 2.0f);
+        REQUIRE(instance.positionScale.z == 3.0f);
+        REQUIRE(instance.positionScale.w == 2.5f);
+        REQUIRE(instance.rotation.w == Catch::Approx(rotation.w));
+        REQUIRE(instance.materialParams.x == 3.0f);  // material ID
+        REQUIRE(instance.materialParams.z == 1.0f);  // LOD level
+    }
+}
+
+TEST_CASE("VulkanRenderer Presentation Controls Design", "[VulkanRenderer][Present]") {
+    SECTION("Present mode settings cover the supported modes") {
+        // Fifo must remain available: it is the only mode the Vulkan spec
+        // guarantees and the fallback when the surface rejects the request
+        auto immediate = VulkanRenderer::PresentModeSetting::Immediate;
+        auto mailbox = VulkanRenderer::PresentModeSetting::Mailbox;
+        auto fifo = VulkanRenderer::PresentModeSetting::Fifo;
+        REQUIRE(immediate != mailbox);
+        REQUIRE(mailbox != fifo);
+        REQUIRE(immediate != fifo);
+    }
+
+    SECTION("Present stats default to zero until a frame presents") {
+        VulkanRenderer::PresentStats stats{};
+        REQUIRE(stats.presentWaitMs == 0.0f);
+        REQUIRE(stats.limiterWaitMs == 0.0f);
+    }
+
+    SECTION("Frame limiter interface") {
+        // Frame pacing is runtime-configurable like the other renderer
+        // toggles; zero means uncapped
+        REQUIRE(std::is_member_function_pointer_v<decltype(&VulkanRenderer::setFrameRateLimit)>);
+        REQUIRE(std::is_member_function_pointer_v<decltype(&VulkanRenderer::getFrameRateLimit)>);
+    }
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/WorldBuilder.h"
+#include "../src/core/World.h"
+#include "../src/components/Transform.h"
+#include "../src/utils/JobSystem.h"
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+using namespace VulkanMon;
+
+TEST_CASE("[WorldBuilder] Builds a detached world off-thread and swaps at a frame boundary", "[WorldBuilder]") {
+    WorldBuilder builder;
+
+    // Gate keeps the worker parked so the "still building" states are
+    // observable deterministically
+    std::atomic<bool> gate{false};
+    REQUIRE(builder.buildAsync([&gate](World& world) {
+        while (!gate.load()) {
+            std::this_thread::yield();
+        }
+        EntityID entity = world.createEntity();
+        Transform transform;
+        transform.setPosition(glm::vec3(7.0f, 0.0f, 0.0f));
+        world.addComponent(entity, transform);
+    }));
+
+    // Scene transitions are serial: a second build is rejected
+    REQUIRE_FALSE(builder.buildAsync([](World&) {}));
+
+    // The live world keeps running; no swap while the build is in flight
+    auto slot = std::make_unique<World>();
+    slot->createEntity();
+    REQUIRE(builder.isBuilding());
+    REQUIRE_FALSE(builder.isReady());
+    REQUIRE_FALSE(builder.trySwap(slot));
+
+    gate.store(true);
+    JobSystem::getInstance().waitIdle();
+
+    REQUIRE(builder.isReady());
+    REQUIRE(builder.trySwap(slot));
+    REQUIRE(slot->getComponentCount<Transform>() == 1);
+
+    // The swap consumed the built world
+    REQUIRE_FALSE(builder.isReady());
+    REQUIRE_FALSE(builder.trySwap(slot));
+}
+
+TEST_CASE("[WorldBuilder] Failed build produces no world", "[WorldBuilder]") {
+    WorldBuilder builder;
+
+    REQUIRE(builder.buildAsync([](World&) {
+        throw std::runtime_error("asset pack missing");
+    }));
+    JobSystem::getInstance().waitIdle();
+
+    REQUIRE(builder.isReady());
+    REQUIRE(builder.buildFailed());
+
+    // The current world survives a failed transition untouched
+    auto slot = std::make_unique<World>();
+    REQUIRE_FALSE(builder.trySwap(slot));
+    REQUIRE(slot != nullptr);
+
+    // A fresh build can be kicked off after the failure
+    REQUIRE(builder.buildAsync([](World& world) {
+        world.createEntity();
+    }));
+    JobSystem::getInstance().waitIdle();
+    REQUIRE(builder.trySwap(slot));
+    REQUIRE_FALSE(builder.buildFailed());
+}
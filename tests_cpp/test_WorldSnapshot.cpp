@@ -0,0 +1,70 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/WorldSnapshot.h"
+#include "../src/core/World.h"
+#include "../src/components/Transform.h"
+#include "../src/components/Renderable.h"
+#include "../src/components/SpatialComponent.h"
+#include <cstdio>
+#include <string>
+
+using namespace VulkanMon;
+
+namespace {
+    // Unique-ish temp path per test run
+    std::string snapshotPath() {
+        return "test_world_snapshot.bin";
+    }
+}
+
+TEST_CASE("[WorldSnapshot] Save and load round trip", "[WorldSnapshot]") {
+    const std::string path = snapshotPath();
+
+    // Build a small source world
+    World source;
+    EntityID creature = source.createEntity();
+    Transform transform;
+    transform.setPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+    transform.setScale(2.5f);
+    source.addComponent(creature, transform);
+    source.addComponent(creature, Renderable("assets/models/sphere.obj", "", 2));
+
+    SpatialComponent spatial(5.0f);
+    source.addComponent(creature, spatial);
+
+    EntityID scenery = source.createEntity();
+    source.addComponent(scenery, Transform{});
+
+    REQUIRE(WorldSnapshot::save(source, path));
+
+    SECTION("Loaded world matches component counts and data") {
+        World loaded;
+        REQUIRE(WorldSnapshot::load(loaded, path));
+
+        REQUIRE(loaded.getComponentCount<Transform>() == 2);
+        REQUIRE(loaded.getComponentCount<Renderable>() == 1);
+        REQUIRE(loaded.getComponentCount<SpatialComponent>() == 1);
+
+        // Find the restored creature through its Renderable
+        bool found = false;
+        loaded.view<Transform, Renderable>().forEach(
+            [&](EntityID, Transform& t, Renderable& r) {
+                found = true;
+                REQUIRE(r.meshPath() == "assets/models/sphere.obj");
+                REQUIRE(r.materialId == 2);
+                REQUIRE(t.position == glm::vec3(1.0f, 2.0f, 3.0f));
+                REQUIRE(t.scale == glm::vec3(2.5f));
+            });
+        REQUIRE(found);
+    }
+
+    SECTION("Load rejects files with bad magic") {
+        std::ofstream bad(path, std::ios::binary | std::ios::trunc);
+        bad << "not a snapshot";
+        bad.close();
+
+        World loaded;
+        REQUIRE_FALSE(WorldSnapshot::load(loaded, path));
+    }
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/WorldStreamer.h"
+#include "../src/core/World.h"
+#include "../src/components/Transform.h"
+#include "../src/components/Renderable.h"
+#include <filesystem>
+
+using namespace VulkanMon;
+
+namespace {
+    // Pokemon-scale world (200x200m) with one entity near the origin,
+    // one in a far cell, and a player that must never be streamed out
+    struct StreamingFixture {
+        World world;
+        WorldConfig worldConfig = WorldConfig::createPokemonWorld();
+        StreamingConfig config;
+        EntityID nearEntity = INVALID_ENTITY;
+        EntityID farEntity = INVALID_ENTITY;
+        EntityID player = INVALID_ENTITY;
+
+        StreamingFixture() {
+            config.cellDirectory = "test_world_cells";
+            std::filesystem::remove_all(config.cellDirectory);
+
+            Transform nearTransform;
+            nearTransform.setPosition(glm::vec3(0.0f, 1.0f, 0.0f));
+            nearEntity = world.createEntity();
+            world.addComponent(nearEntity, nearTransform);
+            world.addComponent(nearEntity, Renderable("assets/models/sphere.obj", "", 1));
+
+            Transform farTransform;
+            farTransform.setPosition(glm::vec3(80.0f, 1.0f, 80.0f));
+            farEntity = world.createEntity();
+            world.addComponent(farEntity, farTransform);
+
+            Transform playerTransform;
+            player = world.createEntity();
+            world.addComponent(player, playerTransform);
+        }
+    };
+}
+
+TEST_CASE("[WorldStreamer] Config validation enforces hysteresis", "[WorldStreamer]") {
+    StreamingConfig config;
+    config.loadRadius = 64.0f;
+    config.unloadRadius = 64.0f;  // no hysteresis band
+    REQUIRE_THROWS_AS(config.validate(), std::invalid_argument);
+
+    config.unloadRadius = 96.0f;
+    REQUIRE_NOTHROW(config.validate());
+}
+
+TEST_CASE("[WorldStreamer] Bake releases streamable entities to cell files", "[WorldStreamer]") {
+    StreamingFixture fixture;
+    WorldStreamer streamer(fixture.world, fixture.worldConfig, fixture.config);
+
+    REQUIRE(streamer.bakeAndRelease({fixture.player}));
+
+    // Only the excluded player survives as a live entity
+    REQUIRE(fixture.world.getComponentCount<Transform>() == 1);
+    REQUIRE(fixture.world.getComponentCount<Renderable>() == 0);
+
+    // Baked data exists on disk in the cell directory
+    REQUIRE(std::filesystem::exists(fixture.config.cellDirectory));
+    REQUIRE_FALSE(std::filesystem::is_empty(fixture.config.cellDirectory));
+}
+
+TEST_CASE("[WorldStreamer] Update streams cells around the focus position", "[WorldStreamer]") {
+    StreamingFixture fixture;
+    WorldStreamer streamer(fixture.world, fixture.worldConfig, fixture.config);
+    REQUIRE(streamer.bakeAndRelease({fixture.player}));
+
+    // Focus at the origin: the near cell comes back, the far cell stays
+    // on disk (its footprint is outside the 64m load radius)
+    streamer.update(glm::vec3(0.0f));
+    streamer.flushPendingLoads();
+    streamer.update(glm::vec3(0.0f));  // instantiation drains on update
+
+    REQUIRE(fixture.world.getComponentCount<Transform>() == 2);
+    REQUIRE(streamer.loadedEntityCount() == 1);
+
+    // The streamed entity carries its full component set back
+    bool found = false;
+    fixture.world.view<Transform, Renderable>().forEach(
+        [&](EntityID, Transform& t, Renderable& r) {
+            found = true;
+            REQUIRE(t.position == glm::vec3(0.0f, 1.0f, 0.0f));
+            REQUIRE(r.meshPath() == "assets/models/sphere.obj");
+        });
+    REQUIRE(found);
+
+    // Moving to the far corner streams that cell in too
+    streamer.update(glm::vec3(80.0f, 0.0f, 80.0f));
+    streamer.flushPendingLoads();
+    streamer.update(glm::vec3(80.0f, 0.0f, 80.0f));
+    REQUIRE(fixture.world.getComponentCount<Transform>() == 3);
+}
+
+TEST_CASE("[WorldStreamer] Release honors the hysteresis band", "[WorldStreamer]") {
+    StreamingFixture fixture;
+    WorldStreamer streamer(fixture.world, fixture.worldConfig, fixture.config);
+    REQUIRE(streamer.bakeAndRelease({fixture.player}));
+
+    // Load both cells by visiting both areas
+    streamer.update(glm::vec3(0.0f));
+    streamer.flushPendingLoads();
+    streamer.update(glm::vec3(80.0f, 0.0f, 80.0f));
+    streamer.flushPendingLoads();
+    streamer.update(glm::vec3(80.0f, 0.0f, 80.0f));
+    REQUIRE(fixture.world.getComponentCount<Transform>() == 3);
+
+    // Back at the origin the far cell sits ~85m out: past the load
+    // radius but inside the 96m unload radius, so it stays resident
+    streamer.update(glm::vec3(0.0f));
+    REQUIRE(fixture.world.getComponentCount<Transform>() == 3);
+
+    // From the opposite corner both cells exceed the unload radius and
+    // their entities are destroyed; memory tracks the active area
+    streamer.update(glm::vec3(-90.0f, 0.0f, -90.0f));
+    streamer.flushPendingLoads();
+    streamer.update(glm::vec3(-90.0f, 0.0f, -90.0f));
+    REQUIRE(fixture.world.getComponentCount<Transform>() == 1);
+    REQUIRE(streamer.loadedEntityCount() == 0);
+}
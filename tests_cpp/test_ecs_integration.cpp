@@ -136,6 +136,42 @@ TEST_CASE("[ECS Integration] Camera component functionality", "[ECS][Camera]") {
         REQUIRE(viewProjMatrix != glm::mat4(1.0f));
     }
 
+    SECTION("Frustum dirty flag only fires on real camera changes") {
+        Camera camera;
+        camera.setPerspective(90.0f, 1.0f, 1.0f, 100.0f);
+        camera.updateViewMatrix(
+            glm::vec3(0.0f, 0.0f, 0.0f),
+            glm::vec3(0.0f, 0.0f, -1.0f),
+            glm::vec3(0.0f, 1.0f, 0.0f)
+        );
+        REQUIRE(camera.frustumDirty);
+
+        camera.frustumDirty = false;
+
+        // Identical per-frame updates must not re-dirty the frustum
+        camera.updateProjectionMatrix();
+        camera.updateViewMatrix(
+            glm::vec3(0.0f, 0.0f, 0.0f),
+            glm::vec3(0.0f, 0.0f, -1.0f),
+            glm::vec3(0.0f, 1.0f, 0.0f)
+        );
+        REQUIRE_FALSE(camera.frustumDirty);
+
+        // An actual move does
+        camera.updateViewMatrix(
+            glm::vec3(1.0f, 0.0f, 0.0f),
+            glm::vec3(0.0f, 0.0f, -1.0f),
+            glm::vec3(0.0f, 1.0f, 0.0f)
+        );
+        REQUIRE(camera.frustumDirty);
+
+        // So does a projection parameter change
+        camera.frustumDirty = false;
+        camera.fov = 60.0f;
+        camera.updateProjectionMatrix();
+        REQUIRE(camera.frustumDirty);
+    }
+
     SECTION("Orthographic camera setup") {
         Camera camera;
         camera.setOrthographic(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f);